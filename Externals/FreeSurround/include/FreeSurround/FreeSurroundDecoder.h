@@ -17,8 +17,9 @@
 
 #ifndef FREESURROUND_DECODER_H
 #define FREESURROUND_DECODER_H
-#include "KissFFTR.h"
+#include "LaneFFT.h"
 #include <complex>
+#include <memory>
 #include <vector>
 
 typedef std::complex<double> cplx;
@@ -149,15 +150,16 @@ private:
   bool use_lfe;
 
   // FFT data structures
-  // left total, right total (source arrays), time-domain destination buffer
-  // array
-  std::vector<double> lt, rt, dst;
+  // left total / right total (in the first two lanes), time-domain
+  // destination buffer (four channels at a time)
+  std::vector<lane4> src, dst;
 
-  // left total / right total in frequency domain
-  std::vector<cplx> lf, rf;
+  // left total / right total in frequency domain (in the first two lanes)
+  std::vector<lane4> src_re, src_im;
 
-  // FFT buffers
-  kiss_fftr_cfg forward, inverse;
+  // the FFT, used for left total and right total at once and for four output
+  // channels at a time
+  std::unique_ptr<LaneFFT> fft;
 
   // buffers
   // whether the buffer is currently empty or dirty
@@ -170,23 +172,26 @@ private:
   std::vector<float> outbuf;
 
   // the window function, precomputed
-  std::vector<double> wnd;
+  std::vector<float> wnd;
 
   // the signal to be constructed in every channel, in the frequency domain
-  // instantiate the decoder with a given channel setup and processing block
-  // size (in samples)
-  std::vector<std::vector<cplx>> signal;
+  // (N/2+1 bins per group of four channels, one channel per lane)
+  std::vector<lane4> signal_re, signal_im;
 
   // helper functions
   inline float sqr(double x);
   inline double amplitude(const cplx &x);
   inline double phase(const cplx &x);
-  inline cplx polar(double a, double p);
+  inline cplx unit(const cplx &x);
   inline float min(double a, double b);
   inline float max(double a, double b);
   inline float clamp(double x);
   inline float sign(double x);
 
+  // access the spectrum of an output channel
+  inline cplx get_signal(unsigned int c, unsigned int f);
+  inline void set_signal(unsigned int c, unsigned int f, const cplx &x);
+
   // get the distance of the soundfield edge, along a given angle
   inline double edgedistance(double a);
 
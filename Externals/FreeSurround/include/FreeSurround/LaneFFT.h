@@ -0,0 +1,59 @@
+// Copyright (C) 2026 Dolphin Emulator Project
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+// USA.
+
+#ifndef FREESURROUND_LANEFFT_H
+#define FREESURROUND_LANEFFT_H
+#include <vector>
+
+// Four floats, one per SIMD lane. Every lane holds a sample of a different
+// signal, so that four transforms are computed at the cost of one.
+struct alignas(16) lane4 {
+  float v[4];
+};
+
+// Real-input FFT of a power-of-two size, computed for four signals at once.
+// The transform is done as a complex FFT of half the size, with the even
+// samples in the real part and the odd samples in the imaginary part.
+class LaneFFT {
+public:
+  // @param n The transform size, a power of two of at least 4.
+  explicit LaneFFT(unsigned int n);
+
+  // Transform n time-domain samples into n/2+1 frequency bins.
+  void forward(const lane4 *in, lane4 *out_re, lane4 *out_im);
+
+  // Transform n/2+1 frequency bins back into n time-domain samples. Like the
+  // forward transform, this is not normalized, so the output is scaled by n.
+  void inverse(const lane4 *in_re, const lane4 *in_im, lane4 *out);
+
+private:
+  // in-place complex FFT of size n/2, on bit reversed input
+  void transform(bool inverse_transform);
+
+  unsigned int N, M;
+
+  // twiddle factors of the complex FFT, e^(-2*pi*i*k/M) for k < M/2
+  std::vector<float> tw_re, tw_im;
+  // twiddle factors of the real FFT post-processing, e^(-2*pi*i*k/N)
+  std::vector<float> post_re, post_im;
+  // bit reversal permutation of the complex FFT
+  std::vector<unsigned int> bitrev;
+
+  // complex FFT buffers
+  std::vector<lane4> z_re, z_im;
+};
+#endif
@@ -19,6 +19,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 #include "FreeSurround/FreeSurroundDecoder.h"
 #include "FreeSurround/ChannelMaps.h"
 #include <cmath>
+#include <cstring>
 
 #undef min
 #undef max
@@ -30,10 +31,7 @@ DPL2FSDecoder::DPL2FSDecoder() {
   buffer_empty = true;
 }
 
-DPL2FSDecoder::~DPL2FSDecoder() {
-  kiss_fftr_free(forward);
-  kiss_fftr_free(inverse);
-}
+DPL2FSDecoder::~DPL2FSDecoder() = default;
 
 void DPL2FSDecoder::Init(channel_setup chsetup, unsigned int blsize,
                          unsigned int sample_rate) {
@@ -43,24 +41,23 @@ void DPL2FSDecoder::Init(channel_setup chsetup, unsigned int blsize,
     samplerate = sample_rate;
 
     // Initialize the parameters
-    wnd = std::vector<double>(N);
+    wnd = std::vector<float>(N);
     inbuf = std::vector<float>(3 * N);
-    lt = std::vector<double>(N);
-    rt = std::vector<double>(N);
-    dst = std::vector<double>(N);
-    lf = std::vector<cplx>(N / 2 + 1);
-    rf = std::vector<cplx>(N / 2 + 1);
-    forward = kiss_fftr_alloc(N, 0, 0, 0);
-    inverse = kiss_fftr_alloc(N, 1, 0, 0);
+    src = std::vector<lane4>(N, lane4{});
+    dst = std::vector<lane4>(N, lane4{});
+    src_re = std::vector<lane4>(N / 2 + 1, lane4{});
+    src_im = std::vector<lane4>(N / 2 + 1, lane4{});
+    fft = std::make_unique<LaneFFT>(N);
     C = static_cast<unsigned int>(chn_alloc[setup].size());
 
     // Allocate per-channel buffers
     outbuf.resize((N + N / 2) * C);
-    signal.resize(C, std::vector<cplx>(N));
+    signal_re.resize((C + 3) / 4 * (N / 2 + 1), lane4{});
+    signal_im.resize((C + 3) / 4 * (N / 2 + 1), lane4{});
 
     // Init the window function
     for (unsigned int k = 0; k < N; k++)
-      wnd[k] = sqrt(0.5 * (1 - cos(2 * pi * k / N)) / N);
+      wnd[k] = static_cast<float>(sqrt(0.5 * (1 - cos(2 * pi * k / N)) / N));
 
     // set default parameters
     set_circular_wrap(90);
@@ -126,8 +123,9 @@ inline double DPL2FSDecoder::amplitude(const cplx &x) {
 inline double DPL2FSDecoder::phase(const cplx &x) {
   return atan2(x.imag(), x.real());
 }
-inline cplx DPL2FSDecoder::polar(double a, double p) {
-  return cplx(a * cos(p), a * sin(p));
+inline cplx DPL2FSDecoder::unit(const cplx &x) {
+  double a = std::abs(x);
+  return a == 0 ? cplx(1, 0) : x / a;
 }
 inline float DPL2FSDecoder::min(double a, double b) {
   return static_cast<float>(a < b ? a : b);
@@ -139,6 +137,16 @@ inline float DPL2FSDecoder::clamp(double x) { return max(-1, min(1, x)); }
 inline float DPL2FSDecoder::sign(double x) {
   return static_cast<float>(x < 0 ? -1 : (x > 0 ? 1 : 0));
 }
+inline cplx DPL2FSDecoder::get_signal(unsigned int c, unsigned int f) {
+  const unsigned int i = c / 4 * (N / 2 + 1) + f;
+  return cplx(signal_re[i].v[c % 4], signal_im[i].v[c % 4]);
+}
+inline void DPL2FSDecoder::set_signal(unsigned int c, unsigned int f,
+                                      const cplx &x) {
+  const unsigned int i = c / 4 * (N / 2 + 1) + f;
+  signal_re[i].v[c % 4] = static_cast<float>(x.real());
+  signal_im[i].v[c % 4] = static_cast<float>(x.imag());
+}
 // get the distance of the soundfield edge, along a given angle
 inline double DPL2FSDecoder::edgedistance(double a) {
   return min(sqrt(1 + sqr(tan(a))), sqrt(1 + sqr(1 / tan(a))));
@@ -156,23 +164,24 @@ int DPL2FSDecoder::map_to_grid(double &x) {
 void DPL2FSDecoder::buffered_decode(float *input) {
   // demultiplex and apply window function
   for (unsigned int k = 0; k < N; k++) {
-    lt[k] = wnd[k] * input[k * 2 + 0];
-    rt[k] = wnd[k] * input[k * 2 + 1];
+    src[k].v[0] = wnd[k] * input[k * 2 + 0];
+    src[k].v[1] = wnd[k] * input[k * 2 + 1];
   }
 
-  // map into spectral domain
-  kiss_fftr(forward, &lt[0], (kiss_fft_cpx *)&lf[0]);
-  kiss_fftr(forward, &rt[0], (kiss_fft_cpx *)&rf[0]);
+  // map both into spectral domain at once
+  fft->forward(&src[0], &src_re[0], &src_im[0]);
 
   // compute multichannel output signal in the spectral domain
   for (unsigned int f = 1; f < N / 2; f++) {
+    const cplx lf(src_re[f].v[0], src_im[f].v[0]);
+    const cplx rf(src_re[f].v[1], src_im[f].v[1]);
     // get Lt/Rt amplitudes & phases
-    double ampL = amplitude(lf[f]), ampR = amplitude(rf[f]);
-    double phaseL = phase(lf[f]), phaseR = phase(rf[f]);
+    double ampL = amplitude(lf), ampR = amplitude(rf);
+    double phaseL = phase(lf), phaseR = phase(rf);
     // calculate the amplitude & phase differences
     double ampDiff =
         clamp((ampL + ampR < epsilon) ? 0 : (ampR - ampL) / (ampR + ampL));
-    double phaseDiff = abs(phaseL - phaseR);
+    double phaseDiff = std::abs(phaseL - phaseR);
     if (phaseDiff > pi)
       phaseDiff = 2 * pi - phaseDiff;
 
@@ -193,10 +202,9 @@ void DPL2FSDecoder::buffered_decode(float *input) {
 
     // get total signal amplitude
     double amp_total = sqrt(ampL * ampL + ampR * ampR);
-    // and total L/C/R signal phases
-    double phase_of[] = {
-        phaseL, atan2(lf[f].imag() + rf[f].imag(), lf[f].real() + rf[f].real()),
-        phaseR};
+    // and total L/C/R signal phases, as unit phasors (which saves computing
+    // their sine and cosine for every channel)
+    cplx phase_of[] = {unit(lf), unit(lf + rf), unit(rf)};
     // compute 2d channel map indexes p/q and update x/y to fractional offsets
     // in the map grid
     int p = map_to_grid(x), q = map_to_grid(y);
@@ -206,10 +214,11 @@ void DPL2FSDecoder::buffered_decode(float *input) {
       // interpolation) and build the
       // signal
       std::vector<float *> &a = chn_alloc[setup][c];
-      signal[c][f] = polar(
-          amp_total * ((1 - x) * (1 - y) * a[q][p] + x * (1 - y) * a[q][p + 1] +
-                       (1 - x) * y * a[q + 1][p] + x * y * a[q + 1][p + 1]),
-          phase_of[1 + static_cast<int>(sign(chn_xsf[setup][c]))]);
+      set_signal(c, f,
+                 amp_total *
+                     ((1 - x) * (1 - y) * a[q][p] + x * (1 - y) * a[q][p + 1] +
+                      (1 - x) * y * a[q + 1][p] + x * y * a[q + 1][p + 1]) *
+                     phase_of[1 + static_cast<int>(sign(chn_xsf[setup][c]))]);
     }
 
     // optionally redirect bass
@@ -219,10 +228,10 @@ void DPL2FSDecoder::buffered_decode(float *input) {
           f < lo_cut ? 1
                      : 0.5 * (1 + cos(pi * (f - lo_cut) / (hi_cut - lo_cut)));
       // assign LFE channel
-      signal[C - 1][f] = lfe_level * polar(amp_total, phase_of[1]);
+      set_signal(C - 1, f, lfe_level * amp_total * phase_of[1]);
       // subtract the signal from the other channels
       for (unsigned int c = 0; c < C - 1; c++)
-        signal[c][f] *= (1 - lfe_level);
+        set_signal(c, f, get_signal(c, f) * (1 - lfe_level));
     }
   }
 
@@ -230,42 +239,38 @@ void DPL2FSDecoder::buffered_decode(float *input) {
   memcpy(&outbuf[0], &outbuf[C * N / 2], N * C * 4);
   // and clear the rest
   memset(&outbuf[C * N], 0, C * 4 * N / 2);
-  // backtransform each channel and overlap-add
-  for (unsigned int c = 0; c < C; c++) {
+  // backtransform four channels at a time and overlap-add
+  for (unsigned int g = 0; g * 4 < C; g++) {
     // back-transform into time domain
-    kiss_fftri(inverse, (kiss_fft_cpx *)&signal[c][0], &dst[0]);
+    const unsigned int offset = g * (N / 2 + 1);
+    fft->inverse(&signal_re[offset], &signal_im[offset], &dst[0]);
     // add the result to the last 2/3 of the output buffer, windowed (and
     // remultiplex)
-    for (unsigned int k = 0; k < N; k++)
-      outbuf[C * (k + N / 2) + c] += static_cast<float>(wnd[k] * dst[k]);
+    const unsigned int lanes = C - g * 4 < 4 ? C - g * 4 : 4;
+    for (unsigned int k = 0; k < N; k++) {
+      for (unsigned int l = 0; l < lanes; l++)
+        outbuf[C * (k + N / 2) + g * 4 + l] += wnd[k] * dst[k].v[l];
+    }
   }
 }
 
 // transform amp/phase difference space into x/y soundfield space
 void DPL2FSDecoder::transform_decode(double a, double p, double &x, double &y) {
-  x = clamp(1.0047 * a + 0.46804 * a * p * p * p - 0.2042 * a * p * p * p * p +
-            0.0080586 * a * p * p * p * p * p * p * p -
-            0.0001526 * a * p * p * p * p * p * p * p * p * p * p -
-            0.073512 * a * a * a * p - 0.2499 * a * a * a * p * p * p * p +
-            0.016932 * a * a * a * p * p * p * p * p * p * p -
-            0.00027707 * a * a * a * p * p * p * p * p * p * p * p * p * p +
-            0.048105 * a * a * a * a * a * p * p * p * p * p * p * p -
-            0.0065947 * a * a * a * a * a * p * p * p * p * p * p * p * p * p *
-                p +
-            0.0016006 * a * a * a * a * a * p * p * p * p * p * p * p * p * p *
-                p * p -
-            0.0071132 * a * a * a * a * a * a * a * p * p * p * p * p * p * p *
-                p * p +
-            0.0022336 * a * a * a * a * a * a * a * p * p * p * p * p * p * p *
-                p * p * p * p -
-            0.0004804 * a * a * a * a * a * a * a * p * p * p * p * p * p * p *
-                p * p * p * p * p);
-  y = clamp(
-      0.98592 - 0.62237 * p + 0.077875 * p * p - 0.0026929 * p * p * p * p * p +
-      0.4971 * a * a * p - 0.00032124 * a * a * p * p * p * p * p * p +
-      9.2491e-006 * a * a * a * a * p * p * p * p * p * p * p * p * p * p +
-      0.051549 * a * a * a * a * a * a * a * a +
-      1.0727e-014 * a * a * a * a * a * a * a * a * a * a);
+  // polynomial fit, with the powers of a and p only computed once
+  const double a2 = a * a, a3 = a2 * a, a4 = a2 * a2, a5 = a4 * a,
+               a7 = a5 * a2, a8 = a4 * a4, a10 = a8 * a2;
+  const double p2 = p * p, p3 = p2 * p, p4 = p2 * p2, p5 = p4 * p,
+               p6 = p3 * p3, p7 = p6 * p, p9 = p7 * p2, p10 = p5 * p5,
+               p11 = p10 * p, p12 = p6 * p6;
+  x = clamp(a * (1.0047 + 0.46804 * p3 - 0.2042 * p4 + 0.0080586 * p7 -
+                 0.0001526 * p10) +
+            a3 * (-0.073512 * p - 0.2499 * p4 + 0.016932 * p7 -
+                  0.00027707 * p10) +
+            a5 * (0.048105 * p7 - 0.0065947 * p10 + 0.0016006 * p11) +
+            a7 * (-0.0071132 * p9 + 0.0022336 * p11 - 0.0004804 * p12));
+  y = clamp(0.98592 - 0.62237 * p + 0.077875 * p2 - 0.0026929 * p5 +
+            0.4971 * a2 * p - 0.00032124 * a2 * p6 +
+            9.2491e-006 * a4 * p10 + 0.051549 * a8 + 1.0727e-014 * a10);
 }
 
 // apply a circular_wrap transformation to some position
@@ -279,12 +284,12 @@ void DPL2FSDecoder::transform_circular_wrap(double &x, double &y,
   double ang = atan2(x, y), len = sqrt(x * x + y * y);
   len = len / edgedistance(ang);
   // apply circular_wrap transform
-  if (abs(ang) < baseangle / 2)
+  if (std::abs(ang) < baseangle / 2)
     // angle falls within the front region (to be enlarged)
     ang *= refangle / baseangle;
   else
     // angle falls within the rear region (to be shrunken)
-    ang = pi - (-(((refangle - 2 * pi) * (pi - abs(ang)) * sign(ang)) /
+    ang = pi - (-(((refangle - 2 * pi) * (pi - std::abs(ang)) * sign(ang)) /
                   (2 * pi - baseangle)));
   // translate back into soundfield position
   len = len * edgedistance(ang);
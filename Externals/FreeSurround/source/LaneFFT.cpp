@@ -0,0 +1,157 @@
+// Copyright (C) 2026 Dolphin Emulator Project
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301,
+// USA.
+
+
+#include "FreeSurround/LaneFFT.h"
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define LANEFFT_SSE
+#elif defined(_M_ARM64) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LANEFFT_NEON
+#endif
+
+namespace {
+#if defined(LANEFFT_SSE)
+typedef __m128 vec;
+inline vec load(const lane4 &x) { return _mm_loadu_ps(x.v); }
+inline void store(lane4 &x, vec a) { _mm_storeu_ps(x.v, a); }
+inline vec splat(float f) { return _mm_set1_ps(f); }
+inline vec add(vec a, vec b) { return _mm_add_ps(a, b); }
+inline vec sub(vec a, vec b) { return _mm_sub_ps(a, b); }
+inline vec mul(vec a, vec b) { return _mm_mul_ps(a, b); }
+#elif defined(LANEFFT_NEON)
+typedef float32x4_t vec;
+inline vec load(const lane4 &x) { return vld1q_f32(x.v); }
+inline void store(lane4 &x, vec a) { vst1q_f32(x.v, a); }
+inline vec splat(float f) { return vdupq_n_f32(f); }
+inline vec add(vec a, vec b) { return vaddq_f32(a, b); }
+inline vec sub(vec a, vec b) { return vsubq_f32(a, b); }
+inline vec mul(vec a, vec b) { return vmulq_f32(a, b); }
+#else
+typedef lane4 vec;
+inline vec load(const lane4 &x) { return x; }
+inline void store(lane4 &x, vec a) { x = a; }
+inline vec splat(float f) { return vec{{f, f, f, f}}; }
+inline vec add(vec a, vec b) {
+  for (int i = 0; i < 4; i++)
+    a.v[i] += b.v[i];
+  return a;
+}
+inline vec sub(vec a, vec b) {
+  for (int i = 0; i < 4; i++)
+    a.v[i] -= b.v[i];
+  return a;
+}
+inline vec mul(vec a, vec b) {
+  for (int i = 0; i < 4; i++)
+    a.v[i] *= b.v[i];
+  return a;
+}
+#endif
+} // namespace
+
+LaneFFT::LaneFFT(unsigned int n)
+    : N(n), M(n / 2), tw_re(M / 2), tw_im(M / 2), post_re(M + 1),
+      post_im(M + 1), bitrev(M), z_re(M), z_im(M) {
+  const double pi = 3.14159265358979323846;
+  for (unsigned int k = 0; k < M / 2; k++) {
+    tw_re[k] = static_cast<float>(cos(-2 * pi * k / M));
+    tw_im[k] = static_cast<float>(sin(-2 * pi * k / M));
+  }
+  for (unsigned int k = 0; k <= M; k++) {
+    post_re[k] = static_cast<float>(cos(-2 * pi * k / N));
+    post_im[k] = static_cast<float>(sin(-2 * pi * k / N));
+  }
+
+  unsigned int bits = 0;
+  while ((1u << bits) < M)
+    bits++;
+  for (unsigned int k = 0; k < M; k++) {
+    unsigned int r = 0;
+    for (unsigned int b = 0; b < bits; b++)
+      r |= ((k >> b) & 1) << (bits - 1 - b);
+    bitrev[k] = r;
+  }
+}
+
+void LaneFFT::transform(bool inverse_transform) {
+  // iterative radix-2 decimation in time, on bit reversed input
+  const float sign = inverse_transform ? -1.0f : 1.0f;
+  for (unsigned int len = 2; len <= M; len <<= 1) {
+    const unsigned int half = len / 2, step = M / len;
+    for (unsigned int j = 0; j < half; j++) {
+      const vec wr = splat(tw_re[j * step]), wi = splat(sign * tw_im[j * step]);
+      for (unsigned int start = j; start < M; start += len) {
+        const vec ar = load(z_re[start]), ai = load(z_im[start]);
+        const vec br = load(z_re[start + half]), bi = load(z_im[start + half]);
+        const vec tr = sub(mul(br, wr), mul(bi, wi));
+        const vec ti = add(mul(br, wi), mul(bi, wr));
+        store(z_re[start], add(ar, tr));
+        store(z_im[start], add(ai, ti));
+        store(z_re[start + half], sub(ar, tr));
+        store(z_im[start + half], sub(ai, ti));
+      }
+    }
+  }
+}
+
+void LaneFFT::forward(const lane4 *in, lane4 *out_re, lane4 *out_im) {
+  // pack the even samples into the real part, the odd ones into the imaginary
+  for (unsigned int k = 0; k < M; k++) {
+    z_re[bitrev[k]] = in[2 * k];
+    z_im[bitrev[k]] = in[2 * k + 1];
+  }
+  transform(false);
+
+  // separate the spectra of the even and odd samples, and combine them into
+  // the spectrum of the whole signal
+  const vec half = splat(0.5f);
+  for (unsigned int k = 0; k <= M; k++) {
+    const unsigned int a = k % M, b = (M - k) % M;
+    const vec ar = load(z_re[a]), ai = load(z_im[a]);
+    const vec br = load(z_re[b]), bi = load(z_im[b]);
+    const vec even_re = mul(half, add(ar, br)), even_im = mul(half, sub(ai, bi));
+    const vec odd_re = mul(half, add(ai, bi)), odd_im = mul(half, sub(br, ar));
+    const vec wr = splat(post_re[k]), wi = splat(post_im[k]);
+    store(out_re[k], add(even_re, sub(mul(wr, odd_re), mul(wi, odd_im))));
+    store(out_im[k], add(even_im, add(mul(wr, odd_im), mul(wi, odd_re))));
+  }
+}
+
+void LaneFFT::inverse(const lane4 *in_re, const lane4 *in_im, lane4 *out) {
+  // undo the separation of the even and odd spectra
+  for (unsigned int k = 0; k < M; k++) {
+    const vec ar = load(in_re[k]), ai = load(in_im[k]);
+    const vec br = load(in_re[M - k]), bi = load(in_im[M - k]);
+    const vec even_re = add(ar, br), even_im = sub(ai, bi);
+    const vec diff_re = sub(ar, br), diff_im = add(ai, bi);
+    const vec wr = splat(post_re[k]), wi = splat(post_im[k]);
+    const vec odd_re = add(mul(diff_re, wr), mul(diff_im, wi));
+    const vec odd_im = sub(mul(diff_im, wr), mul(diff_re, wi));
+    store(z_re[bitrev[k]], sub(even_re, odd_im));
+    store(z_im[bitrev[k]], add(even_im, odd_re));
+  }
+  transform(true);
+
+  for (unsigned int k = 0; k < M; k++) {
+    out[2 * k] = z_re[k];
+    out[2 * k + 1] = z_im[k];
+  }
+}
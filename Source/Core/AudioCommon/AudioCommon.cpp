@@ -12,6 +12,7 @@
 #include "AudioCommon/NullSoundStream.h"
 #include "AudioCommon/OpenALStream.h"
 #include "AudioCommon/OpenSLESStream.h"
+#include "AudioCommon/PipeWireStream.h"
 #include "AudioCommon/PulseAudioStream.h"
 #include "AudioCommon/WASAPIStream.h"
 #include "Common/FileUtil.h"
@@ -38,6 +39,8 @@ static std::unique_ptr<SoundStream> CreateSoundStreamForBackend(std::string_view
     return std::make_unique<AlsaSound>();
   else if (backend == BACKEND_PULSEAUDIO && PulseAudio::IsValid())
     return std::make_unique<PulseAudio>();
+  else if (backend == BACKEND_PIPEWIRE && PipeWireStream::IsValid())
+    return std::make_unique<PipeWireStream>();
   else if (backend == BACKEND_OPENSLES && OpenSLESStream::IsValid())
     return std::make_unique<OpenSLESStream>();
   else if (backend == BACKEND_WASAPI && WASAPIStream::IsValid())
@@ -45,7 +48,7 @@ static std::unique_ptr<SoundStream> CreateSoundStreamForBackend(std::string_view
   return {};
 }
 
-void InitSoundStream(Core::System& system)
+std::unique_ptr<SoundStream> CreateSoundStream()
 {
   std::string backend = Config::Get(Config::MAIN_AUDIO_BACKEND);
   std::unique_ptr<SoundStream> sound_stream = CreateSoundStreamForBackend(backend);
@@ -65,7 +68,7 @@ void InitSoundStream(Core::System& system)
     sound_stream->Init();
   }
 
-  system.SetSoundStream(std::move(sound_stream));
+  return sound_stream;
 }
 
 void PostInitSoundStream(Core::System& system)
@@ -125,6 +128,8 @@ std::vector<std::string> GetSoundBackends()
     backends.emplace_back(BACKEND_ALSA);
   if (PulseAudio::IsValid())
     backends.emplace_back(BACKEND_PULSEAUDIO);
+  if (PipeWireStream::IsValid())
+    backends.emplace_back(BACKEND_PIPEWIRE);
   if (OpenALStream::IsValid())
     backends.emplace_back(BACKEND_OPENAL);
   if (OpenSLESStream::IsValid())
@@ -145,12 +150,14 @@ bool SupportsDPL2Decoder(std::string_view backend)
     return true;
   if (backend == BACKEND_PULSEAUDIO)
     return true;
+  if (backend == BACKEND_PIPEWIRE)
+    return true;
   return false;
 }
 
 bool SupportsLatencyControl(std::string_view backend)
 {
-  return backend == BACKEND_OPENAL || backend == BACKEND_WASAPI;
+  return backend == BACKEND_OPENAL || backend == BACKEND_WASAPI || backend == BACKEND_PIPEWIRE;
 }
 
 bool SupportsVolumeChanges(std::string_view backend)
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -19,7 +20,9 @@ class System;
 
 namespace AudioCommon
 {
-void InitSoundStream(Core::System& system);
+// Creates and initializes the configured backend. This doesn't touch the emulated system, so it
+// may be called from any thread.
+std::unique_ptr<SoundStream> CreateSoundStream();
 void PostInitSoundStream(Core::System& system);
 void ShutdownSoundStream(Core::System& system);
 std::string GetDefaultSoundBackend();
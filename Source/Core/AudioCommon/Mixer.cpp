@@ -13,10 +13,17 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/Swap.h"
+#include "Common/Trace.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/System.h"
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
 {
   switch (quality)
@@ -58,6 +65,80 @@ void Mixer::DoState(PointerWrap& p)
     mixer.DoState(p);
 }
 
+// Polynomial Interpolators for High-Quality Resampling of
+// Over Sampled Audio by Olli Niemitalo, October 2001.
+// Page 43 -- 6-point, 3rd-order Hermite:
+// https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
+//
+// The weight of each tap is W[0] + W[1] * t + W[2] * t^2 + W[3] * t^3, with W = HERMITE_WEIGHTS.
+// Every weight is repeated for the left and right channel, so that each group of four matches two
+// stereo samples.
+alignas(16) static constexpr std::array<std::array<float, 12>, 4> HERMITE_WEIGHTS = {{
+    {0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+    {1.0f / 12, 1.0f / 12, -8.0f / 12, -8.0f / 12, 0.0f, 0.0f, 2.0f / 3, 2.0f / 3, -1.0f / 12,
+     -1.0f / 12, 0.0f, 0.0f},
+    {-2.0f / 12, -2.0f / 12, 15.0f / 12, 15.0f / 12, -7.0f / 3, -7.0f / 3, 5.0f / 3, 5.0f / 3,
+     -6.0f / 12, -6.0f / 12, 1.0f / 12, 1.0f / 12},
+    {1.0f / 12, 1.0f / 12, -7.0f / 12, -7.0f / 12, 4.0f / 3, 4.0f / 3, -4.0f / 3, -4.0f / 3,
+     7.0f / 12, 7.0f / 12, -1.0f / 12, -1.0f / 12},
+}};
+
+// Interpolates between the third and fourth of the six samples starting at front and back. The
+// granules are pre-windowed, so the front and back samples can just be added together.
+Mixer::MixerFifo::StereoPair Mixer::MixerFifo::Interpolate(const StereoPair* front,
+                                                           const StereoPair* back, float t)
+{
+  const float t2 = t * t;
+  const float t3 = t2 * t;
+  const float* f = &front->l;
+  const float* b = &back->l;
+
+#if defined(_M_X86_64)
+  const __m128 t1v = _mm_set1_ps(t);
+  const __m128 t2v = _mm_set1_ps(t2);
+  const __m128 t3v = _mm_set1_ps(t3);
+  __m128 sum = _mm_setzero_ps();
+  for (std::size_t i = 0; i < 12; i += 4)
+  {
+    __m128 weight = _mm_load_ps(&HERMITE_WEIGHTS[0][i]);
+    weight = _mm_add_ps(weight, _mm_mul_ps(_mm_load_ps(&HERMITE_WEIGHTS[1][i]), t1v));
+    weight = _mm_add_ps(weight, _mm_mul_ps(_mm_load_ps(&HERMITE_WEIGHTS[2][i]), t2v));
+    weight = _mm_add_ps(weight, _mm_mul_ps(_mm_load_ps(&HERMITE_WEIGHTS[3][i]), t3v));
+    const __m128 taps = _mm_add_ps(_mm_loadu_ps(f + i), _mm_loadu_ps(b + i));
+    sum = _mm_add_ps(sum, _mm_mul_ps(taps, weight));
+  }
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+
+  StereoPair result;
+  _mm_store_ss(&result.l, sum);
+  _mm_store_ss(&result.r, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+  return result;
+#elif defined(_M_ARM_64)
+  float32x4_t sum = vdupq_n_f32(0.0f);
+  for (std::size_t i = 0; i < 12; i += 4)
+  {
+    float32x4_t weight = vld1q_f32(&HERMITE_WEIGHTS[0][i]);
+    weight = vfmaq_n_f32(weight, vld1q_f32(&HERMITE_WEIGHTS[1][i]), t);
+    weight = vfmaq_n_f32(weight, vld1q_f32(&HERMITE_WEIGHTS[2][i]), t2);
+    weight = vfmaq_n_f32(weight, vld1q_f32(&HERMITE_WEIGHTS[3][i]), t3);
+    const float32x4_t taps = vaddq_f32(vld1q_f32(f + i), vld1q_f32(b + i));
+    sum = vfmaq_f32(sum, taps, weight);
+  }
+  const float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+  return StereoPair(vget_lane_f32(pair, 0), vget_lane_f32(pair, 1));
+#else
+  StereoPair result;
+  for (std::size_t i = 0; i < 12; i += 2)
+  {
+    const float weight = HERMITE_WEIGHTS[0][i] + HERMITE_WEIGHTS[1][i] * t +
+                         HERMITE_WEIGHTS[2][i] * t2 + HERMITE_WEIGHTS[3][i] * t3;
+    result.l += (f[i] + b[i]) * weight;
+    result.r += (f[i + 1] + b[i + 1]) * weight;
+  }
+  return result;
+#endif
+}
+
 // Executed from sound stream thread
 void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
 {
@@ -88,10 +169,20 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
   const std::size_t buffer_size_ms = m_mixer->m_config_audio_buffer_ms;
   const std::size_t buffer_size_samples = std::llround(buffer_size_ms * in_sample_rate / 1000.0);
 
-  // Limit the possible queue sizes to any number between 4 and 64.
+  // The backend takes num_samples at once, so the queue has to hold enough granules for two calls
+  // (the one in progress and the next one) or it runs dry between them, no matter how low the
+  // configured buffer size is. The peak decays slowly so that a single long call doesn't raise the
+  // latency for good.
+  m_callback_size_peak =
+      std::max(num_samples, m_callback_size_peak - (m_callback_size_peak + 255) / 256);
+  const std::size_t callback_samples =
+      std::llround(2 * m_callback_size_peak * in_sample_rate / out_sample_rate);
+  const std::size_t min_granules = callback_samples / (GRANULE_SIZE >> 1) + 1;
+
+  // Limit the possible queue sizes to any number between 2 and MAX_GRANULE_QUEUE_SIZE.
   const std::size_t buffer_size_granules =
-      std::clamp((buffer_size_samples) / (GRANULE_SIZE >> 1), static_cast<std::size_t>(4),
-                 static_cast<std::size_t>(MAX_GRANULE_QUEUE_SIZE));
+      std::clamp(std::max(buffer_size_samples / (GRANULE_SIZE >> 1), min_granules),
+                 static_cast<std::size_t>(2), static_cast<std::size_t>(MAX_GRANULE_QUEUE_SIZE));
 
   bool fade_audio = m_queue_fading.load(std::memory_order_relaxed);
 
@@ -112,31 +203,12 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
     else if (back_index < index_jump)
       fade_audio = Dequeue(&m_back);
 
-    // The Granules are pre-windowed, so we can just add them together
+    // Thanks to the padding, the samples from (ft - 2) to (ft + 3) start at index ft.
     const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
     const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
-    const StereoPair s0 = m_front[(ft - 2) & GRANULE_MASK] + m_back[(bt - 2) & GRANULE_MASK];
-    const StereoPair s1 = m_front[(ft - 1) & GRANULE_MASK] + m_back[(bt - 1) & GRANULE_MASK];
-    const StereoPair s2 = m_front[(ft + 0) & GRANULE_MASK] + m_back[(bt + 0) & GRANULE_MASK];
-    const StereoPair s3 = m_front[(ft + 1) & GRANULE_MASK] + m_back[(bt + 1) & GRANULE_MASK];
-    const StereoPair s4 = m_front[(ft + 2) & GRANULE_MASK] + m_back[(bt + 2) & GRANULE_MASK];
-    const StereoPair s5 = m_front[(ft + 3) & GRANULE_MASK] + m_back[(bt + 3) & GRANULE_MASK];
-
-    // Polynomial Interpolators for High-Quality Resampling of
-    // Over Sampled Audio by Olli Niemitalo, October 2001.
-    // Page 43 -- 6-point, 3rd-order Hermite:
-    // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
     const u32 t_frac = m_current_index & ((1 << GRANULE_FRAC_BITS) - 1);
-    const float t1 = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
-    const float t2 = t1 * t1;
-    const float t3 = t2 * t1;
-
-    StereoPair sample = (s0 * StereoPair{(+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f} +
-                         s1 * StereoPair{(+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f} +
-                         s2 * StereoPair{(+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f} +
-                         s3 * StereoPair{(+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f} +
-                         s4 * StereoPair{(+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f} +
-                         s5 * StereoPair{(+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f});
+    const float t = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
+    StereoPair sample = Interpolate(&m_front[ft], &m_back[bt], t);
 
     // Apply Fade In / Fade Out depending on if we are looping
     if (fade_audio)
@@ -165,6 +237,8 @@ std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
   if (!samples)
     return 0;
 
+  TRACE_SCOPE("Mixer::Mix");
+
   memset(samples, 0, num_samples * 2 * sizeof(s16));
 
   m_dma_mixer.Mix(samples, num_samples);
@@ -253,7 +327,7 @@ void Mixer::PushStreamingSamples(const s16* samples, std::size_t num_samples)
   {
     const s32 sample_rate_divisor = m_streaming_mixer.GetInputSampleRateDivisor();
     auto const volume = m_streaming_mixer.GetVolume();
-    m_wave_writer_dtk.AddStereoSamplesBE(samples, static_cast<u32>(num_samples),
+    m_wave_writer_dtk.AddStereoSamplesLE(samples, static_cast<u32>(num_samples),
                                          sample_rate_divisor, volume.first, volume.second);
   }
 }
@@ -539,7 +613,7 @@ void Mixer::MixerFifo::Enqueue()
   m_queue_looping.store(false, std::memory_order_relaxed);
 }
 
-bool Mixer::MixerFifo::Dequeue(Granule* granule)
+bool Mixer::MixerFifo::Dequeue(PaddedGranule* granule)
 {
   const std::size_t granule_queue_size = m_granule_queue_size.load(std::memory_order_relaxed);
   const std::size_t head = m_queue_head.load(std::memory_order_acquire);
@@ -579,7 +653,11 @@ bool Mixer::MixerFifo::Dequeue(Granule* granule)
     }
   }
 
-  *granule = m_queue[tail];
+  const Granule& queued = m_queue[tail];
+  std::copy(queued.end() - 2, queued.end(), granule->begin());
+  std::copy(queued.begin(), queued.end(), granule->begin() + 2);
+  std::copy(queued.begin(), queued.begin() + (INTERPOLATION_TAPS - 3),
+            granule->begin() + GRANULE_SIZE + 2);
   m_queue_tail.store(next_tail, std::memory_order_release);
 
   return m_queue_fading.load(std::memory_order_relaxed);
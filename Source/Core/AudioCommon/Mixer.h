@@ -28,6 +28,7 @@ public:
 
   // Called from main thread
   void PushSamples(const s16* samples, std::size_t num_samples);
+  // Unlike the DMA samples, streaming samples are little endian.
   void PushStreamingSamples(const s16* samples, std::size_t num_samples);
   void PushWiimoteSpeakerSamples(const s16* samples, std::size_t num_samples,
                                  u32 sample_rate_divisor);
@@ -99,6 +100,13 @@ private:
 
     using Granule = std::array<StereoPair, GRANULE_SIZE>;
 
+    // A granule with the samples around its ends repeated, so that the samples used to
+    // interpolate are always contiguous. Element i holds sample (i - 2) & GRANULE_MASK.
+    static constexpr std::size_t INTERPOLATION_TAPS = 6;
+    using PaddedGranule = std::array<StereoPair, GRANULE_SIZE + INTERPOLATION_TAPS - 1>;
+
+    static StereoPair Interpolate(const StereoPair* front, const StereoPair* back, float t);
+
   public:
     MixerFifo(Mixer* mixer, u32 sample_rate_divisor, bool little_endian)
         : m_mixer(mixer), m_input_sample_rate_divisor(sample_rate_divisor),
@@ -122,7 +130,11 @@ private:
     std::size_t m_next_buffer_index = 0;
 
     u32 m_current_index = 0;
-    Granule m_front, m_back;
+    PaddedGranule m_front, m_back;
+
+    // Recent maximum of the number of samples requested per call of Mix, only used on the
+    // audio thread.
+    std::size_t m_callback_size_peak = 0;
 
     std::atomic<std::size_t> m_granule_queue_size{20};
     std::array<Granule, MAX_GRANULE_QUEUE_SIZE> m_queue;
@@ -133,7 +145,7 @@ private:
     float m_fade_volume = 1.0;
 
     void Enqueue();
-    bool Dequeue(Granule* granule);
+    bool Dequeue(PaddedGranule* granule);
 
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
@@ -145,7 +157,7 @@ private:
   void RefreshConfig();
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
-  MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
+  MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, true};
   MixerFifo m_wiimote_speaker_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 3000, true};
   MixerFifo m_skylander_portal_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 8000, true};
   std::array<MixerFifo, 4> m_gba_mixers{MixerFifo{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, true},
@@ -0,0 +1,188 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/PipeWireStream.h"
+
+#include <algorithm>
+#include <array>
+
+#include <spa/param/audio/format-utils.h>
+#include <spa/pod/builder.h>
+
+#include "Common/Logging/Log.h"
+#include "Core/Config/MainSettings.h"
+
+const pw_stream_events PipeWireStream::STREAM_EVENTS = [] {
+  pw_stream_events events{};
+  events.version = PW_VERSION_STREAM_EVENTS;
+  events.state_changed = &PipeWireStream::OnStateChanged;
+  events.process = &PipeWireStream::OnProcess;
+  return events;
+}();
+
+PipeWireStream::PipeWireStream()
+{
+  pw_init(nullptr, nullptr);
+}
+
+PipeWireStream::~PipeWireStream()
+{
+  if (m_loop)
+    pw_thread_loop_stop(m_loop);
+  if (m_stream)
+    pw_stream_destroy(m_stream);
+  if (m_loop)
+    pw_thread_loop_destroy(m_loop);
+  pw_deinit();
+}
+
+bool PipeWireStream::Init()
+{
+  m_stereo = !Config::ShouldUseDPL2Decoder();
+  m_channels = m_stereo ? 2 : 6;
+  // Surround is remixed in floats, so it's also output as floats to save another conversion
+  m_bytes_per_frame = m_channels * (m_stereo ? sizeof(s16) : sizeof(float));
+
+  m_loop = pw_thread_loop_new("Audio thread - pipewire", nullptr);
+  if (!m_loop)
+  {
+    ERROR_LOG_FMT(AUDIO, "PipeWire failed to create a thread loop");
+    return false;
+  }
+
+  // The quantum is the number of frames the graph processes per cycle, which is what the latency
+  // comes down to. PipeWire picks the smallest quantum requested by any stream on the graph, within
+  // the limits of the server configuration.
+  const u32 sample_rate = m_mixer->GetSampleRate();
+  const u32 quantum = std::clamp<u32>(
+      sample_rate * std::max(Config::Get(Config::MAIN_AUDIO_LATENCY), 0) / 1000, MIN_QUANTUM,
+      MAX_QUANTUM);
+
+  pw_properties* properties =
+      pw_properties_new(PW_KEY_MEDIA_TYPE, "Audio", PW_KEY_MEDIA_CATEGORY, "Playback",
+                        PW_KEY_MEDIA_ROLE, "Game", PW_KEY_APP_NAME, "Dolphin", nullptr);
+  pw_properties_setf(properties, PW_KEY_NODE_LATENCY, "%u/%u", quantum, sample_rate);
+
+  m_stream = pw_stream_new_simple(pw_thread_loop_get_loop(m_loop), "Playback", properties,
+                                  &STREAM_EVENTS, this);
+  if (!m_stream)
+  {
+    ERROR_LOG_FMT(AUDIO, "PipeWire failed to create a stream");
+    return false;
+  }
+
+  spa_audio_info_raw info{};
+  info.format = m_stereo ? SPA_AUDIO_FORMAT_S16 : SPA_AUDIO_FORMAT_F32;
+  info.rate = sample_rate;
+  info.channels = m_channels;
+  if (m_stereo)
+  {
+    info.position[0] = SPA_AUDIO_CHANNEL_FL;
+    info.position[1] = SPA_AUDIO_CHANNEL_FR;
+  }
+  else
+  {
+    // Same order as the output of the surround decoder
+    info.position[0] = SPA_AUDIO_CHANNEL_FL;
+    info.position[1] = SPA_AUDIO_CHANNEL_FR;
+    info.position[2] = SPA_AUDIO_CHANNEL_FC;
+    info.position[3] = SPA_AUDIO_CHANNEL_LFE;
+    info.position[4] = SPA_AUDIO_CHANNEL_RL;
+    info.position[5] = SPA_AUDIO_CHANNEL_RR;
+  }
+
+  std::array<u8, 1024> pod_buffer;
+  spa_pod_builder builder;
+  spa_pod_builder_init(&builder, pod_buffer.data(), static_cast<u32>(pod_buffer.size()));
+  const spa_pod* params[] = {spa_format_audio_raw_build(&builder, SPA_PARAM_EnumFormat, &info)};
+
+  // The stream starts inactive, and SetRunning activates it
+  const auto flags = static_cast<pw_stream_flags>(
+      PW_STREAM_FLAG_AUTOCONNECT | PW_STREAM_FLAG_MAP_BUFFERS | PW_STREAM_FLAG_RT_PROCESS |
+      PW_STREAM_FLAG_INACTIVE);
+  const int result = pw_stream_connect(m_stream, PW_DIRECTION_OUTPUT, PW_ID_ANY, flags, params, 1);
+  if (result < 0)
+  {
+    ERROR_LOG_FMT(AUDIO, "PipeWire failed to connect the stream: {}", spa_strerror(result));
+    return false;
+  }
+
+  if (pw_thread_loop_start(m_loop) < 0)
+  {
+    ERROR_LOG_FMT(AUDIO, "PipeWire failed to start the thread loop");
+    return false;
+  }
+
+  NOTICE_LOG_FMT(AUDIO, "PipeWire backend using {} channels, requesting a quantum of {} frames",
+                 m_channels, quantum);
+  return true;
+}
+
+bool PipeWireStream::SetRunning(bool running)
+{
+  pw_thread_loop_lock(m_loop);
+  const int result = pw_stream_set_active(m_stream, running);
+  pw_thread_loop_unlock(m_loop);
+  return result >= 0;
+}
+
+void PipeWireStream::OnStateChanged(void* userdata, pw_stream_state old_state,
+                                    pw_stream_state state, const char* error)
+{
+  auto* stream = static_cast<PipeWireStream*>(userdata);
+  if (state == PW_STREAM_STATE_ERROR)
+    ERROR_LOG_FMT(AUDIO, "PipeWire stream error: {}", error ? error : "unknown");
+  else if (state == PW_STREAM_STATE_STREAMING)
+    stream->m_latency_reported = false;
+}
+
+void PipeWireStream::OnProcess(void* userdata)
+{
+  static_cast<PipeWireStream*>(userdata)->Process();
+}
+
+// Called on the real-time graph thread.
+void PipeWireStream::Process()
+{
+  pw_buffer* buffer = pw_stream_dequeue_buffer(m_stream);
+  if (!buffer)
+    return;
+
+  spa_data& data = buffer->buffer->datas[0];
+  if (!data.data)
+  {
+    pw_stream_queue_buffer(m_stream, buffer);
+    return;
+  }
+
+  // Only fill what the graph consumes this cycle, so that nothing is buffered ahead of it
+  u32 frames = data.maxsize / m_bytes_per_frame;
+  if (buffer->requested != 0)
+    frames = std::min<u32>(frames, static_cast<u32>(buffer->requested));
+
+  if (m_stereo)
+    m_mixer->Mix(static_cast<s16*>(data.data), frames);
+  else
+    m_mixer->MixSurround(static_cast<float*>(data.data), frames);
+
+  data.chunk->offset = 0;
+  data.chunk->stride = m_bytes_per_frame;
+  data.chunk->size = frames * m_bytes_per_frame;
+  pw_stream_queue_buffer(m_stream, buffer);
+
+  if (!m_latency_reported.exchange(true))
+    ReportLatency(frames);
+}
+
+void PipeWireStream::ReportLatency(u32 frames)
+{
+  pw_time time{};
+  if (pw_stream_get_time_n(m_stream, &time, sizeof(time)) < 0 || time.rate.denom == 0)
+    return;
+
+  // The delay is how long it takes for a sample queued now to be played
+  const double delay_ms = 1000.0 * time.delay * time.rate.num / time.rate.denom;
+  const double quantum_ms = 1000.0 * frames / m_mixer->GetSampleRate();
+  NOTICE_LOG_FMT(AUDIO, "PipeWire stream running: {} frames per cycle ({:.1f} ms), {:.1f} ms delay",
+                 frames, quantum_ms, delay_ms + quantum_ms);
+}
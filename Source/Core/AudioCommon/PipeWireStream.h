@@ -0,0 +1,52 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+
+#if defined(HAVE_PIPEWIRE) && HAVE_PIPEWIRE
+#include <pipewire/pipewire.h>
+#endif
+
+#include "AudioCommon/SoundStream.h"
+#include "Common/CommonTypes.h"
+
+// Plays audio directly through PipeWire. The stream asks the graph for a quantum that matches the
+// configured latency, and mixes in the process callback of the real-time graph thread, so no extra
+// buffering is added on top of the quantum.
+class PipeWireStream final : public SoundStream
+{
+#if defined(HAVE_PIPEWIRE) && HAVE_PIPEWIRE
+public:
+  PipeWireStream();
+  ~PipeWireStream() override;
+
+  bool Init() override;
+  bool SetRunning(bool running) override;
+  static bool IsValid() { return true; }
+
+private:
+  // The smallest and largest quantum that will be requested, in frames.
+  static constexpr u32 MIN_QUANTUM = 64;
+  static constexpr u32 MAX_QUANTUM = 8192;
+
+  static void OnStateChanged(void* userdata, pw_stream_state old_state, pw_stream_state state,
+                             const char* error);
+  static void OnProcess(void* userdata);
+
+  void Process();
+  void ReportLatency(u32 frames);
+
+  static const pw_stream_events STREAM_EVENTS;
+
+  bool m_stereo = true;
+  u32 m_channels = 2;
+  u32 m_bytes_per_frame = 0;
+
+  pw_thread_loop* m_loop = nullptr;
+  pw_stream* m_stream = nullptr;
+
+  std::atomic<bool> m_latency_reported = false;
+#endif
+};
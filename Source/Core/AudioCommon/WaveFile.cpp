@@ -47,14 +47,13 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
   }
 
   // Check if the file is already open
-  if (m_file)
+  if (m_file.IsOpen())
   {
     PanicAlertFmtT("The file {0} was already open, the file header will not be written.", filename);
     return false;
   }
 
-  m_file.Open(filename, "wb");
-  if (!m_file)
+  if (!m_file.Open(filename, "wb"))
   {
     PanicAlertFmtT(
         "The file {0} could not be opened for writing. Please check if it's already opened "
@@ -89,38 +88,52 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
   Write4("data");
   Write(100 * 1000 * 1000 - 32);
 
-  // We are now at offset 44
-  if (m_file.Tell() != 44)
-    PanicAlertFmt("Wrong offset: {}", m_file.Tell());
-
   return true;
 }
 
 void WaveFileWriter::Stop()
 {
-  m_file.Seek(4, File::SeekOrigin::Begin);
-  Write(m_audio_size + 36);
+  if (!m_file.IsOpen())
+    return;
 
-  m_file.Seek(40, File::SeekOrigin::Begin);
-  Write(m_audio_size);
+  // Wait for the samples to be written, then fix up the sizes in the header
+  m_file.Stop();
+  File::IOFile& file = m_file.GetFile();
+  const u32 riff_size = m_audio_size + 36;
+  file.Seek(4, File::SeekOrigin::Begin);
+  file.WriteArray(&riff_size, 1);
+  file.Seek(40, File::SeekOrigin::Begin);
+  file.WriteArray(&m_audio_size, 1);
 
   m_file.Close();
 }
 
 void WaveFileWriter::Write(u32 value)
 {
-  m_file.WriteArray(&value, 1);
+  m_file.Write(&value, sizeof(value));
 }
 
 void WaveFileWriter::Write4(const char* ptr)
 {
-  m_file.WriteBytes(ptr, 4);
+  m_file.Write(ptr, 4);
 }
 
 void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
                                         u32 sample_rate_divisor, int l_volume, int r_volume)
 {
-  if (!m_file)
+  AddStereoSamples(sample_data, count, sample_rate_divisor, l_volume, r_volume, true);
+}
+
+void WaveFileWriter::AddStereoSamplesLE(const short* sample_data, u32 count,
+                                        u32 sample_rate_divisor, int l_volume, int r_volume)
+{
+  AddStereoSamples(sample_data, count, sample_rate_divisor, l_volume, r_volume, false);
+}
+
+void WaveFileWriter::AddStereoSamples(const short* sample_data, u32 count, u32 sample_rate_divisor,
+                                      int l_volume, int r_volume, bool big_endian)
+{
+  if (!m_file.IsOpen())
   {
     ERROR_LOG_FMT(AUDIO, "WaveFileWriter - file not open.");
     return;
@@ -149,8 +162,10 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
   for (u32 i = 0; i < count; i++)
   {
     // Flip the audio channels from RL to LR
-    m_conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
-    m_conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
+    m_conv_buffer[2 * i] = big_endian ? Common::swap16((u16)sample_data[2 * i + 1]) :
+                                        sample_data[2 * i + 1];
+    m_conv_buffer[2 * i + 1] = big_endian ? Common::swap16((u16)sample_data[2 * i]) :
+                                            sample_data[2 * i];
 
     // Apply volume (volume ranges from 0 to 256)
     m_conv_buffer[2 * i] = m_conv_buffer[2 * i] * l_volume / 256;
@@ -167,6 +182,8 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
     m_current_sample_rate_divisor = sample_rate_divisor;
   }
 
-  m_file.WriteBytes(m_conv_buffer.data(), count * 4);
-  m_audio_size += count * 4;
+  // If the writer can't keep up, the samples are dropped rather than stalling the caller. Only
+  // count what is actually written, so that the header stays consistent.
+  if (m_file.Write(m_conv_buffer.data(), count * 4))
+    m_audio_size += count * 4;
 }
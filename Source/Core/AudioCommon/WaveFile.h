@@ -16,8 +16,8 @@
 #include <array>
 #include <string>
 
+#include "Common/AsyncFileWriter.h"
 #include "Common/CommonTypes.h"
-#include "Common/IOFile.h"
 
 class WaveFileWriter
 {
@@ -37,15 +37,21 @@ public:
   // big endian
   void AddStereoSamplesBE(const short* sample_data, u32 count, u32 sample_rate_divisor,
                           int l_volume, int r_volume);
+  // little endian
+  void AddStereoSamplesLE(const short* sample_data, u32 count, u32 sample_rate_divisor,
+                          int l_volume, int r_volume);
   u32 GetAudioSize() const { return m_audio_size; }
 
 private:
   static constexpr size_t BUFFER_SIZE = 32 * 1024;
 
+  void AddStereoSamples(const short* sample_data, u32 count, u32 sample_rate_divisor,
+                        int l_volume, int r_volume, bool big_endian);
   void Write(u32 value);
   void Write4(const char* ptr);
 
-  File::IOFile m_file;
+  // Samples are written on a separate thread, so that disk I/O never stalls the emulation.
+  Common::AsyncFileWriter m_file{"Audio Dump Writer"};
   std::string m_basename;
   u32 m_file_index = 0;
   u32 m_audio_size = 0;
@@ -79,6 +79,7 @@ void ARM64XEmitter::SetCodePtrUnsafe(u8* ptr, u8* end, bool write_failed)
   m_code = ptr;
   m_code_end = end;
   m_write_failed = write_failed;
+  m_writable_offset = Common::GetWritableAliasOffset(ptr);
 }
 
 void ARM64XEmitter::SetCodePtr(u8* ptr, u8* end, bool write_failed)
@@ -118,7 +119,7 @@ void ARM64XEmitter::Write32(u32 value)
     return;
   }
 
-  std::memcpy(m_code, &value, sizeof(u32));
+  std::memcpy(m_code + m_writable_offset, &value, sizeof(u32));
   m_code += sizeof(u32);
 }
 
@@ -730,7 +731,7 @@ void ARM64XEmitter::SetJumpTarget(FixupBranch const& branch)
     break;
   }
 
-  std::memcpy(branch.ptr, &inst, sizeof(inst));
+  std::memcpy(branch.ptr + m_writable_offset, &inst, sizeof(inst));
 }
 
 FixupBranch ARM64XEmitter::WriteFixupBranch()
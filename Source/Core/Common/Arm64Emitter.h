@@ -620,6 +620,9 @@ private:
 
   u8* m_lastCacheFlushEnd = nullptr;
 
+  // The distance from m_code to where it's written, which differs for dual-mapped code space.
+  std::ptrdiff_t m_writable_offset = 0;
+
   // Set to true when a write request happens that would write past m_code_end.
   // Must be cleared with SetCodePtr() afterwards.
   bool m_write_failed = false;
@@ -671,7 +674,8 @@ protected:
 public:
   ARM64XEmitter() = default;
   ARM64XEmitter(u8* code, u8* code_end)
-      : m_code(code), m_code_end(code_end), m_lastCacheFlushEnd(code)
+      : m_code(code), m_code_end(code_end), m_lastCacheFlushEnd(code),
+        m_writable_offset(Common::GetWritableAliasOffset(code))
   {
   }
 
@@ -1470,9 +1474,10 @@ private:
     // AArch64: 0xD4200000 = BRK 0
     constexpr u32 brk_0 = 0xD4200000;
 
+    u8* const writable_region = Common::GetWritableAlias(region);
     for (size_t i = 0; i < region_size; i += sizeof(u32))
     {
-      std::memcpy(region + i, &brk_0, sizeof(u32));
+      std::memcpy(writable_region + i, &brk_0, sizeof(u32));
     }
   }
 };
@@ -0,0 +1,128 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/AsyncFileWriter.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+
+namespace Common
+{
+AsyncFileWriter::AsyncFileWriter(std::string thread_name, size_t buffer_size)
+    : m_thread_name(std::move(thread_name)), m_buffer_size(std::bit_ceil(buffer_size))
+{
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+  Close();
+}
+
+bool AsyncFileWriter::Open(const std::string& filename, const char* openmode)
+{
+  Close();
+
+  if (!m_file.Open(filename, openmode))
+    return false;
+
+  m_buffer.resize(m_buffer_size);
+  m_buffer_mask = m_buffer_size - 1;
+  m_write_position = 0;
+  m_read_position = 0;
+  m_total_queued = 0;
+  m_total_dropped = 0;
+  m_running = true;
+  m_thread = std::thread(&AsyncFileWriter::ThreadLoop, this);
+  return true;
+}
+
+bool AsyncFileWriter::Write(const void* data1, size_t size1, const void* data2, size_t size2)
+{
+  const u64 write_position = m_write_position.load(std::memory_order_relaxed);
+  const u64 read_position = m_read_position.load(std::memory_order_acquire);
+  const size_t free_space = m_buffer.size() - static_cast<size_t>(write_position - read_position);
+  if (!m_running.load(std::memory_order_relaxed) || size1 + size2 > free_space)
+  {
+    m_total_dropped += size1 + size2;
+    return false;
+  }
+
+  u64 position = write_position;
+  for (const auto& [data, size] : {std::pair(data1, size1), std::pair(data2, size2)})
+  {
+    if (size == 0)
+      continue;
+    const size_t offset = static_cast<size_t>(position) & m_buffer_mask;
+    const size_t first_part = std::min(size, m_buffer.size() - offset);
+    std::memcpy(m_buffer.data() + offset, data, first_part);
+    std::memcpy(m_buffer.data(), static_cast<const u8*>(data) + first_part, size - first_part);
+    position += size;
+  }
+  m_write_position.store(position, std::memory_order_release);
+  m_total_queued += size1 + size2;
+
+  // The writer thread also wakes up on its own regularly, so it only needs to be woken up early
+  // once a good part of the buffer is in use.
+  if (position - read_position >= m_buffer.size() / 4)
+    m_data_event.Set();
+
+  return true;
+}
+
+void AsyncFileWriter::WriteQueuedData()
+{
+  const u64 read_position = m_read_position.load(std::memory_order_relaxed);
+  const u64 write_position = m_write_position.load(std::memory_order_acquire);
+  const size_t size = static_cast<size_t>(write_position - read_position);
+  if (size == 0)
+    return;
+
+  const size_t offset = static_cast<size_t>(read_position) & m_buffer_mask;
+  const size_t first_part = std::min(size, m_buffer.size() - offset);
+  m_file.WriteBytes(m_buffer.data() + offset, first_part);
+  m_file.WriteBytes(m_buffer.data(), size - first_part);
+  m_read_position.store(write_position, std::memory_order_release);
+}
+
+void AsyncFileWriter::ThreadLoop()
+{
+  Common::SetCurrentThreadName(m_thread_name.c_str());
+
+  while (m_running.load(std::memory_order_relaxed))
+  {
+    WriteQueuedData();
+    m_data_event.WaitFor(std::chrono::milliseconds(100));
+  }
+
+  WriteQueuedData();
+}
+
+void AsyncFileWriter::Stop()
+{
+  if (!m_thread.joinable())
+    return;
+
+  m_running = false;
+  m_data_event.Set();
+  m_thread.join();
+
+  if (m_total_dropped != 0)
+  {
+    WARN_LOG_FMT(COMMON, "{}: dropped {} of {} bytes because the disk couldn't keep up",
+                 m_thread_name, m_total_dropped, m_total_queued + m_total_dropped);
+  }
+}
+
+void AsyncFileWriter::Close()
+{
+  Stop();
+  m_file.Close();
+  m_buffer = {};
+}
+}  // namespace Common
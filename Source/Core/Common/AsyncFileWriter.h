@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/IOFile.h"
+
+namespace Common
+{
+// Writes a file on a dedicated thread, for dumps where the producer must never block on disk I/O
+// (e.g. audio dumps written from the emulation threads).
+//
+// Data is copied into a fixed-size lock-free ring buffer by a single producer thread. If the
+// writer thread falls behind far enough for the buffer to fill up, writes are dropped in whole and
+// counted instead of blocking.
+class AsyncFileWriter final
+{
+public:
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 16 * 1024 * 1024;
+
+  // The buffer size is rounded up to a power of two. It's only allocated while a file is open.
+  explicit AsyncFileWriter(std::string thread_name, size_t buffer_size = DEFAULT_BUFFER_SIZE);
+  ~AsyncFileWriter();
+
+  AsyncFileWriter(const AsyncFileWriter&) = delete;
+  AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+  // Opens the file and starts the writer thread.
+  bool Open(const std::string& filename, const char* openmode);
+  bool IsOpen() const { return m_file.IsOpen(); }
+
+  // Queues data to be written. Returns false if there isn't enough space in the buffer, in which
+  // case nothing is written. The two-part version writes both parts or neither.
+  bool Write(const void* data, size_t size) { return Write(data, size, nullptr, 0); }
+  bool Write(const void* data1, size_t size1, const void* data2, size_t size2);
+
+  // Waits for all queued data to be written and stops the writer thread. The file stays open and
+  // can then be accessed directly with GetFile (e.g. to fix up a header), until Close or Open.
+  void Stop();
+  File::IOFile& GetFile() { return m_file; }
+
+  // Stops the writer thread and closes the file.
+  void Close();
+
+  u64 GetQueuedBytes() const { return m_total_queued; }
+  u64 GetDroppedBytes() const { return m_total_dropped; }
+
+private:
+  void ThreadLoop();
+  void WriteQueuedData();
+
+  std::string m_thread_name;
+  size_t m_buffer_size;
+  std::vector<u8> m_buffer;
+  size_t m_buffer_mask = 0;
+
+  // Total number of bytes pushed by the producer and written by the writer thread. The positions
+  // in the ring buffer are these modulo the buffer size.
+  std::atomic<u64> m_write_position = 0;
+  std::atomic<u64> m_read_position = 0;
+
+  u64 m_total_queued = 0;
+  u64 m_total_dropped = 0;
+
+  File::IOFile m_file;
+  std::thread m_thread;
+  std::atomic<bool> m_running = false;
+  Common::Event m_data_event;
+};
+}  // namespace Common
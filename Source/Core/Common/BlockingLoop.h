@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <thread>
 
+#include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/Thread.h"
 
 namespace Common
 {
@@ -45,6 +49,7 @@ public:
       return;
 
     // Else as the worker thread may sleep now, we have to set the event.
+    m_wakeup_time.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
     m_new_work_event.Set();
   }
 
@@ -176,17 +181,31 @@ public:
         [[fallthrough]];
 
       case STATE_SLEEPING:
-        // Just relax
-        if (timeout > 0)
-        {
-          m_new_work_event.WaitFor(std::chrono::milliseconds(timeout));
-        }
-        else
+      {
+        const TimePoint idle_start = Clock::now();
+
+        // Spinning may leave an already signaled event behind, which only costs a spurious
+        // iteration on the next sleep.
+        if (!SpinForWork(idle_start))
         {
-          m_new_work_event.Wait();
+          // Just relax
+          if (timeout > 0)
+          {
+            m_new_work_event.WaitFor(std::chrono::milliseconds(timeout));
+          }
+          else
+          {
+            m_new_work_event.Wait();
+          }
+
+          if (m_running_state.load() != STATE_SLEEPING)
+            UpdateWakeupLatency();
         }
+
+        m_idle_time.fetch_add((Clock::now() - idle_start).count(), std::memory_order_relaxed);
         break;
       }
+      }
     }
 
     // Shutdown down, so get a safe state
@@ -232,7 +251,56 @@ public:
   // that we will fall back from the busy loop to sleeping.
   void AllowSleep() { m_may_sleep.Set(); }
 
+  // Lets the worker spin for a while before it goes to sleep, as waking up a sleeping thread
+  // takes several microseconds on most systems. The spin time matches the measured cost of a
+  // wakeup, which bounds the time spent spinning to the time that sleeping would have cost.
+  // Use max_spin = 0 to always sleep right away, which is the default.
+  void SetAdaptiveSpin(std::chrono::microseconds max_spin)
+  {
+    m_max_spin.store(std::chrono::duration_cast<DT>(max_spin).count(), std::memory_order_relaxed);
+  }
+
+  // Returns the time the worker spent waiting for new work since the last call.
+  DT TakeIdleTime() { return DT(m_idle_time.exchange(0, std::memory_order_relaxed)); }
+
 private:
+  // Returns true if new work has arrived, or false if the worker should go to sleep.
+  bool SpinForWork(TimePoint spin_start)
+  {
+    const DT spin_time =
+        std::min(DT(m_max_spin.load(std::memory_order_relaxed)), m_wakeup_latency);
+    if (spin_time <= DT::zero())
+      return false;
+
+    const TimePoint spin_end = spin_start + spin_time;
+    do
+    {
+      for (int i = 0; i < 64; ++i)
+      {
+        if (m_running_state.load(std::memory_order_relaxed) != STATE_SLEEPING)
+          return true;
+        Common::YieldCPU();
+      }
+    } while (Clock::now() < spin_end);
+
+    return false;
+  }
+
+  void UpdateWakeupLatency()
+  {
+    const DT latency =
+        Clock::now().time_since_epoch() - DT(m_wakeup_time.load(std::memory_order_relaxed));
+
+    // Periodic timeouts and wakeups from a previous spin aren't caused by the last Wakeup() call,
+    // and neither are huge outliers worth taking into account.
+    if (latency <= DT::zero() || latency > std::chrono::milliseconds(1))
+      return;
+
+    // Exponential moving average, so a single slow wakeup doesn't change much
+    m_wakeup_latency += (latency - m_wakeup_latency) / 8;
+  }
+
+
   std::mutex m_wait_lock;
   std::mutex m_prepare_lock;
 
@@ -253,5 +321,10 @@ private:
 
   Flag m_may_sleep;  // If this is set, we fall back from the busy loop to an event based
                      // synchronization.
+
+  std::atomic<DT::rep> m_max_spin{0};
+  std::atomic<DT::rep> m_idle_time{0};
+  std::atomic<DT::rep> m_wakeup_time{0};  // Only updated when the worker has to be woken up.
+  DT m_wakeup_latency{};                 // Only accessed by the worker thread.
 };
 }  // namespace Common
@@ -30,6 +30,8 @@ struct CPUInfo
   bool bSSE4_2 = false;
   bool bLZCNT = false;
   bool bAVX = false;
+  bool bAVX2 = false;
+  bool bAVX512F = false;
   bool bBMI1 = false;
   bool bBMI2 = false;
   // PDEP and PEXT are ridiculously slow on AMD Zen1, Zen1+ and Zen2 (Family 17h)
@@ -37,6 +39,7 @@ struct CPUInfo
   bool bFMA = false;
   bool bFMA4 = false;
   bool bAES = false;
+  bool bPCLMULQDQ = false;
   bool bMOVBE = false;
   // This flag indicates that the hardware supports some mode
   // in which denormal inputs _and_ outputs are automatically set to (signed) zero.
@@ -0,0 +1,392 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/CPUTopology.h"
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <set>
+#include <string_view>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <processthreadsapi.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#include <sys/qos.h>
+#include <sys/sysctl.h>
+#elif defined(__linux__)
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#endif
+
+namespace Common
+{
+namespace
+{
+#ifdef _WIN32
+CPUTopology DetectCPUTopology()
+{
+  DWORD length = 0;
+  GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+  std::vector<u8> buffer(length);
+  auto* const info = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data());
+  if (length == 0 || !GetLogicalProcessorInformationEx(RelationAll, info, &length))
+    return {};
+
+  const auto for_each_entry = [&](const auto& func) {
+    for (DWORD offset = 0; offset < length;)
+    {
+      const auto& entry =
+          *reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+      func(entry);
+      offset += entry.Size;
+    }
+  };
+  const auto for_each_processor = [](const GROUP_AFFINITY& affinity, const auto& func) {
+    for (u32 bit = 0; bit < 64; ++bit)
+    {
+      if (affinity.Mask & (KAFFINITY(1) << bit))
+        func(affinity.Group * 64 + bit);
+    }
+  };
+
+  CPUTopology topology;
+  BYTE last_level_cache = 0;
+  u32 physical_core = 0;
+  for_each_entry([&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& entry) {
+    if (entry.Relationship == RelationCache)
+    {
+      last_level_cache = std::max(last_level_cache, entry.Cache.Level);
+    }
+    else if (entry.Relationship == RelationProcessorCore)
+    {
+      for (WORD i = 0; i < entry.Processor.GroupCount; ++i)
+      {
+        for_each_processor(entry.Processor.GroupMask[i], [&](u32 id) {
+          topology.processors.push_back({id, physical_core, entry.Processor.EfficiencyClass, 0});
+        });
+      }
+      physical_core++;
+    }
+  });
+
+  for_each_entry([&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& entry) {
+    if (entry.Relationship != RelationCache || entry.Cache.Level != last_level_cache)
+      return;
+
+    std::optional<u32> cache_group;
+    for_each_processor(entry.Cache.GroupMask, [&](u32 id) {
+      cache_group = cache_group.value_or(id);
+      for (LogicalProcessor& processor : topology.processors)
+      {
+        if (processor.id == id)
+          processor.cache_group = *cache_group;
+      }
+    });
+  });
+
+  return topology;
+}
+#elif defined(__APPLE__)
+std::optional<u32> GetSysctlValue(const std::string& name)
+{
+  u32 value = 0;
+  size_t size = sizeof(value);
+  if (sysctlbyname(name.c_str(), &value, &size, nullptr, 0) != 0)
+    return std::nullopt;
+  return value;
+}
+
+CPUTopology DetectCPUTopology()
+{
+  // macOS doesn't tell which processor is which, only how many there are of each performance
+  // level, with level 0 being the fastest. Each level shares its caches.
+  CPUTopology topology;
+  const u32 num_levels = GetSysctlValue("hw.nperflevels").value_or(0);
+  u32 id = 0;
+  u32 physical_core = 0;
+  for (u32 level = 0; level < num_levels; ++level)
+  {
+    const std::optional<u32> physical = GetSysctlValue(fmt::format("hw.perflevel{}.physicalcpu", level));
+    const std::optional<u32> logical = GetSysctlValue(fmt::format("hw.perflevel{}.logicalcpu", level));
+    if (!physical || !logical || *physical == 0)
+      return {};
+
+    for (u32 i = 0; i < *logical; ++i)
+    {
+      topology.processors.push_back(
+          {id++, physical_core + i * *physical / *logical, num_levels - 1 - level, level});
+    }
+    physical_core += *physical;
+  }
+  return topology;
+}
+#elif defined(__linux__)
+std::optional<std::string> ReadSysfsValue(const std::string& path)
+{
+  std::string value;
+  if (!File::ReadFileToString(path, value))
+    return std::nullopt;
+  return std::string(StripWhitespace(value));
+}
+
+// Parses lists like "0-3,8-11".
+std::vector<u32> ParseProcessorList(const std::string& list)
+{
+  std::vector<u32> processors;
+  for (const std::string& range : SplitString(list, ','))
+  {
+    const std::vector<std::string> bounds = SplitString(range, '-');
+    u32 first;
+    u32 last;
+    if (bounds.empty() || !TryParse(bounds.front(), &first, 10) ||
+        !TryParse(bounds.back(), &last, 10))
+    {
+      continue;
+    }
+    for (u32 id = first; id <= last; ++id)
+      processors.push_back(id);
+  }
+  return processors;
+}
+
+CPUTopology DetectCPUTopology()
+{
+  const std::optional<std::string> online = ReadSysfsValue("/sys/devices/system/cpu/online");
+  if (!online)
+    return {};
+
+  // Intel hybrid CPUs list their P-cores separately. ARM CPUs report the relative capacity of
+  // each core instead.
+  std::set<u32> intel_performance_cores;
+  if (const std::optional<std::string> cores = ReadSysfsValue("/sys/devices/cpu_core/cpus"))
+  {
+    for (const u32 id : ParseProcessorList(*cores))
+      intel_performance_cores.insert(id);
+  }
+
+  CPUTopology topology;
+  for (const u32 id : ParseProcessorList(*online))
+  {
+    const std::string path = fmt::format("/sys/devices/system/cpu/cpu{}/", id);
+    LogicalProcessor processor{id, id, 0, 0};
+
+    if (const auto siblings = ReadSysfsValue(path + "topology/thread_siblings_list"))
+    {
+      const std::vector<u32> sibling_ids = ParseProcessorList(*siblings);
+      if (!sibling_ids.empty())
+        processor.physical_core = sibling_ids.front();
+    }
+
+    if (!intel_performance_cores.empty())
+    {
+      processor.performance_class = intel_performance_cores.contains(id) ? 1 : 0;
+    }
+    else if (const auto capacity = ReadSysfsValue(path + "cpu_capacity"))
+    {
+      TryParse(*capacity, &processor.performance_class, 10);
+    }
+
+    u32 last_level = 0;
+    for (u32 index = 0;; ++index)
+    {
+      const std::string cache_path = fmt::format("{}cache/index{}/", path, index);
+      const std::optional<std::string> level_str = ReadSysfsValue(cache_path + "level");
+      const std::optional<std::string> shared = ReadSysfsValue(cache_path + "shared_cpu_list");
+      u32 level;
+      if (!level_str || !shared || !TryParse(*level_str, &level, 10))
+        break;
+
+      const std::vector<u32> shared_ids = ParseProcessorList(*shared);
+      if (level >= last_level && !shared_ids.empty())
+      {
+        last_level = level;
+        processor.cache_group = shared_ids.front();
+      }
+    }
+
+    topology.processors.push_back(processor);
+  }
+  return topology;
+}
+#else
+CPUTopology DetectCPUTopology()
+{
+  return {};
+}
+#endif
+
+const ThreadPlacement& GetThreadPlacement()
+{
+  static const ThreadPlacement placement = [] {
+    const CPUTopology& topology = GetCPUTopology();
+    ThreadPlacement result = ComputeThreadPlacement(topology);
+    INFO_LOG_FMT(COMMON, "CPU topology: {}", topology.Summarize());
+    INFO_LOG_FMT(COMMON, "Thread placement: CPU thread on [{}], GPU thread on [{}], background on [{}]",
+                 fmt::join(result.cpu_thread, ", "), fmt::join(result.gpu_thread, ", "),
+                 fmt::join(result.background, ", "));
+    return result;
+  }();
+  return placement;
+}
+}  // namespace
+
+bool CPUTopology::IsHybrid() const
+{
+  return std::ranges::adjacent_find(processors, std::ranges::not_equal_to{},
+                                    &LogicalProcessor::performance_class) != processors.end();
+}
+
+std::string CPUTopology::Summarize() const
+{
+  std::set<u32> physical_cores;
+  std::set<u32> performance_classes;
+  std::set<u32> cache_groups;
+  for (const LogicalProcessor& processor : processors)
+  {
+    physical_cores.insert(processor.physical_core);
+    performance_classes.insert(processor.performance_class);
+    cache_groups.insert(processor.cache_group);
+  }
+
+  return fmt::format(
+      "{} logical processors, {} physical cores, {} performance classes, {} cache groups",
+      processors.size(), physical_cores.size(), performance_classes.size(), cache_groups.size());
+}
+
+const CPUTopology& GetCPUTopology()
+{
+  static const CPUTopology topology = DetectCPUTopology();
+  return topology;
+}
+
+ThreadPlacement ComputeThreadPlacement(const CPUTopology& topology)
+{
+  struct PhysicalCore
+  {
+    u32 id;
+    u32 performance_class;
+    u32 cache_group;
+    std::vector<u32> processors;
+  };
+
+  std::map<u32, PhysicalCore> cores_by_id;
+  std::set<u32> cache_groups;
+  for (const LogicalProcessor& processor : topology.processors)
+  {
+    PhysicalCore& core = cores_by_id
+                             .try_emplace(processor.physical_core, processor.physical_core,
+                                          processor.performance_class, processor.cache_group)
+                             .first->second;
+    core.processors.push_back(processor.id);
+    cache_groups.insert(processor.cache_group);
+  }
+
+  ThreadPlacement placement;
+  const bool hybrid = topology.IsHybrid();
+  if (cores_by_id.size() < 2 || (!hybrid && cache_groups.size() < 2))
+    return placement;
+
+  // Fastest first. Of equally fast cores, the last ones are preferred, since the OS tends to handle
+  // interrupts on the first core.
+  std::vector<PhysicalCore> cores;
+  for (auto& [id, core] : cores_by_id)
+    cores.push_back(std::move(core));
+  std::ranges::sort(cores, [](const PhysicalCore& a, const PhysicalCore& b) {
+    if (a.performance_class != b.performance_class)
+      return a.performance_class > b.performance_class;
+    return a.id > b.id;
+  });
+
+  const PhysicalCore& cpu_core = cores[0];
+  auto gpu_core = std::ranges::find_if(cores.begin() + 1, cores.end(), [&](const PhysicalCore& c) {
+    return c.performance_class == cores[1].performance_class &&
+           c.cache_group == cpu_core.cache_group;
+  });
+  if (gpu_core == cores.end())
+    gpu_core = cores.begin() + 1;
+
+  placement.cpu_thread = cpu_core.processors;
+  placement.gpu_thread = gpu_core->processors;
+
+  if (hybrid)
+  {
+    const u32 slowest_class = cores.back().performance_class;
+    for (const PhysicalCore& core : cores)
+    {
+      if (core.performance_class == slowest_class && &core != &cpu_core && &core != &*gpu_core)
+        placement.background.insert(placement.background.end(), core.processors.begin(),
+                                    core.processors.end());
+    }
+    std::ranges::sort(placement.background);
+  }
+
+  std::ranges::sort(placement.cpu_thread);
+  std::ranges::sort(placement.gpu_thread);
+  return placement;
+}
+
+void SetCurrentThreadRole(ThreadRole role)
+{
+  const ThreadPlacement& placement = GetThreadPlacement();
+  const std::vector<u32>& processors = role == ThreadRole::EmulatedCPU ? placement.cpu_thread :
+                                       role == ThreadRole::EmulatedGPU ? placement.gpu_thread :
+                                                                         placement.background;
+
+#ifdef _WIN32
+  // Hard affinities fight the Windows thread scheduler's own hybrid core handling, so the threads
+  // only get an ideal processor. Background threads are marked as power efficient instead, which
+  // is what moves them to E-cores.
+  if (!processors.empty() && role != ThreadRole::Background)
+  {
+    PROCESSOR_NUMBER number{};
+    number.Group = static_cast<WORD>(processors.front() / 64);
+    number.Number = static_cast<BYTE>(processors.front() % 64);
+    SetThreadIdealProcessorEx(GetCurrentThread(), &number, nullptr);
+  }
+
+  THREAD_POWER_THROTTLING_STATE state{};
+  state.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+  state.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+  state.StateMask = role == ThreadRole::Background ? THREAD_POWER_THROTTLING_EXECUTION_SPEED : 0;
+  SetThreadInformation(GetCurrentThread(), ThreadPowerThrottling, &state, sizeof(state));
+#elif defined(__APPLE__)
+  // macOS doesn't allow pinning threads. The QoS class decides which cores a thread runs on.
+  pthread_set_qos_class_self_np(
+      role == ThreadRole::Background ? QOS_CLASS_UTILITY : QOS_CLASS_USER_INTERACTIVE, 0);
+#elif defined(__linux__)
+  if (!processors.empty())
+  {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const u32 id : processors)
+    {
+      if (id < CPU_SETSIZE)
+        CPU_SET(id, &cpu_set);
+    }
+    sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+  }
+
+  // Lowering the priority is always allowed. Android also lets apps raise the priority of their own
+  // threads, which is what keeps the emulation threads from being moved to little cores.
+  if (role == ThreadRole::Background)
+    setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), 10);
+#ifdef ANDROID
+  else
+    setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), -4);
+#endif
+#endif
+}
+}  // namespace Common
@@ -0,0 +1,66 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+struct LogicalProcessor
+{
+  // The number the OS uses for the processor.
+  u32 id = 0;
+  // The same for SMT siblings, which share one physical core.
+  u32 physical_core = 0;
+  // Higher for faster cores. All cores have the same class on CPUs which aren't hybrid.
+  u32 performance_class = 0;
+  // The same for processors sharing their last level cache, e.g. a CCX on AMD CPUs or a cluster
+  // on ARM CPUs.
+  u32 cache_group = 0;
+};
+
+struct CPUTopology
+{
+  std::vector<LogicalProcessor> processors;
+
+  // Whether the CPU has cores of different performance classes, e.g. P-cores and E-cores.
+  bool IsHybrid() const;
+  std::string Summarize() const;
+};
+
+// Detected once. Empty if the topology can't be detected on this host.
+const CPUTopology& GetCPUTopology();
+
+struct ThreadPlacement
+{
+  // Logical processors to run the emulated CPU thread on, sharing one physical core. Empty if the
+  // threads are better left to the OS scheduler.
+  std::vector<u32> cpu_thread;
+  // Logical processors to run the GPU thread on, on a different physical core than the CPU thread.
+  std::vector<u32> gpu_thread;
+  // Logical processors to run background work on, e.g. shader compiling. Empty to run it anywhere.
+  std::vector<u32> background;
+};
+
+// The CPU and GPU threads get the fastest two physical cores, preferring cores which share a cache
+// so that the FIFO doesn't cross it. Threads are only pinned if the CPU is hybrid or has several
+// cache groups, since otherwise all cores are equally good. Background work is restricted to the
+// slowest cores of hybrid CPUs.
+ThreadPlacement ComputeThreadPlacement(const CPUTopology& topology);
+
+enum class ThreadRole
+{
+  EmulatedCPU,
+  EmulatedGPU,
+  Background,
+};
+
+// Places the calling thread according to ComputeThreadPlacement(GetCPUTopology()), and sets the
+// OS's scheduling hints for its role: QoS classes on macOS, power throttling on Windows and thread
+// priorities on Android.
+void SetCurrentThreadRole(ThreadRole role);
+}  // namespace Common
@@ -49,14 +49,22 @@ public:
   CodeBlock& operator=(CodeBlock&&) = delete;
 
   // Call this before you generate any code.
-  void AllocCodeSpace(size_t size)
+  void AllocCodeSpace(size_t size, bool huge_pages = false)
   {
     region_size = size;
     total_region_size = size;
+    region = nullptr;
     if constexpr (executable)
-      region = static_cast<u8*>(Common::AllocateExecutableMemory(total_region_size));
+    {
+      if constexpr (Common::PREFER_DUAL_MAPPED_CODE_SPACE)
+        region = static_cast<u8*>(Common::AllocateDualMappedExecutableMemory(total_region_size));
+      if (!region)
+        region = static_cast<u8*>(Common::AllocateExecutableMemory(total_region_size, huge_pages));
+    }
     else
+    {
       region = static_cast<u8*>(Common::AllocateMemoryPages(total_region_size));
+    }
     T::SetCodePtr(region, region + size);
   }
 
@@ -89,13 +97,21 @@ public:
   {
     return ptr >= region && ptr < (region + total_region_size);
   }
+  // The executable alias of dual-mapped memory is never writable, so only the writable alias
+  // needs its protection changed.
   void WriteProtect(bool allow_execute)
   {
-    Common::WriteProtectMemory(region, region_size, allow_execute);
+    if (u8* const writable = Common::GetWritableAlias(region); writable != region)
+      Common::WriteProtectMemory(writable, region_size);
+    else
+      Common::WriteProtectMemory(region, region_size, allow_execute);
   }
   void UnWriteProtect(bool allow_execute)
   {
-    Common::UnWriteProtectMemory(region, region_size, allow_execute);
+    if (u8* const writable = Common::GetWritableAlias(region); writable != region)
+      Common::UnWriteProtectMemory(writable, region_size);
+    else
+      Common::UnWriteProtectMemory(region, region_size, allow_execute);
   }
   void ResetCodePtr() { T::SetCodePtr(region, region + region_size); }
   size_t GetSpaceLeft() const
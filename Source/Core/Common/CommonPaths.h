@@ -54,6 +54,7 @@
 #define REDUMPCACHE_DIR "Redump"
 #define SHADERCACHE_DIR "Shaders"
 #define RETROACHIEVEMENTSCACHE_DIR "RetroAchievements"
+#define BOOTSNAPSHOTCACHE_DIR "BootSnapshots"
 #define STATESAVES_DIR "StateSaves"
 #define SCREENSHOTS_DIR "ScreenShots"
 #define LOAD_DIR "Load"
@@ -87,6 +88,7 @@
 #define RESOURCEPACK_DIR "ResourcePacks"
 #define DYNAMICINPUT_DIR "DynamicInputTextures"
 #define GRAPHICSMOD_DIR "GraphicMods"
+#define SHADERBUNDLES_DIR "ShaderBundles"
 #define FIRMWARE_DIR "Firmware"
 #define WIISDSYNC_DIR "WiiSDSync"
 #define ASSEMBLY_DIR "SavedAssembly"
@@ -125,6 +127,7 @@
 // Files in the directory returned by GetUserPath(D_MEMORYWATCHER_IDX)
 #define MEMORYWATCHER_LOCATIONS "Locations.txt"
 #define MEMORYWATCHER_SOCKET "MemoryWatcher"
+#define MEMORYWATCHER_RING "Ring.bin"
 
 // Sys files
 #define TOTALDB "totaldb.dsy"
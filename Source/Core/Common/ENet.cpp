@@ -62,4 +62,36 @@ bool SendPacket(ENetPeer* socket, const sf::Packet& packet, u8 channel_id)
 
   return true;
 }
+
+bool SendPacketToPeers(std::span<ENetPeer* const> sockets, const sf::Packet& packet,
+                       u8 channel_id)
+{
+  if (sockets.empty())
+    return true;
+
+  ENetPacket* epac =
+      enet_packet_create(packet.getData(), packet.getDataSize(), ENET_PACKET_FLAG_RELIABLE);
+  if (!epac)
+  {
+    ERROR_LOG_FMT(NETPLAY, "Failed to create ENetPacket ({} bytes).", packet.getDataSize());
+    return false;
+  }
+
+  bool success = true;
+  for (ENetPeer* socket : sockets)
+  {
+    const int result = enet_peer_send(socket, channel_id, epac);
+    if (result != 0)
+    {
+      ERROR_LOG_FMT(NETPLAY, "Failed to send ENetPacket (error code {}).", result);
+      success = false;
+    }
+  }
+
+  // ENet only takes ownership of the packet once it has been queued for a peer.
+  if (epac->referenceCount == 0)
+    enet_packet_destroy(epac);
+
+  return success;
+}
 }  // namespace Common::ENet
@@ -0,0 +1,108 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/FileLock.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+
+namespace Common
+{
+FileLock::~FileLock()
+{
+  Close();
+}
+
+bool FileLock::Open(const std::string& path)
+{
+  Close();
+
+#ifdef _WIN32
+  const HANDLE file = CreateFileW(UTF8ToWString(path).c_str(), GENERIC_READ | GENERIC_WRITE,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                  OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to open lock file {}: {}", path, GetLastErrorString());
+    return false;
+  }
+  m_handle = file;
+#else
+  m_fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (m_fd == -1)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to open lock file {}: {}", path, LastStrerrorString());
+    return false;
+  }
+#endif
+
+  return true;
+}
+
+void FileLock::Close()
+{
+  if (!IsOpen())
+    return;
+
+#ifdef _WIN32
+  CloseHandle(m_handle);
+  m_handle = nullptr;
+#else
+  close(m_fd);
+  m_fd = -1;
+#endif
+}
+
+bool FileLock::IsOpen() const
+{
+#ifdef _WIN32
+  return m_handle != nullptr;
+#else
+  return m_fd != -1;
+#endif
+}
+
+void FileLock::lock()
+{
+  if (!IsOpen())
+    return;
+
+#ifdef _WIN32
+  OVERLAPPED overlapped{};
+  if (!LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped))
+    ERROR_LOG_FMT(COMMON, "Failed to lock file: {}", GetLastErrorString());
+#else
+  while (flock(m_fd, LOCK_EX) != 0)
+  {
+    if (errno != EINTR)
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to lock file: {}", LastStrerrorString());
+      break;
+    }
+  }
+#endif
+}
+
+void FileLock::unlock()
+{
+  if (!IsOpen())
+    return;
+
+#ifdef _WIN32
+  OVERLAPPED overlapped{};
+  UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+#else
+  flock(m_fd, LOCK_UN);
+#endif
+}
+}  // namespace Common
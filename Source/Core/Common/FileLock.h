@@ -0,0 +1,41 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+namespace Common
+{
+// An exclusive lock on a file, which serializes access to files shared by several processes. The
+// lock is advisory: processes which don't take it can still read and write the shared files.
+//
+// Satisfies BasicLockable, so it can be used with std::lock_guard. Locking and unlocking do
+// nothing if the lock file isn't open.
+class FileLock final
+{
+public:
+  FileLock() = default;
+  ~FileLock();
+
+  FileLock(const FileLock&) = delete;
+  FileLock& operator=(const FileLock&) = delete;
+
+  // Creates the lock file if it doesn't exist. Returns false if it couldn't be opened.
+  bool Open(const std::string& path);
+  void Close();
+
+  bool IsOpen() const;
+
+  // Blocks until no other process holds the lock. The lock isn't recursive.
+  void lock();
+  void unlock();
+
+private:
+#ifdef _WIN32
+  void* m_handle = nullptr;
+#else
+  int m_fd = -1;
+#endif
+};
+}  // namespace Common
@@ -68,6 +68,7 @@ enum
   D_RESOURCEPACK_IDX,
   D_DYNAMICINPUT_IDX,
   D_GRAPHICSMOD_IDX,
+  D_SHADERBUNDLES_IDX,
   D_FIRMWARE_IDX,
   D_GBAUSER_IDX,
   D_GBASAVES_IDX,
@@ -93,6 +94,7 @@ enum
   F_GCSRAM_IDX,
   F_MEMORYWATCHERLOCATIONS_IDX,
   F_MEMORYWATCHERSOCKET_IDX,
+  F_MEMORYWATCHERRING_IDX,
   F_WIISDCARDIMAGE_IDX,
   F_DUALSHOCKUDPCLIENTCONFIG_IDX,
   F_FREELOOKCONFIG_IDX,
@@ -0,0 +1,173 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// A hash multimap which stores its elements inline in a single array, using open addressing with
+// linear probing. Lookups touch a few adjacent slots rather than chasing node pointers, which
+// makes this a better fit than std::unordered_multimap for small, frequently searched indices.
+//
+// Only element-wise operations are provided. Pointers to values are invalidated by any insertion
+// or removal, and the map must not be modified from within the callbacks.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatMultiMap final
+{
+public:
+  void Insert(const Key& key, Value value)
+  {
+    if ((m_size + 1) * 4 > m_slots.size() * 3)
+      Grow();
+
+    const u64 hash = HashKey(key);
+    size_t index = GetHomeSlot(hash);
+    while (m_slots[index].used)
+      index = (index + 1) & m_mask;
+
+    Slot& slot = m_slots[index];
+    slot.hash = hash;
+    slot.key = key;
+    slot.value = std::move(value);
+    slot.used = true;
+    ++m_size;
+  }
+
+  // Returns the first value stored under the key for which the predicate returns true, or nullptr.
+  template <typename Predicate>
+  Value* FindIf(const Key& key, Predicate pred)
+  {
+    const size_t index = FindSlot(key, pred);
+    return index != NOT_FOUND ? &m_slots[index].value : nullptr;
+  }
+
+  // Removes the first value stored under the key for which the predicate returns true.
+  template <typename Predicate>
+  bool EraseIf(const Key& key, Predicate pred)
+  {
+    const size_t index = FindSlot(key, pred);
+    if (index == NOT_FOUND)
+      return false;
+
+    EraseSlot(index);
+    return true;
+  }
+
+  bool Erase(const Key& key, const Value& value)
+  {
+    return EraseIf(key, [&value](const Value& v) { return v == value; });
+  }
+
+  // Calls the function with each key and value, in no particular order.
+  template <typename Function>
+  void ForEach(Function func) const
+  {
+    for (const Slot& slot : m_slots)
+    {
+      if (slot.used)
+        func(slot.key, slot.value);
+    }
+  }
+
+  void Clear()
+  {
+    m_slots.clear();
+    m_mask = 0;
+    m_shift = 64;
+    m_size = 0;
+  }
+
+  size_t Size() const { return m_size; }
+  bool Empty() const { return m_size == 0; }
+
+private:
+  struct Slot
+  {
+    u64 hash = 0;
+    Key key{};
+    Value value{};
+    bool used = false;
+  };
+
+  static constexpr size_t NOT_FOUND = ~size_t{0};
+  static constexpr size_t MIN_CAPACITY = 16;
+
+  // Fibonacci hashing, so that weak hashes like the identity hash of integers still spread out
+  // over the table.
+  static u64 HashKey(const Key& key)
+  {
+    return static_cast<u64>(Hash{}(key)) * 0x9E3779B97F4A7C15;
+  }
+
+  size_t GetHomeSlot(u64 hash) const { return static_cast<size_t>(hash >> m_shift); }
+
+  template <typename Predicate>
+  size_t FindSlot(const Key& key, Predicate& pred)
+  {
+    if (m_size == 0)
+      return NOT_FOUND;
+
+    const u64 hash = HashKey(key);
+    for (size_t index = GetHomeSlot(hash); m_slots[index].used; index = (index + 1) & m_mask)
+    {
+      Slot& slot = m_slots[index];
+      if (slot.hash == hash && slot.key == key && pred(slot.value))
+        return index;
+    }
+
+    return NOT_FOUND;
+  }
+
+  // Backward shift deletion: elements after the removed one are moved back into the hole when
+  // that brings them closer to their home slot, so lookups never need tombstones.
+  void EraseSlot(size_t hole)
+  {
+    for (size_t index = (hole + 1) & m_mask; m_slots[index].used; index = (index + 1) & m_mask)
+    {
+      const size_t home = GetHomeSlot(m_slots[index].hash);
+      if (((index - home) & m_mask) >= ((index - hole) & m_mask))
+      {
+        m_slots[hole] = std::move(m_slots[index]);
+        hole = index;
+      }
+    }
+
+    m_slots[hole] = Slot{};
+    --m_size;
+  }
+
+  void Grow()
+  {
+    std::vector<Slot> old_slots = std::exchange(m_slots, {});
+    const size_t capacity = std::max(old_slots.size() * 2, MIN_CAPACITY);
+    m_slots.resize(capacity);
+    m_mask = capacity - 1;
+    m_shift = 64 - std::countr_zero(capacity);
+
+    for (Slot& slot : old_slots)
+    {
+      if (!slot.used)
+        continue;
+
+      size_t index = GetHomeSlot(slot.hash);
+      while (m_slots[index].used)
+        index = (index + 1) & m_mask;
+      m_slots[index] = std::move(slot);
+    }
+  }
+
+  std::vector<Slot> m_slots;
+  size_t m_mask = 0;
+  int m_shift = 64;
+  size_t m_size = 0;
+};
+}  // namespace Common
@@ -7,6 +7,7 @@
 #include <bit>
 #include <cstring>
 
+#include <xxhash.h>
 #include <zlib.h>
 
 #include "Common/BitUtils.h"
@@ -24,9 +25,162 @@
 
 namespace Common
 {
+// zlib-ng picks vectorized CRC32 and Adler-32 implementations at runtime. Other zlib builds, such
+// as a system zlib, only have portable ones, so those get the accelerated versions below instead.
+#ifndef ZLIBNG_VERSION
+#if defined(_M_X86_64)
+
+FUNCTION_TARGET_PCLMUL
+static __m128i FoldBlock(__m128i x, __m128i k, __m128i next)
+{
+  const __m128i low = _mm_clmulepi64_si128(x, k, 0x00);
+  const __m128i high = _mm_clmulepi64_si128(x, k, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(low, high), next);
+}
+
+// Folds 16-byte blocks into the CRC using carry-less multiplication, as described in Intel's "Fast
+// CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction". crc is the inverted CRC
+// state. len must be at least 64 and a multiple of 16.
+FUNCTION_TARGET_PCLMUL
+static u32 FoldCRC32_PCLMULQDQ(u32 crc, const u8* data, size_t len)
+{
+  const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+  const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+  const __m128i k5 = _mm_set_epi64x(0, 0x0163cd6124);
+  const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+  const __m128i low_mask = _mm_setr_epi32(-1, 0, -1, 0);
+
+  const auto load = [](const u8* ptr) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+  };
+
+  __m128i x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+  __m128i x2 = load(data + 16);
+  __m128i x3 = load(data + 32);
+  __m128i x4 = load(data + 48);
+  data += 64;
+  len -= 64;
+
+  for (; len >= 64; data += 64, len -= 64)
+  {
+    x1 = FoldBlock(x1, k1k2, load(data));
+    x2 = FoldBlock(x2, k1k2, load(data + 16));
+    x3 = FoldBlock(x3, k1k2, load(data + 32));
+    x4 = FoldBlock(x4, k1k2, load(data + 48));
+  }
+
+  x1 = FoldBlock(x1, k3k4, x2);
+  x1 = FoldBlock(x1, k3k4, x3);
+  x1 = FoldBlock(x1, k3k4, x4);
+  for (; len >= 16; data += 16, len -= 16)
+    x1 = FoldBlock(x1, k3k4, load(data));
+
+  // Reduce to 64 bits, then to 32 bits with a Barrett reduction.
+  __m128i x2r = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2r);
+  x2r = _mm_srli_si128(x1, 4);
+  x1 = _mm_and_si128(x1, low_mask);
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k5, 0x00), x2r);
+
+  x2r = _mm_and_si128(x1, low_mask);
+  x2r = _mm_clmulepi64_si128(x2r, poly, 0x10);
+  x2r = _mm_and_si128(x2r, low_mask);
+  x2r = _mm_clmulepi64_si128(x2r, poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2r);
+  return static_cast<u32>(_mm_extract_epi32(x1, 1));
+}
+
+static u32 UpdateCRC32_PCLMULQDQ(u32 crc, const u8* data, size_t len)
+{
+  if (len >= 64)
+  {
+    const size_t folded_len = len & ~size_t(15);
+    crc = ~FoldCRC32_PCLMULQDQ(~crc, data, folded_len);
+    data += folded_len;
+    len -= folded_len;
+  }
+  return crc32_z(crc, data, len);
+}
+
+// Sums 32-byte blocks at a time, weighting each byte's contribution to the second sum with
+// multiply-adds.
+FUNCTION_TARGET_SSSE3
+static u32 HashAdler32_SSSE3(u32 adler, const u8* data, size_t len)
+{
+  constexpr u32 BASE = 65521;
+  // The most blocks which can be summed before the second sum could overflow.
+  constexpr size_t MAX_BLOCKS = 5552 / 32;
+
+  u32 s1 = adler & 0xffff;
+  u32 s2 = adler >> 16;
+
+  const __m128i weights1 =
+      _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+  const __m128i weights2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i ones = _mm_set1_epi16(1);
+  const auto horizontal_sum = [](__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    return static_cast<u32>(_mm_cvtsi128_si32(v));
+  };
+
+  size_t blocks = len / 32;
+  len -= blocks * 32;
+  while (blocks != 0)
+  {
+    const size_t n = std::min(blocks, MAX_BLOCKS);
+    blocks -= n;
+
+    // Each block adds s1 as of its start 32 times to s2, which v_prev_s1 accumulates.
+    __m128i v_prev_s1 = _mm_cvtsi32_si128(static_cast<int>(s1 * n));
+    __m128i v_s2 = _mm_cvtsi32_si128(static_cast<int>(s2));
+    __m128i v_s1 = zero;
+    for (size_t i = 0; i < n; ++i, data += 32)
+    {
+      const __m128i bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+      const __m128i bytes2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16));
+      v_prev_s1 = _mm_add_epi32(v_prev_s1, v_s1);
+      v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes1, zero));
+      v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, weights1), ones));
+      v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes2, zero));
+      v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, weights2), ones));
+    }
+    v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_prev_s1, 5));
+
+    s1 = (s1 + horizontal_sum(v_s1)) % BASE;
+    s2 = horizontal_sum(v_s2) % BASE;
+  }
+
+  return adler32_z(s1 | (s2 << 16), data, len);
+}
+
+#elif defined(_M_ARM_64)
+
+static u32 UpdateCRC32_ARMv8(u32 crc, const u8* data, size_t len)
+{
+  // The CRC32 instructions (unlike CRC32C) use the same polynomial as zlib.
+  crc = ~crc;
+  for (; len >= 8; data += 8, len -= 8)
+  {
+    u64 value;
+    std::memcpy(&value, data, sizeof(value));
+    crc = __crc32d(crc, value);
+  }
+  for (; len != 0; ++data, --len)
+    crc = __crc32b(crc, *data);
+  return ~crc;
+}
+
+#endif
+#endif
+
 u32 HashAdler32(const u8* data, size_t len)
 {
-  // Use fast implementation from zlib-ng
+#if !defined(ZLIBNG_VERSION) && defined(_M_X86_64)
+  if (cpu_info.bSSSE3)
+    return HashAdler32_SSSE3(1, data, len);
+#endif
   return adler32_z(1, data, len);
 }
 
@@ -424,6 +578,12 @@ static u64 SetHash64Function(const u8* src, u32 len, u32 samples)
 
 u64 GetHash64(const u8* src, u32 len, u32 samples)
 {
+  // XXH3 is vectorized and processes many lanes at once, so it beats the CRC32 loop for hashing
+  // whole textures, and mixes far better than combining four CRC32s does. Sampling reads scattered
+  // words, which doesn't vectorize, so that still uses the CRC32 and Murmur variants.
+  if (samples == 0 || samples >= len / 8)
+    return XXH3_64bits(src, len);
+
   return s_texture_hash_func(src, len, samples);
 }
 
@@ -434,6 +594,15 @@ u32 StartCRC32()
 
 u32 UpdateCRC32(u32 crc, const u8* data, size_t len)
 {
+#ifndef ZLIBNG_VERSION
+#if defined(_M_X86_64)
+  if (cpu_info.bPCLMULQDQ && cpu_info.bSSE4_1)
+    return UpdateCRC32_PCLMULQDQ(crc, data, len);
+#elif defined(_M_ARM_64)
+  if (cpu_info.bCRC32)
+    return UpdateCRC32_ARMv8(crc, data, len);
+#endif
+#endif
   return crc32_z(crc, data, len);
 }
 
@@ -446,4 +615,9 @@ u32 ComputeCRC32(std::string_view data)
 {
   return ComputeCRC32(reinterpret_cast<const u8*>(data.data()), data.size());
 }
+Hash128 ComputeHash128(const void* data, size_t len)
+{
+  const XXH128_hash_t hash = XXH3_128bits(data, len);
+  return {hash.low64, hash.high64};
+}
 }  // namespace Common
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <compare>
 #include <cstddef>
+#include <functional>
 #include <string_view>
 
 #include "Common/CommonTypes.h"
@@ -14,11 +16,33 @@ u32 HashAdler32(const u8* data, size_t len);
 // JUNK. DO NOT USE FOR NEW THINGS
 u32 HashEctor(const u8* data, size_t len);
 
-// Specialized hash function used for the texture cache
+// Specialized hash function used for the texture cache. With samples set to 0, all of the data
+// is hashed; otherwise only roughly that many u64s spread over the data are.
 u64 GetHash64(const u8* src, u32 len, u32 samples);
 
 u32 StartCRC32();
 u32 UpdateCRC32(u32 crc, const u8* data, size_t len);
 u32 ComputeCRC32(const u8* data, size_t len);
 u32 ComputeCRC32(std::string_view data);
+
+struct Hash128
+{
+  u64 low;
+  u64 high;
+
+  constexpr auto operator<=>(const Hash128&) const = default;
+};
+
+// A fast general purpose 128-bit hash (XXH3) for cache keys. Its output is stable, so it can be
+// used for keys which are stored on disk.
+Hash128 ComputeHash128(const void* data, size_t len);
 }  // namespace Common
+
+template <>
+struct std::hash<Common::Hash128>
+{
+  size_t operator()(const Common::Hash128& hash) const noexcept
+  {
+    return static_cast<size_t>(hash.low);
+  }
+};
@@ -3,18 +3,140 @@
 
 #include "Common/HttpRequest.h"
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <future>
+#include <map>
 #include <mutex>
+#include <thread>
+#include <utility>
 
 #include <curl/curl.h>
 
 #include "Common/Logging/Log.h"
-#include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 
 namespace Common
 {
+namespace
+{
+// Runs the transfers of all HttpRequests on one curl multi handle, so that connections and DNS
+// lookups are reused between them, and requests to the same server are multiplexed over HTTP/2
+// when curl supports it. TLS sessions are shared too, for when a new connection is needed.
+class TransferThread final
+{
+public:
+  using DoneCallback = std::function<void(CURLcode result)>;
+
+  static TransferThread& GetInstance()
+  {
+    static TransferThread s_instance;
+    return s_instance;
+  }
+
+  TransferThread(const TransferThread&) = delete;
+  TransferThread& operator=(const TransferThread&) = delete;
+
+  ~TransferThread()
+  {
+    m_shutdown = true;
+    curl_multi_wakeup(m_multi.get());
+    m_thread.join();
+  }
+
+  CURLSH* GetShare() const { return m_share.get(); }
+  bool IsCurrentThread() const { return std::this_thread::get_id() == m_thread.get_id(); }
+
+  // The handle must be left alone until the callback has been called.
+  void Start(CURL* handle, DoneCallback callback)
+  {
+    {
+      std::lock_guard lk(m_new_transfers_lock);
+      m_new_transfers.emplace_back(handle, std::move(callback));
+    }
+    curl_multi_wakeup(m_multi.get());
+  }
+
+private:
+  TransferThread()
+  {
+    curl_multi_setopt(m_multi.get(), CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+
+    curl_share_setopt(m_share.get(), CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(m_share.get(), CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_share.get(), CURLSHOPT_LOCKFUNC,
+                      +[](CURL*, curl_lock_data data, curl_lock_access, void* userdata) {
+                        static_cast<TransferThread*>(userdata)->m_share_locks[data].lock();
+                      });
+    curl_share_setopt(m_share.get(), CURLSHOPT_UNLOCKFUNC,
+                      +[](CURL*, curl_lock_data data, void* userdata) {
+                        static_cast<TransferThread*>(userdata)->m_share_locks[data].unlock();
+                      });
+
+    m_thread = std::thread(&TransferThread::ThreadFunc, this);
+  }
+
+  void ThreadFunc()
+  {
+    Common::SetCurrentThreadName("HTTP transfers");
+
+    std::map<CURL*, DoneCallback> transfers;
+    while (!m_shutdown)
+    {
+      std::vector<std::pair<CURL*, DoneCallback>> new_transfers;
+      {
+        std::lock_guard lk(m_new_transfers_lock);
+        new_transfers.swap(m_new_transfers);
+      }
+      for (auto& [handle, callback] : new_transfers)
+      {
+        if (curl_multi_add_handle(m_multi.get(), handle) == CURLM_OK)
+          transfers.emplace(handle, std::move(callback));
+        else
+          callback(CURLE_FAILED_INIT);
+      }
+
+      int running_transfers;
+      curl_multi_perform(m_multi.get(), &running_transfers);
+
+      int queued_messages;
+      while (const CURLMsg* message = curl_multi_info_read(m_multi.get(), &queued_messages))
+      {
+        if (message->msg != CURLMSG_DONE)
+          continue;
+
+        CURL* const handle = message->easy_handle;
+        const CURLcode result = message->data.result;
+        curl_multi_remove_handle(m_multi.get(), handle);
+        // The callback may start another transfer on the same handle.
+        auto transfer = transfers.extract(handle);
+        transfer.mapped()(result);
+      }
+
+      curl_multi_poll(m_multi.get(), nullptr, 0, 1000, nullptr);
+    }
+
+    for (const auto& [handle, callback] : transfers)
+      curl_multi_remove_handle(m_multi.get(), handle);
+  }
+
+  std::unique_ptr<CURLM, decltype(&curl_multi_cleanup)> m_multi{curl_multi_init(),
+                                                                 curl_multi_cleanup};
+  std::unique_ptr<CURLSH, decltype(&curl_share_cleanup)> m_share{curl_share_init(),
+                                                                  curl_share_cleanup};
+  std::array<std::mutex, CURL_LOCK_DATA_LAST> m_share_locks;
+
+  std::thread m_thread;
+  std::atomic<bool> m_shutdown = false;
+
+  std::mutex m_new_transfers_lock;
+  std::vector<std::pair<CURL*, DoneCallback>> m_new_transfers;
+};
+}  // namespace
+
 class HttpRequest::Impl final
 {
 public:
@@ -35,17 +157,35 @@ public:
   Response Fetch(const std::string& url, Method method, const Headers& headers, const u8* payload,
                  size_t size, AllowedReturnCodes codes = AllowedReturnCodes::Ok_Only,
                  std::span<Multiform> multiform = {});
+  void FetchAsync(const std::string& url, Method method, const Headers& headers,
+                  std::vector<u8> payload, AllowedReturnCodes codes, ResponseCallback callback);
 
   static int CurlProgressCallback(Impl* impl, curl_off_t dltotal, curl_off_t dlnow,
                                   curl_off_t ultotal, curl_off_t ulnow);
   std::string EscapeComponent(const std::string& string);
 
 private:
+  void StartTransfer(const std::string& url, Method method, const Headers& headers,
+                     const u8* payload, size_t size, AllowedReturnCodes codes,
+                     std::span<Multiform> multiform, ResponseCallback callback);
+  void FinishTransfer(CURLcode result);
+
   static inline std::once_flag s_curl_was_initialized;
   ProgressCallback m_callback;
   Headers m_response_headers;
   std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> m_curl{nullptr, curl_easy_cleanup};
   std::string m_error_string;
+
+  // State of the transfer in progress
+  std::string m_url;
+  Method m_method = Method::GET;
+  AllowedReturnCodes m_codes = AllowedReturnCodes::Ok_Only;
+  std::vector<u8> m_payload;
+  std::unique_ptr<curl_mime, decltype(&curl_mime_free)> m_form{nullptr, curl_mime_free};
+  std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> m_header_list{nullptr,
+                                                                            curl_slist_free_all};
+  std::vector<u8> m_buffer;
+  ResponseCallback m_on_done;
 };
 
 HttpRequest::HttpRequest(std::chrono::milliseconds timeout_ms, ProgressCallback callback)
@@ -96,6 +236,20 @@ HttpRequest::Response HttpRequest::Get(const std::string& url, const Headers& he
   return m_impl->Fetch(url, Impl::Method::GET, headers, nullptr, 0, codes);
 }
 
+void HttpRequest::GetAsync(const std::string& url, ResponseCallback callback,
+                           const Headers& headers, AllowedReturnCodes codes)
+{
+  m_impl->FetchAsync(url, Impl::Method::GET, headers, {}, codes, std::move(callback));
+}
+
+void HttpRequest::PostAsync(const std::string& url, std::vector<u8> payload,
+                            ResponseCallback callback, const Headers& headers,
+                            AllowedReturnCodes codes)
+{
+  m_impl->FetchAsync(url, Impl::Method::POST, headers, std::move(payload), codes,
+                     std::move(callback));
+}
+
 HttpRequest::Response HttpRequest::Post(const std::string& url, const std::vector<u8>& payload,
                                         const Headers& headers, AllowedReturnCodes codes)
 {
@@ -147,6 +301,10 @@ HttpRequest::Impl::Impl(std::chrono::milliseconds timeout_ms, ProgressCallback c
       m_curl.get(), CURLOPT_LOW_SPEED_TIME,
       static_cast<long>(std::chrono::duration_cast<std::chrono::seconds>(timeout_ms).count()));
   curl_easy_setopt(m_curl.get(), CURLOPT_LOW_SPEED_LIMIT, 1);
+
+  // Prefer waiting for a connection which can be multiplexed over opening another one
+  curl_easy_setopt(m_curl.get(), CURLOPT_PIPEWAIT, 1L);
+  curl_easy_setopt(m_curl.get(), CURLOPT_SHARE, TransferThread::GetInstance().GetShare());
 }
 
 bool HttpRequest::Impl::IsValid() const
@@ -231,8 +389,35 @@ HttpRequest::Response HttpRequest::Impl::Fetch(const std::string& url, Method me
                                                const Headers& headers, const u8* payload,
                                                size_t size, AllowedReturnCodes codes,
                                                std::span<Multiform> multiform)
+{
+  std::promise<Response> response;
+  StartTransfer(url, method, headers, payload, size, codes, multiform,
+                [&response](Response result) { response.set_value(std::move(result)); });
+  return response.get_future().get();
+}
+
+void HttpRequest::Impl::FetchAsync(const std::string& url, Method method, const Headers& headers,
+                                   std::vector<u8> payload, AllowedReturnCodes codes,
+                                   ResponseCallback callback)
+{
+  // Unlike the blocking requests, the payload has to be kept around for the transfer.
+  m_payload = std::move(payload);
+  StartTransfer(url, method, headers, m_payload.data(), m_payload.size(), codes, {},
+                std::move(callback));
+}
+
+void HttpRequest::Impl::StartTransfer(const std::string& url, Method method,
+                                      const Headers& headers, const u8* payload, size_t size,
+                                      AllowedReturnCodes codes, std::span<Multiform> multiform,
+                                      ResponseCallback callback)
 {
   m_response_headers.clear();
+  if (!m_curl)
+  {
+    callback({});
+    return;
+  }
+
   curl_easy_setopt(m_curl.get(), CURLOPT_POST, method == Method::POST);
   curl_easy_setopt(m_curl.get(), CURLOPT_URL, url.c_str());
   if (method == Method::POST && multiform.empty())
@@ -241,23 +426,21 @@ HttpRequest::Response HttpRequest::Impl::Fetch(const std::string& url, Method me
     curl_easy_setopt(m_curl.get(), CURLOPT_POSTFIELDSIZE, size);
   }
 
-  curl_mime* form = nullptr;
-  Common::ScopeGuard multiform_guard{[&form] { curl_mime_free(form); }};
+  m_form.reset();
   if (!multiform.empty())
   {
-    form = curl_mime_init(m_curl.get());
+    m_form.reset(curl_mime_init(m_curl.get()));
     for (const auto& value : multiform)
     {
-      curl_mimepart* part = curl_mime_addpart(form);
+      curl_mimepart* part = curl_mime_addpart(m_form.get());
       curl_mime_name(part, value.name.c_str());
       curl_mime_data(part, value.data.c_str(), value.data.size());
     }
 
-    curl_easy_setopt(m_curl.get(), CURLOPT_MIMEPOST, form);
+    curl_easy_setopt(m_curl.get(), CURLOPT_MIMEPOST, m_form.get());
   }
 
   curl_slist* list = nullptr;
-  Common::ScopeGuard list_guard{[&list] { curl_slist_free_all(list); }};
   for (const auto& [name, value] : headers)
   {
     if (!value)
@@ -267,44 +450,72 @@ HttpRequest::Response HttpRequest::Impl::Fetch(const std::string& url, Method me
     else
       list = curl_slist_append(list, (name + ": " + *value).c_str());
   }
+  m_header_list.reset(list);
   curl_easy_setopt(m_curl.get(), CURLOPT_HTTPHEADER, list);
 
   curl_easy_setopt(m_curl.get(), CURLOPT_HEADERFUNCTION, header_callback);
   curl_easy_setopt(m_curl.get(), CURLOPT_HEADERDATA, static_cast<void*>(&m_response_headers));
 
-  std::vector<u8> buffer;
+  m_buffer.clear();
   curl_easy_setopt(m_curl.get(), CURLOPT_WRITEFUNCTION, CurlWriteCallback);
-  curl_easy_setopt(m_curl.get(), CURLOPT_WRITEDATA, &buffer);
+  curl_easy_setopt(m_curl.get(), CURLOPT_WRITEDATA, &m_buffer);
+
+  m_url = url;
+  m_method = method;
+  m_codes = codes;
+  m_on_done = std::move(callback);
+
+  // Waiting for the transfer thread on itself would never finish, so requests made by callbacks
+  // (and progress callbacks) are performed right away instead.
+  TransferThread& transfer_thread = TransferThread::GetInstance();
+  if (transfer_thread.IsCurrentThread())
+    FinishTransfer(curl_easy_perform(m_curl.get()));
+  else
+    transfer_thread.Start(m_curl.get(), [this](CURLcode result) { FinishTransfer(result); });
+}
 
-  const char* type = method == Method::POST ? "POST" : "GET";
-  const CURLcode res = curl_easy_perform(m_curl.get());
-  if (res != CURLE_OK)
+void HttpRequest::Impl::FinishTransfer(CURLcode result)
+{
+  m_form.reset();
+  m_header_list.reset();
+  m_payload.clear();
+
+  // The callback is allowed to destroy this
+  const ResponseCallback on_done = std::move(m_on_done);
+
+  const char* type = m_method == Method::POST ? "POST" : "GET";
+  if (result != CURLE_OK)
   {
-    ERROR_LOG_FMT(COMMON, "Failed to {} {}: {}", type, url, m_error_string);
-    return {};
+    ERROR_LOG_FMT(COMMON, "Failed to {} {}: {}", type, m_url, m_error_string);
+    on_done({});
+    return;
   }
 
-  if (codes == AllowedReturnCodes::All)
-    return buffer;
+  if (m_codes == AllowedReturnCodes::All)
+  {
+    on_done(std::move(m_buffer));
+    return;
+  }
 
   long response_code = 0;
   curl_easy_getinfo(m_curl.get(), CURLINFO_RESPONSE_CODE, &response_code);
   if (response_code != 200)
   {
-    if (buffer.empty())
+    if (m_buffer.empty())
     {
-      ERROR_LOG_FMT(COMMON, "Failed to {} {}: server replied with code {}", type, url,
+      ERROR_LOG_FMT(COMMON, "Failed to {} {}: server replied with code {}", type, m_url,
                     response_code);
     }
     else
     {
       ERROR_LOG_FMT(COMMON, "Failed to {} {}: server replied with code {} and body\n\x1b[0m{:.{}}",
-                    type, url, response_code, reinterpret_cast<char*>(buffer.data()),
-                    static_cast<int>(buffer.size()));
+                    type, m_url, response_code, reinterpret_cast<char*>(m_buffer.data()),
+                    static_cast<int>(m_buffer.size()));
     }
-    return {};
+    on_done({});
+    return;
   }
 
-  return buffer;
+  on_done(std::move(m_buffer));
 }
 }  // namespace Common
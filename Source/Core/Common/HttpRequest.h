@@ -35,6 +35,7 @@ public:
 
   using Response = std::optional<std::vector<u8>>;
   using Headers = std::map<std::string, std::optional<std::string>>;
+  using ResponseCallback = std::function<void(Response response)>;
 
   struct Multiform
   {
@@ -59,6 +60,15 @@ public:
                          const Headers& headers = {},
                          AllowedReturnCodes codes = AllowedReturnCodes::Ok_Only);
 
+  // These return right away. The callback is called on the thread running the transfers of all
+  // requests, so it shouldn't take long. Only one transfer can be in progress per HttpRequest,
+  // which has to be kept alive until the callback has been called (it may be destroyed by it).
+  void GetAsync(const std::string& url, ResponseCallback callback, const Headers& headers = {},
+                AllowedReturnCodes codes = AllowedReturnCodes::Ok_Only);
+  void PostAsync(const std::string& url, std::vector<u8> payload, ResponseCallback callback,
+                 const Headers& headers = {},
+                 AllowedReturnCodes codes = AllowedReturnCodes::Ok_Only);
+
 private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
@@ -3,11 +3,14 @@
 
 #include "Common/IOFile.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstddef>
 #include <cstdio>
 #include <string>
 
 #ifdef _WIN32
+#include <Windows.h>
 #include <io.h>
 
 #include "Common/CommonFuncs.h"
@@ -17,8 +20,6 @@
 #endif
 
 #ifdef ANDROID
-#include <algorithm>
-
 #include "jni/AndroidCommon/AndroidCommon.h"
 #endif
 
@@ -110,6 +111,48 @@ IOFile IOFile::Duplicate(const char openmode[]) const
 #endif  // _WIN32
 }
 
+bool IOFile::ReadAt(u64 offset, void* data, size_t length)
+{
+  if (!IsOpen())
+  {
+    m_good = false;
+    return false;
+  }
+
+  u8* out_ptr = static_cast<u8*>(data);
+  while (length > 0)
+  {
+#ifdef _WIN32
+    const HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_file)));
+    OVERLAPPED overlapped{};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    const DWORD bytes_to_read = static_cast<DWORD>(std::min<size_t>(length, 0x40000000));
+    DWORD bytes_read = 0;
+    if (!ReadFile(handle, out_ptr, bytes_to_read, &bytes_read, &overlapped) || bytes_read == 0)
+    {
+      m_good = false;
+      return false;
+    }
+#else
+    const ssize_t bytes_read = pread(fileno(m_file), out_ptr, length, static_cast<off_t>(offset));
+    if (bytes_read < 0 && errno == EINTR)
+      continue;
+    if (bytes_read <= 0)
+    {
+      m_good = false;
+      return false;
+    }
+#endif
+
+    out_ptr += bytes_read;
+    offset += bytes_read;
+    length -= bytes_read;
+  }
+
+  return true;
+}
+
 void IOFile::SetHandle(std::FILE* file)
 {
   Close();
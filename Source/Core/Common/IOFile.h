@@ -98,6 +98,12 @@ public:
 
   bool WriteString(std::string_view str) { return WriteBytes(str.data(), str.size()); }
 
+  // Reads from the given offset using a positional read on the underlying file descriptor,
+  // bypassing the stdio buffer. Unlike Seek + ReadBytes, this needs only one system call.
+  // On Windows, this moves the position of the underlying handle, so Seek before using the stream
+  // functions again. Only use this on files that aren't being written to.
+  bool ReadAt(u64 offset, void* data, size_t length);
+
   bool IsOpen() const { return nullptr != m_file; }
   // m_good is set to false when a read, write or other function fails
   bool IsGood() const { return m_good; }
@@ -39,6 +39,9 @@
 #ifndef __SSE3__
 #define FUNCTION_TARGET_SSE3 [[gnu::target("sse3")]]
 #endif
+#if !defined(__PCLMUL__) || !defined(__SSE4_1__)
+#define FUNCTION_TARGET_PCLMUL [[gnu::target("pclmul,sse4.1")]]
+#endif
 
 #elif defined(_MSC_VER) || defined(__INTEL_COMPILER)
 
@@ -69,3 +72,6 @@
 #ifndef FUNCTION_TARGET_SSE3
 #define FUNCTION_TARGET_SSE3
 #endif
+#ifndef FUNCTION_TARGET_PCLMUL
+#define FUNCTION_TARGET_PCLMUL
+#endif
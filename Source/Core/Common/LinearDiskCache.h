@@ -4,29 +4,59 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileLock.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
+#include "Common/Random.h"
 #include "Common/Version.h"
 
 // On disk format:
 // header{
-// u32 'DCAC';
-// u32 version;  // svn_rev
+// u32 'DCA2';
 // u16 sizeof(key_type);
 // u16 sizeof(value_type);
+// char version[40];  // git revision
+// u64 index_offset;  // 0 if the file has no index
+// u32 index_size;    // number of index_records
+// u32 generation;  // changes whenever the file is rewritten
 //}
 
 // key_value_pair{
 // u32 value_size;
 // key_type   key;
 // value_type[value_size]   value;
+// u32 entry_number;  // counts up from 1, so that a torn write can be detected
 //}
 
+// index_record{
+// key_type key;
+// u32 value_size;
+// u64 value_offset;
+//}
+
+// Compacting the cache rewrites it as its live key_value_pairs followed by an index of them.
+// Pairs appended later follow the index, and are found by scanning them when the file is opened.
+//
+// A shared cache can be used by several processes at once. They take a lock on "<file>.lock"
+// around opening, appending and compacting, and before appending they read the pairs which the
+// others appended since, so that the entry numbers stay consecutive. Files are only ever replaced
+// by renaming, never truncated, so the mappings of other processes stay valid.
+
 namespace Common
 {
 template <typename K, typename V>
@@ -36,12 +66,16 @@ public:
   virtual void Read(const K& key, const V* value, u32 value_size) = 0;
 };
 
-// Dead simple unsorted key-value store with append functionality.
-// No random read functionality, all reading is done in OpenAndRead.
+// Simple unsorted key-value store with append functionality.
 // Keys and values can contain any characters, including \0.
 //
+// The file is memory-mapped, so values are only read from disk once they are used, either by
+// looking them up or by reading them all in OpenAndRead. A later entry for the same key replaces
+// the earlier one. The file is compacted when it is opened once enough of it is replaced entries
+// or entries which aren't indexed yet. Compacting writes a new file and renames it over the old
+// one, so a crash can at most lose the entry which was being appended.
+//
 // Suitable for caching generated shader bytecode between executions.
-// Not tuned for extreme performance but should be reasonably fast.
 // Does not support keys or values larger than 2GB, which should be reasonable.
 // Keys must have non-zero length; values can have zero length.
 
@@ -52,116 +86,434 @@ template <typename K, typename V>
 class LinearDiskCache
 {
 public:
-  // return number of read entries
-  u32 OpenAndRead(const std::string& filename, LinearDiskCacheReader<K, V>& reader)
+  // Since we're reading/writing directly to the storage of K instances,
+  // K must be trivially copyable.
+  static_assert(std::is_trivially_copyable_v<K>, "K must be a trivially copyable type");
+  // Values are used in place in the mapped file, where they aren't aligned.
+  static_assert(std::is_trivially_copyable_v<V> && alignof(V) == 1,
+                "V must be a trivially copyable type without alignment requirements");
+
+  // Opens the cache and passes every entry to the reader. Returns the number of entries.
+  u32 OpenAndRead(const std::string& filename, LinearDiskCacheReader<K, V>& reader,
+                  bool shared = false)
   {
-    // Since we're reading/writing directly to the storage of K instances,
-    // K must be trivially copyable.
-    static_assert(std::is_trivially_copyable<K>::value, "K must be a trivially copyable type");
+    Open(filename, shared);
+    for (const Entry& entry : m_entries)
+    {
+      if (entry.live)
+        reader.Read(entry.key, entry.value, entry.value_size);
+    }
+    return GetEntryCount();
+  }
 
-    // close any currently opened file
+  // Opens the cache without reading any values. Returns the number of entries.
+  u32 Open(const std::string& filename, bool shared = false)
+  {
     Close();
-    m_num_entries = 0;
-
-    // try opening for reading/writing
-    m_file.Open(filename, "r+b");
+    m_filename = filename;
+    if (shared)
+      m_lock.Open(filename + ".lock");
+    std::lock_guard lock(m_lock);
 
-    const u64 file_size = m_file.GetSize();
-
-    m_header.Init();
-    if (m_file.IsOpen() && ValidateHeader())
+    if (!LoadFile())
     {
-      // good header, read some key/value pairs
-      K key;
-
-      std::unique_ptr<V[]> value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-      u64 last_valid_value_start = m_file.Tell();
-
-      while (m_file.ReadArray(&value_size, 1))
-      {
-        const u64 next_extent = m_file.Tell() + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
-          break;
+      // failed to open file for reading or bad header
+      // recreate file
+      Recreate();
+      return 0;
+    }
 
-        value = std::make_unique_for_overwrite<V[]>(value_size);
+    if (m_torn_tail || NeedsCompaction())
+      CompactLocked({});
+    else
+      OpenForAppending();
 
-        // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
-            m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
-        {
-          last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
-        }
-        else
-        {
-          break;
-        }
-
-        m_num_entries++;
-      }
-      m_file.ClearError();
-      m_file.Seek(last_valid_value_start, File::SeekOrigin::Begin);
+    return GetEntryCount();
+  }
 
-      return m_num_entries;
-    }
+  // Returns the value for a key, or std::nullopt if the cache doesn't contain the key.
+  std::optional<std::span<const V>> Lookup(const K& key) const
+  {
+    const auto it = m_index.find(key);
+    if (it == m_index.end())
+      return std::nullopt;
 
-    // failed to open file for reading or bad header
-    // close and recreate file
-    Close();
-    m_file.Open(filename, "wb");
-    WriteHeader();
-    return 0;
+    const Entry& entry = m_entries[it->second];
+    return std::span<const V>(entry.value, entry.value_size);
   }
 
+  u32 GetEntryCount() const { return static_cast<u32>(m_index.size()); }
+
   void Sync() { m_file.Flush(); }
   void Close()
   {
-    if (m_file.IsOpen())
-      m_file.Close();
+    Clear();
+    m_lock.Close();
   }
 
   // Appends a key-value pair to the store.
   void Append(const K& key, const V* value, u32 value_size)
   {
-    // TODO: Should do a check that we don't already have "key"? (I think each caller does that
-    // already.)
+    std::lock_guard lock(m_lock);
+
+    // Another process may have left a torn entry, which would hide everything appended after it
+    // until the file is compacted the next time it's opened.
+    if (m_lock.IsOpen() && !ReadOtherAppends())
+      return;
+
+    m_num_entries++;
     m_file.WriteArray(&value_size, 1);
     m_file.WriteArray(&key, 1);
     m_file.WriteArray(value, value_size);
-    m_num_entries++;
     m_file.WriteArray(&m_num_entries, 1);
+    m_file_size += sizeof(u32) + sizeof(K) + u64(value_size) * sizeof(V) + sizeof(u32);
+
+    // Other processes must see the whole entry once the lock is released.
+    if (m_lock.IsOpen())
+      m_file.Flush();
+
+    AddAppendedEntry(key, value, value_size);
+  }
+
+  // Rewrites the file without replaced entries, and with an index of all entries. Entries for
+  // which is_stale returns true are dropped too.
+  void Compact(const std::function<bool(const K&)>& is_stale = {})
+  {
+    std::lock_guard lock(m_lock);
+    CompactLocked(is_stale);
   }
 
 private:
-  void WriteHeader() { m_file.WriteArray(&m_header, 1); }
-  bool ValidateHeader()
+  void Clear()
   {
-    char file_header[sizeof(Header)];
+    if (m_file.IsOpen())
+      m_file.Close();
+    m_mapping.Close();
+
+    m_entries.clear();
+    m_index.clear();
+    m_appended_values.clear();
+    m_num_entries = 0;
+    m_replaced_entries = 0;
+    m_unindexed_entries = 0;
+    m_file_size = 0;
+    m_torn_tail = false;
+  }
+
+  void CompactLocked(const std::function<bool(const K&)>& is_stale)
+  {
+    const std::string temp_filename = m_filename + ".tmp";
+    bool success;
+    {
+      File::IOFile out(temp_filename, "wb");
+      Header header = Header::Create();
+      header.generation = Common::Random::GenerateValue<u32>();
+      out.WriteArray(&header, 1);
+
+      std::vector<u8> index;
+      u32 entry_number = 0;
+      for (const Entry& entry : m_entries)
+      {
+        if (!entry.live || (is_stale && is_stale(entry.key)))
+          continue;
+
+        entry_number++;
+        out.WriteArray(&entry.value_size, 1);
+        out.WriteArray(&entry.key, 1);
+        const u64 value_offset = out.Tell();
+        out.WriteArray(entry.value, entry.value_size);
+        out.WriteArray(&entry_number, 1);
+
+        AppendBytes(&index, &entry.key, sizeof(entry.key));
+        AppendBytes(&index, &entry.value_size, sizeof(entry.value_size));
+        AppendBytes(&index, &value_offset, sizeof(value_offset));
+      }
+
+      header.index_offset = out.Tell();
+      header.index_size = entry_number;
+      if (!index.empty())
+        out.WriteBytes(index.data(), index.size());
+      out.Seek(0, File::SeekOrigin::Begin);
+      out.WriteArray(&header, 1);
+      success = out.IsGood() && out.Flush();
+    }
+
+    // The entries point into the mapping, so it can only be closed once they have been written.
+    const std::string filename = m_filename;
+    Clear();
+    m_filename = filename;
+
+    success = success && File::RenameSync(temp_filename, filename);
+    if (!success)
+      File::Delete(temp_filename);
 
-    return (m_file.ReadArray(file_header, sizeof(Header)) &&
-            !memcmp((const char*)&m_header, file_header, sizeof(Header)));
+    // If the new file couldn't replace the old one, the old one can still be appended to, unless
+    // it ends in a torn entry which would hide everything appended after it.
+    if (LoadFile() && !m_torn_tail)
+      OpenForAppending();
+    else
+      Recreate();
   }
 
   struct Header
   {
-    void Init()
+    static Header Create()
     {
+      Header header{};
       // Null-terminator is intentionally not copied.
-      std::memcpy(&id, "DCAC", sizeof(u32));
-      std::memcpy(ver, Common::GetScmRevGitStr().c_str(),
-                  std::min(Common::GetScmRevGitStr().size(), sizeof(ver)));
+      std::memcpy(&header.id, "DCA2", sizeof(u32));
+      header.key_t_size = sizeof(K);
+      header.value_t_size = sizeof(V);
+      std::memcpy(header.ver, Common::GetScmRevGitStr().c_str(),
+                  std::min(Common::GetScmRevGitStr().size(), sizeof(header.ver)));
+      return header;
     }
 
-    u32 id = 0;
-    const u16 key_t_size = sizeof(K);
-    const u16 value_t_size = sizeof(V);
-    char ver[40] = {};
+    // Whether a file with this header was written by this build for these types.
+    bool IsCompatible() const
+    {
+      const Header expected = Create();
+      return std::memcmp(this, &expected, offsetof(Header, index_offset)) == 0;
+    }
+
+    u32 id;
+    u16 key_t_size;
+    u16 value_t_size;
+    char ver[40];
+    u64 index_offset;
+    u32 index_size;
+    u32 generation;
+  };
+  static_assert(sizeof(Header) == 64);
+
+  static constexpr size_t INDEX_RECORD_SIZE = sizeof(K) + sizeof(u32) + sizeof(u64);
+  // Compacting a small cache isn't worth it, since scanning it is cheap.
+  static constexpr u32 MIN_ENTRIES_TO_COMPACT = 64;
 
-  } m_header;
+  struct Entry
+  {
+    K key;
+    const V* value;
+    u32 value_size;
+    bool live;
+  };
 
+  // Keys are compared as the bytes which are stored in the file.
+  struct KeyHash
+  {
+    size_t operator()(const K& key) const
+    {
+      return std::hash<Hash128>{}(ComputeHash128(&key, sizeof(K)));
+    }
+  };
+  struct KeyEqual
+  {
+    bool operator()(const K& a, const K& b) const { return std::memcmp(&a, &b, sizeof(K)) == 0; }
+  };
+
+  static void AppendBytes(std::vector<u8>* out, const void* data, size_t size)
+  {
+    const u8* const bytes = static_cast<const u8*>(data);
+    out->insert(out->end(), bytes, bytes + size);
+  }
+
+  template <typename T>
+  static T ReadFromMapping(std::span<const u8> data, u64 offset)
+  {
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+  }
+
+  void AddEntry(const K& key, const V* value, u32 value_size)
+  {
+    const auto [it, inserted] = m_index.try_emplace(key, m_entries.size());
+    if (!inserted)
+    {
+      m_entries[it->second].live = false;
+      it->second = m_entries.size();
+      m_replaced_entries++;
+    }
+    m_entries.push_back({key, value, value_size, true});
+  }
+
+  void AddAppendedEntry(const K& key, const V* value, u32 value_size)
+  {
+    // The mapping doesn't cover appended values, so lookups use a copy.
+    auto value_copy = std::make_unique_for_overwrite<V[]>(value_size);
+    std::copy_n(value, value_size, value_copy.get());
+    AddEntry(key, value_copy.get(), value_size);
+    m_appended_values.push_back(std::move(value_copy));
+    m_unindexed_entries++;
+  }
+
+  // Catches up with the pairs other processes appended to a shared file since it was read, and
+  // switches to the new file if one of them replaced it. The pairs of a replaced file aren't read,
+  // since they're either already known or are read the next time the file is opened. Returns false
+  // if the file can't be appended to.
+  bool ReadOtherAppends()
+  {
+    File::IOFile file(m_filename, "rb");
+    Header header;
+    if (!file.ReadArray(&header, 1) || !header.IsCompatible())
+      return false;
+
+    if (header.generation != m_header.generation)
+    {
+      m_header = header;
+      m_num_entries = header.index_size;
+      m_file_size = header.index_offset != 0 ?
+                        header.index_offset + u64(header.index_size) * INDEX_RECORD_SIZE :
+                        sizeof(Header);
+      OpenForAppending();
+    }
+
+    const u64 size = file.GetSize();
+    if (size == m_file_size)
+      return true;
+    if (size < m_file_size || !file.Seek(m_file_size, File::SeekOrigin::Begin))
+      return false;
+
+    std::vector<V> value;
+    while (m_file_size < size)
+    {
+      u32 value_size;
+      K key;
+      u32 entry_number;
+      if (!file.ReadArray(&value_size, 1) || !file.ReadArray(&key, 1) ||
+          m_file_size + sizeof(u32) + sizeof(K) + u64(value_size) * sizeof(V) + sizeof(u32) > size)
+      {
+        return false;
+      }
+      value.resize(value_size);
+      if (!file.ReadArray(value.data(), value_size) || !file.ReadArray(&entry_number, 1) ||
+          entry_number != m_num_entries + 1)
+      {
+        return false;
+      }
+
+      AddAppendedEntry(key, value.data(), value_size);
+      m_num_entries++;
+      m_file_size = file.Tell();
+    }
+    return true;
+  }
+
+  // Maps the file and indexes its entries. Returns false if it doesn't exist or has a bad header.
+  bool LoadFile()
+  {
+    if (!m_mapping.Open(m_filename))
+      return false;
+
+    const std::span<const u8> data = m_mapping.GetData();
+    if (data.size() < sizeof(Header))
+      return false;
+    m_header = ReadFromMapping<Header>(data, 0);
+    if (!m_header.IsCompatible())
+      return false;
+
+    u64 offset = sizeof(Header);
+    if (m_header.index_offset != 0)
+    {
+      const u64 index_end = m_header.index_offset + u64(m_header.index_size) * INDEX_RECORD_SIZE;
+      if (m_header.index_offset < sizeof(Header) || index_end > data.size())
+        return false;
+
+      for (u64 record = m_header.index_offset; record < index_end; record += INDEX_RECORD_SIZE)
+      {
+        const K key = ReadFromMapping<K>(data, record);
+        const u32 value_size = ReadFromMapping<u32>(data, record + sizeof(K));
+        const u64 value_offset = ReadFromMapping<u64>(data, record + sizeof(K) + sizeof(u32));
+        if (value_offset < sizeof(Header) ||
+            value_offset + u64(value_size) * sizeof(V) > m_header.index_offset)
+        {
+          return false;
+        }
+        AddEntry(key, reinterpret_cast<const V*>(data.data() + value_offset), value_size);
+      }
+      m_num_entries = m_header.index_size;
+      offset = index_end;
+    }
+
+    // Scan the pairs which were appended after the index.
+    while (offset + sizeof(u32) + sizeof(K) <= data.size())
+    {
+      const u32 value_size = ReadFromMapping<u32>(data, offset);
+      const u64 value_offset = offset + sizeof(u32) + sizeof(K);
+      const u64 next_offset = value_offset + u64(value_size) * sizeof(V) + sizeof(u32);
+      if (next_offset > data.size() ||
+          ReadFromMapping<u32>(data, next_offset - sizeof(u32)) != m_num_entries + 1)
+      {
+        break;
+      }
+
+      AddEntry(ReadFromMapping<K>(data, offset + sizeof(u32)),
+               reinterpret_cast<const V*>(data.data() + value_offset), value_size);
+      m_num_entries++;
+      m_unindexed_entries++;
+      offset = next_offset;
+    }
+
+    m_file_size = offset;
+    m_torn_tail = offset != data.size();
+    return true;
+  }
+
+  bool NeedsCompaction() const
+  {
+    const u32 wasted_entries = m_replaced_entries + m_unindexed_entries;
+    return wasted_entries >= MIN_ENTRIES_TO_COMPACT && wasted_entries * 4 >= m_entries.size();
+  }
+
+  void OpenForAppending() { m_file.Open(m_filename, "ab"); }
+
+  void Recreate()
+  {
+    const std::string filename = m_filename;
+    Clear();
+    m_filename = filename;
+
+    m_header = Header::Create();
+    m_header.generation = Common::Random::GenerateValue<u32>();
+    m_file_size = sizeof(Header);
+
+    // The new file is renamed over the old one so that processes which still have the old one
+    // mapped aren't affected.
+    const std::string temp_filename = m_filename + ".tmp";
+    bool success;
+    {
+      File::IOFile out(temp_filename, "wb");
+      success = out.WriteArray(&m_header, 1) && out.Flush();
+    }
+    if (success && File::RenameSync(temp_filename, m_filename))
+    {
+      OpenForAppending();
+      return;
+    }
+
+    File::Delete(temp_filename);
+    m_file.Open(m_filename, "wb");
+    m_file.WriteArray(&m_header, 1);
+  }
+
+  std::string m_filename;
+  Header m_header{};
   File::IOFile m_file;
+  MappedFile m_mapping;
+  // Only open for shared files.
+  FileLock m_lock;
+
+  // All entries in file order, including replaced ones, which aren't live.
+  std::vector<Entry> m_entries;
+  std::unordered_map<K, size_t, KeyHash, KeyEqual> m_index;
+  std::vector<std::unique_ptr<V[]>> m_appended_values;
+
+  // The number of key_value_pairs in the file, which numbers the next one.
   u32 m_num_entries = 0;
+  // The end of the last pair known to be in the file.
+  u64 m_file_size = 0;
+  u32 m_replaced_entries = 0;
+  u32 m_unindexed_entries = 0;
+  bool m_torn_tail = false;
 };
 }  // namespace Common
@@ -4,6 +4,8 @@
 #include "Common/Logging/LogManager.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdarg>
 #include <cstring>
@@ -12,6 +14,7 @@
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -22,6 +25,7 @@
 #include "Common/Logging/ConsoleListener.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 
 namespace Common::Log
 {
@@ -62,6 +66,87 @@ private:
   bool m_enable;
 };
 
+struct LogRecord
+{
+  u64 sequence;
+  std::chrono::system_clock::time_point time;
+  LogLevel level;
+  LogType type;
+  const char* file;
+  int line;
+  std::string message;
+};
+
+// A bounded queue which only its thread pushes to, and only the log thread pops from.
+class LogRing final
+{
+public:
+  static constexpr size_t CAPACITY = 2048;
+
+  explicit LogRing(u64 owner_) : owner(owner_) {}
+
+  // Returns false if the ring is full, in which case the record is dropped.
+  bool Push(LogRecord&& record)
+  {
+    const size_t write = m_write.load(std::memory_order_relaxed);
+    if (write - m_read.load(std::memory_order_acquire) == CAPACITY)
+    {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    m_records[write % CAPACITY] = std::move(record);
+    m_write.store(write + 1, std::memory_order_release);
+    return true;
+  }
+
+  template <typename Func>
+  void PopAll(Func func)
+  {
+    const size_t write = m_write.load(std::memory_order_acquire);
+    size_t read = m_read.load(std::memory_order_relaxed);
+    for (; read != write; ++read)
+      func(std::move(m_records[read % CAPACITY]));
+    m_read.store(read, std::memory_order_release);
+  }
+
+  bool IsEmpty() const
+  {
+    return m_read.load(std::memory_order_acquire) == m_write.load(std::memory_order_acquire);
+  }
+
+  u64 TakeDroppedCount() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+  // The LogManager instance which the ring is registered with.
+  const u64 owner;
+  // Set once the owning thread has exited, after which the ring is removed when empty.
+  std::atomic<bool> abandoned = false;
+
+private:
+  std::array<LogRecord, CAPACITY> m_records;
+  alignas(64) std::atomic<size_t> m_write = 0;
+  alignas(64) std::atomic<size_t> m_read = 0;
+  std::atomic<u64> m_dropped = 0;
+};
+
+namespace
+{
+struct ThreadRingHolder
+{
+  ~ThreadRingHolder()
+  {
+    if (ring)
+      ring->abandoned.store(true, std::memory_order_release);
+  }
+
+  std::shared_ptr<LogRing> ring;
+};
+
+thread_local ThreadRingHolder t_ring;
+
+std::atomic<u64> s_next_instance_id = 0;
+}  // namespace
+
 void GenericLogFmtImpl(LogLevel level, LogType type, const char* file, int line,
                        fmt::string_view format, const fmt::format_args& args)
 {
@@ -72,8 +157,7 @@ void GenericLogFmtImpl(LogLevel level, LogType type, const char* file, int line,
   if (!instance->IsEnabled(type, level))
     return;
 
-  const auto message = fmt::vformat(format, args);
-  instance->Log(level, type, file, line, message.c_str());
+  instance->Log(level, type, file, line, fmt::vformat(format, args));
 }
 
 static size_t DeterminePathCutOffPoint()
@@ -94,7 +178,7 @@ static size_t DeterminePathCutOffPoint()
   return 0;
 }
 
-LogManager::LogManager()
+LogManager::LogManager() : m_instance_id(s_next_instance_id++)
 {
   // create log containers
   m_log[LogType::ACHIEVEMENTS] = {"RetroAchievements", "Achievements"};
@@ -170,9 +254,16 @@ LogManager::LogManager()
   }
 
   m_path_cutoff_point = DeterminePathCutOffPoint();
+
+  m_log_thread = std::thread(&LogManager::LogThread, this);
 }
 
-LogManager::~LogManager() = default;
+LogManager::~LogManager()
+{
+  m_exit.store(true, std::memory_order_release);
+  m_log_event.Set();
+  m_log_thread.join();
+}
 
 void LogManager::SaveSettings()
 {
@@ -194,38 +285,122 @@ void LogManager::SaveSettings()
   Config::Save();
 }
 
-void LogManager::Log(LogLevel level, LogType type, const char* file, int line, const char* message)
+void LogManager::Log(LogLevel level, LogType type, const char* file, int line, std::string message)
 {
   if (!IsEnabled(type, level) || !static_cast<bool>(m_listener_ids))
     return;
 
-  LogWithFullPath(level, type, file + m_path_cutoff_point, line, message);
+  LogWithFullPath(level, type, file + m_path_cutoff_point, line, std::move(message));
 }
 
-std::string LogManager::GetTimestamp()
+static std::string GetTimestamp(std::chrono::system_clock::time_point time)
 {
   // NOTE: the Qt LogWidget hardcodes the expected length of the timestamp portion of the log line,
   // so ensure they stay in sync
 
   // We want milliseconds *and not hours*, so can't directly use STL formatters
-  const auto now = std::chrono::system_clock::now();
-  const auto now_s = std::chrono::floor<std::chrono::seconds>(now);
-  const auto now_ms = std::chrono::floor<std::chrono::milliseconds>(now);
-  return fmt::format("{:%M:%S}:{:03}", now_s, (now_ms - now_s).count());
+  const auto time_s = std::chrono::floor<std::chrono::seconds>(time);
+  const auto time_ms = std::chrono::floor<std::chrono::milliseconds>(time);
+  return fmt::format("{:%M:%S}:{:03}", time_s, (time_ms - time_s).count());
 }
 
 void LogManager::LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
-                                 const char* message)
+                                 std::string message)
+{
+  LogRecord record{m_next_sequence.fetch_add(1, std::memory_order_relaxed),
+                   std::chrono::system_clock::now(),
+                   level,
+                   type,
+                   file,
+                   line,
+                   std::move(message)};
+  if (GetThreadRing().Push(std::move(record)))
+    m_log_event.Set();
+}
+
+LogRing& LogManager::GetThreadRing()
+{
+  if (!t_ring.ring || t_ring.ring->owner != m_instance_id)
+  {
+    if (t_ring.ring)
+      t_ring.ring->abandoned.store(true, std::memory_order_release);
+    t_ring.ring = std::make_shared<LogRing>(m_instance_id);
+
+    std::lock_guard lk(m_rings_lock);
+    m_rings.push_back(t_ring.ring);
+  }
+  return *t_ring.ring;
+}
+
+void LogManager::LogThread()
 {
-  const std::string msg =
-      fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(), file, line,
-                  LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type), message);
+  Common::SetCurrentThreadName("Log thread");
 
-  for (const auto listener_id : m_listener_ids)
+  while (!m_exit.load(std::memory_order_acquire))
   {
-    if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+    m_log_event.Wait();
+    DrainRings();
   }
+  DrainRings();
+}
+
+void LogManager::DrainRings()
+{
+  std::lock_guard drain_lk(m_drain_lock);
+
+  std::vector<LogRecord> records;
+  u64 dropped = 0;
+  {
+    std::lock_guard lk(m_rings_lock);
+    for (const std::shared_ptr<LogRing>& ring : m_rings)
+    {
+      ring->PopAll([&](LogRecord&& record) { records.push_back(std::move(record)); });
+      dropped += ring->TakeDroppedCount();
+    }
+    std::erase_if(m_rings, [](const std::shared_ptr<LogRing>& ring) {
+      return ring->abandoned.load(std::memory_order_acquire) && ring->IsEmpty();
+    });
+  }
+  if (records.empty() && dropped == 0)
+    return;
+
+  // Each ring is in order, but the rings have to be merged.
+  std::ranges::sort(records, {}, &LogRecord::sequence);
+
+  if (dropped != 0)
+  {
+    m_dropped_messages.fetch_add(dropped, std::memory_order_relaxed);
+    records.push_back({0, std::chrono::system_clock::now(), LogLevel::LWARNING, LogType::COMMON,
+                       __FILE__ + m_path_cutoff_point, __LINE__,
+                       fmt::format("{} log messages were dropped because they were logged faster "
+                                   "than they could be written",
+                                   dropped)});
+  }
+
+  std::lock_guard lk(m_listeners_lock);
+  for (const LogRecord& record : records)
+  {
+    const std::string msg = fmt::format(
+        "{} {}:{} {}[{}]: {}\n", GetTimestamp(record.time), record.file, record.line,
+        LOG_LEVEL_TO_CHAR[static_cast<int>(record.level)], GetShortName(record.type),
+        record.message);
+
+    for (const auto listener_id : m_listener_ids)
+    {
+      if (m_listeners[listener_id])
+        m_listeners[listener_id]->Log(record.level, msg.c_str());
+    }
+  }
+}
+
+void LogManager::Flush()
+{
+  DrainRings();
+}
+
+u64 LogManager::GetDroppedMessageCount() const
+{
+  return m_dropped_messages.load(std::memory_order_relaxed);
 }
 
 LogLevel LogManager::GetLogLevel() const
@@ -271,6 +446,7 @@ const char* LogManager::GetFullName(LogType type) const
 
 void LogManager::RegisterListener(LogListener::LISTENER id, std::unique_ptr<LogListener> listener)
 {
+  std::lock_guard lk(m_listeners_lock);
   m_listeners[id] = std::move(listener);
 }
 
@@ -4,13 +4,18 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/Event.h"
 #include "Common/Logging/Log.h"
 
 namespace Common::Log
@@ -32,6 +37,11 @@ public:
   };
 };
 
+class LogRing;
+
+// Messages are queued on the logging thread and written to the listeners by a separate log
+// thread, so that logging doesn't stall emulation. Each logging thread has its own bounded queue
+// which it pushes to without locking. Messages which don't fit are dropped and counted.
 class LogManager final
 {
 public:
@@ -48,9 +58,15 @@ public:
   static void Init();
   static void Shutdown();
 
-  void Log(LogLevel level, LogType type, const char* file, int line, const char* message);
+  // file must be a string with static storage duration, such as __FILE__.
+  void Log(LogLevel level, LogType type, const char* file, int line, std::string message);
   void LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
-                       const char* message);
+                       std::string message);
+
+  // Blocks until every message queued before the call has been written to the listeners.
+  void Flush();
+  // The number of messages which were dropped because their thread's queue was full.
+  u64 GetDroppedMessageCount() const;
 
   LogLevel GetLogLevel() const;
   void SetLogLevel(LogLevel level);
@@ -77,12 +93,29 @@ private:
   LogManager(LogManager&&) = delete;
   LogManager& operator=(LogManager&&) = delete;
 
-  static std::string GetTimestamp();
+  LogRing& GetThreadRing();
+  void LogThread();
+  void DrainRings();
 
+  const u64 m_instance_id;
   LogLevel m_level;
   EnumMap<LogContainer, LAST_LOG_TYPE> m_log{};
-  std::array<std::unique_ptr<LogListener>, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  // Guards the listeners against being replaced while the log thread is calling them.
+  std::mutex m_listeners_lock;
+  std::array<std::unique_ptr<LogListener>, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
+
+  std::mutex m_rings_lock;
+  std::vector<std::shared_ptr<LogRing>> m_rings;
+  // Held while draining, since each ring only supports one consumer at a time.
+  std::mutex m_drain_lock;
+  std::atomic<u64> m_next_sequence = 0;
+  std::atomic<u64> m_dropped_messages = 0;
+
+  std::atomic<bool> m_exit = false;
+  Common::Event m_log_event;
+  std::thread m_log_thread;
 };
 }  // namespace Common::Log
@@ -0,0 +1,106 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <thread>
+#include <utility>
+
+namespace Common
+{
+// A bounded lock-free queue for any number of producer threads and a single consumer thread.
+//
+// Every slot carries a sequence number which tells producers whether the slot is free and the
+// consumer whether it has been filled, so producers only contend on a single atomic counter and
+// never wait for each other while copying their values in.
+template <typename T, std::size_t capacity>
+class MPSCQueue final
+{
+  static_assert(std::has_single_bit(capacity), "Capacity must be a power of two");
+
+public:
+  MPSCQueue()
+  {
+    for (std::size_t i = 0; i < capacity; ++i)
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  // Safe from any thread. Returns false if the queue is full.
+  bool TryPush(const T& value)
+  {
+    std::size_t pos = m_push_pos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+      slot = &m_slots[pos & MASK];
+      const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      if (sequence == pos)
+      {
+        if (m_push_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      }
+      else if (sequence < pos)
+      {
+        // The consumer hasn't emptied this slot since the last lap.
+        return false;
+      }
+      else
+      {
+        pos = m_push_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->value = value;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Safe from any thread. Waits for the consumer if the queue is full.
+  void Push(const T& value)
+  {
+    while (!TryPush(value))
+      std::this_thread::yield();
+  }
+
+  // The following are only safe from the consumer thread:
+
+  bool Empty() const
+  {
+    return m_slots[m_pop_pos & MASK].sequence.load(std::memory_order_acquire) != m_pop_pos + 1;
+  }
+
+  bool TryPop(T& value)
+  {
+    Slot& slot = m_slots[m_pop_pos & MASK];
+    if (slot.sequence.load(std::memory_order_acquire) != m_pop_pos + 1)
+      return false;
+
+    value = std::move(slot.value);
+    slot.sequence.store(m_pop_pos + capacity, std::memory_order_release);
+    ++m_pop_pos;
+    return true;
+  }
+
+private:
+  static constexpr std::size_t MASK = capacity - 1;
+
+  struct Slot
+  {
+    std::atomic<std::size_t> sequence;
+    T value{};
+  };
+
+  std::array<Slot, capacity> m_slots;
+
+  // Kept on separate cache lines so that producers don't slow the consumer down.
+  alignas(64) std::atomic<std::size_t> m_push_pos{0};
+  alignas(64) std::size_t m_pop_pos = 0;
+};
+}  // namespace Common
@@ -0,0 +1,37 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// A read-only mapping of a whole file. Pages are only read from disk once they are accessed.
+// Other handles may keep writing to the file, but it must not be truncated while it is mapped.
+class MappedFile final
+{
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Returns false if the file couldn't be mapped. Empty files map successfully to no data.
+  bool Open(const std::string& path);
+  void Close();
+
+  bool IsOpen() const { return m_is_open; }
+  std::span<const u8> GetData() const { return {m_data, m_size}; }
+
+private:
+  const u8* m_data = nullptr;
+  size_t m_size = 0;
+  bool m_is_open = false;
+};
+}  // namespace Common
@@ -29,6 +29,14 @@ struct WindowsMemoryFunctions
 };
 #endif
 
+// The accesses which are allowed to pages of a view passed to MemArena::ProtectMemoryRegion().
+enum class MemoryAccess
+{
+  None,
+  Read,
+  ReadWrite,
+};
+
 // This class lets you create a block of anonymous RAM, and then arbitrarily map views into it.
 // Multiple views can mirror the same section of the block, which makes it very convenient for
 // emulating memory mirrors.
@@ -115,6 +123,35 @@ public:
   ///
   void UnmapFromMemoryRegion(void* view, size_t size);
 
+  ///
+  /// Get the granularity of mappings made with MapInMemoryRegion(). Offsets, sizes and addresses
+  /// passed to it must be multiples of this.
+  ///
+  /// @return The granularity in bytes.
+  ///
+  size_t GetMappingGranularity() const;
+
+  ///
+  /// Change which accesses are allowed to part of a region mapped with MapInMemoryRegion(). Other
+  /// accesses fault, like accesses to unmapped parts of the memory region do. The protection is
+  /// dropped when the region is unmapped.
+  ///
+  /// @param view Address within a region mapped with MapInMemoryRegion().
+  /// @param size Size in bytes of the part to change.
+  /// @param access The accesses to allow.
+  ///
+  /// @return Whether the protection was changed.
+  ///
+  bool ProtectMemoryRegion(void* view, size_t size, MemoryAccess access);
+
+  ///
+  /// Get the granularity of ProtectMemoryRegion(). Addresses and sizes passed to it must be
+  /// multiples of this. May be smaller than GetMappingGranularity().
+  ///
+  /// @return The granularity in bytes.
+  ///
+  size_t GetProtectionGranularity() const;
+
 private:
 #ifdef _WIN32
   WindowsMemoryRegion* EnsureSplitRegionForMapping(void* address, size_t size);
@@ -144,6 +144,32 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
     NOTICE_LOG_FMT(MEMMAP, "mmap failed");
 }
 
+size_t MemArena::GetMappingGranularity() const
+{
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+bool MemArena::ProtectMemoryRegion(void* view, size_t size, MemoryAccess access)
+{
+  int prot = PROT_NONE;
+  if (access == MemoryAccess::Read)
+    prot = PROT_READ;
+  else if (access == MemoryAccess::ReadWrite)
+    prot = PROT_READ | PROT_WRITE;
+
+  if (mprotect(view, size, prot) != 0)
+  {
+    ERROR_LOG_FMT(MEMMAP, "ProtectMemoryRegion failed: mprotect: {}", LastStrerrorString());
+    return false;
+  }
+  return true;
+}
+
+size_t MemArena::GetProtectionGranularity() const
+{
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
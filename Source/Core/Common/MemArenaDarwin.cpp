@@ -163,6 +163,34 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
   }
 }
 
+size_t MemArena::GetMappingGranularity() const
+{
+  return static_cast<size_t>(vm_page_size);
+}
+
+bool MemArena::ProtectMemoryRegion(void* view, size_t size, MemoryAccess access)
+{
+  vm_prot_t prot = VM_PROT_NONE;
+  if (access == MemoryAccess::Read)
+    prot = VM_PROT_READ;
+  else if (access == MemoryAccess::ReadWrite)
+    prot = VM_PROT_READ | VM_PROT_WRITE;
+
+  kern_return_t retval =
+      vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(view), size, false, prot);
+  if (retval != KERN_SUCCESS)
+  {
+    ERROR_LOG_FMT(MEMMAP, "ProtectMemoryRegion failed: vm_protect returned {0:#x}", retval);
+    return false;
+  }
+  return true;
+}
+
+size_t MemArena::GetProtectionGranularity() const
+{
+  return static_cast<size_t>(vm_page_size);
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
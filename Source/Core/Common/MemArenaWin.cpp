@@ -438,6 +438,37 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
   UnmapViewOfFile(view);
 }
 
+size_t MemArena::GetMappingGranularity() const
+{
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwAllocationGranularity;
+}
+
+bool MemArena::ProtectMemoryRegion(void* view, size_t size, MemoryAccess access)
+{
+  DWORD protect = PAGE_NOACCESS;
+  if (access == MemoryAccess::Read)
+    protect = PAGE_READONLY;
+  else if (access == MemoryAccess::ReadWrite)
+    protect = PAGE_READWRITE;
+
+  DWORD old_protect;
+  if (!VirtualProtect(view, size, protect, &old_protect))
+  {
+    ERROR_LOG_FMT(MEMMAP, "ProtectMemoryRegion failed: VirtualProtect: {}", GetLastErrorString());
+    return false;
+  }
+  return true;
+}
+
+size_t MemArena::GetProtectionGranularity() const
+{
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwPageSize;
+}
+
 LazyMemoryRegion::LazyMemoryRegion()
 {
   InitWindowsMemoryFunctions(&m_memory_functions);
@@ -3,10 +3,16 @@
 
 #include "Common/MemoryUtil.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <vector>
 
+#include "Common/Align.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -20,6 +26,11 @@
 #include <stdio.h>
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach.h>
+#include <mach/mach_vm.h>
+#endif
 #if defined __APPLE__ || defined __FreeBSD__ || defined __OpenBSD__ || defined __NetBSD__
 #include <sys/sysctl.h>
 #elif defined __HAIKU__
@@ -34,18 +45,222 @@ namespace Common
 // This is purposely not a full wrapper for virtualalloc/mmap, but it
 // provides exactly the primitive operations that Dolphin needs.
 
-void* AllocateExecutableMemory(size_t size)
+#ifdef _WIN32
+// Large pages can only be allocated with SeLockMemoryPrivilege, which has to be granted to the
+// user and is disabled in the process token by default.
+static bool EnableLockMemoryPrivilege()
+{
+  static const bool enabled = [] {
+    HANDLE token;
+    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+      return false;
+
+    TOKEN_PRIVILEGES privileges{};
+    privileges.PrivilegeCount = 1;
+    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+    const bool result =
+        LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+        AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+        GetLastError() == ERROR_SUCCESS;
+    CloseHandle(token);
+
+    if (!result)
+      WARN_LOG_FMT(COMMON, "Large pages are unavailable: {}", GetLastErrorString());
+    return result;
+  }();
+  return enabled;
+}
+
+static void* AllocateExecutableLargePages(size_t size)
+{
+  const size_t large_page_size = GetLargePageMinimum();
+  if (large_page_size == 0 || !EnableLockMemoryPrivilege())
+    return nullptr;
+
+  return VirtualAlloc(nullptr, Common::AlignUp(size, large_page_size),
+                      MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_EXECUTE_READWRITE);
+}
+#endif
+
+namespace
+{
+struct DualMapping
+{
+  u8* executable;
+  u8* writable;
+  size_t size;
+#ifdef _WIN32
+  HANDLE section;
+#endif
+};
+}  // namespace
+
+static std::shared_mutex s_dual_mappings_lock;
+static std::vector<DualMapping> s_dual_mappings;
+// Lets GetWritableAliasOffset skip the lock on hosts which never dual-map memory.
+static std::atomic<bool> s_has_dual_mappings = false;
+// Whether the JITPageWrite functions have to toggle the W^X state of the thread.
+[[maybe_unused]] static std::atomic<bool> s_has_map_jit_memory = false;
+
+void* AllocateDualMappedExecutableMemory(size_t size)
 {
+  DualMapping mapping{nullptr, nullptr, size};
+
 #if defined(_WIN32)
-  void* ptr = VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+  const u64 size64 = size;
+  mapping.section =
+      CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_EXECUTE_READWRITE | SEC_COMMIT,
+                         static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), nullptr);
+  if (!mapping.section)
+  {
+    WARN_LOG_FMT(COMMON, "CreateFileMapping failed: {}", GetLastErrorString());
+    return nullptr;
+  }
+
+  mapping.executable = static_cast<u8*>(
+      MapViewOfFile(mapping.section, FILE_MAP_READ | FILE_MAP_EXECUTE, 0, 0, size));
+  mapping.writable = static_cast<u8*>(MapViewOfFile(mapping.section, FILE_MAP_WRITE, 0, 0, size));
+  if (!mapping.executable || !mapping.writable)
+  {
+    WARN_LOG_FMT(COMMON, "MapViewOfFile failed: {}", GetLastErrorString());
+    if (mapping.executable)
+      UnmapViewOfFile(mapping.executable);
+    if (mapping.writable)
+      UnmapViewOfFile(mapping.writable);
+    CloseHandle(mapping.section);
+    return nullptr;
+  }
+#elif defined(__APPLE__)
+  void* writable = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_SHARED, -1, 0);
+  if (writable == MAP_FAILED)
+    return nullptr;
+
+  mach_vm_address_t executable = 0;
+  vm_prot_t cur_protection, max_protection;
+  const kern_return_t result =
+      mach_vm_remap(mach_task_self(), &executable, size, 0, VM_FLAGS_ANYWHERE, mach_task_self(),
+                    reinterpret_cast<mach_vm_address_t>(writable), FALSE, &cur_protection,
+                    &max_protection, VM_INHERIT_NONE);
+  if (result != KERN_SUCCESS)
+  {
+    WARN_LOG_FMT(COMMON, "mach_vm_remap failed: {}", mach_error_string(result));
+    munmap(writable, size);
+    return nullptr;
+  }
+
+  // Hardened runtimes only allow making memory which isn't MAP_JIT executable with the
+  // allow-unsigned-executable-memory entitlement.
+  if (mprotect(reinterpret_cast<void*>(executable), size, PROT_READ | PROT_EXEC) != 0)
+  {
+    WARN_LOG_FMT(COMMON, "Dual-mapped executable memory is unavailable: {}", LastStrerrorString());
+    munmap(reinterpret_cast<void*>(executable), size);
+    munmap(writable, size);
+    return nullptr;
+  }
+
+  mapping.executable = reinterpret_cast<u8*>(executable);
+  mapping.writable = static_cast<u8*>(writable);
+#elif defined(__linux__) && !defined(__ANDROID__)
+  const int fd = memfd_create("dolphin-jit", MFD_CLOEXEC);
+  if (fd < 0)
+  {
+    WARN_LOG_FMT(COMMON, "memfd_create failed: {}", LastStrerrorString());
+    return nullptr;
+  }
+
+  void* executable = MAP_FAILED;
+  void* writable = MAP_FAILED;
+  if (ftruncate(fd, size) == 0)
+  {
+    executable = mmap(nullptr, size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+    writable = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+
+  if (executable == MAP_FAILED || writable == MAP_FAILED)
+  {
+    WARN_LOG_FMT(COMMON, "Failed to dual-map executable memory: {}", LastStrerrorString());
+    if (executable != MAP_FAILED)
+      munmap(executable, size);
+    if (writable != MAP_FAILED)
+      munmap(writable, size);
+    return nullptr;
+  }
+
+  mapping.executable = static_cast<u8*>(executable);
+  mapping.writable = static_cast<u8*>(writable);
+#else
+  return nullptr;
+#endif
+
+  std::lock_guard lk(s_dual_mappings_lock);
+  s_dual_mappings.push_back(mapping);
+  s_has_dual_mappings.store(true, std::memory_order_relaxed);
+  return mapping.executable;
+}
+
+std::ptrdiff_t GetWritableAliasOffset(const void* ptr)
+{
+  if (!s_has_dual_mappings.load(std::memory_order_relaxed))
+    return 0;
+
+  const u8* const byte_ptr = static_cast<const u8*>(ptr);
+  std::shared_lock lk(s_dual_mappings_lock);
+  for (const DualMapping& mapping : s_dual_mappings)
+  {
+    if (byte_ptr >= mapping.executable && byte_ptr < mapping.executable + mapping.size)
+      return mapping.writable - mapping.executable;
+  }
+  return 0;
+}
+
+// Removes ptr from the dual mappings and unmaps both of its aliases. Returns false if ptr isn't
+// dual-mapped.
+static bool FreeDualMappedMemory(void* ptr)
+{
+  if (!s_has_dual_mappings.load(std::memory_order_relaxed))
+    return false;
+
+  DualMapping mapping;
+  {
+    std::lock_guard lk(s_dual_mappings_lock);
+    const auto it = std::ranges::find(s_dual_mappings, ptr, &DualMapping::executable);
+    if (it == s_dual_mappings.end())
+      return false;
+    mapping = *it;
+    s_dual_mappings.erase(it);
+  }
+
+#ifdef _WIN32
+  if (!UnmapViewOfFile(mapping.executable) || !UnmapViewOfFile(mapping.writable) ||
+      !CloseHandle(mapping.section))
+  {
+    PanicAlertFmt("FreeMemoryPages failed!\nUnmapViewOfFile: {}", GetLastErrorString());
+  }
+#else
+  if (munmap(mapping.executable, mapping.size) != 0 || munmap(mapping.writable, mapping.size) != 0)
+    PanicAlertFmt("FreeMemoryPages failed!\nmunmap: {}", LastStrerrorString());
+#endif
+  return true;
+}
+
+void* AllocateExecutableMemory(size_t size, bool huge_pages)
+{
+#if defined(_WIN32)
+  void* ptr = huge_pages ? AllocateExecutableLargePages(size) : nullptr;
+  if (ptr == nullptr)
+    ptr = VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
 #else
   int map_flags = MAP_ANON | MAP_PRIVATE;
 #if defined(__APPLE__)
   map_flags |= MAP_JIT;
+  s_has_map_jit_memory.store(true, std::memory_order_relaxed);
 #endif
   void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, map_flags, -1, 0);
   if (ptr == MAP_FAILED)
     ptr = nullptr;
+  else if (huge_pages)
+    AdviseHugePages(ptr, size);
 #endif
 
   if (ptr == nullptr)
@@ -91,11 +306,14 @@ static int& JITPageWriteNestCounter()
 // JITPageWriteDisableExecuteEnable();
 // [JIT page is in execute mode for the thread]
 
+// Dual-mapped memory is always writable through its writable alias and executable through the
+// other one, so the toggling is skipped until MAP_JIT memory is allocated.
+
 // Allows a thread to write to executable memory, but not execute the data.
 void JITPageWriteEnableExecuteDisable()
 {
 #if defined(_M_ARM_64) && defined(__APPLE__)
-  if (JITPageWriteNestCounter() == 0)
+  if (JITPageWriteNestCounter() == 0 && s_has_map_jit_memory.load(std::memory_order_relaxed))
   {
     pthread_jit_write_protect_np(0);
   }
@@ -114,7 +332,7 @@ void JITPageWriteDisableExecuteEnable()
     PanicAlertFmt("JITPageWriteNestCounter() underflowed");
 
 #if defined(_M_ARM_64) && defined(__APPLE__)
-  if (JITPageWriteNestCounter() == 0)
+  if (JITPageWriteNestCounter() == 0 && s_has_map_jit_memory.load(std::memory_order_relaxed))
   {
     pthread_jit_write_protect_np(1);
   }
@@ -156,7 +374,7 @@ void* AllocateAlignedMemory(size_t size, size_t alignment)
 
 bool FreeMemoryPages(void* ptr, size_t size)
 {
-  if (ptr)
+  if (ptr && !FreeDualMappedMemory(ptr))
   {
 #ifdef _WIN32
     if (!VirtualFree(ptr, 0, MEM_RELEASE))
@@ -175,6 +393,14 @@ bool FreeMemoryPages(void* ptr, size_t size)
   return true;
 }
 
+void AdviseHugePages(void* ptr, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+  if (madvise(ptr, size, MADV_HUGEPAGE) != 0)
+    WARN_LOG_FMT(COMMON, "madvise(MADV_HUGEPAGE) failed: {}", LastStrerrorString());
+#endif
+}
+
 void FreeAlignedMemory(void* ptr)
 {
   if (ptr)
@@ -5,16 +5,48 @@
 
 #include <cstddef>
 #include <string>
+#include <type_traits>
+
+#include "Common/CommonTypes.h"
 
 namespace Common
 {
-void* AllocateExecutableMemory(size_t size);
+// If huge_pages is set, the memory is backed by huge pages where the OS allows it, which reduces
+// iTLB misses when executing code from it. Otherwise, or if that fails, normal pages are used.
+void* AllocateExecutableMemory(size_t size, bool huge_pages = false);
+
+// Allocates executable memory which is mapped a second time at a writable address, so that code
+// can be written to it without making the executable mapping writable, and without the per-thread
+// W^X toggling which MAP_JIT memory needs. Returns nullptr if the host doesn't allow it, in which
+// case AllocateExecutableMemory should be used instead. Free it with FreeMemoryPages.
+void* AllocateDualMappedExecutableMemory(size_t size);
+
+// Whether CodeBlocks should try AllocateDualMappedExecutableMemory first. Only true where it
+// saves toggling the W^X state of the thread.
+#if defined(_M_ARM_64) && defined(__APPLE__)
+constexpr bool PREFER_DUAL_MAPPED_CODE_SPACE = true;
+#else
+constexpr bool PREFER_DUAL_MAPPED_CODE_SPACE = false;
+#endif
+
+// The distance from an address in dual-mapped memory to its writable alias, or 0 if the address
+// isn't in dual-mapped memory.
+std::ptrdiff_t GetWritableAliasOffset(const void* ptr);
+template <typename T>
+T* GetWritableAlias(T* ptr)
+{
+  using Byte = std::conditional_t<std::is_const_v<T>, const u8, u8>;
+  return reinterpret_cast<T*>(reinterpret_cast<Byte*>(ptr) + GetWritableAliasOffset(ptr));
+}
 
 // These two functions control the executable/writable state of the W^X memory
 // allocations. More detailed documentation about them is in the .cpp file.
 // In general where applicable the ScopedJITPageWriteAndNoExecute wrapper
 // should be used to prevent bugs from not pairing up the calls properly.
 
+// They do nothing unless MAP_JIT memory has been allocated, since dual-mapped memory doesn't need
+// them.
+
 // Allows a thread to write to executable memory, but not execute the data.
 void JITPageWriteEnableExecuteDisable();
 // Allows a thread to execute memory allocated for execution, but not write to it.
@@ -28,6 +60,9 @@ struct ScopedJITPageWriteAndNoExecute
 };
 void* AllocateMemoryPages(size_t size);
 bool FreeMemoryPages(void* ptr, size_t size);
+// Hints that the given memory should be backed by transparent huge pages. Does nothing on
+// platforms without them.
+void AdviseHugePages(void* ptr, size_t size);
 void* AllocateAlignedMemory(size_t size, size_t alignment);
 void FreeAlignedMemory(void* ptr);
 bool ReadProtectMemory(void* ptr, size_t size);
@@ -17,6 +17,7 @@
 #include "Common/Common.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/Logging/LogManager.h"
 #include "Common/StringUtil.h"
 
 namespace Common
@@ -115,6 +116,10 @@ static bool ShowMessageAlert(std::string_view text, bool yes_no, Common::Log::Lo
   Common::Log::GenericLogFmt<2>(Common::Log::LogLevel::LERROR, log_type, file, line,
                                 FMT_STRING("{}: {}"), caption, text);
 
+  // Make sure the message and whatever led up to it are written before the alert blocks or aborts.
+  if (auto* log_manager = Common::Log::LogManager::GetInstance())
+    log_manager->Flush();
+
   // Panic alerts.
   if (style == MsgType::Warning && s_abort_on_panic_alert)
   {
@@ -204,6 +204,8 @@ struct TCPPacket
   TCPPacket(const MACAddress& destination, const MACAddress& source, const sockaddr_in& from,
             const sockaddr_in& to, u32 seq, u32 ack, u16 flags);
   std::vector<u8> Build() const;
+  // Reuses the storage of result
+  void Build(std::vector<u8>* result) const;
   u16 Size() const;
 
   EthernetHeader eth_header;
@@ -221,7 +223,11 @@ struct UDPPacket
   UDPPacket();
   UDPPacket(const MACAddress& destination, const MACAddress& source, const sockaddr_in& from,
             const sockaddr_in& to, const std::vector<u8>& payload);
+  UDPPacket(const MACAddress& destination, const MACAddress& source, const sockaddr_in& from,
+            const sockaddr_in& to, std::vector<u8>&& payload);
   std::vector<u8> Build() const;
+  // Reuses the storage of result
+  void Build(std::vector<u8>* result) const;
   u16 Size() const;
 
   EthernetHeader eth_header;
@@ -46,7 +46,7 @@ void PCAP::AddHeader(u32 link_type)
 {
   PCAPHeader hdr = {PCAP_MAGIC, PCAP_VERSION_MAJOR,  PCAP_VERSION_MINOR, 0,
                     0,          PCAP_CAPTURE_LENGTH, link_type};
-  m_fp->WriteBytes(&hdr, sizeof(hdr));
+  WriteBytes(&hdr, sizeof(hdr), nullptr, 0);
 }
 
 // Not thread-safe, concurrency between multiple calls to IOFile::WriteBytes.
@@ -58,7 +58,19 @@ void PCAP::AddPacket(const u8* bytes, size_t size)
       (u32)std::chrono::duration_cast<std::chrono::seconds>(ts).count(),
       (u32)(std::chrono::duration_cast<std::chrono::microseconds>(ts).count() % 1000000), (u32)size,
       (u32)size};
-  m_fp->WriteBytes(&rec_hdr, sizeof(rec_hdr));
-  m_fp->WriteBytes(bytes, size);
+  WriteBytes(&rec_hdr, sizeof(rec_hdr), bytes, size);
+}
+
+void PCAP::WriteBytes(const void* data1, size_t size1, const void* data2, size_t size2)
+{
+  if (m_writer)
+  {
+    // Both parts are queued at once, so that a dropped packet can't leave a partial record
+    m_writer->Write(data1, size1, data2, size2);
+    return;
+  }
+
+  m_fp->WriteBytes(data1, size1);
+  m_fp->WriteBytes(data2, size2);
 }
 }  // namespace Common
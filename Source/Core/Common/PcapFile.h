@@ -15,6 +15,7 @@
 #include <cstddef>
 #include <memory>
 
+#include "Common/AsyncFileWriter.h"
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 
@@ -35,6 +36,12 @@ public:
   {
     AddHeader(static_cast<u32>(link_type));
   }
+  // Writes packets on the writer's thread instead. Packets are dropped if it can't keep up.
+  explicit PCAP(std::unique_ptr<AsyncFileWriter> writer, LinkType link_type = LinkType::User)
+      : m_writer(std::move(writer))
+  {
+    AddHeader(static_cast<u32>(link_type));
+  }
   template <typename T>
   void AddPacket(const T& obj)
   {
@@ -45,7 +52,9 @@ public:
 
 private:
   void AddHeader(u32 link_type);
+  void WriteBytes(const void* data1, size_t size1, const void* data2, size_t size2);
 
   std::unique_ptr<File::IOFile> m_fp;
+  std::unique_ptr<AsyncFileWriter> m_writer;
 };
 }  // namespace Common
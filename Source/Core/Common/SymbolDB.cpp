@@ -3,7 +3,9 @@
 
 #include "Common/SymbolDB.h"
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <map>
 #include <mutex>
 #include <string>
@@ -62,9 +64,36 @@ bool SymbolDB::Clear(const char* prefix)
   m_functions.clear();
   m_notes.clear();
   m_checksum_to_function.clear();
+  InvalidateFunctionIndex();
   return true;
 }
 
+const Symbol* SymbolDB::LookUpFunction(u32 addr) const
+{
+  if (!m_function_index_valid)
+  {
+    m_function_index.clear();
+    m_function_index.reserve(m_functions.size());
+    for (const auto& [address, symbol] : m_functions)
+      m_function_index.push_back({address, &symbol});
+    m_function_index_valid = true;
+  }
+
+  // The last function which starts at or before the address
+  const auto it =
+      std::ranges::upper_bound(m_function_index, addr, {}, &FunctionIndexEntry::address);
+  if (it == m_function_index.begin())
+    return nullptr;
+
+  const Symbol* symbol = std::prev(it)->symbol;
+  // If the address is exactly the start address of a symbol, we're done. Otherwise, check whether
+  // the address is within the bounds of the symbol.
+  if (symbol->address == addr || addr < symbol->address + symbol->size)
+    return symbol;
+
+  return nullptr;
+}
+
 void SymbolDB::Index()
 {
   std::lock_guard lock(m_mutex);
@@ -134,6 +163,7 @@ void SymbolDB::AddCompleteSymbol(const Symbol& symbol)
 {
   std::lock_guard lock(m_mutex);
   m_functions[symbol.address] = symbol;
+  InvalidateFunctionIndex();
 }
 
 bool SymbolDB::RenameSymbol(const Symbol& symbol, const std::string& symbol_name)
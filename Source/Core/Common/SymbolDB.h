@@ -151,10 +151,27 @@ public:
 protected:
   static void Index(XFuncMap* functions);
 
+  // Returns the function which contains the address. m_mutex must be held.
+  const Symbol* LookUpFunction(u32 addr) const;
+  // Must be called when functions are added to or removed from m_functions.
+  void InvalidateFunctionIndex() { m_function_index_valid = false; }
+
   XFuncMap m_functions;
   XNoteMap m_notes;
   XFuncPtrMap m_checksum_to_function;
   std::string m_map_name;
   mutable std::recursive_mutex m_mutex;
+
+private:
+  struct FunctionIndexEntry
+  {
+    u32 address;
+    const Symbol* symbol;
+  };
+
+  // m_functions flattened into an array sorted by address, as lookups by address are done very
+  // often by the debugger and the profiler. It's rebuilt on the next lookup after a change.
+  mutable std::vector<FunctionIndexEntry> m_function_index;
+  mutable bool m_function_index_valid = false;
 };
 }  // namespace Common
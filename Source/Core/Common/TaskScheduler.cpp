@@ -0,0 +1,216 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/TaskScheduler.h"
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+namespace detail
+{
+struct TaskGroupState
+{
+  explicit TaskGroupState(TaskPriority priority_) : priority(priority_) {}
+
+  const TaskPriority priority;
+
+  std::mutex lock;
+  // Signalled when a task is queued, and when the last running task returns.
+  std::condition_variable cv;
+  std::deque<std::function<void()>> queued_tasks;
+  size_t running_tasks = 0;
+};
+}  // namespace detail
+
+namespace
+{
+using detail::TaskGroupState;
+
+// The CPU and GPU threads in dual core mode.
+constexpr u32 NUM_EMULATION_THREADS = 2;
+
+constexpr size_t NUM_PRIORITIES = static_cast<size_t>(TaskPriority::Background) + 1;
+
+// Runs one of the group's queued tasks on the calling thread. Returns false if none was queued.
+bool RunQueuedTask(TaskGroupState& group)
+{
+  std::function<void()> task;
+  {
+    std::lock_guard lk(group.lock);
+    if (group.queued_tasks.empty())
+      return false;
+
+    task = std::move(group.queued_tasks.front());
+    group.queued_tasks.pop_front();
+    group.running_tasks++;
+  }
+
+  task();
+
+  std::lock_guard lk(group.lock);
+  group.running_tasks--;
+  if (group.running_tasks == 0 && group.queued_tasks.empty())
+    group.cv.notify_all();
+  return true;
+}
+
+class TaskScheduler final
+{
+public:
+  TaskScheduler()
+  {
+    const u32 num_threads = GetTaskThreadBudget();
+    m_max_background_tasks = std::max(num_threads - 1, 1u);
+    for (u32 i = 0; i < num_threads; ++i)
+      m_threads.emplace_back(&TaskScheduler::WorkerThread, this, i);
+  }
+
+  ~TaskScheduler()
+  {
+    {
+      std::lock_guard lk(m_lock);
+      m_exit = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads)
+      thread.join();
+  }
+
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+  // Each queued task gets an entry, which runs whichever of the group's tasks is next once a
+  // worker picks it. Entries whose task has been run by a waiting thread do nothing.
+  void Push(std::shared_ptr<TaskGroupState> group)
+  {
+    {
+      std::lock_guard lk(m_lock);
+      m_queues[static_cast<size_t>(group->priority)].push_back(std::move(group));
+    }
+    m_wake.notify_one();
+  }
+
+private:
+  // Returns the queue to take work from, or nullptr if none may be taken from right now.
+  std::deque<std::shared_ptr<TaskGroupState>>* GetNextQueue()
+  {
+    for (size_t i = 0; i < NUM_PRIORITIES; ++i)
+    {
+      if (m_queues[i].empty())
+        continue;
+      if (static_cast<TaskPriority>(i) == TaskPriority::Background &&
+          m_running_background_tasks >= m_max_background_tasks)
+      {
+        continue;
+      }
+      return &m_queues[i];
+    }
+    return nullptr;
+  }
+
+  void WorkerThread(u32 index)
+  {
+    Common::SetCurrentThreadName(fmt::format("Task Worker {}", index).c_str());
+
+    std::unique_lock lk(m_lock);
+    while (true)
+    {
+      std::deque<std::shared_ptr<TaskGroupState>>* queue;
+      m_wake.wait(lk, [&] { return m_exit || (queue = GetNextQueue()) != nullptr; });
+      if (m_exit)
+        return;
+
+      std::shared_ptr<TaskGroupState> group = std::move(queue->front());
+      queue->pop_front();
+      const bool background = group->priority == TaskPriority::Background;
+      if (background)
+        m_running_background_tasks++;
+
+      lk.unlock();
+      RunQueuedTask(*group);
+      group.reset();
+      lk.lock();
+
+      if (background)
+      {
+        // Another worker may have skipped background work while this one was running.
+        m_running_background_tasks--;
+        m_wake.notify_one();
+      }
+    }
+  }
+
+  std::mutex m_lock;
+  std::condition_variable m_wake;
+  std::array<std::deque<std::shared_ptr<TaskGroupState>>, NUM_PRIORITIES> m_queues;
+  u32 m_running_background_tasks = 0;
+  u32 m_max_background_tasks = 1;
+  bool m_exit = false;
+
+  std::vector<std::thread> m_threads;
+};
+
+TaskScheduler& GetScheduler()
+{
+  // Started on first use, so that programs which never run tasks don't start the worker threads.
+  static TaskScheduler scheduler;
+  return scheduler;
+}
+}  // namespace
+
+u32 GetTaskThreadBudget()
+{
+  static const u32 budget = [] {
+    const u32 cores = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::max(cores, NUM_EMULATION_THREADS + 1) - NUM_EMULATION_THREADS;
+  }();
+  return budget;
+}
+
+TaskGroup::TaskGroup(TaskPriority priority)
+    : m_state(std::make_shared<TaskGroupState>(priority))
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+  Wait();
+}
+
+void TaskGroup::Run(std::function<void()> task)
+{
+  {
+    std::lock_guard lk(m_state->lock);
+    m_state->queued_tasks.push_back(std::move(task));
+  }
+  m_state->cv.notify_all();
+  GetScheduler().Push(m_state);
+}
+
+void TaskGroup::Wait()
+{
+  while (true)
+  {
+    if (RunQueuedTask(*m_state))
+      continue;
+
+    std::unique_lock lk(m_state->lock);
+    m_state->cv.wait(lk, [&] {
+      return !m_state->queued_tasks.empty() || m_state->running_tasks == 0;
+    });
+    if (m_state->queued_tasks.empty())
+      return;
+  }
+}
+}  // namespace Common
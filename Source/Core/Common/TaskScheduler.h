@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+enum class TaskPriority
+{
+  // Emulation is blocked until the work is done, e.g. loading a savestate.
+  LatencyCritical,
+  // The work has to be done within about a frame, e.g. reading compressed disc data.
+  FrameBound,
+  // Nothing is waiting for the work, e.g. scanning the game list or converting a disc.
+  Background,
+};
+
+// The number of worker threads which tasks run on. A core each is left to the emulated CPU and GPU
+// threads, so that tasks don't compete with emulation.
+u32 GetTaskThreadBudget();
+
+namespace detail
+{
+struct TaskGroupState;
+}
+
+// A set of tasks which are waited for together. Tasks run on worker threads shared by the whole
+// process, which pick the highest priority work first. Background tasks never occupy every worker,
+// so more urgent work can always start. The thread waiting for a group also runs the group's tasks
+// which haven't been picked up yet, so groups can be waited for from within tasks.
+class TaskGroup final
+{
+public:
+  explicit TaskGroup(TaskPriority priority);
+  // Waits for the group's tasks.
+  ~TaskGroup();
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  void Run(std::function<void()> task);
+
+  // Blocks until all of the group's tasks have returned, including tasks they added.
+  void Wait();
+
+private:
+  std::shared_ptr<detail::TaskGroupState> m_state;
+};
+
+// Calls func(i) for every i in [0, count), spread over the worker threads and the calling thread.
+// Returns once every call has returned. func must be thread-safe.
+template <typename Func>
+void ParallelFor(TaskPriority priority, size_t count, const Func& func)
+{
+  std::atomic<size_t> next = 0;
+  const auto process = [&] {
+    size_t i;
+    while ((i = next++) < count)
+      func(i);
+  };
+
+  TaskGroup group(priority);
+  const size_t num_tasks = std::min<size_t>(count, GetTaskThreadBudget() + 1);
+  for (size_t i = 1; i < num_tasks; ++i)
+    group.Run(process);
+
+  if (count != 0)
+    process();
+
+  group.Wait();
+}
+}  // namespace Common
@@ -3,6 +3,8 @@
 
 #include "Common/Thread.h"
 
+#include "Common/Trace.h"
+
 #ifdef _WIN32
 #include <Windows.h>
 #include <processthreadsapi.h>
@@ -114,6 +116,7 @@ void SetCurrentThreadName(const char* name)
 {
   SetCurrentThreadNameViaException(name);
   SetCurrentThreadNameViaApi(name);
+  Trace::SetCurrentThreadName(name);
 }
 
 #else  // !WIN32, so must be POSIX threads
@@ -184,6 +187,7 @@ void SetCurrentThreadName(const char* name)
   // API.
   __itt_thread_set_name(name);
 #endif
+  Trace::SetCurrentThreadName(name);
 }
 
 std::tuple<void*, size_t> GetCurrentThreadStack()
@@ -0,0 +1,240 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/Trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace Common::Trace
+{
+namespace
+{
+constexpr u64 BUFFER_CAPACITY = 1 << 16;
+constexpr size_t WRITE_CHUNK_SIZE = 1 << 20;
+
+struct Event
+{
+  const char* name;
+  u64 begin;
+  u64 end;
+};
+
+struct ThreadBuffer
+{
+  std::unique_ptr<Event[]> events = std::make_unique<Event[]>(BUFFER_CAPACITY);
+  // Only written by the thread that owns the buffer. The events of a recording are only valid if
+  // session matches the recording.
+  std::atomic<u64> num_events = 0;
+  std::atomic<u32> session = 0;
+
+  // Protected by s_buffers_mutex.
+  std::string thread_name;
+  u32 thread_id = 0;
+  bool owner_exited = false;
+};
+
+std::mutex s_buffers_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+u32 s_next_thread_id = 1;
+
+std::atomic<u32> s_session = 0;
+u64 s_start_time = 0;
+
+// Lets the buffer of a thread be freed once the thread has exited.
+struct ThreadBufferOwner
+{
+  ~ThreadBufferOwner()
+  {
+    if (!buffer)
+      return;
+    std::lock_guard lk(s_buffers_mutex);
+    buffer->owner_exited = true;
+  }
+
+  ThreadBuffer* buffer = nullptr;
+  // Set when the thread is named before it records its first event.
+  std::string thread_name;
+};
+
+thread_local ThreadBufferOwner t_owner;
+
+ThreadBuffer* CreateThreadBuffer()
+{
+  auto buffer = std::make_unique<ThreadBuffer>();
+
+  std::lock_guard lk(s_buffers_mutex);
+  buffer->thread_id = s_next_thread_id++;
+  buffer->thread_name = t_owner.thread_name.empty() ?
+                            fmt::format("Thread {}", buffer->thread_id) :
+                            t_owner.thread_name;
+  t_owner.buffer = buffer.get();
+  s_buffers.push_back(std::move(buffer));
+  return t_owner.buffer;
+}
+
+std::string EscapeJson(std::string_view str)
+{
+  std::string result;
+  result.reserve(str.size());
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      result += '\\';
+      result += c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      result += fmt::format("\\u{:04x}", c);
+    }
+    else
+    {
+      result += c;
+    }
+  }
+  return result;
+}
+
+double ToMicroseconds(u64 ns)
+{
+  return static_cast<double>(ns) / 1000.0;
+}
+}  // namespace
+
+std::atomic<bool> Detail::s_is_running = false;
+
+u64 Detail::GetTimestamp()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+      .count();
+}
+
+void Detail::RecordEvent(const char* name, u64 begin, u64 end)
+{
+  ThreadBuffer* buffer = t_owner.buffer;
+  if (!buffer) [[unlikely]]
+    buffer = CreateThreadBuffer();
+
+  const u32 session = s_session.load(std::memory_order_relaxed);
+  if (buffer->session.load(std::memory_order_relaxed) != session)
+  {
+    buffer->num_events.store(0, std::memory_order_relaxed);
+    buffer->session.store(session, std::memory_order_release);
+  }
+
+  const u64 index = buffer->num_events.load(std::memory_order_relaxed);
+  buffer->events[index % BUFFER_CAPACITY] = {name, begin, end};
+  buffer->num_events.store(index + 1, std::memory_order_release);
+}
+
+void Start()
+{
+  std::lock_guard lk(s_buffers_mutex);
+  std::erase_if(s_buffers, [](const auto& buffer) { return buffer->owner_exited; });
+
+  s_start_time = Detail::GetTimestamp();
+  s_session.fetch_add(1, std::memory_order_relaxed);
+  Detail::s_is_running.store(true, std::memory_order_relaxed);
+}
+
+void Stop()
+{
+  Detail::s_is_running.store(false, std::memory_order_relaxed);
+}
+
+bool WriteChromeTrace(const std::string& path)
+{
+  File::IOFile file(path, "wb");
+  if (!file)
+  {
+    ERROR_LOG_FMT(COMMON, "Could not open trace file {}", path);
+    return false;
+  }
+
+  std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  bool is_first_event = true;
+  const auto append_separator = [&] {
+    if (!is_first_event)
+      out += ",\n";
+    is_first_event = false;
+  };
+
+  bool success = true;
+  {
+    std::lock_guard lk(s_buffers_mutex);
+    const u32 session = s_session.load(std::memory_order_relaxed);
+
+    std::vector<Event> events;
+    for (const auto& buffer : s_buffers)
+    {
+      if (buffer->session.load(std::memory_order_acquire) != session)
+        continue;
+
+      const u64 end_index = buffer->num_events.load(std::memory_order_acquire);
+      const u64 begin_index = end_index > BUFFER_CAPACITY ? end_index - BUFFER_CAPACITY : 0;
+      events.resize(end_index - begin_index);
+      for (u64 i = begin_index; i < end_index; ++i)
+        events[i - begin_index] = buffer->events[i % BUFFER_CAPACITY];
+
+      // A scope that was entered before the recording stopped can still record its event, which
+      // overwrites the oldest one when the buffer is full.
+      const u64 new_end_index = buffer->num_events.load(std::memory_order_acquire);
+      const u64 valid_begin_index =
+          std::max(begin_index, new_end_index > BUFFER_CAPACITY ?
+                                    new_end_index - BUFFER_CAPACITY :
+                                    0);
+
+      append_separator();
+      fmt::format_to(std::back_inserter(out),
+                     R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})",
+                     buffer->thread_id, EscapeJson(buffer->thread_name));
+
+      for (u64 i = valid_begin_index; i < end_index; ++i)
+      {
+        const Event& event = events[i - begin_index];
+        // Scopes that were entered before the recording started.
+        if (event.begin < s_start_time)
+          continue;
+
+        append_separator();
+        fmt::format_to(std::back_inserter(out),
+                       R"({{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                       EscapeJson(event.name), buffer->thread_id,
+                       ToMicroseconds(event.begin - s_start_time),
+                       ToMicroseconds(event.end - event.begin));
+
+        if (out.size() >= WRITE_CHUNK_SIZE)
+        {
+          success &= file.WriteString(out);
+          out.clear();
+        }
+      }
+    }
+  }
+
+  out += "\n]}\n";
+  success &= file.WriteString(out);
+  if (!success)
+    ERROR_LOG_FMT(COMMON, "Could not write trace file {}", path);
+  return success;
+}
+
+void SetCurrentThreadName(const char* name)
+{
+  std::lock_guard lk(s_buffers_mutex);
+  t_owner.thread_name = name;
+  if (t_owner.buffer)
+    t_owner.buffer->thread_name = name;
+}
+}  // namespace Common::Trace
@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Lightweight scoped tracing.
+//
+// TRACE_SCOPE("name") records how long the enclosing scope took on the current thread. Events are
+// written to a ring buffer owned by that thread, so recording never takes a lock. When tracing is
+// not running, a scope costs a relaxed atomic load and a branch.
+//
+// A recording can be written in the Chrome trace event format, which can be opened in Perfetto
+// (ui.perfetto.dev) or chrome://tracing.
+
+#include <atomic>
+#include <string>
+
+#include "CommonTypes.h"
+
+namespace Common::Trace
+{
+namespace Detail
+{
+extern std::atomic<bool> s_is_running;
+
+u64 GetTimestamp();
+void RecordEvent(const char* name, u64 begin, u64 end);
+}  // namespace Detail
+
+inline bool IsRunning()
+{
+  return Detail::s_is_running.load(std::memory_order_relaxed);
+}
+
+// Discards any previous recording and starts a new one.
+void Start();
+void Stop();
+
+// Writes the events of the last recording, which must be stopped. Threads only keep their most
+// recent events when there are too many to fit in their buffer.
+bool WriteChromeTrace(const std::string& path);
+
+// Names the current thread in recordings. Called by Common::SetCurrentThreadName.
+void SetCurrentThreadName(const char* name);
+
+class ScopedEvent
+{
+public:
+  // name must outlive the recording, which string literals do.
+  explicit ScopedEvent(const char* name)
+  {
+    if (IsRunning()) [[unlikely]]
+    {
+      m_name = name;
+      m_begin = Detail::GetTimestamp();
+    }
+  }
+
+  ~ScopedEvent()
+  {
+    if (m_name) [[unlikely]]
+      Detail::RecordEvent(m_name, m_begin, Detail::GetTimestamp());
+  }
+
+  ScopedEvent(const ScopedEvent&) = delete;
+  ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+private:
+  const char* m_name = nullptr;
+  u64 m_begin = 0;
+};
+}  // namespace Common::Trace
+
+#define TRACE_SCOPE_CONCAT_(a, b) a##b
+#define TRACE_SCOPE_CONCAT(a, b) TRACE_SCOPE_CONCAT_(a, b)
+#define TRACE_SCOPE(name)                                                                          \
+  const Common::Trace::ScopedEvent TRACE_SCOPE_CONCAT(trace_scope_, __LINE__)(name)
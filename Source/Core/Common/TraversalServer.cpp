@@ -2,16 +2,19 @@
 
 // The central server implementation.
 #include <arpa/inet.h>
+#include <array>
 #include <cerrno>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <fcntl.h>
 #include <netinet/in.h>
-#include <sys/select.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <tuple>
 #include <unistd.h>
 #include <unordered_map>
@@ -31,9 +34,29 @@
 #define NUMBER_OF_TRIES 5
 #define PORT 6262
 #define PORT_ALT 6226
+// How many packets are received at once from a socket (with recvmmsg where available)
+#define RECV_BATCH_SIZE 64
+#define RECV_BUFFER_SIZE (4 * 1024 * 1024)
+#define CLIENT_EXPIRY_TIME (30 * 1000000)  // 30s
+#define RESEND_CHECK_INTERVAL 50000        // 50ms
+#define STATS_INTERVAL (60 * 1000000)      // 60s
 
 static u64 currentTime;
 
+struct Stats
+{
+  u64 packetsReceived;
+  u64 shortPackets;
+  u64 packetsSent;
+  u64 sendErrors;
+  u64 hellos;
+  u64 connectRequests;
+  u64 connectFailures;
+};
+
+static Stats stats;
+static Stats lastStats;
+
 struct OutgoingPacketInfo
 {
   Common::TraversalPacket packet;
@@ -44,13 +67,6 @@ struct OutgoingPacketInfo
   u64 sendTime;
 };
 
-template <typename T>
-struct EvictEntry
-{
-  u64 updateTime;
-  T value;
-};
-
 template <typename V>
 struct EvictFindResult
 {
@@ -58,54 +74,78 @@ struct EvictFindResult
   V* value;
 };
 
+// Hash map whose entries expire when they haven't been refreshed for CLIENT_EXPIRY_TIME.
+// Every update is also queued in time order, so that expired entries can be removed from the
+// front of the queue without scanning the map.
 template <typename K, typename V>
-EvictFindResult<V> EvictFind(std::unordered_map<K, EvictEntry<V>>& map, const K& key,
-                             bool refresh = false)
+class EvictMap
 {
-retry:
-  const u64 expiryTime = 30 * 1000000;  // 30s
-  EvictFindResult<V> result;
-  if (map.bucket_count())
-  {
-    auto bucket = map.bucket(key);
-    auto it = map.begin(bucket);
-    for (; it != map.end(bucket); ++it)
+public:
+  EvictFindResult<V> Find(const K& key, bool refresh = false)
+  {
+    EvictFindResult<V> result;
+    auto it = map.find(key);
+    if (it != map.end() && currentTime - it->second.updateTime <= CLIENT_EXPIRY_TIME)
     {
-      if (currentTime - it->second.updateTime > expiryTime)
-      {
-        map.erase(it->first);
-        goto retry;
-      }
-      if (it->first == key)
-      {
-        if (refresh)
-          it->second.updateTime = currentTime;
-        result.found = true;
-        result.value = &it->second.value;
-        return result;
-      }
+      if (refresh)
+        Touch(it->first, it->second);
+      result.found = true;
+      result.value = &it->second.value;
+      return result;
     }
-  }
 #if DEBUG
-  fmt::print("failed to find key '");
-  for (size_t i = 0; i < sizeof(key); i++)
+    fmt::print("failed to find key '");
+    for (size_t i = 0; i < sizeof(key); i++)
+    {
+      fmt::print("{:02x}", ((u8*)&key)[i]);
+    }
+    fmt::print("'\n");
+#endif
+    result.found = false;
+    return result;
+  }
+
+  V* Set(const K& key)
   {
-    fmt::print("{:02x}", ((u8*)&key)[i]);
+    auto& entry = map[key];
+    Touch(key, entry);
+    return &entry.value;
   }
-  fmt::print("'\n");
-#endif
-  result.found = false;
-  return result;
-}
 
-template <typename K, typename V>
-V* EvictSet(std::unordered_map<K, EvictEntry<V>>& map, const K& key)
-{
-  // can't use a local_iterator to emplace...
-  auto& result = map[key];
-  result.updateTime = currentTime;
-  return &result.value;
-}
+  void EvictExpired()
+  {
+    while (!expiryQueue.empty() &&
+           currentTime - expiryQueue.front().first > CLIENT_EXPIRY_TIME)
+    {
+      // Entries that have been refreshed since are still queued with their newer time
+      auto it = map.find(expiryQueue.front().second);
+      if (it != map.end() && it->second.updateTime == expiryQueue.front().first)
+        map.erase(it);
+      expiryQueue.pop_front();
+    }
+  }
+
+  size_t Size() const { return map.size(); }
+
+private:
+  struct Entry
+  {
+    u64 updateTime;
+    V value;
+  };
+
+  void Touch(const K& key, Entry& entry)
+  {
+    // Already queued with this time
+    if (entry.updateTime == currentTime)
+      return;
+    entry.updateTime = currentTime;
+    expiryQueue.emplace_back(currentTime, key);
+  }
+
+  std::unordered_map<K, Entry> map;
+  std::deque<std::pair<u64, K>> expiryQueue;
+};
 
 namespace std
 {
@@ -120,13 +160,14 @@ struct hash<Common::TraversalHostId>
 };
 }  // namespace std
 
-using ConnectedClients =
-    std::unordered_map<Common::TraversalHostId, EvictEntry<Common::TraversalInetAddress>>;
+using ConnectedClients = EvictMap<Common::TraversalHostId, Common::TraversalInetAddress>;
 using OutgoingPackets = std::unordered_map<Common::TraversalRequestId, OutgoingPacketInfo>;
 
 static int sock;
 static int sockAlt;
 static OutgoingPackets outgoingPackets;
+// Packets that have been allocated but not sent yet
+static std::vector<Common::TraversalRequestId> newPackets;
 static ConnectedClients connectedClients;
 
 static Common::TraversalInetAddress MakeInetAddress(const sockaddr_in6& addr)
@@ -204,7 +245,10 @@ static void TrySend(const void* buffer, size_t size, sockaddr_in6* addr, bool fr
       size)
   {
     perror("sendto");
+    stats.sendErrors++;
+    return;
   }
+  stats.packetsSent++;
 }
 
 static Common::TraversalPacket* AllocPacket(const sockaddr_in6& dest, bool fromAlt,
@@ -221,6 +265,7 @@ static Common::TraversalPacket* AllocPacket(const sockaddr_in6& dest, bool fromA
   Common::TraversalPacket* result = &info->packet;
   memset(result, 0, sizeof(*result));
   result->requestId = requestId;
+  newPackets.push_back(requestId);
   return result;
 }
 
@@ -231,6 +276,18 @@ static void SendPacket(OutgoingPacketInfo* info)
   TrySend(&info->packet, sizeof(info->packet), &info->dest, info->fromAlt);
 }
 
+// Sends the packets that have been allocated since the last call, once they've been filled in.
+static void SendNewPackets()
+{
+  for (const Common::TraversalRequestId& requestId : newPackets)
+  {
+    auto it = outgoingPackets.find(requestId);
+    if (it != outgoingPackets.end() && it->second.tries == 0)
+      SendPacket(&it->second);
+  }
+  newPackets.clear();
+}
+
 static void ResendPackets()
 {
   std::vector<std::tuple<Common::TraversalInetAddress, bool, Common::TraversalRequestId>>
@@ -265,6 +322,7 @@ static void ResendPackets()
     fail->type = Common::TraversalPacketType::ConnectFailed;
     fail->connectFailed.requestId = std::get<2>(p);
     fail->connectFailed.reason = Common::TraversalConnectFailedReason::ClientDidntRespond;
+    stats.connectFailures++;
   }
 }
 
@@ -307,12 +365,13 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   }
   case Common::TraversalPacketType::Ping:
   {
-    auto r = EvictFind(connectedClients, packet->ping.hostId, true);
+    auto r = connectedClients.Find(packet->ping.hostId, true);
     packetOk = r.found;
     break;
   }
   case Common::TraversalPacketType::HelloFromClient:
   {
+    stats.hellos++;
     u8 ok = packet->helloFromClient.protoVersion <= Common::TraversalProtoVersion;
     Common::TraversalPacket* reply = AllocPacket(*addr, toAlt);
     reply->type = Common::TraversalPacketType::HelloFromServer;
@@ -326,10 +385,10 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
       while (true)
       {
         GetRandomHostId(&hostId);
-        auto r = EvictFind(connectedClients, hostId);
+        auto r = connectedClients.Find(hostId);
         if (!r.found)
         {
-          iaddr = EvictSet(connectedClients, hostId);
+          iaddr = connectedClients.Set(hostId);
           break;
         }
       }
@@ -343,10 +402,12 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   }
   case Common::TraversalPacketType::ConnectPlease:
   {
+    stats.connectRequests++;
     Common::TraversalHostId& hostId = packet->connectPlease.hostId;
-    auto r = EvictFind(connectedClients, hostId);
+    auto r = connectedClients.Find(hostId);
     if (!r.found)
     {
+      stats.connectFailures++;
       Common::TraversalPacket* reply = AllocPacket(*addr, toAlt);
       reply->type = Common::TraversalPacketType::ConnectFailed;
       reply->connectFailed.requestId = packet->requestId;
@@ -364,7 +425,7 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   case Common::TraversalPacketType::TestPlease:
   {
     Common::TraversalHostId& hostId = packet->testPlease.hostId;
-    auto r = EvictFind(connectedClients, hostId);
+    auto r = connectedClients.Find(hostId);
     if (r.found)
     {
       Common::TraversalPacket ack = {};
@@ -392,6 +453,101 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   }
 }
 
+static void UpdateCurrentTime()
+{
+  currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+}
+
+static void HandleReceivedPacket(Common::TraversalPacket* packet, size_t size, sockaddr_in6* addr,
+                                 bool toAlt)
+{
+  stats.packetsReceived++;
+  if (size < sizeof(*packet))
+  {
+    stats.shortPackets++;
+    fmt::print(stderr, "received short packet from {}\n", SenderName(addr));
+    return;
+  }
+  HandlePacket(packet, addr, toAlt);
+}
+
+// Handles up to RECV_BATCH_SIZE packets that are waiting on the socket. Returns false on a fatal
+// error.
+static bool ReceivePackets(int recvsock, bool toAlt)
+{
+  static std::array<Common::TraversalPacket, RECV_BATCH_SIZE> packets;
+  static std::array<sockaddr_in6, RECV_BATCH_SIZE> addrs;
+
+#ifdef __linux__
+  std::array<iovec, RECV_BATCH_SIZE> iovecs;
+  std::array<mmsghdr, RECV_BATCH_SIZE> messages{};
+  for (size_t i = 0; i < RECV_BATCH_SIZE; i++)
+  {
+    iovecs[i].iov_base = &packets[i];
+    iovecs[i].iov_len = sizeof(packets[i]);
+    messages[i].msg_hdr.msg_name = &addrs[i];
+    messages[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+    messages[i].msg_hdr.msg_iov = &iovecs[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  const int count = recvmmsg(recvsock, messages.data(), RECV_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+  if (count < 0)
+  {
+    if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+      perror("recvmmsg");
+      return false;
+    }
+    return true;
+  }
+
+  for (int i = 0; i < count; i++)
+    HandleReceivedPacket(&packets[i], messages[i].msg_len, &addrs[i], toAlt);
+#else
+  for (size_t i = 0; i < RECV_BATCH_SIZE; i++)
+  {
+    socklen_t addrLen = sizeof(addrs[i]);
+    const ssize_t rv = recvfrom(recvsock, &packets[i], sizeof(packets[i]), MSG_DONTWAIT,
+                                (sockaddr*)&addrs[i], &addrLen);
+    if (rv < 0)
+    {
+      if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+      {
+        perror("recvfrom");
+        return false;
+      }
+      break;
+    }
+    HandleReceivedPacket(&packets[i], rv, &addrs[i], toAlt);
+  }
+#endif
+
+  return true;
+}
+
+static void ReportStats(u64 elapsedTime)
+{
+  const double seconds = elapsedTime / 1000000.0;
+  const u64 received = stats.packetsReceived - lastStats.packetsReceived;
+  const u64 sent = stats.packetsSent - lastStats.packetsSent;
+  fmt::print("clients: {}, pending: {}, received: {} ({:.0f}/s), sent: {} ({:.0f}/s), "
+             "short: {}, send errors: {}, hellos: {}, connects: {} ({} failed)\n",
+             connectedClients.Size(), outgoingPackets.size(), received, received / seconds, sent,
+             sent / seconds, stats.shortPackets - lastStats.shortPackets,
+             stats.sendErrors - lastStats.sendErrors, stats.hellos - lastStats.hellos,
+             stats.connectRequests - lastStats.connectRequests,
+             stats.connectFailures - lastStats.connectFailures);
+  fflush(stdout);
+#ifdef HAVE_LIBSYSTEMD
+  sd_notifyf(0, "STATUS=Listening on port %d (alt port: %d), %zu clients, %.0f packets/s", PORT,
+             PORT_ALT, connectedClients.Size(), received / seconds);
+#endif
+  lastStats = stats;
+}
+
 int main()
 {
   int rv;
@@ -445,84 +601,60 @@ int main()
     return 1;
   }
 
-  timeval tv;
-  tv.tv_sec = 0;
-  tv.tv_usec = 300000;
-  rv = setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
-  if (rv < 0)
-  {
-    perror("setsockopt SO_RCVTIMEO");
-    return 1;
-  }
-  rv = setsockopt(sockAlt, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
-  if (rv < 0)
-  {
-    perror("setsockopt SO_RCVTIMEO alt");
-    return 1;
-  }
+  // A larger receive buffer avoids dropping packets when many arrive at once. This is only a
+  // hint, so failing to set it isn't an error.
+  int recvBufferSize = RECV_BUFFER_SIZE;
+  setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &recvBufferSize, sizeof(recvBufferSize));
+  setsockopt(sockAlt, SOL_SOCKET, SO_RCVBUF, &recvBufferSize, sizeof(recvBufferSize));
 
 #ifdef HAVE_LIBSYSTEMD
   sd_notifyf(0, "READY=1\nSTATUS=Listening on port %d (alt port: %d)", PORT, PORT_ALT);
 #endif
 
+  UpdateCurrentTime();
+  u64 lastResendTime = currentTime;
+  u64 lastStatsTime = currentTime;
+
+  pollfd fds[2]{};
+  fds[0].fd = sock;
+  fds[0].events = POLLIN;
+  fds[1].fd = sockAlt;
+  fds[1].events = POLLIN;
+
   while (true)
   {
-    tv.tv_sec = 0;
-    tv.tv_usec = 300000;
-    fd_set readSet;
-    FD_ZERO(&readSet);
-    FD_SET(sock, &readSet);
-    FD_SET(sockAlt, &readSet);
-    rv = select(std::max(sock, sockAlt) + 1, &readSet, nullptr, nullptr, &tv);
-    if (rv < 0)
+    rv = poll(fds, 2, RESEND_CHECK_INTERVAL / 1000);
+    if (rv < 0 && errno != EINTR && errno != EAGAIN)
     {
-      if (errno != EINTR && errno != EAGAIN)
-      {
-        perror("recvfrom");
-        return 1;
-      }
+      perror("poll");
+      return 1;
     }
 
-    int recvsock;
-    if (FD_ISSET(sock, &readSet))
-    {
-      recvsock = sock;
-    }
-    else if (FD_ISSET(sockAlt, &readSet))
+    UpdateCurrentTime();
+    if (rv > 0)
     {
-      recvsock = sockAlt;
-    }
-    else
-    {
-      ResendPackets();
-      continue;
-    }
-    sockaddr_in6 raddr;
-    socklen_t addrLen = sizeof(raddr);
-    Common::TraversalPacket packet{};
-    // note: switch to recvmmsg (yes, mmsg) if this becomes
-    // expensive
-    rv = recvfrom(recvsock, &packet, sizeof(packet), 0, (sockaddr*)&raddr, &addrLen);
-    currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
-                      std::chrono::system_clock::now().time_since_epoch())
-                      .count();
-    if (rv < 0)
-    {
-      if (errno != EINTR && errno != EAGAIN)
+      for (const pollfd& fd : fds)
       {
-        perror("recvfrom");
-        return 1;
+        if ((fd.revents & POLLIN) && !ReceivePackets(fd.fd, fd.fd == sockAlt))
+          return 1;
       }
     }
-    else if ((size_t)rv < sizeof(packet))
+    SendNewPackets();
+
+    if (currentTime - lastResendTime >= RESEND_CHECK_INTERVAL)
     {
-      fmt::print(stderr, "received short packet from {}\n", SenderName(&raddr));
+      lastResendTime = currentTime;
+      ResendPackets();
+      SendNewPackets();
+      connectedClients.EvictExpired();
     }
-    else
+
+    if (currentTime - lastStatsTime >= STATS_INTERVAL)
     {
-      HandlePacket(&packet, &raddr, recvsock == sockAlt);
+      ReportStats(currentTime - lastStatsTime);
+      lastStatsTime = currentTime;
     }
-    ResendPackets();
+
 #ifdef HAVE_LIBSYSTEMD
     sd_notify(0, "WATCHDOG=1");
 #endif
@@ -170,6 +170,8 @@ void CPUInfo::Detect()
       has_sse = true;
     if (info.ecx & 1)
       bSSE3 = true;
+    if ((info.ecx >> 1) & 1)
+      bPCLMULQDQ = true;
     if ((info.ecx >> 9) & 1)
       bSSSE3 = true;
     if ((info.ecx >> 19) & 1)
@@ -201,6 +203,15 @@ void CPUInfo::Detect()
       info = cpuid(7);
       if ((info.ebx >> 3) & 1)
         bBMI1 = true;
+      // AVX2 relies on the same OS support as AVX.
+      if (bAVX && ((info.ebx >> 5) & 1))
+        bAVX2 = true;
+      // AVX-512 additionally needs the OS to save the opmask and upper ZMM registers.
+      if (bAVX && ((info.ebx >> 16) & 1) &&
+          (xgetbv(XCR_XFEATURE_ENABLED_MASK) & 0b11100110) == 0b11100110)
+      {
+        bAVX512F = true;
+      }
       if ((info.ebx >> 8) & 1)
         bBMI2 = true;
       if ((info.ebx >> 29) & 1)
@@ -259,6 +270,10 @@ std::string CPUInfo::Summarize()
     sum.push_back("HTT");
   if (bAVX)
     sum.push_back("AVX");
+  if (bAVX2)
+    sum.push_back("AVX2");
+  if (bAVX512F)
+    sum.push_back("AVX512F");
   if (bBMI1)
     sum.push_back("BMI1");
   if (bBMI2)
@@ -269,6 +284,8 @@ std::string CPUInfo::Summarize()
     sum.push_back("MOVBE");
   if (bAES)
     sum.push_back("AES");
+  if (bPCLMULQDQ)
+    sum.push_back("PCLMULQDQ");
   if (bCRC32)
     sum.push_back("CRC32");
   if (bSHA1)
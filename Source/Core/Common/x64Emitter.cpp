@@ -105,6 +105,7 @@ void XEmitter::SetCodePtr(u8* ptr, u8* end, bool write_failed)
   code = ptr;
   m_code_end = end;
   m_write_failed = write_failed;
+  m_writable_offset = Common::GetWritableAliasOffset(ptr);
 }
 
 void XEmitter::Write8(u8 value)
@@ -116,7 +117,8 @@ void XEmitter::Write8(u8 value)
     return;
   }
 
-  *code++ = value;
+  code[m_writable_offset] = value;
+  code++;
 }
 
 void XEmitter::Write16(u16 value)
@@ -128,7 +130,7 @@ void XEmitter::Write16(u16 value)
     return;
   }
 
-  std::memcpy(code, &value, sizeof(u16));
+  std::memcpy(code + m_writable_offset, &value, sizeof(u16));
   code += sizeof(u16);
 }
 
@@ -141,7 +143,7 @@ void XEmitter::Write32(u32 value)
     return;
   }
 
-  std::memcpy(code, &value, sizeof(u32));
+  std::memcpy(code + m_writable_offset, &value, sizeof(u32));
   code += sizeof(u32);
 }
 
@@ -154,7 +156,7 @@ void XEmitter::Write64(u64 value)
     return;
   }
 
-  std::memcpy(code, &value, sizeof(u64));
+  std::memcpy(code + m_writable_offset, &value, sizeof(u64));
   code += sizeof(u64);
 }
 
@@ -167,8 +169,8 @@ void XEmitter::ReserveCodeSpace(int bytes)
     return;
   }
 
-  for (int i = 0; i < bytes; i++)
-    *code++ = 0xCC;
+  std::memset(code + m_writable_offset, 0xCC, bytes);
+  code += bytes;
 }
 
 u8* XEmitter::AlignCodeTo(size_t alignment)
@@ -575,7 +577,7 @@ void XEmitter::SetJumpTarget(const FixupBranch& branch)
     s64 distance = (s64)(code - branch.ptr);
     ASSERT_MSG(DYNA_REC, distance >= -0x80 && distance < 0x80,
                "Jump::Short target too far away ({}), needs Jump::Near", distance);
-    branch.ptr[-1] = (u8)(s8)distance;
+    branch.ptr[m_writable_offset - 1] = (u8)(s8)distance;
   }
   else if (branch.type == FixupBranch::Type::Branch32Bit)
   {
@@ -584,7 +586,7 @@ void XEmitter::SetJumpTarget(const FixupBranch& branch)
                "Jump::Near target too far away ({}), needs indirect register", distance);
 
     s32 valid_distance = static_cast<s32>(distance);
-    std::memcpy(&branch.ptr[-4], &valid_distance, sizeof(s32));
+    std::memcpy(&branch.ptr[m_writable_offset - 4], &valid_distance, sizeof(s32));
   }
 }
 
@@ -334,6 +334,9 @@ private:
   // Writes that would reach this memory are refused and will set the m_write_failed flag instead.
   u8* m_code_end = nullptr;
 
+  // The distance from code to where it's written, which differs for dual-mapped code space.
+  std::ptrdiff_t m_writable_offset = 0;
+
   bool flags_locked = false;
 
   // Set to true when a write request happens that would write past m_code_end.
@@ -385,7 +388,11 @@ protected:
 
 public:
   XEmitter() = default;
-  explicit XEmitter(u8* code_ptr, u8* code_end) : code(code_ptr), m_code_end(code_end) {}
+  explicit XEmitter(u8* code_ptr, u8* code_end)
+      : code(code_ptr), m_code_end(code_end),
+        m_writable_offset(Common::GetWritableAliasOffset(code_ptr))
+  {
+  }
   virtual ~XEmitter() = default;
   void SetCodePtr(u8* ptr, u8* end, bool write_failed = false);
   void ReserveCodeSpace(int bytes);
@@ -1206,7 +1213,7 @@ private:
   void PoisonMemory() override
   {
     // x86/64: 0xCC = breakpoint
-    memset(region, 0xCC, region_size);
+    memset(Common::GetWritableAlias(region), 0xCC, region_size);
   }
 };
 
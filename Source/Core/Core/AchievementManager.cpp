@@ -5,6 +5,7 @@
 
 #include "Core/AchievementManager.h"
 
+#include <algorithm>
 #include <cctype>
 #include <memory>
 
@@ -337,7 +338,14 @@ void AchievementManager::DoFrame()
     }
 #endif  // RC_CLIENT_SUPPORTS_RAINTEGRATION
     std::lock_guard lg{m_lock};
+    Core::System* system = m_system.load(std::memory_order_acquire);
+    if (system && !m_dll_found)
+    {
+      Core::CPUThreadGuard thread_guard(*system);
+      UpdateMemorySnapshot(thread_guard);
+    }
     rc_client_do_frame(m_client);
+    m_memory_snapshot_valid = false;
   }
   auto current_time = std::chrono::steady_clock::now();
   if (current_time - m_last_rp_time > std::chrono::seconds{10})
@@ -735,6 +743,9 @@ void AchievementManager::CloseGame()
     m_locked_badges.clear();
     m_leaderboard_map.clear();
     m_rich_presence.fill('\0');
+    m_memory_snapshot_ranges.clear();
+    m_new_memory_snapshot_ranges.clear();
+    m_memory_snapshot.clear();
     m_system.store(nullptr, std::memory_order_release);
     if (Config::Get(Config::RA_DISCORD_PRESENCE_ENABLED))
       Discord::UpdateDiscordPresence();
@@ -1342,8 +1353,14 @@ u32 AchievementManager::MemoryPeeker(u32 address, u8* buffer, u32 num_bytes, rc_
     ASSERT_MSG(ACHIEVEMENTS, false, "MemoryPeeker called from wrong thread");
     return 0;
   }
+  if (instance.m_memory_snapshot_valid && Core::IsCPUThread())
+  {
+    if (instance.ReadMemorySnapshot(address, buffer, num_bytes))
+      return num_bytes;
+    instance.AddMemorySnapshotRange(system, address, num_bytes);
+  }
   Core::CPUThreadGuard thread_guard(system);
-  if (address > MEM1_SIZE)
+  if (address >= MEM1_SIZE)
     address += (MEM2_START - MEM1_SIZE);
   for (u32 num_read = 0; num_read < num_bytes; num_read++)
   {
@@ -1356,6 +1373,84 @@ u32 AchievementManager::MemoryPeeker(u32 address, u8* buffer, u32 num_bytes, rc_
   return num_bytes;
 }
 
+// Requires m_lock
+void AchievementManager::UpdateMemorySnapshot(const Core::CPUThreadGuard& guard)
+{
+  // Ranges which are close together are merged, since copying a few bytes in between is cheaper
+  // than looking up separate ranges.
+  static constexpr u32 MERGE_DISTANCE = 64;
+
+  if (!m_new_memory_snapshot_ranges.empty())
+  {
+    std::vector<std::pair<u32, u32>> ranges = std::move(m_new_memory_snapshot_ranges);
+    m_new_memory_snapshot_ranges.clear();
+    for (const MemorySnapshotRange& range : m_memory_snapshot_ranges)
+      ranges.emplace_back(range.address, range.address + range.size);
+    std::ranges::sort(ranges);
+
+    m_memory_snapshot_ranges.clear();
+    u32 offset = 0;
+    for (auto [start, end] : ranges)
+    {
+      if (!m_memory_snapshot_ranges.empty())
+      {
+        MemorySnapshotRange& last = m_memory_snapshot_ranges.back();
+        const u32 last_end = last.address + last.size;
+        // MEM1 and MEM2 aren't next to each other in physical memory.
+        const bool same_region = (last.address < MEM1_SIZE) == (start < MEM1_SIZE);
+        if (same_region && start <= last_end + MERGE_DISTANCE)
+        {
+          if (end > last_end)
+          {
+            offset += end - last_end;
+            last.size = end - last.address;
+          }
+          continue;
+        }
+      }
+      m_memory_snapshot_ranges.push_back({start, end - start, offset});
+      offset += end - start;
+    }
+    m_memory_snapshot.resize(offset);
+  }
+
+  const Memory::MemoryManager& memory = guard.GetSystem().GetMemory();
+  for (const MemorySnapshotRange& range : m_memory_snapshot_ranges)
+  {
+    const u32 physical_address =
+        range.address < MEM1_SIZE ? range.address : range.address + (MEM2_START - MEM1_SIZE);
+    memory.CopyFromEmu(m_memory_snapshot.data() + range.offset, physical_address, range.size);
+  }
+  m_memory_snapshot_valid = true;
+}
+
+bool AchievementManager::ReadMemorySnapshot(u32 address, u8* buffer, u32 num_bytes) const
+{
+  auto it = std::ranges::upper_bound(m_memory_snapshot_ranges, address, {},
+                                     &MemorySnapshotRange::address);
+  if (it == m_memory_snapshot_ranges.begin())
+    return false;
+  --it;
+  if (u64(address) + num_bytes > u64(it->address) + it->size)
+    return false;
+
+  std::copy_n(m_memory_snapshot.data() + it->offset + (address - it->address), num_bytes, buffer);
+  return true;
+}
+
+void AchievementManager::AddMemorySnapshotRange(const Core::System& system, u32 address,
+                                                u32 num_bytes)
+{
+  // Only ranges which are entirely in MEM1 or entirely in MEM2 can be copied in bulk.
+  Memory::MemoryManager& memory = system.GetMemory();
+  const u64 end = u64(address) + num_bytes;
+  const bool in_mem1 = end <= std::min(MEM1_SIZE, memory.GetRamSizeReal());
+  const bool in_mem2 = address >= MEM1_SIZE && memory.GetEXRAM() != nullptr &&
+                       end <= MEM1_SIZE + u64(memory.GetExRamSizeReal());
+  if (num_bytes != 0 && (in_mem1 || in_mem2))
+    m_new_memory_snapshot_ranges.emplace_back(address, static_cast<u32>(end));
+}
+
 void AchievementManager::FetchBadge(AchievementManager::Badge* badge, u32 badge_type,
                                     const AchievementManager::BadgeNameFunction function,
                                     UpdatedItems callback_data)
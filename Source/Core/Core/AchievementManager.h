@@ -18,6 +18,7 @@
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <rcheevos/include/rc_api_runtime.h>
@@ -247,6 +248,9 @@ private:
                       void* callback_data, rc_client_t* client);
   static u32 MemoryVerifier(u32 address, u8* buffer, u32 num_bytes, rc_client_t* client);
   static u32 MemoryPeeker(u32 address, u8* buffer, u32 num_bytes, rc_client_t* client);
+  void UpdateMemorySnapshot(const Core::CPUThreadGuard& guard);
+  bool ReadMemorySnapshot(u32 address, u8* buffer, u32 num_bytes) const;
+  void AddMemorySnapshotRange(const Core::System& system, u32 address, u32 num_bytes);
   void FetchBadge(Badge* badge, u32 badge_type, const BadgeNameFunction function,
                   const UpdatedItems callback_data);
   static void EventHandler(const rc_client_event_t* event, rc_client_t* client);
@@ -288,6 +292,23 @@ private:
   std::unordered_set<AchievementId> m_active_challenges;
   std::vector<rc_client_leaderboard_tracker_t> m_active_leaderboards;
 
+  // rcheevos reads the same addresses every frame, so the ranges it has read are copied in bulk
+  // at the start of each frame, and its reads are served from that copy.
+  struct MemorySnapshotRange
+  {
+    u32 address;
+    u32 size;
+    // Where the range starts in m_memory_snapshot
+    u32 offset;
+  };
+  // Sorted by address, without overlaps
+  std::vector<MemorySnapshotRange> m_memory_snapshot_ranges;
+  // The start and end of ranges which were read outside of the snapshot this frame
+  std::vector<std::pair<u32, u32>> m_new_memory_snapshot_ranges;
+  std::vector<u8> m_memory_snapshot;
+  // Only set on the CPU thread while rc_client_do_frame runs
+  bool m_memory_snapshot_valid = false;
+
   bool m_dll_found = false;
 #ifdef RC_CLIENT_SUPPORTS_RAINTEGRATION
   std::vector<u8> m_cloned_memory;
@@ -25,6 +25,7 @@
 #include <bit>
 #include <iterator>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
@@ -32,18 +33,24 @@
 
 #include <fmt/format.h>
 
+#include "Common/Align.h"
 #include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
 #include "Common/IniFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Swap.h"
 
 #include "Core/ARDecrypt.h"
 #include "Core/AchievementManager.h"
 #include "Core/CheatCodes.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
 #include "Core/Debugger/PPCDebugInterface.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 namespace ActionReplay
 {
@@ -93,6 +100,41 @@ static std::atomic<bool> s_use_internal_log{false};
 static const ARCode* s_current_code = nullptr;
 static bool s_disable_logging = false;
 
+enum class CompiledOpType : u8
+{
+  Write,
+  Add,
+  AddFloat,
+  Compare,
+  Nop,
+  End,
+};
+
+// One line of a code, translated so that running it doesn't have to decode it or translate its
+// address through the MMU again.
+struct CompiledOp
+{
+  CompiledOpType type = CompiledOpType::Nop;
+  // Bytes per access.
+  u8 size = 0;
+  // The CONDTIONAL_* type and line count of compares.
+  u8 compare_type = 0;
+  u8 skip_subtype = 0;
+  bool is_endif = false;
+  // The number of values written by fills.
+  u32 count = 1;
+  u32 value = 0;
+  u32 address = 0;
+  // The DBAT entry that host_pointer was resolved with.
+  u32 bat_entry = 0;
+  u8* host_pointer = nullptr;
+};
+
+// Parallel to s_active_codes. Codes which use lines the compiled ops don't cover are nullopt, and
+// are always interpreted.
+static std::vector<std::optional<std::vector<CompiledOp>>> s_compiled_codes;
+static bool s_compiled_codes_dirty = true;
+
 struct ARAddr
 {
   union
@@ -121,6 +163,7 @@ void ApplyCodes(std::span<const ARCode> codes, const std::string& game_id, u16 r
 
   std::lock_guard guard(s_lock);
   s_disable_logging = false;
+  s_compiled_codes_dirty = true;
   s_active_codes.clear();
   std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                [&game_id, &revision](const ARCode& code) {
@@ -135,6 +178,7 @@ void SetSyncedCodesAsActive()
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
+  s_compiled_codes_dirty = true;
 }
 
 void UpdateSyncedCodes(std::span<const ARCode> codes)
@@ -152,6 +196,7 @@ std::vector<ARCode> ApplyAndReturnCodes(std::span<const ARCode> codes)
   {
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
+    s_compiled_codes_dirty = true;
     s_active_codes.clear();
     std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                  [](const ARCode& code) { return code.enabled; });
@@ -170,6 +215,7 @@ void AddCode(ARCode code)
   {
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
+    s_compiled_codes_dirty = true;
     s_active_codes.emplace_back(std::move(code));
   }
 }
@@ -999,6 +1045,276 @@ static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcod
   return true;
 }
 
+static u8 GetAccessSize(const u32 size)
+{
+  switch (size)
+  {
+  case DATATYPE_8BIT:
+    return 1;
+  case DATATYPE_16BIT:
+    return 2;
+  default:
+    return 4;
+  }
+}
+
+static std::optional<CompiledOp> CompileLine(const AREntry& entry)
+{
+  const ARAddr addr(entry.cmd_addr);
+  const u32 data = entry.value;
+
+  CompiledOp op;
+  op.is_endif = addr == 0 && data == 0x40000000;
+
+  if (addr == 0)
+  {
+    switch (data >> 29)
+    {
+    case ZCODE_END:
+      op.type = CompiledOpType::End;
+      return op;
+    case ZCODE_NORM:
+      op.type = CompiledOpType::Nop;
+      return op;
+    default:
+      // Fill and slide and memory copy span two lines, so they're left to the interpreter.
+      return std::nullopt;
+    }
+  }
+
+  if (addr >= 0x00002000 && addr < 0x00003000)
+    return std::nullopt;
+
+  op.size = GetAccessSize(addr.size);
+  op.address = addr.GCAddress();
+  op.value = data;
+
+  if (addr.type != 0x00)
+  {
+    op.type = CompiledOpType::Compare;
+    op.compare_type = addr.type;
+    op.skip_subtype = addr.subtype;
+    if (addr.size == DATATYPE_8BIT)
+      op.value = data & 0xFF;
+    else if (addr.size == DATATYPE_16BIT)
+      op.value = data & 0xFFFF;
+  }
+  else if (addr.subtype == SUB_RAM_WRITE)
+  {
+    op.type = CompiledOpType::Write;
+    if (addr.size == DATATYPE_8BIT)
+    {
+      op.count = (data >> 8) + 1;
+      op.value = data & 0xFF;
+    }
+    else if (addr.size == DATATYPE_16BIT)
+    {
+      op.count = (data >> 16) + 1;
+      op.value = data & 0xFFFF;
+    }
+  }
+  else if (addr.subtype == SUB_ADD_CODE)
+  {
+    op.type = addr.size == DATATYPE_32BIT_FLOAT ? CompiledOpType::AddFloat : CompiledOpType::Add;
+  }
+  else
+  {
+    // Writes to pointers depend on RAM contents, and master codes aren't supported.
+    return std::nullopt;
+  }
+
+  // Host pointers are resolved per BAT page, so accesses must not cross into the next one.
+  const u32 last_address = op.address + op.count * op.size - 1;
+  if (last_address < op.address || (op.address ^ last_address) >> PowerPC::BAT_INDEX_SHIFT != 0)
+    return std::nullopt;
+
+  return op;
+}
+
+static std::optional<std::vector<CompiledOp>> CompileCode(const ARCode& arcode)
+{
+  std::vector<CompiledOp> ops;
+  ops.reserve(arcode.ops.size());
+  for (const AREntry& entry : arcode.ops)
+  {
+    std::optional<CompiledOp> op = CompileLine(entry);
+    if (!op)
+      return std::nullopt;
+    ops.push_back(*op);
+  }
+  return ops;
+}
+
+// Resolves the host pointers of all lines that access memory. Returns false if one of them isn't
+// in RAM which can be accessed directly, in which case the code must be interpreted.
+static bool ResolveHostPointers(Memory::MemoryManager& memory,
+                                const PowerPC::BatTable& dbat_table, std::vector<CompiledOp>& ops)
+{
+  for (CompiledOp& op : ops)
+  {
+    if (op.type == CompiledOpType::Nop || op.type == CompiledOpType::End)
+      continue;
+
+    const u32 bat_entry = dbat_table[op.address >> PowerPC::BAT_INDEX_SHIFT];
+    if (bat_entry != op.bat_entry || op.host_pointer == nullptr)
+    {
+      op.bat_entry = bat_entry;
+      op.host_pointer = nullptr;
+      if ((bat_entry & PowerPC::BAT_PHYSICAL_BIT) == 0)
+        return false;
+
+      // Pages mapped to the fake VMEM or the locked L1 cache are left to the interpreter.
+      const u32 physical_address = (bat_entry & PowerPC::BAT_RESULT_MASK) |
+                                   (op.address & (PowerPC::BAT_PAGE_SIZE - 1));
+      const bool is_mem1 = physical_address < memory.GetRamSizeReal();
+      const bool is_mem2 = memory.GetEXRAM() && physical_address >> 28 == 0x1 &&
+                           (physical_address & 0x0FFFFFFF) < memory.GetExRamSizeReal();
+      if (!is_mem1 && !is_mem2)
+        return false;
+
+      op.host_pointer = memory.GetSpanForAddress(physical_address).data();
+    }
+  }
+  return true;
+}
+
+static u32 ReadHostValue(const u8* src, const u8 size)
+{
+  switch (size)
+  {
+  case 1:
+    return *src;
+  case 2:
+    return Common::swap16(src);
+  default:
+    return Common::swap32(src);
+  }
+}
+
+// Behaves like ApplyMemoryPatch, so that only words which actually change get their cached
+// instructions invalidated.
+static void WriteHostValue(PowerPC::PowerPCManager& power_pc, u8* dest, const u32 address,
+                           const u32 value, const u8 size)
+{
+  bool should_invalidate_cache = false;
+  for (u32 offset = 0; offset < size; ++offset)
+  {
+    const u8 byte = static_cast<u8>(value >> ((size - 1 - offset) * 8));
+    if (dest[offset] != byte)
+    {
+      dest[offset] = byte;
+      should_invalidate_cache = true;
+    }
+
+    if (((address + offset) % 4) == 3 || offset == size - 1u)
+    {
+      if (should_invalidate_cache)
+        power_pc.ScheduleInvalidateCacheThreadSafe(Common::AlignDown(address + offset, 4));
+      should_invalidate_cache = false;
+    }
+  }
+}
+
+static bool CompareValuesQuietly(const u32 val1, const u32 val2, const int type)
+{
+  switch (type)
+  {
+  case CONDTIONAL_EQUAL:
+    return val1 == val2;
+  case CONDTIONAL_NOT_EQUAL:
+    return val1 != val2;
+  case CONDTIONAL_LESS_THAN_SIGNED:
+    return static_cast<s32>(val1) < static_cast<s32>(val2);
+  case CONDTIONAL_GREATER_THAN_SIGNED:
+    return static_cast<s32>(val1) > static_cast<s32>(val2);
+  case CONDTIONAL_LESS_THAN_UNSIGNED:
+    return val1 < val2;
+  case CONDTIONAL_GREATER_THAN_UNSIGNED:
+    return val1 > val2;
+  default:
+    return (val1 & val2) != 0;
+  }
+}
+
+// Runs a code the same way as RunCodeLocked, minus the logging.
+static void RunCompiledCode(PowerPC::PowerPCManager& power_pc, const std::vector<CompiledOp>& ops)
+{
+  int skip_count = 0;
+
+  for (const CompiledOp& op : ops)
+  {
+    if (skip_count)
+    {
+      if (skip_count > 0)
+        --skip_count;
+      else if (-CONDTIONAL_ALL_LINES == skip_count)
+        return;
+      else if (op.is_endif)
+        skip_count = 0;
+      continue;
+    }
+
+    switch (op.type)
+    {
+    case CompiledOpType::Write:
+      for (u32 i = 0; i < op.count; ++i)
+      {
+        WriteHostValue(power_pc, op.host_pointer + i * op.size, op.address + i * op.size, op.value,
+                       op.size);
+      }
+      break;
+
+    case CompiledOpType::Add:
+      WriteHostValue(power_pc, op.host_pointer, op.address,
+                     ReadHostValue(op.host_pointer, op.size) + op.value, op.size);
+      break;
+
+    case CompiledOpType::AddFloat:
+    {
+      const float value = std::bit_cast<float>(ReadHostValue(op.host_pointer, op.size));
+      WriteHostValue(power_pc, op.host_pointer, op.address,
+                     std::bit_cast<u32>(value + static_cast<float>(op.value)), op.size);
+      break;
+    }
+
+    case CompiledOpType::Compare:
+      if (!CompareValuesQuietly(ReadHostValue(op.host_pointer, op.size), op.value,
+                                op.compare_type))
+      {
+        if (op.skip_subtype == CONDTIONAL_ONE_LINE || op.skip_subtype == CONDTIONAL_TWO_LINES)
+          skip_count = op.skip_subtype + 1;
+        else
+          skip_count = -static_cast<int>(op.skip_subtype);
+      }
+      break;
+
+    case CompiledOpType::Nop:
+      break;
+
+    case CompiledOpType::End:
+      return;
+    }
+  }
+}
+
+// Compiled codes access RAM without going through the MMU, so they can only be used when the
+// accesses wouldn't have any side effects there.
+static bool CanRunCompiledCodes(const Core::CPUThreadGuard& cpu_guard)
+{
+  // The first run of each set of codes is interpreted so that it gets logged.
+  if (!s_disable_logging)
+    return false;
+
+  // ApplyMemoryPatch doesn't write anything in hardcore mode.
+  if (AchievementManager::GetInstance().IsHardcoreModeActive())
+    return false;
+
+  const Core::System& system = cpu_guard.GetSystem();
+  const PowerPC::PowerPCState& ppc_state = system.GetPPCState();
+  return !system.GetPowerPC().GetMemChecks().HasAny() && ppc_state.msr.DR &&
+         !ppc_state.m_enable_dcache;
+}
+
 void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
 {
   if (!Config::AreCheatsEnabled())
@@ -1008,11 +1324,50 @@ void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard guard(s_lock);
-  std::erase_if(s_active_codes, [&cpu_guard](const ARCode& code) {
-    const bool success = RunCodeLocked(cpu_guard, code);
-    LogInfo("\n");
-    return !success;
-  });
+
+  if (s_compiled_codes_dirty)
+  {
+    s_compiled_codes.clear();
+    s_compiled_codes.reserve(s_active_codes.size());
+    for (const ARCode& code : s_active_codes)
+      s_compiled_codes.push_back(CompileCode(code));
+    s_compiled_codes_dirty = false;
+  }
+
+  Core::System& system = cpu_guard.GetSystem();
+  const bool use_compiled_codes = CanRunCompiledCodes(cpu_guard);
+  Memory::MemoryManager& memory = system.GetMemory();
+  const PowerPC::BatTable& dbat_table = system.GetMMU().GetDBATTable();
+  PowerPC::PowerPCManager& power_pc = system.GetPowerPC();
+
+  // Codes which fail are removed from both lists.
+  size_t kept_codes = 0;
+  for (size_t i = 0; i < s_active_codes.size(); ++i)
+  {
+    std::optional<std::vector<CompiledOp>>& compiled_code = s_compiled_codes[i];
+    if (use_compiled_codes && compiled_code &&
+        ResolveHostPointers(memory, dbat_table, *compiled_code))
+    {
+      RunCompiledCode(power_pc, *compiled_code);
+    }
+    else
+    {
+      const bool success = RunCodeLocked(cpu_guard, s_active_codes[i]);
+      LogInfo("\n");
+      if (!success)
+        continue;
+    }
+
+    if (kept_codes != i)
+    {
+      s_active_codes[kept_codes] = std::move(s_active_codes[i]);
+      s_compiled_codes[kept_codes] = std::move(compiled_code);
+    }
+    ++kept_codes;
+  }
+  s_active_codes.erase(s_active_codes.begin() + kept_codes, s_active_codes.end());
+  s_compiled_codes.erase(s_compiled_codes.begin() + kept_codes, s_compiled_codes.end());
+
   s_disable_logging = true;
 }
 
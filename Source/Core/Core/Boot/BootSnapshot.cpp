@@ -0,0 +1,130 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Boot/BootSnapshot.h"
+
+#include <set>
+#include <utility>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/Logging/Log.h"
+#include "Common/Version.h"
+#include "Core/Boot/Boot.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/HLE/HLE.h"
+#include "Core/Movie.h"
+#include "Core/NetPlayProto.h"
+#include "Core/State.h"
+#include "Core/System.h"
+#include "DiscIO/DiscUtils.h"
+#include "DiscIO/VolumeDisc.h"
+
+namespace BootSnapshot
+{
+// The path to save the snapshot to once the entry point is reached. Empty if it's not armed.
+static std::string s_pending_path;
+
+constexpr u32 DOL_ENTRY_POINT_OFFSET = 0xE0;
+
+// Whether a setting can change the state of the emulated hardware when the game starts.
+static bool AffectsSnapshot(const Config::Location& location)
+{
+  if (location == Config::MAIN_FAST_BOOT_SNAPSHOT.GetLocation())
+    return false;
+
+  if (location.system == Config::System::SYSCONF)
+    return true;
+
+  return location.system == Config::System::Main &&
+         (location.section == "Core" || location.section == "DSP");
+}
+
+static std::string DescribeSettings()
+{
+  std::set<Config::Location> locations;
+  for (const Config::LayerType type : Config::SEARCH_ORDER)
+  {
+    const std::shared_ptr<Config::Layer> layer = Config::GetLayer(type);
+    if (!layer)
+      continue;
+
+    for (const auto& [location, value] : layer->GetLayerMap())
+    {
+      if (AffectsSnapshot(location))
+        locations.insert(location);
+    }
+  }
+
+  // Settings which aren't in any layer have their default values, so they don't need to be listed.
+  std::string description;
+  for (const Config::Location& location : locations)
+  {
+    description += fmt::format("{}.{}.{}={}\n", Config::GetSystemName(location.system),
+                               location.section, location.key,
+                               Config::GetAsString(location).value_or(""));
+  }
+  return description;
+}
+
+std::optional<Snapshot> GetSnapshot(Core::System& system, const BootParameters& boot)
+{
+  if (!Config::Get(Config::MAIN_FAST_BOOT_SNAPSHOT) || NetPlay::IsNetPlayRunning() ||
+      system.GetMovie().IsMovieActive() || !boot.riivolution_patches.empty())
+  {
+    return std::nullopt;
+  }
+
+  const auto* ipl = std::get_if<BootParameters::IPL>(&boot.parameters);
+  if (!ipl || !ipl->disc || !ipl->disc->volume)
+    return std::nullopt;
+
+  const DiscIO::VolumeDisc& volume = *ipl->disc->volume;
+  const DiscIO::Partition partition = volume.GetGamePartition();
+  const std::optional<u64> dol_offset = DiscIO::GetBootDOLOffset(volume, partition);
+  const std::optional<u32> entry_point =
+      dol_offset ? volume.ReadSwapped<u32>(*dol_offset + DOL_ENTRY_POINT_OFFSET, partition) :
+                   std::nullopt;
+  std::string key_data;
+  if (!entry_point || !File::ReadFileToString(ipl->path, key_data))
+    return std::nullopt;
+
+  key_data += Common::GetScmRevGitStr();
+  key_data += DescribeSettings();
+  const Common::Hash128 key = Common::ComputeHash128(key_data.data(), key_data.size());
+
+  const std::string directory = File::GetUserPath(D_CACHE_IDX) + BOOTSNAPSHOTCACHE_DIR DIR_SEP;
+  File::CreateFullPath(directory);
+  std::string path = fmt::format("{}{}_r{}_d{}_{:016x}{:016x}.sav", directory,
+                                 volume.GetGameID(partition),
+                                 volume.GetRevision(partition).value_or(0),
+                                 volume.GetDiscNumber(partition).value_or(0), key.high, key.low);
+  return Snapshot{std::move(path), *entry_point};
+}
+
+void Arm(Core::System& system, const Snapshot& snapshot)
+{
+  s_pending_path = snapshot.path;
+  HLE::Patch(system, snapshot.entry_point, "BootSnapshot");
+}
+
+void OnEntryPointReached(const Core::CPUThreadGuard& guard)
+{
+  // The hook stays installed for the rest of the session, but only saves once.
+  if (s_pending_path.empty())
+    return;
+
+  // If the snapshot was loaded, the game has already passed its entry point. Reaching it means the
+  // IPL ran after all, e.g. because the snapshot couldn't be loaded, so it's replaced.
+  NOTICE_LOG_FMT(BOOT, "Saving fast boot snapshot {}", s_pending_path);
+  Core::QueueHostJob([path = std::exchange(s_pending_path, {})](Core::System& system) {
+    State::SaveAs(system, path, true);
+  });
+}
+}  // namespace BootSnapshot
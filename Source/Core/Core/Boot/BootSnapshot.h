@@ -0,0 +1,43 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Core
+{
+class CPUThreadGuard;
+class System;
+}  // namespace Core
+
+struct BootParameters;
+
+// Fast boot snapshots skip the emulated IPL on later boots of a game. The first boot saves a
+// state once the IPL has run the apploader and jumps to the game's entry point, and later boots
+// load that state instead of running the IPL again.
+//
+// Snapshots are keyed by the game ID, revision and disc number, the IPL, the Dolphin build and the
+// settings which affect the emulated hardware, so any mismatch cold boots instead. Boots which skip
+// the IPL aren't snapshotted, since they already start at the game's entry point.
+namespace BootSnapshot
+{
+struct Snapshot
+{
+  std::string path;
+  // The effective address of the game's entry point
+  u32 entry_point;
+};
+
+// Returns the snapshot to use for this boot, or std::nullopt if it can't use one.
+std::optional<Snapshot> GetSnapshot(Core::System& system, const BootParameters& boot);
+
+// Saves the snapshot once the game's entry point is reached. Must be called after booting.
+void Arm(Core::System& system, const Snapshot& snapshot);
+
+// Called by the HLE hook at the entry point.
+void OnEntryPointReached(const Core::CPUThreadGuard& guard);
+}  // namespace BootSnapshot
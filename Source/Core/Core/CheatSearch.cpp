@@ -3,10 +3,14 @@
 
 #include "Core/CheatSearch.h"
 
+#include <algorithm>
+#include <array>
 #include <bit>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <variant>
@@ -15,6 +19,8 @@
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
+#include "Common/TaskScheduler.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Core.h"
@@ -200,17 +206,223 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
 }
 }  // namespace
 
+// Physical RAM is scanned in chunks of this many values, which are spread over the worker threads.
+constexpr size_t SCAN_CHUNK_SIZE = 0x40000;
+
+// Within a chunk, values are compared in blocks of this many. The comparisons of a block don't
+// branch, so that the compiler can vectorize them.
+constexpr size_t SCAN_BLOCK_SIZE = 64;
+
+template <typename T>
+static T LoadBigEndian(const u8* data)
+{
+  if constexpr (sizeof(T) == 1)
+  {
+    return std::bit_cast<T>(*data);
+  }
+  else if constexpr (sizeof(T) == 2)
+  {
+    u16 value;
+    std::memcpy(&value, data, sizeof(value));
+    return std::bit_cast<T>(Common::swap16(value));
+  }
+  else if constexpr (sizeof(T) == 4)
+  {
+    u32 value;
+    std::memcpy(&value, data, sizeof(value));
+    return std::bit_cast<T>(Common::swap32(value));
+  }
+  else
+  {
+    u64 value;
+    std::memcpy(&value, data, sizeof(value));
+    return std::bit_cast<T>(Common::swap64(value));
+  }
+}
+
+// Whether NewSearch and NextSearch may read the given address space straight from host memory
+// instead of going through the MMU.
+static bool CanReadPhysicalRAMDirectly(const Core::System& system,
+                                       PowerPC::RequestedAddressSpace address_space)
+{
+  const auto& ppc_state = system.GetPPCState();
+  if (ppc_state.m_enable_dcache)
+    return false;
+
+  return address_space == PowerPC::RequestedAddressSpace::Physical ||
+         (address_space == PowerPC::RequestedAddressSpace::Effective && !ppc_state.msr.DR);
+}
+
+// Returns the host memory backing MEM1 or MEM2 from the given physical address up to the end of
+// that RAM, or an empty span if the address isn't in either.
+static std::span<const u8> GetPhysicalRAMSpan(Memory::MemoryManager& memory, u32 address)
+{
+  if (memory.GetRAM() && address < memory.GetRamSizeReal())
+    return {memory.GetRAM() + address, memory.GetRamSizeReal() - address};
+
+  constexpr u32 exram_base = 0x10000000;
+  if (memory.GetEXRAM() && address >= exram_base &&
+      address - exram_base < memory.GetExRamSizeReal())
+  {
+    return {memory.GetEXRAM() + (address - exram_base),
+            memory.GetExRamSizeReal() - (address - exram_base)};
+  }
+
+  return {};
+}
+
+// Adds the values at data + i * stride for i in [0, count) which pass the comparison to results.
+template <typename T, typename Compare>
+static void ScanChunk(const u8* data, size_t count, size_t stride, u32 address, T compare_value,
+                      const Compare& compare, Cheats::SearchResults<T>* results)
+{
+  std::array<T, SCAN_BLOCK_SIZE> values;
+  std::array<u8, SCAN_BLOCK_SIZE> matches;
+
+  for (size_t block_start = 0; block_start < count; block_start += SCAN_BLOCK_SIZE)
+  {
+    const u8* block_data = data + block_start * stride;
+    const size_t block_size = std::min(SCAN_BLOCK_SIZE, count - block_start);
+    if (block_size == SCAN_BLOCK_SIZE)
+    {
+      for (size_t i = 0; i < SCAN_BLOCK_SIZE; ++i)
+      {
+        values[i] = LoadBigEndian<T>(block_data + i * stride);
+        matches[i] = compare(values[i], compare_value);
+      }
+    }
+    else
+    {
+      matches.fill(0);
+      for (size_t i = 0; i < block_size; ++i)
+      {
+        values[i] = LoadBigEndian<T>(block_data + i * stride);
+        matches[i] = compare(values[i], compare_value);
+      }
+    }
+
+    // Most blocks have no matches when searching for a specific value, so skip them quickly.
+    for (size_t word = 0; word < SCAN_BLOCK_SIZE; word += sizeof(u64))
+    {
+      u64 any_match;
+      std::memcpy(&any_match, &matches[word], sizeof(any_match));
+      if (any_match == 0)
+        continue;
+
+      for (size_t i = word; i < word + sizeof(u64); ++i)
+      {
+        if (matches[i])
+        {
+          results->Add(static_cast<u32>(address + (block_start + i) * stride), values[i],
+                       Cheats::SearchResultValueState::ValueFromPhysicalMemory);
+        }
+      }
+    }
+  }
+}
+
+// Scans count values spaced stride bytes apart, starting at the given host memory which backs the
+// given physical address.
+template <typename T, typename Compare>
+static void ScanPhysicalRAM(const u8* data, size_t count, size_t stride, u32 address,
+                            T compare_value, const Compare& compare,
+                            Cheats::SearchResults<T>* results)
+{
+  const size_t chunk_count = (count + SCAN_CHUNK_SIZE - 1) / SCAN_CHUNK_SIZE;
+  std::vector<Cheats::SearchResults<T>> chunk_results(chunk_count);
+  Common::ParallelFor(Common::TaskPriority::LatencyCritical, chunk_count, [&](size_t chunk) {
+    const size_t first = chunk * SCAN_CHUNK_SIZE;
+    ScanChunk(data + first * stride, std::min(SCAN_CHUNK_SIZE, count - first), stride,
+              static_cast<u32>(address + first * stride), compare_value, compare,
+              &chunk_results[chunk]);
+  });
+
+  size_t total = results->Size();
+  for (const Cheats::SearchResults<T>& chunk_result : chunk_results)
+    total += chunk_result.Size();
+  results->Reserve(total);
+  for (const Cheats::SearchResults<T>& chunk_result : chunk_results)
+    results->Append(chunk_result, 0, chunk_result.Size());
+}
+
+template <typename T>
+static void ScanPhysicalRAM(const u8* data, size_t count, size_t stride, u32 address,
+                            const Cheats::SearchFilter<T>& filter,
+                            Cheats::SearchResults<T>* results)
+{
+  const auto scan = [&](const auto& compare) {
+    ScanPhysicalRAM(data, count, stride, address, filter.m_value, compare, results);
+  };
+
+  if (!filter.m_compare_type)
+  {
+    scan([](const T&, const T&) { return true; });
+    return;
+  }
+
+  switch (*filter.m_compare_type)
+  {
+  case Cheats::CompareType::Equal:
+    scan(std::equal_to<T>());
+    break;
+  case Cheats::CompareType::NotEqual:
+    scan(std::not_equal_to<T>());
+    break;
+  case Cheats::CompareType::Less:
+    scan(std::less<T>());
+    break;
+  case Cheats::CompareType::LessOrEqual:
+    scan(std::less_equal<T>());
+    break;
+  case Cheats::CompareType::Greater:
+    scan(std::greater<T>());
+    break;
+  case Cheats::CompareType::GreaterOrEqual:
+    scan(std::greater_equal<T>());
+    break;
+  default:
+    DEBUG_ASSERT(false);
+    break;
+  }
+}
+
 template <typename T>
-Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
+static bool PassesFilter(const Cheats::SearchFilter<T>& filter, const T& value)
+{
+  if (!filter.m_compare_type)
+    return true;
+
+  switch (*filter.m_compare_type)
+  {
+  case Cheats::CompareType::Equal:
+    return value == filter.m_value;
+  case Cheats::CompareType::NotEqual:
+    return value != filter.m_value;
+  case Cheats::CompareType::Less:
+    return value < filter.m_value;
+  case Cheats::CompareType::LessOrEqual:
+    return value <= filter.m_value;
+  case Cheats::CompareType::Greater:
+    return value > filter.m_value;
+  case Cheats::CompareType::GreaterOrEqual:
+    return value >= filter.m_value;
+  default:
+    DEBUG_ASSERT(false);
+    return false;
+  }
+}
+
+template <typename T>
+Common::Result<Cheats::SearchErrorCode, Cheats::SearchResults<T>>
 Cheats::NewSearch(const Core::CPUThreadGuard& guard,
                   const std::vector<Cheats::MemoryRange>& memory_ranges,
                   PowerPC::RequestedAddressSpace address_space, bool aligned,
-                  const std::function<bool(const T& value)>& validator)
+                  const Cheats::SearchFilter<T>& filter)
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return Cheats::SearchErrorCode::DisabledInHardcoreMode;
   auto& system = guard.GetSystem();
-  std::vector<Cheats::SearchResult<T>> results;
+  Cheats::SearchResults<T> results;
   const Core::State core_state = Core::GetState(system);
   if (core_state != Core::State::Running && core_state != Core::State::Paused)
     return Cheats::SearchErrorCode::NoEmulationActive;
@@ -219,6 +431,9 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  auto& memory = system.GetMemory();
+  const bool read_directly = CanReadPhysicalRAMDirectly(system, address_space);
+
   for (const Cheats::MemoryRange& range : memory_ranges)
   {
     if (range.m_length < sizeof(T))
@@ -232,21 +447,34 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
       continue;
 
     const u64 length = aligned_length - (sizeof(T) - 1);
-    for (u64 i = 0; i < length; i += increment_per_loop)
+    for (u64 i = 0; i < length;)
     {
       const u32 addr = start_address + i;
+
+      // Scan all values which lie entirely within the same RAM at once.
+      const std::span<const u8> ram =
+          read_directly ? GetPhysicalRAMSpan(memory, addr) : std::span<const u8>();
+      if (ram.size() >= sizeof(T))
+      {
+        const u64 count = std::min<u64>((ram.size() - sizeof(T)) / increment_per_loop + 1,
+                                        (length - i + increment_per_loop - 1) / increment_per_loop);
+        ScanPhysicalRAM(ram.data(), count, increment_per_loop, addr, filter, &results);
+        i += count * increment_per_loop;
+        continue;
+      }
+
+      i += increment_per_loop;
+
       const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
       if (!current_value)
         continue;
 
-      if (validator(current_value->value))
+      if (PassesFilter(filter, current_value->value))
       {
-        auto& r = results.emplace_back();
-        r.m_value = current_value->value;
-        r.m_value_state = current_value->translated ?
-                              Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                              Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-        r.m_address = addr;
+        results.Add(addr, current_value->value,
+                    current_value->translated ?
+                        Cheats::SearchResultValueState::ValueFromVirtualMemory :
+                        Cheats::SearchResultValueState::ValueFromPhysicalMemory);
       }
     }
   }
@@ -254,16 +482,16 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
 }
 
 template <typename T>
-Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
+Common::Result<Cheats::SearchErrorCode, Cheats::SearchResults<T>>
 Cheats::NextSearch(const Core::CPUThreadGuard& guard,
-                   const std::vector<Cheats::SearchResult<T>>& previous_results,
+                   const Cheats::SearchResults<T>& previous_results,
                    PowerPC::RequestedAddressSpace address_space,
                    const std::function<bool(const T& new_value, const T& old_value)>& validator)
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return Cheats::SearchErrorCode::DisabledInHardcoreMode;
   auto& system = guard.GetSystem();
-  std::vector<Cheats::SearchResult<T>> results;
+  Cheats::SearchResults<T> results;
   const Core::State core_state = Core::GetState(system);
   if (core_state != Core::State::Running && core_state != Core::State::Paused)
     return Cheats::SearchErrorCode::NoEmulationActive;
@@ -272,28 +500,40 @@ Cheats::NextSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
-  for (const auto& previous_result : previous_results)
+  auto& memory = system.GetMemory();
+  const bool read_directly = CanReadPhysicalRAMDirectly(system, address_space);
+
+  results.Reserve(previous_results.Size());
+  for (size_t i = 0; i < previous_results.Size(); ++i)
   {
-    const u32 addr = previous_result.m_address;
-    const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+    const u32 addr = previous_results.m_addresses[i];
+    std::optional<PowerPC::ReadResult<T>> current_value;
+    if (const std::span<const u8> ram =
+            read_directly ? GetPhysicalRAMSpan(memory, addr) : std::span<const u8>();
+        ram.size() >= sizeof(T))
+    {
+      current_value.emplace(false, LoadBigEndian<T>(ram.data()));
+    }
+    else
+    {
+      current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+    }
+
     if (!current_value)
     {
-      auto& r = results.emplace_back();
-      r.m_address = addr;
-      r.m_value_state = Cheats::SearchResultValueState::AddressNotAccessible;
+      results.Add(addr, T{}, Cheats::SearchResultValueState::AddressNotAccessible);
       continue;
     }
 
     // if the previous state was invalid we always update the value to avoid getting stuck in an
     // invalid state
-    if (!previous_result.IsValueValid() || validator(current_value->value, previous_result.m_value))
+    if (!previous_results.IsValueValid(i) ||
+        validator(current_value->value, previous_results.m_values[i]))
     {
-      auto& r = results.emplace_back();
-      r.m_value = current_value->value;
-      r.m_value_state = current_value->translated ?
-                            Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                            Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-      r.m_address = addr;
+      results.Add(addr, current_value->value,
+                  current_value->translated ?
+                      Cheats::SearchResultValueState::ValueFromVirtualMemory :
+                      Cheats::SearchResultValueState::ValueFromPhysicalMemory);
     }
   }
   return results;
@@ -371,7 +611,7 @@ template <typename T>
 void Cheats::CheatSearchSession<T>::ResetResults()
 {
   m_first_search_done = false;
-  m_search_results.clear();
+  m_search_results = {};
 }
 
 template <typename T>
@@ -427,23 +667,24 @@ Cheats::SearchErrorCode Cheats::CheatSearchSession<T>::RunSearch(const Core::CPU
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return Cheats::SearchErrorCode::DisabledInHardcoreMode;
-  Common::Result<SearchErrorCode, std::vector<SearchResult<T>>> result =
+  Common::Result<SearchErrorCode, SearchResults<T>> result =
       Cheats::SearchErrorCode::InvalidParameters;
   if (m_filter_type == FilterType::CompareAgainstSpecificValue)
   {
     if (!m_value)
       return Cheats::SearchErrorCode::InvalidParameters;
 
-    auto func = MakeCompareFunctionForSpecificValue<T>(m_compare_type, *m_value);
     if (m_first_search_done)
     {
+      auto func = MakeCompareFunctionForSpecificValue<T>(m_compare_type, *m_value);
       result = Cheats::NextSearch<T>(
           guard, m_search_results, m_address_space,
           [&func](const T& new_value, const T& old_value) { return func(new_value); });
     }
     else
     {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned, func);
+      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned,
+                                    {m_compare_type, *m_value});
     }
   }
   else if (m_filter_type == FilterType::CompareAgainstLastValue)
@@ -463,8 +704,7 @@ Cheats::SearchErrorCode Cheats::CheatSearchSession<T>::RunSearch(const Core::CPU
     }
     else
     {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned,
-                                    [](const T& v) { return true; });
+      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned, {});
     }
   }
 
@@ -523,17 +763,16 @@ bool Cheats::CheatSearchSession<T>::IsFloatingType() const
 template <typename T>
 size_t Cheats::CheatSearchSession<T>::GetResultCount() const
 {
-  return m_search_results.size();
+  return m_search_results.Size();
 }
 
 template <typename T>
 size_t Cheats::CheatSearchSession<T>::GetValidValueCount() const
 {
-  const auto& results = m_search_results;
   size_t count = 0;
-  for (const auto& r : results)
+  for (size_t i = 0; i < m_search_results.Size(); ++i)
   {
-    if (r.IsValueValid())
+    if (m_search_results.IsValueValid(i))
       ++count;
   }
   return count;
@@ -542,19 +781,19 @@ size_t Cheats::CheatSearchSession<T>::GetValidValueCount() const
 template <typename T>
 u32 Cheats::CheatSearchSession<T>::GetResultAddress(size_t index) const
 {
-  return m_search_results[index].m_address;
+  return m_search_results.m_addresses[index];
 }
 
 template <typename T>
 T Cheats::CheatSearchSession<T>::GetResultValue(size_t index) const
 {
-  return m_search_results[index].m_value;
+  return m_search_results.m_values[index];
 }
 
 template <typename T>
 Cheats::SearchValue Cheats::CheatSearchSession<T>::GetResultValueAsSearchValue(size_t index) const
 {
-  return Cheats::SearchValue{m_search_results[index].m_value};
+  return Cheats::SearchValue{m_search_results.m_values[index]};
 }
 
 template <typename T>
@@ -567,28 +806,28 @@ std::string Cheats::CheatSearchSession<T>::GetResultValueAsString(size_t index,
   {
     if constexpr (std::is_same_v<T, float>)
     {
-      return fmt::format("0x{0:08x}", std::bit_cast<s32>(m_search_results[index].m_value));
+      return fmt::format("0x{0:08x}", std::bit_cast<s32>(m_search_results.m_values[index]));
     }
     else if constexpr (std::is_same_v<T, double>)
     {
-      return fmt::format("0x{0:016x}", std::bit_cast<s64>(m_search_results[index].m_value));
+      return fmt::format("0x{0:016x}", std::bit_cast<s64>(m_search_results.m_values[index]));
     }
     else
     {
       return fmt::format("0x{0:0{1}x}",
-                         std::bit_cast<std::make_unsigned_t<T>>(m_search_results[index].m_value),
+                         std::bit_cast<std::make_unsigned_t<T>>(m_search_results.m_values[index]),
                          sizeof(T) * 2);
     }
   }
 
-  return fmt::format("{}", m_search_results[index].m_value);
+  return fmt::format("{}", m_search_results.m_values[index]);
 }
 
 template <typename T>
 Cheats::SearchResultValueState
 Cheats::CheatSearchSession<T>::GetResultValueState(size_t index) const
 {
-  return m_search_results[index].m_value_state;
+  return m_search_results.m_value_states[index];
 }
 
 template <typename T>
@@ -607,13 +846,12 @@ template <typename T>
 std::unique_ptr<Cheats::CheatSearchSessionBase>
 Cheats::CheatSearchSession<T>::ClonePartial(const size_t begin_index, const size_t end_index) const
 {
-  if (begin_index == 0 && end_index >= m_search_results.size())
+  if (begin_index == 0 && end_index >= m_search_results.Size())
     return Clone();
 
   auto c =
       std::make_unique<Cheats::CheatSearchSession<T>>(m_memory_ranges, m_address_space, m_aligned);
-  c->m_search_results.assign(m_search_results.begin() + begin_index,
-                             m_search_results.begin() + end_index);
+  c->m_search_results.Append(m_search_results, begin_index, end_index);
   c->m_compare_type = this->m_compare_type;
   c->m_filter_type = this->m_filter_type;
   c->m_value = this->m_value;
@@ -64,18 +64,55 @@ enum class SearchResultValueState : u8
   AddressNotAccessible,
 };
 
+// Search results are stored as separate arrays, which takes less memory than an array of structs
+// and lets the arrays be filled in bulk.
 template <typename T>
-struct SearchResult
+struct SearchResults
 {
-  T m_value;
-  SearchResultValueState m_value_state;
-  u32 m_address;
+  std::vector<u32> m_addresses;
+  std::vector<T> m_values;
+  std::vector<SearchResultValueState> m_value_states;
 
-  bool IsValueValid() const
+  size_t Size() const { return m_addresses.size(); }
+  bool IsValueValid(size_t index) const
   {
-    return m_value_state == SearchResultValueState::ValueFromPhysicalMemory ||
-           m_value_state == SearchResultValueState::ValueFromVirtualMemory;
+    return m_value_states[index] == SearchResultValueState::ValueFromPhysicalMemory ||
+           m_value_states[index] == SearchResultValueState::ValueFromVirtualMemory;
   }
+
+  void Reserve(size_t count)
+  {
+    m_addresses.reserve(count);
+    m_values.reserve(count);
+    m_value_states.reserve(count);
+  }
+
+  void Add(u32 address, T value, SearchResultValueState value_state)
+  {
+    m_addresses.push_back(address);
+    m_values.push_back(value);
+    m_value_states.push_back(value_state);
+  }
+
+  // Appends the results with indices in [begin_index, end_index) of the given results.
+  void Append(const SearchResults& other, size_t begin_index, size_t end_index)
+  {
+    m_addresses.insert(m_addresses.end(), other.m_addresses.begin() + begin_index,
+                       other.m_addresses.begin() + end_index);
+    m_values.insert(m_values.end(), other.m_values.begin() + begin_index,
+                    other.m_values.begin() + end_index);
+    m_value_states.insert(m_value_states.end(), other.m_value_states.begin() + begin_index,
+                          other.m_value_states.begin() + end_index);
+  }
+};
+
+// Which values a new search keeps: the ones for which `value <m_compare_type> m_value` is true, or
+// all of them if no comparison is given.
+template <typename T>
+struct SearchFilter
+{
+  std::optional<CompareType> m_compare_type;
+  T m_value{};
 };
 
 struct MemoryRange
@@ -113,18 +150,18 @@ DataType GetDataType(const SearchValue& value);
 std::vector<u8> GetValueAsByteVector(const SearchValue& value);
 
 // Do a new search across the given memory region in the given address space, only keeping values
-// for which the given validator returns true.
+// which pass the given filter. Physical RAM is read directly and scanned on several threads.
 template <typename T>
-Common::Result<SearchErrorCode, std::vector<SearchResult<T>>>
+Common::Result<SearchErrorCode, SearchResults<T>>
 NewSearch(const Core::CPUThreadGuard& guard, const std::vector<MemoryRange>& memory_ranges,
           PowerPC::RequestedAddressSpace address_space, bool aligned,
-          const std::function<bool(const T& value)>& validator);
+          const SearchFilter<T>& filter);
 
 // Refresh the values for the given results in the given address space, only keeping values for
 // which the given validator returns true.
 template <typename T>
-Common::Result<SearchErrorCode, std::vector<SearchResult<T>>>
-NextSearch(const Core::CPUThreadGuard& guard, const std::vector<SearchResult<T>>& previous_results,
+Common::Result<SearchErrorCode, SearchResults<T>>
+NextSearch(const Core::CPUThreadGuard& guard, const SearchResults<T>& previous_results,
            PowerPC::RequestedAddressSpace address_space,
            const std::function<bool(const T& new_value, const T& old_value)>& validator);
 
@@ -217,7 +254,7 @@ public:
                                                        size_t end_index) const override;
 
 private:
-  std::vector<SearchResult<T>> m_search_results;
+  SearchResults<T> m_search_results;
   std::vector<MemoryRange> m_memory_ranges;
   PowerPC::RequestedAddressSpace m_address_space;
   CompareType m_compare_type = CompareType::Equal;
@@ -36,13 +36,21 @@ namespace Config
 // Main.Core
 
 const Info<bool> MAIN_SKIP_IPL{{System::Main, "Core", "SkipIPL"}, true};
+const Info<bool> MAIN_FAST_BOOT_SNAPSHOT{{System::Main, "Core", "FastBootSnapshot"}, false};
 const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
                                            PowerPC::DefaultCPUCore()};
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
 const Info<bool> MAIN_FASTMEM_ARENA{{System::Main, "Core", "FastmemArena"}, true};
+const Info<bool> MAIN_HUGE_PAGES{{System::Main, "Core", "HugePages"}, false};
 const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP{{System::Main, "Core", "LargeEntryPointsMap"}, true};
+const Info<bool> MAIN_JIT_PERSISTENT_CACHE{{System::Main, "Core", "JITPersistentCache"}, false};
+const Info<int> MAIN_JIT_COMPILE_THRESHOLD{{System::Main, "Core", "JITCompileThreshold"}, 0};
+const Info<bool> MAIN_JIT_RECOMPILE_HOT_BLOCKS{{System::Main, "Core", "JITRecompileHotBlocks"},
+                                               false};
+const Info<bool> MAIN_JIT_PROFILE_BRANCHES{{System::Main, "Core", "JITProfileBranches"}, false};
 const Info<bool> MAIN_ACCURATE_CPU_CACHE{{System::Main, "Core", "AccurateCPUCache"}, false};
+const Info<u32> MAIN_SECONDARY_TLB_SIZE{{System::Main, "Core", "SecondaryTLBSize"}, 4096};
 const Info<bool> MAIN_DSP_HLE{{System::Main, "Core", "DSPHLE"}, true};
 const Info<int> MAIN_MAX_FALLBACK{{System::Main, "Core", "MaxFallback"}, 100};
 const Info<int> MAIN_TIMING_VARIANCE{{System::Main, "Core", "TimingVariance"}, 40};
@@ -55,8 +63,11 @@ constexpr bool DEFAULT_CPU_THREAD = false;
 #endif
 const Info<bool> MAIN_CPU_THREAD{{System::Main, "Core", "CPUThread"}, DEFAULT_CPU_THREAD};
 const Info<bool> MAIN_SYNC_ON_SKIP_IDLE{{System::Main, "Core", "SyncOnSkipIdle"}, true};
+const Info<bool> MAIN_THREAD_PLACEMENT{{System::Main, "Core", "ThreadPlacement"}, true};
 const Info<std::string> MAIN_DEFAULT_ISO{{System::Main, "Core", "DefaultISO"}, ""};
 const Info<bool> MAIN_ENABLE_CHEATS{{System::Main, "Core", "EnableCheats"}, false};
+const Info<bool> MAIN_GECKO_NATIVE_WRITES{{System::Main, "Core", "GeckoNativeWrites"}, false};
+const Info<bool> MAIN_HLE_SDK_FUNCTIONS{{System::Main, "Core", "HLESDKFunctions"}, false};
 const Info<int> MAIN_GC_LANGUAGE{{System::Main, "Core", "SelectedLanguage"}, 0};
 const Info<bool> MAIN_OVERRIDE_REGION_SETTINGS{{System::Main, "Core", "OverrideRegionSettings"},
                                                false};
@@ -196,6 +207,9 @@ const Info<bool> MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC{
     {System::Main, "Core", "WiiSDCardEnableFolderSync"}, false};
 const Info<u64> MAIN_WII_SD_CARD_FILESIZE{{System::Main, "Core", "WiiSDCardFilesize"}, 0};
 const Info<bool> MAIN_WII_KEYBOARD{{System::Main, "Core", "WiiKeyboard"}, false};
+const Info<bool> MAIN_WII_NAND_IN_MEMORY{{System::Main, "Core", "WiiNANDInMemory"}, false};
+const Info<bool> MAIN_WII_NAND_IN_MEMORY_FLUSH{{System::Main, "Core", "WiiNANDInMemoryFlush"},
+                                               false};
 const Info<bool> MAIN_WIIMOTE_CONTINUOUS_SCANNING{
     {System::Main, "Core", "WiimoteContinuousScanning"}, false};
 const Info<std::string> MAIN_WIIMOTE_AUTO_CONNECT_ADDRESSES{
@@ -270,6 +284,10 @@ const Info<DiscIO::Region> MAIN_FALLBACK_REGION{{System::Main, "Core", "Fallback
 const Info<bool> MAIN_AUTO_DISC_CHANGE{{System::Main, "Core", "AutoDiscChange"}, false};
 const Info<bool> MAIN_ALLOW_SD_WRITES{{System::Main, "Core", "WiiSDCardAllowWrites"}, true};
 const Info<bool> MAIN_ENABLE_SAVESTATES{{System::Main, "Core", "EnableSaveStates"}, false};
+const Info<u32> MAIN_REWIND_INTERVAL{{System::Main, "Core", "RewindInterval"}, 0};
+const Info<u32> MAIN_REWIND_MEMORY_BUDGET_MB{{System::Main, "Core", "RewindMemoryBudgetMB"}, 256};
+const Info<bool> MAIN_ROLLBACK_PROFILER{{System::Main, "Core", "RollbackProfiler"}, false};
+const Info<bool> MAIN_SAVESTATE_USE_ZSTD{{System::Main, "Core", "SaveStateUseZstd"}, false};
 const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS{
     {System::Main, "Core", "RealWiiRemoteRepeatReports"}, true};
 const Info<bool> MAIN_WII_WIILINK_ENABLE{{System::Main, "Core", "EnableWiiLink"}, false};
@@ -325,11 +343,14 @@ const Info<std::string> MAIN_WII_SD_CARD_IMAGE_PATH{{System::Main, "General", "W
 const Info<std::string> MAIN_WII_SD_CARD_SYNC_FOLDER_PATH{
     {System::Main, "General", "WiiSDCardSyncFolder"}, ""};
 const Info<std::string> MAIN_WFS_PATH{{System::Main, "General", "WFSPath"}, ""};
+const Info<std::string> MAIN_SHADER_CACHE_PATH{{System::Main, "General", "ShaderCachePath"},
+                                               ""};
 const Info<bool> MAIN_SHOW_LAG{{System::Main, "General", "ShowLag"}, false};
 const Info<bool> MAIN_SHOW_FRAME_COUNT{{System::Main, "General", "ShowFrameCount"}, false};
 const Info<std::string> MAIN_WIRELESS_MAC{{System::Main, "General", "WirelessMac"}, ""};
 const Info<std::string> MAIN_GDB_SOCKET{{System::Main, "General", "GDBSocket"}, ""};
 const Info<int> MAIN_GDB_PORT{{System::Main, "General", "GDBPort"}, -1};
+const Info<bool> MAIN_MEMORY_WATCHER_RING{{System::Main, "General", "MemoryWatcherRing"}, false};
 const Info<int> MAIN_ISO_PATH_COUNT{{System::Main, "General", "ISOPaths"}, 0};
 const Info<std::string> MAIN_SKYLANDERS_PATH{{System::Main, "General", "SkylandersCollectionPath"},
                                              ""};
@@ -394,6 +415,7 @@ const std::array<Info<std::string>, 4> MAIN_GBA_ROM_PATHS{
 const Info<std::string> MAIN_GBA_SAVES_PATH{{System::Main, "GBA", "SavesPath"}, ""};
 const Info<bool> MAIN_GBA_SAVES_IN_ROM_PATH{{System::Main, "GBA", "SavesInRomPath"}, false};
 const Info<bool> MAIN_GBA_THREADS{{System::Main, "GBA", "Threads"}, true};
+const Info<bool> MAIN_GBA_RELAXED_SYNC{{System::Main, "GBA", "RelaxedSync"}, false};
 #endif
 
 // Main.Network
@@ -511,10 +533,16 @@ const Info<bool> MAIN_MOVIE_DUMP_FRAMES_SILENT{{System::Main, "Movie", "DumpFram
 const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY{{System::Main, "Movie", "ShowInputDisplay"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RTC{{System::Main, "Movie", "ShowRTC"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RERECORD{{System::Main, "Movie", "ShowRerecord"}, false};
+const Info<u32> MAIN_MOVIE_CHECKPOINT_INTERVAL{{System::Main, "Movie", "CheckpointInterval"}, 0};
+const Info<u32> MAIN_MOVIE_CHECKPOINT_MEMORY_BUDGET_MB{
+    {System::Main, "Movie", "CheckpointMemoryBudgetMB"}, 1024};
 
 // Main.Input
 
 const Info<bool> MAIN_INPUT_BACKGROUND_INPUT{{System::Main, "Input", "BackgroundInput"}, false};
+const Info<u32> MAIN_INPUT_POLLING_RATE{{System::Main, "Input", "PollingRate"}, 0};
+const Info<bool> MAIN_SI_LATE_INPUT_SAMPLING{{System::Main, "Input", "SILateInputSampling"},
+                                             false};
 
 // Main.Debug
 
@@ -541,6 +569,7 @@ const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF{{System::Main, "Debug", "JitR
                                                    false};
 const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING{{System::Main, "Debug", "JitEnableProfiling"},
                                                  false};
+const Info<bool> MAIN_DEBUG_EVENT_PROFILING{{System::Main, "Debug", "EventProfiling"}, false};
 
 // Main.BluetoothPassthrough
 
@@ -20,6 +20,7 @@
 #define BACKEND_CUBEB "Cubeb"
 #define BACKEND_OPENAL "OpenAL"
 #define BACKEND_PULSEAUDIO "Pulse"
+#define BACKEND_PIPEWIRE "PipeWire"
 #define BACKEND_OPENSLES "OpenSLES"
 #define BACKEND_WASAPI _trans("WASAPI (Exclusive Mode)")
 
@@ -54,12 +55,19 @@ namespace Config
 // Main.Core
 
 extern const Info<bool> MAIN_SKIP_IPL;
+extern const Info<bool> MAIN_FAST_BOOT_SNAPSHOT;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
+extern const Info<bool> MAIN_HUGE_PAGES;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
+extern const Info<bool> MAIN_JIT_PERSISTENT_CACHE;
+extern const Info<int> MAIN_JIT_COMPILE_THRESHOLD;
+extern const Info<bool> MAIN_JIT_RECOMPILE_HOT_BLOCKS;
+extern const Info<bool> MAIN_JIT_PROFILE_BRANCHES;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
+extern const Info<u32> MAIN_SECONDARY_TLB_SIZE;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
 extern const Info<bool> MAIN_DSP_HLE;
 extern const Info<int> MAIN_MAX_FALLBACK;
@@ -67,8 +75,11 @@ extern const Info<int> MAIN_TIMING_VARIANCE;
 extern const Info<bool> MAIN_CORRECT_TIME_DRIFT;
 extern const Info<bool> MAIN_CPU_THREAD;
 extern const Info<bool> MAIN_SYNC_ON_SKIP_IDLE;
+extern const Info<bool> MAIN_THREAD_PLACEMENT;
 extern const Info<std::string> MAIN_DEFAULT_ISO;
 extern const Info<bool> MAIN_ENABLE_CHEATS;
+extern const Info<bool> MAIN_GECKO_NATIVE_WRITES;
+extern const Info<bool> MAIN_HLE_SDK_FUNCTIONS;
 extern const Info<int> MAIN_GC_LANGUAGE;
 extern const Info<bool> MAIN_OVERRIDE_REGION_SETTINGS;
 extern const Info<bool> MAIN_DPL2_DECODER;
@@ -108,6 +119,10 @@ extern const Info<bool> MAIN_WII_SD_CARD;
 extern const Info<bool> MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC;
 extern const Info<u64> MAIN_WII_SD_CARD_FILESIZE;
 extern const Info<bool> MAIN_WII_KEYBOARD;
+// Keeps the session NAND in memory instead of writing every change to the host file system.
+extern const Info<bool> MAIN_WII_NAND_IN_MEMORY;
+// Whether changes to the in-memory NAND are written back to the NAND when emulation stops.
+extern const Info<bool> MAIN_WII_NAND_IN_MEMORY_FLUSH;
 extern const Info<bool> MAIN_WIIMOTE_CONTINUOUS_SCANNING;
 extern const Info<std::string> MAIN_WIIMOTE_AUTO_CONNECT_ADDRESSES;
 extern const Info<bool> MAIN_WIIMOTE_ENABLE_SPEAKER;
@@ -157,6 +172,14 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+// Number of emulated fields between rewind snapshots. 0 disables rewinding.
+extern const Info<u32> MAIN_REWIND_INTERVAL;
+extern const Info<u32> MAIN_REWIND_MEMORY_BUDGET_MB;
+// Periodically measures how long saving and loading an in-memory state takes, to estimate what
+// rollback netcode would cost for the running game.
+extern const Info<bool> MAIN_ROLLBACK_PROFILER;
+// Compress savestates with Zstandard instead of LZ4, which is smaller but slower.
+extern const Info<bool> MAIN_SAVESTATE_USE_ZSTD;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
@@ -204,11 +227,13 @@ extern const Info<std::string> MAIN_FS_PATH;
 extern const Info<std::string> MAIN_WII_SD_CARD_IMAGE_PATH;
 extern const Info<std::string> MAIN_WII_SD_CARD_SYNC_FOLDER_PATH;
 extern const Info<std::string> MAIN_WFS_PATH;
+extern const Info<std::string> MAIN_SHADER_CACHE_PATH;
 extern const Info<bool> MAIN_SHOW_LAG;
 extern const Info<bool> MAIN_SHOW_FRAME_COUNT;
 extern const Info<std::string> MAIN_WIRELESS_MAC;
 extern const Info<std::string> MAIN_GDB_SOCKET;
 extern const Info<int> MAIN_GDB_PORT;
+extern const Info<bool> MAIN_MEMORY_WATCHER_RING;
 extern const Info<int> MAIN_ISO_PATH_COUNT;
 extern const Info<std::string> MAIN_SKYLANDERS_PATH;
 std::vector<std::string> GetIsoPaths();
@@ -222,6 +247,7 @@ extern const std::array<Info<std::string>, 4> MAIN_GBA_ROM_PATHS;
 extern const Info<std::string> MAIN_GBA_SAVES_PATH;
 extern const Info<bool> MAIN_GBA_SAVES_IN_ROM_PATH;
 extern const Info<bool> MAIN_GBA_THREADS;
+extern const Info<bool> MAIN_GBA_RELAXED_SYNC;
 #endif
 
 // Main.Network
@@ -326,10 +352,17 @@ extern const Info<bool> MAIN_MOVIE_DUMP_FRAMES_SILENT;
 extern const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY;
 extern const Info<bool> MAIN_MOVIE_SHOW_RTC;
 extern const Info<bool> MAIN_MOVIE_SHOW_RERECORD;
+extern const Info<u32> MAIN_MOVIE_CHECKPOINT_INTERVAL;
+extern const Info<u32> MAIN_MOVIE_CHECKPOINT_MEMORY_BUDGET_MB;
 
 // Main.Input
 
 extern const Info<bool> MAIN_INPUT_BACKGROUND_INPUT;
+// Rate in Hz of the input polling thread during emulation. 0 polls on the emulation thread.
+extern const Info<u32> MAIN_INPUT_POLLING_RATE;
+// Samples GameCube controller input again when the game reads the polled data, instead of only at
+// the SI poll. Ignored during NetPlay and movie recording/playback.
+extern const Info<bool> MAIN_SI_LATE_INPUT_SAMPLING;
 
 // Main.Debug
 
@@ -347,6 +380,7 @@ extern const Info<bool> MAIN_DEBUG_JIT_SYSTEM_REGISTERS_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_BRANCH_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING;
+extern const Info<bool> MAIN_DEBUG_EVENT_PROFILING;
 
 // Main.BluetoothPassthrough
 
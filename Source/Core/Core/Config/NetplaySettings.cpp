@@ -45,6 +45,9 @@ const Info<u32> NETPLAY_CHUNKED_UPLOAD_LIMIT{{System::Main, "NetPlay", "ChunkedU
 
 const Info<u32> NETPLAY_BUFFER_SIZE{{System::Main, "NetPlay", "BufferSize"}, 5};
 const Info<u32> NETPLAY_CLIENT_BUFFER_SIZE{{System::Main, "NetPlay", "BufferSizeClient"}, 1};
+const Info<bool> NETPLAY_ADAPTIVE_BUFFER{{System::Main, "NetPlay", "AdaptiveBuffer"}, false};
+const Info<u32> NETPLAY_ADAPTIVE_BUFFER_MIN{{System::Main, "NetPlay", "AdaptiveBufferMin"}, 2};
+const Info<u32> NETPLAY_ADAPTIVE_BUFFER_MAX{{System::Main, "NetPlay", "AdaptiveBufferMax"}, 30};
 
 const Info<bool> NETPLAY_SAVEDATA_LOAD{{System::Main, "NetPlay", "SyncSaves"}, true};
 const Info<bool> NETPLAY_SAVEDATA_WRITE{{System::Main, "NetPlay", "WriteSaveData"}, true};
@@ -56,6 +59,8 @@ const Info<bool> NETPLAY_STRICT_SETTINGS_SYNC{{System::Main, "NetPlay", "StrictS
 const Info<std::string> NETPLAY_NETWORK_MODE{{System::Main, "NetPlay", "NetworkMode"},
                                              "fixeddelay"};
 const Info<bool> NETPLAY_GOLF_MODE_OVERLAY{{System::Main, "NetPlay", "GolfModeOverlay"}, true};
+const Info<bool> NETPLAY_LATENCY_GRAPH_OVERLAY{{System::Main, "NetPlay", "LatencyGraphOverlay"},
+                                               false};
 const Info<bool> NETPLAY_HIDE_REMOTE_GBAS{{System::Main, "NetPlay", "HideRemoteGBAs"}, false};
 
 }  // namespace Config
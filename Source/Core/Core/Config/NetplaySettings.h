@@ -41,6 +41,10 @@ extern const Info<u32> NETPLAY_CHUNKED_UPLOAD_LIMIT;
 
 extern const Info<u32> NETPLAY_BUFFER_SIZE;
 extern const Info<u32> NETPLAY_CLIENT_BUFFER_SIZE;
+// Lets the host adjust the pad buffer to the measured latency of the players.
+extern const Info<bool> NETPLAY_ADAPTIVE_BUFFER;
+extern const Info<u32> NETPLAY_ADAPTIVE_BUFFER_MIN;
+extern const Info<u32> NETPLAY_ADAPTIVE_BUFFER_MAX;
 
 extern const Info<bool> NETPLAY_SAVEDATA_LOAD;
 extern const Info<bool> NETPLAY_SAVEDATA_WRITE;
@@ -50,6 +54,7 @@ extern const Info<bool> NETPLAY_RECORD_INPUTS;
 extern const Info<bool> NETPLAY_STRICT_SETTINGS_SYNC;
 extern const Info<std::string> NETPLAY_NETWORK_MODE;
 extern const Info<bool> NETPLAY_GOLF_MODE_OVERLAY;
+extern const Info<bool> NETPLAY_LATENCY_GRAPH_OVERLAY;
 extern const Info<bool> NETPLAY_HIDE_REMOTE_GBAS;
 
 }  // namespace Config
@@ -42,6 +42,7 @@
 #include "Core/DolphinAnalytics.h"
 #include "Core/FifoPlayer/FifoDataFile.h"
 #include "Core/HLE/HLE.h"
+#include "Core/HLE/HLE_SDK.h"
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/EXI/EXI_Device.h"
 #include "Core/HW/GCKeyboard.h"
@@ -273,7 +274,14 @@ void SConfig::OnTitleDirectlyBooted(const Core::CPUThreadGuard& guard)
   auto& ppc_symbol_db = system.GetPPCSymbolDB();
 
   if (ppc_symbol_db.LoadMapOnBoot(guard))
+  {
     Host_PPCSymbolsChanged();
+  }
+  else if (Config::Get(Config::MAIN_HLE_SDK_FUNCTIONS) && ppc_symbol_db.IsEmpty() &&
+           HLE_SDK::IdentifyFunctions(guard))
+  {
+    Host_PPCSymbolsChanged();
+  }
   HLE::Reload(system);
 
   PatchEngine::Reload(system);
@@ -7,9 +7,11 @@
 #include <atomic>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <string_view>
 #include <utility>
 #include <variant>
 
@@ -24,6 +26,7 @@
 
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
+#include "Common/CPUTopology.h"
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
@@ -36,10 +39,12 @@
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
+#include "Common/Timer.h"
 #include "Common/Version.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Boot/Boot.h"
+#include "Core/Boot/BootSnapshot.h"
 #include "Core/BootManager.h"
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/MainSettings.h"
@@ -136,7 +141,7 @@ static Common::EventHook s_frame_presented =
 
 bool GetIsThrottlerTempDisabled()
 {
-  return s_is_throttler_temp_disabled;
+  return s_is_throttler_temp_disabled || State::IsSeekingMovie();
 }
 
 void SetIsThrottlerTempDisabled(bool disable)
@@ -355,6 +360,9 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   else
     Common::SetCurrentThreadName("CPU-GPU thread");
 
+  if (Config::Get(Config::MAIN_THREAD_PLACEMENT))
+    Common::SetCurrentThreadRole(Common::ThreadRole::EmulatedCPU);
+
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
 
@@ -409,6 +417,9 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   // Enter CPU run loop. When we leave it - we are done.
   system.GetCPU().Run();
 
+  // The profile can still be written after emulation stops.
+  system.GetPowerPC().GetSamplingProfiler().Stop();
+
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher.reset();
 #endif
@@ -434,6 +445,9 @@ static void FifoPlayerThread(Core::System& system, const std::optional<std::stri
   else
     Common::SetCurrentThreadName("FIFO-GPU thread");
 
+  if (Config::Get(Config::MAIN_THREAD_PLACEMENT))
+    Common::SetCurrentThreadRole(Common::ThreadRole::EmulatedCPU);
+
   // Enter CPU run loop. When we leave it - we are done.
   if (auto cpu_core = system.GetFifoPlayer().GetCPUCore())
   {
@@ -485,19 +499,31 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   // If settings have changed since the previous run, notify callbacks.
   CPUThreadConfigCallback::CheckForConfigChanges();
 
+  Common::Timer phase_timer;
+  phase_timer.Start();
+  const auto log_phase = [&phase_timer](std::string_view phase) {
+    INFO_LOG_FMT(BOOT, "{} took {} ms", phase, phase_timer.ElapsedMs());
+    phase_timer.Start();
+  };
+
+  // Opening the audio device can take a noticeable amount of time with some backends, and nothing
+  // before HW::Init needs it, so it's done in parallel with the rest of the setup below.
+  std::future<std::unique_ptr<SoundStream>> sound_stream =
+      std::async(std::launch::async, AudioCommon::CreateSoundStream);
+
   // Switch the window used for inputs to the render window. This way, the cursor position
   // is relative to the render window, instead of the main window.
   ASSERT(g_controller_interface.IsInit());
   g_controller_interface.ChangeWindow(wsi.render_window);
 
+  g_controller_interface.SetInputPollingRate(Config::Get(Config::MAIN_INPUT_POLLING_RATE));
+  Common::ScopeGuard input_polling_guard{[] { g_controller_interface.SetInputPollingRate(0); }};
+
   Pad::LoadConfig();
   Pad::LoadGBAConfig();
   Keyboard::LoadConfig();
 
   BootSessionData boot_session_data = std::move(boot->boot_session_data);
-  const std::optional<std::string>& savestate_path = boot_session_data.GetSavestatePath();
-  const bool delete_savestate =
-      boot_session_data.GetDeleteSavestate() == DeleteSavestateAfterBoot::Yes;
 
   bool sync_sd_folder = system.IsWii() && Config::Get(Config::MAIN_WII_SD_CARD) &&
                         Config::Get(Config::MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC);
@@ -528,11 +554,31 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   system.GetMovie().Init(*boot);
   Common::ScopeGuard movie_guard([&system] { system.GetMovie().Shutdown(); });
 
-  AudioCommon::InitSoundStream(system);
+  // A fast boot snapshot is loaded like any other savestate, after the IPL has been set up.
+  std::optional<BootSnapshot::Snapshot> boot_snapshot;
+  if (!boot_session_data.GetSavestatePath())
+  {
+    boot_snapshot = BootSnapshot::GetSnapshot(system, *boot);
+    if (boot_snapshot && File::Exists(boot_snapshot->path))
+    {
+      NOTICE_LOG_FMT(BOOT, "Loading fast boot snapshot {}", boot_snapshot->path);
+      boot_session_data.SetSavestateData(boot_snapshot->path, DeleteSavestateAfterBoot::No);
+    }
+  }
+
+  const std::optional<std::string>& savestate_path = boot_session_data.GetSavestatePath();
+  const bool delete_savestate =
+      boot_session_data.GetDeleteSavestate() == DeleteSavestateAfterBoot::Yes;
+
+  log_phase("Input, SD card and movie setup");
+
+  system.SetSoundStream(sound_stream.get());
   Common::ScopeGuard audio_guard([&system] { AudioCommon::ShutdownSoundStream(system); });
+  log_phase("Waiting for the audio backend");
 
   HW::Init(system,
            NetPlay::IsNetPlayRunning() ? &(boot_session_data.GetNetplaySettings()->sram) : nullptr);
+  log_phase("HW initialization");
 
   Common::ScopeGuard hw_guard{[&system] {
     INFO_LOG_FMT(CONSOLE, "{}", StopMessage(false, "Shutting down HW"));
@@ -561,6 +607,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
     g_video_backend->Shutdown();
   }};
+  log_phase("Video backend initialization");
 
   if (cpu_info.HTT)
     Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, cpu_info.num_cores > 4);
@@ -575,6 +622,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }
 
   AudioCommon::PostInitSoundStream(system);
+  log_phase("DSP and audio initialization");
 
   // Set execution state to known values (CPU/FIFO/Audio Paused)
   system.GetCPU().Break();
@@ -599,6 +647,11 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     CPUThreadGuard guard(system);
     if (!CBoot::BootUp(system, guard, std::move(boot)))
       return;
+    log_phase("Booting");
+
+    // Armed even if the snapshot is loaded, so that it's replaced if loading it fails.
+    if (boot_snapshot)
+      BootSnapshot::Arm(system, *boot_snapshot);
   }
 
   // Initialise Wii filesystem contents.
@@ -609,9 +662,14 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     boot_session_data.InvokeWiiSyncCleanup();
   }};
   if (system.IsWii())
+  {
     Core::InitializeWiiFileSystemContents(savegame_redirect, boot_session_data);
+    log_phase("Wii filesystem setup");
+  }
   else
+  {
     wiifs_guard.Dismiss();
+  }
 
   // This adds the SyncGPU handler to CoreTiming, so now CoreTiming::Advance might block.
   system.GetFifo().Prepare();
@@ -634,6 +692,8 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     // This thread, after creating the EmuWindow, spawns a CPU
     // thread, and then takes over and becomes the video thread
     Common::SetCurrentThreadName("Video thread");
+    if (Config::Get(Config::MAIN_THREAD_PLACEMENT))
+      Common::SetCurrentThreadRole(Common::ThreadRole::EmulatedGPU);
     UndeclareAsCPUThread();
     Common::FPU::LoadDefaultSIMDState();
 
@@ -881,6 +941,9 @@ void Callback_NewField(Core::System& system)
   }
 
   AchievementManager::GetInstance().DoFrame();
+  State::UpdateRewind(system);
+  State::UpdateRollbackProfiler(system);
+  State::UpdateMovieCheckpoints(system);
 }
 
 void UpdateTitle(Core::System& system)
@@ -4,6 +4,7 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
+#include <chrono>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -13,8 +14,9 @@
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
-#include "Common/SPSCQueue.h"
+#include "Common/Trace.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CPUThreadConfigCallback.h"
@@ -76,7 +78,9 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
 
 void CoreTimingManager::UnregisterAllEvents()
 {
-  ASSERT_MSG(POWERPC, m_event_queue.empty(), "Cannot unregister events with events pending");
+  ASSERT_MSG(POWERPC, m_event_queue.size() == m_removed_events,
+             "Cannot unregister events with events pending");
+  ResetEventProfile();
   m_event_types.clear();
 }
 
@@ -119,7 +123,6 @@ void CoreTimingManager::Shutdown()
 {
   Core::RemoveOnStateChangedCallback(&m_on_state_changed_handle);
 
-  std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
@@ -154,11 +157,26 @@ void CoreTimingManager::RefreshConfig()
   UpdateSpeedLimit(GetTicks(), Config::Get(Config::MAIN_EMULATION_SPEED));
 
   m_use_precision_timer = Config::Get(Config::MAIN_PRECISION_FRAME_TIMING);
+
+  const bool profile_events = Config::Get(Config::MAIN_DEBUG_EVENT_PROFILING);
+  if (profile_events != m_profile_events)
+  {
+    // The trace is kept when profiling is disabled so that it can still be written out.
+    if (profile_events)
+    {
+      ResetEventProfile();
+    }
+    else
+    {
+      std::lock_guard lk(m_event_profile_lock);
+      m_event_profile.clear();
+    }
+    m_profile_events = profile_events;
+  }
 }
 
 void CoreTimingManager::DoState(PointerWrap& p)
 {
-  std::lock_guard lk(m_ts_write_lock);
   p.Do(m_globals.slice_length);
   p.Do(m_globals.global_timer);
   p.Do(m_idled_cycles);
@@ -173,6 +191,9 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
+  // Removed events aren't saved.
+  if (m_removed_events != 0)
+    CompactEventQueue();
   p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
@@ -213,6 +234,15 @@ void CoreTimingManager::DoState(PointerWrap& p)
     // and library version specific.
     std::ranges::make_heap(m_event_queue, std::ranges::greater{});
 
+    m_removed_events = 0;
+    for (auto& [name, event_type] : m_event_types)
+      event_type.queued = 0;
+    for (Event& ev : m_event_queue)
+    {
+      ev.generation = ev.type->generation;
+      ++ev.type->queued;
+    }
+
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
     ResetThrottle(m_globals.global_timer);
@@ -240,6 +270,34 @@ u64 CoreTimingManager::GetIdleTicks() const
 void CoreTimingManager::ClearPendingEvents()
 {
   m_event_queue.clear();
+  m_removed_events = 0;
+  for (auto& [name, event_type] : m_event_types)
+    event_type.queued = 0;
+}
+
+void CoreTimingManager::PushEvent(Event event)
+{
+  event.generation = event.type->generation;
+  ++event.type->queued;
+  m_event_queue.push_back(event);
+  std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+}
+
+void CoreTimingManager::PopRemovedEvents()
+{
+  while (!m_event_queue.empty() && IsRemoved(m_event_queue.front()))
+  {
+    std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
+    m_event_queue.pop_back();
+    --m_removed_events;
+  }
+}
+
+void CoreTimingManager::CompactEventQueue()
+{
+  std::erase_if(m_event_queue, IsRemoved);
+  std::ranges::make_heap(m_event_queue, std::ranges::greater{});
+  m_removed_events = 0;
 }
 
 void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
@@ -268,8 +326,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    PushEvent(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -281,21 +338,22 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
                     *event_type->name);
     }
 
-    std::lock_guard lk(m_ts_write_lock);
     m_ts_queue.Push(Event{cycles_into_future, 0, userdata, event_type});
   }
 }
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  const size_t erased =
-      std::erase_if(m_event_queue, [&](const Event& e) { return e.type == event_type; });
+  if (event_type->queued == 0)
+    return;
 
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (erased != 0)
-  {
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
-  }
+  ++event_type->generation;
+  m_removed_events += event_type->queued;
+  event_type->queued = 0;
+
+  PopRemovedEvents();
+  if (m_removed_events > m_event_queue.size() / 2)
+    CompactEventQueue();
 }
 
 void CoreTimingManager::RemoveAllEvents(EventType* event_type)
@@ -319,20 +377,20 @@ void CoreTimingManager::ForceExceptionCheck(s64 cycles)
 
 void CoreTimingManager::MoveEvents()
 {
-  while (!m_ts_queue.Empty())
+  Event from_thread;
+  while (m_ts_queue.TryPop(from_thread))
   {
-    auto& ev = m_event_queue.emplace_back(m_ts_queue.Front());
-    m_ts_queue.Pop();
+    from_thread.fifo_order = m_event_fifo_id++;
+    from_thread.time += m_globals.global_timer;
 
-    ev.fifo_order = m_event_fifo_id++;
-    ev.time += m_globals.global_timer;
-
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    PushEvent(from_thread);
   }
 }
 
 void CoreTimingManager::Advance()
 {
+  TRACE_SCOPE("CoreTiming::Advance");
+
   CPUThreadConfigCallback::CheckForConfigChanges();
 
   MoveEvents();
@@ -353,11 +411,24 @@ void CoreTimingManager::Advance()
     Event evt = std::move(m_event_queue.front());
     std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
     m_event_queue.pop_back();
-    evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
+    if (IsRemoved(evt))
+    {
+      --m_removed_events;
+      continue;
+    }
+
+    --evt.type->queued;
+    if (m_profile_events) [[unlikely]]
+      RunProfiledEvent(evt);
+    else
+      evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
   m_is_global_timer_sane = false;
 
+  // Removed events shouldn't end the next slice early.
+  PopRemovedEvents();
+
   // Still events left (scheduled in the future)
   if (!m_event_queue.empty())
   {
@@ -515,6 +586,7 @@ bool CoreTimingManager::UseSyncOnSkipIdle() const
 void CoreTimingManager::LogPendingEvents() const
 {
   auto clone = m_event_queue;
+  std::erase_if(clone, IsRemoved);
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
@@ -561,6 +633,7 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   text.reserve(1000);
 
   auto clone = m_event_queue;
+  std::erase_if(clone, IsRemoved);
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
@@ -569,6 +642,90 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   return text;
 }
 
+void CoreTimingManager::RunProfiledEvent(const Event& event)
+{
+  EventType& type = *event.type;
+  const TimePoint start = Clock::now();
+  type.callback(m_system, event.userdata, m_globals.global_timer - event.time);
+  const TimePoint end = Clock::now();
+
+  ++type.profile_calls;
+  type.profile_time += end - start;
+
+  const EventTraceEntry entry{type.name, m_globals.global_timer, start, end - start};
+  if (m_event_trace.size() < MAX_EVENT_TRACE_ENTRIES)
+    m_event_trace.push_back(entry);
+  else
+    m_event_trace[m_event_trace_next] = entry;
+  m_event_trace_next = (m_event_trace_next + 1) % MAX_EVENT_TRACE_ENTRIES;
+
+  if (end - m_profile_interval_start >= std::chrono::seconds(1))
+    PublishEventProfile(end);
+}
+
+void CoreTimingManager::PublishEventProfile(TimePoint now)
+{
+  std::vector<EventProfile> profile;
+  for (auto& [name, type] : m_event_types)
+  {
+    if (type.profile_calls != 0)
+      profile.push_back({name, type.profile_calls, type.profile_time});
+    type.profile_calls = 0;
+    type.profile_time = DT::zero();
+  }
+  std::ranges::sort(profile, std::ranges::greater{}, &EventProfile::time);
+  m_profile_interval_start = now;
+
+  std::lock_guard lk(m_event_profile_lock);
+  m_event_profile = std::move(profile);
+}
+
+void CoreTimingManager::ResetEventProfile()
+{
+  for (auto& [name, type] : m_event_types)
+  {
+    type.profile_calls = 0;
+    type.profile_time = DT::zero();
+  }
+  m_profile_interval_start = Clock::now();
+  m_event_trace.clear();
+  m_event_trace_next = 0;
+
+  std::lock_guard lk(m_event_profile_lock);
+  m_event_profile.clear();
+}
+
+std::vector<EventProfile> CoreTimingManager::GetEventProfile() const
+{
+  std::lock_guard lk(m_event_profile_lock);
+  return m_event_profile;
+}
+
+bool CoreTimingManager::WriteEventTrace(const std::string& path) const
+{
+  File::IOFile file(path, "w");
+  if (!file)
+    return false;
+
+  // The trace is a ring buffer, so the oldest entry is the next one to be overwritten once full.
+  const size_t count = m_event_trace.size();
+  const size_t first = count < MAX_EVENT_TRACE_ENTRIES ? 0 : m_event_trace_next;
+  const TimePoint base_time = count != 0 ? m_event_trace[first].start : TimePoint{};
+
+  std::string text = "{\"traceEvents\":[\n";
+  for (size_t i = 0; i < count; ++i)
+  {
+    const EventTraceEntry& entry = m_event_trace[(first + i) % count];
+    text += fmt::format("{}{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                        "\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"cycle\":{}}}}}\n",
+                        i == 0 ? "" : ",", *entry.name, DT_us(entry.start - base_time).count(),
+                        DT_us(entry.duration).count(), entry.cycle);
+  }
+  text += "]}\n";
+
+  return file.WriteString(text);
+}
+
 u32 CoreTimingManager::GetFakeDecStartValue() const
 {
   return m_fake_dec_start_value;
@@ -609,14 +766,14 @@ void CoreTimingManager::SetFakeTBStartTicks(u64 val)
   m_globals.fake_TB_start_ticks = val;
 }
 
-void GlobalAdvance()
+void AdvanceFromJIT(CoreTimingManager& core_timing)
 {
-  Core::System::GetInstance().GetCoreTiming().Advance();
+  core_timing.Advance();
 }
 
-void GlobalIdle()
+void IdleFromJIT(CoreTimingManager& core_timing)
 {
-  Core::System::GetInstance().GetCoreTiming().Idle();
+  core_timing.Idle();
 }
 
 }  // namespace CoreTiming
@@ -23,7 +23,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
 #include "Common/Timer.h"
 #include "Core/CPUThreadConfigCallback.h"
 
@@ -52,6 +52,24 @@ struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+
+  // Removing events of this type only increments the generation. The queued events which were
+  // scheduled in an older generation are skipped when they come up.
+  u64 generation = 0;
+  // Number of queued events of this type which haven't been removed.
+  u32 queued = 0;
+
+  // Only collected while event profiling is enabled.
+  u64 profile_calls = 0;
+  DT profile_time{};
+};
+
+// Host time spent in the callbacks of one event type during the last profiling interval.
+struct EventProfile
+{
+  std::string name;
+  u64 calls;
+  DT time;
 };
 
 struct Event
@@ -60,6 +78,7 @@ struct Event
   u64 fifo_order;
   u64 userdata;
   EventType* type;
+  u64 generation = 0;
 
   // Sort by time, unless the times are the same, in which case sort by the order added to the queue
   constexpr auto operator<=>(const Event& other) const
@@ -81,10 +100,6 @@ enum class FromThread
   ANY
 };
 
-// helpers until the JIT is updated to use the instance
-void GlobalAdvance();
-void GlobalIdle();
-
 class CoreTimingManager
 {
 public:
@@ -140,6 +155,15 @@ public:
 
   std::string GetScheduledEventsSummary() const;
 
+  // Returns how much host time each event type's callback used during the last second, most
+  // expensive first. Empty unless MAIN_DEBUG_EVENT_PROFILING is enabled. May be called from any
+  // thread.
+  std::vector<EventProfile> GetEventProfile() const;
+
+  // Writes the most recent profiled callbacks in the Chrome trace event format, which can be
+  // opened in Perfetto or chrome://tracing. Must be called from the CPU thread.
+  bool WriteEventTrace(const std::string& path) const;
+
   void AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clock);
 
   u32 GetFakeDecStartValue() const;
@@ -183,13 +207,15 @@ private:
   // We don't use std::priority_queue because we need to be able to serialize, unserialize and
   // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accommodated
   // by the standard adaptor class.
+  // Removed events are left in the heap until they reach the top, or until they make up half of
+  // it, so that removing doesn't have to rebuild the heap every time.
   std::vector<Event> m_event_queue;
   u64 m_event_fifo_id = 0;
-  std::mutex m_ts_write_lock;
+  size_t m_removed_events = 0;
 
   // Event objects created from other threads.
   // The time value of each Event here is a cycles_into_future value.
-  Common::SPSCQueue<Event> m_ts_queue;
+  Common::MPSCQueue<Event, 1024> m_ts_queue;
 
   float m_last_oc_factor = 0.0f;
 
@@ -223,6 +249,15 @@ private:
   TimePoint CalculateTargetHostTimeInternal(s64 target_cycle);
   void UpdateVISkip(TimePoint current_time, TimePoint target_time);
 
+  void PushEvent(Event event);
+  static bool IsRemoved(const Event& event) { return event.generation != event.type->generation; }
+  void PopRemovedEvents();
+  void CompactEventQueue();
+
+  void RunProfiledEvent(const Event& event);
+  void PublishEventProfile(TimePoint now);
+  void ResetEventProfile();
+
   int DowncountToCycles(int downcount) const;
   int CyclesToDowncount(int cycles) const;
 
@@ -231,6 +266,28 @@ private:
   Common::PrecisionTimer m_precision_gpu_timer;
 
   int m_on_state_changed_handle;
+
+  struct EventTraceEntry
+  {
+    const std::string* name;
+    s64 cycle;
+    TimePoint start;
+    DT duration;
+  };
+
+  static constexpr size_t MAX_EVENT_TRACE_ENTRIES = 1 << 18;
+
+  bool m_profile_events = false;
+  TimePoint m_profile_interval_start{};
+  std::vector<EventTraceEntry> m_event_trace;
+  size_t m_event_trace_next = 0;
+
+  mutable std::mutex m_event_profile_lock;
+  std::vector<EventProfile> m_event_profile;
 };
 
+// Called by the JITs, which can't call member functions directly.
+void AdvanceFromJIT(CoreTimingManager& core_timing);
+void IdleFromJIT(CoreTimingManager& core_timing);
+
 }  // namespace CoreTiming
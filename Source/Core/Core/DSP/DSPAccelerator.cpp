@@ -11,6 +11,21 @@
 
 namespace DSP
 {
+static u8 GetGainShift(u16 gain_scale)
+{
+  switch (gain_scale)
+  {
+  case 0:
+    return 11;  // x / 2048 = x >> 11
+  case 1:
+    return 0;  // x / 1 = x >> 0
+  case 2:
+    return 16;  // x / 65536 = x >> 16
+  default:
+    return 0;
+  }
+}
+
 u16 Accelerator::GetCurrentSample()
 {
   u16 val = 0;
@@ -189,22 +204,9 @@ u16 Accelerator::ReadSample(const s16* coefs)
   case FormatDecode::MMIOPCMInc:
   {
     // Gain seems to only apply for PCM decoding
-    u8 gain_shift = 0;
-    switch (m_sample_format.gain_scale)
-    {
-    case FormatGainScale::GainScale2048:
-      gain_shift = 11;  // x / 2048 = x >> 11
-      break;
-    case FormatGainScale::GainScale1:
-      gain_shift = 0;  // x / 1 = x >> 0
-      break;
-    case FormatGainScale::GainScale65536:
-      gain_shift = 16;  // x / 65536 = x >> 16
-      break;
-    default:
+    if (m_sample_format.gain_scale == FormatGainScale::GainScaleInvalid)
       ERROR_LOG_FMT(DSPLLE, "ReadSample() invalid gain mode in format {:#x}", m_sample_format.hex);
-      break;
-    }
+    const u8 gain_shift = GetGainShift(static_cast<u16>(m_sample_format.gain_scale.Value()));
     s32 val32 = ((static_cast<s32>(m_gain) * raw_sample) >> gain_shift) +
                 (((coef1 * m_yn1) >> gain_shift) + ((coef2 * m_yn2) >> gain_shift));
     val = static_cast<s16>(val32);
@@ -234,6 +236,132 @@ u16 Accelerator::ReadSample(const s16* coefs)
   return val;
 }
 
+// Returns how many of the next count samples can be decoded without any of the special cases in
+// ReadSample: the end address checks, ADPCM frame headers, and everything that logs.
+u32 Accelerator::GetFastReadLength(u32 count) const
+{
+  if (m_reads_stopped || m_sample_format.unk != 0)
+    return 0;
+
+  // After each read, the current address is incremented once and then compared against the end
+  // address. The run must stop before any of the incremented addresses in [first_unsafe,
+  // last_unsafe] is reached.
+  const s64 current = m_current_address;
+  const s64 end = m_end_address;
+  s64 first_unsafe, last_unsafe;
+  u32 length = count;
+  switch (m_sample_format.decode)
+  {
+  case FormatDecode::ADPCM:
+    if (m_sample_format.size != FormatSize::Size4Bit)
+      return 0;
+    // Reading the header of the next frame is left to ReadSample, and so are the special looping
+    // cases for end addresses that are 16-byte aligned or one above.
+    length = std::min<u32>(length, 15 - (m_current_address & 15));
+    first_unsafe = end - 1;
+    last_unsafe = end + 1;
+    break;
+  case FormatDecode::PCM:
+    if (m_sample_format.size != FormatSize::Size8Bit &&
+        m_sample_format.size != FormatSize::Size16Bit)
+    {
+      return 0;
+    }
+    if (m_sample_format.gain_scale == FormatGainScale::GainScaleInvalid)
+      return 0;
+    // The current address is masked after every read, so don't let the run carry into bit 30
+    length = std::min<u32>(length, 0x3fffffff - (m_current_address & 0x3fffffff));
+    first_unsafe = last_unsafe = end + 1;
+    break;
+  default:
+    return 0;
+  }
+
+  if (current + 1 <= last_unsafe)
+    length = static_cast<u32>(std::clamp<s64>(first_unsafe - current - 1, 0, length));
+  return length;
+}
+
+void Accelerator::ReadADPCMSamples(const s16* coefs, s16* samples, u32 count)
+{
+  const int coef_idx = (m_pred_scale >> 4) & 0x7;
+  const s32 coef1 = coefs[coef_idx * 2 + 0];
+  const s32 coef2 = coefs[coef_idx * 2 + 1];
+  const s32 scale = 1 << (m_pred_scale & 0xF);
+
+  s32 yn1 = m_yn1;
+  s32 yn2 = m_yn2;
+  u32 address = m_current_address;
+  u8 byte = 0;
+  for (u32 i = 0; i < count; ++i, ++address)
+  {
+    if (i == 0 || (address & 1) == 0)
+      byte = ReadMemory(address >> 1);
+    s32 nibble = (address & 1) ? (byte & 0xF) : (byte >> 4);
+    if (nibble >= 8)
+      nibble -= 16;
+
+    const s32 val32 = (scale * nibble) + ((0x400 + coef1 * yn1 + coef2 * yn2) >> 11);
+    yn2 = yn1;
+    yn1 = std::clamp<s32>(val32, -0x7FFF, 0x7FFF);
+    samples[i] = static_cast<s16>(yn1);
+  }
+
+  m_yn1 = static_cast<s16>(yn1);
+  m_yn2 = static_cast<s16>(yn2);
+  SetCurrentAddress(address);
+}
+
+void Accelerator::ReadPCMSamples(const s16* coefs, s16* samples, u32 count)
+{
+  const int coef_idx = (m_pred_scale >> 4) & 0x7;
+  const s32 coef1 = coefs[coef_idx * 2 + 0];
+  const s32 coef2 = coefs[coef_idx * 2 + 1];
+  const s32 gain = m_gain;
+  const u8 gain_shift = GetGainShift(static_cast<u16>(m_sample_format.gain_scale.Value()));
+  const bool is_16_bit = m_sample_format.size == FormatSize::Size16Bit;
+
+  s16 yn1 = m_yn1;
+  s16 yn2 = m_yn2;
+  u32 address = m_current_address;
+  for (u32 i = 0; i < count; ++i, ++address)
+  {
+    const s16 raw_sample = is_16_bit ?
+                               static_cast<s16>((ReadMemory(address * 2) << 8) |
+                                                ReadMemory(address * 2 + 1)) :
+                               ReadMemory(address);
+    const s32 val32 = ((gain * raw_sample) >> gain_shift) +
+                      (((coef1 * yn1) >> gain_shift) + ((coef2 * yn2) >> gain_shift));
+    yn2 = yn1;
+    yn1 = static_cast<s16>(val32);
+    samples[i] = yn1;
+  }
+
+  m_yn1 = yn1;
+  m_yn2 = yn2;
+  SetCurrentAddress(address);
+}
+
+void Accelerator::ReadSamples(const s16* coefs, s16* samples, u32 count)
+{
+  u32 i = 0;
+  while (i < count)
+  {
+    const u32 length = GetFastReadLength(count - i);
+    if (length == 0)
+    {
+      samples[i++] = static_cast<s16>(ReadSample(coefs));
+      continue;
+    }
+
+    if (m_sample_format.decode == FormatDecode::ADPCM)
+      ReadADPCMSamples(coefs, samples + i, length);
+    else
+      ReadPCMSamples(coefs, samples + i, length);
+    i += length;
+  }
+}
+
 void Accelerator::DoState(PointerWrap& p)
 {
   p.Do(m_start_address);
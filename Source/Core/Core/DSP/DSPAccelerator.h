@@ -16,6 +16,9 @@ public:
   virtual ~Accelerator() = default;
 
   u16 ReadSample(const s16* coefs);
+  // Same as calling ReadSample count times, but decodes runs of samples that can't hit the end
+  // address or an ADPCM frame header without going through the per-sample checks.
+  void ReadSamples(const s16* coefs, s16* samples, u32 count);
   // Zelda ucode reads ARAM through 0xffd3.
   u16 ReadRaw();
   void WriteRaw(u16 value);
@@ -48,6 +51,9 @@ protected:
   virtual u8 ReadMemory(u32 address) = 0;
   virtual void WriteMemory(u32 address, u8 value) = 0;
   u16 GetCurrentSample();
+  u32 GetFastReadLength(u32 count) const;
+  void ReadADPCMSamples(const s16* coefs, s16* samples, u32 count);
+  void ReadPCMSamples(const s16* coefs, s16* samples, u32 count);
 
   // DSP accelerator registers.
   u32 m_start_address = 0;
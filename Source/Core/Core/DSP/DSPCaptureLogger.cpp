@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 
+#include "Common/AsyncFileWriter.h"
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 #include "Common/PcapFile.h"
@@ -39,8 +40,11 @@ struct DMAPacket
 #pragma pack(pop)
 
 PCAPDSPCaptureLogger::PCAPDSPCaptureLogger(const std::string& pcap_filename)
-    : m_pcap(new Common::PCAP(new File::IOFile(pcap_filename, "wb")))
 {
+  // The capture is written from the DSP thread, so keep disk I/O off of it
+  auto writer = std::make_unique<Common::AsyncFileWriter>("DSP Capture Writer");
+  writer->Open(pcap_filename, "wb");
+  m_pcap = std::make_unique<Common::PCAP>(std::move(writer));
 }
 
 PCAPDSPCaptureLogger::PCAPDSPCaptureLogger(Common::PCAP* pcap) : m_pcap(pcap)
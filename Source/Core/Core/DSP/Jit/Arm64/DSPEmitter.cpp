@@ -0,0 +1,473 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/Arm64/DSPEmitter.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "Common/Assert.h"
+#include "Common/BitSet.h"
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
+#include "Common/MemoryUtil.h"
+
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::Arm64
+{
+constexpr size_t COMPILED_CODE_SIZE = 2097152;
+constexpr size_t MAX_BLOCK_SIZE = 250;
+constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
+
+// Pinned while running DSP code. All of these are callee saved, so the interpreter handlers
+// that the blocks call into leave them alone.
+constexpr ARM64Reg STATE_REG = ARM64Reg::X19;
+constexpr ARM64Reg CYCLES_LEFT_REG = ARM64Reg::X20;
+constexpr ARM64Reg BLOCKS_REG = ARM64Reg::X21;
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+constexpr u32 SDSP_OFF_PC = offsetof(SDSP, pc);
+constexpr u32 SDSP_OFF_EXCEPTIONS = offsetof(SDSP, exceptions);
+constexpr u32 SDSP_OFF_CONTROL_REG = offsetof(SDSP, control_reg);
+constexpr u32 SDSP_OFF_EXTERNAL_INTERRUPT_WAITING = offsetof(SDSP, external_interrupt_waiting);
+
+constexpr u32 SDSP_OFF_R_ST(size_t index)
+{
+  return static_cast<u32>(offsetof(SDSP, r.st) + sizeof(SDSP::r.st[0]) * index);
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+static_assert(decltype(SDSP::external_interrupt_waiting)::is_always_lock_free &&
+              sizeof(SDSP::external_interrupt_waiting) == sizeof(u8));
+
+DSPEmitter::DSPEmitter(DSPCore& dsp)
+    : m_blocks(MAX_BLOCKS), m_block_size(MAX_BLOCKS), m_block_links(MAX_BLOCKS), m_dsp_core{dsp}
+{
+  AllocCodeSpace(COMPILED_CODE_SIZE);
+
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+  CompileDispatcher();
+  m_stub_entry_point = CompileStub();
+  FlushIcache();
+
+  // Clear all of the block references
+  std::ranges::fill(m_blocks, (DSPCompiledCode)m_stub_entry_point);
+}
+
+DSPEmitter::~DSPEmitter()
+{
+  FreeCodeSpace();
+}
+
+u16 DSPEmitter::RunCycles(u16 cycles)
+{
+  if (m_dsp_core.DSPState().external_interrupt_waiting.exchange(false, std::memory_order_acquire))
+  {
+    m_dsp_core.CheckExternalInterrupt();
+    m_dsp_core.CheckExceptions();
+  }
+
+  m_cycles_left = cycles;
+  auto exec_addr = (DSPCompiledCode)m_enter_dispatcher;
+  exec_addr();
+
+  if (m_dsp_core.DSPState().reset_dspjit_codespace)
+    ClearIRAMandDSPJITCodespaceReset();
+
+  return m_cycles_left;
+}
+
+void DSPEmitter::DoState(PointerWrap& p)
+{
+  p.Do(m_cycles_left);
+}
+
+void DSPEmitter::ClearIRAM()
+{
+  for (size_t i = 0; i < DSP_IRAM_SIZE; i++)
+  {
+    m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
+    m_block_links[i] = nullptr;
+    m_block_size[i] = 0;
+    m_unresolved_jumps[i].clear();
+  }
+  m_dsp_core.DSPState().reset_dspjit_codespace = true;
+}
+
+void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
+{
+  {
+    const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+    ClearCodeSpace();
+    CompileDispatcher();
+    m_stub_entry_point = CompileStub();
+    FlushIcache();
+  }
+
+  for (size_t i = 0; i < MAX_BLOCKS; i++)
+  {
+    m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
+    m_block_links[i] = nullptr;
+    m_block_size[i] = 0;
+    m_unresolved_jumps[i].clear();
+  }
+  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+static u32 CheckExceptionsThunk(DSPCore& dsp)
+{
+  return dsp.CheckExceptions() ? 1u : 0u;
+}
+
+// Must go out of block if exception is detected
+void DSPEmitter::checkExceptions(u32 retval)
+{
+  // Check for interrupts and exceptions
+  LDRB(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_EXCEPTIONS);
+  FixupBranch skip_check = CBZ(ARM64Reg::W0);
+
+  MOVI2R(ARM64Reg::W0, m_compile_pc);
+  STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_PC);
+
+  ABI_CallFunction(&CheckExceptionsThunk, &m_dsp_core);
+  FixupBranch skip_return = CBZ(ARM64Reg::W0);
+  MOVI2R(ARM64Reg::W0, retval);
+  B(m_return_dispatcher);
+  SetJumpTarget(skip_return);
+
+  SetJumpTarget(skip_check);
+}
+
+static void FallbackThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetOp(inst))(inst);
+}
+
+static void FallbackExtThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetExtOp(inst))(inst);
+}
+
+static void ApplyWriteBackLogThunk(Interpreter::Interpreter& interpreter)
+{
+  interpreter.ApplyWriteBackLog();
+}
+
+static void PopLoopStacksThunk(SDSP& state)
+{
+  state.PopStack(StackRegister::Call);
+  state.PopStack(StackRegister::LoopAddress);
+  state.PopStack(StackRegister::LoopCounter);
+}
+
+void DSPEmitter::EmitInstruction(UDSPInstruction inst)
+{
+  const DSPOPCTemplate* const op_template = GetOpTemplate(inst);
+  ASSERT_MSG(DSPLLE, Interpreter::GetOp(inst) != nullptr, "No function for {:04x}", inst);
+
+  // Handlers that read the PC expect it to point past the main opcode word, so that they can
+  // fetch their immediates from there.
+  if (op_template->reads_pc)
+  {
+    MOVI2R(ARM64Reg::W0, static_cast<u16>(m_compile_pc + 1));
+    STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_PC);
+  }
+
+  Interpreter::Interpreter& interpreter = m_dsp_core.GetInterpreter();
+  if (op_template->extended)
+    ABI_CallFunction(&FallbackExtThunk, &interpreter, inst);
+
+  ABI_CallFunction(&FallbackThunk, &interpreter, inst);
+
+  if (op_template->extended)
+    ABI_CallFunction(&ApplyWriteBackLogThunk, &interpreter);
+}
+
+void DSPEmitter::HandleLoop()
+{
+  LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_R_ST(2));
+  LDRH(IndexType::Unsigned, ARM64Reg::W1, STATE_REG, SDSP_OFF_R_ST(3));
+
+  FixupBranch loop_counter_zero = CBZ(ARM64Reg::W1);
+  CMPI2R(ARM64Reg::W0, static_cast<u16>(m_compile_pc - 1), ARM64Reg::W2);
+  FixupBranch loop_address_mismatch = B(CC_NEQ);
+
+  SUB(ARM64Reg::W1, ARM64Reg::W1, 1);
+  STRH(IndexType::Unsigned, ARM64Reg::W1, STATE_REG, SDSP_OFF_R_ST(3));
+  FixupBranch load_stack = CBZ(ARM64Reg::W1);
+
+  LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_R_ST(0));
+  STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_PC);
+  FixupBranch loop_updated = B();
+
+  SetJumpTarget(load_stack);
+  ABI_CallFunction(&PopLoopStacksThunk, &m_dsp_core.DSPState());
+
+  SetJumpTarget(loop_updated);
+  SetJumpTarget(loop_address_mismatch);
+  SetJumpTarget(loop_counter_zero);
+}
+
+void DSPEmitter::WriteBlockExit()
+{
+  const auto& analyzer = m_dsp_core.DSPState().GetAnalyzer();
+  if (!Host::OnThread() && analyzer.IsIdleSkip(m_start_address))
+    MOVI2R(ARM64Reg::W0, DSP_IDLE_SKIP_CYCLES);
+  else
+    MOVI2R(ARM64Reg::W0, m_block_size[m_start_address]);
+  B(m_return_dispatcher);
+}
+
+void DSPEmitter::WriteBlockLink(u16 dest)
+{
+  // Jump directly to the called block if it has already been compiled.
+  if (dest >= m_start_address && dest <= m_compile_pc)
+    return;
+
+  if (m_block_links[dest] != nullptr)
+  {
+    // Check if we have enough cycles to execute the next block
+    LDRH(IndexType::Unsigned, ARM64Reg::W0, CYCLES_LEFT_REG, 0);
+    CMPI2R(ARM64Reg::W0, m_block_size[m_start_address] + m_block_size[dest], ARM64Reg::W1);
+    FixupBranch not_enough_cycles = B(CC_LS);
+
+    SUB(ARM64Reg::W0, ARM64Reg::W0, m_block_size[m_start_address]);
+    STRH(IndexType::Unsigned, ARM64Reg::W0, CYCLES_LEFT_REG, 0);
+    B(m_block_links[dest]);
+    SetJumpTarget(not_enough_cycles);
+  }
+  else
+  {
+    // The destination has not been compiled yet.  Add it to the list
+    // of blocks that this block is waiting on.
+    m_unresolved_jumps[m_start_address].push_back(dest);
+  }
+}
+
+void DSPEmitter::Compile(u16 start_addr)
+{
+  // Remember the current block address for later
+  m_start_address = start_addr;
+  m_unresolved_jumps[start_addr].clear();
+
+  const u8* entry_point = AlignCode16();
+
+  m_compile_pc = start_addr;
+  bool fixup_pc = false;
+  m_block_size[start_addr] = 0;
+
+  auto& state = m_dsp_core.DSPState();
+  auto& analyzer = state.GetAnalyzer();
+  while (m_compile_pc < start_addr + MAX_BLOCK_SIZE)
+  {
+    if (analyzer.IsCheckExceptions(m_compile_pc))
+      checkExceptions(m_block_size[start_addr]);
+
+    const UDSPInstruction inst = state.ReadIMEM(m_compile_pc);
+    const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+
+    EmitInstruction(inst);
+
+    m_block_size[start_addr]++;
+    const u16 inst_pc = m_compile_pc;
+    m_compile_pc += opcode->size;
+
+    // If the block was trying to link into itself, remove the link
+    m_unresolved_jumps[start_addr].remove(m_compile_pc);
+
+    fixup_pc = true;
+
+    // Handle loop condition, only if current instruction was flagged as a loop destination
+    // by the analyzer.
+    if (analyzer.IsLoopEnd(static_cast<u16>(m_compile_pc - 1u)))
+    {
+      LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_R_ST(2));
+      FixupBranch loop_address_exit = CBZ(ARM64Reg::W0);
+      LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_R_ST(3));
+      FixupBranch loop_counter_exit = CBZ(ARM64Reg::W0);
+
+      if (!opcode->branch)
+      {
+        // branch insns update the g_dsp.pc
+        MOVI2R(ARM64Reg::W0, m_compile_pc);
+        STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_PC);
+      }
+
+      // These functions branch and therefore only need to be called in the
+      // end of each block and in this order
+      HandleLoop();
+      WriteBlockExit();
+
+      SetJumpTarget(loop_address_exit);
+      SetJumpTarget(loop_counter_exit);
+    }
+
+    if (opcode->branch)
+    {
+      // don't update g_dsp.pc -- the branch insn already did
+      fixup_pc = false;
+      if (opcode->uncond_branch)
+      {
+        // Unconditional JMP and CALL have a static destination, which makes them linkable.
+        if (opcode->param_count == 1 && opcode->params[0].type == P_ADDR_I)
+          WriteBlockLink(state.ReadIMEM(static_cast<u16>(inst_pc + 1)));
+        break;
+      }
+
+      // look at g_dsp.pc if we actually branched
+      LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_PC);
+      CMPI2R(ARM64Reg::W0, m_compile_pc, ARM64Reg::W1);
+      FixupBranch no_branch = B(CC_EQ);
+      WriteBlockExit();
+      SetJumpTarget(no_branch);
+    }
+
+    // End the block if we're before an idle skip address
+    if (analyzer.IsIdleSkip(m_compile_pc))
+    {
+      break;
+    }
+  }
+
+  if (fixup_pc)
+  {
+    MOVI2R(ARM64Reg::W0, m_compile_pc);
+    STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_PC);
+  }
+
+  m_blocks[start_addr] = (DSPCompiledCode)entry_point;
+
+  // Mark this block as a linkable destination if it does not contain
+  // any unresolved CALL's
+  if (m_unresolved_jumps[start_addr].empty())
+  {
+    m_block_links[start_addr] = entry_point;
+
+    for (size_t i = 0; i < 0xffff; ++i)
+    {
+      if (!m_unresolved_jumps[i].empty())
+      {
+        // Check if there were any blocks waiting for this block to be linkable
+        size_t size = m_unresolved_jumps[i].size();
+        m_unresolved_jumps[i].remove(start_addr);
+        if (m_unresolved_jumps[i].size() < size)
+        {
+          // Mark the block to be recompiled again
+          m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
+          m_block_links[i] = nullptr;
+          m_block_size[i] = 0;
+        }
+      }
+    }
+  }
+
+  if (m_block_size[start_addr] == 0)
+  {
+    // just a safeguard, should never happen anymore.
+    // if it does we might get stuck over in RunForCycles.
+    ERROR_LOG_FMT(DSPLLE, "Block at {:#06x} has zero size", start_addr);
+    m_block_size[start_addr] = 1;
+  }
+
+  WriteBlockExit();
+}
+
+void DSPEmitter::CompileCurrent(DSPEmitter& emitter)
+{
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+
+  emitter.Compile(emitter.m_dsp_core.DSPState().pc);
+
+  bool retry = true;
+
+  while (retry)
+  {
+    retry = false;
+    for (size_t i = 0; i < 0xffff; ++i)
+    {
+      if (!emitter.m_unresolved_jumps[i].empty())
+      {
+        const u16 address_to_compile = emitter.m_unresolved_jumps[i].front();
+        emitter.Compile(address_to_compile);
+        if (!emitter.m_unresolved_jumps[i].empty())
+          retry = true;
+      }
+    }
+  }
+
+  emitter.FlushIcache();
+}
+
+DSPEmitter::Block DSPEmitter::CompileStub()
+{
+  const u8* entry_point = AlignCode16();
+  ABI_CallFunction(&CompileCurrent, this);
+  MOVI2R(ARM64Reg::W0, 0);  // Return 0 cycles executed
+  B(m_return_dispatcher);
+  return entry_point;
+}
+
+void DSPEmitter::CompileDispatcher()
+{
+  m_enter_dispatcher = AlignCode16();
+
+  // R19 ~ R30 are callee saved. No floating point registers are used.
+  const BitSet32 registers_used(0x7FF80000);
+  ABI_PushRegisters(registers_used);
+
+  MOVP2R(STATE_REG, &m_dsp_core.DSPState());
+  MOVP2R(CYCLES_LEFT_REG, &m_cycles_left);
+  MOVP2R(BLOCKS_REG, m_blocks.data());
+
+  const u8* dispatcher_loop = GetCodePtr();
+
+  FixupBranch exception_exit;
+  if (Host::OnThread())
+  {
+    LDRB(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_EXTERNAL_INTERRUPT_WAITING);
+    exception_exit = CBNZ(ARM64Reg::W0);
+  }
+
+  // Check for DSP halt
+  LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_OFF_CONTROL_REG);
+  FixupBranch halt = TBNZ(ARM64Reg::W0, MathUtil::IntLog2(CR_HALT));
+
+  // Execute block. Cycles executed returned in W0.
+  LDRH(IndexType::Unsigned, ARM64Reg::W1, STATE_REG, SDSP_OFF_PC);
+  LDR(ARM64Reg::X2, BLOCKS_REG, ArithOption(ARM64Reg::X1, true));
+  BR(ARM64Reg::X2);
+
+  m_return_dispatcher = GetCodePtr();
+
+  // Decrement cyclesLeft
+  LDRH(IndexType::Unsigned, ARM64Reg::W1, CYCLES_LEFT_REG, 0);
+  SUBS(ARM64Reg::W1, ARM64Reg::W1, ARM64Reg::W0);
+  STRH(IndexType::Unsigned, ARM64Reg::W1, CYCLES_LEFT_REG, 0);
+  B(CC_HI, dispatcher_loop);
+
+  // DSP gave up the remaining cycles.
+  SetJumpTarget(halt);
+  if (Host::OnThread())
+  {
+    SetJumpTarget(exception_exit);
+  }
+  ABI_PopRegisters(registers_used);
+  RET();
+}
+
+}  // namespace DSP::JIT::Arm64
@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <list>
+#include <vector>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCommon.h"
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+
+class PointerWrap;
+
+namespace DSP
+{
+class DSPCore;
+
+namespace JIT::Arm64
+{
+// A block-based recompiler for ARM64 hosts. Blocks are formed, linked and idle-skipped exactly
+// like in the x64 emitter, but the instructions inside a block are emitted as direct calls into
+// the interpreter's handlers. This removes the per-instruction fetch, decode, loop and exception
+// polling overhead of the interpreter while sharing its (well tested) instruction semantics.
+class DSPEmitter final : public JIT::DSPEmitter, public Arm64Gen::ARM64CodeBlock
+{
+public:
+  explicit DSPEmitter(DSPCore& dsp);
+  ~DSPEmitter() override;
+
+  u16 RunCycles(u16 cycles) override;
+  void DoState(PointerWrap& p) override;
+  void ClearIRAM() override;
+
+private:
+  using DSPCompiledCode = u32 (*)();
+  using Block = const u8*;
+
+  // The emitter emits calls to this function. It's present here
+  // within the class itself to allow access to member variables.
+  static void CompileCurrent(DSPEmitter& emitter);
+
+  void EmitInstruction(UDSPInstruction inst);
+  void ClearIRAMandDSPJITCodespaceReset();
+
+  void CompileDispatcher();
+  Block CompileStub();
+  void Compile(u16 start_addr);
+
+  // Loads the cycle count of the current block into W0 and returns to the dispatcher.
+  void WriteBlockExit();
+  void WriteBlockLink(u16 dest);
+
+  void HandleLoop();
+  void checkExceptions(u32 retval);
+
+  static constexpr size_t MAX_BLOCKS = 0x10000;
+
+  u16 m_compile_pc = 0;
+  u16 m_start_address = 0;
+
+  std::vector<DSPCompiledCode> m_blocks;
+  std::vector<u16> m_block_size;
+  std::vector<Block> m_block_links;
+
+  std::array<std::list<u16>, MAX_BLOCKS> m_unresolved_jumps;
+
+  u16 m_cycles_left = 0;
+
+  // CALL this to start the dispatcher
+  const u8* m_enter_dispatcher = nullptr;
+  const u8* m_return_dispatcher = nullptr;
+  const u8* m_stub_entry_point = nullptr;
+
+  DSPCore& m_dsp_core;
+};
+
+}  // namespace JIT::Arm64
+}  // namespace DSP
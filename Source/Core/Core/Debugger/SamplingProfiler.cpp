@@ -0,0 +1,335 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Debugger/SamplingProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <utility>
+
+#include <fmt/format.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif !defined(_M_GENERIC)
+#include <pthread.h>
+#include <signal.h>
+#endif
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Core/Core.h"
+#include "Core/HLE/HLE.h"
+#include "Core/MachineContext.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "VideoCommon/VideoEvents.h"
+
+namespace Core
+{
+namespace
+{
+constexpr auto SAMPLE_INTERVAL = std::chrono::milliseconds(1);
+// How long to wait for the CPU thread to take a sample before giving up on it
+constexpr auto SAMPLE_TIMEOUT = std::chrono::milliseconds(10);
+
+// Set while recording. The signal handler can only use these.
+const u32* s_guest_pc = nullptr;
+std::atomic<uintptr_t> s_sample_host_pc;
+std::atomic<u32> s_sample_guest_pc;
+
+#ifdef _WIN32
+HANDLE s_cpu_thread = nullptr;
+#elif !defined(_M_GENERIC)
+pthread_t s_cpu_thread;
+std::atomic<bool> s_sample_taken;
+bool s_handler_installed = false;
+
+void SampleHandler(int sig, siginfo_t* info, void* raw_context)
+{
+  ucontext_t* context = static_cast<ucontext_t*>(raw_context);
+#if defined(__APPLE__) && defined(USE_SIGACTION_ON_APPLE)
+  const SContext* ctx = context->uc_mcontext;
+#elif defined(__APPLE__)
+  const SContext* ctx = &context->uc_mcontext->__ss;
+#elif defined(__OpenBSD__)
+  const SContext* ctx = context;
+#else
+  const SContext* ctx = &context->uc_mcontext;
+#endif
+
+  s_sample_host_pc.store(static_cast<uintptr_t>(ctx->CTX_PC), std::memory_order_relaxed);
+  s_sample_guest_pc.store(*s_guest_pc, std::memory_order_relaxed);
+  s_sample_taken.store(true, std::memory_order_release);
+}
+#endif
+
+// Must be called on the CPU thread.
+bool AttachCPUThread()
+{
+#ifdef _WIN32
+  s_cpu_thread = OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_QUERY_INFORMATION,
+                            FALSE, GetCurrentThreadId());
+  return s_cpu_thread != nullptr;
+#elif !defined(_M_GENERIC)
+  s_cpu_thread = pthread_self();
+
+  // The handler is left installed, as a signal which timed out may still be delivered later.
+  if (s_handler_installed)
+    return true;
+
+  struct sigaction sa;
+  sa.sa_sigaction = &SampleHandler;
+  sa.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  s_handler_installed = sigaction(SIGPROF, &sa, nullptr) == 0;
+  return s_handler_installed;
+#else
+  return false;
+#endif
+}
+
+void DetachCPUThread()
+{
+#ifdef _WIN32
+  CloseHandle(s_cpu_thread);
+  s_cpu_thread = nullptr;
+#endif
+}
+
+bool TakeSample(uintptr_t* host_pc, u32* guest_pc)
+{
+#ifdef _WIN32
+  if (SuspendThread(s_cpu_thread) == static_cast<DWORD>(-1))
+    return false;
+
+  // Nothing which could take a lock held by the CPU thread may run until it's resumed.
+  CONTEXT context{};
+  context.ContextFlags = CONTEXT_CONTROL;
+  const bool got_context = GetThreadContext(s_cpu_thread, &context);
+  *guest_pc = *s_guest_pc;
+  ResumeThread(s_cpu_thread);
+
+  if (!got_context)
+    return false;
+  *host_pc = static_cast<uintptr_t>(context.CTX_PC);
+  return true;
+#elif !defined(_M_GENERIC)
+  s_sample_taken.store(false, std::memory_order_relaxed);
+  if (pthread_kill(s_cpu_thread, SIGPROF) != 0)
+    return false;
+
+  // The signal is handled as soon as the CPU thread is scheduled, which can take a while if it's
+  // waiting for something.
+  const auto timeout = std::chrono::steady_clock::now() + SAMPLE_TIMEOUT;
+  while (!s_sample_taken.load(std::memory_order_acquire))
+  {
+    if (std::chrono::steady_clock::now() > timeout)
+      return false;
+    std::this_thread::yield();
+  }
+
+  *host_pc = s_sample_host_pc.load(std::memory_order_relaxed);
+  *guest_pc = s_sample_guest_pc.load(std::memory_order_relaxed);
+  return true;
+#else
+  return false;
+#endif
+}
+}  // namespace
+
+SamplingProfiler::~SamplingProfiler()
+{
+  Stop();
+}
+
+bool SamplingProfiler::IsSupported()
+{
+#ifdef _M_GENERIC
+  return false;
+#else
+  return true;
+#endif
+}
+
+void SamplingProfiler::Start(Core::System& system)
+{
+  std::lock_guard lk(m_control_lock);
+  if (m_running || !IsSupported())
+    return;
+
+  m_counts.clear();
+  m_total_samples = 0;
+  m_pending_samples.clear();
+  s_guest_pc = &system.GetPPCState().pc;
+
+  m_system = &system;
+  m_running = true;
+  // The sampler thread is started by the CPU thread so that it knows which thread to interrupt.
+  m_VI_end_field_event =
+      VIEndFieldEvent::Register([this, &system] { OnFrameEnd(system); }, "SamplingProfiler");
+}
+
+void SamplingProfiler::Stop()
+{
+  std::lock_guard lk(m_control_lock);
+  if (!m_running)
+    return;
+
+  // Waits for OnFrameEnd to return if it's running.
+  m_VI_end_field_event.reset();
+
+  if (m_sampler_thread.joinable())
+  {
+    m_sampling = false;
+    m_sampler_thread.join();
+    DetachCPUThread();
+  }
+
+  // The samples can't be mapped to JIT blocks anymore after the CPU thread has moved on.
+  if (Core::IsCPUThread())
+    ResolveSamples(*m_system);
+  m_pending_samples.clear();
+
+  m_running = false;
+}
+
+void SamplingProfiler::OnFrameEnd(Core::System& system)
+{
+  if (!m_sampler_thread.joinable())
+  {
+    if (!AttachCPUThread())
+    {
+      ERROR_LOG_FMT(POWERPC, "Failed to attach the sampling profiler to the CPU thread");
+      return;
+    }
+    m_sampling = true;
+    m_sampler_thread = std::thread(&SamplingProfiler::SamplerThread, this);
+  }
+
+  ResolveSamples(system);
+}
+
+void SamplingProfiler::SamplerThread()
+{
+  Common::SetCurrentThreadName("Sampling profiler");
+
+  while (m_sampling)
+  {
+    std::this_thread::sleep_for(SAMPLE_INTERVAL);
+
+    Sample sample;
+    if (!TakeSample(&sample.host_pc, &sample.guest_pc))
+      continue;
+
+    std::lock_guard lk(m_samples_lock);
+    m_pending_samples.push_back(sample);
+  }
+}
+
+void SamplingProfiler::ResolveSamples(Core::System& system)
+{
+  std::vector<Sample> samples;
+  {
+    std::lock_guard lk(m_samples_lock);
+    samples.swap(m_pending_samples);
+  }
+  if (samples.empty())
+    return;
+
+  // The host code of every block, sorted by address
+  struct CodeRange
+  {
+    uintptr_t begin;
+    uintptr_t end;
+    u32 address;
+  };
+  std::vector<CodeRange> ranges;
+  ranges.reserve(system.GetJitInterface().GetBlockCount() * 2);
+  {
+    const Core::CPUThreadGuard guard(system);
+    system.GetJitInterface().RunOnBlocks(guard, [&ranges](const JitBlock& block) {
+      ranges.push_back({reinterpret_cast<uintptr_t>(block.near_begin),
+                        reinterpret_cast<uintptr_t>(block.near_end), block.effectiveAddress});
+      if (block.far_begin != block.far_end)
+      {
+        ranges.push_back({reinterpret_cast<uintptr_t>(block.far_begin),
+                          reinterpret_cast<uintptr_t>(block.far_end), block.effectiveAddress});
+      }
+    });
+  }
+  std::ranges::sort(ranges, {}, &CodeRange::begin);
+
+  const PPCSymbolDB& symbol_db = system.GetPPCSymbolDB();
+  for (const Sample& sample : samples)
+  {
+    std::string_view category = "Host";
+    u32 address = sample.guest_pc;
+
+    const auto range = std::ranges::upper_bound(ranges, sample.host_pc, {}, &CodeRange::begin);
+    if (range != ranges.begin() && sample.host_pc < std::prev(range)->end)
+    {
+      category = "JIT";
+      address = std::prev(range)->address;
+    }
+
+    std::string function;
+    if (const u32 hook_index = HLE::GetHookByAddress(address); hook_index != 0)
+    {
+      category = "HLE";
+      function = HLE::GetHookNameByIndex(hook_index);
+    }
+    else if (const Common::Symbol* symbol = symbol_db.GetSymbolFromAddr(address))
+    {
+      function = symbol->name;
+    }
+    else
+    {
+      function = fmt::format("{:08x}", address);
+    }
+
+    // The folded stack format uses semicolons to separate frames.
+    std::ranges::replace(function, ';', ':');
+    m_counts[fmt::format("{};{}", category, function)]++;
+  }
+  m_total_samples += samples.size();
+}
+
+bool SamplingProfiler::WriteFoldedStacks(const std::string& path) const
+{
+  File::IOFile f(path, "w");
+  if (!f)
+    return false;
+
+  for (const auto& [stack, count] : m_counts)
+    f.WriteString(fmt::format("{} {}\n", stack, count));
+
+  return true;
+}
+
+bool SamplingProfiler::WriteReport(const std::string& path) const
+{
+  File::IOFile f(path, "w");
+  if (!f)
+    return false;
+
+  std::vector<std::pair<std::string_view, u64>> functions(m_counts.begin(), m_counts.end());
+  std::ranges::stable_sort(functions,
+                           [](const auto& a, const auto& b) { return a.second > b.second; });
+
+  f.WriteString(fmt::format("{} samples\n\n", m_total_samples));
+  f.WriteString(fmt::format("{:>10} {:>7}  {}\n", "Samples", "Percent", "Function"));
+  for (const auto& [stack, count] : functions)
+  {
+    const double percent = 100.0 * count / m_total_samples;
+    f.WriteString(fmt::format("{:>10} {:>6.2f}%  {}\n", count, percent, stack));
+  }
+
+  return true;
+}
+}  // namespace Core
@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+namespace Core
+{
+class System;
+
+// Statistical profiler which attributes the host time spent on the CPU thread to guest functions.
+//
+// A sampler thread interrupts the CPU thread about a thousand times per second and records its
+// host PC and the guest PC. Once per field, the CPU thread maps the host PCs to the JIT blocks
+// containing them, and looks up the guest functions in the symbol map. Time spent outside of
+// recompiled code (interpreters, HLE, dispatcher, memory handlers) is attributed using the guest
+// PC, so it's only as precise as the CPU core keeps it up to date.
+class SamplingProfiler
+{
+public:
+  SamplingProfiler() = default;
+  ~SamplingProfiler();
+
+  SamplingProfiler(const SamplingProfiler&) = delete;
+  SamplingProfiler& operator=(const SamplingProfiler&) = delete;
+
+  static bool IsSupported();
+
+  // Starting discards the previously recorded profile.
+  void Start(Core::System& system);
+  void Stop();
+  bool IsRunning() const { return m_running; }
+
+  // One "category;function count" line per function, for flame graph tools.
+  bool WriteFoldedStacks(const std::string& path) const;
+  // Functions sorted by the number of samples.
+  bool WriteReport(const std::string& path) const;
+
+private:
+  struct Sample
+  {
+    uintptr_t host_pc;
+    u32 guest_pc;
+  };
+
+  void OnFrameEnd(Core::System& system);
+  void ResolveSamples(Core::System& system);
+  void SamplerThread();
+
+  std::atomic<bool> m_running = false;
+  std::atomic<bool> m_sampling = false;
+  std::thread m_sampler_thread;
+  Common::EventHook m_VI_end_field_event;
+  std::mutex m_control_lock;
+  Core::System* m_system = nullptr;
+
+  std::mutex m_samples_lock;
+  std::vector<Sample> m_pending_samples;
+
+  // Only touched on the CPU thread while recording
+  std::map<std::string, u64> m_counts;
+  u64 m_total_samples = 0;
+};
+}  // namespace Core
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
@@ -104,6 +105,25 @@ void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
   m_Frames.push_back(frameInfo);
 }
 
+bool FifoDataFile::ReadMemoryUpdateData(const MemoryUpdate& update, u8* dest)
+{
+  if (!m_streaming_file)
+  {
+    std::ranges::copy(update.data, dest);
+    return true;
+  }
+
+  if (!m_streaming_file->Seek(update.fileOffset, File::SeekOrigin::Begin) ||
+      !m_streaming_file->ReadBytes(dest, update.size))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to read memory update at {:#x} from the DFF file",
+                  update.fileOffset);
+    m_streaming_file->ClearError();
+    return false;
+  }
+  return true;
+}
+
 bool FifoDataFile::Save(const std::string& filename)
 {
   File::IOFile file;
@@ -312,6 +332,10 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   if (!file.IsGood())
     return panic_failed_to_read();
 
+  const bool stream_data = file.GetSize() > STREAMING_THRESHOLD;
+  if (stream_data)
+    INFO_LOG_FMT(VIDEO, "Streaming memory updates from {}", filename);
+
   // idk what else these could be used for, but it'd be a shame to not make them available.
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
@@ -333,15 +357,19 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     file.Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
     file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
 
-    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
-
-    if (!file.IsGood())
+    if (!ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
+                           dstFrame.memoryUpdates, file, stream_data) ||
+        !file.IsGood())
+    {
       return panic_failed_to_read();
+    }
 
-    dataFile->AddFrame(dstFrame);
+    dataFile->m_Frames.push_back(std::move(dstFrame));
   }
 
+  if (stream_data)
+    dataFile->m_streaming_file = std::make_unique<File::IOFile>(std::move(file));
+
   return dataFile;
 }
 
@@ -371,6 +399,7 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
   u64 updateListOffset = file.Tell();
   PadFile(memUpdates.size() * sizeof(FileMemoryUpdate), file);
 
+  std::vector<u8> streamed_data;
   for (unsigned int i = 0; i < memUpdates.size(); ++i)
   {
     const MemoryUpdate& srcUpdate = memUpdates[i];
@@ -378,12 +407,21 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
     // Write memory
     file.Seek(0, File::SeekOrigin::End);
     u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+    if (m_streaming_file)
+    {
+      streamed_data.resize(srcUpdate.size);
+      ReadMemoryUpdateData(srcUpdate, streamed_data.data());
+      file.WriteBytes(streamed_data.data(), streamed_data.size());
+    }
+    else
+    {
+      file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+    }
 
     FileMemoryUpdate dstUpdate;
     dstUpdate.address = srcUpdate.address;
     dstUpdate.dataOffset = dataOffset;
-    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
+    dstUpdate.dataSize = srcUpdate.size;
     dstUpdate.fifoPosition = srcUpdate.fifoPosition;
     dstUpdate.type = static_cast<u8>(srcUpdate.type);
 
@@ -395,25 +433,36 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
   return updateListOffset;
 }
 
-void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
+bool FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
+                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file,
+                                     bool stream_data)
 {
+  // The update list is contiguous, so read it at once.
+  std::vector<FileMemoryUpdate> srcUpdates(numUpdates);
+  file.Seek(fileOffset, File::SeekOrigin::Begin);
+  if (!file.ReadArray(srcUpdates.data(), srcUpdates.size()))
+    return false;
+
   memUpdates.resize(numUpdates);
 
   for (u32 i = 0; i < numUpdates; ++i)
   {
-    u64 updateOffset = fileOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    FileMemoryUpdate srcUpdate;
-    file.ReadBytes(&srcUpdate, sizeof(FileMemoryUpdate));
+    const FileMemoryUpdate& srcUpdate = srcUpdates[i];
 
     MemoryUpdate& dstUpdate = memUpdates[i];
     dstUpdate.address = srcUpdate.address;
     dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.data.resize(srcUpdate.dataSize);
     dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
+    dstUpdate.fileOffset = srcUpdate.dataOffset;
+    dstUpdate.size = srcUpdate.dataSize;
+
+    if (stream_data)
+      continue;
 
+    dstUpdate.data.resize(srcUpdate.dataSize);
     file.Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
+    if (!file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize))
+      return false;
   }
+  return true;
 }
@@ -28,8 +28,13 @@ struct MemoryUpdate
 
   u32 fifoPosition = 0;
   u32 address = 0;
+  // Empty if the data is streamed from the file, see FifoDataFile::ReadMemoryUpdateData.
   std::vector<u8> data;
   Type type{};
+
+  // Where the data is in the file it was loaded from.
+  u64 fileOffset = 0;
+  u32 size = 0;
 };
 
 struct FifoFrameInfo
@@ -77,6 +82,14 @@ public:
   u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
   bool Save(const std::string& filename);
 
+  // Copies the size bytes of data of a memory update of this file to dest.
+  bool ReadMemoryUpdateData(const MemoryUpdate& update, u8* dest);
+
+  // Files larger than this keep the data of their memory updates on disk, and read it when it
+  // is played, so that they load quickly and don't need to fit in RAM. The FIFO data of all
+  // frames is still loaded, since it is analyzed when the file is opened.
+  static constexpr u64 STREAMING_THRESHOLD = 256 * 1024 * 1024;
+
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
 
 private:
@@ -91,8 +104,9 @@ private:
   bool GetFlag(u32 flag) const;
 
   u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
-  static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  static bool ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
+                                std::vector<MemoryUpdate>& memUpdates, File::IOFile& file,
+                                bool stream_data);
 
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
   std::array<u32, CP_MEM_SIZE> m_CPMem{};
@@ -106,4 +120,7 @@ private:
   u32 m_Version = 0;
 
   std::vector<FifoFrameInfo> m_Frames;
+
+  // Open while memory update data is streamed from the file.
+  std::unique_ptr<File::IOFile> m_streaming_file;
 };
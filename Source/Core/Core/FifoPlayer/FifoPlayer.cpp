@@ -27,6 +27,7 @@
 #include "Core/System.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
+#include "VideoCommon/TMEM.h"
 #include "VideoCommon/VideoCommon.h"
 
 // We need to include TextureDecoder.h for the texMem array.
@@ -183,6 +184,7 @@ bool FifoPlayer::Open(const std::string& filename)
   Close();
 
   m_File = FifoDataFile::Load(filename, false);
+  m_LoopsPlayed = 0;
 
   if (m_File)
   {
@@ -273,7 +275,8 @@ CPU::State FifoPlayer::AdvanceFrame()
 {
   if (m_CurrentFrame > m_FrameRangeEnd)
   {
-    if (!m_Loop)
+    ++m_LoopsPlayed;
+    if (m_LoopLimit != 0 ? m_LoopsPlayed >= m_LoopLimit : !m_Loop)
       return CPU::State::PowerDown;
 
     // When looping, reload the contents of all the BP/CP/CF registers.
@@ -494,7 +497,7 @@ void FifoPlayer::WriteMemory(const MemoryUpdate& memUpdate)
   else
     mem = &memory.GetRAM()[memUpdate.address & memory.GetRamMask()];
 
-  std::ranges::copy(memUpdate.data, mem);
+  m_File->ReadMemoryUpdateData(memUpdate, mem);
 }
 
 void FifoPlayer::WriteFifo(const u8* data, u32 start, u32 end)
@@ -702,6 +705,7 @@ void FifoPlayer::LoadTextureMemory()
   static_assert(static_cast<size_t>(TMEM_SIZE) == static_cast<size_t>(FifoDataFile::TEX_MEM_SIZE),
                 "TMEM_SIZE matches the size of texture memory in FifoDataFile");
   std::memcpy(s_tex_mem.data(), m_File->GetTexMem(), FifoDataFile::TEX_MEM_SIZE);
+  TMEM::ForgetPreloads();
 }
 
 void FifoPlayer::WriteCP(u32 address, u16 value)
@@ -133,6 +133,10 @@ public:
   u32 GetObjectRangeEnd() const { return m_ObjectRangeEnd; }
   void SetObjectRangeEnd(u32 end) { m_ObjectRangeEnd = end; }
 
+  // Stops playback after the frame range was played the given number of times, regardless of
+  // the loop setting. 0 leaves it to the loop setting.
+  void SetLoopLimit(u32 loops) { m_LoopLimit = loops; }
+
   // Callbacks
   void SetFileLoadedCallback(CallbackFunc callback);
   void SetFrameWrittenCallback(CallbackFunc callback) { m_FrameWrittenCb = std::move(callback); }
@@ -184,6 +188,8 @@ private:
   Core::System& m_system;
 
   bool m_Loop = true;
+  u32 m_LoopLimit = 0;
+  u32 m_LoopsPlayed = 0;
   // If enabled then all memory updates happen at once before the first frame
   bool m_EarlyMemoryUpdates = false;
 
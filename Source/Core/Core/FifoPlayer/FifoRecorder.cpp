@@ -378,6 +378,7 @@ void FifoRecorder::UseMemory(u32 address, u32 size, MemoryUpdate::Type type, boo
     memUpdate.type = type;
     memUpdate.data.resize(size);
     std::copy_n(newData, size, memUpdate.data.begin());
+    memUpdate.size = size;
 
     m_CurrentFrame.memoryUpdates.push_back(std::move(memUpdate));
   }
@@ -6,7 +6,9 @@
 #include <algorithm>
 #include <iterator>
 #include <mutex>
+#include <optional>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "Common/ChunkFile.h"
@@ -48,6 +50,8 @@ static Installation s_code_handler_installed = Installation::Uninstalled;
 // the currently active codes
 static std::vector<GeckoCode> s_active_codes;
 static std::vector<GeckoCode> s_synced_codes;
+// The active codes which couldn't be converted to patches and need to be run by the code handler
+static std::vector<GeckoCode> s_handler_codes;
 static std::mutex s_active_codes_lock;
 
 size_t CountEnabledCodes()
@@ -59,6 +63,66 @@ size_t CountEnabledCodes()
   return s_active_codes.size();
 }
 
+std::optional<PatchEngine::Patch> ConvertToPatch(const GeckoCode& code)
+{
+  PatchEngine::Patch patch;
+  patch.name = code.name;
+  patch.enabled = true;
+
+  for (const GeckoCode::Code& line : code.codes)
+  {
+    // This assumes that the base address is 0x80000000. The po flag (0x10) selects the pointer
+    // instead, and the remaining bits of the first byte are part of the address.
+    const u32 address = 0x80000000 | (line.address & 0x01FFFFFF);
+    switch (line.address >> 25)
+    {
+    case 0:  // 00XXXXXX YYYY00ZZ
+      for (u32 i = 0; i <= line.data >> 16; ++i)
+      {
+        patch.entries.emplace_back(PatchEngine::PatchType::Patch8Bit, address + i,
+                                   line.data & 0xFF);
+      }
+      break;
+    case 1:  // 02XXXXXX YYYYZZZZ
+      for (u32 i = 0; i <= line.data >> 16; ++i)
+      {
+        patch.entries.emplace_back(PatchEngine::PatchType::Patch16Bit, address + i * 2,
+                                   line.data & 0xFFFF);
+      }
+      break;
+    case 2:  // 04XXXXXX ZZZZZZZZ
+      patch.entries.emplace_back(PatchEngine::PatchType::Patch32Bit, address, line.data);
+      break;
+    default:
+      return std::nullopt;
+    }
+  }
+
+  if (patch.entries.empty())
+    return std::nullopt;
+  return patch;
+}
+
+// Requires s_active_codes_lock
+static void UpdateHandlerCodesLocked()
+{
+  s_handler_codes.clear();
+  std::vector<PatchEngine::Patch> patches;
+  const bool native_writes = Config::Get(Config::MAIN_GECKO_NATIVE_WRITES);
+  for (const GeckoCode& code : s_active_codes)
+  {
+    std::optional<PatchEngine::Patch> patch;
+    if (native_writes)
+      patch = ConvertToPatch(code);
+
+    if (patch)
+      patches.push_back(std::move(*patch));
+    else
+      s_handler_codes.push_back(code);
+  }
+  PatchEngine::SetGeckoPatches(std::move(patches));
+}
+
 void SetActiveCodes(std::span<const GeckoCode> gcodes, const std::string& game_id, u16 revision)
 {
   std::lock_guard lk(s_active_codes_lock);
@@ -75,6 +139,7 @@ void SetActiveCodes(std::span<const GeckoCode> gcodes, const std::string& game_i
                  });
   }
   s_active_codes.shrink_to_fit();
+  UpdateHandlerCodesLocked();
 
   s_code_handler_installed = Installation::Uninstalled;
 }
@@ -84,6 +149,7 @@ void SetSyncedCodesAsActive()
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
+  UpdateHandlerCodesLocked();
 }
 
 void UpdateSyncedCodes(std::span<const GeckoCode> gcodes)
@@ -107,6 +173,7 @@ std::vector<GeckoCode> SetAndReturnActiveCodes(std::span<const GeckoCode> gcodes
                  [](const GeckoCode& code) { return code.enabled; });
   }
   s_active_codes.shrink_to_fit();
+  UpdateHandlerCodesLocked();
 
   s_code_handler_installed = Installation::Uninstalled;
 
@@ -170,8 +237,8 @@ static Installation InstallCodeHandlerLocked(const Core::CPUThreadGuard& guard)
   const u32 end_address = codelist_end_address - CODE_SIZE;
   u32 next_address = start_address;
 
-  // NOTE: Only active codes are in the list
-  for (const GeckoCode& active_code : s_active_codes)
+  // NOTE: Only active codes which weren't converted to patches are in the list
+  for (const GeckoCode& active_code : s_handler_codes)
   {
     // If the code is not going to fit in the space we have left then we have to skip it
     if (next_address + active_code.codes.size() * CODE_SIZE > end_address)
@@ -231,6 +298,8 @@ void Shutdown()
 {
   std::lock_guard codes_lock(s_active_codes_lock);
   s_active_codes.clear();
+  s_handler_codes.clear();
+  PatchEngine::SetGeckoPatches({});
   s_code_handler_installed = Installation::Uninstalled;
 }
 
@@ -246,7 +315,7 @@ void RunCodeHandler(const Core::CPUThreadGuard& guard)
     {
       // Don't spam retry if the install failed. The corrupt / missing disk file is not likely to be
       // fixed within 1 frame of the last error.
-      if (s_active_codes.empty() || s_code_handler_installed == Installation::Failed)
+      if (s_handler_codes.empty() || s_code_handler_installed == Installation::Failed)
         return;
       s_code_handler_installed = InstallCodeHandlerLocked(guard);
 
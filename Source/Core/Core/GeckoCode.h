@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Core/PatchEngine.h"
 
 class PointerWrap;
 
@@ -65,6 +67,9 @@ void SetActiveCodes(std::span<const GeckoCode> gcodes, const std::string& game_i
 void SetSyncedCodesAsActive();
 void UpdateSyncedCodes(std::span<const GeckoCode> gcodes);
 std::vector<GeckoCode> SetAndReturnActiveCodes(std::span<const GeckoCode> gcodes);
+// Converts a code which only consists of 8, 16 and 32-bit writes (code types 00, 02 and 04) to a
+// patch which can be applied without running the code handler. Returns nullopt for other codes.
+std::optional<PatchEngine::Patch> ConvertToPatch(const GeckoCode& code);
 void RunCodeHandler(const Core::CPUThreadGuard& guard);
 void Shutdown();
 void DoState(PointerWrap&);
@@ -15,6 +15,7 @@
 #include "Core/GeckoCode.h"
 #include "Core/HLE/HLE_Misc.h"
 #include "Core/HLE/HLE_OS.h"
+#include "Core/HLE/HLE_SDK.h"
 #include "Core/HW/Memmap.h"
 #include "Core/Host.h"
 #include "Core/IOS/ES/ES.h"
@@ -28,7 +29,7 @@ namespace HLE
 static std::map<u32, u32> s_hooked_addresses;
 
 // clang-format off
-constexpr std::array<Hook, 23> os_patches{{
+constexpr std::array<Hook, 29> os_patches{{
     // Placeholder, os_patches[0] is the "non-existent function" index
     {"FAKE_TO_SKIP_0",               HLE_Misc::UnimplementedFunction,       HookType::Replace, HookFlag::Generic},
 
@@ -58,9 +59,17 @@ constexpr std::array<Hook, 23> os_patches{{
     {"___blank",                     HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Debug}, // used for early init things (normally)
     {"__write_console",              HLE_OS::HLE_write_console,             HookType::Start,   HookFlag::Debug}, // used by sysmenu (+more?)
 
+    // SDK functions
+    {"memcpy",                       HLE_SDK::HLE_memcpy,                   HookType::Replace, HookFlag::SDK},
+    {"memset",                       HLE_SDK::HLE_memset,                   HookType::Replace, HookFlag::SDK},
+    {"DCFlushRange",                 HLE_SDK::HLE_DCFlushRange,             HookType::Replace, HookFlag::SDK},
+    {"DCInvalidateRange",            HLE_SDK::HLE_DCInvalidateRange,        HookType::Replace, HookFlag::SDK},
+    {"DCStoreRange",                 HLE_SDK::HLE_DCStoreRange,             HookType::Replace, HookFlag::SDK},
+
     {"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HookType::Start,   HookFlag::Fixed},
     {"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HookType::Replace, HookFlag::Fixed},
-    {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Fixed} // apploader needs OSReport-like function
+    {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Fixed}, // apploader needs OSReport-like function
+    {"BootSnapshot",                 HLE_Misc::BootSnapshotEntryPoint,      HookType::Start,   HookFlag::Fixed}, // installed at the game's entry point by BootSnapshot::Arm()
 }};
 // clang-format on
 
@@ -179,6 +188,8 @@ void ExecuteFromJIT(u32 current_pc, u32 hook_index, Core::System& system)
 {
   ASSERT(Core::IsCPUThread());
   Core::CPUThreadGuard guard(system);
+  // The JIT doesn't keep pc up to date within a block.
+  system.GetPPCState().pc = current_pc;
   Execute(guard, current_pc, hook_index);
 }
 
@@ -234,6 +245,9 @@ TryReplaceFunctionResult TryReplaceFunction(PPCSymbolDB& ppc_symbol_db, u32 addr
 
 bool IsEnabled(HookFlag flag, PowerPC::CoreMode mode)
 {
+  if (flag == HLE::HookFlag::SDK)
+    return Config::Get(Config::MAIN_HLE_SDK_FUNCTIONS);
+
   return flag != HLE::HookFlag::Debug || Config::IsDebuggingEnabled() ||
          mode == PowerPC::CoreMode::Interpreter;
 }
@@ -36,6 +36,7 @@ enum class HookFlag
   Generic,  // Miscellaneous function
   Debug,    // Debug output function
   Fixed,    // An arbitrary hook mapped to a fixed address instead of a symbol
+  SDK,      // Native replacement for an SDK function, only used if HLESDKFunctions is enabled
 };
 
 struct Hook
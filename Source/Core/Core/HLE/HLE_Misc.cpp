@@ -5,6 +5,7 @@
 
 #include "Common/Common.h"
 #include "Common/CommonTypes.h"
+#include "Core/Boot/BootSnapshot.h"
 #include "Core/Core.h"
 #include "Core/GeckoCode.h"
 #include "Core/HW/CPU.h"
@@ -79,4 +80,9 @@ void GeckoReturnTrampoline(const Core::CPUThreadGuard& guard)
                             PowerPC::MMU::HostRead_U64(guard, SP + 24 + (2 * i + 1) * sizeof(u64)));
   }
 }
+
+void BootSnapshotEntryPoint(const Core::CPUThreadGuard& guard)
+{
+  BootSnapshot::OnEntryPointReached(guard);
+}
 }  // namespace HLE_Misc
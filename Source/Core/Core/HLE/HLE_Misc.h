@@ -14,4 +14,5 @@ void UnimplementedFunction(const Core::CPUThreadGuard& guard);
 void HBReload(const Core::CPUThreadGuard& guard);
 void GeckoCodeHandlerICacheFlush(const Core::CPUThreadGuard& guard);
 void GeckoReturnTrampoline(const Core::CPUThreadGuard& guard);
+void BootSnapshotEntryPoint(const Core::CPUThreadGuard& guard);
 }  // namespace HLE_Misc
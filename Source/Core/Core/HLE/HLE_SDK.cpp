@@ -0,0 +1,160 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HLE/HLE_SDK.h"
+
+#include <cstring>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/PowerPC/SignatureDB/SignatureDB.h"
+#include "Core/System.h"
+
+namespace HLE_SDK
+{
+namespace
+{
+// Runs the first instruction of the hooked function and continues with the rest of it. Hooks only
+// trigger at the start of a function, so the original code then runs as if it wasn't hooked.
+void RunOriginalFunction(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+
+  ppc_state.npc = ppc_state.pc + sizeof(UGeckoInstruction);
+  const u32 opcode = system.GetMMU().Read_Opcode(ppc_state.pc);
+  if (opcode != 0)
+    Interpreter::RunInterpreterOp(system.GetInterpreter(), UGeckoInstruction{opcode});
+
+  constexpr u32 SYNCHRONOUS_EXCEPTIONS =
+      EXCEPTION_ISI | EXCEPTION_DSI | EXCEPTION_PROGRAM | EXCEPTION_ALIGNMENT;
+  if ((ppc_state.Exceptions & SYNCHRONOUS_EXCEPTIONS) != 0)
+    system.GetPowerPC().CheckExceptions();
+}
+
+// Applies the effect of running dcbf, dcbi or dcbst on every cache line in the range, when the
+// data cache isn't emulated. Returns false if the call has to run the original function.
+bool InvalidateRangeForDataCacheOp(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  if (ppc_state.m_enable_dcache)
+    return false;
+
+  const u32 address = ppc_state.gpr[3];
+  const u32 size = ppc_state.gpr[4];
+  if (size != 0)
+  {
+    // Like the instructions, this only touches the JIT cache, to compensate for the lack of precise
+    // L1 icache emulation.
+    const u32 lines = static_cast<u32>((u64(size) + (address & 31) + 31) / 32);
+    system.GetJitInterface().InvalidateICacheLines(address & ~31, lines);
+  }
+
+  ppc_state.npc = LR(ppc_state);
+  return true;
+}
+}  // namespace
+
+bool IdentifyFunctions(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_symbol_db = system.GetPPCSymbolDB();
+
+  SignatureDB db(SignatureDB::HandlerType::DSY);
+  if (!db.Load(File::GetSysDirectory() + TOTALDB))
+  {
+    WARN_LOG_FMT(OSHLE, "Failed to load {}, SDK functions won't be replaced", TOTALDB);
+    return false;
+  }
+
+  PPCAnalyst::FindFunctions(guard, Memory::MEM1_BASE_ADDR,
+                            Memory::MEM1_BASE_ADDR + system.GetMemory().GetRamSizeReal(),
+                            &ppc_symbol_db);
+  db.Apply(guard, &ppc_symbol_db);
+  return !ppc_symbol_db.IsEmpty();
+}
+
+// The SDK's memcpy is safe to use with overlapping ranges, so this needs memmove's semantics.
+void HLE_memcpy(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  auto& mmu = system.GetMMU();
+
+  const u32 dest = ppc_state.gpr[3];
+  const u32 src = ppc_state.gpr[4];
+  const u32 size = ppc_state.gpr[5];
+  if (size != 0)
+  {
+    u8* const host_dest = mmu.GetOptimizableRAMPointer(dest, size);
+    const u8* const host_src = mmu.GetOptimizableRAMPointer(src, size);
+    if (!host_dest || !host_src)
+    {
+      RunOriginalFunction(guard);
+      return;
+    }
+
+    std::memmove(host_dest, host_src, size);
+  }
+
+  // r3 already holds the return value, which is dest.
+  ppc_state.npc = LR(ppc_state);
+}
+
+void HLE_memset(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  auto& mmu = system.GetMMU();
+
+  const u32 dest = ppc_state.gpr[3];
+  const u8 value = static_cast<u8>(ppc_state.gpr[4]);
+  const u32 size = ppc_state.gpr[5];
+  if (size != 0)
+  {
+    u8* const host_dest = mmu.GetOptimizableRAMPointer(dest, size);
+    if (!host_dest)
+    {
+      RunOriginalFunction(guard);
+      return;
+    }
+
+    std::memset(host_dest, value, size);
+  }
+
+  ppc_state.npc = LR(ppc_state);
+}
+
+// The SDK versions of these end with a sc to synchronize the caches, which doesn't have any other
+// effect without data cache emulation, so it's skipped.
+void HLE_DCFlushRange(const Core::CPUThreadGuard& guard)
+{
+  if (!InvalidateRangeForDataCacheOp(guard))
+    RunOriginalFunction(guard);
+}
+
+void HLE_DCInvalidateRange(const Core::CPUThreadGuard& guard)
+{
+  // dcbi is privileged, so let the original code raise the exception.
+  if (guard.GetSystem().GetPPCState().msr.PR || !InvalidateRangeForDataCacheOp(guard))
+    RunOriginalFunction(guard);
+}
+
+void HLE_DCStoreRange(const Core::CPUThreadGuard& guard)
+{
+  if (!InvalidateRangeForDataCacheOp(guard))
+    RunOriginalFunction(guard);
+}
+}  // namespace HLE_SDK
@@ -0,0 +1,24 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+namespace Core
+{
+class CPUThreadGuard;
+}
+
+// Native replacements for hot SDK routines. Each one falls back to running the original function
+// when the call can't be handled natively, e.g. because its range isn't plain RAM.
+namespace HLE_SDK
+{
+// Names the functions in MEM1 using the bundled signature database, so that the SDK functions can
+// be hooked when the game has no symbol map. Returns true if any symbols were added.
+bool IdentifyFunctions(const Core::CPUThreadGuard& guard);
+
+void HLE_memcpy(const Core::CPUThreadGuard& guard);
+void HLE_memset(const Core::CPUThreadGuard& guard);
+void HLE_DCFlushRange(const Core::CPUThreadGuard& guard);
+void HLE_DCInvalidateRange(const Core::CPUThreadGuard& guard);
+void HLE_DCStoreRange(const Core::CPUThreadGuard& guard);
+}  // namespace HLE_SDK
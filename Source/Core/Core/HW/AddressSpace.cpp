@@ -75,6 +75,17 @@ std::optional<u32> Accessors::Search(const Core::CPUThreadGuard& guard, u32 hays
   return std::nullopt;
 }
 
+bool Accessors::SupportsUnsynchronizedReads() const
+{
+  return false;
+}
+
+bool Accessors::CopyFromEmuUnsynchronized(Core::System& system, u32 address, void* data,
+                                          std::size_t size) const
+{
+  return false;
+}
+
 Accessors::~Accessors()
 {
 }
@@ -85,6 +96,13 @@ struct EffectiveAddressSpaceAccessors : Accessors
   {
     return PowerPC::MMU::HostIsRAMAddress(guard, address);
   }
+  bool SupportsUnsynchronizedReads() const override { return true; }
+  bool CopyFromEmuUnsynchronized(Core::System& system, u32 address, void* data,
+                                 std::size_t size) const override
+  {
+    return system.GetMemory().CopyFromEmuUnsynchronized(data, address, size,
+                                                        PowerPC::RequestedAddressSpace::Effective);
+  }
   u8 ReadU8(const Core::CPUThreadGuard& guard, u32 address) const override
   {
     return PowerPC::MMU::HostRead_U8(guard, address);
@@ -326,6 +344,22 @@ struct CompositeAddressSpaceAccessors : Accessors
     return std::nullopt;
   }
 
+  bool SupportsUnsynchronizedReads() const override
+  {
+    return std::ranges::all_of(m_accessor_mappings, [](const AccessorMapping& mapping) {
+      return mapping.accessors->SupportsUnsynchronizedReads();
+    });
+  }
+
+  bool CopyFromEmuUnsynchronized(Core::System& system, u32 address, void* data,
+                                 std::size_t size) const override
+  {
+    return std::ranges::any_of(m_accessor_mappings, [&](const AccessorMapping& mapping) {
+      return address >= mapping.base && mapping.accessors->CopyFromEmuUnsynchronized(
+                                            system, address - mapping.base, data, size);
+    });
+  }
+
 private:
   std::vector<AccessorMapping> m_accessor_mappings;
   std::vector<AccessorMapping>::iterator FindAppropriateAccessor(const Core::CPUThreadGuard& guard,
@@ -347,12 +381,27 @@ private:
 struct SmallBlockAccessors : Accessors
 {
   SmallBlockAccessors() = default;
-  SmallBlockAccessors(u8** alloc_base_, u32 size_) : alloc_base{alloc_base_}, size{size_} {}
+  SmallBlockAccessors(u8** alloc_base_, u32 size_,
+                      std::optional<u32> physical_address_ = std::nullopt)
+      : alloc_base{alloc_base_}, size{size_}, physical_address{physical_address_}
+  {
+  }
 
   bool IsValidAddress(const Core::CPUThreadGuard& guard, u32 address) const override
   {
     return (*alloc_base != nullptr) && (address < size);
   }
+
+  bool SupportsUnsynchronizedReads() const override { return physical_address.has_value(); }
+  bool CopyFromEmuUnsynchronized(Core::System& system, u32 address, void* data,
+                                 std::size_t size_to_copy) const override
+  {
+    if (!physical_address || address >= size || size_to_copy > size - address)
+      return false;
+
+    return system.GetMemory().CopyFromEmuUnsynchronized(
+        data, *physical_address + address, size_to_copy, PowerPC::RequestedAddressSpace::Physical);
+  }
   u8 ReadU8(const Core::CPUThreadGuard& guard, u32 address) const override
   {
     return (*alloc_base)[address];
@@ -406,6 +455,7 @@ struct SmallBlockAccessors : Accessors
 private:
   u8** alloc_base = nullptr;
   u32 size = 0;
+  std::optional<u32> physical_address;
 };
 
 struct NullAccessors : Accessors
@@ -473,8 +523,8 @@ void Init()
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
 
-  s_mem1_address_space_accessors = {&memory.GetRAM(), memory.GetRamSizeReal()};
-  s_mem2_address_space_accessors = {&memory.GetEXRAM(), memory.GetExRamSizeReal()};
+  s_mem1_address_space_accessors = {&memory.GetRAM(), memory.GetRamSizeReal(), 0x00000000};
+  s_mem2_address_space_accessors = {&memory.GetEXRAM(), memory.GetExRamSizeReal(), 0x10000000};
   s_fake_address_space_accessors = {&memory.GetFakeVMEM(), memory.GetFakeVMemSize()};
   s_physical_address_space_accessors_gcn = {{0x00000000, &s_mem1_address_space_accessors}};
   s_physical_address_space_accessors_wii = {{0x00000000, &s_mem1_address_space_accessors},
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <optional>
 
 #include "Common/CommonTypes.h"
@@ -10,6 +11,7 @@
 namespace Core
 {
 class CPUThreadGuard;
+class System;
 }
 
 namespace AddressSpace
@@ -47,6 +49,12 @@ struct Accessors
   virtual std::optional<u32> Search(const Core::CPUThreadGuard& guard, u32 haystack_offset,
                                     const u8* needle_start, std::size_t needle_size,
                                     bool forward) const;
+
+  // Address spaces backed by MEM1 and MEM2 can be read without pausing the CPU thread, see
+  // Memory::MemoryManager::CopyFromEmuUnsynchronized. The values read this way may be torn.
+  virtual bool SupportsUnsynchronizedReads() const;
+  virtual bool CopyFromEmuUnsynchronized(Core::System& system, u32 address, void* data,
+                                         std::size_t size) const;
   virtual ~Accessors();
 };
 
@@ -0,0 +1,295 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+
+#if defined(_M_X86_64)
+#include <immintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+#if defined(_M_X86_64) && (defined(__GNUC__) || defined(__clang__)) && !defined(__AVX2__)
+#define ATTR_TARGET_AVX2 [[gnu::target("avx2")]]
+#else
+#define ATTR_TARGET_AVX2
+#endif
+
+namespace DSP::HLE::AXMix
+{
+namespace
+{
+s16 ClampS16(s32 sample)
+{
+  return std::clamp<s32>(sample, -0x8000, 0x7FFF);
+}
+
+template <bool SignedVolume>
+s16 ScaleSample(s16 sample, u16 volume)
+{
+  const s32 factor = SignedVolume ? s32(s16(volume)) : s32(volume);
+  return ClampS16((s32(sample) * factor) >> 15);
+}
+
+// Returns the volumes used for the next N samples.
+template <size_t N>
+std::array<u16, N> GetVolumeRamp(u16 volume, u16 volume_delta)
+{
+  std::array<u16, N> volumes;
+  for (size_t i = 0; i < N; ++i)
+    volumes[i] = static_cast<u16>(volume + i * volume_delta);
+  return volumes;
+}
+
+// The vector kernels below process as many samples as fit in whole vectors, update volume
+// accordingly and return the number of processed samples. The caller handles the rest.
+
+#if defined(_M_X86_64)
+template <bool SignedVolume>
+__m128i ScaleSamples(__m128i samples, __m128i volumes)
+{
+  const __m128i lo = _mm_mullo_epi16(samples, volumes);
+  __m128i hi = _mm_mulhi_epi16(samples, volumes);
+  if constexpr (!SignedVolume)
+  {
+    // mulhi treats volumes of 0x8000 and above as negative, which makes the product
+    // samples * 0x10000 too small. Add that back to the high half.
+    hi = _mm_add_epi16(hi, _mm_and_si128(samples, _mm_srai_epi16(volumes, 15)));
+  }
+  const __m128i product0 = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+  const __m128i product1 = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+  // The saturating pack clamps the results to s16.
+  return _mm_packs_epi32(product0, product1);
+}
+
+template <bool SignedVolume>
+ATTR_TARGET_AVX2 __m256i ScaleSamples(__m256i samples, __m256i volumes)
+{
+  const __m256i lo = _mm256_mullo_epi16(samples, volumes);
+  __m256i hi = _mm256_mulhi_epi16(samples, volumes);
+  if constexpr (!SignedVolume)
+    hi = _mm256_add_epi16(hi, _mm256_and_si256(samples, _mm256_srai_epi16(volumes, 15)));
+  // Unpacking and packing both operate within 128-bit lanes, so the sample order is preserved.
+  const __m256i product0 = _mm256_srai_epi32(_mm256_unpacklo_epi16(lo, hi), 15);
+  const __m256i product1 = _mm256_srai_epi32(_mm256_unpackhi_epi16(lo, hi), 15);
+  return _mm256_packs_epi32(product0, product1);
+}
+
+template <bool SignedVolume>
+u32 ApplyVolumeSSE2(s16* samples, u32 count, u16& volume, u16 volume_delta)
+{
+  const auto ramp = GetVolumeRamp<8>(volume, volume_delta);
+  __m128i volumes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ramp.data()));
+  const __m128i step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+
+  u32 i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    auto* const ptr = reinterpret_cast<__m128i*>(samples + i);
+    _mm_storeu_si128(ptr, ScaleSamples<SignedVolume>(_mm_loadu_si128(ptr), volumes));
+    volumes = _mm_add_epi16(volumes, step);
+  }
+
+  volume = static_cast<u16>(volume + i * volume_delta);
+  return i;
+}
+
+template <bool SignedVolume>
+ATTR_TARGET_AVX2 u32 ApplyVolumeAVX2(s16* samples, u32 count, u16& volume, u16 volume_delta)
+{
+  const auto ramp = GetVolumeRamp<16>(volume, volume_delta);
+  __m256i volumes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ramp.data()));
+  const __m256i step = _mm256_set1_epi16(static_cast<s16>(volume_delta * 16));
+
+  u32 i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    auto* const ptr = reinterpret_cast<__m256i*>(samples + i);
+    _mm256_storeu_si256(ptr, ScaleSamples<SignedVolume>(_mm256_loadu_si256(ptr), volumes));
+    volumes = _mm256_add_epi16(volumes, step);
+  }
+
+  volume = static_cast<u16>(volume + i * volume_delta);
+  return i;
+}
+
+u32 MixAddSSE2(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+               s16* last_sample)
+{
+  const auto ramp = GetVolumeRamp<8>(volume, volume_delta);
+  __m128i volumes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ramp.data()));
+  const __m128i step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+
+  u32 i = 0;
+  __m128i mixed = _mm_setzero_si128();
+  for (; i + 8 <= count; i += 8)
+  {
+    mixed = ScaleSamples<false>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)),
+                                volumes);
+    volumes = _mm_add_epi16(volumes, step);
+
+    // Sign extend to 32 bits.
+    const __m128i mixed0 = _mm_srai_epi32(_mm_unpacklo_epi16(mixed, mixed), 16);
+    const __m128i mixed1 = _mm_srai_epi32(_mm_unpackhi_epi16(mixed, mixed), 16);
+    auto* const out0 = reinterpret_cast<__m128i*>(out + i);
+    auto* const out1 = reinterpret_cast<__m128i*>(out + i + 4);
+    _mm_storeu_si128(out0, _mm_add_epi32(_mm_loadu_si128(out0), mixed0));
+    _mm_storeu_si128(out1, _mm_add_epi32(_mm_loadu_si128(out1), mixed1));
+  }
+
+  if (i != 0)
+    *last_sample = static_cast<s16>(_mm_extract_epi16(mixed, 7));
+  volume = static_cast<u16>(volume + i * volume_delta);
+  return i;
+}
+
+ATTR_TARGET_AVX2 u32 MixAddAVX2(int* out, const s16* input, u32 count, u16& volume,
+                                u16 volume_delta, s16* last_sample)
+{
+  const auto ramp = GetVolumeRamp<16>(volume, volume_delta);
+  __m256i volumes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ramp.data()));
+  const __m256i step = _mm256_set1_epi16(static_cast<s16>(volume_delta * 16));
+
+  u32 i = 0;
+  __m256i mixed = _mm256_setzero_si256();
+  for (; i + 16 <= count; i += 16)
+  {
+    mixed = ScaleSamples<false>(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)), volumes);
+    volumes = _mm256_add_epi16(volumes, step);
+
+    const __m256i mixed0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(mixed));
+    const __m256i mixed1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mixed, 1));
+    auto* const out0 = reinterpret_cast<__m256i*>(out + i);
+    auto* const out1 = reinterpret_cast<__m256i*>(out + i + 8);
+    _mm256_storeu_si256(out0, _mm256_add_epi32(_mm256_loadu_si256(out0), mixed0));
+    _mm256_storeu_si256(out1, _mm256_add_epi32(_mm256_loadu_si256(out1), mixed1));
+  }
+
+  if (i != 0)
+    *last_sample = static_cast<s16>(_mm256_extract_epi16(mixed, 15));
+  volume = static_cast<u16>(volume + i * volume_delta);
+  return i;
+}
+#elif defined(_M_ARM_64)
+template <bool SignedVolume>
+int16x8_t ScaleSamples(int16x8_t samples, uint16x8_t volumes)
+{
+  int32x4_t factor0, factor1;
+  if constexpr (SignedVolume)
+  {
+    factor0 = vmovl_s16(vget_low_s16(vreinterpretq_s16_u16(volumes)));
+    factor1 = vmovl_high_s16(vreinterpretq_s16_u16(volumes));
+  }
+  else
+  {
+    factor0 = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(volumes)));
+    factor1 = vreinterpretq_s32_u32(vmovl_high_u16(volumes));
+  }
+  const int32x4_t product0 = vshrq_n_s32(vmulq_s32(vmovl_s16(vget_low_s16(samples)), factor0), 15);
+  const int32x4_t product1 = vshrq_n_s32(vmulq_s32(vmovl_high_s16(samples), factor1), 15);
+  // The saturating narrow clamps the results to s16.
+  return vqmovn_high_s32(vqmovn_s32(product0), product1);
+}
+
+template <bool SignedVolume>
+u32 ApplyVolumeNEON(s16* samples, u32 count, u16& volume, u16 volume_delta)
+{
+  const auto ramp = GetVolumeRamp<8>(volume, volume_delta);
+  uint16x8_t volumes = vld1q_u16(ramp.data());
+  const uint16x8_t step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+
+  u32 i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    vst1q_s16(samples + i, ScaleSamples<SignedVolume>(vld1q_s16(samples + i), volumes));
+    volumes = vaddq_u16(volumes, step);
+  }
+
+  volume = static_cast<u16>(volume + i * volume_delta);
+  return i;
+}
+
+u32 MixAddNEON(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+               s16* last_sample)
+{
+  const auto ramp = GetVolumeRamp<8>(volume, volume_delta);
+  uint16x8_t volumes = vld1q_u16(ramp.data());
+  const uint16x8_t step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+
+  u32 i = 0;
+  int16x8_t mixed = vdupq_n_s16(0);
+  for (; i + 8 <= count; i += 8)
+  {
+    mixed = ScaleSamples<false>(vld1q_s16(input + i), volumes);
+    volumes = vaddq_u16(volumes, step);
+
+    vst1q_s32(out + i, vaddw_s16(vld1q_s32(out + i), vget_low_s16(mixed)));
+    vst1q_s32(out + i + 4, vaddw_high_s16(vld1q_s32(out + i + 4), mixed));
+  }
+
+  if (i != 0)
+    *last_sample = vgetq_lane_s16(mixed, 7);
+  volume = static_cast<u16>(volume + i * volume_delta);
+  return i;
+}
+#endif
+
+template <bool SignedVolume>
+void ApplyVolumeImpl(s16* samples, u32 count, u16& volume, u16 volume_delta)
+{
+  u32 i = 0;
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    i = ApplyVolumeAVX2<SignedVolume>(samples, count, volume, volume_delta);
+  else
+    i = ApplyVolumeSSE2<SignedVolume>(samples, count, volume, volume_delta);
+#elif defined(_M_ARM_64)
+  i = ApplyVolumeNEON<SignedVolume>(samples, count, volume, volume_delta);
+#endif
+
+  for (; i < count; ++i)
+  {
+    samples[i] = ScaleSample<SignedVolume>(samples[i], volume);
+    volume += volume_delta;
+  }
+}
+}  // namespace
+
+void ApplyVolume(s16* samples, u32 count, u16& volume, u16 volume_delta, bool signed_volume)
+{
+  if (signed_volume)
+    ApplyVolumeImpl<true>(samples, count, volume, volume_delta);
+  else
+    ApplyVolumeImpl<false>(samples, count, volume, volume_delta);
+}
+
+void MixAdd(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+            s16* last_sample)
+{
+  u32 i = 0;
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    i = MixAddAVX2(out, input, count, volume, volume_delta, last_sample);
+  else
+    i = MixAddSSE2(out, input, count, volume, volume_delta, last_sample);
+#elif defined(_M_ARM_64)
+  i = MixAddNEON(out, input, count, volume, volume_delta, last_sample);
+#endif
+
+  for (; i < count; ++i)
+  {
+    const s16 sample = ScaleSample<false>(input[i], volume);
+    out[i] += sample;
+    volume += volume_delta;
+    *last_sample = sample;
+  }
+}
+}  // namespace DSP::HLE::AXMix
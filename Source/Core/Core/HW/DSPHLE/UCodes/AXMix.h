@@ -0,0 +1,25 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Per-sample voice mixing kernels shared by the GC and Wii versions of AX.
+//
+// These are vectorized where the host supports it, but always produce the exact same results as
+// a plain sample-by-sample loop, since audio output feeds back into emulated state and has to stay
+// deterministic across hosts (netplay, TAS movies).
+namespace DSP::HLE::AXMix
+{
+// Scales samples[i] by the volume for sample i, i.e. samples[i] = clamp((samples[i] * volume) >> 15)
+// where volume is incremented by volume_delta (modulo 2^16) after each sample. volume is treated as
+// a signed value if signed_volume is true, and as an unsigned value otherwise.
+void ApplyVolume(s16* samples, u32 count, u16& volume, u16 volume_delta, bool signed_volume);
+
+// Adds clamp((input[i] * volume) >> 15) to out[i], with volume being an unsigned value that is
+// incremented by volume_delta (modulo 2^16) after each sample. The last mixed sample is written
+// to *last_sample, which is left untouched if count is zero.
+void MixAdd(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+            s16* last_sample);
+}  // namespace DSP::HLE::AXMix
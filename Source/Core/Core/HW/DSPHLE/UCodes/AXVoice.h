@@ -12,6 +12,7 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <functional>
 #include <memory>
@@ -21,6 +22,7 @@
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -187,12 +189,12 @@ void AcceleratorSetup(HLEAccelerator* accelerator, PB_TYPE* pb)
   accelerator->SetPredScale(pb->adpcm.pred_scale);
 }
 
-// Reads a sample from the accelerator. Also handles looping and
+// Reads samples from the accelerator. Also handles looping and
 // disabling streams that reached the end (this is done by an exception raised
 // by the accelerator on real hardware).
-u16 AcceleratorGetSample(HLEAccelerator* accelerator)
+void AcceleratorGetSamples(HLEAccelerator* accelerator, s16* samples, u32 count)
 {
-  return accelerator->ReadSample(accelerator->acc_pb->adpcm.coefs);
+  accelerator->ReadSamples(accelerator->acc_pb->adpcm.coefs, samples, count);
 }
 
 // Reads samples from the input callback, resamples them to <count> samples at
@@ -336,9 +338,38 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  // The resampler doesn't touch the accelerator, so the input samples can be decoded in blocks
+  // instead of one at a time, as long as exactly as many are decoded as the resampler consumes.
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  u32 remaining = count;
+  if (pb.src_type == SRCTYPE_LINEAR || pb.src_type == SRCTYPE_POLYPHASE)
+  {
+    remaining = 0;
+    u32 pos = pb.src.cur_addr_frac;
+    for (u32 i = 0; i < count; ++i)
+    {
+      pos += ratio;
+      remaining += pos >> 16;
+      pos &= 0xFFFF;
+    }
+  }
+
+  std::array<s16, 64> input;
+  u32 input_pos = 0;
+  u32 input_size = 0;
+  const auto read_input = [&](u32) {
+    if (input_pos == input_size)
+    {
+      input_size = std::min<u32>(remaining, static_cast<u32>(input.size()));
+      remaining -= input_size;
+      AcceleratorGetSamples(accelerator, input.data(), input_size);
+      input_pos = 0;
+    }
+    return input[input_pos++];
+  };
+  u32 curr_pos = ResampleAudio(read_input, samples, count, pb.src.last_samples,
+                               pb.src.cur_addr_frac, ratio, pb.src_type, coeffs);
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -357,27 +388,12 @@ s16 ClampS16(s64 sample)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
   // If volume ramping is disabled, set volume_delta to 0. That way, the
   // mixing loop can avoid testing if volume ramping is enabled at each step,
   // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    s16 sample16 = ClampS16((s32)sample);
-
-    out[i] += sample16;
-    volume += volume_delta;
+  const u16 volume_delta = ramp ? vd->volume_delta : 0;
 
-    *dpop = sample16;
-  }
+  AXMix::MixAdd(out, input, count, vd->volume, volume_delta, dpop);
 }
 
 // Execute a low pass filter on the samples using one history value.
@@ -430,19 +446,17 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   GetInputSamples(accelerator, pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+  // signed on GameCube
+  constexpr bool signed_volume = true;
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+  // unsigned on Wii
+  constexpr bool signed_volume = false;
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = ClampS16(sample);
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  u16 volume = static_cast<u16>(pb.vol_env.cur_volume);
+  AXMix::ApplyVolume(samples, count, volume, static_cast<u16>(pb.vol_env.cur_volume_delta),
+                     signed_volume);
+  pb.vol_env.cur_volume = static_cast<s16>(volume);
 
   // Optionally, execute a low-pass and/or biquad filter.
   if (pb.lpf.on != 0)
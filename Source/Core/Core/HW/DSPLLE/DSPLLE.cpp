@@ -30,6 +30,11 @@
 
 namespace DSP::LLE
 {
+// How many updates worth of cycles the DSP thread may fall behind the CPU thread
+constexpr u32 MAX_PENDING_UPDATES = 4;
+// How often a thread checks for work before going to sleep
+constexpr int SPIN_COUNT = 1000;
+
 DSPLLE::DSPLLE() = default;
 
 DSPLLE::~DSPLLE()
@@ -58,9 +63,11 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 {
   Common::SetCurrentThreadName("DSP thread");
 
+  int spins = 0;
   while (dsp_lle->m_is_running.IsSet())
   {
-    const int cycles = static_cast<int>(dsp_lle->m_cycle_count.load());
+    const u32 cycles = dsp_lle->m_cycle_count.load();
+    bool is_locked = false;
     if (cycles > 0)
     {
       std::unique_lock dsp_thread_lock(dsp_lle->m_dsp_thread_mutex, std::try_to_lock);
@@ -68,22 +75,60 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
       {
         if (dsp_lle->m_dsp_core.IsJITCreated())
         {
-          dsp_lle->m_dsp_core.RunCycles(cycles);
+          dsp_lle->m_dsp_core.RunCycles(static_cast<int>(cycles));
         }
         else
         {
-          dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(cycles);
+          dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(static_cast<int>(cycles));
         }
-        dsp_lle->m_cycle_count.store(0);
+        // The CPU thread may have added more cycles in the meantime
+        dsp_lle->m_cycle_count.fetch_sub(cycles);
+        if (dsp_lle->m_ppc_waiting.load())
+          dsp_lle->m_ppc_event.Set();
+        spins = 0;
         continue;
       }
+      // Paused, PauseAndLock wakes us up when unlocking
+      is_locked = true;
     }
 
-    dsp_lle->m_ppc_event.Set();
-    dsp_lle->m_dsp_event.Wait();
+    if (!is_locked && spins < SPIN_COUNT)
+    {
+      ++spins;
+      Common::YieldCPU();
+      continue;
+    }
+
+    dsp_lle->m_dsp_thread_parked.store(true);
+    if (is_locked || dsp_lle->m_cycle_count.load() == 0)
+      dsp_lle->m_dsp_event.Wait();
+    dsp_lle->m_dsp_thread_parked.store(false);
+    spins = 0;
   }
 }
 
+void DSPLLE::WakeDSPThread()
+{
+  if (m_dsp_thread_parked.load())
+    m_dsp_event.Set();
+}
+
+void DSPLLE::WaitForDSPThread(u32 max_cycle_count)
+{
+  // The DSP thread is usually almost done, so spin for a bit before going to sleep
+  for (int i = 0; i < SPIN_COUNT; ++i)
+  {
+    if (m_cycle_count.load() <= max_cycle_count)
+      return;
+    Common::YieldCPU();
+  }
+
+  m_ppc_waiting.store(true);
+  while (m_cycle_count.load() > max_cycle_count && m_is_running.IsSet())
+    m_ppc_event.Wait();
+  m_ppc_waiting.store(false);
+}
+
 static bool LoadDSPRom(u16* rom, const std::string& filename, u32 size_in_bytes)
 {
   std::string bytes;
@@ -120,7 +165,7 @@ static bool FillDSPInitOptions(DSPInitOptions* opts)
     return false;
 
   opts->core_type = DSPInitOptions::CoreType::Interpreter;
-#ifdef _M_X86_64
+#if defined(_M_X86_64) || defined(_M_ARM_64)
   if (Config::Get(Config::MAIN_DSP_JIT))
     opts->core_type = DSPInitOptions::CoreType::JIT64;
 #endif
@@ -157,6 +202,7 @@ bool DSPLLE::Initialize(bool wii, bool dsp_thread)
 
   if (dsp_thread)
   {
+    m_cycle_count.store(0);
     m_is_running.Set(true);
     m_dsp_thread = std::thread(DSPThread, this);
   }
@@ -275,10 +321,12 @@ void DSPLLE::DSP_Update(int cycles)
   }
   else
   {
-    // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
-    m_ppc_event.Wait();
-    m_cycle_count.fetch_add(dsp_cycles);
-    m_dsp_event.Set();
+    // Hand the cycles over without waiting, unless the DSP thread has fallen too far behind
+    const u32 cycle_count = m_cycle_count.fetch_add(dsp_cycles) + dsp_cycles;
+    WakeDSPThread();
+    const u32 max_cycle_count = MAX_PENDING_UPDATES * static_cast<u32>(dsp_cycles);
+    if (cycle_count > max_cycle_count)
+      WaitForDSPThread(max_cycle_count);
   }
 }
 
@@ -300,7 +348,6 @@ void DSPLLE::PauseAndLock(bool do_lock)
     if (m_is_dsp_on_thread)
     {
       // Signal the DSP thread so it can perform any outstanding work now (if any)
-      m_ppc_event.Wait();
       m_dsp_event.Set();
     }
   }
@@ -40,16 +40,22 @@ public:
 
 private:
   static void DSPThread(DSPLLE* dsp_lle);
+  void WakeDSPThread();
+  void WaitForDSPThread(u32 max_cycle_count);
 
   DSPCore m_dsp_core;
   std::thread m_dsp_thread;
   std::mutex m_dsp_thread_mutex;
   bool m_is_dsp_on_thread = false;
   Common::Flag m_is_running;
+  // Cycles the CPU thread has handed to the DSP thread which it hasn't run yet
   std::atomic<u32> m_cycle_count{};
 
+  // Each side only signals its event when the other side has said it is going to wait on it
   Common::Event m_dsp_event;
   Common::Event m_ppc_event;
+  std::atomic<bool> m_dsp_thread_parked{};
+  std::atomic<bool> m_ppc_waiting{};
   bool m_request_disable_thread = false;
 };
 }  // namespace DSP::LLE
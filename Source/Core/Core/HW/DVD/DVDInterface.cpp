@@ -131,20 +131,10 @@ size_t DVDInterface::ProcessDTKSamples(s16* target_samples, size_t target_block_
 {
   const size_t block_count_to_process =
       std::min(target_block_count, audio_data.size() / StreamADPCM::ONE_BLOCK_SIZE);
-  size_t samples_processed = 0;
-  size_t bytes_processed = 0;
   for (size_t i = 0; i < block_count_to_process; ++i)
   {
-    m_adpcm_decoder.DecodeBlock(&target_samples[samples_processed * 2],
-                                &audio_data[bytes_processed]);
-    for (size_t j = 0; j < StreamADPCM::SAMPLES_PER_BLOCK * 2; ++j)
-    {
-      // TODO: Fix the mixer so it can accept non-byte-swapped samples.
-      s16* sample = &target_samples[samples_processed * 2 + j];
-      *sample = Common::swap16(*sample);
-    }
-    samples_processed += StreamADPCM::SAMPLES_PER_BLOCK;
-    bytes_processed += StreamADPCM::ONE_BLOCK_SIZE;
+    m_adpcm_decoder.DecodeBlock(&target_samples[i * StreamADPCM::SAMPLES_PER_BLOCK * 2],
+                                &audio_data[i * StreamADPCM::ONE_BLOCK_SIZE]);
   }
   return block_count_to_process;
 }
@@ -198,10 +188,12 @@ void DVDInterface::DTKStreamingCallback(DIInterruptType interrupt_type,
 
   // Determine which audio data to read next.
 
-  // 3.5 ms of samples
-  constexpr u32 MAX_POSSIBLE_BLOCKS = 6;
+  // 14 ms of samples. Each batch costs an event and a DVDThread read, so the batches are much
+  // larger than what the drive would read at a time. This doesn't affect what the game sees, since
+  // the reported stream position only has a granularity of 32 KiB (1024 blocks).
+  constexpr u32 MAX_POSSIBLE_BLOCKS = 24;
   constexpr u32 MAX_POSSIBLE_SAMPLES = MAX_POSSIBLE_BLOCKS * StreamADPCM::SAMPLES_PER_BLOCK;
-  const u32 maximum_blocks = sample_rate == AudioInterface::SampleRate::AI32KHz ? 4 : 6;
+  const u32 maximum_blocks = sample_rate == AudioInterface::SampleRate::AI32KHz ? 16 : 24;
   u64 read_offset = 0;
   u32 read_length = 0;
 
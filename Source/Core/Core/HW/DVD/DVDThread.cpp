@@ -3,6 +3,7 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <optional>
@@ -15,6 +16,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
+#include "Common/Trace.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -55,6 +57,7 @@ void DVDThread::Stop()
 
   m_result_queue.Clear();
   m_result_map.clear();
+  ClearReadAheadCache();
 
   m_disc.reset();
 }
@@ -103,6 +106,7 @@ void DVDThread::DoState(PointerWrap& p)
 void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
+  ClearReadAheadCache();
   m_disc = std::move(disc);
 }
 
@@ -295,14 +299,111 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
 
 void DVDThread::ProcessReadRequest(ReadRequest&& request)
 {
+  TRACE_SCOPE("DVDThread::ProcessReadRequest");
   m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
   std::vector<u8> buffer(request.length);
-  if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+  if (!ReadFromCache(request, buffer.data()) &&
+      !m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+  {
     buffer.resize(0);
+  }
 
   request.realtime_done_us = Common::Timer::NowUs();
 
+  // Keep a copy of what's needed, since the request is moved into the result queue.
+  const ReadRequest request_copy = request;
   m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
+
+  // The result has already been handed over, so any time spent here is hidden behind the emulated
+  // completion delay of the request.
+  ReadAhead(request_copy);
+}
+
+const DVDThread::CachedRead* DVDThread::FindCachedRead(const DiscIO::Partition& partition,
+                                                       u64 dvd_offset, u32 length) const
+{
+  const auto it = std::ranges::find_if(m_read_ahead_cache, [&](const CachedRead& cached_read) {
+    return cached_read.partition == partition && dvd_offset >= cached_read.dvd_offset &&
+           dvd_offset + length <= cached_read.dvd_offset + cached_read.data.size();
+  });
+  return it != m_read_ahead_cache.end() ? &*it : nullptr;
+}
+
+bool DVDThread::ReadFromCache(const ReadRequest& request, u8* out_ptr) const
+{
+  const CachedRead* cached_read =
+      FindCachedRead(request.partition, request.dvd_offset, request.length);
+  if (!cached_read)
+    return false;
+
+  std::copy_n(cached_read->data.begin() + (request.dvd_offset - cached_read->dvd_offset),
+              request.length, out_ptr);
+  return true;
+}
+
+void DVDThread::ReadAhead(const ReadRequest& request)
+{
+  const bool same_partition = request.partition == m_last_read_partition;
+  const bool sequential =
+      same_partition && request.dvd_offset == m_last_read_offset + m_last_read_length;
+  const s64 stride = static_cast<s64>(request.dvd_offset - m_last_read_offset);
+  const bool strided = same_partition && !sequential && stride > 0 && stride == m_last_read_stride;
+
+  m_last_read_partition = request.partition;
+  m_last_read_offset = request.dvd_offset;
+  m_last_read_length = request.length;
+  m_last_read_stride = stride;
+
+  if ((!sequential && !strided) || request.length == 0)
+    return;
+
+  // Predict the next request and read it unless it's already in the cache. For sequential reads,
+  // a larger window is read, and it's extended once less than half of it is left, so that a
+  // steady stream of reads never has to wait for the disc.
+  u64 offset = request.dvd_offset + (sequential ? request.length : stride);
+  u32 length;
+  if (sequential)
+  {
+    length = std::max(request.length, SEQUENTIAL_READ_AHEAD_SIZE);
+    if (const CachedRead* cached_read = FindCachedRead(request.partition, offset, request.length))
+    {
+      const u64 cached_end = cached_read->dvd_offset + cached_read->data.size();
+      if (cached_end - offset >= length / 2)
+        return;
+      offset = cached_end;
+    }
+  }
+  else
+  {
+    length = request.length;
+    if (length > MAX_STRIDED_READ_AHEAD_SIZE || FindCachedRead(request.partition, offset, length))
+      return;
+  }
+
+  std::vector<u8> data(length);
+  if (!m_disc->Read(offset, length, data.data(), request.partition))
+  {
+    // Most likely the end of the disc or partition. If so, the emulated software will get a read
+    // error the normal way if it actually tries to read there.
+    return;
+  }
+
+  m_read_ahead_cache_size += data.size();
+  m_read_ahead_cache.push_back({request.partition, offset, std::move(data)});
+  while (m_read_ahead_cache_size > MAX_READ_AHEAD_CACHE_SIZE && m_read_ahead_cache.size() > 1)
+  {
+    m_read_ahead_cache_size -= m_read_ahead_cache.front().data.size();
+    m_read_ahead_cache.pop_front();
+  }
+}
+
+void DVDThread::ClearReadAheadCache()
+{
+  m_read_ahead_cache.clear();
+  m_read_ahead_cache_size = 0;
+  m_last_read_partition = {};
+  m_last_read_length = 0;
+  m_last_read_stride = 0;
 }
 }  // namespace DVD
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <deque>
 #include <map>
 #include <memory>
 #include <optional>
@@ -120,6 +121,34 @@ private:
 
   void ProcessReadRequest(ReadRequest&& read_request);
 
+  // Read-ahead. This only changes how fast the host gets the data, not when the emulated software
+  // is notified, so it has no effect on determinism.
+  struct CachedRead;
+  const CachedRead* FindCachedRead(const DiscIO::Partition& partition, u64 dvd_offset,
+                                   u32 length) const;
+  bool ReadFromCache(const ReadRequest& request, u8* out_ptr) const;
+  void ReadAhead(const ReadRequest& request);
+  void ClearReadAheadCache();
+
+  struct CachedRead
+  {
+    DiscIO::Partition partition{};
+    u64 dvd_offset = 0;
+    std::vector<u8> data;
+  };
+
+  static constexpr u32 SEQUENTIAL_READ_AHEAD_SIZE = 1024 * 1024;
+  static constexpr u32 MAX_STRIDED_READ_AHEAD_SIZE = 256 * 1024;
+  static constexpr size_t MAX_READ_AHEAD_CACHE_SIZE = 4 * 1024 * 1024;
+
+  // Only accessed by the DVD thread (or by the CPU thread while the DVD thread is idle)
+  std::deque<CachedRead> m_read_ahead_cache;
+  size_t m_read_ahead_cache_size = 0;
+  DiscIO::Partition m_last_read_partition{};
+  u64 m_last_read_offset = 0;
+  u32 m_last_read_length = 0;
+  s64 m_last_read_stride = 0;
+
   using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
   CoreTiming::EventType* m_finish_read = nullptr;
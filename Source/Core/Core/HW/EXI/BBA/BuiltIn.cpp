@@ -129,6 +129,11 @@ bool CEXIETHERNET::BuiltInBBAInterface::IsActivated()
 void CEXIETHERNET::BuiltInBBAInterface::WriteToQueue(const std::vector<u8>& data)
 {
   m_queue_data[m_queue_write] = data;
+  CommitQueueWrite();
+}
+
+void CEXIETHERNET::BuiltInBBAInterface::CommitQueueWrite()
+{
   const u8 next_write_index = (m_queue_write + 1) & 15;
   if (next_write_index != m_queue_read)
     m_queue_write = next_write_index;
@@ -164,29 +169,31 @@ void CEXIETHERNET::BuiltInBBAInterface::PollData(std::size_t* datasize)
       }
     }
 
-    // Check for connection data
-    if (*datasize == 0)
+    // Check for connection data. UDP sockets are drained, so that datagrams which arrived
+    // together don't each have to wait for another poll.
+    do
     {
-      // Send it to the network buffer if empty
-      const auto socket_data = TryGetDataFromSocket(&net_ref);
-      if (socket_data.has_value())
+      if (*datasize == 0)
       {
-        *datasize = socket_data->size();
-        std::memcpy(m_eth_ref->mRecvBuffer.get(), socket_data->data(), *datasize);
+        // Send it to the network buffer if empty
+        if (!TryGetDataFromSocket(&net_ref, &m_recv_packet))
+          break;
+        *datasize = m_recv_packet.size();
+        std::memcpy(m_eth_ref->mRecvBuffer.get(), m_recv_packet.data(), *datasize);
       }
-    }
-    else if (!WillQueueOverrun())
-    {
-      // Otherwise, enqueue it
-      const auto socket_data = TryGetDataFromSocket(&net_ref);
-      if (socket_data.has_value())
-        WriteToQueue(*socket_data);
-    }
-    else
-    {
-      WARN_LOG_FMT(SP1, "BBA queue might overrun, can't poll more data");
-      return;
-    }
+      else if (!WillQueueOverrun())
+      {
+        // Otherwise, enqueue it, building the frame in place
+        if (!TryGetDataFromSocket(&net_ref, &m_queue_data[m_queue_write]))
+          break;
+        CommitQueueWrite();
+      }
+      else
+      {
+        WARN_LOG_FMT(SP1, "BBA queue might overrun, can't poll more data");
+        return;
+      }
+    } while (net_ref.type == IPPROTO_UDP);
   }
 }
 
@@ -249,8 +256,8 @@ void CEXIETHERNET::BuiltInBBAInterface::HandleDHCP(const Common::UDPPacket& pack
   WriteToQueue(response.Build());
 }
 
-std::optional<std::vector<u8>>
-CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
+bool CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref,
+                                                             std::vector<u8>* packet)
 {
   std::size_t datasize = 0;  // Set by socket.receive using a non-const reference
   unsigned short remote_port;
@@ -259,18 +266,23 @@ CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
   {
   case IPPROTO_UDP:
   {
-    std::array<u8, MAX_UDP_LENGTH> buffer;
+    m_payload_buffer.resize(MAX_UDP_LENGTH);
     std::optional<sf::IpAddress> target;
-    (void)ref->udp_socket.receive(buffer.data(), MAX_UDP_LENGTH, datasize, target, remote_port);
+    (void)ref->udp_socket.receive(m_payload_buffer.data(), MAX_UDP_LENGTH, datasize, target,
+                                  remote_port);
     if (datasize > 0)
     {
       ref->from.sin_port = htons(remote_port);
       const u32 remote_ip = htonl(target->toInteger());
       ref->from.sin_addr.s_addr = remote_ip;
       ref->my_mac = ResolveAddress(remote_ip);
-      const std::vector<u8> udp_data(buffer.begin(), buffer.begin() + datasize);
-      const Common::UDPPacket packet(ref->bba_mac, ref->my_mac, ref->from, ref->to, udp_data);
-      return packet.Build();
+      m_payload_buffer.resize(datasize);
+      Common::UDPPacket udp_packet(ref->bba_mac, ref->my_mac, ref->from, ref->to,
+                                   std::move(m_payload_buffer));
+      udp_packet.Build(packet);
+      // Keep the payload storage for the next datagram
+      m_payload_buffer = std::move(udp_packet.data);
+      return true;
     }
     break;
   }
@@ -290,7 +302,7 @@ CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
     }
     case BbaTcpSocket::ConnectingState::None:
     case BbaTcpSocket::ConnectingState::Connecting:
-      return std::nullopt;
+      return false;
     case BbaTcpSocket::ConnectingState::Connected:
       break;
     }
@@ -308,25 +320,28 @@ CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
     // set default size to 0 to avoid issue
     datasize = 0;
     const bool can_go = (GetTickCountStd() - ref->poke_time > 100 || ref->window_size > 2000);
-    std::array<u8, MAX_TCP_LENGTH> buffer;
+    m_payload_buffer.resize(MAX_TCP_LENGTH);
     if (tcp_buffer != nullptr && ref->ready && can_go)
-      st = ref->tcp_socket.receive(buffer.data(), MAX_TCP_LENGTH, datasize);
+      st = ref->tcp_socket.receive(m_payload_buffer.data(), MAX_TCP_LENGTH, datasize);
 
     if (datasize > 0)
     {
-      Common::TCPPacket packet(ref->bba_mac, ref->my_mac, ref->from, ref->to, ref->seq_num,
-                               ref->ack_num, TCP_FLAG_ACK | TCP_FLAG_PSH);
-      packet.data = std::vector<u8>(buffer.begin(), buffer.begin() + datasize);
+      Common::TCPPacket tcp_packet(ref->bba_mac, ref->my_mac, ref->from, ref->to, ref->seq_num,
+                                   ref->ack_num, TCP_FLAG_ACK | TCP_FLAG_PSH);
+      m_payload_buffer.resize(datasize);
+      tcp_packet.data = std::move(m_payload_buffer);
 
       // build buffer
       tcp_buffer->seq_id = ref->seq_num;
       tcp_buffer->tick = GetTickCountStd();
-      tcp_buffer->data = packet.Build();
+      tcp_packet.Build(&tcp_buffer->data);
+      m_payload_buffer = std::move(tcp_packet.data);
       tcp_buffer->seq_id = ref->seq_num;
       tcp_buffer->used = true;
       ref->seq_num += static_cast<u32>(datasize);
       ref->poke_time = GetTickCountStd();
-      return tcp_buffer->data;
+      *packet = tcp_buffer->data;
+      return true;
     }
     if (GetTickCountStd() - ref->delay > 3000)
     {
@@ -334,13 +349,14 @@ CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
       {
         ref->ip = 0;
         ref->tcp_socket.disconnect();
-        return BuildFINFrame(ref);
+        *packet = BuildFINFrame(ref);
+        return true;
       }
     }
     break;
   }
 
-  return std::nullopt;
+  return false;
 }
 
 void CEXIETHERNET::BuiltInBBAInterface::HandleTCPFrame(const Common::TCPPacket& packet)
@@ -444,6 +444,9 @@ private:
     u8 m_queue_read = 0;
     u8 m_queue_write = 0;
     std::array<std::vector<u8>, 16> m_queue_data;
+    // Reused storage for received payloads and for frames going straight to mRecvBuffer
+    std::vector<u8> m_payload_buffer;
+    std::vector<u8> m_recv_packet;
     std::mutex m_mtx;
     std::string m_local_ip;
     u32 m_current_ip = 0;
@@ -461,9 +464,10 @@ private:
     static void ReadThreadHandler(BuiltInBBAInterface* self);
 #endif
     void WriteToQueue(const std::vector<u8>& data);
+    void CommitQueueWrite();
     bool WillQueueOverrun() const;
     void PollData(std::size_t* datasize);
-    std::optional<std::vector<u8>> TryGetDataFromSocket(StackRef* ref);
+    bool TryGetDataFromSocket(StackRef* ref, std::vector<u8>* packet);
 
     void HandleARP(const Common::ARPPacket& packet);
     void HandleDHCP(const Common::UDPPacket& packet);
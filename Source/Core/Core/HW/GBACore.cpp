@@ -3,6 +3,8 @@
 
 #include "Core/HW/GBACore.h"
 
+#include <algorithm>
+
 #define PYCPARSE  // Remove static functions from the header
 #include <mgba/core/interface.h>
 #undef PYCPARSE
@@ -33,6 +35,7 @@
 #include "Core/Core.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/System.h"
 
@@ -46,6 +49,8 @@ mLogger s_stub_logger = {
 
 constexpr auto SAMPLES = 512;
 constexpr auto SAMPLE_RATE = 48000;
+// Running ahead is split up so that a new command doesn't wait for the whole budget
+constexpr u64 RUN_AHEAD_SLICES = 8;
 
 // libmGBA does not return the correct frequency for some GB models
 static u32 GetCoreFrequency(mCore* core)
@@ -252,6 +257,11 @@ bool Core::Start(u64 gc_ticks)
 
   if (Config::Get(Config::MAIN_GBA_THREADS))
   {
+    // Running ahead makes the timing of link transfers nondeterministic
+    const bool relaxed_sync = Config::Get(Config::MAIN_GBA_RELAXED_SYNC) &&
+                              !NetPlay::IsNetPlayRunning() && !m_system.GetMovie().IsMovieActive();
+    m_run_ahead_ticks =
+        relaxed_sync ? m_system.GetSystemTimers().GetTicksPerSecond() / 1000 : 0;
     m_idle = true;
     m_exit_loop = false;
     m_thread = std::make_unique<std::thread>([this] { ThreadLoop(); });
@@ -272,6 +282,7 @@ void Core::Stop()
     }
     m_thread->join();
     m_thread.reset();
+    m_run_ahead_ticks = 0;
   }
   if (m_core)
   {
@@ -534,12 +545,34 @@ void Core::ThreadLoop()
     RunCommand(command);
 
     queue_lock.lock();
+    if (m_run_ahead_ticks)
+      RunAhead(command.ticks + command.transfer_time, queue_lock);
     if (m_command_queue.empty())
       m_idle = true;
     m_response_cv.notify_one();
   }
 }
 
+void Core::RunAhead(u64 gc_ticks, std::unique_lock<std::mutex>& queue_lock)
+{
+  // When the next command arrives, the core has likely already reached its time, so the response
+  // is ready without waiting for the core to catch up. Commands for an earlier time than the core
+  // has reached are run immediately.
+  const u64 limit = gc_ticks + m_run_ahead_ticks;
+  const u64 slice = std::max<u64>(m_run_ahead_ticks / RUN_AHEAD_SLICES, 1);
+  while (m_command_queue.empty() && !m_exit_loop &&
+         static_cast<s64>(limit - m_last_gc_ticks) > 0)
+  {
+    const u64 last_gc_ticks = m_last_gc_ticks;
+    queue_lock.unlock();
+    RunUntil(std::min(limit, m_last_gc_ticks + slice));
+    queue_lock.lock();
+    // Too close to the limit for a single core cycle
+    if (m_last_gc_ticks == last_gc_ticks)
+      break;
+  }
+}
+
 void Core::RunCommand(Command& command)
 {
   m_keys = command.keys;
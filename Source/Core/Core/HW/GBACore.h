@@ -65,6 +65,7 @@ public:
   void Stop();
   void Reset();
   bool IsStarted() const;
+  bool IsRunningAhead() const { return m_run_ahead_ticks != 0; }
   CoreInfo GetCoreInfo() const;
 
   void SetHost(std::weak_ptr<GBAHostInterface> host);
@@ -85,6 +86,7 @@ public:
 
 private:
   void ThreadLoop();
+  void RunAhead(u64 gc_ticks, std::unique_lock<std::mutex>& queue_lock);
   void RunUntil(u64 gc_ticks);
   void RunFor(u64 gc_ticks);
   void Flush();
@@ -133,6 +135,8 @@ private:
   std::weak_ptr<GBAHostInterface> m_host;
 
   std::unique_ptr<std::thread> m_thread;
+  // With relaxed sync, how far the thread may run the core past the last command, in GC ticks
+  u64 m_run_ahead_ticks = 0;
   bool m_exit_loop = false;
   bool m_idle = false;
   std::mutex m_queue_mutex;
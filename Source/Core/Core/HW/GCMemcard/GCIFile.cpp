@@ -3,6 +3,8 @@
 
 #include "Core/HW/GCMemcard/GCIFile.h"
 
+#include <algorithm>
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -87,6 +89,11 @@ int GCIFile::UsesBlock(u16 block_num)
 
 void GCIFile::DoState(PointerWrap& p)
 {
+  // Savestates don't track single blocks, so the whole file gets written instead
+  if (std::ranges::find(m_dirty_blocks, true) != m_dirty_blocks.end())
+    m_dirty = true;
+  m_dirty_blocks.clear();
+
   p.Do(m_gci_header);
   p.Do(m_dirty);
   p.Do(m_filename);
@@ -25,7 +25,11 @@ public:
   DEntry m_gci_header;
   std::vector<GCMBlock> m_save_data;
   std::vector<u16> m_used_blocks;
+  // The whole file needs to be written, e.g. because its header changed
   bool m_dirty = false;
+  // Blocks of m_save_data that were written since the last flush, which are enough to update an
+  // existing file if it isn't dirty otherwise
+  std::vector<bool> m_dirty_blocks;
   std::string m_filename;
 };
 }  // namespace Memcard
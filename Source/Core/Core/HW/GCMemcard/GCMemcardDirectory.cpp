@@ -551,7 +551,10 @@ inline s32 GCMemcardDirectory::SaveAreaRW(u32 block, bool writing)
 
         if (writing)
         {
-          m_saves[i].m_dirty = true;
+          std::vector<bool>& dirty_blocks = m_saves[i].m_dirty_blocks;
+          if (dirty_blocks.size() <= static_cast<size_t>(idx))
+            dirty_blocks.resize(m_saves[i].m_save_data.size());
+          dirty_blocks[idx] = true;
         }
 
         m_last_block = block;
@@ -618,16 +621,52 @@ bool GCMemcardDirectory::SetUsedBlocks(int save_index)
   return true;
 }
 
+bool GCMemcardDirectory::WriteGCI(const GCIWrite& write)
+{
+  if (!write.whole_file)
+  {
+    File::IOFile gci(write.filename, "r+b");
+    if (!gci)
+      return false;
+    for (const auto& [index, block] : write.blocks)
+    {
+      gci.Seek(Memcard::DENTRY_SIZE + static_cast<s64>(index) * Memcard::BLOCK_SIZE,
+               File::SeekOrigin::Begin);
+      gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
+    }
+    return gci.IsGood();
+  }
+
+  // Write a new file first, so that the old save is still intact if writing fails halfway
+  const std::string temp_filename = write.filename + ".tmp";
+  {
+    File::IOFile gci(temp_filename, "wb");
+    if (!gci)
+      return false;
+    gci.WriteBytes(&write.header, Memcard::DENTRY_SIZE);
+    for (const auto& [index, block] : write.blocks)
+      gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
+    if (!gci.IsGood())
+      return false;
+  }
+  return File::RenameSync(temp_filename, write.filename);
+}
+
 void GCMemcardDirectory::FlushToFile()
 {
+  std::vector<GCIWrite> writes;
   std::unique_lock l(m_write_mutex);
-  Memcard::DEntry invalid;
   for (Memcard::GCIFile& save : m_saves)
   {
-    if (save.m_dirty)
+    const bool has_dirty_blocks =
+        std::ranges::find(save.m_dirty_blocks, true) != save.m_dirty_blocks.end();
+    if (save.m_dirty || has_dirty_blocks)
     {
       if (save.m_gci_header.m_gamecode != Memcard::DEntry::UNINITIALIZED_GAMECODE)
       {
+        // An existing file only needs the blocks that were written
+        const bool whole_file =
+            save.m_dirty || save.m_filename.empty() || !File::Exists(save.m_filename);
         save.m_dirty = false;
         if (save.m_save_data.empty())
         {
@@ -636,6 +675,7 @@ void GCMemcardDirectory::FlushToFile()
           // skip flushing this file until actual save data is modified
           ERROR_LOG_FMT(EXPANSIONINTERFACE,
                         "GCI header modified without corresponding save data changes");
+          save.m_dirty_blocks.clear();
           continue;
         }
         if (save.m_filename.empty())
@@ -657,31 +697,17 @@ void GCMemcardDirectory::FlushToFile()
           }
           save.m_filename = default_save_name;
         }
-        File::IOFile gci(save.m_filename, "wb");
-        if (gci)
-        {
-          gci.WriteBytes(&save.m_gci_header, Memcard::DENTRY_SIZE);
-          for (const Memcard::GCMBlock& block : save.m_save_data)
-            gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
 
-          if (gci.IsGood())
-          {
-            Core::DisplayMessage("Wrote save contents to GCI Folder", 4000);
-          }
-          else
-          {
-            Core::DisplayMessage(
-                fmt::format("Failed to write save contents to {}", save.m_filename), 10000);
-            ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", save.m_filename);
-          }
-        }
-        else
+        GCIWrite& write = writes.emplace_back();
+        write.filename = save.m_filename;
+        write.header = save.m_gci_header;
+        write.whole_file = whole_file;
+        for (u16 i = 0; i < save.m_save_data.size(); ++i)
         {
-          Core::DisplayMessage(
-              fmt::format("Failed to open file at {} for writing", save.m_filename), 10000);
-          ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to open file at {} for writing",
-                        save.m_filename);
+          if (whole_file || (i < save.m_dirty_blocks.size() && save.m_dirty_blocks[i]))
+            write.blocks.emplace_back(i, save.m_save_data[i]);
         }
+        save.m_dirty_blocks.clear();
       }
       else if (save.m_filename.length() != 0)
       {
@@ -694,6 +720,7 @@ void GCMemcardDirectory::FlushToFile()
         save.m_filename.clear();
         save.m_save_data.clear();
         save.m_used_blocks.clear();
+        save.m_dirty_blocks.clear();
       }
     }
 
@@ -707,8 +734,25 @@ void GCMemcardDirectory::FlushToFile()
     {
       INFO_LOG_FMT(EXPANSIONINTERFACE, "Flushing savedata to disk for {}", save.m_filename);
       save.m_save_data.clear();
+      save.m_dirty_blocks.clear();
+    }
+  }
+  l.unlock();
+
+  for (const GCIWrite& write : writes)
+  {
+    if (WriteGCI(write))
+    {
+      Core::DisplayMessage("Wrote save contents to GCI Folder", 4000);
+    }
+    else
+    {
+      Core::DisplayMessage(fmt::format("Failed to write save contents to {}", write.filename),
+                           10000);
+      ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", write.filename);
     }
   }
+
 #if _WRITE_MC_HEADER
   u8 mc[BLOCK_SIZE * MC_FST_BLOCKS];
   Read(0, BLOCK_SIZE * MC_FST_BLOCKS, mc);
@@ -6,6 +6,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "Common/Event.h"
@@ -42,6 +43,17 @@ public:
   void DoState(PointerWrap& p) override;
 
 private:
+  // Save data copied out of m_saves, so that it can be written without holding m_write_mutex
+  struct GCIWrite
+  {
+    std::string filename;
+    Memcard::DEntry header;
+    // Only the blocks to update, unless the whole file is written
+    std::vector<std::pair<u16, Memcard::GCMBlock>> blocks;
+    bool whole_file;
+  };
+  static bool WriteGCI(const GCIWrite& write);
+
   bool LoadGCI(Memcard::GCIFile gci);
   inline s32 SaveAreaRW(u32 block, bool writing = false);
   // s32 DirectoryRead(u32 offset, u32 length, u8* dest_address);
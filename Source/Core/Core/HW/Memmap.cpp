@@ -12,13 +12,17 @@
 #include <array>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <span>
 #include <tuple>
 
+#include "Common/Align.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -33,6 +37,7 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
+#include "Core/PowerPC/BreakPoints.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -73,6 +78,8 @@ void MemoryManager::InitMMIO(bool is_wii)
 
 void MemoryManager::Init()
 {
+  std::unique_lock lock(m_unsynchronized_read_mutex);
+
   const auto get_mem1_size = [] {
     if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
       return Config::Get(Config::MAIN_MEM1_SIZE);
@@ -123,6 +130,9 @@ void MemoryManager::Init()
   }
   m_arena.GrabSHMSegment(mem_size, "dolphin-emu");
 
+  // Emulated RAM is accessed all over the place, so huge pages can save a lot of TLB misses
+  m_use_huge_pages = Config::Get(Config::MAIN_HUGE_PAGES);
+
   m_physical_page_mappings.fill(nullptr);
 
   // Create an anonymous view of the physical memory
@@ -141,6 +151,9 @@ void MemoryManager::Init()
       exit(0);
     }
 
+    if (m_use_huge_pages)
+      Common::AdviseHugePages(*region.out_pointer, region.size);
+
     for (u32 i = 0; i < region.size; i += PowerPC::BAT_PAGE_SIZE)
     {
       const size_t index = (i + region.physical_address) >> PowerPC::BAT_INDEX_SHIFT;
@@ -226,15 +239,23 @@ bool MemoryManager::InitFastmemArena()
                     region.physical_address, region.size);
       return false;
     }
+
+    if (m_use_huge_pages)
+      Common::AdviseHugePages(view, region.size);
   }
 
   m_is_fastmem_arena_initialized = true;
+  m_is_page_table_mapping_supported = m_arena.GetMappingGranularity() <= PowerPC::HW_PAGE_SIZE;
   m_fastmem_arena_size = memory_size;
+  UpdateMemCheckProtections();
   return true;
 }
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  UnprotectMemChecks();
+  RemovePageTableMappings(0, 0);
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -243,9 +264,11 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 
   m_logical_page_mappings.fill(nullptr);
 
+  // Pages overlapping memchecks are mapped too, and get protected by ProtectMemChecks below.
+  const u32 mapped_bits = PowerPC::BAT_PHYSICAL_BIT | PowerPC::BAT_MEMCHECK_BIT;
   for (u32 i = 0; i < dbat_table.size(); ++i)
   {
-    if (dbat_table[i] & PowerPC::BAT_PHYSICAL_BIT)
+    if (dbat_table[i] & mapped_bits)
     {
       u32 logical_address = i << PowerPC::BAT_INDEX_SHIFT;
       u32 logical_size = PowerPC::BAT_PAGE_SIZE;
@@ -253,7 +276,7 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 
       while (i + 1 < dbat_table.size())
       {
-        if (!(dbat_table[i + 1] & PowerPC::BAT_PHYSICAL_BIT))
+        if (!(dbat_table[i + 1] & mapped_bits))
         {
           ++i;
           break;
@@ -295,6 +318,9 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
               exit(0);
             }
             m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+
+            if (m_use_huge_pages)
+              Common::AdviseHugePages(mapped_pointer, mapped_size);
           }
 
           m_logical_page_mappings[i] =
@@ -303,6 +329,139 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
       }
     }
   }
+
+  ProtectMemChecks();
+}
+
+void MemoryManager::UpdateMemCheckProtections()
+{
+  UnprotectMemChecks();
+  ProtectMemChecks();
+}
+
+void MemoryManager::ProtectMemChecks()
+{
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  const auto& mem_checks = m_system.GetPowerPC().GetMemChecks().GetMemChecks();
+  if (mem_checks.empty())
+    return;
+
+  const size_t granularity = m_arena.GetProtectionGranularity();
+
+  // Memchecks are effective addresses, which are physical addresses while address translation is
+  // disabled, so they are protected in both views. Pages only watched for writes stay readable.
+  // They are protected first, so that a page watched for both keeps the stricter protection.
+  for (const bool break_on_read : {false, true})
+  {
+    for (const TMemCheck& mem_check : mem_checks)
+    {
+      if (mem_check.is_break_on_read != break_on_read ||
+          (!mem_check.is_break_on_read && !mem_check.is_break_on_write))
+      {
+        continue;
+      }
+
+      const u64 start = Common::AlignDown(u64{mem_check.start_address}, granularity);
+      const u64 end = Common::AlignUp(u64{mem_check.end_address} + 1, granularity);
+      const auto access = break_on_read ? Common::MemoryAccess::None : Common::MemoryAccess::Read;
+
+      const auto protect = [&](u8* view_base, u32 view_address, u32 view_size) {
+        const u64 protect_start = std::max<u64>(start, view_address);
+        const u64 protect_end = std::min<u64>(end, u64{view_address} + view_size);
+        if (protect_start >= protect_end)
+          return;
+
+        u8* pointer = view_base + (protect_start - view_address);
+        const u32 size = static_cast<u32>(protect_end - protect_start);
+        if (m_arena.ProtectMemoryRegion(pointer, size, access))
+          m_memcheck_protected_entries.push_back({pointer, size});
+      };
+
+      for (const PhysicalMemoryRegion& region : m_physical_regions)
+      {
+        if (region.active)
+        {
+          protect(m_physical_base + region.physical_address, region.physical_address,
+                  region.size);
+        }
+      }
+
+      for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+      {
+        u8* pointer = static_cast<u8*>(entry.mapped_pointer);
+        protect(pointer, static_cast<u32>(pointer - m_logical_base), entry.mapped_size);
+      }
+    }
+  }
+}
+
+void MemoryManager::UnprotectMemChecks()
+{
+  for (const LogicalMemoryView& entry : m_memcheck_protected_entries)
+  {
+    m_arena.ProtectMemoryRegion(entry.mapped_pointer, entry.mapped_size,
+                                Common::MemoryAccess::ReadWrite);
+  }
+  m_memcheck_protected_entries.clear();
+}
+
+void MemoryManager::AddPageTableMapping(u32 logical_address, u32 translated_address)
+{
+  if (!m_is_page_table_mapping_supported)
+    return;
+
+  if (const auto it = m_page_table_mapped_entries.find(logical_address);
+      it != m_page_table_mapped_entries.end())
+  {
+    if (it->second == translated_address)
+      return;
+
+    m_arena.UnmapFromMemoryRegion(m_logical_base + logical_address, PowerPC::HW_PAGE_SIZE);
+    m_page_table_mapped_entries.erase(it);
+  }
+
+  for (const auto& physical_region : m_physical_regions)
+  {
+    if (!physical_region.active)
+      continue;
+
+    const u32 mapping_address = physical_region.physical_address;
+    if (translated_address < mapping_address ||
+        translated_address - mapping_address >= physical_region.size)
+    {
+      continue;
+    }
+
+    const u32 position = physical_region.shm_position + translated_address - mapping_address;
+    u8* base = m_logical_base + logical_address;
+    if (!m_arena.MapInMemoryRegion(position, PowerPC::HW_PAGE_SIZE, base))
+    {
+      ERROR_LOG_FMT(MEMMAP,
+                    "Failed to map page at 0x{:08X} into logical fastmem region at 0x{:08X}.",
+                    translated_address, logical_address);
+      return;
+    }
+
+    m_page_table_mapped_entries.emplace(logical_address, translated_address);
+    return;
+  }
+}
+
+void MemoryManager::RemovePageTableMappings(u32 logical_address, u32 mask)
+{
+  for (auto it = m_page_table_mapped_entries.begin(); it != m_page_table_mapped_entries.end();)
+  {
+    if (((it->first ^ logical_address) & mask) != 0)
+    {
+      ++it;
+      continue;
+    }
+
+    m_arena.UnmapFromMemoryRegion(m_logical_base + it->first, PowerPC::HW_PAGE_SIZE);
+    it = m_page_table_mapped_entries.erase(it);
+  }
 }
 
 void MemoryManager::DoState(PointerWrap& p)
@@ -356,6 +515,8 @@ void MemoryManager::DoState(PointerWrap& p)
 
 void MemoryManager::Shutdown()
 {
+  std::unique_lock lock(m_unsynchronized_read_mutex);
+
   ShutdownFastmemArena();
 
   m_is_initialized = false;
@@ -377,6 +538,9 @@ void MemoryManager::ShutdownFastmemArena()
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  // Unmapping drops the protections.
+  m_memcheck_protected_entries.clear();
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -386,6 +550,8 @@ void MemoryManager::ShutdownFastmemArena()
     m_arena.UnmapFromMemoryRegion(base, region.size);
   }
 
+  RemovePageTableMappings(0, 0);
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -400,6 +566,7 @@ void MemoryManager::ShutdownFastmemArena()
   m_logical_base = nullptr;
 
   m_is_fastmem_arena_initialized = false;
+  m_is_page_table_mapping_supported = false;
 }
 
 void MemoryManager::Clear()
@@ -449,6 +616,38 @@ void MemoryManager::CopyFromEmu(void* data, u32 address, size_t size) const
   memcpy(data, pointer, size);
 }
 
+bool MemoryManager::CopyFromEmuUnsynchronized(void* data, u32 address, size_t size,
+                                              PowerPC::RequestedAddressSpace space) const
+{
+  if (space != PowerPC::RequestedAddressSpace::Physical)
+  {
+    const u32 segment = address & 0xE0000000;
+    if (segment != 0x80000000 && segment != 0xC0000000)
+      return false;
+    address &= 0x1FFFFFFF;
+  }
+
+  std::shared_lock lock(m_unsynchronized_read_mutex);
+
+  const u8* source = nullptr;
+  if (m_ram && address < GetRamSizeReal() && size <= GetRamSizeReal() - address)
+  {
+    source = m_ram + address;
+  }
+  else if (m_exram && address >= 0x10000000)
+  {
+    const u32 offset = address - 0x10000000;
+    if (offset < GetExRamSizeReal() && size <= GetExRamSizeReal() - offset)
+      source = m_exram + offset;
+  }
+
+  if (!source)
+    return false;
+
+  memcpy(data, source, size);
+  return true;
+}
+
 void MemoryManager::CopyToEmu(u32 address, const void* data, size_t size)
 {
   if (size == 0)
@@ -4,7 +4,9 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <memory>
+#include <shared_mutex>
 #include <span>
 #include <string>
 #include <vector>
@@ -101,6 +103,21 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Page table translations are mapped into the logical fastmem region one page at a time, on top
+  // of the BAT mappings. This is only possible if the host can map memory at the granularity of
+  // PowerPC pages. All page table mappings are removed by UpdateLogicalMemory.
+  bool IsPageTableMappingSupported() const { return m_is_page_table_mapping_supported; }
+  void AddPageTableMapping(u32 logical_address, u32 translated_address);
+  // Removes the mappings of all pages whose logical address matches the given one in the bits
+  // which are set in the mask. A mask of 0 removes all of them.
+  void RemovePageTableMappings(u32 logical_address, u32 mask);
+
+  // Memchecks are implemented for fast accesses by protecting the host pages of the fastmem views
+  // which hold them. Fast accesses to those pages fault and get backpatched into slow accesses,
+  // which check the exact range, while fast accesses to other pages are unaffected. Has to be
+  // called whenever the memchecks change. UpdateLogicalMemory does this too.
+  void UpdateMemCheckProtections();
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -117,6 +134,14 @@ public:
   u8* GetPointerForRange(u32 address, size_t size) const;
 
   void CopyFromEmu(void* data, u32 address, size_t size) const;
+  // Copies MEM1 or MEM2 without synchronizing with the CPU thread, so that tools can show memory
+  // while the emulation keeps running. Effective and virtual addresses are translated with the BATs
+  // which the OS sets up (0x80000000 and 0x90000000 cached, 0xC0000000 and 0xD0000000 uncached)
+  // rather than the current BATs and page table, which can't be read safely from another thread.
+  // Values which the CPU writes during the copy may come out torn. Returns false without copying
+  // anything if the range isn't entirely within MEM1 or MEM2.
+  bool CopyFromEmuUnsynchronized(void* data, u32 address, size_t size,
+                                 PowerPC::RequestedAddressSpace space) const;
   void CopyToEmu(u32 address, const void* data, size_t size);
   void Memset(u32 address, u8 value, size_t size);
   u8 Read_U8(u32 address) const;
@@ -195,12 +220,18 @@ private:
   u32 m_exram_mask = 0;
 
   bool m_is_fastmem_arena_initialized = false;
+  bool m_is_page_table_mapping_supported = false;
+  bool m_use_huge_pages = false;
 
   // STATE_TO_SAVE
   // Save the Init(), Shutdown() state
   bool m_is_initialized = false;
   // END STATE_TO_SAVE
 
+  // Keeps the views of MEM1 and MEM2 alive during CopyFromEmuUnsynchronized. Only Init and
+  // Shutdown lock it exclusively, so the CPU thread never waits for it while running.
+  mutable std::shared_mutex m_unsynchronized_read_mutex;
+
   // MMIO mapping object.
   std::unique_ptr<MMIO::Mapping> m_mmio_mapping;
 
@@ -249,11 +280,19 @@ private:
 
   std::vector<LogicalMemoryView> m_logical_mapped_entries;
 
+  // Host pages of the fastmem views which UpdateMemCheckProtections has protected.
+  std::vector<LogicalMemoryView> m_memcheck_protected_entries;
+
+  // Pages currently mapped through the page table, from logical to physical address.
+  std::map<u32, u32> m_page_table_mapped_entries;
+
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+  void ProtectMemChecks();
+  void UnprotectMemChecks();
 };
 }  // namespace Memory
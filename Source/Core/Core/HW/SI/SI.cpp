@@ -18,6 +18,7 @@
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/ProcessorInterface.h"
@@ -28,6 +29,8 @@
 #include "Core/System.h"
 
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
+#include "InputCommon/GCPadStatus.h"
+#include "VideoCommon/PerformanceMetrics.h"
 
 namespace SerialInterface
 {
@@ -371,6 +374,7 @@ void SerialInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
     mmio->Register(base | (SI_CHANNEL_0_IN_HI + 0xC * i),
                    MMIO::ComplexRead<u32>([i, clear_rdst](Core::System& system, u32) {
                      auto& si = system.GetSerialInterface();
+                     si.OnChannelInputRead(i);
                      si.m_status_reg.hex &= clear_rdst;
                      si.UpdateInterrupts();
                      return si.m_channel[i].in_hi.hex;
@@ -379,6 +383,7 @@ void SerialInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
     mmio->Register(base | (SI_CHANNEL_0_IN_LO + 0xC * i),
                    MMIO::ComplexRead<u32>([i, clear_rdst](Core::System& system, u32) {
                      auto& si = system.GetSerialInterface();
+                     si.OnChannelInputRead(i);
                      si.m_status_reg.hex &= clear_rdst;
                      si.UpdateInterrupts();
                      return si.m_channel[i].in_lo.hex;
@@ -559,15 +564,31 @@ void SerialInterfaceManager::UpdateDevices()
   g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::SerialInterface);
   g_controller_interface.UpdateInput();
 
+  // Late sampling calls GetData again when the game reads the data, so it must not be used when
+  // the input has to match between runs or between NetPlay clients.
+  const bool late_sampling =
+      Config::Get(Config::MAIN_SI_LATE_INPUT_SAMPLING) && !Core::WantsDeterminism();
+  m_late_sampling_updated_input = false;
+  const TimePoint poll_time = Clock::now();
+
   // Update channels and set the status bit if there's new data
   for (u32 i = 0; i != MAX_SI_CHANNELS; ++i)
   {
+    SSIChannel& channel = m_channel[i];
+    channel.has_unread_input = false;
+    channel.needs_late_sample = false;
+
     // ERRLATCH bit is maintained.
-    u32 errlatch = m_channel[i].in_hi.ERRLATCH.Value();
-    switch (m_channel[i].device->GetData(m_channel[i].in_hi.hex, m_channel[i].in_lo.hex))
+    u32 errlatch = channel.in_hi.ERRLATCH.Value();
+    switch (channel.device->GetData(channel.in_hi.hex, channel.in_lo.hex))
     {
     case DataResponse::Success:
       m_status_reg.hex |= GetRDSTBit(i);
+      channel.input_time = channel.device->GetInputTime().value_or(poll_time);
+      channel.has_unread_input = true;
+      // Keep data requesting a recalibration (PAD_GET_ORIGIN), as it is only reported once.
+      channel.needs_late_sample = late_sampling && channel.device->SupportsLateSampling() &&
+                                  (channel.in_hi.hex & (PAD_GET_ORIGIN << 16)) == 0;
       break;
     case DataResponse::ErrorNoResponse:
       SetNoResponse(i);
@@ -587,6 +608,45 @@ void SerialInterfaceManager::UpdateDevices()
   NetPlay::SetSIPollBatching(false);
 }
 
+void SerialInterfaceManager::OnChannelInputRead(u32 channel_index)
+{
+  SSIChannel& channel = m_channel[channel_index];
+  if (channel.needs_late_sample)
+  {
+    channel.needs_late_sample = false;
+
+    // The game may read the data long after the poll, so sample the host input again right before
+    // it is read. All channels are usually read in a row, so the input is only updated once.
+    if (!m_late_sampling_updated_input)
+    {
+      g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::SerialInterface);
+      g_controller_interface.UpdateInput();
+      m_late_sampling_updated_input = true;
+    }
+
+    const TimePoint sample_time = Clock::now();
+    u32 hi = 0;
+    u32 lo = 0;
+    // Keep the polled data if the device stopped responding in the meantime. The status register
+    // already reported the data as valid.
+    if (channel.device->GetData(hi, lo) == DataResponse::Success)
+    {
+      const u32 errlatch = channel.in_hi.ERRLATCH.Value();
+      channel.in_hi.hex = hi;
+      channel.in_hi.ERRLATCH = errlatch;
+      channel.in_lo.hex = lo;
+      channel.input_time = channel.device->GetInputTime().value_or(sample_time);
+    }
+  }
+
+  if (channel.has_unread_input)
+  {
+    channel.has_unread_input = false;
+    g_perf_metrics.CountInputAge(static_cast<int>(channel_index),
+                                 Clock::now() - channel.input_time);
+  }
+}
+
 SIDevices SerialInterfaceManager::GetDeviceType(int channel) const
 {
   if (channel < 0 || channel >= MAX_SI_CHANNELS || !m_channel[channel].device)
@@ -81,6 +81,8 @@ private:
 
   void ChangeDeviceDeterministic(SIDevices device, int channel);
 
+  void OnChannelInputRead(u32 channel);
+
   void RegisterEvents();
   void RunSIBuffer(u64 user_data, s64 cycles_late);
   static void GlobalRunSIBuffer(Core::System& system, u64 user_data, s64 cycles_late);
@@ -132,6 +134,11 @@ private:
     std::unique_ptr<ISIDevice> device;
 
     bool has_recent_device_unplug = false;
+
+    // Host side bookkeeping for the polled data, not part of savestates.
+    TimePoint input_time{};
+    bool has_unread_input = false;
+    bool needs_late_sample = false;
   };
 
   // SI Poll: Controls how often a device is polled
@@ -242,6 +249,9 @@ private:
   USIEXIClockCount m_exi_clock_count;
   std::array<u8, 128> m_si_buffer{};
 
+  // Whether the controller interface was updated for late sampling since the last poll.
+  bool m_late_sampling_updated_input = false;
+
   Core::System& m_system;
 };
 }  // namespace SerialInterface
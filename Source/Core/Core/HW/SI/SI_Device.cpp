@@ -79,6 +79,16 @@ int ISIDevice::TransferInterval()
   return 0;
 }
 
+bool ISIDevice::SupportsLateSampling() const
+{
+  return false;
+}
+
+std::optional<TimePoint> ISIDevice::GetInputTime() const
+{
+  return std::nullopt;
+}
+
 void ISIDevice::DoState(PointerWrap& p)
 {
 }
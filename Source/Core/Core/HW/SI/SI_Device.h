@@ -4,6 +4,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+
 #include "Common/CommonTypes.h"
 
 class PointerWrap;
@@ -128,6 +130,14 @@ public:
 
   virtual DataResponse GetData(u32& hi, u32& low) = 0;
 
+  // Whether GetData may be called a second time for the same poll, to replace the polled data
+  // with fresher host input right before the game reads it.
+  virtual bool SupportsLateSampling() const;
+
+  // When the input returned by the last GetData call was received from the host, for devices
+  // that don't simply sample it when GetData is called.
+  virtual std::optional<TimePoint> GetInputTime() const;
+
   // Send a command directly (no detour per buffer)
   virtual void SendCommand(u32 command, u8 poll) = 0;
 
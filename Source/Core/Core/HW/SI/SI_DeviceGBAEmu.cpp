@@ -64,7 +64,8 @@ int CSIDevice_GBAEmu::RunBuffer(u8* buffer, int request_length)
     si.RemoveEvent(m_device_number);
     si.ScheduleEvent(m_device_number,
                      TransferInterval() + GetSyncInterval(m_system.GetSystemTimers()));
-    for (int i = 0; i < MAX_SI_CHANNELS; ++i)
+    // Cores which run ahead on their own don't need to be brought up to every transfer
+    for (int i = 0; i < MAX_SI_CHANNELS && !m_core->IsRunningAhead(); ++i)
     {
       if (i == m_device_number || si.GetDeviceType(i) != GetDeviceType())
         continue;
@@ -31,12 +31,13 @@ CSIDevice_GCAdapter::CSIDevice_GCAdapter(Core::System& system, SIDevices device,
 GCPadStatus CSIDevice_GCAdapter::GetPadStatus()
 {
   GCPadStatus pad_status = {};
+  m_input_time = {};
 
   // For netplay, the local controllers are polled in GetNetPads(), and
   // the remote controllers receive their status there as well
   if (!NetPlay::IsNetPlayRunning())
   {
-    pad_status = GCAdapter::Input(m_device_number);
+    pad_status = GCAdapter::Input(m_device_number, &m_input_time);
   }
 
   HandleMoviePadStatus(m_system.GetMovie(), m_device_number, &pad_status);
@@ -81,6 +82,13 @@ DataResponse CSIDevice_GCAdapter::GetData(u32& hi, u32& low)
   return DataResponse::Success;
 }
 
+std::optional<TimePoint> CSIDevice_GCAdapter::GetInputTime() const
+{
+  if (m_input_time == TimePoint{})
+    return std::nullopt;
+  return m_input_time;
+}
+
 void CSIDevice_GCController::Rumble(int pad_num, ControlState strength, SIDevices device)
 {
   if (device == SIDEVICE_WIIU_ADAPTER)
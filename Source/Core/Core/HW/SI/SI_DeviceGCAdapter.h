@@ -18,8 +18,10 @@ public:
   int RunBuffer(u8* buffer, int request_length) override;
 
   DataResponse GetData(u32& hi, u32& low) override;
+  std::optional<TimePoint> GetInputTime() const override;
 
 private:
   bool m_simulate_konga{};
+  TimePoint m_input_time{};
 };
 }  // namespace SerialInterface
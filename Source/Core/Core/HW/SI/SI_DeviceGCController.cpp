@@ -164,6 +164,11 @@ GCPadStatus CSIDevice_GCController::GetPadStatus()
   return pad_status;
 }
 
+bool CSIDevice_GCController::SupportsLateSampling() const
+{
+  return true;
+}
+
 // GetData
 
 // Return true on new data (max 7 Bytes and 6 bits ;)
@@ -64,6 +64,7 @@ public:
   int RunBuffer(u8* buffer, int request_length) override;
 
   DataResponse GetData(u32& hi, u32& low) override;
+  bool SupportsLateSampling() const override;
 
   // Send a command directly
   void SendCommand(u32 command, u8 poll) override;
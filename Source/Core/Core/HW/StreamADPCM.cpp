@@ -6,41 +6,48 @@
 #include "Core/HW/StreamADPCM.h"
 
 #include <algorithm>
+#include <array>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 
 namespace StreamADPCM
 {
-static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
+// Filter coefficients for hist1 and hist2, selected by the upper bits of the block header. Any
+// other filter number acts like filter 0.
+static constexpr std::array<std::array<s32, 2>, 4> FILTER_COEFFICIENTS = {{
+    {0, 0},
+    {0x3c, 0},
+    {0x73, -0x34},
+    {0x62, -0x37},
+}};
+
+// Decodes one channel of a block. The filter and scale only change once per block, so they are
+// looked up before decoding the samples rather than for each sample.
+static void DecodeChannel(s16* pcm, const u8* data, int nibble_shift, u8 q, s32& hist1,
+                          s32& hist2)
 {
-  s32 hist = 0;
-  switch (q >> 4)
-  {
-  case 0:
-    hist = 0;
-    break;
-  case 1:
-    hist = (hist1 * 0x3c);
-    break;
-  case 2:
-    hist = (hist1 * 0x73) - (hist2 * 0x34);
-    break;
-  case 3:
-    hist = (hist1 * 0x62) - (hist2 * 0x37);
-    break;
-  }
-  hist = std::clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
+  const size_t filter = q >> 4;
+  const s32 coef1 = filter < FILTER_COEFFICIENTS.size() ? FILTER_COEFFICIENTS[filter][0] : 0;
+  const s32 coef2 = filter < FILTER_COEFFICIENTS.size() ? FILTER_COEFFICIENTS[filter][1] : 0;
+  const int scale_shift = q & 0xf;
 
-  s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
+  s32 h1 = hist1;
+  s32 h2 = hist2;
+  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
+  {
+    const s32 hist = std::clamp((coef1 * h1 + coef2 * h2 + 0x20) >> 6, -0x200000, 0x1fffff);
+    const s32 bits = (data[i] >> nibble_shift) & 0xf;
+    const s32 cur = ((static_cast<s16>(bits << 12) >> scale_shift) << 6) + hist;
 
-  hist2 = hist1;
-  hist1 = cur;
+    h2 = h1;
+    h1 = cur;
 
-  cur >>= 6;
-  cur = std::clamp(cur, -0x8000, 0x7fff);
+    pcm[i * 2] = static_cast<s16>(std::clamp(cur >> 6, -0x8000, 0x7fff));
+  }
 
-  return (s16)cur;
+  hist1 = h1;
+  hist2 = h2;
 }
 
 void ADPCMDecoder::ResetFilter()
@@ -61,12 +68,8 @@ void ADPCMDecoder::DoState(PointerWrap& p)
 
 void ADPCMDecoder::DecodeBlock(s16* pcm, const u8* adpcm)
 {
-  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
-  {
-    pcm[i * 2] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
-                                 m_histl1, m_histl2);
-    pcm[i * 2 + 1] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4, adpcm[1],
-                                     m_histr1, m_histr2);
-  }
+  const u8* data = adpcm + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK);
+  DecodeChannel(pcm, data, 0, adpcm[0], m_histl1, m_histl2);
+  DecodeChannel(pcm + 1, data, 4, adpcm[1], m_histr1, m_histr2);
 }
 }  // namespace StreamADPCM
@@ -32,6 +32,8 @@
 #include "InputCommon/ControllerInterface/Wiimote/WiimoteController.h"
 #include "InputCommon/InputConfig.h"
 
+#include "VideoCommon/PerformanceMetrics.h"
+
 #include "SFML/Network.hpp"
 
 namespace WiimoteReal
@@ -49,6 +51,10 @@ static bool s_real_wiimotes_initialized = false;
 static std::unordered_set<std::string> s_known_ids;
 static std::mutex s_known_ids_mutex;
 
+// For Wiimote::m_data_report_middle
+constexpr u8 DATA_REPORT_INDEX_MASK = 3;
+constexpr u8 DATA_REPORT_FRESH = 4;
+
 std::recursive_mutex g_wiimotes_mutex;
 
 // Real wii remotes assigned to a particular slot.
@@ -240,7 +246,7 @@ void Wiimote::ClearReadQueue()
   Report rpt;
 
   // The "Clear" function isn't thread-safe :/
-  while (m_read_reports.Pop(rpt))
+  while (GetNextReport(&rpt))
   {
   }
 }
@@ -296,9 +302,15 @@ void Wiimote::InterruptDataOutput(const u8* data, const u32 size)
   WriteReport(std::move(rpt));
 }
 
+static bool IsDataReport(const Report& rpt)
+{
+  return rpt.size() >= 2 && rpt[1] >= u8(InputReportID::ReportCore);
+}
+
 void Wiimote::Read()
 {
-  Report rpt(MAX_PAYLOAD);
+  Report& rpt = m_read_buffer;
+  rpt.resize(MAX_PAYLOAD);
   auto const result = IORead(rpt.data());
 
   if (0 == result)
@@ -322,9 +334,27 @@ void Wiimote::Read()
                         m_balance_board_dump_port);
     }
 
-    // Add it to queue
     rpt.resize(result);
-    m_read_reports.Push(std::move(rpt));
+    const u64 sequence = ++m_read_sequence;
+    const TimePoint now = Clock::now();
+
+    if (IsDataReport(rpt))
+    {
+      // Replace the previous data report, whether it was read or not. The storage of the report
+      // taken out of the back buffer is reused for the next read.
+      ReceivedReport& back = m_data_reports[m_data_report_back];
+      std::swap(back.data, rpt);
+      back.sequence = sequence;
+      back.time = now;
+      m_data_report_back = m_data_report_middle.exchange(m_data_report_back | DATA_REPORT_FRESH,
+                                                         std::memory_order_acq_rel) &
+                           DATA_REPORT_INDEX_MASK;
+    }
+    else
+    {
+      // Add it to queue
+      m_read_reports.Push(ReceivedReport{std::move(rpt), sequence, now});
+    }
   }
 }
 
@@ -429,14 +459,34 @@ bool Wiimote::IsBalanceBoard()
   return false;
 }
 
-static bool IsDataReport(const Report& rpt)
-{
-  return rpt.size() >= 2 && rpt[1] >= u8(InputReportID::ReportCore);
-}
-
 bool Wiimote::GetNextReport(Report* report)
 {
-  return m_read_reports.Pop(*report);
+  // Take the newest data report. An older one which wasn't read yet is stale and dropped.
+  if (m_data_report_middle.load(std::memory_order_relaxed) & DATA_REPORT_FRESH)
+  {
+    m_data_report_front =
+        m_data_report_middle.exchange(m_data_report_front, std::memory_order_acq_rel) &
+        DATA_REPORT_INDEX_MASK;
+    m_has_data_report = true;
+  }
+
+  // Return whichever of the data report and the queued reports was read first.
+  ReceivedReport* next = m_read_reports.Empty() ? nullptr : &m_read_reports.Front();
+  ReceivedReport& data_report = m_data_reports[m_data_report_front];
+  const bool take_data_report =
+      m_has_data_report && (next == nullptr || data_report.sequence < next->sequence);
+  if (take_data_report)
+    next = &data_report;
+  if (next == nullptr)
+    return false;
+
+  std::swap(*report, next->data);
+  m_last_input_report_time = next->time;
+  if (take_data_report)
+    m_has_data_report = false;
+  else
+    m_read_reports.Pop();
+  return true;
 }
 
 // Returns the next report that should be sent
@@ -494,6 +544,9 @@ void Wiimote::Update(const WiimoteEmu::DesiredWiimoteState& target_state)
   if (rpt.empty())
     return;
 
+  if (IsDataReport(rpt) && m_index < PerformanceMetrics::NUM_WII_REMOTES)
+    g_perf_metrics.CountWiiRemoteReportAge(m_index, Clock::now() - m_last_input_report_time);
+
   InterruptCallback(rpt.front(), rpt.data() + REPORT_HID_HEADER_SIZE,
                     u32(rpt.size() - REPORT_HID_HEADER_SIZE));
 }
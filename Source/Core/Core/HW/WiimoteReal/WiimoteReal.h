@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -153,7 +154,36 @@ private:
   // Triggered when the thread has finished ConnectInternal.
   Common::Event m_thread_ready_event;
 
-  Common::SPSCQueue<Report> m_read_reports;
+  // A report read by the Wii Remote thread. Reports are numbered in the order they were read, so
+  // that data and non-data reports reach the CPU thread in order.
+  struct ReceivedReport
+  {
+    Report data;
+    u64 sequence = 0;
+    TimePoint time{};
+  };
+
+  // Only the newest data report is kept, so stale ones don't pile up when the Wii Remote sends
+  // reports faster than they are read. This is a triple buffer: the Wii Remote thread fills the
+  // back buffer and swaps it with the middle one, which the CPU thread swaps with the front buffer
+  // when it has been refilled.
+  std::array<ReceivedReport, 3> m_data_reports;
+  // Index of the middle buffer, with DATA_REPORT_FRESH set when it holds an unread report
+  std::atomic<u8> m_data_report_middle = 1;
+  u8 m_data_report_back = 0;
+  u8 m_data_report_front = 2;
+  // Whether the front buffer holds a report which hasn't been read yet
+  bool m_has_data_report = false;
+
+  // Used by the Wii Remote thread.
+  Report m_read_buffer;
+  u64 m_read_sequence = 0;
+
+  // When the report last returned by GetNextReport was read from the Wii Remote
+  TimePoint m_last_input_report_time{};
+
+  // Acknowledgements and other replies, which must all be read.
+  Common::SPSCQueue<ReceivedReport> m_read_reports;
   Common::SPSCQueue<Report> m_write_reports;
 
   bool m_speaker_enabled_in_dolphin_config = false;
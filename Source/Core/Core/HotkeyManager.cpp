@@ -181,6 +181,7 @@ constexpr std::array<const char*, NUM_HOTKEYS> s_hotkey_labels{{
     _trans("Save Oldest State"),
     _trans("Undo Load State"),
     _trans("Undo Save State"),
+    _trans("Rewind State"),
     _trans("Save State"),
     _trans("Load State"),
     _trans("Increase Selected State Slot"),
@@ -150,9 +150,13 @@ HostFileSystem::HostFileSystem(const std::string& root_path,
   File::CreateFullPath(m_root_path + '/');
   ResetFst();
   LoadFst();
+  m_fst_writer.Reset("IOS FST Writer");
 }
 
-HostFileSystem::~HostFileSystem() = default;
+HostFileSystem::~HostFileSystem()
+{
+  m_fst_writer.Shutdown();
+}
 
 std::string HostFileSystem::GetFstFilePath() const
 {
@@ -161,6 +165,7 @@ std::string HostFileSystem::GetFstFilePath() const
 
 void HostFileSystem::ResetFst()
 {
+  InvalidateFstEntryCache();
   m_root_entry = {};
   m_root_entry.name = "/";
   // Mode 0x16 (Directory | Owner_None | Group_Read | Other_Read) in the FS sysmodule
@@ -202,6 +207,7 @@ void HostFileSystem::LoadFst()
     ERROR_LOG_FMT(IOS_FS, "Failed to parse FST: at least one of the entries was invalid");
     return;
   }
+  InvalidateFstEntryCache();
   m_root_entry = *root_entry;
 }
 
@@ -218,12 +224,42 @@ void HostFileSystem::SaveFst()
   };
   collect_entries(collect_entries, m_root_entry);
 
+  // SaveFst is called after every change to the tree, so this is a good place to drop pointers
+  // that may have been invalidated.
+  InvalidateFstEntryCache();
+
+  std::vector<u8> data(to_write.size() * sizeof(SerializedFstEntry));
+  std::memcpy(data.data(), to_write.data(), data.size());
+
+  // Games that create many files save the FST for each of them, so writing it (which includes
+  // flushing it to disk on some systems) is done on a separate thread, and a write that is still
+  // queued just gets replaced with the newer data. Writes keep being done in order and through
+  // an atomic rename, so the file on disk is always some complete earlier version of the FST.
+  {
+    std::lock_guard lk(m_pending_fst_mutex);
+    const bool write_queued = m_pending_fst.has_value();
+    m_pending_fst = std::move(data);
+    if (write_queued)
+      return;
+  }
+  m_fst_writer.Push([this] { WritePendingFst(); });
+}
+
+void HostFileSystem::WritePendingFst()
+{
+  std::vector<u8> data;
+  {
+    std::lock_guard lk(m_pending_fst_mutex);
+    data = std::move(*m_pending_fst);
+    m_pending_fst.reset();
+  }
+
   const std::string dest_path = GetFstFilePath();
   const std::string temp_path = File::GetTempFilenameForAtomicWrite(dest_path);
   {
     // This temporary file must be closed before it can be renamed.
     File::IOFile file{temp_path, "wb"};
-    if (!file.WriteArray(to_write.data(), to_write.size()))
+    if (!file.WriteBytes(data.data(), data.size()))
     {
       PanicAlertFmt("IOS_FS: Failed to write new FST");
       return;
@@ -233,6 +269,16 @@ void HostFileSystem::SaveFst()
     PanicAlertFmt("IOS_FS: Failed to rename temporary FST file");
 }
 
+void HostFileSystem::FlushFst()
+{
+  m_fst_writer.WaitForCompletion();
+}
+
+void HostFileSystem::InvalidateFstEntryCache()
+{
+  m_fst_entry_cache.clear();
+}
+
 HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string& path)
 {
   if (path == "/")
@@ -246,33 +292,44 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
   if (!host_file_info.Exists())
     return nullptr;
 
-  FstEntry* entry = host_file.is_redirect ? &m_redirect_fst : &m_root_entry;
-  std::string complete_path = "";
-  for (const std::string& component : SplitString(std::string(path.substr(1)), '/'))
+  FstEntry* entry;
+  if (const auto it = m_fst_entry_cache.find(path); it != m_fst_entry_cache.end())
   {
-    complete_path += '/' + component;
-    const auto next = std::ranges::find(entry->children, component, &FstEntry::name);
-    if (next != entry->children.end())
-    {
-      entry = &*next;
-    }
-    else
+    entry = it->second;
+  }
+  else
+  {
+    entry = host_file.is_redirect ? &m_redirect_fst : &m_root_entry;
+    std::string complete_path = "";
+    for (const std::string& component : SplitString(std::string(path.substr(1)), '/'))
     {
-      // Fall back to dummy data to avoid breaking existing filesystems.
-      // This code path is also reached when creating a new file or directory;
-      // proper metadata is filled in later.
-      INFO_LOG_FMT(IOS_FS, "Creating a default entry for {} ({})", complete_path,
-                   host_file.is_redirect ? "redirect" : "NAND");
-      entry = &entry->children.emplace_back();
-      entry->name = component;
-      entry->data.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
+      complete_path += '/' + component;
+      const auto next = std::ranges::find(entry->children, component, &FstEntry::name);
+      if (next != entry->children.end())
+      {
+        entry = &*next;
+      }
+      else
+      {
+        // Fall back to dummy data to avoid breaking existing filesystems.
+        // This code path is also reached when creating a new file or directory;
+        // proper metadata is filled in later.
+        INFO_LOG_FMT(IOS_FS, "Creating a default entry for {} ({})", complete_path,
+                     host_file.is_redirect ? "redirect" : "NAND");
+        InvalidateFstEntryCache();
+        entry = &entry->children.emplace_back();
+        entry->name = component;
+        entry->data.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
+      }
     }
+    m_fst_entry_cache.emplace(path, entry);
   }
 
   entry->data.is_file = host_file_info.IsFile();
   if (entry->data.is_file && !entry->children.empty())
   {
     WARN_LOG_FMT(IOS_FS, "{} is a file but also has children; clearing children", path);
+    InvalidateFstEntryCache();
     entry->children.clear();
   }
 
@@ -369,6 +426,9 @@ void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_dir
 
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  // The NAND root, which contains the FST file, may be part of the save state.
+  FlushFst();
+
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
   for (Handle& handle : m_handles)
     handle.host_file.reset();
@@ -841,6 +901,7 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
 
 void HostFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
 {
+  InvalidateFstEntryCache();
   m_nand_redirects = std::move(nand_redirects);
 }
 }  // namespace IOS::HLE::FS
@@ -6,11 +6,15 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/FS/FileSystem.h"
 
 namespace IOS::HLE::FS
@@ -104,11 +108,18 @@ private:
   std::string GetFstFilePath() const;
   void ResetFst();
   void LoadFst();
+  /// Serializes the FST and queues it to be written on the FST writer thread.
+  /// Saves that happen before the writer gets to them are coalesced into a single write.
   void SaveFst();
+  void WritePendingFst();
+  /// Blocks until all queued FST writes have finished.
+  void FlushFst();
   /// Get the FST entry for a file (or directory).
   /// Automatically creates fallback entries for parents if they do not exist.
   /// Returns nullptr if the path is invalid or the file does not exist.
   FstEntry* GetFstEntryForPath(const std::string& path);
+  /// Must be called whenever the children of any FST entry are modified.
+  void InvalidateFstEntryCache();
 
   /// FST entry for the filesystem root.
   ///
@@ -119,6 +130,13 @@ private:
   /// and we do not want FS to break if the user adds or removes files in their
   /// filesystem root manually.
   FstEntry m_root_entry{};
+  /// Maps Wii paths to FST entries, so that lookups don't have to walk the tree.
+  std::unordered_map<std::string, FstEntry*> m_fst_entry_cache;
+
+  std::mutex m_pending_fst_mutex;
+  std::optional<std::vector<u8>> m_pending_fst;
+  Common::AsyncWorkThread m_fst_writer;
+
   std::string m_root_path;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
@@ -0,0 +1,872 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/FS/MemoryBackend/FS.h"
+
+#include <algorithm>
+#include <deque>
+#include <string_view>
+#include <utility>
+
+#include "Common/Align.h"
+#include "Common/ChunkFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "Core/IOS/FS/HostBackend/FS.h"
+
+namespace IOS::HLE::FS
+{
+// File descriptors at or above this value belong to the template file system (redirected paths).
+constexpr Fd REDIRECTED_FD_BASE = 0x1000;
+
+static std::string JoinPath(std::string_view parent, std::string_view name)
+{
+  return fmt::format("{}/{}", parent == "/" ? "" : parent, name);
+}
+
+bool MemoryFileSystem::Node::CheckPermission(Uid caller_uid, Gid caller_gid,
+                                             Mode requested_mode) const
+{
+  if (caller_uid == 0)
+    return true;
+  Mode file_mode = data.modes.other;
+  if (data.uid == caller_uid)
+    file_mode = data.modes.owner;
+  else if (data.gid == caller_gid)
+    file_mode = data.modes.group;
+  return (u8(requested_mode) & u8(file_mode)) == u8(requested_mode);
+}
+
+MemoryFileSystem::MemoryFileSystem(const std::string& template_root_path)
+    : m_template(std::make_unique<HostFileSystem>(template_root_path))
+{
+  m_root.name = "/";
+  if (const Result<Metadata> metadata = m_template->GetMetadata(0, 0, "/"))
+    m_root.data = *metadata;
+  m_root.data.is_file = false;
+  m_root.data.size = 0;
+
+  LoadTemplateDirectory(&m_root, "/");
+}
+
+MemoryFileSystem::~MemoryFileSystem() = default;
+
+void MemoryFileSystem::LoadTemplateDirectory(Node* directory, const std::string& path)
+{
+  const Result<std::vector<std::string>> names = m_template->ReadDirectory(0, 0, path);
+  if (!names)
+    return;
+
+  // ReadDirectory lists the newest entries first.
+  for (auto it = names->rbegin(); it != names->rend(); ++it)
+  {
+    const std::string child_path = JoinPath(path, *it);
+    const Result<Metadata> metadata = m_template->GetMetadata(0, 0, child_path);
+    if (!metadata)
+      continue;
+
+    auto& child = directory->children.emplace_back(std::make_unique<Node>());
+    child->name = *it;
+    child->data = *metadata;
+    if (!child->data.is_file)
+    {
+      child->data.size = 0;
+      LoadTemplateDirectory(child.get(), child_path);
+    }
+    else if (child->data.size != 0)
+    {
+      child->template_path = child_path;
+    }
+  }
+}
+
+bool MemoryFileSystem::LoadContents(Node* node)
+{
+  if (node->template_path.empty())
+    return true;
+
+  const Result<FileHandle> file = m_template->OpenFile(0, 0, node->template_path, Mode::Read);
+  std::vector<u8> contents(node->data.size);
+  if (!file || !file->Read(contents.data(), contents.size()))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to read {} from the template NAND", node->template_path);
+    return false;
+  }
+
+  node->contents = std::move(contents);
+  node->template_path.clear();
+  return true;
+}
+
+MemoryFileSystem::Node* MemoryFileSystem::FindChild(Node* directory, std::string_view name)
+{
+  const auto it = std::ranges::find_if(directory->children,
+                                       [name](const auto& child) { return child->name == name; });
+  return it != directory->children.end() ? it->get() : nullptr;
+}
+
+MemoryFileSystem::Node* MemoryFileSystem::FindNode(const std::string& path)
+{
+  if (path == "/")
+    return &m_root;
+
+  if (!IsValidNonRootPath(path))
+    return nullptr;
+
+  Node* node = &m_root;
+  for (const std::string& component : SplitString(path.substr(1), '/'))
+  {
+    if (node->data.is_file)
+      return nullptr;
+    node = FindChild(node, component);
+    if (!node)
+      return nullptr;
+  }
+  return node;
+}
+
+void MemoryFileSystem::MarkModified(Node* node)
+{
+  node->modified = true;
+  for (const auto& child : node->children)
+    MarkModified(child.get());
+}
+
+bool MemoryFileSystem::IsRedirected(const std::string& path) const
+{
+  return std::ranges::any_of(m_nand_redirects, [&path](const NandRedirect& redirect) {
+    return path.starts_with(redirect.source_path) &&
+           (path.size() == redirect.source_path.size() ||
+            path[redirect.source_path.size()] == '/');
+  });
+}
+
+bool MemoryFileSystem::IsFileOpened(const std::string& path) const
+{
+  return std::ranges::any_of(m_handles, [&path](const Handle& handle) {
+    return handle.opened && handle.wii_path == path;
+  });
+}
+
+bool MemoryFileSystem::IsDirectoryInUse(const std::string& path) const
+{
+  return std::ranges::any_of(m_handles, [&path](const Handle& handle) {
+    return handle.opened && handle.wii_path.starts_with(path);
+  });
+}
+
+void MemoryFileSystem::DoStateWriteOrMeasure(PointerWrap& p, Node* directory,
+                                             const std::string& relative_path)
+{
+  const auto get_name = [&relative_path](const Node& child) {
+    return relative_path.empty() ? child.name : relative_path + '/' + child.name;
+  };
+
+  for (const auto& child : directory->children)
+  {
+    std::string name = get_name(*child);
+    char type = child->data.is_file ? 'f' : 'd';
+    p.Do(type);
+    p.Do(name);
+    if (child->data.is_file)
+    {
+      LoadContents(child.get());
+      u32 size = static_cast<u32>(child->contents.size());
+      p.Do(size);
+      p.DoArray(child->contents.data(), size);
+    }
+  }
+
+  for (const auto& child : directory->children)
+  {
+    if (!child->data.is_file)
+      DoStateWriteOrMeasure(p, child.get(), get_name(*child));
+  }
+}
+
+void MemoryFileSystem::DoStateRead(PointerWrap& p, const std::string& directory_path)
+{
+  Node* directory = FindNode(directory_path);
+  if (!directory || directory->data.is_file)
+  {
+    ERROR_LOG_FMT(IOS_FS, "{} is missing, cannot restore it from the state", directory_path);
+    p.SetVerifyMode();
+    return;
+  }
+
+  // Keep the metadata of entries that still exist, like HostFileSystem does through its FST.
+  Node old_directory;
+  std::swap(old_directory.children, directory->children);
+  directory->children_removed = true;
+  MarkModified(directory);
+
+  while (true)
+  {
+    char type = 0;
+    p.Do(type);
+    if (!type)
+      break;
+    std::string name;
+    p.Do(name);
+
+    const SplitPathResult split_path = SplitPathAndBasename("/" + name);
+    Node* parent = split_path.parent == "/" ? directory : nullptr;
+    Node* old_parent = split_path.parent == "/" ? &old_directory : nullptr;
+    if (!parent)
+    {
+      parent = directory;
+      old_parent = &old_directory;
+      for (const std::string& component : SplitString(split_path.parent.substr(1), '/'))
+      {
+        parent = parent ? FindChild(parent, component) : nullptr;
+        old_parent = old_parent ? FindChild(old_parent, component) : nullptr;
+      }
+    }
+
+    auto node = std::make_unique<Node>();
+    node->name = split_path.file_name;
+    node->data.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
+    if (const Node* old_node = old_parent ? FindChild(old_parent, node->name) : nullptr)
+      node->data = old_node->data;
+    node->data.is_file = type == 'f';
+    node->data.size = 0;
+    node->modified = true;
+
+    if (node->data.is_file)
+    {
+      u32 size = 0;
+      p.Do(size);
+      node->contents.resize(size);
+      p.DoArray(node->contents.data(), size);
+      node->data.size = size;
+    }
+
+    if (parent && !parent->data.is_file)
+      parent->children.push_back(std::move(node));
+  }
+}
+
+void MemoryFileSystem::DoState(PointerWrap& p)
+{
+  // This uses the same format as HostFileSystem. Only the contents of /tmp are part of the state,
+  // since the in-memory NAND is never used together with a temporary NAND root.
+  bool original_save_state_made_during_movie_recording = false;
+  p.Do(original_save_state_made_during_movie_recording);
+
+  if (!p.IsReadMode())
+  {
+    Node* tmp = FindNode("/tmp");
+    if (tmp && !tmp->data.is_file)
+      DoStateWriteOrMeasure(p, tmp, "");
+    char type = 0;
+    p.Do(type);
+    (void)p.ReserveU32();
+  }
+  else
+  {
+    DoStateRead(p, "/tmp");
+    u32 nand_size = 0;
+    (void)p.DoExternal(nand_size);
+  }
+
+  for (Handle& handle : m_handles)
+  {
+    p.Do(handle.opened);
+    p.Do(handle.mode);
+    p.Do(handle.wii_path);
+    p.Do(handle.file_offset);
+    if (p.IsReadMode())
+      handle.node = handle.opened ? FindNode(handle.wii_path) : nullptr;
+  }
+}
+
+ResultCode MemoryFileSystem::Format(Uid uid)
+{
+  if (uid != 0)
+    return ResultCode::AccessDenied;
+
+  m_root.children.clear();
+  m_root.children_removed = true;
+  // Mode 0x16 (Directory | Owner_None | Group_Read | Other_Read) in the FS sysmodule
+  m_root.data = {};
+  m_root.data.modes = {Mode::None, Mode::Read, Mode::Read};
+  m_root.modified = true;
+  // Reset and close all handles.
+  m_handles = {};
+  return ResultCode::Success;
+}
+
+MemoryFileSystem::Handle* MemoryFileSystem::AssignFreeHandle()
+{
+  const auto it =
+      std::ranges::find_if(m_handles, [](const Handle& handle) { return !handle.opened; });
+  if (it == m_handles.end())
+    return nullptr;
+
+  *it = Handle{};
+  it->opened = true;
+  return &*it;
+}
+
+MemoryFileSystem::Handle* MemoryFileSystem::GetHandleFromFd(Fd fd)
+{
+  if (fd >= m_handles.size() || !m_handles[fd].opened || !m_handles[fd].node)
+    return nullptr;
+  return &m_handles[fd];
+}
+
+Fd MemoryFileSystem::ConvertHandleToFd(const Handle* handle) const
+{
+  return handle - m_handles.data();
+}
+
+Result<FileHandle> MemoryFileSystem::OpenFile(Uid uid, Gid gid, const std::string& path,
+                                              Mode mode)
+{
+  if (IsRedirected(path))
+  {
+    Result<FileHandle> file = m_template->OpenFile(uid, gid, path, mode);
+    if (!file)
+      return file.Error();
+    return FileHandle{this, REDIRECTED_FD_BASE + file->Release()};
+  }
+
+  Handle* handle = AssignFreeHandle();
+  if (!handle)
+    return ResultCode::NoFreeHandle;
+
+  Node* node = FindNode(path);
+  if (!node)
+  {
+    *handle = Handle{};
+    return ResultCode::NotFound;
+  }
+
+  if (!node->data.is_file)
+  {
+    *handle = Handle{};
+    return ResultCode::Invalid;
+  }
+
+  if (!LoadContents(node))
+  {
+    *handle = Handle{};
+    return ResultCode::AccessDenied;
+  }
+
+  handle->wii_path = path;
+  handle->node = node;
+  handle->mode = mode;
+  handle->file_offset = 0;
+  return FileHandle{this, ConvertHandleToFd(handle)};
+}
+
+ResultCode MemoryFileSystem::Close(Fd fd)
+{
+  if (fd >= REDIRECTED_FD_BASE)
+    return m_template->Close(fd - REDIRECTED_FD_BASE);
+
+  if (fd >= m_handles.size() || !m_handles[fd].opened)
+    return ResultCode::Invalid;
+
+  m_handles[fd] = Handle{};
+  return ResultCode::Success;
+}
+
+Result<u32> MemoryFileSystem::ReadBytesFromFile(Fd fd, u8* ptr, u32 count)
+{
+  if (fd >= REDIRECTED_FD_BASE)
+    return m_template->ReadBytesFromFile(fd - REDIRECTED_FD_BASE, ptr, count);
+
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  if ((u8(handle->mode) & u8(Mode::Read)) == 0)
+    return ResultCode::AccessDenied;
+
+  const std::vector<u8>& contents = handle->node->contents;
+  const u32 file_size = static_cast<u32>(contents.size());
+  // IOS has this check in the read request handler.
+  if (count + handle->file_offset > file_size)
+    count = file_size - handle->file_offset;
+
+  std::copy_n(contents.begin() + handle->file_offset, count, ptr);
+  handle->file_offset += count;
+  return count;
+}
+
+Result<u32> MemoryFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
+{
+  if (fd >= REDIRECTED_FD_BASE)
+    return m_template->WriteBytesToFile(fd - REDIRECTED_FD_BASE, ptr, count);
+
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  if ((u8(handle->mode) & u8(Mode::Write)) == 0)
+    return ResultCode::AccessDenied;
+
+  Node* node = handle->node;
+  if (node->contents.size() < size_t{handle->file_offset} + count)
+    node->contents.resize(size_t{handle->file_offset} + count);
+  std::copy_n(ptr, count, node->contents.begin() + handle->file_offset);
+  node->data.size = static_cast<u32>(node->contents.size());
+  node->modified = true;
+
+  handle->file_offset += count;
+  return count;
+}
+
+Result<u32> MemoryFileSystem::SeekFile(Fd fd, u32 offset, SeekMode mode)
+{
+  if (fd >= REDIRECTED_FD_BASE)
+    return m_template->SeekFile(fd - REDIRECTED_FD_BASE, offset, mode);
+
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  const u32 file_size = static_cast<u32>(handle->node->contents.size());
+  u32 new_position = 0;
+  switch (mode)
+  {
+  case SeekMode::Set:
+    new_position = offset;
+    break;
+  case SeekMode::Current:
+    new_position = handle->file_offset + offset;
+    break;
+  case SeekMode::End:
+    new_position = file_size + offset;
+    break;
+  default:
+    return ResultCode::Invalid;
+  }
+
+  // This differs from POSIX behaviour which allows seeking past the end of the file.
+  if (file_size < new_position)
+    return ResultCode::Invalid;
+
+  handle->file_offset = new_position;
+  return handle->file_offset;
+}
+
+Result<FileStatus> MemoryFileSystem::GetFileStatus(Fd fd)
+{
+  if (fd >= REDIRECTED_FD_BASE)
+    return m_template->GetFileStatus(fd - REDIRECTED_FD_BASE);
+
+  const Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  FileStatus status;
+  status.size = static_cast<u32>(handle->node->contents.size());
+  status.offset = handle->file_offset;
+  return status;
+}
+
+ResultCode MemoryFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
+                                                   FileAttribute attr, Modes modes, bool is_file)
+{
+  if (IsRedirected(path))
+  {
+    return is_file ? m_template->CreateFile(uid, gid, path, attr, modes) :
+                     m_template->CreateDirectory(uid, gid, path, attr, modes);
+  }
+
+  if (!IsValidNonRootPath(path) || !std::ranges::all_of(path, Common::IsPrintableCharacter))
+    return ResultCode::Invalid;
+
+  if (!is_file && std::ranges::count(path, '/') > int(MaxPathDepth))
+    return ResultCode::TooManyPathComponents;
+
+  const auto split_path = SplitPathAndBasename(path);
+
+  Node* parent = FindNode(split_path.parent);
+  if (!parent)
+    return ResultCode::NotFound;
+
+  if (!parent->CheckPermission(uid, gid, Mode::Write))
+    return ResultCode::AccessDenied;
+
+  if (FindChild(parent, split_path.file_name))
+    return ResultCode::AlreadyExists;
+
+  if (parent->data.is_file)
+    return ResultCode::UnknownError;
+
+  auto& child = parent->children.emplace_back(std::make_unique<Node>());
+  child->name = split_path.file_name;
+  child->data.is_file = is_file;
+  child->data.modes = modes;
+  child->data.uid = uid;
+  child->data.gid = gid;
+  child->data.attribute = attr;
+  child->modified = true;
+  return ResultCode::Success;
+}
+
+ResultCode MemoryFileSystem::CreateFile(Uid uid, Gid gid, const std::string& path,
+                                        FileAttribute attr, Modes modes)
+{
+  return CreateFileOrDirectory(uid, gid, path, attr, modes, true);
+}
+
+ResultCode MemoryFileSystem::CreateDirectory(Uid uid, Gid gid, const std::string& path,
+                                             FileAttribute attr, Modes modes)
+{
+  return CreateFileOrDirectory(uid, gid, path, attr, modes, false);
+}
+
+ResultCode MemoryFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
+{
+  if (IsRedirected(path))
+    return m_template->Delete(uid, gid, path);
+
+  if (!IsValidNonRootPath(path))
+    return ResultCode::Invalid;
+
+  const auto split_path = SplitPathAndBasename(path);
+
+  Node* parent = FindNode(split_path.parent);
+  if (!parent)
+    return ResultCode::NotFound;
+
+  if (!parent->CheckPermission(uid, gid, Mode::Write))
+    return ResultCode::AccessDenied;
+
+  const Node* node = FindChild(parent, split_path.file_name);
+  if (!node)
+    return ResultCode::NotFound;
+
+  if (node->data.is_file ? IsFileOpened(path) : IsDirectoryInUse(path))
+    return ResultCode::InUse;
+
+  std::erase_if(parent->children, [node](const auto& child) { return child.get() == node; });
+  parent->children_removed = true;
+  return ResultCode::Success;
+}
+
+ResultCode MemoryFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
+                                    const std::string& new_path)
+{
+  if (IsRedirected(old_path) || IsRedirected(new_path))
+    return m_template->Rename(uid, gid, old_path, new_path);
+
+  if (!IsValidNonRootPath(old_path) || !IsValidNonRootPath(new_path))
+    return ResultCode::Invalid;
+
+  const auto split_old_path = SplitPathAndBasename(old_path);
+  const auto split_new_path = SplitPathAndBasename(new_path);
+
+  Node* old_parent = FindNode(split_old_path.parent);
+  Node* new_parent = FindNode(split_new_path.parent);
+  if (!old_parent || !new_parent)
+    return ResultCode::NotFound;
+
+  if (!old_parent->CheckPermission(uid, gid, Mode::Write) ||
+      !new_parent->CheckPermission(uid, gid, Mode::Write))
+  {
+    return ResultCode::AccessDenied;
+  }
+
+  Node* node = FindChild(old_parent, split_old_path.file_name);
+  if (!node)
+    return ResultCode::NotFound;
+
+  // For files, the file name is not allowed to change.
+  if (node->data.is_file && split_old_path.file_name != split_new_path.file_name)
+    return ResultCode::Invalid;
+
+  if ((!node->data.is_file && IsDirectoryInUse(old_path)) ||
+      (node->data.is_file && IsFileOpened(old_path)))
+  {
+    return ResultCode::InUse;
+  }
+
+  if (old_path == new_path)
+    return ResultCode::Success;
+
+  // Renaming can't put a directory inside itself, and the target must be in a directory.
+  if (new_parent->data.is_file || new_path.starts_with(old_path + '/'))
+    return ResultCode::NotFound;
+
+  // If there is already something of the same type at the new path, delete it.
+  if (const Node* existing = FindChild(new_parent, split_new_path.file_name))
+  {
+    if (existing->data.is_file != node->data.is_file)
+      return ResultCode::Invalid;
+    std::erase_if(new_parent->children,
+                  [existing](const auto& child) { return child.get() == existing; });
+    new_parent->children_removed = true;
+  }
+
+  // Finally, remove the node from the old parent and move it to the new parent.
+  const auto it = std::ranges::find_if(old_parent->children,
+                                       [node](const auto& child) { return child.get() == node; });
+  std::unique_ptr<Node> moved_node = std::move(*it);
+  old_parent->children.erase(it);
+  old_parent->children_removed = true;
+
+  moved_node->name = split_new_path.file_name;
+  MarkModified(moved_node.get());
+  new_parent->children.push_back(std::move(moved_node));
+  return ResultCode::Success;
+}
+
+Result<std::vector<std::string>> MemoryFileSystem::ReadDirectory(Uid uid, Gid gid,
+                                                                 const std::string& path)
+{
+  if (IsRedirected(path))
+    return m_template->ReadDirectory(uid, gid, path);
+
+  if (!IsValidPath(path))
+    return ResultCode::Invalid;
+
+  Node* node = FindNode(path);
+  if (!node)
+    return ResultCode::NotFound;
+
+  if (!node->CheckPermission(uid, gid, Mode::Read))
+    return ResultCode::AccessDenied;
+
+  if (node->data.is_file)
+    return ResultCode::Invalid;
+
+  // Newest entries come first, as Nintendo traverses a linked list in which new elements are
+  // inserted at the front.
+  std::vector<std::string> output;
+  output.reserve(node->children.size());
+  for (auto it = node->children.rbegin(); it != node->children.rend(); ++it)
+    output.push_back((*it)->name);
+  return output;
+}
+
+Result<Metadata> MemoryFileSystem::GetMetadata(Uid uid, Gid gid, const std::string& path)
+{
+  if (IsRedirected(path))
+    return m_template->GetMetadata(uid, gid, path);
+
+  const Node* node = nullptr;
+  if (path == "/")
+  {
+    node = &m_root;
+  }
+  else
+  {
+    if (!IsValidNonRootPath(path))
+      return ResultCode::Invalid;
+
+    const auto split_path = SplitPathAndBasename(path);
+    const Node* parent = FindNode(split_path.parent);
+    if (!parent)
+      return ResultCode::NotFound;
+    if (!parent->CheckPermission(uid, gid, Mode::Read))
+      return ResultCode::AccessDenied;
+    node = FindNode(path);
+  }
+
+  if (!node)
+    return ResultCode::NotFound;
+
+  return node->data;
+}
+
+ResultCode MemoryFileSystem::SetMetadata(Uid caller_uid, const std::string& path, Uid uid, Gid gid,
+                                         FileAttribute attr, Modes modes)
+{
+  if (IsRedirected(path))
+    return m_template->SetMetadata(caller_uid, path, uid, gid, attr, modes);
+
+  if (!IsValidPath(path))
+    return ResultCode::Invalid;
+
+  Node* node = FindNode(path);
+  if (!node)
+    return ResultCode::NotFound;
+
+  if (caller_uid != 0 && caller_uid != node->data.uid)
+    return ResultCode::AccessDenied;
+  if (caller_uid != 0 && uid != node->data.uid)
+    return ResultCode::AccessDenied;
+
+  if (node->data.uid != uid && node->data.is_file && node->data.size != 0)
+    return ResultCode::FileNotEmpty;
+
+  if (node->data.gid != gid || node->data.uid != uid || node->data.attribute != attr ||
+      node->data.modes != modes)
+  {
+    node->data.gid = gid;
+    node->data.uid = uid;
+    node->data.attribute = attr;
+    node->data.modes = modes;
+    node->modified = true;
+  }
+
+  return ResultCode::Success;
+}
+
+Result<NandStats> MemoryFileSystem::GetNandStats()
+{
+  const auto root_stats = GetDirectoryStats("/");
+  if (!root_stats)
+    return root_stats.Error();
+
+  NandStats stats{};
+  stats.cluster_size = CLUSTER_SIZE;
+  stats.free_clusters = USABLE_CLUSTERS - root_stats->used_clusters;
+  stats.used_clusters = root_stats->used_clusters;
+  stats.bad_clusters = 0;
+  stats.reserved_clusters = RESERVED_CLUSTERS;
+  stats.free_inodes = TOTAL_INODES - root_stats->used_inodes;
+  stats.used_inodes = root_stats->used_inodes;
+
+  return stats;
+}
+
+Result<DirectoryStats> MemoryFileSystem::GetDirectoryStats(const std::string& wii_path)
+{
+  const auto result = GetExtendedDirectoryStats(wii_path);
+  if (!result)
+    return result.Error();
+
+  DirectoryStats stats{};
+  stats.used_inodes = static_cast<u32>(std::min<u64>(result->used_inodes, TOTAL_INODES));
+  stats.used_clusters = static_cast<u32>(std::min<u64>(result->used_clusters, USABLE_CLUSTERS));
+  return stats;
+}
+
+Result<ExtendedDirectoryStats>
+MemoryFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
+{
+  if (IsRedirected(wii_path))
+    return m_template->GetExtendedDirectoryStats(wii_path);
+
+  if (!IsValidPath(wii_path))
+    return ResultCode::Invalid;
+
+  const Node* node = FindNode(wii_path);
+  if (!node)
+    return ResultCode::NotFound;
+  if (node->data.is_file)
+    return ResultCode::Invalid;
+
+  // Start with one inode for the directory itself.
+  ExtendedDirectoryStats stats{1, 0};
+  std::deque<const Node*> todo{node};
+  while (!todo.empty())
+  {
+    const Node* directory = todo.front();
+    todo.pop_front();
+    for (const auto& child : directory->children)
+    {
+      ++stats.used_inodes;
+      if (child->data.is_file)
+        stats.used_clusters += Common::AlignUp(child->data.size, CLUSTER_SIZE) / CLUSTER_SIZE;
+      else
+        todo.push_back(child.get());
+    }
+  }
+  return stats;
+}
+
+void MemoryFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
+{
+  // Redirected paths are passed through to the template file system, which applies the redirects.
+  m_nand_redirects = nand_redirects;
+  m_template->SetNandRedirects(std::move(nand_redirects));
+}
+
+bool MemoryFileSystem::LoadModifiedContents(Node* node)
+{
+  if (node->modified && !LoadContents(node))
+    return false;
+
+  return std::ranges::all_of(node->children, [this](const auto& child) {
+    return LoadModifiedContents(child.get());
+  });
+}
+
+bool MemoryFileSystem::FlushNode(const Node& node, const std::string& path)
+{
+  const Result<Metadata> existing = m_template->GetMetadata(0, 0, path);
+  if (existing && (existing->is_file || node.data.is_file))
+    m_template->Delete(0, 0, path);
+
+  const ResultCode result =
+      node.data.is_file ?
+          m_template->CreateFile(0, 0, path, node.data.attribute, node.data.modes) :
+          m_template->CreateDirectory(0, 0, path, node.data.attribute, node.data.modes);
+  if (result != ResultCode::Success && result != ResultCode::AlreadyExists)
+    return false;
+
+  // Set the owner before writing, since it can't be changed for files that aren't empty.
+  if (m_template->SetMetadata(0, path, node.data.uid, node.data.gid, node.data.attribute,
+                              node.data.modes) != ResultCode::Success)
+  {
+    return false;
+  }
+
+  if (!node.data.is_file || node.contents.empty())
+    return true;
+
+  const Result<FileHandle> file = m_template->OpenFile(0, 0, path, Mode::Write);
+  return file && file->Write(node.contents.data(), node.contents.size());
+}
+
+bool MemoryFileSystem::FlushDirectory(Node* directory, const std::string& path)
+{
+  if (directory->children_removed)
+  {
+    if (const Result<std::vector<std::string>> names = m_template->ReadDirectory(0, 0, path))
+    {
+      for (const std::string& name : *names)
+      {
+        if (!FindChild(directory, name))
+          m_template->Delete(0, 0, JoinPath(path, name));
+      }
+    }
+    directory->children_removed = false;
+  }
+
+  for (const auto& child : directory->children)
+  {
+    const std::string child_path = JoinPath(path, child->name);
+    if (child->modified)
+    {
+      if (!FlushNode(*child, child_path))
+      {
+        ERROR_LOG_FMT(IOS_FS, "Failed to write {} to the template NAND", child_path);
+        return false;
+      }
+      child->modified = false;
+    }
+
+    if (!child->data.is_file && !FlushDirectory(child.get(), child_path))
+      return false;
+  }
+
+  return true;
+}
+
+bool MemoryFileSystem::Flush()
+{
+  // The template files that modified nodes still refer to may get overwritten or deleted while
+  // flushing, so everything that is going to be written is read first.
+  if (!LoadModifiedContents(&m_root))
+    return false;
+
+  if (m_root.modified)
+  {
+    m_template->SetMetadata(0, "/", m_root.data.uid, m_root.data.gid, m_root.data.attribute,
+                            m_root.data.modes);
+    m_root.modified = false;
+  }
+
+  return FlushDirectory(&m_root, "/");
+}
+
+}  // namespace IOS::HLE::FS
@@ -0,0 +1,129 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/IOS/FS/FileSystem.h"
+
+namespace IOS::HLE::FS
+{
+class HostFileSystem;
+
+/// Backend that keeps the NAND in memory, using a NAND on the host file system as a template.
+///
+/// The directory structure and metadata of the template are read once on construction. File
+/// contents are read from the template when a file is first opened. Changes are only kept in
+/// memory unless Flush is called, so sessions that don't need to keep their NAND changes
+/// barely touch the host file system.
+///
+/// Paths that are covered by a NAND redirect are passed through to the template, which applies the
+/// redirects like usual. Handles to redirected files are not part of savestates.
+class MemoryFileSystem final : public FileSystem
+{
+public:
+  explicit MemoryFileSystem(const std::string& template_root_path);
+  ~MemoryFileSystem() override;
+
+  void DoState(PointerWrap& p) override;
+
+  ResultCode Format(Uid uid) override;
+
+  Result<FileHandle> OpenFile(Uid uid, Gid gid, const std::string& path, Mode mode) override;
+  ResultCode Close(Fd fd) override;
+  Result<u32> ReadBytesFromFile(Fd fd, u8* ptr, u32 size) override;
+  Result<u32> WriteBytesToFile(Fd fd, const u8* ptr, u32 size) override;
+  Result<u32> SeekFile(Fd fd, u32 offset, SeekMode mode) override;
+  Result<FileStatus> GetFileStatus(Fd fd) override;
+
+  ResultCode CreateFile(Uid caller_uid, Gid caller_gid, const std::string& path,
+                        FileAttribute attribute, Modes modes) override;
+
+  ResultCode CreateDirectory(Uid caller_uid, Gid caller_gid, const std::string& path,
+                             FileAttribute attribute, Modes modes) override;
+
+  ResultCode Delete(Uid caller_uid, Gid caller_gid, const std::string& path) override;
+  ResultCode Rename(Uid caller_uid, Gid caller_gid, const std::string& old_path,
+                    const std::string& new_path) override;
+
+  Result<std::vector<std::string>> ReadDirectory(Uid caller_uid, Gid caller_gid,
+                                                 const std::string& path) override;
+
+  Result<Metadata> GetMetadata(Uid caller_uid, Gid caller_gid, const std::string& path) override;
+  ResultCode SetMetadata(Uid caller_uid, const std::string& path, Uid uid, Gid gid,
+                         FileAttribute attribute, Modes modes) override;
+
+  Result<NandStats> GetNandStats() override;
+  Result<DirectoryStats> GetDirectoryStats(const std::string& path) override;
+  Result<ExtendedDirectoryStats> GetExtendedDirectoryStats(const std::string& path) override;
+
+  void SetNandRedirects(std::vector<NandRedirect> nand_redirects) override;
+
+  /// Writes all changes made since construction (or the last flush) to the template NAND.
+  bool Flush();
+
+private:
+  struct Node
+  {
+    bool CheckPermission(Uid uid, Gid gid, Mode requested_mode) const;
+
+    std::string name;
+    /// The size is kept up to date for files.
+    Metadata data{};
+    /// For files whose contents haven't been read yet, the path of the file in the template.
+    std::string template_path;
+    std::vector<u8> contents;
+    /// Whether the node has to be written to the template when flushing.
+    bool modified = false;
+    /// Whether any children have been deleted or moved away since the last flush.
+    bool children_removed = false;
+    /// Children of this node, oldest first. Only valid for directories.
+    std::vector<std::unique_ptr<Node>> children;
+  };
+
+  struct Handle
+  {
+    bool opened = false;
+    Mode mode = Mode::None;
+    std::string wii_path;
+    Node* node = nullptr;
+    u32 file_offset = 0;
+  };
+  Handle* AssignFreeHandle();
+  Handle* GetHandleFromFd(Fd fd);
+  Fd ConvertHandleToFd(const Handle* handle) const;
+
+  void LoadTemplateDirectory(Node* directory, const std::string& path);
+  bool LoadContents(Node* node);
+  Node* FindNode(const std::string& path);
+  static Node* FindChild(Node* directory, std::string_view name);
+  static void MarkModified(Node* node);
+
+  bool IsRedirected(const std::string& path) const;
+  bool IsFileOpened(const std::string& path) const;
+  bool IsDirectoryInUse(const std::string& path) const;
+
+  ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
+                                   FileAttribute attribute, Modes modes, bool is_file);
+
+  void DoStateWriteOrMeasure(PointerWrap& p, Node* directory, const std::string& relative_path);
+  void DoStateRead(PointerWrap& p, const std::string& directory_path);
+
+  bool LoadModifiedContents(Node* node);
+  bool FlushDirectory(Node* directory, const std::string& path);
+  bool FlushNode(const Node& node, const std::string& path);
+
+  std::unique_ptr<HostFileSystem> m_template;
+  Node m_root{};
+  std::array<Handle, 16> m_handles{};
+
+  std::vector<NandRedirect> m_nand_redirects;
+};
+
+}  // namespace IOS::HLE::FS
@@ -318,7 +318,11 @@ EmulationKernel::EmulationKernel(Core::System& system, u64 title_id)
     return;
   }
 
-  m_fs = FS::MakeFileSystem(IOS::HLE::FS::Location::Session, Core::GetActiveNandRedirects());
+  m_fs = Core::GetMemoryNand();
+  if (m_fs)
+    m_fs->SetNandRedirects(Core::GetActiveNandRedirects());
+  else
+    m_fs = FS::MakeFileSystem(IOS::HLE::FS::Location::Session, Core::GetActiveNandRedirects());
   ASSERT(m_fs);
 
   AddDevice(std::make_unique<AesDevice>(*this, "/dev/aes"));
@@ -1004,6 +1004,11 @@ void WiiSockMan::Update()
   FD_ZERO(&write_fds);
   FD_ZERO(&except_fds);
 
+  // Only sockets with pending operations need their state queried, since Update does nothing for
+  // the others. Titles tend to keep most of their sockets idle, so this keeps the cost of each
+  // update proportional to the number of sockets that are actually in use.
+  bool any_pending_sockops = false;
+
   auto socket_iter = WiiSockets.begin();
   auto end_socks = WiiSockets.end();
 
@@ -1012,10 +1017,14 @@ void WiiSockMan::Update()
     const WiiSocket& sock = socket_iter->second;
     if (sock.IsValid())
     {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
+      if (!sock.pending_sockops.empty())
+      {
+        FD_SET(sock.fd, &read_fds);
+        FD_SET(sock.fd, &write_fds);
+        FD_SET(sock.fd, &except_fds);
+        nfds = std::max(nfds, sock.fd + 1);
+        any_pending_sockops = true;
+      }
       ++socket_iter;
     }
     else
@@ -1025,22 +1034,25 @@ void WiiSockMan::Update()
     }
   }
 
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
-
-  if (ret >= 0)
+  if (any_pending_sockops)
   {
+    const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
+
     for (auto& pair : WiiSockets)
     {
       WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
-    }
-  }
-  else
-  {
-    for (auto& elem : WiiSockets)
-    {
-      elem.second.Update(false, false, false);
+      if (sock.pending_sockops.empty())
+        continue;
+
+      if (ret >= 0)
+      {
+        sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
+                    FD_ISSET(sock.fd, &except_fds) != 0);
+      }
+      else
+      {
+        sock.Update(false, false, false);
+      }
     }
   }
   UpdatePollCommands();
@@ -0,0 +1,227 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/SDIO/SDCardCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace IOS::HLE
+{
+SDCardCache::SDCardCache(File::IOFile& file) : m_file(file)
+{
+  m_worker.Reset("SD Card Cache");
+}
+
+SDCardCache::~SDCardCache()
+{
+  m_worker.Shutdown();
+  std::lock_guard lk(m_mutex);
+  FlushLocked();
+}
+
+u64 SDCardCache::GetFileSize()
+{
+  if (!m_file_size_known)
+  {
+    m_file_size = m_file.GetSize();
+    m_file_size_known = true;
+  }
+  return m_file_size;
+}
+
+SDCardCache::Chunk* SDCardCache::GetChunk(u64 index, bool needs_contents)
+{
+  auto it = m_chunks.find(index);
+  if (it == m_chunks.end())
+  {
+    const u64 offset = index * CHUNK_SIZE;
+    Chunk chunk;
+    const u64 file_size = GetFileSize();
+    chunk.data.resize(offset < file_size ? std::min<u64>(CHUNK_SIZE, file_size - offset) : 0);
+    if (needs_contents && !chunk.data.empty())
+    {
+      m_file.ClearError();
+      if (!m_file.Seek(offset, File::SeekOrigin::Begin) ||
+          !m_file.ReadBytes(chunk.data.data(), chunk.data.size()))
+      {
+        ERROR_LOG_FMT(IOS_SD, "Failed to read {} bytes at {:#x} from the SD card image",
+                      chunk.data.size(), offset);
+        return nullptr;
+      }
+    }
+    chunk.last_use = ++m_use_counter;
+    it = m_chunks.emplace(index, std::move(chunk)).first;
+    EvictIfNeeded();
+  }
+  else
+  {
+    it->second.last_use = ++m_use_counter;
+  }
+
+  return &it->second;
+}
+
+bool SDCardCache::WriteBack(u64 index, Chunk& chunk)
+{
+  if (!chunk.dirty)
+    return true;
+
+  chunk.dirty = false;
+  --m_num_dirty_chunks;
+
+  m_file.ClearError();
+  if (!m_file.Seek(index * CHUNK_SIZE, File::SeekOrigin::Begin) ||
+      !m_file.WriteBytes(chunk.data.data(), chunk.data.size()))
+  {
+    ERROR_LOG_FMT(IOS_SD, "Failed to write {} bytes at {:#x} to the SD card image",
+                  chunk.data.size(), index * CHUNK_SIZE);
+    return false;
+  }
+  return true;
+}
+
+void SDCardCache::EvictIfNeeded()
+{
+  while (m_chunks.size() > MAX_CHUNKS)
+  {
+    const auto oldest = std::ranges::min_element(
+        m_chunks, {}, [](const auto& entry) { return entry.second.last_use; });
+    WriteBack(oldest->first, oldest->second);
+    m_chunks.erase(oldest);
+  }
+}
+
+bool SDCardCache::FlushLocked()
+{
+  if (m_num_dirty_chunks == 0)
+    return true;
+
+  // Write in image order to keep the host writes sequential.
+  std::vector<u64> dirty_chunks;
+  dirty_chunks.reserve(m_num_dirty_chunks);
+  for (const auto& [index, chunk] : m_chunks)
+  {
+    if (chunk.dirty)
+      dirty_chunks.push_back(index);
+  }
+  std::ranges::sort(dirty_chunks);
+
+  bool success = true;
+  for (const u64 index : dirty_chunks)
+    success &= WriteBack(index, m_chunks[index]);
+  success &= m_file.Flush();
+  return success;
+}
+
+bool SDCardCache::Flush()
+{
+  m_worker.WaitForCompletion();
+  std::lock_guard lk(m_mutex);
+  return FlushLocked();
+}
+
+void SDCardCache::Reset()
+{
+  Flush();
+  std::lock_guard lk(m_mutex);
+  m_chunks.clear();
+  m_num_dirty_chunks = 0;
+  m_file_size_known = false;
+  m_last_read_end = ~u64{0};
+  m_last_prefetched_chunk = ~u64{0};
+}
+
+void SDCardCache::Prefetch(u64 index)
+{
+  std::lock_guard lk(m_mutex);
+  if (!m_chunks.contains(index))
+    GetChunk(index, true);
+}
+
+bool SDCardCache::Read(u64 offset, u8* data, u32 size)
+{
+  std::unique_lock lk(m_mutex);
+  const u64 file_size = GetFileSize();
+  if (offset > file_size || size > file_size - offset)
+  {
+    ERROR_LOG_FMT(IOS_SD, "Read of {} bytes at {:#x} is past the end of the SD card image", size,
+                  offset);
+    return false;
+  }
+
+  const bool is_sequential = offset == m_last_read_end;
+  while (size != 0)
+  {
+    const Chunk* chunk = GetChunk(offset / CHUNK_SIZE, true);
+    if (!chunk)
+      return false;
+
+    const u32 chunk_offset = static_cast<u32>(offset % CHUNK_SIZE);
+    const u32 length = std::min(size, CHUNK_SIZE - chunk_offset);
+    std::memcpy(data, chunk->data.data() + chunk_offset, length);
+    data += length;
+    offset += length;
+    size -= length;
+  }
+  m_last_read_end = offset;
+
+  // Sequential reads are likely to continue into the next chunk, so start reading it already.
+  const u64 next_index = offset / CHUNK_SIZE + 1;
+  if (is_sequential && next_index != m_last_prefetched_chunk &&
+      next_index * CHUNK_SIZE < file_size && !m_chunks.contains(next_index))
+  {
+    m_last_prefetched_chunk = next_index;
+    lk.unlock();
+    m_worker.Push([this, next_index] { Prefetch(next_index); });
+  }
+
+  return true;
+}
+
+bool SDCardCache::Write(u64 offset, const u8* data, u32 size)
+{
+  std::unique_lock lk(m_mutex);
+
+  while (size != 0)
+  {
+    const u32 chunk_offset = static_cast<u32>(offset % CHUNK_SIZE);
+    const u32 length = std::min(size, CHUNK_SIZE - chunk_offset);
+
+    // Chunks that are overwritten completely don't need to be read first.
+    Chunk* chunk = GetChunk(offset / CHUNK_SIZE, length != CHUNK_SIZE);
+    if (!chunk)
+      return false;
+
+    if (chunk->data.size() < chunk_offset + length)
+      chunk->data.resize(chunk_offset + length);
+    std::memcpy(chunk->data.data() + chunk_offset, data, length);
+    if (!chunk->dirty)
+    {
+      chunk->dirty = true;
+      ++m_num_dirty_chunks;
+    }
+
+    data += length;
+    offset += length;
+    size -= length;
+    m_file_size = std::max(GetFileSize(), offset);
+  }
+
+  if (m_num_dirty_chunks >= DIRTY_CHUNKS_FLUSH_THRESHOLD && !m_flush_pending)
+  {
+    m_flush_pending = true;
+    lk.unlock();
+    m_worker.Push([this] {
+      std::lock_guard lock(m_mutex);
+      m_flush_pending = false;
+      FlushLocked();
+    });
+  }
+
+  return true;
+}
+}  // namespace IOS::HLE
@@ -0,0 +1,76 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+
+namespace File
+{
+class IOFile;
+}
+
+namespace IOS::HLE
+{
+// Write-back cache for the SD card image.
+//
+// The image is cached in fixed-size chunks. Sequential reads prefetch the following chunk on a
+// worker thread, and writes are only written to the image when enough chunks are dirty (again on
+// the worker thread), when a chunk is evicted, or when the cache is flushed.
+class SDCardCache
+{
+public:
+  explicit SDCardCache(File::IOFile& file);
+  ~SDCardCache();
+
+  SDCardCache(const SDCardCache&) = delete;
+  SDCardCache& operator=(const SDCardCache&) = delete;
+
+  bool Read(u64 offset, u8* data, u32 size);
+  bool Write(u64 offset, const u8* data, u32 size);
+
+  // Writes all dirty chunks to the image.
+  bool Flush();
+
+  // Flushes and empties the cache. Must be called before the image is closed or reopened.
+  void Reset();
+
+private:
+  static constexpr u32 CHUNK_SIZE = 0x10000;
+  static constexpr size_t MAX_CHUNKS = 256;
+  static constexpr size_t DIRTY_CHUNKS_FLUSH_THRESHOLD = 32;
+
+  struct Chunk
+  {
+    std::vector<u8> data;
+    u64 last_use = 0;
+    bool dirty = false;
+  };
+
+  u64 GetFileSize();
+  Chunk* GetChunk(u64 index, bool needs_contents);
+  bool WriteBack(u64 index, Chunk& chunk);
+  bool FlushLocked();
+  void EvictIfNeeded();
+  void Prefetch(u64 index);
+
+  File::IOFile& m_file;
+  u64 m_file_size = 0;
+  bool m_file_size_known = false;
+
+  std::mutex m_mutex;
+  std::unordered_map<u64, Chunk> m_chunks;
+  u64 m_use_counter = 0;
+  size_t m_num_dirty_chunks = 0;
+  bool m_flush_pending = false;
+  u64 m_last_read_end = ~u64{0};
+  u64 m_last_prefetched_chunk = ~u64{0};
+
+  Common::AsyncWorkThreadSP m_worker;
+};
+}  // namespace IOS::HLE
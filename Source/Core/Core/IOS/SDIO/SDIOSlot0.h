@@ -13,6 +13,7 @@
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/IOS.h"
+#include "Core/IOS/SDIO/SDCardCache.h"
 
 class PointerWrap;
 
@@ -166,6 +167,8 @@ private:
   std::array<u32, 0x200 / sizeof(u32)> m_registers{};
 
   File::IOFile m_card;
+  // Must be declared after m_card, so that it is flushed before the image is closed.
+  SDCardCache m_card_cache{m_card};
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_config_callback_id;
   bool m_sd_card_inserted = false;
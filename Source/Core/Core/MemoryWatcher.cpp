@@ -3,23 +3,42 @@
 
 #include "Core/MemoryWatcher.h"
 
+#include <algorithm>
+#include <bit>
+#include <cerrno>
 #include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
+#include <new>
 #include <sstream>
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/MMU.h"
 
+static_assert(std::atomic<u64>::is_always_lock_free && std::atomic<u32>::is_always_lock_free,
+              "The ring is shared with other processes, so its atomics must not use locks");
+
 MemoryWatcher::MemoryWatcher()
 {
   m_running = false;
   if (!LoadAddresses(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX)))
     return;
-  if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+  if (Config::Get(Config::MAIN_MEMORY_WATCHER_RING))
+  {
+    if (!OpenRing(File::GetUserPath(F_MEMORYWATCHERRING_IDX)))
+      return;
+  }
+  else if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+  {
     return;
+  }
   m_running = true;
 }
 
@@ -29,7 +48,10 @@ MemoryWatcher::~MemoryWatcher()
     return;
 
   m_running = false;
-  close(m_fd);
+  if (m_ring_header)
+    munmap(m_ring_header, m_ring_size);
+  else
+    close(m_fd);
 }
 
 bool MemoryWatcher::LoadAddresses(const std::string& path)
@@ -39,23 +61,35 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   if (!locations)
     return false;
 
+  std::map<std::pair<u32, u32>, u32> node_lookup;
   std::string line;
   while (std::getline(locations, line))
-    ParseLine(line);
+    ParseLine(line, &node_lookup);
 
-  return !m_values.empty();
+  m_node_values.resize(m_nodes.size());
+  m_node_stopped.resize(m_nodes.size());
+
+  return !m_watches.empty();
 }
 
-void MemoryWatcher::ParseLine(const std::string& line)
+void MemoryWatcher::ParseLine(const std::string& line,
+                              std::map<std::pair<u32, u32>, u32>* node_lookup)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  u32 node = NO_NODE;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+  {
+    const auto [it, inserted] =
+        node_lookup->try_emplace({node, offset}, static_cast<u32>(m_nodes.size()));
+    if (inserted)
+      m_nodes.push_back({node, offset});
+    node = it->second;
+  }
+
+  m_watches.push_back({line, node});
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,46 +101,127 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+bool MemoryWatcher::OpenRing(const std::string& path)
 {
-  u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  // Enough room for every watch to change a few times before a reader has to catch up.
+  const u32 capacity =
+      std::bit_ceil(std::max<u32>(static_cast<u32>(m_watches.size()) * 8, 1024));
+  m_ring_size = sizeof(RingHeader) + capacity * sizeof(RingRecord);
+
+  const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (fd < 0)
   {
-    value = PowerPC::MMU::HostRead_U32(guard, value + offset);
-    if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
-      break;
+    ERROR_LOG_FMT(CORE, "Failed to open memory watcher ring {}: {}", path, strerror(errno));
+    return false;
+  }
+
+  void* const base = ftruncate(fd, m_ring_size) == 0 ?
+                         mmap(nullptr, m_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) :
+                         MAP_FAILED;
+  close(fd);
+  if (base == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to map memory watcher ring {}: {}", path, strerror(errno));
+    return false;
   }
-  return value;
+
+  m_ring_header = new (base) RingHeader{};
+  m_ring_records = reinterpret_cast<RingRecord*>(m_ring_header + 1);
+  for (u32 i = 0; i < capacity; ++i)
+    new (&m_ring_records[i]) RingRecord{RingRecord::INVALID_SEQUENCE, 0, 0};
+
+  m_ring_header->capacity = capacity;
+  m_ring_header->num_watches = static_cast<u32>(m_watches.size());
+  m_ring_header->version = RingHeader::VERSION;
+  m_ring_header->next_sequence.store(0, std::memory_order_relaxed);
+  // Readers check the magic last, so it must be written after everything else.
+  std::atomic_thread_fence(std::memory_order_release);
+  m_ring_header->magic = RingHeader::MAGIC;
+  return true;
 }
 
-std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
+void MemoryWatcher::ChasePointers(const Core::CPUThreadGuard& guard)
+{
+  for (size_t i = 0; i < m_nodes.size(); ++i)
+  {
+    const PointerNode& node = m_nodes[i];
+    u32 pointer = 0;
+    if (node.parent != NO_NODE)
+    {
+      pointer = m_node_values[node.parent];
+      if (m_node_stopped[node.parent])
+      {
+        m_node_values[i] = pointer;
+        m_node_stopped[i] = true;
+        continue;
+      }
+    }
+
+    const u32 value = PowerPC::MMU::HostRead_U32(guard, pointer + node.offset);
+    m_node_values[i] = value;
+    m_node_stopped[i] = !PowerPC::MMU::HostIsRAMAddress(guard, value);
+  }
+}
+
+std::string MemoryWatcher::ComposeMessages()
 {
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  for (Watch& watch : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+    const u32 new_value = watch.node != NO_NODE ? m_node_values[watch.node] : 0;
+    if (new_value != watch.value)
     {
       // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      watch.value = new_value;
+      message_stream << watch.address << '\n' << new_value << '\n';
     }
   }
 
   return message_stream.str();
 }
 
+void MemoryWatcher::WriteRecords()
+{
+  const u32 capacity = m_ring_header->capacity;
+  u64 sequence = m_ring_header->next_sequence.load(std::memory_order_relaxed);
+
+  for (u32 i = 0; i < m_watches.size(); ++i)
+  {
+    Watch& watch = m_watches[i];
+    const u32 new_value = watch.node != NO_NODE ? m_node_values[watch.node] : 0;
+    if (new_value == watch.value)
+      continue;
+
+    watch.value = new_value;
+
+    RingRecord& record = m_ring_records[sequence % capacity];
+    record.sequence.store(RingRecord::INVALID_SEQUENCE, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    record.watch_index.store(i, std::memory_order_relaxed);
+    record.value.store(new_value, std::memory_order_relaxed);
+    record.sequence.store(sequence, std::memory_order_release);
+    ++sequence;
+  }
+
+  m_ring_header->next_sequence.store(sequence, std::memory_order_release);
+}
+
 void MemoryWatcher::Step(const Core::CPUThreadGuard& guard)
 {
   if (!m_running)
     return;
 
-  std::string message = ComposeMessages(guard);
+  ChasePointers(guard);
+
+  if (m_ring_header)
+  {
+    WriteRecords();
+    return;
+  }
+
+  std::string message = ComposeMessages();
   sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
          sizeof(m_addr));
 }
@@ -5,10 +5,12 @@
 
 #include "Common/CommonTypes.h"
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <utility>
 #include <vector>
 
 namespace Core
@@ -24,28 +26,92 @@ class CPUThreadGuard;
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// If the MemoryWatcherRing setting is enabled, changes are instead written as
+// binary records to a ring in the memory-mapped file "Ring.bin", next to the
+// input file. See RingHeader and RingRecord for its layout.
 class MemoryWatcher final
 {
 public:
+  // The file starts with this header, followed by `capacity` records. All values are in the host's
+  // byte order.
+  struct RingHeader
+  {
+    static constexpr u32 MAGIC = 0x524D5744;  // "DWMR"
+    static constexpr u32 VERSION = 1;
+
+    u32 magic;
+    u32 version;
+    u32 capacity;
+    // The number of lines in the input file.
+    u32 num_watches;
+    // The sequence number of the next record to be written. The record with sequence number n is
+    // stored at index n % capacity, so readers which fall more than capacity records behind have
+    // missed changes.
+    std::atomic<u64> next_sequence;
+  };
+
+  // The writer sets sequence to INVALID_SEQUENCE before updating a record, and stores the record's
+  // sequence number after it. Readers should read sequence, then the contents, then sequence
+  // again, and only use the contents if both reads match the expected sequence number.
+  struct RingRecord
+  {
+    static constexpr u64 INVALID_SEQUENCE = ~u64(0);
+
+    std::atomic<u64> sequence;
+    // The zero-based line number of the watched address in the input file.
+    std::atomic<u32> watch_index;
+    std::atomic<u32> value;
+  };
+
   MemoryWatcher();
   ~MemoryWatcher();
   void Step(const Core::CPUThreadGuard& guard);
 
 private:
+  static constexpr u32 NO_NODE = ~u32(0);
+
+  // Pointer chains are stored as a tree, so that each pointer which several chains go through is
+  // only read once per frame.
+  struct PointerNode
+  {
+    u32 parent;
+    u32 offset;
+  };
+
+  struct Watch
+  {
+    // The line from the input file
+    std::string address;
+    // The node at the end of the pointer chain
+    u32 node;
+    u32 value = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
+  bool OpenRing(const std::string& path);
 
-  void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
-  std::string ComposeMessages(const Core::CPUThreadGuard& guard);
+  // node_lookup maps a parent and an offset to the existing node for them.
+  void ParseLine(const std::string& line, std::map<std::pair<u32, u32>, u32>* node_lookup);
+  void ChasePointers(const Core::CPUThreadGuard& guard);
+  std::string ComposeMessages();
+  void WriteRecords();
 
   bool m_running = false;
 
-  int m_fd;
+  int m_fd = -1;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  RingHeader* m_ring_header = nullptr;
+  RingRecord* m_ring_records = nullptr;
+  size_t m_ring_size = 0;
+
+  // Parents always come before their children.
+  std::vector<PointerNode> m_nodes;
+  // The value read at each node this frame
+  std::vector<u32> m_node_values;
+  // Whether a pointer along the node's chain wasn't in RAM, in which case the chain stops there
+  std::vector<u8> m_node_stopped;
+  std::vector<Watch> m_watches;
 };
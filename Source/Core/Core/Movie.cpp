@@ -549,6 +549,7 @@ bool MovieManager::BeginRecordingInput(const ControllerTypeArray& controllers,
     m_play_mode = PlayMode::Recording;
     m_author = Config::Get(Config::MAIN_MOVIE_MOVIE_AUTHOR);
     m_temp_input.clear();
+    m_saved_input_sizes.clear();
 
     m_current_byte = 0;
 
@@ -826,6 +827,7 @@ void MovieManager::RecordInput(const GCPadStatus* PadStatus, int controllerID)
 
   CheckPadStatus(PadStatus, controllerID);
 
+  InvalidateSavedInput(m_current_byte);
   m_temp_input.resize(m_current_byte + sizeof(ControllerState));
   memcpy(&m_temp_input[m_current_byte], &m_pad_state, sizeof(ControllerState));
   m_current_byte += sizeof(ControllerState);
@@ -855,6 +857,7 @@ void MovieManager::RecordWiimote(int wiimote, const SerializedWiimoteState& seri
   InputUpdate();
 
   const u8 size = serialized_state.length;
+  InvalidateSavedInput(m_current_byte);
   m_temp_input.resize(m_current_byte + size + 1);
   m_temp_input[m_current_byte++] = size;
   std::copy_n(serialized_state.data.data(), size, m_temp_input.data() + m_current_byte);
@@ -938,6 +941,7 @@ bool MovieManager::PlayInput(const std::string& movie_path,
   Core::UpdateWantDeterminism(m_system);
 
   m_temp_input.resize(recording_file.GetSize() - 256);
+  m_saved_input_sizes.clear();
   recording_file.ReadBytes(m_temp_input.data(), m_temp_input.size());
   m_current_byte = 0;
   recording_file.Close();
@@ -1036,6 +1040,7 @@ void MovieManager::LoadInput(const std::string& movie_path)
     m_total_tick_count = m_tick_count_at_last_input = m_temp_header.tickCount;
 
     m_temp_input.resize(static_cast<size_t>(totalSavedBytes));
+    m_saved_input_sizes.clear();
     t_record.ReadBytes(m_temp_input.data(), m_temp_input.size());
   }
   else if (m_current_byte > 0)
@@ -1078,6 +1083,7 @@ void MovieManager::LoadInput(const std::string& movie_path)
                          "read-only mode off. Otherwise you'll probably get a desync.",
                          byte_offset, byte_offset);
 
+          InvalidateSavedInput(static_cast<u64>(mismatch_index));
           std::ranges::copy(movInput, m_temp_input.begin());
         }
         else
@@ -1340,10 +1346,43 @@ void MovieManager::EndPlayInput(bool cont)
   }
 }
 
+// NOTE: CPU Thread / Host Thread
+void MovieManager::InvalidateSavedInput(u64 offset)
+{
+  // Input is usually only appended, unless a savestate has been loaded.
+  if (offset >= m_temp_input.size())
+    return;
+
+  for (auto& [filename, saved_size] : m_saved_input_sizes)
+    saved_size = std::min(saved_size, offset);
+}
+
 // NOTE: Save State + Host Thread
 void MovieManager::SaveRecording(const std::string& filename)
 {
-  File::IOFile save_record(filename, "wb");
+  // If this file already contains the start of the current input, only the rest has to be written.
+  // The end of the input in the file is compared in case the file was replaced in the meantime.
+  File::IOFile save_record;
+  u64 write_offset = 0;
+  const auto saved = m_saved_input_sizes.find(filename);
+  if (saved != m_saved_input_sizes.end() && saved->second != 0 &&
+      save_record.Open(filename, "r+b") &&
+      save_record.GetSize() >= sizeof(DTMHeader) + saved->second)
+  {
+    const u64 compare_size = std::min<u64>(saved->second, 4096);
+    std::vector<u8> saved_end(compare_size);
+    if (save_record.Seek(sizeof(DTMHeader) + saved->second - compare_size,
+                         File::SeekOrigin::Begin) &&
+        save_record.ReadBytes(saved_end.data(), saved_end.size()) &&
+        std::equal(saved_end.begin(), saved_end.end(),
+                   m_temp_input.begin() + (saved->second - compare_size)))
+    {
+      write_offset = saved->second;
+    }
+  }
+  if (write_offset == 0)
+    save_record.Open(filename, "wb");
+
   // Create the real header now and write it
   DTMHeader header;
   memset(&header, 0, sizeof(DTMHeader));
@@ -1391,9 +1430,19 @@ void MovieManager::SaveRecording(const std::string& filename)
   header.uniqueID = 0;
   // header.audioEmulator;
 
-  save_record.WriteArray(&header, 1);
+  const u64 end = sizeof(DTMHeader) + m_temp_input.size();
+  bool success = save_record.Seek(0, File::SeekOrigin::Begin) &&
+                 save_record.WriteArray(&header, 1) &&
+                 save_record.Seek(sizeof(DTMHeader) + write_offset, File::SeekOrigin::Begin) &&
+                 save_record.WriteBytes(m_temp_input.data() + write_offset,
+                                        m_temp_input.size() - write_offset) &&
+                 save_record.Flush() && (save_record.GetSize() == end || save_record.Resize(end));
+  save_record.Close();
 
-  bool success = save_record.WriteBytes(m_temp_input.data(), m_temp_input.size());
+  if (success)
+    m_saved_input_sizes[filename] = m_temp_input.size();
+  else
+    m_saved_input_sizes.erase(filename);
 
   if (success && m_recording_from_save_state)
   {
@@ -1524,5 +1573,6 @@ void MovieManager::Shutdown()
 {
   m_current_input_count = m_total_input_count = m_total_frames = m_tick_count_at_last_input = 0;
   m_temp_input.clear();
+  m_saved_input_sizes.clear();
 }
 }  // namespace Movie
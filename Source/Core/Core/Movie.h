@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstring>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -231,6 +232,8 @@ private:
   void CheckMD5();
   void GetMD5();
 
+  void InvalidateSavedInput(u64 offset);
+
   bool m_read_only = true;
   u32 m_rerecords = 0;
   PlayMode m_play_mode = PlayMode::None;
@@ -269,6 +272,10 @@ private:
 
   std::string m_current_file_name;
 
+  // For each DTM file that has been saved, how much of the current input it already contains.
+  // Saving to the same file again only appends the input recorded since then.
+  std::map<std::string, u64> m_saved_input_sizes;
+
   // m_input_display is used by both CPU and GPU (is mutable).
   std::mutex m_input_display_lock;
   std::array<std::string, 8> m_input_display;
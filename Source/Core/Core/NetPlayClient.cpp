@@ -402,6 +402,10 @@ void NetPlayClient::OnData(sf::Packet& packet)
     OnWiimoteData(packet);
     break;
 
+  case MessageID::SpectatorInputBatch:
+    OnSpectatorInputBatch(packet);
+    break;
+
   case MessageID::PadBuffer:
     OnPadBuffer(packet);
     break;
@@ -753,6 +757,47 @@ void NetPlayClient::OnWiimoteData(sf::Packet& packet)
   }
 }
 
+void NetPlayClient::OnSpectatorInputBatch(sf::Packet& packet)
+{
+  // The server's input packets for players, each prefixed by its size, in the order they were sent.
+  while (!packet.endOfPacket())
+  {
+    u32 size = 0;
+    packet >> size;
+
+    sf::Packet input_packet;
+    for (u32 i = 0; i < size && !packet.endOfPacket(); ++i)
+    {
+      u8 byte;
+      packet >> byte;
+      input_packet << byte;
+    }
+
+    MessageID mid;
+    input_packet >> mid;
+
+    switch (mid)
+    {
+    case MessageID::PadData:
+      OnPadData(input_packet);
+      break;
+
+    case MessageID::PadHostData:
+      OnPadHostData(input_packet);
+      break;
+
+    case MessageID::WiimoteData:
+      OnWiimoteData(input_packet);
+      break;
+
+    default:
+      PanicAlertFmtT("Unknown SpectatorInputBatch message received with id: {0}",
+                     static_cast<u8>(mid));
+      return;
+    }
+  }
+}
+
 void NetPlayClient::OnPadBuffer(sf::Packet& packet)
 {
   u32 size = 0;
@@ -1540,6 +1585,12 @@ void NetPlayClient::DisplayPlayersPing()
                        OSD::Duration::SHORT, OSD::Color::CYAN);
 }
 
+u32 NetPlayClient::GetMaxPing()
+{
+  std::lock_guard lkp(m_crit.players);
+  return GetPlayersMaxPing();
+}
+
 u32 NetPlayClient::GetPlayersMaxPing() const
 {
   return std::ranges::max_element(m_players, {}, [](const auto& kv) { return kv.second.ping; })
@@ -174,6 +174,10 @@ public:
 
   void AdjustPadBufferSize(unsigned int size);
 
+  // For the latency graph. The ping is the highest ping of all players.
+  u32 GetMaxPing();
+  u32 GetPadBufferSize() const { return m_target_buffer_size; }
+
   void SetWiiSyncData(std::unique_ptr<IOS::HLE::FS::FileSystem> fs, std::vector<u64> titles,
                       std::string redirect_folder);
 
@@ -288,6 +292,7 @@ private:
   void OnPadData(sf::Packet& packet);
   void OnPadHostData(sf::Packet& packet);
   void OnWiimoteData(sf::Packet& packet);
+  void OnSpectatorInputBatch(sf::Packet& packet);
   void OnPadBuffer(sf::Packet& packet);
   void OnHostInputAuthority(sf::Packet& packet);
   void OnGolfSwitch(sf::Packet& packet);
@@ -4,9 +4,11 @@
 #include "Core/NetPlayCommon.h"
 
 #include <algorithm>
+#include <functional>
+#include <memory>
 
 #include <fmt/format.h>
-#include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
@@ -15,78 +17,154 @@
 
 namespace NetPlay
 {
-constexpr u32 LZO_IN_LEN = 1024 * 64;
-constexpr u32 LZO_OUT_LEN = LZO_IN_LEN + (LZO_IN_LEN / 16) + 64 + 3;
+// Data is sent as a single Zstandard stream, split into parts that are each prefixed with their
+// size and followed by a part of size 0. Long distance matching is enabled since saves and memory
+// cards often contain the same data many megabytes apart.
+constexpr size_t COMPRESSION_INPUT_SIZE = 1024 * 1024;
+constexpr int COMPRESSION_LEVEL = 6;
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
+using CompressionContext = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
+using DecompressionContext = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
+
+static void AppendPart(sf::Packet& packet, const u8* data, size_t size)
 {
-  File::IOFile file(file_path, "rb");
-  if (!file)
-  {
-    PanicAlertFmtT("Failed to open file \"{0}\".", file_path);
-    return false;
-  }
+  packet << static_cast<u32>(size);
+  packet.append(data, size);
+}
 
-  const u64 size = file.GetSize();
+// Calls read to get the data in pieces of at most COMPRESSION_INPUT_SIZE bytes.
+static bool CompressIntoPacket(u64 size, const std::function<bool(u8*, size_t)>& read,
+                               sf::Packet& packet)
+{
   packet << size;
-
   if (size == 0)
     return true;
 
-  std::vector<u8> in_buffer(LZO_IN_LEN);
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+  CompressionContext context(ZSTD_createCCtx(), ZSTD_freeCCtx);
+  if (!context || ZSTD_isError(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel,
+                                                      COMPRESSION_LEVEL)) ||
+      ZSTD_isError(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_enableLongDistanceMatching, 1)) ||
+      ZSTD_isError(ZSTD_CCtx_setPledgedSrcSize(context.get(), size)))
+  {
+    PanicAlertFmtT("Internal Zstandard Error - compression failed");
+    return false;
+  }
+
+  std::vector<u8> in_buffer(static_cast<size_t>(std::min<u64>(size, COMPRESSION_INPUT_SIZE)));
+  std::vector<u8> out_buffer(ZSTD_CStreamOutSize());
 
-  lzo_uint i = 0;
-  while (true)
+  u64 position = 0;
+  bool finished = false;
+  while (!finished)
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
+    const size_t in_size = static_cast<size_t>(std::min<u64>(size - position, in_buffer.size()));
+    if (!read(in_buffer.data(), in_size))
+      return false;
+    position += in_size;
 
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
+    const ZSTD_EndDirective mode = position == size ? ZSTD_e_end : ZSTD_e_continue;
+    ZSTD_inBuffer input{in_buffer.data(), in_size, 0};
+    do
     {
-      cur_len = LZO_IN_LEN;
-    }
+      ZSTD_outBuffer output{out_buffer.data(), out_buffer.size(), 0};
+      const size_t result = ZSTD_compressStream2(context.get(), &output, &input, mode);
+      if (ZSTD_isError(result))
+      {
+        PanicAlertFmtT("Internal Zstandard Error - compression failed");
+        return false;
+      }
+
+      if (output.pos != 0)
+        AppendPart(packet, out_buffer.data(), output.pos);
+
+      finished = mode == ZSTD_e_end && result == 0;
+    } while (mode == ZSTD_e_end ? !finished : input.pos != input.size);
+  }
 
-    if (cur_len <= 0)
-      break;  // EOF
+  // Mark end of data
+  packet << static_cast<u32>(0);
 
-    if (!file.ReadBytes(in_buffer.data(), cur_len))
-    {
-      PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
-      return false;
-    }
+  return true;
+}
 
-    if (lzo1x_1_compress(in_buffer.data(), cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
-      return false;
-    }
+// Reads the size written by CompressIntoPacket, and then calls write with the decompressed data.
+static bool DecompressFromPacket(sf::Packet& packet, u64 size,
+                                 const std::function<bool(const u8*, size_t)>& write)
+{
+  DecompressionContext context(ZSTD_createDCtx(), ZSTD_freeDCtx);
+  if (!context)
+  {
+    PanicAlertFmtT("Internal Zstandard Error - decompression failed");
+    return false;
+  }
 
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+  std::vector<u8> in_buffer;
+  std::vector<u8> out_buffer(ZSTD_DStreamOutSize());
+  u64 decompressed_size = 0;
+
+  while (true)
+  {
+    u32 part_size = 0;
+    packet >> part_size;
+    if (!part_size)
+      break;  // We reached the end of the data stream
+    if (part_size > packet.getDataSize())
+      break;
 
-    if (cur_len != LZO_IN_LEN)
+    in_buffer.resize(part_size);
+    for (u8& byte : in_buffer)
+      packet >> byte;
+    if (!packet)
       break;
 
-    i += cur_len;
+    ZSTD_inBuffer input{in_buffer.data(), in_buffer.size(), 0};
+    ZSTD_outBuffer output;
+    // A full output buffer means that the decompressor might still have data buffered.
+    do
+    {
+      output = {out_buffer.data(), out_buffer.size(), 0};
+      if (ZSTD_isError(ZSTD_decompressStream(context.get(), &output, &input)) ||
+          output.pos > size - decompressed_size)
+      {
+        PanicAlertFmtT("Internal Zstandard Error - decompression failed");
+        return false;
+      }
+
+      decompressed_size += output.pos;
+      if (output.pos != 0 && !write(out_buffer.data(), output.pos))
+        return false;
+    } while (input.pos != input.size || output.pos == output.size);
   }
 
-  // Mark end of data
-  packet << static_cast<u32>(0);
+  if (decompressed_size != size)
+  {
+    PanicAlertFmtT("Internal Zstandard Error - decompression failed");
+    return false;
+  }
 
   return true;
 }
 
+bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
+{
+  File::IOFile file(file_path, "rb");
+  if (!file)
+  {
+    PanicAlertFmtT("Failed to open file \"{0}\".", file_path);
+    return false;
+  }
+
+  return CompressIntoPacket(
+      file.GetSize(),
+      [&](u8* data, size_t size) {
+        if (file.ReadBytes(data, size))
+          return true;
+        PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
+        return false;
+      },
+      packet);
+}
+
 static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::Packet& packet)
 {
   const u64 size = folder.children.size();
@@ -118,57 +196,15 @@ bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet
 
 bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet)
 {
-  const u64 size = in_buffer.size();
-  packet << size;
-
-  if (size == 0)
-    return true;
-
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
-
-  lzo_uint i = 0;
-  while (true)
-  {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
-
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
-
-    if (cur_len <= 0)
-      break;  // end of buffer
-
-    if (lzo1x_1_compress(&in_buffer[i], cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
-      return false;
-    }
-
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
-
-    if (cur_len != LZO_IN_LEN)
-      break;
-
-    i += cur_len;
-  }
-
-  // Mark end of data
-  packet << static_cast<u32>(0);
-
-  return true;
+  size_t position = 0;
+  return CompressIntoPacket(
+      in_buffer.size(),
+      [&](u8* data, size_t size) {
+        std::copy_n(in_buffer.begin() + position, size, data);
+        position += size;
+        return true;
+      },
+      packet);
 }
 
 bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
@@ -185,38 +221,12 @@ bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
     return false;
   }
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-  std::vector<u8> out_buffer(LZO_IN_LEN);
-
-  while (true)
-  {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
-
-    packet >> cur_len;
-    if (!cur_len)
-      break;  // We reached the end of the data stream
-
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
-
-    if (lzo1x_decompress(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
-      return false;
-    }
-
-    if (!file.WriteBytes(out_buffer.data(), new_len))
-    {
-      PanicAlertFmtT("Error writing file: {0}", file_path);
-      return false;
-    }
-  }
-
-  return true;
+  return DecompressFromPacket(packet, file_size, [&](const u8* data, size_t size) {
+    if (file.WriteBytes(data, size))
+      return true;
+    PanicAlertFmtT("Error writing file: {0}", file_path);
+    return false;
+  });
 }
 
 static bool DecompressPacketIntoFolderInternal(sf::Packet& packet, const std::string& folder_path)
@@ -264,36 +274,18 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
 {
   u64 size = Common::PacketReadU64(packet);
 
-  std::vector<u8> out_buffer(size);
+  std::vector<u8> out_buffer;
+  out_buffer.reserve(size);
 
   if (size == 0)
     return out_buffer;
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-
-  lzo_uint i = 0;
-  while (true)
-  {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
-
-    packet >> cur_len;
-    if (!cur_len)
-      break;  // We reached the end of the data stream
-
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
-
-    if (lzo1x_decompress(in_buffer.data(), cur_len, &out_buffer[i], &new_len, nullptr) != LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
-      return {};
-    }
-
-    i += new_len;
-  }
+  const bool success = DecompressFromPacket(packet, size, [&](const u8* data, size_t length) {
+    out_buffer.insert(out_buffer.end(), data, data + length);
+    return true;
+  });
+  if (!success)
+    return {};
 
   return out_buffer;
 }
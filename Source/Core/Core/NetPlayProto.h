@@ -153,6 +153,7 @@ enum class MessageID : u8
   PadBuffer = 0x62,
   PadHostData = 0x63,
   GBAConfig = 0x64,
+  SpectatorInputBatch = 0x65,
 
   WiimoteData = 0x70,
   WiimoteMapping = 0x71,
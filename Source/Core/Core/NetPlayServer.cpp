@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdio>
 #include <memory>
@@ -93,6 +94,11 @@
 
 namespace NetPlay
 {
+// How long inputs for spectators may be held back, and how large the batch may grow before it's
+// sent anyway. The size is kept below a typical MTU so that the batch isn't fragmented.
+constexpr u64 SPECTATOR_INPUT_BATCH_INTERVAL_MS = 100;
+constexpr std::size_t SPECTATOR_INPUT_BATCH_MAX_SIZE = 1024;
+
 NetPlayServer::~NetPlayServer()
 {
   if (is_connected)
@@ -280,7 +286,7 @@ void NetPlayServer::ThreadFunc()
     int net;
     if (m_traversal_client)
       m_traversal_client->HandleResends();
-    net = enet_host_service(m_server, &netEvent, 1000);
+    net = enet_host_service(m_server, &netEvent, GetSpectatorInputBatchTimeout());
     while (!m_async_queue.Empty())
     {
       INFO_LOG_FMT(NETPLAY, "Processing async queue event.");
@@ -691,6 +697,65 @@ void NetPlayServer::AdjustPadBufferSize(unsigned int size)
   }
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::UpdateAdaptivePadBuffer()
+{
+  std::lock_guard lkg(m_crit.game);
+
+  // The buffer doesn't determine the input delay with host input authority.
+  if (!Config::Get(Config::NETPLAY_ADAPTIVE_BUFFER) || m_host_input_authority)
+    return;
+
+  // Adjust at most once per ping interval, so that changes are gradual.
+  if (Common::Timer::NowMs() - m_last_adaptive_buffer_change_ms < 1000)
+    return;
+
+  // Inputs travel from one client to the host and then to the other clients, so the buffer has to
+  // cover the latency of the two slowest players. Four deviations are added so that jitter rarely
+  // makes inputs arrive late.
+  double slowest = 0, second_slowest = 0;
+  {
+    std::lock_guard lkp(m_crit.players);
+    for (const Client& player : std::views::values(m_players))
+    {
+      if (!player.has_ping_sample)
+        continue;
+      const double latency = player.smoothed_ping + 4 * player.ping_jitter;
+      if (latency > slowest)
+      {
+        second_slowest = slowest;
+        slowest = latency;
+      }
+      else
+      {
+        second_slowest = std::max(second_slowest, latency);
+      }
+    }
+  }
+
+  // The usual rule of thumb for the buffer size is the ping divided by 8.
+  const u32 min_buffer = Config::Get(Config::NETPLAY_ADAPTIVE_BUFFER_MIN);
+  const u32 max_buffer = std::max(min_buffer, Config::Get(Config::NETPLAY_ADAPTIVE_BUFFER_MAX));
+  const u32 target = std::clamp(static_cast<u32>(std::ceil((slowest + second_slowest) / 8)),
+                                min_buffer, max_buffer);
+
+  // Move one step at a time, and only shrink the buffer once it is clearly too large to avoid
+  // oscillating between two sizes.
+  unsigned int new_buffer_size = m_target_buffer_size;
+  if (target > m_target_buffer_size)
+    new_buffer_size = m_target_buffer_size + 1;
+  else if (target + 1 < m_target_buffer_size)
+    new_buffer_size = m_target_buffer_size - 1;
+
+  if (new_buffer_size == m_target_buffer_size)
+    return;
+
+  INFO_LOG_FMT(NETPLAY, "Adjusting the pad buffer from {} to {} (target {})",
+               m_target_buffer_size, new_buffer_size, target);
+  m_last_adaptive_buffer_change_ms = Common::Timer::NowMs();
+  AdjustPadBufferSize(new_buffer_size);
+}
+
 void NetPlayServer::SetHostInputAuthority(const bool enable)
 {
   std::lock_guard lkg(m_crit.game);
@@ -848,7 +913,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     }
     else
     {
-      SendToClients(spac, player.pid);
+      SendInputToClients(spac, player.pid);
     }
   }
   break;
@@ -880,7 +945,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       }
     }
 
-    SendToClients(spac, player.pid);
+    SendInputToClients(spac, player.pid);
   }
   break;
 
@@ -918,7 +983,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         spac << pad.data[i];
     }
 
-    SendToClients(spac, player.pid);
+    SendInputToClients(spac, player.pid);
   }
   break;
 
@@ -989,6 +1054,21 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (m_ping_key == ping_key)
     {
       player.ping = ping;
+
+      if (player.has_ping_sample)
+      {
+        const double deviation = std::abs(player.smoothed_ping - ping);
+        player.ping_jitter += (deviation - player.ping_jitter) / 4;
+        player.smoothed_ping += (ping - player.smoothed_ping) / 8;
+      }
+      else
+      {
+        player.smoothed_ping = ping;
+        player.ping_jitter = ping / 2.0;
+        player.has_ping_sample = true;
+      }
+
+      UpdateAdaptivePadBuffer();
     }
 
     sf::Packet spac;
@@ -2215,6 +2295,9 @@ u64 NetPlayServer::GetInitialNetPlayRTC() const
 void NetPlayServer::SendToClients(const sf::Packet& packet, const PlayerId skip_pid,
                                   const u8 channel_id)
 {
+  // Anything sent to everyone might depend on the inputs before it, so those go out first.
+  FlushSpectatorInputBatch();
+
   for (auto& p : std::views::values(m_players))
   {
     if (p.pid && p.pid != skip_pid)
@@ -2224,6 +2307,66 @@ void NetPlayServer::SendToClients(const sf::Packet& packet, const PlayerId skip_
   }
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::SendInputToClients(const sf::Packet& packet, const PlayerId skip_pid)
+{
+  std::lock_guard lkp(m_crit.players);
+
+  for (auto& p : std::views::values(m_players))
+  {
+    if (p.pid && p.pid != skip_pid && PlayerHasControllerMapped(p.pid))
+      Send(p.socket, packet);
+  }
+
+  if (m_spectator_input_batch.getDataSize() == 0)
+  {
+    m_spectator_input_batch << MessageID::SpectatorInputBatch;
+    m_spectator_input_batch_timer.Start();
+  }
+
+  m_spectator_input_batch << static_cast<u32>(packet.getDataSize());
+  m_spectator_input_batch.append(packet.getData(), packet.getDataSize());
+
+  if (m_spectator_input_batch.getDataSize() >= SPECTATOR_INPUT_BATCH_MAX_SIZE)
+    FlushSpectatorInputBatch();
+}
+
+// called from multiple threads
+void NetPlayServer::FlushSpectatorInputBatch()
+{
+  std::lock_guard lkp(m_crit.players);
+
+  if (m_spectator_input_batch.getDataSize() == 0)
+    return;
+
+  std::vector<ENetPeer*> spectators;
+  for (auto& p : std::views::values(m_players))
+  {
+    if (p.pid && !PlayerHasControllerMapped(p.pid))
+      spectators.push_back(p.socket);
+  }
+
+  // Every spectator gets the same packet, so it's only built once however many are watching.
+  Common::ENet::SendPacketToPeers(spectators, m_spectator_input_batch, DEFAULT_CHANNEL);
+  m_spectator_input_batch.clear();
+}
+
+// called from ---NETPLAY--- thread
+int NetPlayServer::GetSpectatorInputBatchTimeout()
+{
+  std::lock_guard lkp(m_crit.players);
+
+  if (m_spectator_input_batch.getDataSize() == 0)
+    return 1000;
+
+  const u64 elapsed = m_spectator_input_batch_timer.ElapsedMs();
+  if (elapsed < SPECTATOR_INPUT_BATCH_INTERVAL_MS)
+    return static_cast<int>(SPECTATOR_INPUT_BATCH_INTERVAL_MS - elapsed);
+
+  FlushSpectatorInputBatch();
+  return 1000;
+}
+
 void NetPlayServer::Send(ENetPeer* socket, const sf::Packet& packet, const u8 channel_id)
 {
   Common::ENet::SendPacket(socket, packet, channel_id);
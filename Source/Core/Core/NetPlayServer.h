@@ -91,6 +91,10 @@ private:
 
     ENetPeer* socket = nullptr;
     u32 ping = 0;
+    // Smoothed round trip time and its mean deviation, in milliseconds (as in RFC 6298)
+    double smoothed_ping = 0;
+    double ping_jitter = 0;
+    bool has_ping_sample = false;
     u32 current_game = 0;
 
     Common::QoSSession qos_session;
@@ -136,6 +140,9 @@ private:
   void SendResponseToAllPlayers(const MessageID message_id, Data&&... data_to_send);
   void SendToClients(const sf::Packet& packet, PlayerId skip_pid = 0,
                      u8 channel_id = DEFAULT_CHANNEL);
+  void SendInputToClients(const sf::Packet& packet, PlayerId skip_pid);
+  void FlushSpectatorInputBatch();
+  int GetSpectatorInputBatchTimeout();
   void Send(ENetPeer* socket, const sf::Packet& packet, u8 channel_id = DEFAULT_CHANNEL);
   ConnectionError OnConnect(ENetPeer* socket, sf::Packet& received_packet);
   unsigned int OnDisconnect(const Client& player);
@@ -146,6 +153,7 @@ private:
   void OnConnectFailed(Common::TraversalConnectFailedReason) override {}
   void OnTtlDetermined(u8 ttl) override;
   void UpdatePadMapping();
+  void UpdateAdaptivePadBuffer();
   void UpdateGBAConfig();
   void UpdateWiimoteMapping();
   std::vector<std::pair<std::string, std::string>> GetInterfaceListInternal() const;
@@ -171,6 +179,7 @@ private:
   bool m_update_pings = false;
   u32 m_current_game = 0;
   unsigned int m_target_buffer_size = 0;
+  u64 m_last_adaptive_buffer_change_ms = 0;
   PadMappingArray m_pad_map;
   GBAConfigArray m_gba_config;
   PadMappingArray m_wiimote_map;
@@ -183,6 +192,11 @@ private:
   PlayerId m_current_golfer = 1;
   PlayerId m_pending_golfer = 0;
 
+  // Spectators don't need inputs as soon as they're available, so they're collected here and
+  // sent out in one packet shared by all of them. Guarded by m_crit.players.
+  sf::Packet m_spectator_input_batch;
+  Common::Timer m_spectator_input_batch_timer;
+
   std::map<PlayerId, Client> m_players;
 
   std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_timebase_by_frame;
@@ -14,6 +14,7 @@
 #include <optional>
 #include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -48,6 +49,8 @@ constexpr std::array<const char*, 3> s_patch_type_strings{{
 static std::vector<Patch> s_on_frame;
 static std::vector<std::size_t> s_on_frame_memory;
 static std::mutex s_on_frame_memory_mutex;
+static std::vector<Patch> s_gecko_patches;
+static std::mutex s_gecko_patches_mutex;
 
 const char* PatchTypeAsString(PatchType type)
 {
@@ -255,6 +258,12 @@ static void ApplyPatches(const Core::CPUThreadGuard& guard, const std::vector<Pa
   }
 }
 
+static void ApplyGeckoPatches(const Core::CPUThreadGuard& guard)
+{
+  std::lock_guard lock(s_gecko_patches_mutex);
+  ApplyPatches(guard, s_gecko_patches);
+}
+
 static void ApplyMemoryPatches(const Core::CPUThreadGuard& guard,
                                std::span<const std::size_t> memory_patch_indices)
 {
@@ -305,6 +314,12 @@ void RemoveMemoryPatch(std::size_t index)
   std::erase(s_on_frame_memory, index);
 }
 
+void SetGeckoPatches(std::vector<Patch> patches)
+{
+  std::lock_guard lock(s_gecko_patches_mutex);
+  s_gecko_patches = std::move(patches);
+}
+
 static void ApplyStartupPatches(Core::System& system)
 {
   ASSERT(Core::IsCPUThread());
@@ -347,6 +362,7 @@ bool ApplyFramePatches(Core::System& system)
   ApplyMemoryPatches(guard, s_on_frame_memory);
 
   // Run the Gecko code handler
+  ApplyGeckoPatches(guard);
   Gecko::RunCodeHandler(guard);
   ActionReplay::RunAllActive(guard);
 
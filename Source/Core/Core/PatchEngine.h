@@ -59,6 +59,9 @@ void LoadPatches();
 void AddMemoryPatch(std::size_t index);
 void RemoveMemoryPatch(std::size_t index);
 
+// Patches converted from Gecko codes, which are applied every frame before the code handler runs.
+void SetGeckoPatches(std::vector<Patch> patches);
+
 bool ApplyFramePatches(Core::System& system);
 void Shutdown();
 void Reload(Core::System& system);
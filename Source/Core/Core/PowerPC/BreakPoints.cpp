@@ -353,6 +353,7 @@ void MemChecks::Update()
     m_mem_breakpoints_set = HasAny();
   }
 
+  // This also updates which pages of the fastmem arena are protected for the memchecks.
   m_system.GetMMU().DBATUpdated();
 }
 
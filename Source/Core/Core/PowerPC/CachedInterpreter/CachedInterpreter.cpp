@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 
+#include <algorithm>
 #include <span>
 #include <sstream>
 #include <utility>
@@ -131,6 +132,15 @@ s32 CachedInterpreter::Interpret(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+template <std::size_t count>
+s32 CachedInterpreter::InterpretSequence(PowerPC::PowerPCState& ppc_state,
+                                         const InterpretSequenceOperands<count>& operands)
+{
+  for (const auto& [func, current_pc, inst] : operands.entries)
+    func(operands.interpreter, inst);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 template <bool write_pc>
 s32 CachedInterpreter::InterpretAndCheckExceptions(
     PowerPC::PowerPCState& ppc_state, const InterpretAndCheckExceptionsOperands& operands)
@@ -214,6 +224,7 @@ bool CachedInterpreter::HandleFunctionHooking(u32 address)
   if (!result)
     return false;
 
+  WritePendingInterprets();
   Write(HLEFunction, {m_system, address, result.hook_index});
 
   if (result.type != HLE::HookType::Replace)
@@ -226,6 +237,7 @@ bool CachedInterpreter::HandleFunctionHooking(u32 address)
 
 void CachedInterpreter::WriteEndBlock()
 {
+  WritePendingInterprets();
   if (IsProfilingEnabled())
   {
     Write(EndBlock<true>, {{js.downcountAmount, js.numLoadStoreInst, js.numFloatingPointInst},
@@ -237,6 +249,42 @@ void CachedInterpreter::WriteEndBlock()
   }
 }
 
+template <std::size_t count>
+void CachedInterpreter::WriteInterpretSequence()
+{
+  InterpretSequenceOperands<count> operands{m_system.GetInterpreter()};
+  std::copy_n(m_pending_interprets.begin(), count, operands.entries.begin());
+  Write(InterpretSequence<count>, operands);
+}
+
+void CachedInterpreter::WritePendingInterprets()
+{
+  static_assert(MAX_INTERPRET_SEQUENCE == 4);
+  switch (m_pending_interprets.size())
+  {
+  case 0:
+    return;
+  case 1:
+  {
+    const auto& [func, current_pc, inst] = m_pending_interprets.front();
+    Write(Interpret<false>, {m_system.GetInterpreter(), func, current_pc, inst});
+    break;
+  }
+  case 2:
+    WriteInterpretSequence<2>();
+    break;
+  case 3:
+    WriteInterpretSequence<3>();
+    break;
+  case 4:
+    WriteInterpretSequence<4>();
+    break;
+  default:
+    ASSERT(false);
+  }
+  m_pending_interprets.clear();
+}
+
 bool CachedInterpreter::SetEmitterStateToFreeCodeRegion()
 {
   const auto free = m_free_ranges.by_size_begin();
@@ -334,6 +382,7 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.numLoadStoreInst = 0;
   js.numFloatingPointInst = 0;
   js.curBlock = b;
+  m_pending_interprets.clear();
 
   auto& interpreter = m_system.GetInterpreter();
   auto& power_pc = m_system.GetPowerPC();
@@ -364,10 +413,12 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       if (IsDebuggingEnabled() && !cpu.IsStepping() &&
           breakpoints.IsAddressBreakPoint(js.compilerPC))
       {
+        WritePendingInterprets();
         Write(CheckBreakpoint, {power_pc, js.compilerPC, js.downcountAmount});
       }
       if (!js.firstFPInstructionFound && (op.opinfo->flags & FL_USE_FPU) != 0)
       {
+        WritePendingInterprets();
         Write(CheckFPU, {power_pc, js.compilerPC, js.downcountAmount});
         js.firstFPInstructionFound = true;
       }
@@ -376,6 +427,7 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       if ((jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
           (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op)))
       {
+        WritePendingInterprets();
         const InterpretAndCheckExceptionsOperands operands = {
             {interpreter, Interpreter::GetInterpreterOp(op.inst), js.compilerPC, op.inst},
             power_pc,
@@ -384,20 +436,30 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
                                CallbackCast(InterpretAndCheckExceptions<false>),
               operands);
       }
+      else if (op.canEndBlock)
+      {
+        WritePendingInterprets();
+        Write(Interpret<true>, {interpreter, Interpreter::GetInterpreterOp(op.inst), js.compilerPC,
+                                op.inst});
+      }
       else
       {
-        const InterpretOperands operands = {interpreter, Interpreter::GetInterpreterOp(op.inst),
-                                            js.compilerPC, op.inst};
-        Write(op.canEndBlock ? CallbackCast(Interpret<true>) : CallbackCast(Interpret<false>),
-              operands);
+        m_pending_interprets.push_back(
+            {Interpreter::GetInterpreterOp(op.inst), js.compilerPC, op.inst});
+        if (m_pending_interprets.size() == MAX_INTERPRET_SEQUENCE)
+          WritePendingInterprets();
       }
 
       if (op.branchIsIdleLoop)
+      {
+        WritePendingInterprets();
         Write(CheckIdle, {m_system.GetCoreTiming(), js.blockStart});
+      }
       if (op.canEndBlock)
         WriteEndBlock();
     }
   }
+  WritePendingInterprets();
   if (code_block.m_broken)
   {
     Write(WriteBrokenBlockNPC, {nextPC});
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <vector>
 
 #include <rangeset/rangesizeset.h>
 
@@ -63,6 +65,9 @@ private:
 
   bool HandleFunctionHooking(u32 address);
   void WriteEndBlock();
+  void WritePendingInterprets();
+  template <std::size_t count>
+  void WriteInterpretSequence();
 
   // Finds a free memory region and sets the code emitter to point at that region.
   // Returns false if no free memory region can be found.
@@ -78,6 +83,9 @@ private:
   struct EndBlockOperands;
   struct InterpretOperands;
   struct InterpretAndCheckExceptionsOperands;
+  struct InterpretSequenceEntry;
+  template <std::size_t count>
+  struct InterpretSequenceOperands;
   struct HLEFunctionOperands;
   struct WriteBrokenBlockNPCOperands;
   struct CheckHaltOperands;
@@ -94,6 +102,12 @@ private:
   static s32 Interpret(PowerPC::PowerPCState& ppc_state, const InterpretOperands& operands);
   template <bool write_pc>
   static s32 Interpret(std::ostream& stream, const InterpretOperands& operands);
+  template <std::size_t count>
+  static s32 InterpretSequence(PowerPC::PowerPCState& ppc_state,
+                               const InterpretSequenceOperands<count>& operands);
+  template <std::size_t count>
+  static s32 InterpretSequence(std::ostream& stream,
+                               const InterpretSequenceOperands<count>& operands);
   template <bool write_pc>
   static s32 InterpretAndCheckExceptions(PowerPC::PowerPCState& ppc_state,
                                          const InterpretAndCheckExceptionsOperands& operands);
@@ -112,6 +126,12 @@ private:
   static s32 CheckIdle(PowerPC::PowerPCState& ppc_state, const CheckIdleOperands& operands);
   static s32 CheckIdle(std::ostream& stream, const CheckIdleOperands& operands);
 
+  // Consecutive instructions which don't need a PC update or any checks are collected here and
+  // written as a single InterpretSequence callback, which saves a trip through the dispatch loop
+  // for each of them.
+  static constexpr std::size_t MAX_INTERPRET_SEQUENCE = 4;
+  std::vector<InterpretSequenceEntry> m_pending_interprets;
+
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges;
   CachedInterpreterBlockCache m_block_cache;
 };
@@ -144,6 +164,20 @@ struct CachedInterpreter::InterpretOperands
   UGeckoInstruction inst;
 };
 
+struct CachedInterpreter::InterpretSequenceEntry
+{
+  void (*func)(Interpreter&, UGeckoInstruction);  // Interpreter::Instruction
+  u32 current_pc;
+  UGeckoInstruction inst;
+};
+
+template <std::size_t count>
+struct CachedInterpreter::InterpretSequenceOperands
+{
+  Interpreter& interpreter;
+  std::array<InterpretSequenceEntry, count> entries;
+};
+
 struct CachedInterpreter::InterpretAndCheckExceptionsOperands : InterpretOperands
 {
   PowerPC::PowerPCManager& power_pc;
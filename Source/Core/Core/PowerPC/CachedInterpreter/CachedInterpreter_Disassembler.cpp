@@ -42,6 +42,17 @@ s32 CachedInterpreter::Interpret(std::ostream& stream, const InterpretOperands&
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+template <std::size_t count>
+s32 CachedInterpreter::InterpretSequence(std::ostream& stream,
+                                         const InterpretSequenceOperands<count>& operands)
+{
+  fmt::println(stream, "InterpretSequence<count={}>(", count);
+  for (const auto& [func, current_pc, inst] : operands.entries)
+    fmt::println(stream, "  current_pc=0x{:08x}, inst=0x{:08x}", current_pc, inst.hex);
+  stream << ")\n";
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 template <bool write_pc>
 s32 CachedInterpreter::InterpretAndCheckExceptions(
     std::ostream& stream, const InterpretAndCheckExceptionsOperands& operands)
@@ -108,6 +119,9 @@ std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream&
       LOOKUP_KV(CachedInterpreter::EndBlock<true>),
       LOOKUP_KV(CachedInterpreter::Interpret<false>),
       LOOKUP_KV(CachedInterpreter::Interpret<true>),
+      LOOKUP_KV(CachedInterpreter::InterpretSequence<2>),
+      LOOKUP_KV(CachedInterpreter::InterpretSequence<3>),
+      LOOKUP_KV(CachedInterpreter::InterpretSequence<4>),
       LOOKUP_KV(CachedInterpreter::InterpretAndCheckExceptions<false>),
       LOOKUP_KV(CachedInterpreter::InterpretAndCheckExceptions<true>),
       LOOKUP_KV(CachedInterpreter::HLEFunction),
@@ -648,6 +648,7 @@ static void WriteRegister()
   else if (id >= 71 && id < 87)
   {
     ppc_state.sr[id - 71] = re32hex(bufptr);
+    system.GetMMU().SRUpdated();
   }
   else if (id >= 88 && id < 104)
   {
@@ -36,6 +36,9 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  // Executes instructions until the end of the current block is reached, like one iteration of
+  // the fast runloop. Returns the number of cycles taken.
+  int RunSingleBlock();
 
   void Run() override;
   void ClearCache() override;
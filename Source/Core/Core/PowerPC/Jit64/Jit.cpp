@@ -3,7 +3,10 @@
 
 #include "Core/PowerPC/Jit64/Jit.h"
 
+#include <algorithm>
+#include <array>
 #include <map>
+#include <numeric>
 #include <span>
 #include <sstream>
 #include <string>
@@ -25,7 +28,9 @@
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/SymbolDB.h"
+#include "Common/Trace.h"
 #include "Common/x64ABI.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -274,7 +279,8 @@ void Jit64::Init()
   const size_t trampolines_size = jo.memcheck ? TRAMPOLINE_CODE_SIZE_MMU : TRAMPOLINE_CODE_SIZE;
   const size_t farcode_size = jo.memcheck ? FARCODE_SIZE_MMU : FARCODE_SIZE;
   const size_t constpool_size = m_const_pool.CONST_POOL_SIZE;
-  AllocCodeSpace(CODE_SIZE + routines_size + trampolines_size + farcode_size + constpool_size);
+  AllocCodeSpace(CODE_SIZE + routines_size + trampolines_size + farcode_size + constpool_size,
+                 Config::Get(Config::MAIN_HUGE_PAGES));
   AddChildCodeSpace(&asm_routines, routines_size);
   AddChildCodeSpace(&trampolines, trampolines_size);
   AddChildCodeSpace(&m_far_code, farcode_size);
@@ -615,7 +621,11 @@ void Jit64::WriteExitDestInRSCRATCH(bool bl, u32 after)
   }
 
   SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
-  if (bl)
+  if (jo.enableBlocklink)
+  {
+    WriteIndirectExit(bl, after);
+  }
+  else if (bl)
   {
     CALL(asm_routines.dispatcher);
     POP(RSCRATCH);
@@ -627,6 +637,65 @@ void Jit64::WriteExitDestInRSCRATCH(bool bl, u32 after)
   }
 }
 
+void Jit64::WriteIndirectExit(bool bl, u32 after)
+{
+  // Inline cache for the branch target in RSCRATCH: if it matches the last target seen at this
+  // exit, the exit is followed like a normal block link. Otherwise the exit is retargeted at the
+  // new destination before it is taken.
+  JitBlock* b = js.curBlock;
+  const u32 link_index = static_cast<u32>(b->linkData.size());
+  JitBlock::LinkData linkData;
+  linkData.exitAddress = JitBlockCache::INVALID_INDIRECT_EXIT_ADDRESS;
+  linkData.linkStatus = false;
+  linkData.call = bl;
+
+  FixupBranch after_fixup;
+  if (bl)
+  {
+    FixupBranch do_timing = J_CC(CC_LE, Jump::Near);
+    SwitchToFarCode();
+    SetJumpTarget(do_timing);
+    CALL(asm_routines.do_timing);
+    after_fixup = J(Jump::Near);
+    SwitchToNearCode();
+  }
+  else
+  {
+    J_CC(CC_LE, asm_routines.do_timing);
+  }
+
+  // The initial address doesn't fit in an imm8, so the immediate can be patched later.
+  CMP(32, R(RSCRATCH), Imm32(linkData.exitAddress));
+  linkData.indirectCheck = GetWritableCodePtr() - sizeof(u32);
+  FixupBranch miss = J_CC(CC_NE, Jump::Near);
+
+  linkData.exitPtrs = GetWritableCodePtr();
+  if (bl)
+  {
+    CALL(asm_routines.dispatcher_no_timing_check);
+    SetJumpTarget(after_fixup);
+    POP(RSCRATCH);
+    JustWriteExit(after, false, 0);
+  }
+  else
+  {
+    JMP(asm_routines.dispatcher_no_timing_check, Jump::Near);
+  }
+
+  SwitchToFarCode();
+  SetJumpTarget(miss);
+  // The return address for the BLR optimization has already been pushed.
+  const size_t rsp_alignment = bl ? 8 : 0;
+  ABI_PushRegistersAndAdjustStack({}, rsp_alignment);
+  ABI_CallFunctionPPC(JitBlockCache::RetargetIndirectExitFromJIT,
+                      static_cast<JitBaseBlockCache*>(&blocks), b, link_index);
+  ABI_PopRegistersAndAdjustStack({}, rsp_alignment);
+  JMP(linkData.exitPtrs, Jump::Near);
+  SwitchToNearCode();
+
+  b->linkData.push_back(linkData);
+}
+
 void Jit64::WriteBLRExit()
 {
   if (!m_enable_blr_optimization)
@@ -667,7 +736,7 @@ void Jit64::WriteRfiExitDestInRSCRATCH()
 void Jit64::WriteIdleExit(u32 destination)
 {
   ABI_PushRegistersAndAdjustStack({}, 0);
-  ABI_CallFunction(CoreTiming::GlobalIdle);
+  ABI_CallFunctionP(CoreTiming::IdleFromJIT, &m_system.GetCoreTiming());
   ABI_PopRegistersAndAdjustStack({}, 0);
   MOV(32, PPCSTATE(pc), Imm32(destination));
   WriteExceptionExit();
@@ -754,6 +823,7 @@ void Jit64::Jit(u32 em_address)
 
 void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 {
+  TRACE_SCOPE("Jit64::Jit");
   CleanUpAfterStackFault();
 
   if (trampolines.IsAlmostFull() || SConfig::GetInstance().bJITNoBlockCache)
@@ -795,6 +865,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
+  ConfigureAnalyzerForBlock(em_address);
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
   if (code_block.m_memory_exception)
@@ -953,11 +1024,18 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     }
   }
 
+  bool has_speculative_constants = false;
   if (!js.noSpeculativeConstantsAddresses.contains(js.blockStart))
   {
-    IntializeSpeculativeConstants();
+    has_speculative_constants = IntializeSpeculativeConstants();
   }
 
+  // The loop header must come after all of the checks above, but the speculative constants are
+  // only checked on block entry and can't be kept across a back edge.
+  m_loop_header = nullptr;
+  if (!has_speculative_constants)
+    SetUpLoopRegisters();
+
   // Translate instructions
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
@@ -1289,7 +1367,7 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
 }
 
-void Jit64::IntializeSpeculativeConstants()
+bool Jit64::IntializeSpeculativeConstants()
 {
   // If the block depends on an input register which looks like a gather pipe or MMIO related
   // constant, guess that it is actually a constant input, and specialize the block based on this
@@ -1322,6 +1400,102 @@ void Jit64::IntializeSpeculativeConstants()
       gpr.SetImmediate32(i, compileTimeValue, false);
     }
   }
+  return target != nullptr;
+}
+
+void Jit64::SetUpLoopRegisters()
+{
+  if (bJITRegisterCacheOff || IsDebuggingEnabled() || IsProfilingEnabled() ||
+      IsFuncWatchEnabled() || (m_ppc_state.feature_flags & FEATURE_FLAG_PERFMON))
+  {
+    return;
+  }
+
+  // Hooks run at the start of the block, before the loop header.
+  if (HLE::TryReplaceFunction(m_ppc_symbol_db, js.blockStart, PowerPC::CoreMode::JIT))
+    return;
+
+  const std::span<PPCAnalyst::CodeOp> ops(m_code_buffer.data(), code_block.m_num_instructions);
+  const bool is_loop = std::ranges::any_of(ops, [this](const PPCAnalyst::CodeOp& op) {
+    return op.branchTo == js.blockStart && !op.inst.LK && !op.branchIsIdleLoop && !op.skip;
+  });
+  if (!is_loop)
+    return;
+
+  // A jump back into a block that has been invalidated would keep running stale code, since the
+  // back edge isn't a block link that can be unlinked.
+  const bool touches_caches = std::ranges::any_of(ops, [](const PPCAnalyst::CodeOp& op) {
+    return op.opinfo->type == OpType::DataCache ||
+           op.opinfo->type == OpType::InstructionCache;
+  });
+  if (touches_caches)
+    return;
+
+  std::array<u32, 32> gpr_uses{};
+  std::array<u32, 32> fpr_uses{};
+  for (const PPCAnalyst::CodeOp& op : ops)
+  {
+    for (int i : op.regsIn | op.regsOut)
+      gpr_uses[i]++;
+    for (int i : op.fregsIn | op.GetFregsOut())
+      fpr_uses[i]++;
+  }
+
+  // Registers which are only touched once per iteration aren't worth a host register.
+  const auto pick = [](const std::array<u32, 32>& uses, size_t max_count) {
+    std::array<int, 32> order;
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(order, [&uses](int a, int b) { return uses[a] > uses[b]; });
+
+    BitSet32 result;
+    for (size_t i = 0; i < max_count && uses[order[i]] >= 2; i++)
+      result[order[i]] = true;
+    return result;
+  };
+  const BitSet32 loop_gprs = pick(gpr_uses, MAX_LOOP_GPRS);
+  const BitSet32 loop_fprs = pick(fpr_uses, MAX_LOOP_FPRS);
+  if (!loop_gprs && !loop_fprs)
+    return;
+
+  // Keep the registers allocated for the whole block, so that they are still in place when the
+  // back edge is reached.
+  for (PPCAnalyst::CodeOp& op : ops)
+  {
+    op.gprInUse |= loop_gprs;
+    op.fprInUse |= loop_fprs;
+  }
+
+  m_gpr_loop_state = gpr.BindForLoop(loop_gprs);
+  m_fpr_loop_state = fpr.BindForLoop(loop_fprs);
+  m_loop_header = GetCodePtr();
+}
+
+bool Jit64::WriteLoopBackEdge(const PPCAnalyst::CodeOp& branch_op)
+{
+  if (!m_loop_header || branch_op.branchTo != js.blockStart || branch_op.inst.LK ||
+      branch_op.branchIsIdleLoop)
+  {
+    return false;
+  }
+
+  // Anything that Cleanup would have to do on exit can't be skipped on the back edge.
+  if (js.fifoBytesSinceCheck != 0 || js.carryFlag != CarryFlag::InPPCState)
+    return false;
+
+  if (!gpr.CanRestoreLoopState(m_gpr_loop_state) || !fpr.CanRestoreLoopState(m_fpr_loop_state))
+    return false;
+
+  gpr.RestoreLoopState(m_gpr_loop_state);
+  fpr.RestoreLoopState(m_fpr_loop_state);
+
+  SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
+  J_CC(CC_G, m_loop_header);
+
+  gpr.Flush();
+  fpr.Flush();
+  MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+  JMP(asm_routines.do_timing, Jump::Near);
+  return true;
 }
 
 bool Jit64::HandleFunctionHooking(u32 address)
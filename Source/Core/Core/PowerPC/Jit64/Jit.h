@@ -79,7 +79,8 @@ public:
   BitSet32 CallerSavedRegistersInUse() const;
   BitSet8 ComputeStaticGQRs(const PPCAnalyst::CodeBlock&) const;
 
-  void IntializeSpeculativeConstants();
+  bool IntializeSpeculativeConstants();
+  void SetUpLoopRegisters();
 
   JitBlockCache* GetBlockCache() override { return &blocks; }
   void Trace();
@@ -100,11 +101,16 @@ public:
   void WriteExit(u32 destination, bool bl = false, u32 after = 0);
   void JustWriteExit(u32 destination, bool bl, u32 after);
   void WriteExitDestInRSCRATCH(bool bl = false, u32 after = 0);
+  void WriteIndirectExit(bool bl, u32 after);
   void WriteBLRExit();
   void WriteExceptionExit();
   void WriteExternalExceptionExit();
   void WriteRfiExitDestInRSCRATCH();
   void WriteIdleExit(u32 destination);
+  // Jumps straight back to the loop header of the block if branch_op branches to the start of the
+  // block, keeping the loop registers in host registers. Returns false if this isn't possible, in
+  // which case the caller has to write a normal exit.
+  bool WriteLoopBackEdge(const PPCAnalyst::CodeOp& branch_op);
   template <bool condition>
   void WriteBranchWatch(u32 origin, u32 destination, UGeckoInstruction inst, Gen::X64Reg reg_a,
                         Gen::X64Reg reg_b, BitSet32 caller_save);
@@ -286,6 +292,14 @@ private:
   GPRRegCache gpr{*this};
   FPURegCache fpr{*this};
 
+  // For blocks which branch back to their own start, the code after the register setup at the
+  // start of the block, and the registers which are kept in host registers across iterations.
+  static constexpr size_t MAX_LOOP_GPRS = 6;
+  static constexpr size_t MAX_LOOP_FPRS = 8;
+  const u8* m_loop_header = nullptr;
+  RegCache::LoopState m_gpr_loop_state{};
+  RegCache::LoopState m_fpr_loop_state{};
+
   Jit64AsmRoutineManager asm_routines{*this};
 
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_near;
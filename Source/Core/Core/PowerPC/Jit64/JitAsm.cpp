@@ -67,11 +67,11 @@ void Jit64AsmRoutineManager::Generate()
 
   const u8* outerLoop = GetCodePtr();
   ABI_PushRegistersAndAdjustStack({}, 0);
-  ABI_CallFunction(CoreTiming::GlobalAdvance);
+  ABI_CallFunctionP(CoreTiming::AdvanceFromJIT, &m_jit.m_system.GetCoreTiming());
   ABI_PopRegistersAndAdjustStack({}, 0);
 
   // When we've just entered the jit we need to update the membase
-  // GlobalAdvance also checks exceptions after which we need to
+  // AdvanceFromJIT also checks exceptions after which we need to
   // update the membase so it makes sense to do this here.
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
@@ -218,15 +218,25 @@ void Jit64AsmRoutineManager::Generate()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
+  // JitTrampoline might have run the block in the interpreter instead of compiling it
+  CMP(32, PPCSTATE(downcount), Imm8(0));
+  FixupBranch bail_after_trampoline = J_CC(CC_LE, Jump::Near);
+
   JMP(dispatcher_no_check, Jump::Near);
 
   SetJumpTarget(bail);
+  SetJumpTarget(bail_after_trampoline);
   do_timing = GetCodePtr();
 
   // make sure npc contains the next pc (needed for exception checking in CoreTiming::Advance)
   MOV(32, R(RSCRATCH), PPCSTATE(pc));
   MOV(32, PPCSTATE(npc), R(RSCRATCH));
 
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(&m_jit)));
+  ABI_CallFunction(JitBase::SampleHotBlock);
+  ABI_PopRegistersAndAdjustStack({}, 0);
+
   // Check the state pointer to see if we are exiting
   // Gets checked on at the end of every slice
   MOV(64, R(RSCRATCH), ImmPtr(system.GetCPU().GetStatePtr()));
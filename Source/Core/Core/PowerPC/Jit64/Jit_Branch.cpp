@@ -159,6 +159,9 @@ void Jit64::bx(UGeckoInstruction inst)
     return;
   }
 
+  if (WriteLoopBackEdge(*js.op))
+    return;
+
   gpr.Flush();
   fpr.Flush();
 
@@ -191,21 +194,55 @@ void Jit64::bcx(UGeckoInstruction inst)
 
   // USES_CR
 
+  const bool check_ctr = (inst.BO & BO_DONT_DECREMENT_FLAG) == 0;
+  const bool check_condition = (inst.BO & BO_DONT_CHECK_CONDITION) == 0;
+
+  BranchProfile* profile = nullptr;
+  if (check_ctr || check_condition)
+    profile = GetBranchProfile(js.compilerPC);
+  if (profile)
+  {
+    MOV(64, R(RSCRATCH), ImmPtr(&profile->runs));
+    ADD(64, MatR(RSCRATCH), Imm8(1));
+  }
+
+  // The exit for an unlikely branch goes to far code, and the last check jumps there instead of
+  // over it. Exits for calls and idle loops use far code themselves.
+  const bool unlikely = (check_ctr || check_condition) && !inst.LK && !js.op->branchIsIdleLoop &&
+                        IsBranchUnlikely(js.compilerPC);
+  FixupBranch pBranch;
+
   FixupBranch pCTRDontBranch;
-  if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)  // Decrement and test CTR
+  if (check_ctr)  // Decrement and test CTR
   {
     SUB(32, PPCSTATE_CTR, Imm8(1));
-    if (inst.BO & BO_BRANCH_IF_CTR_0)
-      pCTRDontBranch = J_CC(CC_NZ, Jump::Near);
+    const bool branch_if_ctr_0 = (inst.BO & BO_BRANCH_IF_CTR_0) != 0;
+    if (unlikely && !check_condition)
+      pBranch = J_CC(branch_if_ctr_0 ? CC_Z : CC_NZ, Jump::Near);
     else
-      pCTRDontBranch = J_CC(CC_Z, Jump::Near);
+      pCTRDontBranch = J_CC(branch_if_ctr_0 ? CC_NZ : CC_Z, Jump::Near);
   }
 
   FixupBranch pConditionDontBranch;
-  if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)  // Test a CR bit
+  if (check_condition)  // Test a CR bit
   {
-    pConditionDontBranch =
-        JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !(inst.BO_2 & BO_BRANCH_IF_TRUE));
+    const bool branch_if_true = (inst.BO_2 & BO_BRANCH_IF_TRUE) != 0;
+    if (unlikely)
+      pBranch = JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), branch_if_true);
+    else
+      pConditionDontBranch = JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !branch_if_true);
+  }
+
+  if (unlikely)
+  {
+    SwitchToFarCode();
+    SetJumpTarget(pBranch);
+  }
+
+  if (profile)
+  {
+    MOV(64, R(RSCRATCH), ImmPtr(&profile->taken));
+    ADD(64, MatR(RSCRATCH), Imm8(1));
   }
 
   if (inst.LK)
@@ -235,27 +272,34 @@ void Jit64::bcx(UGeckoInstruction inst)
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
-    gpr.Flush();
-    fpr.Flush();
 
-    if (IsDebuggingEnabled())
+    if (!WriteLoopBackEdge(*js.op))
     {
-      // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
-      WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, ABI_PARAM1, RSCRATCH, {});
-    }
-    if (js.op->branchIsIdleLoop)
-    {
-      WriteIdleExit(js.op->branchTo);
-    }
-    else
-    {
-      WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4);
+      gpr.Flush();
+      fpr.Flush();
+
+      if (IsDebuggingEnabled())
+      {
+        // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
+        WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, ABI_PARAM1, RSCRATCH, {});
+      }
+      if (js.op->branchIsIdleLoop)
+      {
+        WriteIdleExit(js.op->branchTo);
+      }
+      else
+      {
+        WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4);
+      }
     }
   }
 
-  if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+  if (unlikely)
+    SwitchToNearCode();
+
+  if (check_condition && !unlikely)
     SetJumpTarget(pConditionDontBranch);
-  if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+  if (check_ctr && !(unlikely && !check_condition))
     SetJumpTarget(pCTRDontBranch);
 
   if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
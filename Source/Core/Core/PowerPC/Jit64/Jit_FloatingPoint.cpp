@@ -494,6 +494,7 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
   }
   else
   {
+    bool product_ready = false;
     if (madds0)
     {
       MOVDDUP(result_xmm, Rc);
@@ -510,12 +511,22 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
       if (round_input)
         Force25BitPrecision(result_xmm, R(result_xmm), scratch_xmm);
     }
-    else
+    else if (round_input)
     {
-      if (round_input)
-        Force25BitPrecision(result_xmm, Rc, scratch_xmm);
+      Force25BitPrecision(result_xmm, Rc, scratch_xmm);
+    }
+    else if (!use_fma && cpu_info.bAVX && Rc.IsSimpleReg())
+    {
+      // Fold the copy of c into the multiplication.
+      if (packed)
+        VMULPD(result_xmm, Rc.GetSimpleReg(), Ra);
       else
-        MOVAPD(result_xmm, Rc);
+        VMULSD(result_xmm, Rc.GetSimpleReg(), Ra);
+      product_ready = true;
+    }
+    else
+    {
+      MOVAPD(result_xmm, Rc);
     }
 
     if (use_fma)
@@ -539,7 +550,8 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
     {
       if (packed)
       {
-        MULPD(result_xmm, Ra);
+        if (!product_ready)
+          MULPD(result_xmm, Ra);
         if (subtract)
           SUBPD(result_xmm, Rb);
         else
@@ -547,7 +559,8 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
       }
       else
       {
-        MULSD(result_xmm, Ra);
+        if (!product_ready)
+          MULSD(result_xmm, Ra);
         if (subtract)
           SUBSD(result_xmm, Rb);
         else
@@ -485,10 +485,13 @@ void Jit64::DoMergedBranchCondition()
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
 
-    gpr.Flush();
-    fpr.Flush();
+    if (next.OPCD != 16 || !WriteLoopBackEdge(js.op[1]))
+    {
+      gpr.Flush();
+      fpr.Flush();
 
-    DoMergedBranch();
+      DoMergedBranch();
+    }
   }
 
   SetJumpTarget(pDontBranch);
@@ -541,9 +544,12 @@ void Jit64::DoMergedBranchImmediate(s64 val)
 
   if (branch)
   {
-    gpr.Flush();
-    fpr.Flush();
-    DoMergedBranch();
+    if (next.OPCD != 16 || !WriteLoopBackEdge(js.op[1]))
+    {
+      gpr.Flush();
+      fpr.Flush();
+      DoMergedBranch();
+    }
   }
   else if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
   {
@@ -470,6 +470,64 @@ void RegCache::PreloadRegisters(BitSet32 to_preload)
   }
 }
 
+RegCache::LoopState RegCache::BindForLoop(BitSet32 pregs)
+{
+  LoopState state;
+  state.fill(Gen::INVALID_REG);
+  for (preg_t preg : pregs)
+  {
+    BindToRegister(preg, true, true);
+    state[preg] = RX(preg);
+  }
+  return state;
+}
+
+bool RegCache::CanRestoreLoopState(const LoopState& state) const
+{
+  if (IsAnyConstraintActive() || !IsAllUnlocked())
+    return false;
+
+  for (size_t i = 0; i < state.size(); i++)
+  {
+    if (state[i] != Gen::INVALID_REG && m_regs[i].IsDiscarded())
+      return false;
+  }
+  return true;
+}
+
+void RegCache::RestoreLoopState(const LoopState& state)
+{
+  BitSet32 kept;
+  BitSet32 misplaced;
+  for (preg_t i = 0; i < state.size(); i++)
+  {
+    if (state[i] == Gen::INVALID_REG)
+      continue;
+
+    kept[i] = true;
+    if (!m_regs[i].IsBound() || RX(i) != state[i])
+      misplaced[i] = true;
+  }
+
+  // Once everything else is flushed, the host registers of the misplaced registers are free,
+  // since the only thing that can still be bound to them is the guest register they belong to.
+  Flush(~kept);
+  Flush(misplaced);
+
+  for (preg_t i : misplaced)
+  {
+    const X64Reg xr = state[i];
+    ASSERT_MSG(DYNA_REC, m_xregs[xr].IsFree(), "Xreg {} of the loop state is in use",
+               Common::ToUnderlying(xr));
+    m_xregs[xr].SetBoundTo(i, true);
+    LoadRegister(i, xr);
+    m_regs[i].SetBoundTo(xr);
+  }
+
+  for (preg_t i : kept)
+    m_xregs[state[i]].MakeDirty();
+}
+
 BitSet32 RegCache::RegistersInUse() const
 {
   BitSet32 result;
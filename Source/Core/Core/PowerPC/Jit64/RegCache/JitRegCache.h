@@ -185,6 +185,17 @@ public:
   void PreloadRegisters(BitSet32 pregs);
   BitSet32 RegistersInUse() const;
 
+  // The host register that each guest register is kept in across the back edge of a loop, or
+  // INVALID_REG for guest registers which are in their default location at the loop header.
+  using LoopState = std::array<Gen::X64Reg, 32>;
+
+  // Binds the registers for the loop header. They are marked as dirty, since they may have been
+  // modified by the time the loop is left.
+  LoopState BindForLoop(BitSet32 pregs);
+  bool CanRestoreLoopState(const LoopState& state) const;
+  // Emits the moves which bring the cache back into the state at the loop header.
+  void RestoreLoopState(const LoopState& state);
+
 protected:
   friend class RCOpArg;
   friend class RCX64Reg;
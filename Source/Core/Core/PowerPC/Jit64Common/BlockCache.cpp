@@ -3,7 +3,10 @@
 
 #include "Core/PowerPC/Jit64Common/BlockCache.h"
 
+#include <cstring>
+
 #include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
 #include "Common/x64Emitter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 
@@ -13,6 +16,9 @@ JitBlockCache::JitBlockCache(JitBase& jit) : JitBaseBlockCache{jit}
 
 void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest)
 {
+  if (source.indirectCheck)
+    std::memcpy(Common::GetWritableAlias(source.indirectCheck), &source.exitAddress, sizeof(u32));
+
   u8* location = source.exitPtrs;
   const u8* address = dest ? dest->normalEntry : m_jit.GetAsmRoutines()->dispatcher_no_timing_check;
   if (source.call)
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "Common/Assert.h"
+#include "Common/MemoryUtil.h"
 
 ConstantPool::ConstantPool() = default;
 
@@ -51,7 +52,7 @@ const void* ConstantPool::GetConstant(const void* value, size_t element_size, si
     m_current_ptr = static_cast<u8*>(m_current_ptr) + value_size;
     m_remaining_size -= value_size;
 
-    std::memcpy(ptr, value, value_size);
+    std::memcpy(Common::GetWritableAlias(ptr), value, value_size);
     info = ConstantInfo{ptr, value_size};
   }
 
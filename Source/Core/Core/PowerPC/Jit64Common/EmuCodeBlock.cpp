@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/Jit64Common/EmuCodeBlock.h"
 
+#include <array>
 #include <functional>
 #include <limits>
 
@@ -18,6 +19,7 @@
 #include "Core/PowerPC/Jit64Common/Jit64Constants.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCCache.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -25,6 +27,10 @@ using namespace Gen;
 
 namespace
 {
+// Registers which DCacheLoadStore picks its temporaries from, in the order they're pushed
+constexpr std::array<X64Reg, 5> DCACHE_TEMP_CANDIDATES{RSCRATCH, RSCRATCH2, RSCRATCH_EXTRA, RSI,
+                                                       RDI};
+
 OpArg SwapImmediate(int access_size, const OpArg& reg_value)
 {
   if (access_size == 32)
@@ -131,6 +137,133 @@ FixupBranch EmuCodeBlock::CheckIfSafeAddress(const OpArg& reg_value, X64Reg reg_
   return J_CC(CC_Z, m_far_code.Enabled() ? Jump::Near : Jump::Short);
 }
 
+EmuCodeBlock::DCacheAccess EmuCodeBlock::DCacheLoadStore(bool store, const OpArg& reg_value,
+                                                         X64Reg reg_addr, int accessSize,
+                                                         bool swap, bool signExtend,
+                                                         BitSet32 registers_in_use)
+{
+  DCacheAccess access;
+
+  // Get ourselves three free registers which don't hold the address or the value
+  std::array<X64Reg, 3> temps;
+  size_t temp_count = 0;
+  for (X64Reg reg : DCACHE_TEMP_CANDIDATES)
+  {
+    if (temp_count == temps.size())
+      break;
+    if (reg == reg_addr || (reg_value.IsSimpleReg() && reg == reg_value.GetSimpleReg()))
+      continue;
+
+    temps[temp_count++] = reg;
+    if (registers_in_use[reg])
+    {
+      PUSH(reg);
+      access.pushed_registers[reg] = true;
+    }
+  }
+  const auto [block, way, tmp] = temps;
+  const PowerPC::Cache& dcache = m_jit.m_ppc_state.dCache;
+
+  // Look up the physical address, giving up on uncached and unmapped memory
+  MOV(32, R(block), R(reg_addr));
+  SHR(32, R(block), Imm8(PowerPC::BAT_INDEX_SHIFT));
+  MOV(64, R(tmp), ImmPtr(m_jit.m_mmu.GetDBATTable().data()));
+  MOV(32, R(block), MComplex(tmp, block, SCALE_4, 0));
+  TEST(32, R(block), Imm32(PowerPC::BAT_PHYSICAL_BIT));
+  access.slow.push_back(J_CC(CC_Z, Jump::Near));
+  AND(32, R(block), Imm32(~(PowerPC::BAT_PAGE_SIZE - 1)));
+  MOV(32, R(way), R(reg_addr));
+  AND(32, R(way), Imm32(PowerPC::BAT_PAGE_SIZE - 1));
+  OR(32, R(block), R(way));
+
+  // Accesses crossing into the next block are split up by the C++ code
+  if (accessSize > 8)
+  {
+    AND(32, R(way), Imm8(31));
+    CMP(32, R(way), Imm8(32 - accessSize / 8));
+    access.slow.push_back(J_CC(CC_A, Jump::Near));
+  }
+
+  // Leave the locked L1 and fake VMEM to the C++ code too
+  CMP(32, R(block), Imm32(PowerPC::CACHE_VMEM_BIT));
+  access.slow.push_back(J_CC(CC_AE, Jump::Near));
+
+  MOV(64, R(tmp), ImmPtr(dcache.lookup_table.data()));
+  BTR(32, R(block), Imm8(MathUtil::IntLog2(PowerPC::CACHE_EXRAM_BIT)));
+  FixupBranch mem1 = J_CC(CC_NC);
+  MOV(64, R(tmp), ImmPtr(dcache.lookup_table_ex.data()));
+  SetJumpTarget(mem1);
+  SHR(32, R(block), Imm8(5));
+  MOVZX(32, 8, way, MComplex(tmp, block, SCALE_1, 0));
+  CMP(32, R(way), Imm32(0xFF));
+  access.slow.push_back(J_CC(CC_E, Jump::Near));
+
+  // It's a hit, which updates the PLRU bits of the set like Cache::GetCache
+  const X64Reg set = block;
+  AND(32, R(set), Imm8(PowerPC::CACHE_SETS - 1));
+  const OpArg plru = MComplex(RPPCSTATE, set, SCALE_1, PPCSTATE_OFF(dCache.plru));
+  MOV(64, R(tmp), ImmPtr(PowerPC::PLRU_MASK.data()));
+  MOVZX(32, 8, tmp, MComplex(tmp, way, SCALE_1, 0));
+  NOT(32, R(tmp));
+  AND(8, plru, R(tmp));
+  MOV(64, R(tmp), ImmPtr(PowerPC::PLRU_VALUE.data()));
+  MOVZX(32, 8, tmp, MComplex(tmp, way, SCALE_1, 0));
+  OR(8, plru, R(tmp));
+
+  if (store)
+  {
+    const OpArg modified = MComplex(RPPCSTATE, set, SCALE_1, PPCSTATE_OFF(dCache.modified));
+    MOVZX(32, 8, tmp, modified);
+    BTS(32, R(tmp), R(way));
+    MOV(8, modified, R(tmp));
+  }
+
+  // The data of the block is at dCache.data[set][way]
+  const X64Reg offset = block;
+  LEA(32, offset, MComplex(way, set, SCALE_8, 0));
+  SHL(32, R(offset), Imm8(5));
+  MOV(32, R(tmp), R(reg_addr));
+  AND(32, R(tmp), Imm8(31));
+  OR(32, R(offset), R(tmp));
+  const OpArg data = MComplex(RPPCSTATE, offset, SCALE_1, PPCSTATE_OFF(dCache.data));
+
+  if (!store)
+  {
+    LoadAndSwap(accessSize, reg_value.GetSimpleReg(), data, signExtend);
+  }
+  else if (reg_value.IsImm())
+  {
+    MOV(accessSize, data, swap ? SwapImmediate(accessSize, reg_value) : reg_value);
+  }
+  else if (swap && accessSize > 8)
+  {
+    // Don't clobber the value
+    X64Reg src = reg_value.GetSimpleReg();
+    if (!cpu_info.bMOVBE)
+    {
+      MOV(accessSize == 64 ? 64 : 32, R(tmp), reg_value);
+      src = tmp;
+    }
+    SwapAndStore(accessSize, data, src);
+  }
+  else
+  {
+    MOV(accessSize, data, reg_value);
+  }
+
+  PopDCacheTemps(access.pushed_registers);
+  return access;
+}
+
+void EmuCodeBlock::PopDCacheTemps(BitSet32 pushed_registers)
+{
+  for (auto it = DCACHE_TEMP_CANDIDATES.rbegin(); it != DCACHE_TEMP_CANDIDATES.rend(); ++it)
+  {
+    if (pushed_registers[*it])
+      POP(*it);
+  }
+}
+
 void EmuCodeBlock::UnsafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int accessSize, s32 offset,
                                        bool swap, MovInfo* info)
 {
@@ -375,6 +508,7 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
       (flags & SAFE_LOADSTORE_DR_ON) || (m_jit.m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR);
   const bool fast_check_address =
       !force_slow_access && dr_set && m_jit.jo.fastmem_arena && !m_jit.m_ppc_state.m_enable_dcache;
+  const bool dcache_access = !force_slow_access && dr_set && m_jit.m_ppc_state.m_enable_dcache;
   if (fast_check_address)
   {
     FixupBranch slow = CheckIfSafeAddress(R(reg_value), reg_addr, registersInUse);
@@ -385,6 +519,18 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
       exit = J(Jump::Near);
     SetJumpTarget(slow);
   }
+  else if (dcache_access)
+  {
+    const DCacheAccess access = DCacheLoadStore(false, R(reg_value), reg_addr, accessSize, true,
+                                                signExtend, registersInUse);
+    if (m_far_code.Enabled())
+      SwitchToFarCode();
+    else
+      exit = J(Jump::Near);
+    for (FixupBranch slow : access.slow)
+      SetJumpTarget(slow);
+    PopDCacheTemps(access.pushed_registers);
+  }
 
   // PC is used by memory watchpoints (if enabled), profiling where to insert gather pipe
   // interrupt checks, and printing accurate PC locations in debug logs.
@@ -426,7 +572,7 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
     MOVZX(64, accessSize, reg_value, R(ABI_RETURN));
   }
 
-  if (fast_check_address)
+  if (fast_check_address || dcache_access)
   {
     if (m_far_code.Enabled())
     {
@@ -549,6 +695,7 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
       (flags & SAFE_LOADSTORE_DR_ON) || (m_jit.m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR);
   const bool fast_check_address =
       !force_slow_access && dr_set && m_jit.jo.fastmem_arena && !m_jit.m_ppc_state.m_enable_dcache;
+  const bool dcache_access = !force_slow_access && dr_set && m_jit.m_ppc_state.m_enable_dcache;
   if (fast_check_address)
   {
     FixupBranch slow = CheckIfSafeAddress(reg_value, reg_addr, registersInUse);
@@ -559,6 +706,18 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
       exit = J(Jump::Near);
     SetJumpTarget(slow);
   }
+  else if (dcache_access)
+  {
+    const DCacheAccess access =
+        DCacheLoadStore(true, reg_value, reg_addr, accessSize, swap, false, registersInUse);
+    if (m_far_code.Enabled())
+      SwitchToFarCode();
+    else
+      exit = J(Jump::Near);
+    for (FixupBranch slow : access.slow)
+      SetJumpTarget(slow);
+    PopDCacheTemps(access.pushed_registers);
+  }
 
   // PC is used by memory watchpoints (if enabled), profiling where to insert gather pipe
   // interrupt checks, and printing accurate PC locations in debug logs.
@@ -607,7 +766,7 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
 
   MemoryExceptionCheck();
 
-  if (fast_check_address)
+  if (fast_check_address || dcache_access)
   {
     if (m_far_code.Enabled())
     {
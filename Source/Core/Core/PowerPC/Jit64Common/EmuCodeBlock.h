@@ -4,6 +4,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
@@ -55,6 +56,23 @@ public:
 
   Gen::FixupBranch CheckIfSafeAddress(const Gen::OpArg& reg_value, Gen::X64Reg reg_addr,
                                       BitSet32 registers_in_use);
+
+  struct DCacheAccess
+  {
+    // Taken when the access has to go through the C++ code
+    std::vector<Gen::FixupBranch> slow;
+    // Registers which were saved for use as temporaries
+    BitSet32 pushed_registers;
+  };
+
+  // With the data cache emulated, accesses the cache directly if the address is in a block of
+  // MEM1 or MEM2 which is already cached. The caller has to set the slow branches as jump targets
+  // and call PopDCacheTemps before emitting the slow path. Needs translation to be enabled.
+  DCacheAccess DCacheLoadStore(bool store, const Gen::OpArg& reg_value, Gen::X64Reg reg_addr,
+                               int accessSize, bool swap, bool signExtend,
+                               BitSet32 registers_in_use);
+  void PopDCacheTemps(BitSet32 pushed_registers);
+
   // these return the address of the MOV, for backpatching
   void UnsafeWriteRegToReg(Gen::OpArg reg_value, Gen::X64Reg reg_addr, int accessSize,
                            s32 offset = 0, bool swap = true, Gen::MovInfo* info = nullptr);
@@ -137,8 +137,15 @@ void CommonAsmRoutines::GenFrsqrte()
   SHL(64, R(RSCRATCH2), Imm8(52));  // exponent = ((0x3FFLL << 52) - ((exponent - (0x3FELL << 52)) /
                                     // 2)) & (0x7FFLL << 52);
 
-  MOV(64, R(RSCRATCH_EXTRA), R(RSCRATCH));
-  SHR(64, R(RSCRATCH_EXTRA), Imm8(48));
+  if (cpu_info.bBMI2)
+  {
+    RORX(64, RSCRATCH_EXTRA, R(RSCRATCH), 48);
+  }
+  else
+  {
+    MOV(64, R(RSCRATCH_EXTRA), R(RSCRATCH));
+    SHR(64, R(RSCRATCH_EXTRA), Imm8(48));
+  }
   AND(32, R(RSCRATCH_EXTRA), Imm8(0x1F));
 
   PUSH(RSCRATCH2);
@@ -241,9 +248,16 @@ void CommonAsmRoutines::GenFres()
   OR(32, R(RSCRATCH_EXTRA), R(RSCRATCH2));
   SHL(64, R(RSCRATCH_EXTRA), Imm8(52));  // vali = sign | exponent
 
-  MOV(64, R(RSCRATCH2), R(RSCRATCH));
+  if (cpu_info.bBMI2)
+  {
+    RORX(64, RSCRATCH2, R(RSCRATCH), 47);
+  }
+  else
+  {
+    MOV(64, R(RSCRATCH2), R(RSCRATCH));
+    SHR(64, R(RSCRATCH2), Imm8(47));
+  }
   SHR(64, R(RSCRATCH), Imm8(37));
-  SHR(64, R(RSCRATCH2), Imm8(47));
   AND(32, R(RSCRATCH), Imm32(0x3FF));  // i % 1024
   AND(32, R(RSCRATCH2), Imm8(0x1F));   // i / 1024
 
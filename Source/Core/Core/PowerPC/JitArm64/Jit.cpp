@@ -20,7 +20,9 @@
 #include "Common/MathUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/Trace.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -45,7 +47,8 @@ constexpr size_t NEAR_CODE_SIZE = 1024 * 1024 * 64;
 // farcode actually is needed, saving it from having to emit farcode for most instructions.
 // TODO: Perhaps implement something similar to Jit64. But using more RAM isn't much of a problem.
 constexpr size_t FAR_CODE_SIZE = 1024 * 1024 * 64;
-constexpr size_t TOTAL_CODE_SIZE = NEAR_CODE_SIZE * 2 + FAR_CODE_SIZE * 2;
+constexpr size_t CONST_POOL_SIZE = Arm64ConstantPool::CONST_POOL_SIZE;
+constexpr size_t TOTAL_CODE_SIZE = NEAR_CODE_SIZE * 2 + FAR_CODE_SIZE * 2 + CONST_POOL_SIZE;
 
 JitArm64::JitArm64(Core::System& system)
     : JitBase(system), m_float_emit(this),
@@ -62,10 +65,11 @@ void JitArm64::Init()
   RefreshConfig();
 
   // We want the regions to be laid out in this order in memory:
-  // m_far_code_0, m_near_code_0, m_near_code_1, m_far_code_1.
+  // m_far_code_0, m_near_code_0, m_near_code_1, m_far_code_1, m_const_pool.
   // AddChildCodeSpace grabs space from the end of the parent region,
   // so we have to call AddChildCodeSpace in reverse order.
-  AllocCodeSpace(TOTAL_CODE_SIZE);
+  AllocCodeSpace(TOTAL_CODE_SIZE, Config::Get(Config::MAIN_HUGE_PAGES));
+  m_const_pool.Init(AllocChildCodeSpace(CONST_POOL_SIZE), CONST_POOL_SIZE);
   AddChildCodeSpace(&m_far_code_1, FAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_1, NEAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_0, NEAR_CODE_SIZE);
@@ -176,6 +180,7 @@ void JitArm64::ClearCache()
   m_near_code_0.ClearCodeSpace();
   m_near_code_1.ClearCodeSpace();
   m_far_code_1.ClearCodeSpace();
+  m_const_pool.Clear();
   RefreshConfig();
 
   GenerateAsmAndResetFreeMemoryRanges();
@@ -250,9 +255,28 @@ void JitArm64::Shutdown()
   auto& memory = m_system.GetMemory();
   memory.ShutdownFastmemArena();
   FreeCodeSpace();
+  m_const_pool.Shutdown();
   blocks.Shutdown();
 }
 
+void JitArm64::MOVI2RFromPool(ARM64Reg Rd, u64 imm)
+{
+  ASSERT_MSG(DYNA_REC, Is64Bit(Rd), "The constant pool only holds 64-bit values");
+
+  // Emit the MOVI2R sequence to find out how long it is, and rewind if the pool does better
+  u8* const start = GetWritableCodePtr();
+  MOVI2R(Rd, imm);
+  if (HasWriteFailed() || GetCodePtr() - start <= static_cast<ptrdiff_t>(2 * sizeof(u32)))
+    return;
+
+  const u8* constant = m_const_pool.GetConstant(imm);
+  if (!constant)
+    return;
+
+  SetCodePtrUnsafe(start, GetWritableCodeEnd(), false);
+  LDR(IndexType::Unsigned, Rd, Rd, MOVPage2R(Rd, constant));
+}
+
 void JitArm64::FallBackToInterpreter(UGeckoInstruction inst)
 {
   FlushCarry();
@@ -944,6 +968,7 @@ void JitArm64::Jit(u32 em_address)
 
 void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 {
+  TRACE_SCOPE("JitArm64::Jit");
   CleanUpAfterStackFault();
 
   if (SConfig::GetInstance().bJITNoBlockCache)
@@ -979,6 +1004,7 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
+  ConfigureAnalyzerForBlock(em_address);
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
   if (code_block.m_memory_exception)
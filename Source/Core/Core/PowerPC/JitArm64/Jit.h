@@ -14,6 +14,7 @@
 
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/JitArm64/JitArm64Cache.h"
+#include "Core/PowerPC/JitArm64/JitArm64_ConstantPool.h"
 #include "Core/PowerPC/JitArm64/JitArm64_RegCache.h"
 #include "Core/PowerPC/JitArmCommon/BackPatch.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
@@ -228,6 +229,15 @@ protected:
 
   bool IsInFarCode() const { return m_in_far_code; }
 
+  // Like MOVI2R and MOVP2R, but loads the value from the constant pool if building it with
+  // MOVZ/MOVK would take more than the two instructions a load from the pool takes.
+  void MOVI2RFromPool(Arm64Gen::ARM64Reg Rd, u64 imm);
+  template <class P>
+  void MOVP2RFromPool(Arm64Gen::ARM64Reg Rd, P* ptr)
+  {
+    MOVI2RFromPool(Rd, reinterpret_cast<uintptr_t>(ptr));
+  }
+
   // Dump a memory range of code
   void DumpCode(const u8* start, const u8* end);
 
@@ -288,6 +298,11 @@ protected:
                                          Arm64Gen::ARM64Reg tmp, const void* bat_table);
   Arm64Gen::FixupBranch CheckIfSafeAddress(Arm64Gen::ARM64Reg addr, Arm64Gen::ARM64Reg tmp1,
                                            Arm64Gen::ARM64Reg tmp2);
+  // With the data cache emulated, looks up addr in it. On a hit, the PLRU and modified bits are
+  // updated, base and offset are pushed to the stack and then set to point at the data in the
+  // cache. Otherwise, jumps to the returned branch. Clobbers W0 and W30.
+  Arm64Gen::FixupBranch EmitDCacheLookup(u32 flags, Arm64Gen::ARM64Reg addr,
+                                         Arm64Gen::ARM64Reg base, Arm64Gen::ARM64Reg offset);
 
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
 
@@ -410,6 +425,8 @@ protected:
   //
   // m_far_code_0 and m_far_code_1 can't reach each other, but that isn't needed, because all blocks
   // have their entry points in near code.
+  //
+  // The constant pool comes after m_far_code_1, which keeps it within ADRP range of all code.
 
   Arm64Gen::ARM64CodeBlock m_near_code_0;
   Arm64Gen::ARM64CodeBlock m_near_code_1;
@@ -419,6 +436,8 @@ protected:
   Arm64Gen::ARM64CodeBlock m_far_code;
   bool m_in_far_code = false;
 
+  Arm64ConstantPool m_const_pool;
+
   // Backed up when we switch to far code.
   u8* m_near_code = nullptr;
   u8* m_near_code_end = nullptr;
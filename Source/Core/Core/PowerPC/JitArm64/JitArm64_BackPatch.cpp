@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/JitArm64/Jit.h"
 
+#include <array>
 #include <cstddef>
 #include <optional>
 #include <string>
@@ -59,8 +60,12 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
 {
   const u32 access_size = BackPatchInfo::GetFlagSize(flags);
 
+  // Cache hits are handled inline, everything else goes through the C++ code
+  const bool emit_dcache_access = m_accurate_cpu_cache_enabled && m_ppc_state.m_enable_dcache &&
+                                  !emitting_routine && !(flags & BackPatchInfo::FLAG_ZERO_256) &&
+                                  (m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR);
   if (m_accurate_cpu_cache_enabled)
-    mode = MemAccessMode::AlwaysSlowAccess;
+    mode = emit_dcache_access ? MemAccessMode::Auto : MemAccessMode::AlwaysSlowAccess;
 
   const bool emit_fast_access = mode != MemAccessMode::AlwaysSlowAccess;
   const bool emit_slow_access = mode != MemAccessMode::AlwaysFastAccess;
@@ -73,8 +78,25 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
   {
     ARM64Reg memory_base = MEM_REG;
     ARM64Reg memory_offset = addr;
+    std::array<ARM64Reg, 2> dcache_regs{};
 
-    if (!jo.fastmem)
+    if (emit_dcache_access)
+    {
+      // Two registers which aren't used by the access are saved to hold the location in the cache
+      BitSet32 used_gprs{0, 1, 30, DecodeReg(addr)};
+      if (IsGPR(RS))
+        used_gprs[DecodeReg(RS)] = true;
+      for (int i = 2, count = 0; count < 2; i++)
+      {
+        if (!used_gprs[i])
+          dcache_regs[count++] = ARM64Reg::X0 + i;
+      }
+
+      memory_base = dcache_regs[0];
+      memory_offset = EncodeRegTo32(dcache_regs[1]);
+      slow_access_fixup = EmitDCacheLookup(flags, addr, dcache_regs[0], dcache_regs[1]);
+    }
+    else if (!jo.fastmem)
     {
       const ARM64Reg temp = emitting_routine ? ARM64Reg::W3 : ARM64Reg::W30;
 
@@ -146,6 +168,9 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
 
       ByteswapAfterLoad(this, &m_float_emit, RS, RS, flags, true, false);
     }
+
+    if (emit_dcache_access)
+      LDP(IndexType::Post, dcache_regs[0], dcache_regs[1], ARM64Reg::SP, 16);
   }
   const u8* fast_access_end = GetCodePtr();
 
@@ -79,7 +79,7 @@ void JitArm64::WriteBranchWatch(u32 origin, u32 destination, UGeckoInstruction i
                                 ARM64Reg reg_b, BitSet32 gpr_caller_save, BitSet32 fpr_caller_save)
 {
   const ARM64Reg branch_watch = EncodeRegTo64(reg_a);
-  MOVP2R(branch_watch, &m_branch_watch);
+  MOVP2RFromPool(branch_watch, &m_branch_watch);
   LDRB(IndexType::Unsigned, reg_b, branch_watch, Core::BranchWatch::GetOffsetOfRecordingActive());
   FixupBranch branch_over = CBZ(reg_b);
 
@@ -115,7 +115,7 @@ void JitArm64::WriteBranchWatchDestInRegister(u32 origin, ARM64Reg destination,
                                               BitSet32 fpr_caller_save)
 {
   const ARM64Reg branch_watch = EncodeRegTo64(reg_a);
-  MOVP2R(branch_watch, &m_branch_watch);
+  MOVP2RFromPool(branch_watch, &m_branch_watch);
   LDRB(IndexType::Unsigned, reg_b, branch_watch, Core::BranchWatch::GetOffsetOfRecordingActive());
   FixupBranch branch_over = CBZ(reg_b);
 
@@ -188,10 +188,7 @@ void JitArm64::bx(UGeckoInstruction inst)
     }
 
     // make idle loops go faster
-    ARM64Reg XA = EncodeRegTo64(WA);
-
-    MOVP2R(XA, &CoreTiming::GlobalIdle);
-    BLR(XA);
+    ABI_CallFunction(&CoreTiming::IdleFromJIT, &m_system.GetCoreTiming());
     WA.Unlock();
 
     WriteExceptionExit(js.op->branchTo);
@@ -213,6 +210,18 @@ void JitArm64::bcx(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITBranchOff);
 
+  const bool check_ctr = (inst.BO & BO_DONT_DECREMENT_FLAG) == 0;
+  const bool check_condition = (inst.BO & BO_DONT_CHECK_CONDITION) == 0;
+
+  BranchProfile* profile = nullptr;
+  if (check_ctr || check_condition)
+    profile = GetBranchProfile(js.compilerPC);
+
+  // The exit for an unlikely branch goes to far code. Exits for calls and idle loops use far code
+  // themselves.
+  const bool unlikely = (check_ctr || check_condition) && !inst.LK && !js.op->branchIsIdleLoop &&
+                        IsBranchUnlikely(js.compilerPC);
+
   auto WA = gpr.GetScopedReg();
   auto WB = inst.LK || IsDebuggingEnabled() ? gpr.GetScopedReg() :
                                               Arm64GPRCache::ScopedARM64Reg(WA.GetReg());
@@ -222,8 +231,22 @@ void JitArm64::bcx(UGeckoInstruction inst)
                   gpr.GetScopedReg() :
                   Arm64GPRCache::ScopedARM64Reg(ARM64Reg::INVALID_REG);
 
+    // Allocated up front, as allocating can spill a register in only one of the paths.
+    auto WD = profile ? gpr.GetScopedReg() : Arm64GPRCache::ScopedARM64Reg(ARM64Reg::INVALID_REG);
+    const auto increment_counter = [&](u64* counter) {
+      const ARM64Reg XA = EncodeRegTo64(WA);
+      const ARM64Reg XD = EncodeRegTo64(WD);
+      MOVP2R(XA, counter);
+      LDR(IndexType::Unsigned, XD, XA, 0);
+      ADD(XD, XD, 1);
+      STR(IndexType::Unsigned, XD, XA, 0);
+    };
+
+    if (profile)
+      increment_counter(&profile->runs);
+
     FixupBranch pCTRDontBranch;
-    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)  // Decrement and test CTR
+    if (check_ctr)  // Decrement and test CTR
     {
       LDR(IndexType::Unsigned, WA, PPC_REG, PPCSTATE_OFF_SPR(SPR_CTR));
       SUBS(WA, WA, 1);
@@ -237,12 +260,22 @@ void JitArm64::bcx(UGeckoInstruction inst)
 
     FixupBranch pConditionDontBranch;
 
-    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)  // Test a CR bit
+    if (check_condition)  // Test a CR bit
     {
       pConditionDontBranch =
           JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !(inst.BO_2 & BO_BRANCH_IF_TRUE));
     }
 
+    if (unlikely)
+    {
+      FixupBranch far_addr = B();
+      SwitchToFarCode();
+      SetJumpTarget(far_addr);
+    }
+
+    if (profile)
+      increment_counter(&profile->taken);
+
     if (inst.LK)
     {
       MOVI2R(WA, js.compilerPC + 4);
@@ -268,10 +301,7 @@ void JitArm64::bcx(UGeckoInstruction inst)
     if (js.op->branchIsIdleLoop)
     {
       // make idle loops go faster
-      ARM64Reg XA = EncodeRegTo64(WA);
-
-      MOVP2R(XA, &CoreTiming::GlobalIdle);
-      BLR(XA);
+      ABI_CallFunction(&CoreTiming::IdleFromJIT, &m_system.GetCoreTiming());
 
       WriteExceptionExit(js.op->branchTo);
     }
@@ -280,9 +310,12 @@ void JitArm64::bcx(UGeckoInstruction inst)
       WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4, WA);
     }
 
-    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+    if (unlikely)
+      SwitchToNearCode();
+
+    if (check_condition)
       SetJumpTarget(pConditionDontBranch);
-    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+    if (check_ctr)
       SetJumpTarget(pCTRDontBranch);
   }
 
@@ -427,10 +460,7 @@ void JitArm64::bclrx(UGeckoInstruction inst)
     if (js.op->branchIsIdleLoop)
     {
       // make idle loops go faster
-      ARM64Reg XA = EncodeRegTo64(WA);
-
-      MOVP2R(XA, &CoreTiming::GlobalIdle);
-      BLR(XA);
+      ABI_CallFunction(&CoreTiming::IdleFromJIT, &m_system.GetCoreTiming());
 
       WriteExceptionExit(js.op->branchTo);
     }
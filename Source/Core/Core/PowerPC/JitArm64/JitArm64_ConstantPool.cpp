@@ -0,0 +1,45 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitArm64/JitArm64_ConstantPool.h"
+
+#include <cstring>
+
+#include "Common/MemoryUtil.h"
+
+void Arm64ConstantPool::Init(u8* memory, size_t size)
+{
+  m_region = memory;
+  m_region_size = size;
+  Clear();
+}
+
+void Arm64ConstantPool::Clear()
+{
+  m_used_size = 0;
+  m_locations.clear();
+}
+
+void Arm64ConstantPool::Shutdown()
+{
+  m_region = nullptr;
+  m_region_size = 0;
+  Clear();
+}
+
+const u8* Arm64ConstantPool::GetConstant(u64 value)
+{
+  if (const auto iter = m_locations.find(value); iter != m_locations.end())
+    return iter->second;
+
+  // The constants are always 8-byte aligned, as the scaled offsets of LDR require
+  if (m_used_size + sizeof(value) > m_region_size)
+    return nullptr;
+
+  u8* location = m_region + m_used_size;
+  m_used_size += sizeof(value);
+
+  std::memcpy(Common::GetWritableAlias(location), &value, sizeof(value));
+  m_locations.emplace(value, location);
+  return location;
+}
@@ -0,0 +1,32 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+
+#include "Common/CommonTypes.h"
+
+// 64-bit constants are copied into this pool, which is allocated next to the code regions. This
+// lets the code load them with an ADRP and an LDR, which is shorter than the up to four
+// instructions MOVI2R needs for values like pointers to host structures.
+class Arm64ConstantPool
+{
+public:
+  static constexpr size_t CONST_POOL_SIZE = 1024 * 64;
+
+  void Init(u8* memory, size_t size);
+  void Clear();
+  void Shutdown();
+
+  // Copies the value into the pool if it isn't there already, and returns its location.
+  // Returns nullptr if the pool has run out of space.
+  const u8* GetConstant(u64 value);
+
+private:
+  u8* m_region = nullptr;
+  size_t m_region_size = 0;
+  size_t m_used_size = 0;
+  std::unordered_map<u64, const u8*> m_locations;
+};
@@ -348,7 +348,7 @@ FixupBranch JitArm64::BATAddressLookup(ARM64Reg addr_out, ARM64Reg addr_in, ARM6
 {
   tmp = EncodeRegTo64(tmp);
 
-  MOVP2R(tmp, bat_table);
+  MOVP2RFromPool(tmp, bat_table);
   LSR(addr_out, addr_in, PowerPC::BAT_INDEX_SHIFT);
   LDR(addr_out, tmp, ArithOption(addr_out, true));
   FixupBranch pass = TBNZ(addr_out, MathUtil::IntLog2(PowerPC::BAT_MAPPED_BIT));
@@ -362,7 +362,7 @@ FixupBranch JitArm64::CheckIfSafeAddress(Arm64Gen::ARM64Reg addr, Arm64Gen::ARM6
 {
   tmp2 = EncodeRegTo64(tmp2);
 
-  MOVP2R(tmp2, m_mmu.GetDBATTable().data());
+  MOVP2RFromPool(tmp2, m_mmu.GetDBATTable().data());
   LSR(tmp1, addr, PowerPC::BAT_INDEX_SHIFT);
   LDR(tmp1, tmp2, ArithOption(tmp1, true));
   FixupBranch pass = TBNZ(tmp1, MathUtil::IntLog2(PowerPC::BAT_PHYSICAL_BIT));
@@ -371,6 +371,90 @@ FixupBranch JitArm64::CheckIfSafeAddress(Arm64Gen::ARM64Reg addr, Arm64Gen::ARM6
   return fail;
 }
 
+FixupBranch JitArm64::EmitDCacheLookup(u32 flags, ARM64Reg addr, ARM64Reg base, ARM64Reg offset)
+{
+  constexpr u32 plru_offset = PPCSTATE_OFF(dCache.plru);
+  constexpr u32 modified_offset = PPCSTATE_OFF(dCache.modified);
+  constexpr u32 bits_page = plru_offset & ~0xFFF;
+  static_assert(modified_offset - bits_page < 0x1000 && bits_page < 0x1000000);
+
+  const u32 access_size = BackPatchInfo::GetFlagSize(flags);
+  const PowerPC::Cache& dcache = m_ppc_state.dCache;
+  const ARM64Reg way = ARM64Reg::W0;
+  const ARM64Reg tmp = ARM64Reg::W30;
+  const ARM64Reg base_32 = EncodeRegTo32(base);
+  const ARM64Reg offset_32 = EncodeRegTo32(offset);
+  addr = EncodeRegTo32(addr);
+
+  // The far code is out of range of conditional branches, so they all go through this
+  FixupBranch lookup = B();
+  const u8* miss = GetCodePtr();
+  FixupBranch fail = B();
+  SetJumpTarget(lookup);
+
+  // Only MEM1 and MEM2 which aren't uncached (or watched) are looked up
+  MOVP2RFromPool(ARM64Reg::X0, m_mmu.GetDBATTable().data());
+  LSR(tmp, addr, PowerPC::BAT_INDEX_SHIFT);
+  LDR(tmp, ARM64Reg::X0, ArithOption(tmp, true));
+  TBZ(tmp, MathUtil::IntLog2(PowerPC::BAT_PHYSICAL_BIT), miss);
+  BFI(tmp, addr, 0, PowerPC::BAT_INDEX_SHIFT);
+
+  // Accesses crossing into the next block are split up by the C++ code
+  if (access_size > 8)
+  {
+    AND(way, addr, LogicalImm(31, GPRSize::B32));
+    CMP(way, 32 - access_size / 8);
+    B(CCFlags::CC_HI, miss);
+  }
+
+  // Leave the locked L1 and fake VMEM to the C++ code too
+  TST(tmp, LogicalImm(~(PowerPC::CACHE_VMEM_BIT - 1), GPRSize::B32));
+  B(CCFlags::CC_NEQ, miss);
+
+  MOVP2RFromPool(ARM64Reg::X0, dcache.lookup_table.data());
+  FixupBranch mem1 = TBZ(tmp, MathUtil::IntLog2(PowerPC::CACHE_EXRAM_BIT));
+  MOVP2RFromPool(ARM64Reg::X0, dcache.lookup_table_ex.data());
+  AND(tmp, tmp, LogicalImm(~PowerPC::CACHE_EXRAM_BIT, GPRSize::B32));
+  SetJumpTarget(mem1);
+  LSR(tmp, tmp, 5);
+  LDRB(way, ARM64Reg::X0, ArithOption(EncodeRegTo64(tmp)));
+  CMP(way, 0xFF);
+  B(CCFlags::CC_EQ, miss);
+
+  STP(IndexType::Pre, base, offset, ARM64Reg::SP, -16);
+
+  // Update the bits of the set like Cache::GetCache does
+  UBFX(base_32, addr, 5, 7);
+  ADD(base, PPC_REG, base);
+  ADDI2R(base, base, bits_page);
+  LDRB(IndexType::Unsigned, tmp, base, plru_offset - bits_page);
+  MOVP2RFromPool(offset, PowerPC::PLRU_MASK.data());
+  LDRB(offset_32, offset, ArithOption(EncodeRegTo64(way)));
+  BIC(tmp, tmp, offset_32);
+  MOVP2RFromPool(offset, PowerPC::PLRU_VALUE.data());
+  LDRB(offset_32, offset, ArithOption(EncodeRegTo64(way)));
+  ORR(tmp, tmp, offset_32);
+  STRB(IndexType::Unsigned, tmp, base, plru_offset - bits_page);
+
+  if (flags & BackPatchInfo::FLAG_STORE)
+  {
+    LDRB(IndexType::Unsigned, tmp, base, modified_offset - bits_page);
+    MOVI2R(offset_32, 1);
+    LSLV(offset_32, offset_32, way);
+    ORR(tmp, tmp, offset_32);
+    STRB(IndexType::Unsigned, tmp, base, modified_offset - bits_page);
+  }
+
+  // The block is at dCache.data[set][way]
+  UBFX(base_32, addr, 5, 7);
+  ADD(base_32, way, base_32, ArithOption(base_32, ShiftType::LSL, 3));
+  ADD(base, PPC_REG, base, ArithOption(base, ShiftType::LSL, 5));
+  ADDI2R(base, base, PPCSTATE_OFF(dCache.data), EncodeRegTo64(tmp));
+  AND(offset_32, addr, LogicalImm(31, GPRSize::B32));
+
+  return fail;
+}
+
 void JitArm64::lXX(UGeckoInstruction inst)
 {
   INSTRUCTION_START
@@ -829,7 +913,7 @@ void JitArm64::dcbx(UGeckoInstruction inst)
     if (IsDebuggingEnabled())
     {
       const ARM64Reg branch_watch = EncodeRegTo64(reg_cycle_count);
-      MOVP2R(branch_watch, &m_branch_watch);
+      MOVP2RFromPool(branch_watch, &m_branch_watch);
       LDRB(IndexType::Unsigned, WB, branch_watch, Core::BranchWatch::GetOffsetOfRecordingActive());
       FixupBranch branch_over = CBZ(WB);
 
@@ -887,7 +971,7 @@ void JitArm64::dcbx(UGeckoInstruction inst)
 
   // Check whether a JIT cache line needs to be invalidated.
   LSR(physical_addr, physical_addr, 5 + 5);  // >> 5 for cache line size, >> 5 for width of bitset
-  MOVP2R(EncodeRegTo64(WA), GetBlockCache()->GetBlockBitSet());
+  MOVP2RFromPool(EncodeRegTo64(WA), GetBlockCache()->GetBlockBitSet());
   LDR(physical_addr, EncodeRegTo64(WA), ArithOption(EncodeRegTo64(physical_addr), true));
 
   LSR(WA, effective_addr, 5);  // mask sizeof cacheline, & 0x1f is the position within the bitset
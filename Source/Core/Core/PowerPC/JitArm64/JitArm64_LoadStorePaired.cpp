@@ -109,7 +109,7 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
     UBFM(type_reg, scale_reg, 16, 18);   // Type
     UBFM(scale_reg, scale_reg, 24, 29);  // Scale
 
-    MOVP2R(ARM64Reg::X30, w ? single_load_quantized : paired_load_quantized);
+    MOVP2RFromPool(ARM64Reg::X30, w ? single_load_quantized : paired_load_quantized);
     LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
     BLR(EncodeRegTo64(type_reg));
 
@@ -267,7 +267,7 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
     UBFM(type_reg, scale_reg, 0, 2);    // Type
     UBFM(scale_reg, scale_reg, 8, 13);  // Scale
 
-    MOVP2R(ARM64Reg::X30, w ? single_store_quantized : paired_store_quantized);
+    MOVP2RFromPool(ARM64Reg::X30, w ? single_store_quantized : paired_store_quantized);
     LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
     BLR(EncodeRegTo64(type_reg));
 
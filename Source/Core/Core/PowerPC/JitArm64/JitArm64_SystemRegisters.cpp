@@ -274,7 +274,7 @@ void JitArm64::mcrxr(UGeckoInstruction inst)
   // [SO OV CA 0] << 3
   LSL(WA, WA, 4);
 
-  MOVP2R(XB, PowerPC::ConditionRegister::s_crTable.data());
+  MOVP2RFromPool(XB, PowerPC::ConditionRegister::s_crTable.data());
   LDR(XB, XB, XA);
 
   // Clear XER[0-3]
@@ -295,6 +295,8 @@ void JitArm64::mtsr(UGeckoInstruction inst)
 {
   INSTRUCTION_START
   JITDISABLE(bJITSystemRegistersOff);
+  // The page table fastmem mappings depend on the segment registers
+  FALLBACK_IF(jo.fastmem_arena);
 
   STR(IndexType::Unsigned, gpr.R(inst.RS), PPC_REG, PPCSTATE_OFF_SR(inst.SR));
 }
@@ -321,6 +323,8 @@ void JitArm64::mtsrin(UGeckoInstruction inst)
 {
   INSTRUCTION_START
   JITDISABLE(bJITSystemRegistersOff);
+  // The page table fastmem mappings depend on the segment registers
+  FALLBACK_IF(jo.fastmem_arena);
 
   u32 b = inst.RB, d = inst.RD;
   gpr.BindToRegister(d, d == b);
@@ -431,7 +435,7 @@ void JitArm64::mfspr(UGeckoInstruction inst)
     // cost of calling out to C for this is actually significant.
 
     auto& core_timing_globals = m_system.GetCoreTiming().GetGlobals();
-    MOVP2R(Xg, &core_timing_globals);
+    MOVP2RFromPool(Xg, &core_timing_globals);
 
     LDR(IndexType::Unsigned, WA, PPC_REG, PPCSTATE_OFF(downcount));
     m_float_emit.SCVTF(SC, WA);
@@ -763,7 +767,7 @@ void JitArm64::mtcrf(UGeckoInstruction inst)
     ARM64Reg RS = gpr.R(inst.RS);
     auto WB = gpr.GetScopedReg();
     ARM64Reg XB = EncodeRegTo64(WB);
-    MOVP2R(XB, PowerPC::ConditionRegister::s_crTable.data());
+    MOVP2RFromPool(XB, PowerPC::ConditionRegister::s_crTable.data());
     for (int i = 0; i < 8; ++i)
     {
       if ((crm & (0x80 >> i)) != 0)
@@ -818,7 +822,7 @@ void JitArm64::mcrfs(UGeckoInstruction inst)
     STR(IndexType::Unsigned, WA, PPC_REG, PPCSTATE_OFF(fpscr));
   }
 
-  MOVP2R(XA, PowerPC::ConditionRegister::s_crTable.data());
+  MOVP2RFromPool(XA, PowerPC::ConditionRegister::s_crTable.data());
   LDR(CR, XA, ArithOption(CR, true));
 }
 
@@ -185,15 +185,23 @@ void JitArm64::GenerateAsm()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   EmitUpdateMembase();
 
+  // JitTrampoline might have run the block in the interpreter instead of compiling it
+  LDR(IndexType::Unsigned, ARM64Reg::W8, PPC_REG, PPCSTATE_OFF(downcount));
+  CMP(ARM64Reg::W8, 0);
+  FixupBranch bail_after_trampoline = B(CC_LE);
+
   B(dispatcher_no_check);
 
   SetJumpTarget(bail);
+  SetJumpTarget(bail_after_trampoline);
   do_timing = GetCodePtr();
   // Write the current PC out to PPCSTATE
   static_assert(PPCSTATE_OFF(pc) <= 252);
   static_assert(PPCSTATE_OFF(pc) + 4 == PPCSTATE_OFF(npc));
   STP(IndexType::Signed, DISPATCHER_PC, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
 
+  ABI_CallFunction(&JitBase::SampleHotBlock, this);
+
   // Check the state pointer to see if we are exiting
   // Gets checked on at the end of every slice
   LDR(IndexType::Unsigned, ARM64Reg::W8, ARM64Reg::X8, MOVPage2R(ARM64Reg::X8, cpu.GetStatePtr()));
@@ -201,10 +209,10 @@ void JitArm64::GenerateAsm()
   FixupBranch exit = CBNZ(ARM64Reg::W8);
 
   SetJumpTarget(to_start_of_timing_slice);
-  ABI_CallFunction(&CoreTiming::GlobalAdvance);
+  ABI_CallFunction(&CoreTiming::AdvanceFromJIT, &m_system.GetCoreTiming());
 
   // When we've just entered the jit we need to update the membase
-  // GlobalAdvance also checks exceptions after which we need to
+  // AdvanceFromJIT also checks exceptions after which we need to
   // update the membase so it makes sense to do this here.
   EmitUpdateMembase();
 
@@ -19,6 +19,7 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
 #include "Core/MemTools.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -88,9 +89,37 @@ const u8* JitBase::Dispatch(JitBase& jit)
   return jit.GetBlockCache()->Dispatch();
 }
 
+void JitBase::SampleHotBlock(JitBase& jit)
+{
+  if (!jit.m_recompile_hot_blocks || jit.IsDebuggingEnabled())
+    return;
+
+  // Sampling the PC at the end of timing slices is much cheaper than counting block runs, and
+  // it's just as good at finding the handful of blocks that run most of the time.
+  const u32 pc = jit.m_ppc_state.pc;
+  const CPUEmuFeatureFlags feature_flags = jit.m_ppc_state.feature_flags;
+  JitBlock* block = jit.GetBlockCache()->GetBlockFromStartAddress(pc, feature_flags);
+  if (!block || ++block->hot_samples < HOT_BLOCK_SAMPLES)
+    return;
+
+  const u64 key = BlockKey(pc, feature_flags);
+  if (jit.m_hot_blocks.contains(key) || jit.m_hot_blocks.size() >= MAX_HOT_BLOCKS)
+    return;
+
+  DEBUG_LOG_FMT(DYNA_REC, "Recompiling hot block at {:08x}", pc);
+
+  // The block gets recompiled with the hot tier options the next time it's dispatched.
+  jit.m_hot_blocks.insert(key);
+  jit.EraseSingleBlock(*block);
+}
+
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
+  if (jit.TryInterpretColdBlock(em_address))
+    return;
+
   jit.Jit(em_address);
+  jit.PrewarmBlocks(em_address);
 }
 
 JitBase::JitBase(Core::System& system)
@@ -111,8 +140,52 @@ JitBase::~JitBase()
   CPUThreadConfigCallback::RemoveConfigChangedCallback(m_registered_config_callback_id);
 }
 
+void JitBase::PrewarmBlocks(u32 em_address)
+{
+  if (IsDebuggingEnabled() || SConfig::GetInstance().bJITNoBlockCache)
+    return;
+
+  for (const u32 address : GetBlockCache()->GetPrewarmAddresses(em_address))
+    Jit(address);
+}
+
+bool JitBase::TryInterpretColdBlock(u32 em_address)
+{
+  if (m_compile_threshold <= 0 || IsDebuggingEnabled())
+    return false;
+
+  // Code that only runs a few times, like initialization code and loaders, doesn't gain anything
+  // from being compiled, and compiling it causes stutter whenever a game reaches new code.
+  const u64 key = BlockKey(em_address, m_ppc_state.feature_flags);
+  if (m_hot_blocks.contains(key))
+    return false;
+
+  const auto [it, inserted] = m_cold_block_run_counts.try_emplace(key, 0);
+  if (++it->second > m_compile_threshold)
+  {
+    m_cold_block_run_counts.erase(it);
+    return false;
+  }
+
+  // Games that generate code at runtime can make this grow without bound.
+  if (m_cold_block_run_counts.size() > MAX_COLD_BLOCKS)
+    m_cold_block_run_counts.clear();
+
+  // The dispatcher checks the downcount again after returning from JitTrampoline.
+  m_ppc_state.downcount -= m_system.GetInterpreter().RunSingleBlock();
+  return true;
+}
+
 bool JitBase::DoesConfigNeedRefresh() const
 {
+  if (m_compile_threshold != Config::Get(Config::MAIN_JIT_COMPILE_THRESHOLD) ||
+      m_recompile_hot_blocks != Config::Get(Config::MAIN_JIT_RECOMPILE_HOT_BLOCKS) ||
+      m_profile_branches !=
+          (m_recompile_hot_blocks && Config::Get(Config::MAIN_JIT_PROFILE_BRANCHES)))
+  {
+    return true;
+  }
+
   return std::ranges::any_of(JIT_SETTINGS, [this](const auto& pair) {
     return this->*pair.first != Config::Get(*pair.second);
   });
@@ -123,6 +196,17 @@ void JitBase::RefreshConfig()
   for (const auto& [member, config_info] : JIT_SETTINGS)
     this->*member = Config::Get(*config_info);
 
+  m_compile_threshold = Config::Get(Config::MAIN_JIT_COMPILE_THRESHOLD);
+  m_cold_block_run_counts.clear();
+  // The set of hot blocks is kept across cache clears, which happen on every savestate load.
+  m_recompile_hot_blocks = Config::Get(Config::MAIN_JIT_RECOMPILE_HOT_BLOCKS);
+  if (!m_recompile_hot_blocks)
+    m_hot_blocks.clear();
+  // Only hot blocks use the branch profiles. Like the hot blocks, they're kept across cache clears.
+  m_profile_branches = m_recompile_hot_blocks && Config::Get(Config::MAIN_JIT_PROFILE_BRANCHES);
+  if (!m_profile_branches)
+    m_branch_profiles.clear();
+
   if (m_accurate_cpu_cache_enabled)
   {
     m_fastmem_enabled = false;
@@ -135,9 +219,10 @@ void JitBase::RefreshConfig()
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
   analyzer.SetDivByZeroExceptionsEnabled(m_enable_div_by_zero_exceptions);
 
+  // Watchpoints don't need fastmem to be disabled, since the fastmem arena protects the pages
+  // holding them. Fast accesses to those pages fault and get backpatched into slow accesses.
   bool any_watchpoints = m_system.GetPowerPC().GetMemChecks().HasAny();
-  jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && (m_ppc_state.msr.DR || !any_watchpoints) &&
-               EMM::IsExceptionHandlerSupported();
+  jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && EMM::IsExceptionHandlerSupported();
   jo.memcheck = m_system.IsMMUMode() || m_system.IsPauseOnPanicMode() || any_watchpoints;
   jo.fp_exceptions = m_enable_float_exceptions;
   jo.div_by_zero_exceptions = m_enable_div_by_zero_exceptions;
@@ -277,6 +362,46 @@ bool JitBase::CanMergeNextInstructions(int count) const
   return true;
 }
 
+void JitBase::ConfigureAnalyzerForBlock(u32 em_address)
+{
+  js.isHotBlock = m_hot_blocks.contains(BlockKey(em_address, m_ppc_state.feature_flags));
+  if (js.isHotBlock)
+  {
+    analyzer.SetBranchFollowingEnabled(true);
+    analyzer.SetBranchFollowingThreshold(HOT_BRANCH_FOLLOWING_THRESHOLD);
+  }
+  else
+  {
+    analyzer.SetBranchFollowingEnabled(m_enable_branch_following);
+    analyzer.SetBranchFollowingThreshold(
+        PPCAnalyst::PPCAnalyzer::DEFAULT_BRANCH_FOLLOWING_THRESHOLD);
+  }
+}
+
+JitBase::BranchProfile* JitBase::GetBranchProfile(u32 address)
+{
+  if (!m_profile_branches || js.isHotBlock || IsDebuggingEnabled())
+    return nullptr;
+
+  if (const auto it = m_branch_profiles.find(address); it != m_branch_profiles.end())
+    return &it->second;
+
+  if (m_branch_profiles.size() >= MAX_BRANCH_PROFILES)
+    return nullptr;
+  return &m_branch_profiles[address];
+}
+
+bool JitBase::IsBranchUnlikely(u32 address) const
+{
+  if (!js.isHotBlock || IsDebuggingEnabled())
+    return false;
+
+  const auto it = m_branch_profiles.find(address);
+  if (it == m_branch_profiles.end() || it->second.runs < MIN_BRANCH_PROFILE_RUNS)
+    return false;
+  return it->second.taken * UNLIKELY_BRANCH_RATIO < it->second.runs;
+}
+
 bool JitBase::ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op) const
 {
   if (jo.fp_exceptions)
@@ -8,6 +8,7 @@
 #include <iosfwd>
 #include <map>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -80,6 +81,20 @@ protected:
   static constexpr size_t GUARD_SIZE = 64 * 1024;
   static constexpr size_t GUARD_OFFSET = SAFE_STACK_SIZE - GUARD_SIZE;
 
+  static constexpr size_t MAX_COLD_BLOCKS = 0x10000;
+
+  // A block is considered hot once this many timing slices have ended right before it.
+  static constexpr u32 HOT_BLOCK_SAMPLES = 64;
+  static constexpr size_t MAX_HOT_BLOCKS = 0x4000;
+  // Hot blocks may inline this many unconditional branches, calls and returns.
+  static constexpr u32 HOT_BRANCH_FOLLOWING_THRESHOLD = 8;
+
+  static constexpr size_t MAX_BRANCH_PROFILES = 0x10000;
+  // A profiled branch needs to have run this often before hot blocks lay it out by its profile.
+  static constexpr u64 MIN_BRANCH_PROFILE_RUNS = 256;
+  // Branches taken less than once in this many runs are considered unlikely.
+  static constexpr u64 UNLIKELY_BRANCH_RATIO = 16;
+
   struct JitOptions
   {
     bool enableBlocklink;
@@ -127,6 +142,8 @@ protected:
     BitSet32 fpr_is_store_safe;
 
     JitBlock* curBlock;
+    // Set when the block is compiled with the hot tier options.
+    bool isHotBlock = false;
 
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
@@ -162,6 +179,27 @@ protected:
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
 
+  // Number of times a block is run in the interpreter before it gets compiled. 0 means that
+  // blocks are always compiled right away.
+  int m_compile_threshold = 0;
+  std::unordered_map<u64, int> m_cold_block_run_counts;
+
+  // Blocks that are recompiled with more aggressive analyzer options.
+  bool m_recompile_hot_blocks = false;
+  std::unordered_set<u64> m_hot_blocks;
+
+  // How often the conditional branches in blocks that aren't hot yet run and are taken, by
+  // address. Hot blocks move the taken path of unlikely branches to far code, so that the likely
+  // path falls through. The counters are updated by the generated code, so entries can only be
+  // removed after clearing the cache.
+  struct BranchProfile
+  {
+    u64 runs = 0;
+    u64 taken = 0;
+  };
+  bool m_profile_branches = false;
+  std::unordered_map<u32, BranchProfile> m_branch_profiles;
+
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
@@ -190,6 +228,20 @@ protected:
 
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op) const;
 
+  static u64 BlockKey(u32 em_address, CPUEmuFeatureFlags feature_flags)
+  {
+    return (static_cast<u64>(feature_flags) << 32) | em_address;
+  }
+
+  // Sets up the analyzer for the tier that the block at the given address is compiled in.
+  void ConfigureAnalyzerForBlock(u32 em_address);
+
+  // Returns the counters that the conditional branch at the given address should update, or
+  // nullptr if it shouldn't be profiled.
+  BranchProfile* GetBranchProfile(u32 address);
+  // Whether the conditional branch at the given address should be laid out as unlikely.
+  bool IsBranchUnlikely(u32 address) const;
+
 public:
   explicit JitBase(Core::System& system);
   JitBase(const JitBase&) = delete;
@@ -203,10 +255,19 @@ public:
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
 
   static const u8* Dispatch(JitBase& jit);
+  // Called by the dispatcher at the end of every timing slice.
+  static void SampleHotBlock(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Compiles blocks near the given address that were compiled in previous sessions of the game.
+  void PrewarmBlocks(u32 em_address);
+
+  // Runs a block that hasn't been compiled yet in the interpreter if it hasn't been run often
+  // enough to be worth compiling. Returns false if the block should be compiled instead.
+  bool TryInterpretColdBlock(u32 em_address);
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
@@ -7,7 +7,6 @@
 #include <array>
 #include <cstring>
 #include <functional>
-#include <map>
 #include <ranges>
 #include <set>
 #include <span>
@@ -16,12 +15,15 @@
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -47,6 +49,38 @@ void JitBlock::ProfileData::EndProfiling(ProfileData* data, u32 downcount_amount
   data->time_spent += Clock::now() - data->time_start;
 }
 
+void JitBlockBucketTable::Insert(u32 address, JitBlock* block)
+{
+  std::unique_ptr<Region>& region = m_regions[address >> REGION_SHIFT];
+  if (!region)
+    region = std::make_unique<Region>();
+
+  Bucket& bucket = (*region)[(address >> BUCKET_SHIFT) % BUCKETS_PER_REGION];
+  if (std::ranges::find(bucket, block) == bucket.end())
+    bucket.push_back(block);
+}
+
+void JitBlockBucketTable::Erase(u32 address, const JitBlock* block)
+{
+  Bucket* bucket = Find(address);
+  if (!bucket)
+    return;
+
+  const auto it = std::ranges::find(*bucket, block);
+  if (it == bucket->end())
+    return;
+
+  // Order doesn't matter, so avoid shifting the remaining elements.
+  *it = bucket->back();
+  bucket->pop_back();
+}
+
+void JitBlockBucketTable::Clear()
+{
+  for (std::unique_ptr<Region>& region : m_regions)
+    region.reset();
+}
+
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
 {
 }
@@ -63,6 +97,8 @@ void JitBaseBlockCache::Init()
     m_entry_points_ptr = static_cast<u8**>(m_entry_points_arena.Create(FAST_BLOCK_MAP_SIZE));
 #endif
 
+  m_persistent_cache_enabled = Config::Get(Config::MAIN_JIT_PERSISTENT_CACHE);
+
   Clear();
 }
 
@@ -70,6 +106,9 @@ void JitBaseBlockCache::Shutdown()
 {
   Common::JitRegister::Shutdown();
 
+  m_persistent_cache.Save();
+  m_persistent_cache.Clear();
+
   m_entry_points_arena.Release();
 }
 
@@ -83,13 +122,16 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
-  for (auto& e : block_map)
+  for (BlockSlot& slot : m_block_pool)
   {
-    DestroyBlock(e.second);
+    if (slot.in_use)
+      DestroyBlock(slot);
   }
-  block_map.clear();
-  links_to.clear();
-  block_range_map.clear();
+  m_block_pool.clear();
+  m_free_block_slots.clear();
+  m_block_count = 0;
+  links_to.Clear();
+  block_range_map.Clear();
 
   valid_block.ClearAll();
 
@@ -116,15 +158,20 @@ JitBlock** JitBaseBlockCache::GetFastBlockMapFallback()
 void JitBaseBlockCache::RunOnBlocks(const Core::CPUThreadGuard&,
                                     std::function<void(const JitBlock&)> f) const
 {
-  for (const auto& e : block_map)
-    f(e.second);
+  for (const BlockSlot& slot : m_block_pool)
+  {
+    if (slot.in_use)
+      f(slot);
+  }
 }
 
 void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 {
-  for (const auto& kv : block_map)
+  for (const BlockSlot& slot : m_block_pool)
   {
-    if (JitBlock::ProfileData* const profile_data = kv.second.profile_data.get())
+    if (!slot.in_use)
+      continue;
+    if (JitBlock::ProfileData* const profile_data = slot.profile_data.get())
       *profile_data = {};
   }
   Host_JitProfileDataWiped();
@@ -133,7 +180,22 @@ void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
   const u32 physical_address = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
-  JitBlock& b = block_map.emplace(physical_address, m_jit.IsProfilingEnabled())->second;
+
+  BlockSlot* slot;
+  if (m_free_block_slots.empty())
+  {
+    slot = &m_block_pool.emplace_back(m_jit.IsProfilingEnabled());
+  }
+  else
+  {
+    slot = m_free_block_slots.back();
+    m_free_block_slots.pop_back();
+    static_cast<JitBlock&>(*slot) = JitBlock(m_jit.IsProfilingEnabled());
+    slot->in_use = true;
+  }
+  ++m_block_count;
+
+  JitBlock& b = *slot;
   b.effectiveAddress = em_address;
   b.physicalAddress = physical_address;
   b.feature_flags = m_jit.m_ppc_state.feature_flags;
@@ -171,17 +233,19 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
                                  original_buffer_transform_view.end());
   }
 
+  // The entry point is always the first physical address, so the block also lands in the bucket
+  // that GetBlockFromStartAddress looks at.
   for (u32 addr : block.physical_addresses)
   {
     valid_block.Set(addr / 32);
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].insert(&block);
+    block_range_map.Insert(addr, &block);
   }
 
   if (block_link)
   {
     for (const auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      links_to.Insert(e.exitAddress, &block);
     }
 
     LinkBlock(block);
@@ -200,6 +264,11 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
     Common::JitRegister::Register(block.normalEntry, block.near_end - block.normalEntry,
                                   "JIT_PPC_{:08x}", block.physicalAddress);
   }
+
+  // Blocks compiled while debugging are split up for single stepping and breakpoints,
+  // so they aren't worth remembering.
+  if (m_persistent_cache_enabled && !m_jit.IsDebuggingEnabled())
+    RecordPersistentBlock(block);
 }
 
 JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, CPUEmuFeatureFlags feature_flags)
@@ -215,12 +284,17 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, CPUEmuFeatureFla
     translated_addr = translated.address;
   }
 
-  auto iter = block_map.equal_range(translated_addr);
-  for (; iter.first != iter.second; iter.first++)
+  const JitBlockBucketTable::Bucket* bucket = block_range_map.Find(translated_addr);
+  if (!bucket)
+    return nullptr;
+
+  for (JitBlock* b : *bucket)
   {
-    JitBlock& b = iter.first->second;
-    if (b.effectiveAddress == addr && b.feature_flags == feature_flags)
-      return &b;
+    if (b->physicalAddress == translated_addr && b->effectiveAddress == addr &&
+        b->feature_flags == feature_flags)
+    {
+      return b;
+    }
   }
 
   return nullptr;
@@ -348,67 +422,54 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
-  // Iterate over all macro blocks which overlap the given range.
-  auto start = block_range_map.lower_bound(address & BLOCK_RANGE_MAP_MASK);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
-  {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
-    {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
-      {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & BLOCK_RANGE_MAP_MASK) != start->first)
-            block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
+  // Iterate over all buckets which overlap the given range.
+  block_range_map.ForEachBucketInRange(
+      address, length, [&](JitBlockBucketTable::Bucket& bucket) {
+        // Iterate over all blocks in the bucket. Removing a block from its buckets swaps the last
+        // element of this bucket into the current position, so only advance if nothing was erased.
+        std::size_t i = 0;
+        while (i < bucket.size())
         {
-          if (&block_map_iter.first->second == block)
+          JitBlock* block = bucket[i];
+          if (block->OverlapsPhysicalRange(address, length))
+          {
+            RemoveBlockFromRangeMap(*block);
+            DestroyBlock(*block);
+            FreeBlock(*block);
+          }
+          else
           {
-            block_map.erase(block_map_iter.first);
-            break;
+            ++i;
           }
-          block_map_iter.first++;
         }
-        iter = start->second.erase(iter);
-      }
-      else
-      {
-        iter++;
-      }
-    }
-
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
-  }
+      });
 }
 
 void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
 {
-  const auto equal_range = block_map.equal_range(block.physicalAddress);
-  const auto block_map_iter = std::ranges::find(equal_range.first, equal_range.second, &block,
-                                                [](const auto& kv) { return &kv.second; });
-  if (block_map_iter == equal_range.second) [[unlikely]]
+  const JitBlockBucketTable::Bucket* bucket = block_range_map.Find(block.physicalAddress);
+  if (!bucket || std::ranges::find(*bucket, &block) == bucket->end()) [[unlikely]]
     return;
 
-  JitBlock& mutable_block = block_map_iter->second;
+  JitBlock& mutable_block = const_cast<JitBlock&>(block);
+  RemoveBlockFromRangeMap(mutable_block);
+  DestroyBlock(mutable_block);
+  FreeBlock(mutable_block);  // The original JitBlock reference is now dangling.
+}
 
-  for (const u32 addr : mutable_block.physical_addresses)
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(&mutable_block);
+void JitBaseBlockCache::RemoveBlockFromRangeMap(JitBlock& block)
+{
+  for (const u32 addr : block.physical_addresses)
+    block_range_map.Erase(addr, &block);
+}
 
-  DestroyBlock(mutable_block);
-  block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
+void JitBaseBlockCache::FreeBlock(JitBlock& block)
+{
+  // Every JitBlock is allocated as part of a BlockSlot.
+  BlockSlot& slot = static_cast<BlockSlot&>(block);
+  slot.in_use = false;
+  m_free_block_slots.push_back(&slot);
+  --m_block_count;
 }
 
 u32* JitBaseBlockCache::GetBlockBitSet() const
@@ -416,6 +477,74 @@ u32* JitBaseBlockCache::GetBlockBitSet() const
   return valid_block.m_valid_block.get();
 }
 
+std::vector<u32> JitBaseBlockCache::GetPrewarmAddresses(u32 em_address)
+{
+  std::vector<u32> addresses;
+  if (!m_persistent_cache_enabled)
+    return addresses;
+
+  SyncPersistentCacheGame();
+  if (!m_persistent_cache.HasPending())
+    return addresses;
+
+  const auto translated = m_jit.m_mmu.JitCache_TranslateAddress(em_address);
+  if (!translated.valid)
+    return addresses;
+
+  auto& memory = m_jit.m_system.GetMemory();
+  const CPUEmuFeatureFlags feature_flags = m_jit.m_ppc_state.feature_flags;
+  for (JitPersistentCache::Entry& entry : m_persistent_cache.TakePending(translated.address))
+  {
+    // Blocks for a different MSR state can only be compiled once the game switches to it.
+    if (entry.feature_flags != feature_flags)
+    {
+      m_persistent_cache.Defer(std::move(entry), false);
+      continue;
+    }
+
+    // Already compiled, and thereby already recorded for the next session.
+    if (GetBlockFromStartAddress(entry.effective_address, feature_flags))
+      continue;
+
+    // The code might not have been loaded yet, or the game might have loaded a different overlay
+    // to the same address.
+    const auto entry_translated = m_jit.m_mmu.JitCache_TranslateAddress(entry.effective_address);
+    if (!entry_translated.valid || entry_translated.address != entry.physical_address ||
+        JitPersistentCache::HashRanges(memory, entry.ranges) != entry.code_hash)
+    {
+      m_persistent_cache.Defer(std::move(entry), true);
+      continue;
+    }
+
+    addresses.push_back(entry.effective_address);
+  }
+
+  return addresses;
+}
+
+void JitBaseBlockCache::SyncPersistentCacheGame()
+{
+  m_persistent_cache.SwitchGame(SConfig::GetInstance().GetGameID(), m_jit.m_system.GetMemory());
+}
+
+void JitBaseBlockCache::RecordPersistentBlock(const JitBlock& block)
+{
+  SyncPersistentCacheGame();
+
+  JitPersistentCache::Entry entry;
+  entry.ranges = JitPersistentCache::MakeRanges(block.physical_addresses);
+  const std::optional<u32> code_hash =
+      JitPersistentCache::HashRanges(m_jit.m_system.GetMemory(), entry.ranges);
+  if (!code_hash)
+    return;
+
+  entry.effective_address = block.effectiveAddress;
+  entry.physical_address = block.physicalAddress;
+  entry.feature_flags = block.feature_flags;
+  entry.code_hash = *code_hash;
+  m_persistent_cache.Record(std::move(entry));
+}
+
 void JitBaseBlockCache::WriteDestroyBlock(const JitBlock& block)
 {
 }
@@ -445,17 +574,49 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
   LinkBlockExits(block);
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
+  const JitBlockBucketTable::Bucket* bucket = links_to.Find(block.effectiveAddress);
+  if (!bucket)
     return;
 
-  for (JitBlock* b2 : it->second)
+  // The bucket also contains blocks linking to nearby addresses, but LinkBlockExits only links
+  // the exits that point to an existing block, so there is no need to filter them here.
+  for (JitBlock* b2 : *bucket)
   {
     if (block.feature_flags == b2->feature_flags)
       LinkBlockExits(*b2);
   }
 }
 
+void JitBaseBlockCache::RetargetIndirectExitFromJIT(JitBaseBlockCache& block_cache,
+                                                    JitBlock* block, u32 link_index)
+{
+  block_cache.RetargetIndirectExit(*block, link_index, block_cache.m_jit.m_ppc_state.pc);
+}
+
+void JitBaseBlockCache::RetargetIndirectExit(JitBlock& block, u32 link_index, u32 address)
+{
+  if (link_index >= block.linkData.size())
+    return;
+
+  JitBlock::LinkData& e = block.linkData[link_index];
+  if (!e.indirectCheck || e.indirectRetargets >= MAX_INDIRECT_EXIT_RETARGETS)
+    return;
+
+  // The block may have been destroyed while it was running, e.g. by invalidating its own code.
+  if (GetBlockFromStartAddress(block.effectiveAddress, block.feature_flags) != &block)
+    return;
+
+  e.indirectRetargets++;
+
+  links_to.Erase(e.exitAddress, &block);
+  e.exitAddress = address;
+  links_to.Insert(address, &block);
+
+  JitBlock* destination_block = GetBlockFromStartAddress(address, block.feature_flags);
+  WriteLinkBlock(e, destination_block);
+  e.linkStatus = destination_block != nullptr;
+}
+
 void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
 {
   // Unlink all exits of this block.
@@ -465,10 +626,10 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 
   // Unlink all exits of other blocks which points to this block
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
+  const JitBlockBucketTable::Bucket* bucket = links_to.Find(block.effectiveAddress);
+  if (!bucket)
     return;
-  for (JitBlock* sourceBlock : it->second)
+  for (JitBlock* sourceBlock : *bucket)
   {
     if (sourceBlock->feature_flags != block.feature_flags)
       continue;
@@ -505,14 +666,7 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
 
   // Delete linking addresses
   for (const auto& e : block.linkData)
-  {
-    auto it = links_to.find(e.exitAddress);
-    if (it == links_to.end())
-      continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
-  }
+    links_to.Erase(e.exitAddress, &block);
 
   // Raise an signal if we are going to call this block again
   WriteDestroyBlock(block);
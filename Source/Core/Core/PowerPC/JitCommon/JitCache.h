@@ -7,18 +7,17 @@
 #include <bitset>
 #include <chrono>
 #include <cstring>
+#include <deque>
 #include <functional>
-#include <map>
 #include <memory>
 #include <set>
 #include <type_traits>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitPersistentCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 class JitBase;
@@ -97,6 +96,11 @@ struct JitBlock : public JitBlockData
     u32 exitAddress;
     bool linkStatus;  // is it already linked?
     bool call;
+    // For indirect exits, the immediate that the branch target is compared against before the
+    // link is followed. It always holds exitAddress. nullptr for exits with a fixed destination.
+    u8* indirectCheck = nullptr;
+    // How often the indirect exit has been pointed at a different target.
+    u8 indirectRetargets = 0;
   };
   std::vector<LinkData> linkData;
 
@@ -108,6 +112,10 @@ struct JitBlock : public JitBlockData
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
 
   std::unique_ptr<ProfileData> profile_data;
+
+  // Number of timing slices that ended right before this block. Used to find the blocks that are
+  // worth recompiling with more expensive optimizations.
+  u32 hot_samples = 0;
 };
 
 typedef void (*CompiledCode)();
@@ -142,6 +150,64 @@ public:
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
 };
 
+// Lists of blocks for every 0x100 byte bucket of the 32-bit address space. The second level
+// tables are only allocated for regions of the address space that actually contain code, so
+// lookups never allocate and never touch node-based containers.
+class JitBlockBucketTable final
+{
+public:
+  static constexpr u32 BUCKET_SHIFT = 8;
+  static constexpr u32 REGION_SHIFT = 20;
+  static constexpr u32 BUCKETS_PER_REGION = 1u << (REGION_SHIFT - BUCKET_SHIFT);
+  static constexpr u32 NUM_REGIONS = 1u << (32 - REGION_SHIFT);
+
+  using Bucket = std::vector<JitBlock*>;
+
+  // Returns nullptr if no block was ever added to the bucket's region.
+  Bucket* Find(u32 address) const
+  {
+    Region* region = m_regions[address >> REGION_SHIFT].get();
+    return region ? &(*region)[(address >> BUCKET_SHIFT) % BUCKETS_PER_REGION] : nullptr;
+  }
+
+  void Insert(u32 address, JitBlock* block);
+  void Erase(u32 address, const JitBlock* block);
+  void Clear();
+
+  // Calls f for every bucket that overlaps [address, address + length). Empty regions are skipped
+  // quickly, which keeps invalidating huge ranges cheap.
+  template <typename F>
+  void ForEachBucketInRange(u32 address, u32 length, F f) const
+  {
+    if (length == 0)
+      return;
+
+    const u64 end = static_cast<u64>(address) + length;
+    u64 bucket_address = address & ~((1u << BUCKET_SHIFT) - 1);
+    while (bucket_address < end)
+    {
+      const u32 region_index = static_cast<u32>(bucket_address >> REGION_SHIFT);
+      const u64 region_end = static_cast<u64>(region_index + 1) << REGION_SHIFT;
+      if (Region* region = m_regions[region_index].get())
+      {
+        for (; bucket_address < end && bucket_address < region_end;
+             bucket_address += 1u << BUCKET_SHIFT)
+        {
+          f((*region)[(bucket_address >> BUCKET_SHIFT) % BUCKETS_PER_REGION]);
+        }
+      }
+      else
+      {
+        bucket_address = region_end;
+      }
+    }
+  }
+
+private:
+  using Region = std::array<Bucket, BUCKETS_PER_REGION>;
+  std::array<std::unique_ptr<Region>, NUM_REGIONS> m_regions;
+};
+
 class JitBaseBlockCache
 {
 public:
@@ -164,7 +230,7 @@ public:
   JitBlock** GetFastBlockMapFallback();
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
-  std::size_t GetBlockCount() const { return block_map.size(); }
+  std::size_t GetBlockCount() const { return m_block_count; }
 
   JitBlock* AllocateBlock(u32 em_address);
   void FinalizeBlock(JitBlock& block, bool block_link, const PPCAnalyst::CodeBlock& code_block,
@@ -181,6 +247,17 @@ public:
   // assembly version.)
   const u8* Dispatch();
 
+  // Called by indirect exits whose target didn't match the cached one. Points the exit at the
+  // current PC and links it if a block exists there.
+  static void RetargetIndirectExitFromJIT(JitBaseBlockCache& block_cache, JitBlock* block,
+                                          u32 link_index);
+
+  // Indirect exits which keep missing stop being retargeted and always go to the dispatcher.
+  static constexpr u8 MAX_INDIRECT_EXIT_RETARGETS = 8;
+
+  // Never matches a branch target, since those are always aligned.
+  static constexpr u32 INVALID_INDIRECT_EXIT_ADDRESS = 0x7FFFFFFF;
+
   void InvalidateICache(u32 address, u32 length, bool forced);
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
@@ -188,6 +265,11 @@ public:
 
   u32* GetBlockBitSet() const;
 
+  // Returns the effective addresses of blocks that were compiled in a previous session, are close
+  // to the given address and still match the contents of memory. They are removed from the
+  // persistent cache's pending list, so the caller is expected to compile them right away.
+  std::vector<u32> GetPrewarmAddresses(u32 em_address);
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -200,26 +282,40 @@ private:
   void LinkBlockExits(JitBlock& block);
   void LinkBlock(JitBlock& block);
   void UnlinkBlock(const JitBlock& block);
+  void RetargetIndirectExit(JitBlock& block, u32 link_index, u32 address);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
 
+  void RemoveBlockFromRangeMap(JitBlock& block);
+  void FreeBlock(JitBlock& block);
+
+  void SyncPersistentCacheGame();
+  void RecordPersistentBlock(const JitBlock& block);
+
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address, u32 msr);
 
-  // links_to hold all exit points of all valid blocks in a reverse way.
-  // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  // Storage for all blocks. Blocks are allocated in chunks, never move, and the slots of
+  // destroyed blocks are reused through the free list.
+  struct BlockSlot : JitBlock
+  {
+    explicit BlockSlot(bool profiling_enabled) : JitBlock(profiling_enabled) {}
+
+    bool in_use = true;
+  };
+  std::deque<BlockSlot> m_block_pool;
+  std::vector<BlockSlot*> m_free_block_slots;
+  std::size_t m_block_count = 0;
 
-  // Map indexed by the physical address of the entry point.
-  // This is used to query the block based on the current PC in a slow way.
-  std::multimap<u32, JitBlock> block_map;  // start_addr -> block
+  // links_to holds all exit points of all valid blocks in a reverse way, bucketed by the
+  // effective address of the exit. It is used to query all blocks which link to an address.
+  JitBlockBucketTable links_to;
 
-  // Range of overlapping code indexed by a masked physical address.
-  // This is used for invalidation of memory regions. The range is grouped
-  // in macro blocks of each 0x100 bytes.
-  static constexpr u32 BLOCK_RANGE_MAP_MASK = ~(0x100 - 1);
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  // All blocks overlapping each 0x100 byte bucket of physical memory. This is used both for
+  // invalidation of memory regions and to query the block based on the current PC in a slow way
+  // (every block is also in the bucket of its entry point).
+  JitBlockBucketTable block_range_map;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
@@ -235,4 +331,9 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  // Blocks compiled in this and previous sessions of the running game.
+  // Only used if Config::MAIN_JIT_PERSISTENT_CACHE is enabled.
+  bool m_persistent_cache_enabled = false;
+  JitPersistentCache m_persistent_cache;
 };
@@ -0,0 +1,264 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitPersistentCache.h"
+
+#include <algorithm>
+#include <span>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Version.h"
+#include "Core/HW/Memmap.h"
+
+namespace
+{
+constexpr u32 CACHE_FILE_MAGIC = 0x4A424331;  // "JBC1"
+constexpr u32 CACHE_FILE_VERSION = 1;
+
+struct CacheFileHeader
+{
+  u32 magic;
+  u32 version;
+  u32 revision_hash;
+  u32 ram_size;
+  u32 exram_size;
+  u32 num_entries;
+};
+
+struct CacheFileEntry
+{
+  u32 effective_address;
+  u32 physical_address;
+  u32 feature_flags;
+  u32 code_hash;
+  u32 num_ranges;
+};
+
+u32 GetRevisionHash()
+{
+  return Common::ComputeCRC32(Common::GetScmRevGitStr());
+}
+
+std::span<const u8> GetPhysicalSpan(Memory::MemoryManager& memory, u32 address, u32 size)
+{
+  // Avoid MemoryManager::GetSpanForAddress here, since it raises a panic alert for addresses
+  // outside of RAM, and the cache file might be stale.
+  const u32 masked = address & 0x3FFFFFFF;
+  if (masked < memory.GetRamSizeReal())
+  {
+    if (memory.GetRamSizeReal() - masked < size)
+      return {};
+    return std::span(memory.GetRAM() + masked, size);
+  }
+
+  const u32 exram_offset = masked & 0x0FFFFFFF;
+  if (memory.GetEXRAM() && (masked >> 28) == 0x1 && exram_offset < memory.GetExRamSizeReal())
+  {
+    if (memory.GetExRamSizeReal() - exram_offset < size)
+      return {};
+    return std::span(memory.GetEXRAM() + exram_offset, size);
+  }
+
+  return {};
+}
+}  // namespace
+
+std::string JitPersistentCache::GetCachePath(std::string_view game_id)
+{
+  return fmt::format("{}{}.jitblocks", File::GetUserPath(D_CACHE_IDX), game_id);
+}
+
+JitPersistentCache::PhysicalRanges
+JitPersistentCache::MakeRanges(const std::set<u32>& physical_addresses)
+{
+  PhysicalRanges ranges;
+  for (const u32 address : physical_addresses)
+  {
+    if (!ranges.empty() && ranges.back().address + ranges.back().num_instructions * 4 == address)
+      ++ranges.back().num_instructions;
+    else
+      ranges.push_back({address, 1});
+  }
+  return ranges;
+}
+
+std::optional<u32> JitPersistentCache::HashRanges(Memory::MemoryManager& memory,
+                                                  const PhysicalRanges& ranges)
+{
+  u32 crc = Common::StartCRC32();
+  for (const PhysicalRange& range : ranges)
+  {
+    const std::span<const u8> span =
+        GetPhysicalSpan(memory, range.address, range.num_instructions * 4);
+    if (span.empty())
+      return std::nullopt;
+    crc = Common::UpdateCRC32(crc, span.data(), span.size());
+  }
+  return crc;
+}
+
+bool JitPersistentCache::SwitchGame(std::string_view game_id, Memory::MemoryManager& memory)
+{
+  if (game_id == m_game_id && m_ram_size == memory.GetRamSizeReal() &&
+      m_exram_size == memory.GetExRamSizeReal())
+  {
+    return false;
+  }
+
+  Save();
+  Clear();
+
+  m_game_id = game_id;
+  m_ram_size = memory.GetRamSizeReal();
+  m_exram_size = memory.GetExRamSizeReal();
+  Load();
+  return true;
+}
+
+void JitPersistentCache::Load()
+{
+  if (m_game_id.empty())
+    return;
+
+  const std::string path = GetCachePath(m_game_id);
+  File::IOFile file(path, "rb");
+  if (!file)
+    return;
+
+  CacheFileHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != CACHE_FILE_MAGIC ||
+      header.version != CACHE_FILE_VERSION)
+  {
+    WARN_LOG_FMT(DYNA_REC, "Ignoring invalid JIT block cache file {}", path);
+    return;
+  }
+
+  // Instruction selection differs between revisions, and RAM size overrides change which
+  // physical addresses are valid, so only reuse entries from an identical setup.
+  if (header.revision_hash != GetRevisionHash() || header.ram_size != m_ram_size ||
+      header.exram_size != m_exram_size)
+  {
+    INFO_LOG_FMT(DYNA_REC, "Ignoring JIT block cache file {} from a different build or setup",
+                 path);
+    return;
+  }
+
+  for (u32 i = 0; i < header.num_entries && m_pending.size() < MAX_ENTRIES; ++i)
+  {
+    CacheFileEntry file_entry;
+    if (!file.ReadArray(&file_entry, 1))
+      break;
+
+    Entry entry;
+    entry.effective_address = file_entry.effective_address;
+    entry.physical_address = file_entry.physical_address;
+    entry.feature_flags = file_entry.feature_flags;
+    entry.code_hash = file_entry.code_hash;
+    entry.ranges.resize(file_entry.num_ranges);
+    if (!file.ReadArray(entry.ranges.data(), entry.ranges.size()))
+      break;
+
+    m_pending.emplace(entry.physical_address, std::move(entry));
+  }
+
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} blocks from JIT block cache file {}", m_pending.size(), path);
+}
+
+void JitPersistentCache::Save() const
+{
+  if (m_game_id.empty() || (m_recorded.empty() && m_pending.empty()))
+    return;
+
+  // Blocks that weren't reached in this session are kept, so that playing through a different
+  // part of the game doesn't throw away everything that was learned previously.
+  std::map<u64, const Entry*> entries;
+  for (const auto& [key, entry] : m_recorded)
+    entries.emplace(key, &entry);
+  for (const auto& [physical_address, entry] : m_pending)
+  {
+    if (entries.size() >= MAX_ENTRIES)
+      break;
+    entries.emplace(Key(entry), &entry);
+  }
+
+  const std::string path = GetCachePath(m_game_id);
+  File::CreateFullPath(path);
+  File::IOFile file(path, "wb");
+  if (!file)
+  {
+    WARN_LOG_FMT(DYNA_REC, "Failed to open JIT block cache file {} for writing", path);
+    return;
+  }
+
+  const u32 num_entries = static_cast<u32>(std::min(entries.size(), MAX_ENTRIES));
+  const CacheFileHeader header{CACHE_FILE_MAGIC, CACHE_FILE_VERSION, GetRevisionHash(),
+                               m_ram_size,       m_exram_size,       num_entries};
+  bool success = file.WriteArray(&header, 1);
+
+  u32 written = 0;
+  for (auto it = entries.begin(); success && written < num_entries; ++it, ++written)
+  {
+    const Entry& entry = *it->second;
+    const CacheFileEntry file_entry{entry.effective_address, entry.physical_address,
+                                    entry.feature_flags, entry.code_hash,
+                                    static_cast<u32>(entry.ranges.size())};
+    success = file.WriteArray(&file_entry, 1) &&
+              file.WriteArray(entry.ranges.data(), entry.ranges.size());
+  }
+
+  if (!success)
+    WARN_LOG_FMT(DYNA_REC, "Failed to write JIT block cache file {}", path);
+}
+
+void JitPersistentCache::Clear()
+{
+  m_game_id.clear();
+  m_ram_size = 0;
+  m_exram_size = 0;
+  m_recorded.clear();
+  m_pending.clear();
+}
+
+void JitPersistentCache::Record(Entry entry)
+{
+  if (m_game_id.empty())
+    return;
+
+  const u64 key = Key(entry);
+  if (m_recorded.size() >= MAX_ENTRIES && !m_recorded.contains(key))
+    return;
+
+  entry.failed_validations = 0;
+  m_recorded.insert_or_assign(key, std::move(entry));
+}
+
+std::vector<JitPersistentCache::Entry> JitPersistentCache::TakePending(u32 physical_address)
+{
+  const u32 region_start = physical_address & ~(PREWARM_REGION_SIZE - 1);
+  const auto begin = m_pending.lower_bound(region_start);
+  const auto end = region_start + PREWARM_REGION_SIZE == 0 ?
+                       m_pending.end() :
+                       m_pending.lower_bound(region_start + PREWARM_REGION_SIZE);
+
+  std::vector<Entry> result;
+  for (auto it = begin; it != end; ++it)
+    result.push_back(std::move(it->second));
+  m_pending.erase(begin, end);
+  return result;
+}
+
+void JitPersistentCache::Defer(Entry entry, bool failed_validation)
+{
+  if (failed_validation && ++entry.failed_validations >= MAX_FAILED_VALIDATIONS)
+    return;
+
+  m_pending.emplace(entry.physical_address, std::move(entry));
+}
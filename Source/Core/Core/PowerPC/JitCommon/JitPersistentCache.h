@@ -0,0 +1,106 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Memory
+{
+class MemoryManager;
+}
+
+// Remembers which blocks a game compiled in previous sessions so that they can be compiled ahead
+// of time the next time the game is run.
+//
+// Emitted host code can't be stored directly since it embeds absolute pointers into the code
+// regions, the PowerPCState and other host structures. Instead, the analyzed block metadata is
+// stored, validated against the current contents of emulated memory, and then recompiled in a
+// batch once the game reaches code close to it. This lets the block linker connect the prewarmed
+// blocks directly, so the game doesn't have to take a trip through the dispatcher and the JIT for
+// every single block in a freshly loaded code region.
+class JitPersistentCache
+{
+public:
+  // A contiguous run of instructions.
+  struct PhysicalRange
+  {
+    u32 address;
+    u32 num_instructions;
+  };
+  using PhysicalRanges = std::vector<PhysicalRange>;
+
+  struct Entry
+  {
+    u32 effective_address = 0;
+    u32 physical_address = 0;
+    u32 feature_flags = 0;
+    u32 code_hash = 0;
+    PhysicalRanges ranges;
+
+    // Not serialized. Number of times the entry has failed validation in this session.
+    u32 failed_validations = 0;
+  };
+
+  // Limits the size of the cache file for games that use a lot of self-modifying code.
+  static constexpr size_t MAX_ENTRIES = 0x20000;
+
+  // Entries within this many bytes of a missing block are prewarmed together.
+  static constexpr u32 PREWARM_REGION_SIZE = 0x10000;
+
+  // Entries that still don't match the contents of memory after this many attempts are dropped.
+  static constexpr u32 MAX_FAILED_VALIDATIONS = 4;
+
+  static std::string GetCachePath(std::string_view game_id);
+
+  static PhysicalRanges MakeRanges(const std::set<u32>& physical_addresses);
+
+  // Returns std::nullopt if any of the ranges is outside of emulated RAM.
+  static std::optional<u32> HashRanges(Memory::MemoryManager& memory,
+                                       const PhysicalRanges& ranges);
+
+  // Switches to the cache file of the given game, saving the current one first.
+  // Returns false if the game is unchanged.
+  bool SwitchGame(std::string_view game_id, Memory::MemoryManager& memory);
+
+  // Writes out all known entries for the current game.
+  void Save() const;
+
+  void Clear();
+
+  void Record(Entry entry);
+
+  // Removes all pending entries within the prewarm region of the given physical address
+  // and returns them.
+  std::vector<Entry> TakePending(u32 physical_address);
+
+  // Returns an entry that couldn't be prewarmed yet to the pending list.
+  void Defer(Entry entry, bool failed_validation);
+
+  bool HasPending() const { return !m_pending.empty(); }
+
+private:
+  static u64 Key(const Entry& entry)
+  {
+    return (static_cast<u64>(entry.feature_flags) << 32) | entry.effective_address;
+  }
+
+  void Load();
+
+  std::string m_game_id;
+  u32 m_ram_size = 0;
+  u32 m_exram_size = 0;
+
+  // Entries compiled during this session.
+  std::map<u64, Entry> m_recorded;
+
+  // Entries loaded from disk that haven't been compiled yet, indexed by physical address.
+  std::multimap<u32, Entry> m_pending;
+};
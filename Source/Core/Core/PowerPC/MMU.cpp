@@ -25,6 +25,7 @@
 
 #include "Core/PowerPC/MMU.h"
 
+#include <algorithm>
 #include <bit>
 #include <cstddef>
 #include <cstring>
@@ -937,6 +938,55 @@ bool MMU::IsOptimizableRAMAddress(const u32 address, const u32 access_size) cons
   return (bat_result_1 & bat_result_2 & BAT_PHYSICAL_BIT) != 0;
 }
 
+u8* MMU::GetOptimizableRAMPointer(const u32 address, const u32 size) const
+{
+  if (size == 0 || u64(address) + size > 0x100000000)
+    return nullptr;
+
+  if (m_power_pc.GetMemChecks().HasAny())
+    return nullptr;
+
+  if (!m_ppc_state.msr.DR)
+    return nullptr;
+
+  if (m_ppc_state.m_enable_dcache)
+    return nullptr;
+
+  const u32 first_page = address & ~(BAT_PAGE_SIZE - 1);
+  const u64 end_address = u64(address) + size;
+  u8* first_page_pointer = nullptr;
+  for (u64 page = first_page; page < end_address; page += BAT_PAGE_SIZE)
+  {
+    const u32 bat_result = m_dbat_table[page >> BAT_INDEX_SHIFT];
+    if ((bat_result & BAT_PHYSICAL_BIT) == 0)
+      return nullptr;
+
+    // The fake VMEM and the locked L1 cache are mapped too, but aren't part of RAM.
+    const u32 physical_address = bat_result & BAT_RESULT_MASK;
+    u8* page_pointer = nullptr;
+    if (physical_address < m_memory.GetRamSizeReal())
+    {
+      page_pointer = m_memory.GetRAM() + physical_address;
+    }
+    else if (m_memory.GetEXRAM() && physical_address >> 28 == 0x1 &&
+             (physical_address & 0x0FFFFFFF) < m_memory.GetExRamSizeReal())
+    {
+      page_pointer = m_memory.GetEXRAM() + (physical_address & m_memory.GetExRamMask());
+    }
+    else
+    {
+      return nullptr;
+    }
+
+    if (page == first_page)
+      first_page_pointer = page_pointer;
+    else if (page_pointer != first_page_pointer + (page - first_page))
+      return nullptr;
+  }
+
+  return first_page_pointer + (address - first_page);
+}
+
 bool MMU::IsPhysicalRAMAddress(const u32 address) const
 {
   const u32 segment = address >> 28;
@@ -1335,6 +1385,87 @@ void MMU::SDRUpdated()
 
   m_ppc_state.pagetable_base = htaborg << 16;
   m_ppc_state.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+
+  ClearSecondaryTLB();
+  UpdatePageTableMappings();
+}
+
+void MMU::SetSecondaryTLBSize(u32 entries)
+{
+  if (entries != 0)
+    entries = std::bit_ceil(std::clamp<u32>(entries, HW_PAGE_INDEX_MASK + 1, 1 << 20));
+
+  if (entries == m_secondary_tlb.size())
+    return;
+
+  m_secondary_tlb.clear();
+  m_secondary_tlb.resize(entries);
+}
+
+void MMU::ClearSecondaryTLB()
+{
+  std::ranges::fill(m_secondary_tlb, SecondaryTLBEntry{});
+}
+
+void MMU::SRUpdated()
+{
+  UpdatePageTableMappings();
+}
+
+// Makes data accesses to a page which was translated through the page table take the fastmem path.
+void MMU::MapPageTableEntry(u32 effective_address, u32 pte2_hex)
+{
+#ifndef _ARCH_32
+  if (!m_memory.IsPageTableMappingSupported())
+    return;
+
+  const UPTE_Hi pte2(pte2_hex);
+
+  // Fast accesses can't set the R and C bits, so only pages which already have both set can be
+  // mapped. Like with BATs, uncached memory and memchecks are left to slow accesses.
+  if (pte2.R == 0 || pte2.C == 0 || (pte2.WIMG & 0b1100) != 0)
+    return;
+
+  // BAT translation takes precedence over the page table
+  const u32 logical_address = effective_address & ~static_cast<u32>(HW_PAGE_MASK);
+  if (m_dbat_table[logical_address >> BAT_INDEX_SHIFT] & BAT_MAPPED_BIT)
+    return;
+
+  const u32 translated_address = pte2.RPN << HW_PAGE_INDEX_SHIFT;
+  if (!IsPhysicalRAMAddress(translated_address))
+    return;
+  if (m_power_pc.GetMemChecks().OverlapsMemcheck(logical_address, HW_PAGE_SIZE))
+    return;
+
+  m_memory.AddPageTableMapping(logical_address, translated_address);
+#endif
+}
+
+// Rebuilds the page table mappings after a change which may have invalidated any of them. The
+// entries still in the data TLB are mapped again right away, and everything else is mapped again
+// the next time it goes through a page table walk.
+void MMU::UpdatePageTableMappings()
+{
+#ifndef _ARCH_32
+  if (!m_memory.IsPageTableMappingSupported())
+    return;
+
+  m_memory.RemovePageTableMappings(0, 0);
+
+  for (const TLBEntry& tlbe : m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX])
+  {
+    for (size_t way = 0; way < PowerPC::TLB_WAYS; ++way)
+    {
+      if (tlbe.tag[way] == TLBEntry::INVALID_TAG)
+        continue;
+
+      const u32 effective_address = tlbe.tag[way] << HW_PAGE_INDEX_SHIFT;
+      const auto sr = UReg_SR{m_ppc_state.sr[EffectiveAddress(effective_address).SR]};
+      if (sr.T == 0 && sr.VSID == tlbe.vsid[way])
+        MapPageTableEntry(effective_address, tlbe.pte[way]);
+    }
+  }
+#endif
 }
 
 enum class TLBLookupResult
@@ -1424,6 +1555,16 @@ void MMU::InvalidateTLBEntry(u32 address)
 
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
+
+  // The secondary TLB is indexed by at least as many bits as the TLB, so every entry of the
+  // congruence class ends up at an index with the same low bits.
+  for (size_t i = entry_index; i < m_secondary_tlb.size(); i += HW_PAGE_INDEX_MASK + 1)
+    m_secondary_tlb[i].tag = SecondaryTLBEntry::INVALID_TAG;
+
+  // tlbie invalidates the whole congruence class, so do the same for the fastmem mappings
+#ifndef _ARCH_32
+  m_memory.RemovePageTableMappings(address, HW_PAGE_INDEX_MASK << HW_PAGE_INDEX_SHIFT);
+#endif
 }
 
 // Page Address Translation
@@ -1460,6 +1601,29 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
   const u32 page_index = address.page_index;  // 16 bit
   const u32 api = address.API;                //  6 bit (part of page_index)
 
+  // Secondary TLB. A write to a page whose C bit isn't set yet still has to go through the page
+  // table so that the bit gets set there.
+  SecondaryTLBEntry* secondary_entry = nullptr;
+  if (!m_secondary_tlb.empty())
+  {
+    const u32 tag = address.Hex >> HW_PAGE_INDEX_SHIFT;
+    secondary_entry = &m_secondary_tlb[tag & (m_secondary_tlb.size() - 1)];
+    const UPTE_Hi pte2(secondary_entry->pte);
+    if (res == TLBLookupResult::NotFound && secondary_entry->tag == tag &&
+        secondary_entry->vsid == VSID && (flag != XCheckTLBFlag::Write || pte2.C != 0))
+    {
+      UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+
+      if constexpr (flag == XCheckTLBFlag::Read || flag == XCheckTLBFlag::Write)
+        MapPageTableEntry(address.Hex, pte2.Hex);
+
+      *wi = (pte2.WIMG & 0b1100) != 0;
+
+      return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
+                                    (pte2.RPN << 12) | offset};
+    }
+  }
+
   // hash function no 1 "xor" .360
   u32 hash = (VSID ^ page_index);
 
@@ -1510,12 +1674,18 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
         if (!IsNoExceptionFlag(flag))
         {
           m_memory.Write_U32(pte2.Hex, pteg_addr + 4);
+
+          if (secondary_entry)
+            *secondary_entry = {address.Hex >> HW_PAGE_INDEX_SHIFT, VSID, pte2.Hex};
         }
 
         // We already updated the TLB entry if this was caused by a C bit.
         if (res != TLBLookupResult::UpdateC)
           UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
 
+        if constexpr (flag == XCheckTLBFlag::Read || flag == XCheckTLBFlag::Write)
+          MapPageTableEntry(address.Hex, pte2.Hex);
+
         *wi = (pte2.WIMG & 0b1100) != 0;
 
         return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
@@ -1576,6 +1746,7 @@ void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
         // BAT_MAPPED_BIT is whether the translation is valid
         // BAT_PHYSICAL_BIT is whether we can use the fastmem arena
         // BAT_WI_BIT is whether either W or I (of WIMG) is set
+        // BAT_MEMCHECK_BIT is whether we could use the fastmem arena if not for a memcheck
         u32 valid_bit = BAT_MAPPED_BIT;
 
         const bool wi = (batl.WIMG & 0b1100) != 0;
@@ -1607,10 +1778,15 @@ void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
           }
         }
 
-        // Fast accesses don't support memchecks, so force slow accesses by removing fastmem
-        // mappings for all overlapping virtual pages.
-        if (m_power_pc.GetMemChecks().OverlapsMemcheck(virtual_address, BAT_PAGE_SIZE))
-          valid_bit &= ~BAT_PHYSICAL_BIT;
+        // Accesses which check the BAT table before being fast don't support memchecks, so force
+        // them to be slow for all overlapping virtual pages. The fastmem arena still maps these
+        // pages, but protects the host pages holding the memchecks so that fastmem accesses to
+        // them fault and get backpatched.
+        if ((valid_bit & BAT_PHYSICAL_BIT) &&
+            m_power_pc.GetMemChecks().OverlapsMemcheck(virtual_address, BAT_PAGE_SIZE))
+        {
+          valid_bit = (valid_bit & ~BAT_PHYSICAL_BIT) | BAT_MEMCHECK_BIT;
+        }
 
         // (BEPI | j) == (BEPI & ~BL) | (j & BL).
         bat_table[virtual_address >> BAT_INDEX_SHIFT] = physical_address | valid_bit;
@@ -1630,7 +1806,7 @@ void MMU::UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
     u32 flags = BAT_MAPPED_BIT | BAT_PHYSICAL_BIT;
 
     if (m_power_pc.GetMemChecks().OverlapsMemcheck(e_address << BAT_INDEX_SHIFT, BAT_PAGE_SIZE))
-      flags &= ~BAT_PHYSICAL_BIT;
+      flags = (flags & ~BAT_PHYSICAL_BIT) | BAT_MEMCHECK_BIT;
 
     bat_table[e_address] = p_address | flags;
   }
@@ -1653,6 +1829,7 @@ void MMU::DBATUpdated()
 #ifndef _ARCH_32
   m_memory.UpdateLogicalMemory(m_dbat_table);
 #endif
+  UpdatePageTableMappings();
 
   // IsOptimizable*Address and dcbz depends on the BAT mapping, so we need a flush here.
   m_system.GetJitInterface().ClearSafe();
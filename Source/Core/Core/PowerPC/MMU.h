@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "Common/BitField.h"
 #include "Common/CommonTypes.h"
@@ -64,7 +65,8 @@ constexpr u32 BAT_PAGE_COUNT = 1 << (32 - BAT_INDEX_SHIFT);
 constexpr u32 BAT_MAPPED_BIT = 0x1;
 constexpr u32 BAT_PHYSICAL_BIT = 0x2;
 constexpr u32 BAT_WI_BIT = 0x4;
-constexpr u32 BAT_RESULT_MASK = UINT32_C(~0x7);
+constexpr u32 BAT_MEMCHECK_BIT = 0x8;
+constexpr u32 BAT_RESULT_MASK = UINT32_C(~0xF);
 using BatTable = std::array<u32, BAT_PAGE_COUNT>;  // 128 KB
 
 constexpr size_t HW_PAGE_SIZE = 4096;
@@ -238,14 +240,25 @@ public:
 
   // TLB functions
   void SDRUpdated();
+  void SRUpdated();
   void InvalidateTLBEntry(u32 address);
   void DBATUpdated();
   void IBATUpdated();
 
+  // The secondary TLB is a larger, direct-mapped cache of page table entries which is checked when
+  // the emulated TLB misses, so that fewer translations have to walk the page table. It isn't
+  // visible to emulated software and isn't part of savestates. A size of 0 disables it.
+  void SetSecondaryTLBSize(u32 entries);
+  void ClearSecondaryTLB();
+
   // Result changes based on the BAT registers and MSR.DR.  Returns whether
   // it's safe to optimize a read or write to this address to an unguarded
   // memory access.  Does not consider page tables.
   bool IsOptimizableRAMAddress(u32 address, u32 access_size) const;
+  // Returns a host pointer to a range of effective addresses if every access to it could be
+  // optimized like above, and the range is in one contiguous block of MEM1 or MEM2. Returns
+  // nullptr otherwise.
+  u8* GetOptimizableRAMPointer(u32 address, u32 size) const;
   u32 IsOptimizableMMIOAccess(u32 address, u32 access_size) const;
   bool IsOptimizableGatherPipeWrite(u32 address) const;
 
@@ -278,6 +291,15 @@ private:
     bool Success() const { return result <= TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED; }
   };
 
+  struct SecondaryTLBEntry
+  {
+    static constexpr u32 INVALID_TAG = 0xffffffff;
+
+    u32 tag = INVALID_TAG;
+    u32 vsid = 0;
+    u32 pte = 0;
+  };
+
   union EffectiveAddress
   {
     BitField<0, 12, u32> offset;
@@ -302,6 +324,9 @@ private:
 
   void Memcheck(u32 address, u64 var, bool write, size_t size);
 
+  void MapPageTableEntry(u32 effective_address, u32 pte2_hex);
+  void UpdatePageTableMappings();
+
   void UpdateBATs(BatTable& bat_table, u32 base_spr);
   void UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr);
 
@@ -327,6 +352,8 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+
+  std::vector<SecondaryTLBEntry> m_secondary_tlb;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
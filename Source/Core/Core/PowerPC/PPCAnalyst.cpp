@@ -41,9 +41,6 @@
 
 namespace PPCAnalyst
 {
-// 0 does not perform block merging
-constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
-
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
 static u32 EvaluateBranchTarget(UGeckoInstruction instr, u32 pc)
@@ -218,6 +215,15 @@ static u32 GetSPRIndex(UGeckoInstruction inst)
   return (inst.SPRU << 5) | (inst.SPRL & 0x1F);
 }
 
+static bool IsTimeBaseRead(UGeckoInstruction inst)
+{
+  // mftb, or mfspr with TBL/TBU
+  if (inst.OPCD != 31 || (inst.SUBOP10 != 371 && inst.SUBOP10 != 339))
+    return false;
+  const u32 index = (inst.SPRU << 5) | (inst.SPRL & 0x1F);
+  return index == SPR_TL || index == SPR_TU;
+}
+
 static bool InstructionCanEndBlock(const CodeOp& op)
 {
   return (op.opinfo->flags & FL_ENDBLOCK) &&
@@ -742,50 +748,52 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
   // Very basic algorithm to detect busy wait loops:
   //   * It loops to itself and does not contain any other branches.
   //   * It does not write to memory.
-  //   * It only reads from registers it wrote to earlier in the loop, or it
-  //     does not write to these registers.
+  //   * It only reads from registers and CR fields it wrote to earlier in the loop, or it
+  //     does not write to these registers. In other words, nothing is carried over from one
+  //     iteration to the next, so every iteration computes the same thing until memory, MMIO
+  //     or the time base changes, all of which only happens when time passes.
   //
   // Would benefit a lot from basic inlining support - a lot of the most
   // used busy loops are DSP register interactions, which are bl/cmp/bne
   // (with the bl target a pure function that follows the above rules). We
   // don't detect these at the moment.
-  std::bitset<32> write_disallowed_regs;
-  std::bitset<32> written_regs;
+  BitSet32 write_disallowed_regs;
+  BitSet32 written_regs;
+  BitSet8 write_disallowed_cr;
+  BitSet8 written_cr;
   for (size_t i = 0; i <= instructions; ++i)
   {
-    if (code[i].opinfo->type == OpType::Branch)
+    const CodeOp& op = code[i];
+
+    const OpType type = op.opinfo->type;
+    if (type == OpType::Branch)
     {
-      if (code[i].branchUsesCtr)
+      if (op.branchUsesCtr)
         return false;
-      if (code[i].branchTo == block->m_address && i == instructions)
-        return true;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+    else if (type != OpType::Integer && type != OpType::Load && type != OpType::CR &&
+             !IsTimeBaseRead(op.inst) &&
+             !(op.inst.OPCD == 19 && op.inst.SUBOP10 == 0) &&  // mcrf
+             !(op.inst.OPCD == 31 && op.inst.SUBOP10 == 19))   // mfcr
     {
       // In the future, some subsets of other instruction types might get
       // supported. Right now, only try loops that have this very
       // restricted instruction set.
       return false;
     }
-    else
-    {
-      for (int reg : code[i].regsIn)
-      {
-        if (reg == -1)
-          continue;
-        if (written_regs[reg])
-          continue;
-        write_disallowed_regs[reg] = true;
-      }
-      for (int reg : code[i].regsOut)
-      {
-        if (reg == -1)
-          continue;
-        if (write_disallowed_regs[reg])
-          return false;
-        written_regs[reg] = true;
-      }
-    }
+
+    write_disallowed_regs |= op.regsIn & ~written_regs;
+    if (op.regsOut & write_disallowed_regs)
+      return false;
+    written_regs |= op.regsOut;
+
+    write_disallowed_cr |= op.crIn & ~written_cr;
+    if (op.crOut & write_disallowed_cr)
+      return false;
+    written_cr |= op.crOut;
+
+    if (type == OpType::Branch && op.branchTo == block->m_address && i == instructions)
+      return true;
   }
   return false;
 }
@@ -860,7 +868,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
     bool conditional_continue = false;
 
-    // TODO: Find the optimal value for BRANCH_FOLLOWING_THRESHOLD.
+    // TODO: Find the optimal value for DEFAULT_BRANCH_FOLLOWING_THRESHOLD.
     //       If it is small, the performance will be down.
     //       If it is big, the size of generated code will be big and
     //       cache clearning will happen many times.
@@ -891,7 +899,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       {
         code[i].branchTo = code[caller].address + 4;
         if ((inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) &&
-            numFollows < BRANCH_FOLLOWING_THRESHOLD)
+            numFollows < m_branch_following_threshold)
         {
           // bclrx with unconditional branch = return
           // Follow it if we can propagate the LR value of the last CALL instruction.
@@ -944,8 +952,13 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
+    if (code[i].branchIsIdleLoop)
+    {
+      DEBUG_LOG_FMT(POWERPC, "Idle loop detected at {:#010x} ({} instructions)", block->m_address,
+                    i + 1);
+    }
 
-    if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (follow && numFollows < m_branch_following_threshold)
     {
       // Follow the unconditional branch.
       numFollows++;
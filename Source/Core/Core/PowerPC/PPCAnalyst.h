@@ -135,6 +135,9 @@ struct CodeBlock
 class PPCAnalyzer
 {
 public:
+  // 0 does not perform block merging
+  static constexpr u32 DEFAULT_BRANCH_FOLLOWING_THRESHOLD = 2;
+
   enum AnalystOption
   {
     // Conditional branch continuing
@@ -179,6 +182,7 @@ public:
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
   void SetDebuggingEnabled(bool enabled) { m_is_debugging_enabled = enabled; }
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
+  void SetBranchFollowingThreshold(u32 threshold) { m_branch_following_threshold = threshold; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
@@ -203,6 +207,7 @@ private:
 
   bool m_is_debugging_enabled = false;
   bool m_enable_branch_following = false;
+  u32 m_branch_following_threshold = DEFAULT_BRANCH_FOLLOWING_THRESHOLD;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
 };
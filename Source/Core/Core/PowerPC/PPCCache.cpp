@@ -19,13 +19,6 @@ namespace PowerPC
 {
 namespace
 {
-constexpr std::array<u32, 8> s_plru_mask{
-    11, 11, 19, 19, 37, 37, 69, 69,
-};
-constexpr std::array<u32, 8> s_plru_value{
-    11, 3, 17, 1, 36, 4, 64, 0,
-};
-
 constexpr std::array<u32, 255> s_way_from_valid = [] {
   std::array<u32, 255> data{};
   for (size_t m = 0; m < data.size(); m++)
@@ -265,7 +258,7 @@ std::pair<u32, u32> Cache::GetCache(Memory::MemoryManager& memory, u32 addr, boo
 
   // update plru
   if (way != 0xff)
-    plru[set] = (plru[set] & ~s_plru_mask[way]) | s_plru_value[way];
+    plru[set] = (plru[set] & ~PLRU_MASK[way]) | PLRU_VALUE[way];
 
   return {set, way};
 }
@@ -31,6 +31,15 @@ constexpr u32 CACHE_BLOCK_SIZE = 8;
 constexpr u32 CACHE_EXRAM_BIT = 0x10000000;
 constexpr u32 CACHE_VMEM_BIT = 0x20000000;
 
+// Accessing a way of a set updates its PLRU bits to (plru & ~PLRU_MASK[way]) | PLRU_VALUE[way].
+// These are also used by the JITs, which update them inline on cache hits.
+inline constexpr std::array<u8, CACHE_WAYS> PLRU_MASK{
+    11, 11, 19, 19, 37, 37, 69, 69,
+};
+inline constexpr std::array<u8, CACHE_WAYS> PLRU_VALUE{
+    11, 3, 17, 1, 36, 4, 64, 0,
+};
+
 struct Cache
 {
   std::array<std::array<std::array<u32, CACHE_BLOCK_SIZE>, CACHE_WAYS>, CACHE_SETS> data{};
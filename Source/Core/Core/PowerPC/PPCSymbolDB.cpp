@@ -48,6 +48,7 @@ const Common::Symbol* PPCSymbolDB::AddFunction(const Core::CPUThreadGuard& guard
     return nullptr;
 
   const auto insert = m_functions.emplace(start_addr, std::move(symbol));
+  InvalidateFunctionIndex();
   Common::Symbol* ptr = &insert.first->second;
   ptr->type = Common::Symbol::Type::Function;
   m_checksum_to_function[ptr->hash].insert(ptr);
@@ -61,6 +62,7 @@ void PPCSymbolDB::AddKnownSymbol(const Core::CPUThreadGuard& guard, u32 startAdd
   std::lock_guard lock(m_mutex);
   AddKnownSymbol(guard, startAddr, size, name, object_name, type, &m_functions,
                  &m_checksum_to_function);
+  InvalidateFunctionIndex();
 }
 
 void PPCSymbolDB::AddKnownSymbol(const Core::CPUThreadGuard& guard, u32 startAddr, u32 size,
@@ -161,26 +163,7 @@ void PPCSymbolDB::DetermineNoteLayers(XNoteMap* notes)
 const Common::Symbol* PPCSymbolDB::GetSymbolFromAddr(u32 addr) const
 {
   std::lock_guard lock(m_mutex);
-  if (m_functions.empty())
-    return nullptr;
-
-  auto it = m_functions.lower_bound(addr);
-
-  if (it != m_functions.end())
-  {
-    // If the address is exactly the start address of a symbol, we're done.
-    if (it->second.address == addr)
-      return &it->second;
-  }
-  if (it != m_functions.begin())
-  {
-    // Otherwise, check whether the address is within the bounds of a symbol.
-    --it;
-    if (addr >= it->second.address && addr < it->second.address + it->second.size)
-      return &it->second;
-  }
-
-  return nullptr;
+  return LookUpFunction(addr);
 }
 
 const Common::Note* PPCSymbolDB::GetNoteFromAddr(u32 addr) const
@@ -218,6 +201,7 @@ void PPCSymbolDB::DeleteFunction(u32 start_address)
 {
   std::lock_guard lock(m_mutex);
   m_functions.erase(start_address);
+  InvalidateFunctionIndex();
 }
 
 void PPCSymbolDB::DeleteNote(u32 start_address)
@@ -630,6 +614,7 @@ bool PPCSymbolDB::LoadMap(const Core::CPUThreadGuard& guard, std::string filenam
 
   std::lock_guard lock(m_mutex);
   std::swap(m_functions, new_functions);
+  InvalidateFunctionIndex();
   std::swap(m_notes, new_notes);
   std::swap(m_checksum_to_function, checksum_to_function);
   std::swap(m_map_name, filename);
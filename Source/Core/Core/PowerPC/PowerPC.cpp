@@ -117,6 +117,7 @@ void PowerPCManager::DoState(PointerWrap& p)
     RecalculateAllFeatureFlags(m_ppc_state);
 
     auto& mmu = m_system.GetMMU();
+    mmu.ClearSecondaryTLB();
     mmu.IBATUpdated();
     mmu.DBATUpdated();
   }
@@ -248,6 +249,7 @@ void PowerPCManager::RefreshConfig()
   const bool old_enable_dcache = m_ppc_state.m_enable_dcache;
 
   m_ppc_state.m_enable_dcache = Config::Get(Config::MAIN_ACCURATE_CPU_CACHE);
+  m_system.GetMMU().SetSecondaryTLBSize(Config::Get(Config::MAIN_SECONDARY_TLB_SIZE));
 
   if (old_enable_dcache && !m_ppc_state.m_enable_dcache)
   {
@@ -280,6 +282,7 @@ void PowerPCManager::Reset()
   m_ppc_state.pagetable_base = 0;
   m_ppc_state.pagetable_hashmask = 0;
   m_ppc_state.tlb = {};
+  m_system.GetMMU().ClearSecondaryTLB();
 
   ResetRegisters();
   m_ppc_state.iCache.Reset(m_system.GetJitInterface());
@@ -15,6 +15,7 @@
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Debugger/BranchWatch.h"
 #include "Core/Debugger/FunctionWatch.h"
+#include "Core/Debugger/SamplingProfiler.h"
 #include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/PowerPC/BreakPoints.h"
 #include "Core/PowerPC/ConditionRegister.h"
@@ -305,6 +306,8 @@ public:
   const Core::BranchWatch& GetBranchWatch() const { return m_branch_watch; }
   Core::FunctionWatch& GetFunctionWatch() { return m_function_watch; }
   const Core::FunctionWatch& GetFunctionWatch() const { return m_function_watch; }
+  Core::SamplingProfiler& GetSamplingProfiler() { return m_sampling_profiler; }
+  const Core::SamplingProfiler& GetSamplingProfiler() const { return m_sampling_profiler; }
 
 private:
   void InitializeCPUCore(CPUCore cpu_core);
@@ -324,6 +327,7 @@ private:
   PPCDebugInterface m_debug_interface;
   Core::BranchWatch m_branch_watch;
   Core::FunctionWatch m_function_watch;
+  Core::SamplingProfiler m_sampling_profiler;
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
 
@@ -0,0 +1,200 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RewindBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+namespace State
+{
+namespace
+{
+constexpr std::array<u64, 256> GenerateGearTable()
+{
+  // splitmix64, so the table is fixed without having to spell out 256 random constants
+  std::array<u64, 256> table{};
+  u64 state = 0x9E3779B97F4A7C15;
+  for (u64& entry : table)
+  {
+    state += 0x9E3779B97F4A7C15;
+    u64 z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+    entry = z ^ (z >> 31);
+  }
+  return table;
+}
+
+constexpr std::array<u64, 256> GEAR_TABLE = GenerateGearTable();
+
+// A chunk boundary is placed where the top 13 bits of the rolling hash are zero, which gives an
+// average chunk size of 8 KiB on top of the minimum size. Using the top bits means that the
+// boundaries depend on the last 64 bytes rather than only the last few.
+constexpr u64 CHUNK_BOUNDARY_MASK = ~u64{0} << (64 - 13);
+}  // namespace
+
+RewindBuffer::RewindBuffer(size_t memory_budget) : m_memory_budget(memory_budget)
+{
+}
+
+size_t RewindBuffer::FindChunkEnd(std::span<const u8> data)
+{
+  if (data.size() <= MIN_CHUNK_SIZE)
+    return data.size();
+
+  const size_t limit = std::min(data.size(), MAX_CHUNK_SIZE);
+
+  // Gear hash, a rolling hash over the last 64 bytes. The first bytes of the chunk are skipped,
+  // since a boundary can't be placed there anyway.
+  u64 hash = 0;
+  for (size_t i = MIN_CHUNK_SIZE; i < limit; ++i)
+  {
+    hash = (hash << 1) + GEAR_TABLE[data[i]];
+    if ((hash & CHUNK_BOUNDARY_MASK) == 0)
+      return i + 1;
+  }
+
+  return limit;
+}
+
+u32 RewindBuffer::AddChunk(std::span<const u8> data)
+{
+  const u64 hash = Common::GetHash64(data.data(), static_cast<u32>(data.size()), 0);
+
+  if (const auto it = m_chunk_index.find(hash); it != m_chunk_index.end())
+  {
+    Chunk& chunk = m_chunks[it->second];
+    if (std::ranges::equal(chunk.data, data))
+    {
+      ++chunk.ref_count;
+      return it->second;
+    }
+  }
+
+  u32 id;
+  if (!m_free_chunks.empty())
+  {
+    id = m_free_chunks.back();
+    m_free_chunks.pop_back();
+  }
+  else
+  {
+    id = static_cast<u32>(m_chunks.size());
+    m_chunks.emplace_back();
+  }
+
+  Chunk& chunk = m_chunks[id];
+  chunk.data.assign(data.begin(), data.end());
+  chunk.hash = hash;
+  chunk.ref_count = 1;
+
+  // On a hash collision, the new chunk is stored but can't be shared
+  chunk.indexed = m_chunk_index.try_emplace(hash, id).second;
+
+  m_memory_usage += chunk.data.size();
+  return id;
+}
+
+void RewindBuffer::ReleaseChunk(u32 id)
+{
+  Chunk& chunk = m_chunks[id];
+  if (--chunk.ref_count != 0)
+    return;
+
+  if (chunk.indexed)
+    m_chunk_index.erase(chunk.hash);
+
+  m_memory_usage -= chunk.data.size();
+  chunk.data = {};
+  chunk.indexed = false;
+  m_free_chunks.push_back(id);
+}
+
+void RewindBuffer::Push(std::span<const u8> state)
+{
+  Snapshot snapshot;
+  snapshot.size = state.size();
+
+  size_t offset = 0;
+  while (offset < state.size())
+  {
+    const size_t length = FindChunkEnd(state.subspan(offset));
+    snapshot.chunks.push_back(AddChunk(state.subspan(offset, length)));
+    offset += length;
+  }
+
+  m_memory_usage += snapshot.chunks.size() * sizeof(u32);
+  m_snapshots.push_back(std::move(snapshot));
+
+  EnforceMemoryBudget();
+}
+
+bool RewindBuffer::Get(size_t index, Common::UniqueBuffer<u8>& state) const
+{
+  if (index >= m_snapshots.size())
+    return false;
+
+  const Snapshot& snapshot = m_snapshots[index];
+  if (state.size() < snapshot.size)
+    state.reset(snapshot.size);
+
+  u8* out = state.data();
+  for (const u32 id : snapshot.chunks)
+  {
+    const std::vector<u8>& data = m_chunks[id].data;
+    std::memcpy(out, data.data(), data.size());
+    out += data.size();
+  }
+
+  return true;
+}
+
+bool RewindBuffer::Pop(Common::UniqueBuffer<u8>& state)
+{
+  if (!Get(m_snapshots.size() - 1, state))
+    return false;
+
+  const Snapshot& snapshot = m_snapshots.back();
+  for (const u32 id : snapshot.chunks)
+    ReleaseChunk(id);
+  m_memory_usage -= snapshot.chunks.size() * sizeof(u32);
+  m_snapshots.pop_back();
+
+  return true;
+}
+
+void RewindBuffer::DropOldestSnapshot()
+{
+  const Snapshot& snapshot = m_snapshots.front();
+  for (const u32 id : snapshot.chunks)
+    ReleaseChunk(id);
+  m_memory_usage -= snapshot.chunks.size() * sizeof(u32);
+  m_snapshots.pop_front();
+}
+
+void RewindBuffer::EnforceMemoryBudget()
+{
+  while (m_snapshots.size() > 1 && m_memory_usage > m_memory_budget)
+    DropOldestSnapshot();
+}
+
+void RewindBuffer::Clear()
+{
+  m_chunks.clear();
+  m_free_chunks.clear();
+  m_chunk_index.clear();
+  m_snapshots.clear();
+  m_memory_usage = 0;
+}
+
+void RewindBuffer::SetMemoryBudget(size_t memory_budget)
+{
+  m_memory_budget = memory_budget;
+  EnforceMemoryBudget();
+}
+}  // namespace State
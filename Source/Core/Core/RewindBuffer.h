@@ -0,0 +1,79 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// Keeps the most recent savestates in memory within a fixed memory budget.
+//
+// Savestates are split into content-defined chunks (so that data which merely moved because an
+// earlier part of the state changed in size is still recognized), and each distinct chunk is only
+// stored once. Consecutive savestates mostly consist of identical data, since only a small part of
+// emulated memory is written between them, so every snapshot after the first one effectively only
+// costs the chunks that changed.
+class RewindBuffer
+{
+public:
+  explicit RewindBuffer(size_t memory_budget);
+
+  // Adds a snapshot, dropping the oldest snapshots if the memory budget is exceeded. The newest
+  // snapshot is always kept, even if it doesn't fit in the budget by itself.
+  void Push(std::span<const u8> state);
+
+  // Reassembles the newest snapshot into the buffer and removes it. Returns false if empty.
+  bool Pop(Common::UniqueBuffer<u8>& state);
+
+  // Reassembles the snapshot with the given index (0 being the oldest) into the buffer, without
+  // removing it. Returns false if there is no such snapshot.
+  bool Get(size_t index, Common::UniqueBuffer<u8>& state) const;
+
+  void Clear();
+  void SetMemoryBudget(size_t memory_budget);
+
+  size_t GetNumSnapshots() const { return m_snapshots.size(); }
+  size_t GetMemoryUsage() const { return m_memory_usage; }
+
+  static constexpr size_t MIN_CHUNK_SIZE = 2 * 1024;
+  static constexpr size_t MAX_CHUNK_SIZE = 64 * 1024;
+
+private:
+  struct Chunk
+  {
+    std::vector<u8> data;
+    u64 hash = 0;
+    u32 ref_count = 0;
+    bool indexed = false;
+  };
+
+  struct Snapshot
+  {
+    std::vector<u32> chunks;
+    size_t size = 0;
+  };
+
+  static size_t FindChunkEnd(std::span<const u8> data);
+
+  u32 AddChunk(std::span<const u8> data);
+  void ReleaseChunk(u32 id);
+  void DropOldestSnapshot();
+  void EnforceMemoryBudget();
+
+  std::vector<Chunk> m_chunks;
+  std::vector<u32> m_free_chunks;
+  std::unordered_map<u64, u32> m_chunk_index;
+  std::deque<Snapshot> m_snapshots;
+
+  size_t m_memory_budget;
+  size_t m_memory_usage = 0;
+};
+}  // namespace State
@@ -4,13 +4,19 @@
 #include "Core/State.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <future>
+#include <iterator>
 #include <locale>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -19,6 +25,7 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -27,23 +34,28 @@
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
+#include "Common/TaskScheduler.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
 #include "Common/Version.h"
 #include "Common/WorkQueueThread.h"
 
 #include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/GeckoCode.h"
+#include "Core/HW/CPU.h"
 #include "Core/HW/HW.h"
 #include "Core/HW/Memmap.h"
+#include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
 #include "Core/Host.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
 #include "Core/System.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
@@ -72,9 +84,49 @@ static std::mutex s_undo_load_buffer_mutex;
 
 static std::mutex s_load_or_save_in_progress_mutex;
 
+// Rewind snapshots are taken and loaded on the host thread, through the usual
+// SaveToBuffer/LoadFromBuffer paths, so that they happen at a safe point of the CPU thread.
+static RewindBuffer s_rewind_buffer{0};
+static Common::UniqueBuffer<u8> s_rewind_state_buffer;
+static std::mutex s_rewind_buffer_mutex;
+static u32 s_rewind_field_counter = 0;
+static std::atomic<bool> s_rewind_snapshot_pending = false;
+
+// Checkpoints of the movie that is being played back, in the same kind of buffer as rewind
+// snapshots, so that each checkpoint only costs what changed since the previous one. The movie
+// frame of each checkpoint is kept in s_movie_checkpoint_frames, in increasing order.
+static RewindBuffer s_movie_checkpoints{0};
+static std::deque<u64> s_movie_checkpoint_frames;
+static Common::UniqueBuffer<u8> s_movie_checkpoint_buffer;
+static std::mutex s_movie_checkpoint_mutex;
+static std::atomic<bool> s_movie_checkpoint_pending = false;
+static std::atomic<bool> s_movie_checkpoints_stored = false;
+
+static constexpr u64 NO_MOVIE_SEEK = ~u64{0};
+static std::atomic<u64> s_movie_seek_target = NO_MOVIE_SEEK;
+
+// Rollback netcode would save a state every frame and load one for every misprediction, so the
+// profiler measures both on the CPU thread, without the cost of pausing it.
+struct RollbackProfilerStats
+{
+  u32 num_samples = 0;
+  std::chrono::steady_clock::duration total_save_time{};
+  std::chrono::steady_clock::duration max_save_time{};
+  std::chrono::steady_clock::duration total_load_time{};
+  std::chrono::steady_clock::duration max_load_time{};
+  size_t max_state_size = 0;
+};
+constexpr u32 ROLLBACK_PROFILER_INTERVAL = 30;
+constexpr u32 ROLLBACK_PROFILER_SAMPLES_PER_REPORT = 20;
+static Common::UniqueBuffer<u8> s_rollback_profiler_buffer;
+static RollbackProfilerStats s_rollback_profiler_stats;
+static u32 s_rollback_profiler_field_counter = 0;
+static std::atomic<bool> s_rollback_profile_pending = false;
+
 struct CompressAndDumpState_args
 {
   Common::UniqueBuffer<u8> buffer;
+  size_t state_size = 0;  // The buffer can be larger than the state
   std::string filename;
   std::shared_ptr<Common::Event> state_write_done_event;
 };
@@ -225,24 +277,61 @@ void LoadFromBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
       true);
 }
 
-void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+// Size of the most recently saved state, used to size buffers for the next one.
+static std::atomic<size_t> s_last_state_size = 0;
+
+static size_t GetStateBufferSize(size_t state_size)
+{
+  // Leave some headroom, so that states which grow slightly from one save to the next (e.g.
+  // because of new texture cache entries) still fit.
+  return state_size + state_size / 16;
+}
+
+// Must be called on the CPU thread. Returns the size of the state, which can be smaller than the
+// size of the buffer, and sets valid to whether DoState succeeded.
+static size_t DoStateToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer, bool* valid)
+{
+  // The buffer is usually big enough already, so write to it straight away rather than measuring
+  // first. When the state doesn't fit, PointerWrap switches to measuring, and the state is written
+  // again to a buffer of the measured size.
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+  DoState(system, p);
+  size_t state_size = ptr - buffer.data();
+  if (state_size <= buffer.size())
+  {
+    s_last_state_size = state_size;
+    *valid = p.IsWriteMode();
+    return state_size;
+  }
+
+  buffer.reset(GetStateBufferSize(state_size));
+  ptr = buffer.data();
+  PointerWrap p_retry(&ptr, buffer.size(), PointerWrap::Mode::Write);
+  DoState(system, p_retry);
+  state_size = ptr - buffer.data();
+  s_last_state_size = state_size;
+  *valid = p_retry.IsWriteMode();
+  return state_size;
+}
+
+// Returns the size of the state, which can be smaller than the size of the buffer.
+static size_t SaveToBufferWithSize(Core::System& system, Common::UniqueBuffer<u8>& buffer)
 {
+  size_t state_size = 0;
   Core::RunOnCPUThread(
       system,
       [&] {
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-        DoState(system, p_measure);
-
-        const size_t new_buffer_size = ptr - (u8*)(nullptr);
-        if (new_buffer_size > buffer.size())
-          buffer.reset(new_buffer_size);
-
-        ptr = buffer.data();
-        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
-        DoState(system, p);
+        bool valid;
+        state_size = DoStateToBuffer(system, buffer, &valid);
       },
       true);
+  return state_size;
+}
+
+void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+{
+  SaveToBufferWithSize(system, buffer);
 }
 
 namespace
@@ -309,50 +398,85 @@ static std::vector<SlotWithTimestamp> GetUsedSlotsWithTimestamp()
   return result;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+// Size of the chunks that are compressed in parallel. Large enough to not hurt the compression
+// ratio, but small enough to give every core some work for typical state sizes.
+constexpr u32 COMPRESSION_CHUNK_SIZE = 4 * 1024 * 1024;
+
+constexpr int ZSTD_COMPRESSION_LEVEL = 3;
+
+static bool CompressBufferToFile(const u8* raw_buffer, u64 size, CompressionType compression_type,
+                                 File::IOFile& f)
 {
-  u64 total_bytes_compressed = 0;
+  const u32 num_chunks =
+      static_cast<u32>((size + COMPRESSION_CHUNK_SIZE - 1) / COMPRESSION_CHUNK_SIZE);
+  std::vector<Common::UniqueBuffer<u8>> compressed_chunks(num_chunks);
+  std::vector<u32> compressed_sizes(num_chunks);
+
+  // Saving runs alongside emulation, but the next save or load waits for it.
+  Common::ParallelFor(Common::TaskPriority::FrameBound, num_chunks, [&](size_t i) {
+    const u8* const chunk = raw_buffer + i * COMPRESSION_CHUNK_SIZE;
+    const size_t chunk_size =
+        std::min<u64>(COMPRESSION_CHUNK_SIZE, size - i * COMPRESSION_CHUNK_SIZE);
+    Common::UniqueBuffer<u8>& compressed = compressed_chunks[i];
+
+    if (compression_type == CompressionType::ZstdChunked)
+    {
+      compressed.reset(ZSTD_compressBound(chunk_size));
+      const size_t result = ZSTD_compress(compressed.data(), compressed.size(), chunk,
+                                          chunk_size, ZSTD_COMPRESSION_LEVEL);
+      compressed_sizes[i] = ZSTD_isError(result) ? 0 : static_cast<u32>(result);
+    }
+    else
+    {
+      const int chunk_size_int = static_cast<int>(chunk_size);
+      compressed.reset(LZ4_compressBound(chunk_size_int));
+      const int result = LZ4_compress_default(reinterpret_cast<const char*>(chunk),
+                                              reinterpret_cast<char*>(compressed.data()),
+                                              chunk_size_int, static_cast<int>(compressed.size()));
+      compressed_sizes[i] = static_cast<u32>(std::max(result, 0));
+    }
+  });
 
-  while (true)
+  if (Common::Contains(compressed_sizes, 0u))
   {
-    const u64 bytes_left_to_compress = size - total_bytes_compressed;
+    PanicAlertFmtT("Internal compression error - compression failed");
+    return false;
+  }
 
-    const int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    Common::UniqueBuffer<char> compressed_buffer(LZ4_compressBound(bytes_to_compress));
-    const int compressed_len = LZ4_compress_default(
-        reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed, compressed_buffer.get(),
-        bytes_to_compress, int(compressed_buffer.size()));
+  // The chunks are written in order, after an index of their sizes, so that loading can find
+  // every chunk without having to decompress the preceding ones.
+  const StateChunkedPayloadHeader payload_header{COMPRESSION_CHUNK_SIZE, num_chunks};
+  bool success = f.WriteArray(&payload_header, 1) &&
+                 f.WriteArray(compressed_sizes.data(), compressed_sizes.size());
+  for (u32 i = 0; success && i < num_chunks; ++i)
+    success = f.WriteBytes(compressed_chunks[i].data(), compressed_sizes[i]);
 
-    if (compressed_len == 0)
-    {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
-    }
+  return success;
+}
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
+static CompressionType GetCompressionType()
+{
+  if (!s_use_compression)
+    return CompressionType::Uncompressed;
 
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
-  }
+  return Config::Get(Config::MAIN_SAVESTATE_USE_ZSTD) ? CompressionType::ZstdChunked :
+                                                        CompressionType::LZ4Chunked;
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(size_t uncompressed_size, CompressionType compression_type,
+                               File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -364,7 +488,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, uncompressed_size, compression_type);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
@@ -377,7 +501,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
 static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args& save_args)
 {
   const u8* const buffer_data = save_args.buffer.data();
-  const size_t buffer_size = save_args.buffer.size();
+  const size_t buffer_size = save_args.state_size;
   const std::string& filename = save_args.filename;
 
   // Find free temporary filename.
@@ -398,10 +522,11 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
+  const CompressionType compression_type = GetCompressionType();
+  WriteHeadersToFile(buffer_size, compression_type, f);
 
-  if (s_use_compression)
-    CompressBufferToFile(buffer_data, buffer_size, f);
+  if (compression_type != CompressionType::Uncompressed)
+    CompressBufferToFile(buffer_data, buffer_size, compression_type, f);
   else
     f.WriteBytes(buffer_data, buffer_size);
 
@@ -472,19 +597,13 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           ++s_state_writes_in_queue;
         }
 
-        // Measure the size of the buffer.
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-        DoState(system, p_measure);
-        const size_t buffer_size = ptr - (u8*)(nullptr);
-
-        // Then actually do the write.
-        Common::UniqueBuffer<u8> current_buffer(buffer_size);
-        ptr = current_buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
+        // The buffer is handed off to the save thread, so it can't be reused, but sizing it from
+        // the previous save still avoids a separate measuring pass.
+        Common::UniqueBuffer<u8> current_buffer(GetStateBufferSize(s_last_state_size));
+        bool valid;
+        const size_t state_size = DoStateToBuffer(system, current_buffer, &valid);
 
-        if (p.IsWriteMode())
+        if (valid)
         {
           Core::DisplayMessage("Saving State...", 1000);
 
@@ -492,6 +611,7 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
 
           CompressAndDumpState_args save_args;
           save_args.buffer = std::move(current_buffer);
+          save_args.state_size = state_size;
           save_args.filename = filename;
           if (wait)
           {
@@ -706,6 +826,86 @@ static bool DecompressLZ4(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::
   }
 }
 
+static bool DecompressChunked(Common::UniqueBuffer<u8>& raw_buffer, u64 size,
+                              CompressionType compression_type, File::IOFile& f)
+{
+  StateChunkedPayloadHeader payload_header;
+  if (!f.ReadArray(&payload_header, 1))
+  {
+    PanicAlertFmt("Could not read state data header");
+    return false;
+  }
+
+  const u64 chunk_size = payload_header.chunk_size;
+  const u32 num_chunks = payload_header.num_chunks;
+  if (chunk_size == 0 || num_chunks != (size + chunk_size - 1) / chunk_size)
+  {
+    PanicAlertFmt("State data header corrupted");
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(num_chunks);
+  if (!f.ReadArray(compressed_sizes.data(), compressed_sizes.size()))
+  {
+    PanicAlertFmt("Could not read state data length");
+    return false;
+  }
+
+  std::vector<u64> compressed_offsets(num_chunks);
+  u64 total_compressed_size = 0;
+  for (u32 i = 0; i < num_chunks; ++i)
+  {
+    compressed_offsets[i] = total_compressed_size;
+    total_compressed_size += compressed_sizes[i];
+  }
+
+  if (total_compressed_size > f.GetSize() - f.Tell())
+  {
+    PanicAlertFmt("State data length corrupted");
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> compressed_data(total_compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.reset(size);
+
+  // Each chunk must decompress to exactly its expected size. A flag per chunk is used rather than
+  // std::vector<bool>, since the chunks are decompressed concurrently.
+  std::vector<u8> chunk_ok(num_chunks);
+  Common::ParallelFor(Common::TaskPriority::LatencyCritical, num_chunks, [&](size_t i) {
+    const u8* const compressed = compressed_data.data() + compressed_offsets[i];
+    u8* const out = raw_buffer.data() + i * chunk_size;
+    const u64 expected_size = std::min(chunk_size, size - i * chunk_size);
+
+    if (compression_type == CompressionType::ZstdChunked)
+    {
+      const size_t result = ZSTD_decompress(out, expected_size, compressed, compressed_sizes[i]);
+      chunk_ok[i] = !ZSTD_isError(result) && result == expected_size;
+    }
+    else
+    {
+      const int result = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed),
+                                             reinterpret_cast<char*>(out),
+                                             static_cast<int>(compressed_sizes[i]),
+                                             static_cast<int>(expected_size));
+      chunk_ok[i] = result >= 0 && static_cast<u64>(result) == expected_size;
+    }
+  });
+
+  if (Common::Contains(chunk_ok, u8(0)))
+  {
+    PanicAlertFmtT("Internal decompression error - decompression failed");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -803,6 +1003,20 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
 
     break;
   }
+  case CompressionType::LZ4Chunked:
+  case CompressionType::ZstdChunked:
+  {
+    Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
+    const auto compression_type =
+        static_cast<CompressionType>(extended_header.base_header.compression_type);
+    if (!DecompressChunked(buffer, extended_header.base_header.uncompressed_size,
+                           compression_type, f))
+    {
+      return;
+    }
+
+    break;
+  }
   case CompressionType::Uncompressed:
   {
     u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
@@ -943,8 +1157,24 @@ void Shutdown()
 {
   s_save_thread.Shutdown();
 
-  std::lock_guard lk(s_undo_load_buffer_mutex);
-  s_undo_load_buffer.reset();
+  {
+    std::lock_guard lk(s_undo_load_buffer_mutex);
+    s_undo_load_buffer.reset();
+  }
+
+  {
+    std::lock_guard lk(s_rewind_buffer_mutex);
+    s_rewind_buffer.Clear();
+    s_rewind_state_buffer.reset();
+    s_rewind_field_counter = 0;
+  }
+
+  std::lock_guard lk(s_movie_checkpoint_mutex);
+  s_movie_checkpoints.Clear();
+  s_movie_checkpoint_frames.clear();
+  s_movie_checkpoint_buffer.reset();
+  s_movie_checkpoints_stored = false;
+  s_movie_seek_target = NO_MOVIE_SEEK;
 }
 
 static std::string MakeStateFilename(int number)
@@ -1035,4 +1265,257 @@ void UndoSaveState(Core::System& system)
   LoadAs(system, File::GetUserPath(D_STATESAVES_IDX) + "lastState.sav");
 }
 
+static void SaveRewindSnapshot(Core::System& system)
+{
+  std::lock_guard lk(s_rewind_buffer_mutex);
+
+  const size_t state_size = SaveToBufferWithSize(system, s_rewind_state_buffer);
+  if (state_size == 0)
+    return;
+
+  s_rewind_buffer.SetMemoryBudget(size_t(Config::Get(Config::MAIN_REWIND_MEMORY_BUDGET_MB)) << 20);
+  s_rewind_buffer.Push(std::span(s_rewind_state_buffer.data(), state_size));
+}
+
+void UpdateRewind(Core::System& system)
+{
+  const u32 interval = Config::Get(Config::MAIN_REWIND_INTERVAL);
+  if (interval == 0 || NetPlay::IsNetPlayRunning() || system.GetMovie().IsMovieActive())
+    return;
+
+  if (++s_rewind_field_counter < interval)
+    return;
+  s_rewind_field_counter = 0;
+
+  // Don't queue up more snapshots if the host thread can't keep up
+  if (s_rewind_snapshot_pending.exchange(true))
+    return;
+
+  Core::QueueHostJob([](Core::System& system_) {
+    SaveRewindSnapshot(system_);
+    s_rewind_snapshot_pending = false;
+  });
+}
+
+static void ReportRollbackCost(Core::System& system, const RollbackProfilerStats& stats)
+{
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+  const double average_save_ms = Milliseconds(stats.total_save_time).count() / stats.num_samples;
+  const double average_load_ms = Milliseconds(stats.total_load_time).count() / stats.num_samples;
+  const double frame_ms = 1000.0 / system.GetVideoInterface().GetTargetRefreshRate();
+
+  const std::string message = fmt::format(
+      "Rollback cost: save {:.2f} ms (max {:.2f} ms, {:.0f}% of a field), load {:.2f} ms "
+      "(max {:.2f} ms), state size {:.1f} MiB",
+      average_save_ms, Milliseconds(stats.max_save_time).count(),
+      average_save_ms / frame_ms * 100, average_load_ms, Milliseconds(stats.max_load_time).count(),
+      stats.max_state_size / 1048576.0);
+  NOTICE_LOG_FMT(CORE, "{}", message);
+  OSD::AddMessage(message, OSD::Duration::VERY_LONG);
+}
+
+static void ProfileRollbackCost(Core::System& system)
+{
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        using Clock = std::chrono::steady_clock;
+        RollbackProfilerStats& stats = s_rollback_profiler_stats;
+
+        const Clock::time_point start = Clock::now();
+        bool valid;
+        const size_t state_size = DoStateToBuffer(system, s_rollback_profiler_buffer, &valid);
+        const Clock::time_point saved = Clock::now();
+        if (!valid)
+          return;
+
+        // Loading the state that was just saved doesn't change anything, but costs as much as
+        // loading an older one.
+        u8* ptr = s_rollback_profiler_buffer.data();
+        PointerWrap p(&ptr, state_size, PointerWrap::Mode::Read);
+        DoState(system, p);
+        const Clock::time_point loaded = Clock::now();
+
+        ++stats.num_samples;
+        stats.total_save_time += saved - start;
+        stats.max_save_time = std::max(stats.max_save_time, saved - start);
+        stats.total_load_time += loaded - saved;
+        stats.max_load_time = std::max(stats.max_load_time, loaded - saved);
+        stats.max_state_size = std::max(stats.max_state_size, state_size);
+      },
+      true);
+
+  if (s_rollback_profiler_stats.num_samples >= ROLLBACK_PROFILER_SAMPLES_PER_REPORT)
+  {
+    ReportRollbackCost(system, s_rollback_profiler_stats);
+    s_rollback_profiler_stats = {};
+  }
+}
+
+void UpdateRollbackProfiler(Core::System& system)
+{
+  // Like rewinding, this stays out of netplay and movies, where states must not be loaded.
+  if (!Config::Get(Config::MAIN_ROLLBACK_PROFILER) || NetPlay::IsNetPlayRunning() ||
+      system.GetMovie().IsMovieActive())
+  {
+    return;
+  }
+
+  if (++s_rollback_profiler_field_counter < ROLLBACK_PROFILER_INTERVAL)
+    return;
+  s_rollback_profiler_field_counter = 0;
+
+  if (s_rollback_profile_pending.exchange(true))
+    return;
+
+  Core::QueueHostJob([](Core::System& system_) {
+    ProfileRollbackCost(system_);
+    s_rollback_profile_pending = false;
+  });
+}
+
+void Rewind(Core::System& system)
+{
+  if (system.GetMovie().IsMovieActive())
+  {
+    OSD::AddMessage("Rewinding is disabled during movie recording and playback");
+    return;
+  }
+
+  std::lock_guard lk(s_rewind_buffer_mutex);
+  if (!s_rewind_buffer.Pop(s_rewind_state_buffer))
+  {
+    OSD::AddMessage("There is nothing to rewind");
+    return;
+  }
+
+  LoadFromBuffer(system, s_rewind_state_buffer);
+}
+
+static void SaveMovieCheckpoint(Core::System& system)
+{
+  std::lock_guard lk(s_movie_checkpoint_mutex);
+
+  u64 frame = 0;
+  size_t state_size = 0;
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        bool valid;
+        state_size = DoStateToBuffer(system, s_movie_checkpoint_buffer, &valid);
+        frame = system.GetMovie().GetCurrentFrame();
+        if (!valid)
+          state_size = 0;
+      },
+      true);
+
+  // A checkpoint for this part of the movie might have been taken before seeking back
+  if (state_size == 0 || !system.GetMovie().IsPlayingInput() ||
+      (!s_movie_checkpoint_frames.empty() && frame <= s_movie_checkpoint_frames.back()))
+  {
+    return;
+  }
+
+  s_movie_checkpoints.SetMemoryBudget(
+      size_t(Config::Get(Config::MAIN_MOVIE_CHECKPOINT_MEMORY_BUDGET_MB)) << 20);
+  s_movie_checkpoints.Push(std::span(s_movie_checkpoint_buffer.data(), state_size));
+  s_movie_checkpoint_frames.push_back(frame);
+
+  // Keep the frames in sync with the checkpoints that weren't dropped to stay within the budget
+  while (s_movie_checkpoint_frames.size() > s_movie_checkpoints.GetNumSnapshots())
+    s_movie_checkpoint_frames.pop_front();
+
+  s_movie_checkpoints_stored = true;
+}
+
+static void ClearMovieCheckpoints()
+{
+  std::lock_guard lk(s_movie_checkpoint_mutex);
+  s_movie_checkpoints.Clear();
+  s_movie_checkpoint_frames.clear();
+  s_movie_checkpoints_stored = false;
+}
+
+void UpdateMovieCheckpoints(Core::System& system)
+{
+  auto& movie = system.GetMovie();
+  const u64 frame = movie.GetCurrentFrame();
+
+  const u64 seek_target = s_movie_seek_target;
+  if (seek_target != NO_MOVIE_SEEK && (frame >= seek_target || !movie.IsPlayingInput()))
+  {
+    s_movie_seek_target = NO_MOVIE_SEEK;
+    system.GetCPU().Break();
+    Core::NotifyStateChanged(Core::GetState(system));
+  }
+
+  if (!movie.IsPlayingInput())
+  {
+    // The checkpoints are only valid for the movie they were taken from
+    if (s_movie_checkpoints_stored.exchange(false))
+      Core::QueueHostJob([](Core::System&) { ClearMovieCheckpoints(); });
+    return;
+  }
+
+  const u32 interval = Config::Get(Config::MAIN_MOVIE_CHECKPOINT_INTERVAL);
+  if (interval == 0 || frame % interval != 0)
+    return;
+
+  // Don't queue up more checkpoints if the host thread can't keep up
+  if (s_movie_checkpoint_pending.exchange(true))
+    return;
+
+  Core::QueueHostJob([](Core::System& system_) {
+    SaveMovieCheckpoint(system_);
+    s_movie_checkpoint_pending = false;
+  });
+}
+
+bool IsSeekingMovie()
+{
+  return s_movie_seek_target != NO_MOVIE_SEEK;
+}
+
+void SeekMovie(Core::System& system, u64 frame)
+{
+  auto& movie = system.GetMovie();
+  if (!movie.IsPlayingInput())
+  {
+    OSD::AddMessage("Seeking is only possible during movie playback");
+    return;
+  }
+
+  {
+    std::lock_guard lk(s_movie_checkpoint_mutex);
+
+    // Load the last checkpoint before the target, unless the emulation is already closer to it
+    const u64 current_frame = movie.GetCurrentFrame();
+    const auto it = std::ranges::upper_bound(s_movie_checkpoint_frames, frame);
+    const bool has_checkpoint = it != s_movie_checkpoint_frames.begin();
+    if (frame < current_frame || (has_checkpoint && *std::prev(it) > current_frame))
+    {
+      if (!has_checkpoint)
+      {
+        OSD::AddMessage(fmt::format("There is no movie checkpoint before frame {}", frame));
+        return;
+      }
+
+      const size_t index = std::distance(s_movie_checkpoint_frames.begin(), it) - 1;
+      s_movie_checkpoints.Get(index, s_movie_checkpoint_buffer);
+      LoadFromBuffer(system, s_movie_checkpoint_buffer);
+    }
+  }
+
+  if (movie.GetCurrentFrame() >= frame)
+  {
+    Core::SetState(system, Core::State::Paused);
+    return;
+  }
+
+  // The target is reached by running without the speed limit, and UpdateMovieCheckpoints pauses
+  // the emulation once it gets there.
+  s_movie_seek_target = frame;
+  Core::SetState(system, Core::State::Running);
+}
+
 }  // namespace State
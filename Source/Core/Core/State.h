@@ -55,6 +55,10 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // The payload is split into independently compressed chunks, which are preceded by a
+  // StateChunkedPayloadHeader and a table of the compressed chunk sizes (u32 each).
+  LZ4Chunked = 2,
+  ZstdChunked = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -72,6 +76,14 @@ static_assert(offsetof(StateExtendedBaseHeader, payload_offset) == 4);
 static_assert(offsetof(StateExtendedBaseHeader, uncompressed_size) == 8);
 static_assert(std::is_trivially_copyable_v<StateExtendedBaseHeader>);
 
+struct StateChunkedPayloadHeader
+{
+  u32 chunk_size;  // Uncompressed size of all chunks but the last one
+  u32 num_chunks;
+};
+static_assert(sizeof(StateChunkedPayloadHeader) == 8);
+static_assert(std::is_trivially_copyable_v<StateChunkedPayloadHeader>);
+
 struct StateExtendedHeader
 {
   StateExtendedBaseHeader base_header;
@@ -114,6 +126,24 @@ void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
 void UndoLoadState(Core::System& system);
 
+// Called at every emulated field (CPU thread). Schedules a rewind snapshot when one is due.
+void UpdateRewind(Core::System& system);
+// Loads the most recent rewind snapshot and discards it, so that calling this repeatedly goes
+// further back in time.
+void Rewind(Core::System& system);
+
+// Called at every emulated field (CPU thread). When the rollback profiler is enabled, schedules a
+// measurement of saving and loading a state, and periodically reports the results.
+void UpdateRollbackProfiler(Core::System& system);
+
+// Called at every emulated field (CPU thread). During movie playback, schedules a movie checkpoint
+// every MAIN_MOVIE_CHECKPOINT_INTERVAL frames, and pauses the emulation once a seek is done.
+void UpdateMovieCheckpoints(Core::System& system);
+// Jumps to a frame of the movie that is being played back, by loading the last checkpoint before
+// it and running at unlimited speed from there (or from the current frame, if that is closer).
+void SeekMovie(Core::System& system, u64 frame);
+bool IsSeekingMovie();
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
@@ -18,11 +18,13 @@
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/CommonTitles.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Config/SessionSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/WiiSave.h"
 #include "Core/IOS/ES/ES.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/MemoryBackend/FS.h"
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/Uids.h"
 #include "Core/Movie.h"
@@ -38,6 +40,7 @@ static std::string s_temp_wii_root;
 static std::string s_temp_redirect_root;
 static bool s_wii_root_initialized = false;
 static std::vector<IOS::HLE::FS::NandRedirect> s_nand_redirects;
+static std::shared_ptr<FS::MemoryFileSystem> s_memory_nand;
 
 // When Temp NAND + Redirects are both active, we need to keep track of where each redirect path
 // should be copied back to after a successful session finish.
@@ -232,6 +235,13 @@ void InitializeWiiRoot(bool use_temporary)
 
 void ShutdownWiiRoot()
 {
+  if (s_memory_nand)
+  {
+    if (Config::Get(Config::MAIN_WII_NAND_IN_MEMORY_FLUSH) && !s_memory_nand->Flush())
+      ERROR_LOG_FMT(IOS_FS, "Failed to write the in-memory NAND back to the NAND");
+    s_memory_nand.reset();
+  }
+
   if (WiiRootIsTemporary())
   {
     File::DeleteDirRecursively(s_temp_wii_root);
@@ -245,6 +255,19 @@ void ShutdownWiiRoot()
   s_wii_root_initialized = false;
 }
 
+std::shared_ptr<FS::FileSystem> GetMemoryNand()
+{
+  // Temporary roots (movies and netplay) already avoid touching the configured NAND.
+  if (!s_memory_nand && s_wii_root_initialized && !WiiRootIsTemporary() &&
+      Config::Get(Config::MAIN_WII_NAND_IN_MEMORY))
+  {
+    INFO_LOG_FMT(IOS_FS, "Loading the NAND into memory");
+    s_memory_nand =
+        std::make_shared<FS::MemoryFileSystem>(File::GetUserPath(D_SESSION_WIIROOT_IDX));
+  }
+  return s_memory_nand;
+}
+
 bool WiiRootIsInitialized()
 {
   return s_wii_root_initialized;
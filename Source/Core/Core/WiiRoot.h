@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -12,6 +13,7 @@ class BootSessionData;
 
 namespace IOS::HLE::FS
 {
+class FileSystem;
 struct NandRedirect;
 }
 
@@ -39,4 +41,8 @@ void InitializeWiiFileSystemContents(
 void CleanUpWiiFileSystemContents(const BootSessionData& boot_session_data);
 
 const std::vector<IOS::HLE::FS::NandRedirect>& GetActiveNandRedirects();
+
+// Returns the in-memory session NAND, creating it on first use, or nullptr if it isn't enabled.
+// The same file system is kept across IOS reloads until the Wii root is shut down.
+std::shared_ptr<IOS::HLE::FS::FileSystem> GetMemoryNand();
 }  // namespace Core
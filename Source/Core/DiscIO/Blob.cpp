@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -78,6 +79,22 @@ void SectorReader::SetChunkSize(int block_cnt)
   SetSectorSize(m_block_size);
 }
 
+std::vector<const BlobReader::ReadRange*>
+BlobReader::SortReadRanges(std::span<const ReadRange> ranges)
+{
+  std::vector<const ReadRange*> sorted_ranges(ranges.size());
+  std::ranges::transform(ranges, sorted_ranges.begin(), [](const auto& range) { return &range; });
+  std::ranges::sort(sorted_ranges, {}, &ReadRange::offset);
+  return sorted_ranges;
+}
+
+bool BlobReader::ReadMultiple(std::span<const ReadRange> ranges)
+{
+  return std::ranges::all_of(SortReadRanges(ranges), [this](const ReadRange* range) {
+    return Read(range->offset, range->size, range->out_ptr);
+  });
+}
+
 SectorReader::~SectorReader() = default;
 
 const SectorReader::Cache* SectorReader::FindCacheLine(u64 block_num)
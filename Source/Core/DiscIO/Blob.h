@@ -17,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,19 @@ public:
 
   // NOT thread-safe - can't call this from multiple threads.
   virtual bool Read(u64 offset, u64 size, u8* out_ptr) = 0;
+
+  struct ReadRange
+  {
+    u64 offset;
+    u64 size;
+    u8* out_ptr;
+  };
+
+  // Reads several ranges at once. The ranges may be processed in any order, which lets
+  // implementations sort and merge them to reduce seeking and the number of I/O operations.
+  // The default implementation calls Read for each range in order of offset.
+  // NOT thread-safe - can't call this from multiple threads.
+  virtual bool ReadMultiple(std::span<const ReadRange> ranges);
   template <typename T>
   std::optional<T> ReadSwapped(u64 offset)
   {
@@ -99,6 +113,8 @@ public:
 
 protected:
   BlobReader() {}
+
+  static std::vector<const ReadRange*> SortReadRanges(std::span<const ReadRange> ranges);
 };
 
 // Provides caching and byte-operation-to-block-operations facilities.
@@ -202,6 +218,6 @@ bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, const CompressCB& callback);
+                       int chunk_size, const CompressCB& callback, bool zstd_dictionary = false);
 
 }  // namespace DiscIO
@@ -97,12 +97,9 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
     if (std::holds_alternative<ContentFile>(m_content_source))
     {
       const auto& content = std::get<ContentFile>(m_content_source);
-      File::IOFile file(content.m_filename, "rb");
-      if (!file.Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
-          !file.ReadBytes(*buffer, bytes_to_read))
-      {
+      File::IOFile* file = blob->GetContentFile(content.m_filename);
+      if (!file || !file->ReadAt(content.m_offset + offset_in_content, *buffer, bytes_to_read))
         return false;
-      }
     }
     else if (std::holds_alternative<ContentMemory>(m_content_source))
     {
@@ -149,8 +146,31 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
 
 void DiscContentContainer::Add(u64 offset, u64 size, ContentSource source)
 {
-  if (size != 0)
-    m_contents.emplace(offset, size, std::move(source));
+  if (size == 0)
+    return;
+
+  // A piece of a file which directly follows the previous piece of the same file is merged with
+  // it, so that reads spanning both are done as one host read.
+  if (auto* file = std::get_if<ContentFile>(&source); file && file->m_offset != 0)
+  {
+    const auto previous = m_contents.find(DiscContent(offset));
+    if (previous != m_contents.end() && previous->GetEndOffset() == offset)
+    {
+      const auto* previous_file = std::get_if<ContentFile>(&previous->GetContentSource());
+      if (previous_file && previous_file->m_filename == file->m_filename &&
+          previous_file->m_offset + previous->GetSize() == file->m_offset)
+      {
+        const u64 merged_offset = previous->GetOffset();
+        const u64 merged_size = previous->GetSize() + size;
+        ContentFile merged_file = *previous_file;
+        m_contents.erase(previous);
+        m_contents.emplace(merged_offset, merged_size, std::move(merged_file));
+        return;
+      }
+    }
+  }
+
+  m_contents.emplace(offset, size, std::move(source));
 }
 
 u64 DiscContentContainer::CheckSizeAndAdd(u64 offset, const std::string& path)
@@ -506,6 +526,29 @@ DirectoryBlobReader::DirectoryBlobReader(const DirectoryBlobReader& rhs)
 {
 }
 
+File::IOFile* DirectoryBlobReader::GetContentFile(const std::string& path)
+{
+  const auto it = std::ranges::find_if(m_content_files,
+                                       [&path](const auto& file) { return file.first == path; });
+  if (it != m_content_files.end())
+  {
+    m_content_files.splice(m_content_files.begin(), m_content_files, it);
+    return &it->second;
+  }
+
+  File::IOFile file(path, "rb");
+  if (!file)
+  {
+    ERROR_LOG_FMT(DISCIO, "Failed to open {}", path);
+    return nullptr;
+  }
+
+  if (m_content_files.size() >= MAX_OPEN_CONTENT_FILES)
+    m_content_files.pop_back();
+  m_content_files.emplace_front(path, std::move(file));
+  return &m_content_files.front().second;
+}
+
 bool DirectoryBlobReader::Read(u64 offset, u64 length, u8* buffer)
 {
   if (offset + length > m_data_size)
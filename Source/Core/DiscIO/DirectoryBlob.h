@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
 #include <optional>
@@ -16,6 +17,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/WiiEncryptionCache.h"
@@ -137,6 +139,7 @@ public:
   u64 GetOffset() const;
   u64 GetEndOffset() const;
   u64 GetSize() const;
+  const ContentSource& GetContentSource() const { return m_content_source; }
   bool Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReader* blob) const;
 
   bool operator==(const DiscContent& other) const { return GetEndOffset() == other.GetEndOffset(); }
@@ -309,6 +312,12 @@ private:
 
   const VolumeDisc* GetWrappedVolume() const { return m_wrapped_volume.get(); }
 
+  // Returns a handle to a file which content is read from. The most recently used handles are
+  // kept open, so that games reading a file in many small pieces don't reopen it every time.
+  File::IOFile* GetContentFile(const std::string& path);
+
+  static constexpr size_t MAX_OPEN_CONTENT_FILES = 16;
+
   // For GameCube:
   DirectoryBlobPartition m_gamecube_pseudopartition;
 
@@ -323,6 +332,9 @@ private:
   u64 m_data_size;
 
   std::unique_ptr<VolumeDisc> m_wrapped_volume;
+
+  // Most recently used first
+  std::list<std::pair<std::string, File::IOFile>> m_content_files;
 };
 
 }  // namespace DiscIO
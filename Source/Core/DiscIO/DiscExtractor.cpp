@@ -5,16 +5,23 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstring>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/TaskScheduler.h"
+#include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/Filesystem.h"
@@ -51,8 +58,9 @@ u64 ReadFile(const Volume& volume, const Partition& partition, std::string_view
                   offset_in_file);
 }
 
-bool ExportData(const Volume& volume, const Partition& partition, u64 offset, u64 size,
-                const std::string& export_filename)
+static bool ExportData(const Volume& volume, const Partition& partition, u64 offset, u64 size,
+                       const std::string& export_filename, std::vector<u8>* buffer,
+                       size_t max_read_size)
 {
   File::IOFile f(export_filename, "wb");
   if (!f)
@@ -60,15 +68,14 @@ bool ExportData(const Volume& volume, const Partition& partition, u64 offset, u6
 
   while (size)
   {
-    // Limit read size to 128 MB
-    const size_t read_size = static_cast<size_t>(std::min<u64>(size, 0x08000000));
+    const size_t read_size = static_cast<size_t>(std::min<u64>(size, max_read_size));
+    if (buffer->size() < read_size)
+      buffer->resize(read_size);
 
-    std::vector<u8> buffer(read_size);
-
-    if (!volume.Read(offset, read_size, buffer.data(), partition))
+    if (!volume.Read(offset, read_size, buffer->data(), partition))
       return false;
 
-    if (!f.WriteBytes(buffer.data(), read_size))
+    if (!f.WriteBytes(buffer->data(), read_size))
       return false;
 
     size -= read_size;
@@ -78,6 +85,14 @@ bool ExportData(const Volume& volume, const Partition& partition, u64 offset, u6
   return true;
 }
 
+bool ExportData(const Volume& volume, const Partition& partition, u64 offset, u64 size,
+                const std::string& export_filename)
+{
+  // Limit read size to 128 MB
+  std::vector<u8> buffer;
+  return ExportData(volume, partition, offset, size, export_filename, &buffer, 0x08000000);
+}
+
 bool ExportFile(const Volume& volume, const Partition& partition, const FileInfo* file_info,
                 const std::string& export_filename)
 {
@@ -98,10 +113,24 @@ bool ExportFile(const Volume& volume, const Partition& partition, std::string_vi
   return ExportFile(volume, partition, file_system->FindFileInfo(path).get(), export_filename);
 }
 
-void ExportDirectory(const Volume& volume, const Partition& partition, const FileInfo& directory,
-                     bool recursive, const std::string& filesystem_path,
+namespace
+{
+struct FileToExport
+{
+  std::string path;
+  std::string export_path;
+  u64 offset;
+  u64 size;
+};
+}  // namespace
+
+// Creates the directories and returns the files in the order ExportDirectory used to visit them.
+// Returns false if update_progress cancelled the extraction.
+static bool
+CollectFilesToExport(const FileInfo& directory, bool recursive, const std::string& filesystem_path,
                      const std::string& export_folder,
-                     const std::function<bool(const std::string& path)>& update_progress)
+                     const std::function<bool(const std::string& path)>& update_progress,
+                     std::vector<FileToExport>* files)
 {
   std::string export_root = export_folder + '/';
   if (directory.IsDirectory() && !directory.IsRoot())
@@ -115,24 +144,138 @@ void ExportDirectory(const Volume& volume, const Partition& partition, const Fil
     const std::string path = filesystem_path + name;
     const std::string export_path = export_root + name;
 
+    if (!file_info.IsDirectory())
+    {
+      files->push_back({path, export_path, file_info.GetOffset(), file_info.GetSize()});
+      continue;
+    }
+
     if (update_progress(path))
-      return;
+      return false;
 
     DEBUG_LOG_FMT(DISCIO, "{}", export_path);
 
-    if (!file_info.IsDirectory())
+    if (recursive &&
+        !CollectFilesToExport(file_info, recursive, filesystem_path, export_root,
+                              update_progress, files))
     {
-      if (File::Exists(export_path))
-        NOTICE_LOG_FMT(DISCIO, "{} already exists", export_path);
-      else if (!ExportFile(volume, partition, &file_info, export_path))
-        ERROR_LOG_FMT(DISCIO, "Could not export {}", export_path);
+      return false;
     }
-    else if (recursive)
+  }
+
+  return true;
+}
+
+static void ExportFileToPath(const Volume& volume, const Partition& partition,
+                             const FileToExport& file, std::vector<u8>* buffer)
+{
+  // Keep the per-thread buffers small, since several files are extracted at once
+  constexpr size_t MAX_READ_SIZE = 0x400000;
+
+  DEBUG_LOG_FMT(DISCIO, "{}", file.export_path);
+
+  if (File::Exists(file.export_path))
+    NOTICE_LOG_FMT(DISCIO, "{} already exists", file.export_path);
+  else if (!ExportData(volume, partition, file.offset, file.size, file.export_path, buffer,
+                       MAX_READ_SIZE))
+  {
+    ERROR_LOG_FMT(DISCIO, "Could not export {}", file.export_path);
+  }
+}
+
+void ExportDirectory(const Volume& volume, const Partition& partition, const FileInfo& directory,
+                     bool recursive, const std::string& filesystem_path,
+                     const std::string& export_folder,
+                     const std::function<bool(const std::string& path)>& update_progress)
+{
+  std::vector<FileToExport> files;
+  if (!CollectFilesToExport(directory, recursive, filesystem_path, export_folder, update_progress,
+                            &files))
+  {
+    return;
+  }
+
+  // Extract in disc order, so that the reads are close to sequential even when several threads
+  // are working on neighbouring files.
+  std::ranges::stable_sort(files, {}, &FileToExport::offset);
+
+  // Each thread gets its own copy of the volume, so that decryption and decompression of Wii
+  // and WIA/RVZ data can happen in parallel. Volumes are not thread-safe, so the volume we were
+  // given is only used when no copy can be made.
+  const size_t max_threads = std::min<size_t>(Common::GetTaskThreadBudget(), 4);
+  std::vector<std::unique_ptr<Volume>> volumes;
+  while (volumes.size() < std::min(max_threads, files.size()))
+  {
+    std::unique_ptr<BlobReader> reader = volume.GetBlobReader().CopyReader();
+    std::unique_ptr<Volume> copy = reader ? CreateVolume(std::move(reader)) : nullptr;
+    if (!copy)
+      break;
+    volumes.push_back(std::move(copy));
+  }
+
+  if (volumes.size() <= 1)
+  {
+    std::vector<u8> buffer;
+    for (const FileToExport& file : files)
     {
-      ExportDirectory(volume, partition, file_info, recursive, filesystem_path, export_root,
-                      update_progress);
+      if (update_progress(file.path))
+        return;
+      ExportFileToPath(volumes.empty() ? volume : *volumes[0], partition, file, &buffer);
     }
+    return;
   }
+
+  // The tasks report finished files back to this thread, which is the only one calling
+  // update_progress.
+  std::atomic<size_t> next_file = 0;
+  std::atomic<bool> cancelled = false;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<size_t> finished_files;
+  size_t running_tasks = volumes.size();
+
+  Common::TaskGroup tasks(Common::TaskPriority::Background);
+  for (const std::unique_ptr<Volume>& worker_volume : volumes)
+  {
+    tasks.Run([&, worker_volume = worker_volume.get()] {
+      std::vector<u8> buffer;
+      size_t i;
+      while (!cancelled && (i = next_file++) < files.size())
+      {
+        ExportFileToPath(*worker_volume, partition, files[i], &buffer);
+
+        std::lock_guard lk(mutex);
+        finished_files.push_back(i);
+        cv.notify_one();
+      }
+
+      std::lock_guard lk(mutex);
+      --running_tasks;
+      cv.notify_one();
+    });
+  }
+
+  std::vector<size_t> reported_files;
+  std::unique_lock lk(mutex);
+  while (true)
+  {
+    cv.wait(lk, [&] { return !finished_files.empty() || running_tasks == 0; });
+    if (finished_files.empty())
+      break;
+
+    std::swap(reported_files, finished_files);
+    lk.unlock();
+    for (const size_t i : reported_files)
+    {
+      if (!cancelled && update_progress(files[i].path))
+        cancelled = true;
+    }
+    reported_files.clear();
+    lk.lock();
+  }
+  lk.unlock();
+
+  tasks.Wait();
 }
 
 bool ExportWiiUnencryptedHeader(const Volume& volume, const std::string& export_filename)
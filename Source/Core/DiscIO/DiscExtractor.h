@@ -27,9 +27,11 @@ bool ExportFile(const Volume& volume, const Partition& partition, const FileInfo
 bool ExportFile(const Volume& volume, const Partition& partition, std::string_view path,
                 const std::string& export_filename);
 
-// update_progress is called once for each child (file or directory).
-// If update_progress returns true, the extraction gets cancelled.
+// update_progress is called once for each child (file or directory), always on the calling
+// thread. If update_progress returns true, the extraction gets cancelled.
 // filesystem_path is supposed to be the path corresponding to the directory argument.
+// Directories are created first. Files are then extracted in disc order using several threads,
+// with update_progress being called as each file finishes.
 void ExportDirectory(const Volume& volume, const Partition& partition, const FileInfo& directory,
                      bool recursive, const std::string& filesystem_path,
                      const std::string& export_folder,
@@ -46,6 +46,33 @@ bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   }
 }
 
+bool PlainFileReader::ReadMultiple(std::span<const ReadRange> ranges)
+{
+  const std::vector<const ReadRange*> sorted_ranges = SortReadRanges(ranges);
+
+  // Ranges which are adjacent both in the file and in memory are merged into one read.
+  for (size_t i = 0; i < sorted_ranges.size();)
+  {
+    const ReadRange& first = *sorted_ranges[i];
+    u64 size = first.size;
+    for (++i; i < sorted_ranges.size(); ++i)
+    {
+      const ReadRange& next = *sorted_ranges[i];
+      if (next.offset != first.offset + size || next.out_ptr != first.out_ptr + size)
+        break;
+      size += next.size;
+    }
+
+    if (!m_file.ReadAt(first.offset, first.out_ptr, size))
+    {
+      m_file.ClearError();
+      return false;
+    }
+  }
+
+  return true;
+}
+
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, const CompressCB& callback)
 {
@@ -31,6 +31,7 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  bool ReadMultiple(std::span<const ReadRange> ranges) override;
 
 private:
   PlainFileReader(File::IOFile file);
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -14,6 +15,8 @@
 #include "Common/Assert.h"
 #include "Common/Event.h"
 #include "Common/Result.h"
+#include "Common/Semaphore.h"
+#include "Common/TaskScheduler.h"
 
 namespace DiscIO
 {
@@ -29,6 +32,17 @@ enum class ConversionResultCode
 template <typename T>
 using ConversionResult = Common::Result<ConversionResultCode, T>;
 
+// Limits the number of blocks being compressed at once across all MultithreadedCompressors in the
+// process, so that running several conversions in parallel doesn't oversubscribe the CPU. While
+// one conversion is waiting for I/O, the others get to use the cores. Like the shared tasks, the
+// slots leave the emulation threads their cores.
+inline Common::Semaphore& GetCompressionSlots()
+{
+  static const int slots = static_cast<int>(Common::GetTaskThreadBudget());
+  static Common::Semaphore semaphore(slots, slots);
+  return semaphore;
+}
+
 // This class starts a number of compression threads and one output thread.
 // The set_up_compress_thread_state function is called at the start of each compression thread.
 // When CompressAndWrite is called, the compress function will be called on one of the
@@ -48,7 +62,7 @@ public:
       std::function<ConversionResultCode(OutputParameters)> output)
       : m_set_up_compress_thread_state(std::move(set_up_compress_thread_state)),
         m_compress(std::move(compress)), m_output(std::move(output)),
-        m_threads(std::max<unsigned int>(1, std::thread::hardware_concurrency()))
+        m_threads(Common::GetTaskThreadBudget())
   {
     m_compress_threads = std::make_unique<CompressThread[]>(m_threads);
 
@@ -156,8 +170,10 @@ private:
       state->compress_done_event.Reset();
       state->compress_ready_event.Set();
 
+      GetCompressionSlots().Wait();
       ConversionResult<OutputParameters> result =
           m_compress(&compress_thread_state, std::move(parameters));
+      GetCompressionSlots().Post();
 
       if (result)
       {
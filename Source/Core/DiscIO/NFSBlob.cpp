@@ -21,6 +21,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/TaskScheduler.h"
 
 namespace DiscIO
 {
@@ -202,7 +203,7 @@ u64 NFSFileReader::ToPhysicalBlockIndex(u64 logical_block_index) const
   return std::numeric_limits<u64>::max();
 }
 
-bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index)
+bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index, u8* out_ptr)
 {
   constexpr u64 BLOCKS_PER_FILE = MAX_FILE_SIZE / BLOCK_SIZE;
 
@@ -220,15 +221,13 @@ bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index)
     File::IOFile& file_1 = m_files[file_index];
     File::IOFile& file_2 = m_files[file_index + 1];
 
-    if (!file_1.Seek(sizeof(NFSHeader) + block_in_file * BLOCK_SIZE, File::SeekOrigin::Begin) ||
-        !file_1.ReadBytes(m_current_block_encrypted.data(), PART_1_SIZE))
+    if (!file_1.ReadAt(sizeof(NFSHeader) + block_in_file * BLOCK_SIZE, out_ptr, PART_1_SIZE))
     {
       file_1.ClearError();
       return false;
     }
 
-    if (!file_2.Seek(0, File::SeekOrigin::Begin) ||
-        !file_2.ReadBytes(m_current_block_encrypted.data() + PART_1_SIZE, PART_2_SIZE))
+    if (!file_2.ReadAt(0, out_ptr + PART_1_SIZE, PART_2_SIZE))
     {
       file_2.ClearError();
       return false;
@@ -240,8 +239,7 @@ bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index)
 
     File::IOFile& file = m_files[file_index];
 
-    if (!file.Seek(sizeof(NFSHeader) + block_in_file * BLOCK_SIZE, File::SeekOrigin::Begin) ||
-        !file.ReadBytes(m_current_block_encrypted.data(), BLOCK_SIZE))
+    if (!file.ReadAt(sizeof(NFSHeader) + block_in_file * BLOCK_SIZE, out_ptr, BLOCK_SIZE))
     {
       file.ClearError();
       return false;
@@ -251,38 +249,50 @@ bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index)
   return true;
 }
 
-void NFSFileReader::DecryptBlock(u64 logical_block_index)
+void NFSFileReader::DecryptBlock(u64 logical_block_index, const u8* in_ptr, u8* out_ptr) const
 {
   std::array<u8, 16> iv{};
   const u64 swapped_block_index = Common::swap64(logical_block_index);
   std::memcpy(iv.data() + iv.size() - sizeof(swapped_block_index), &swapped_block_index,
               sizeof(swapped_block_index));
 
-  m_aes_context->Crypt(iv.data(), m_current_block_encrypted.data(),
-                       m_current_block_decrypted.data(), BLOCK_SIZE);
+  m_aes_context->Crypt(iv.data(), in_ptr, out_ptr, BLOCK_SIZE);
 }
 
-bool NFSFileReader::ReadAndDecryptBlock(u64 logical_block_index)
+bool NFSFileReader::ReadAndDecryptBlocks(u64 first_logical_block_index, u64 count)
 {
-  const u64 physical_block_index = ToPhysicalBlockIndex(logical_block_index);
-
-  if (physical_block_index == std::numeric_limits<u64>::max())
-  {
-    // The block isn't physically present. Treat its contents as all zeroes.
-    m_current_block_decrypted.fill(0);
-  }
-  else
+  m_first_cached_block_index = std::numeric_limits<u64>::max();
+  m_cached_block_count = 0;
+  m_blocks_encrypted.resize(count * BLOCK_SIZE);
+  m_blocks_decrypted.resize(count * BLOCK_SIZE);
+
+  // Blocks which aren't physically present are treated as all zeroes.
+  std::vector<bool> present(count);
+  for (u64 i = 0; i < count; ++i)
   {
-    if (!ReadEncryptedBlock(physical_block_index))
+    const u64 physical_block_index = ToPhysicalBlockIndex(first_logical_block_index + i);
+    present[i] = physical_block_index != std::numeric_limits<u64>::max();
+    if (!present[i])
+      continue;
+    if (!ReadEncryptedBlock(physical_block_index, &m_blocks_encrypted[i * BLOCK_SIZE]))
       return false;
-
-    DecryptBlock(logical_block_index);
   }
 
+  // Each block has its own IV, so they can all be decrypted at the same time.
+  Common::ParallelFor(Common::TaskPriority::FrameBound, count, [&](size_t i) {
+    u8* out_ptr = &m_blocks_decrypted[i * BLOCK_SIZE];
+    if (present[i])
+      DecryptBlock(first_logical_block_index + i, &m_blocks_encrypted[i * BLOCK_SIZE], out_ptr);
+    else
+      std::fill_n(out_ptr, BLOCK_SIZE, 0);
+  });
+
   // Small hack: Set 0x61 of the header to 1 so that VolumeWii realizes that the disc is unencrypted
-  if (logical_block_index == 0)
-    m_current_block_decrypted[0x61] = 1;
+  if (first_logical_block_index == 0)
+    m_blocks_decrypted[0x61] = 1;
 
+  m_first_cached_block_index = first_logical_block_index;
+  m_cached_block_count = count;
   return true;
 }
 
@@ -293,16 +303,24 @@ bool NFSFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
     const u64 logical_block_index = offset / BLOCK_SIZE;
     const u64 offset_in_block = offset % BLOCK_SIZE;
 
-    if (logical_block_index != m_current_logical_block_index)
+    if (logical_block_index < m_first_cached_block_index ||
+        logical_block_index >= m_first_cached_block_index + m_cached_block_count)
     {
-      if (!ReadAndDecryptBlock(logical_block_index))
-        return false;
+      const u64 last_block_index = (offset + nbytes - 1) / BLOCK_SIZE;
+      u64 count = last_block_index - logical_block_index + 1;
+      if (logical_block_index == m_first_cached_block_index + m_cached_block_count)
+        count += READ_AHEAD_BLOCKS;
+      count = std::min(count, MAX_CACHED_BLOCKS);
 
-      m_current_logical_block_index = logical_block_index;
+      if (!ReadAndDecryptBlocks(logical_block_index, count))
+        return false;
     }
 
-    const u64 bytes_to_copy = std::min(nbytes, BLOCK_SIZE - offset_in_block);
-    std::memcpy(out_ptr, m_current_block_decrypted.data() + offset_in_block, bytes_to_copy);
+    const u64 offset_in_cache =
+        (logical_block_index - m_first_cached_block_index) * BLOCK_SIZE + offset_in_block;
+    const u64 bytes_to_copy =
+        std::min(nbytes, m_cached_block_count * BLOCK_SIZE - offset_in_cache);
+    std::memcpy(out_ptr, m_blocks_decrypted.data() + offset_in_cache, bytes_to_copy);
 
     offset += bytes_to_copy;
     nbytes -= bytes_to_copy;
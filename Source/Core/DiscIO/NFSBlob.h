@@ -62,6 +62,10 @@ private:
   using Key = std::array<u8, Common::AES::Context::KEY_SIZE>;
   static constexpr u32 BLOCK_SIZE = 0x8000;
   static constexpr u32 MAX_FILE_SIZE = 0xFA00000;
+  // Reads which continue where the previous one ended also load this many blocks after them.
+  static constexpr u64 READ_AHEAD_BLOCKS = 16;
+  // The most blocks which are kept decrypted at once.
+  static constexpr u64 MAX_CACHED_BLOCKS = 64;
 
   static bool ReadKey(const std::string& path, const std::string& directory, Key* key_out);
   static std::vector<NFSLBARange> GetLBARanges(const NFSHeader& header);
@@ -74,13 +78,16 @@ private:
                 u64 raw_size);
 
   u64 ToPhysicalBlockIndex(u64 logical_block_index) const;
-  bool ReadEncryptedBlock(u64 physical_block_index);
-  void DecryptBlock(u64 logical_block_index);
-  bool ReadAndDecryptBlock(u64 logical_block_index);
-
-  std::array<u8, BLOCK_SIZE> m_current_block_encrypted;
-  std::array<u8, BLOCK_SIZE> m_current_block_decrypted;
-  u64 m_current_logical_block_index = std::numeric_limits<u64>::max();
+  bool ReadEncryptedBlock(u64 physical_block_index, u8* out_ptr);
+  void DecryptBlock(u64 logical_block_index, const u8* in_ptr, u8* out_ptr) const;
+  // Replaces the cached blocks with count blocks starting at first_logical_block_index.
+  bool ReadAndDecryptBlocks(u64 first_logical_block_index, u64 count);
+
+  // The blocks are read from the files on the calling thread, and then decrypted in parallel.
+  std::vector<u8> m_blocks_encrypted;
+  std::vector<u8> m_blocks_decrypted;
+  u64 m_first_cached_block_index = std::numeric_limits<u64>::max();
+  u64 m_cached_block_count = 0;
 
   std::vector<NFSLBARange> m_lba_ranges;
   std::vector<File::IOFile> m_files;
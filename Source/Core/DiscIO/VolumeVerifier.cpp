@@ -36,6 +36,7 @@
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/TaskScheduler.h"
 #include "Common/Version.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/ES/ES.h"
@@ -1240,14 +1241,33 @@ void VolumeVerifier::Process()
     m_group_future = std::async(std::launch::async, [this, read_failed,
                                                      group_index = m_group_index] {
       const GroupToVerify& group = m_groups[group_index];
+      const size_t num_blocks = group.block_index_end - group.block_index_start;
+
+      // Decrypting and hashing the blocks is what this verification spends most of its time on,
+      // and the blocks are independent of each other, so spread them over several threads.
+      std::vector<u8> blocks_valid(num_blocks);
+      const auto check_block = [&](size_t i) {
+        blocks_valid[i] = !read_failed && m_volume.CheckBlockIntegrity(
+                                              group.block_index_start + i,
+                                              m_data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                              group.partition);
+      };
+
+      // The first block is checked on its own first so that the lazily loaded partition key and
+      // H3 table are loaded before other threads try to use them.
+      if (num_blocks != 0)
+        check_block(0);
+
+      const size_t remaining_blocks = num_blocks - std::min<size_t>(num_blocks, 1);
+      Common::ParallelFor(Common::TaskPriority::Background, remaining_blocks,
+                          [&](size_t i) { check_block(i + 1); });
+
       u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
+      for (size_t i = 0; i < num_blocks; ++i, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
       {
         const u64 block_offset = group.offset + offset_in_group;
 
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
+        if (blocks_valid[i])
         {
           m_biggest_verified_offset =
               std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
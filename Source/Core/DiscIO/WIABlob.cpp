@@ -85,7 +85,10 @@ WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& pa
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  m_prefetch_thread.StopAndCancel();
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -149,6 +152,9 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
     return false;
   }
 
+  m_chunk_cache.resize(std::clamp<size_t>(CHUNK_CACHE_MEMORY / (u64{chunk_size} * 2),
+                                          MIN_CACHED_CHUNKS, MAX_CACHED_CHUNKS));
+
   const u32 compression_type = Common::swap32(m_header_2.compression_type);
   m_compression_type = static_cast<WIARVZCompressionType>(compression_type);
   if (m_compression_type > (RVZ ? WIARVZCompressionType::Zstd : WIARVZCompressionType::LZMA2) ||
@@ -158,6 +164,29 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
     return false;
   }
 
+  if (RVZ && m_compression_type == WIARVZCompressionType::Zstd &&
+      m_header_2.compressor_data_size != 0)
+  {
+    u32 dictionary_size;
+    if (m_header_2.compressor_data_size != sizeof(dictionary_size))
+      return false;
+    std::memcpy(&dictionary_size, m_header_2.compressor_data, sizeof(dictionary_size));
+
+    std::vector<u8> dictionary(Common::swap32(dictionary_size));
+    if (!m_file.Seek(sizeof(WIAHeader1) + header_2_size, File::SeekOrigin::Begin) ||
+        !m_file.ReadBytes(dictionary.data(), dictionary.size()))
+    {
+      return false;
+    }
+
+    m_zstd_dictionary = CreateZstdDecompressionDictionary(dictionary);
+    if (!m_zstd_dictionary)
+    {
+      ERROR_LOG_FMT(DISCIO, "Invalid Zstandard dictionary in {}", path);
+      return false;
+    }
+  }
+
   const size_t number_of_partition_entries = Common::swap32(m_header_2.number_of_partition_entries);
   const size_t partition_entry_size = Common::swap32(m_header_2.partition_entry_size);
   std::vector<u8> partition_entries(partition_entry_size * number_of_partition_entries);
@@ -514,19 +543,10 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
-
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
 
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
+    WIARVZCompressionType compression_type;
+    u32 rvz_packed_size;
+    const u32 group_data_size = GetGroupDataSize(group, &compression_type, &rvz_packed_size);
 
     if (group_data_size == 0)
     {
@@ -542,7 +562,7 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        InvalidateCachedChunk(group_offset_in_file);
         return false;
       }
 
@@ -557,6 +577,15 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
       }
     }
 
+    const u64 next_group_offset_in_data = group_offset_in_data + chunk_size;
+    if (total_group_index == m_last_read_group_index + 1 && i + 1 < number_of_groups &&
+        next_group_offset_in_data < data_size)
+    {
+      PrefetchGroup(total_group_index + 1, next_group_offset_in_data,
+                    std::min(chunk_size, data_size - next_group_offset_in_data), exception_lists);
+    }
+    m_last_read_group_index = total_group_index;
+
     *offset += bytes_to_read;
     *size -= bytes_to_read;
     *out_ptr += bytes_to_read;
@@ -565,6 +594,28 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   return true;
 }
 
+template <bool RVZ>
+u32 WIARVZFileReader<RVZ>::GetGroupDataSize(const GroupEntry& group,
+                                            WIARVZCompressionType* compression_type,
+                                            u32* rvz_packed_size) const
+{
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  *compression_type = m_compression_type;
+  *rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      *compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    *rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  return group_data_size;
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
@@ -572,9 +623,43 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  CachedChunk* least_recently_used = &m_chunk_cache.front();
+  for (CachedChunk& cached_chunk : m_chunk_cache)
+  {
+    if (cached_chunk.offset_in_file == offset_in_file)
+    {
+      cached_chunk.last_use = ++m_chunk_cache_use_counter;
+      return cached_chunk.chunk;
+    }
 
+    if (cached_chunk.last_use < least_recently_used->last_use)
+      least_recently_used = &cached_chunk;
+  }
+
+  std::optional<Chunk> prefetched_chunk = TakePrefetchedChunk(offset_in_file);
+  if (prefetched_chunk)
+  {
+    least_recently_used->chunk = std::move(*prefetched_chunk);
+    least_recently_used->chunk.SetFile(&m_file);
+  }
+  else
+  {
+    least_recently_used->chunk =
+        CreateChunk(&m_file, offset_in_file, compressed_size, decompressed_size, compression_type,
+                    exception_lists, rvz_packed_size, data_offset);
+  }
+
+  least_recently_used->offset_in_file = offset_in_file;
+  least_recently_used->last_use = ++m_chunk_cache_use_counter;
+  return least_recently_used->chunk;
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
+                                   u64 decompressed_size, WIARVZCompressionType compression_type,
+                                   u32 exception_lists, u32 rvz_packed_size, u64 data_offset) const
+{
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
   {
@@ -597,17 +682,106 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                                       m_header_2.compressor_data_size);
     break;
   case WIARVZCompressionType::Zstd:
-    decompressor = std::make_unique<ZstdDecompressor>();
+    decompressor = std::make_unique<ZstdDecompressor>(m_zstd_dictionary.get());
     break;
   }
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(file, offset_in_file, compressed_size, decompressed_size, exception_lists,
+               compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InvalidateCachedChunk(u64 offset_in_file)
+{
+  for (CachedChunk& cached_chunk : m_chunk_cache)
+  {
+    if (cached_chunk.offset_in_file == offset_in_file)
+      cached_chunk = CachedChunk{};
+  }
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchGroup(u64 total_group_index, u64 group_offset_in_data,
+                                          u64 chunk_size, u32 exception_lists)
+{
+  if (total_group_index >= m_group_entries.size())
+    return;
+
+  WIARVZCompressionType compression_type;
+  u32 rvz_packed_size;
+  const GroupEntry& group = m_group_entries[total_group_index];
+  const u32 group_data_size = GetGroupDataSize(group, &compression_type, &rvz_packed_size);
+  if (group_data_size == 0)
+    return;
+
+  const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+  if (std::ranges::any_of(m_chunk_cache, [&](const CachedChunk& cached_chunk) {
+        return cached_chunk.offset_in_file == group_offset_in_file;
+      }))
+  {
+    return;
+  }
+
+  if (!m_prefetch_file.IsOpen())
+  {
+    m_prefetch_file = m_file.Duplicate("rb");
+    if (!m_prefetch_file.IsOpen())
+      return;
+
+    m_prefetch_thread.Reset("WIA/RVZ Read-Ahead", [this](PrefetchedChunk* prefetched_chunk) {
+      const bool success = prefetched_chunk->chunk.DecompressAll();
+      {
+        std::lock_guard lk(m_prefetch_mutex);
+        prefetched_chunk->done = true;
+        prefetched_chunk->success = success;
+      }
+      m_prefetch_cv.notify_all();
+    });
+  }
+
+  {
+    std::lock_guard lk(m_prefetch_mutex);
+    if (m_prefetched_chunks.contains(group_offset_in_file))
+      return;
+
+    // Chunks which were decompressed but never read are from an earlier sequential read.
+    if (m_prefetched_chunks.size() >= MAX_PREFETCHED_CHUNKS)
+      std::erase_if(m_prefetched_chunks, [](const auto& pair) { return pair.second.done; });
+    if (m_prefetched_chunks.size() >= MAX_PREFETCHED_CHUNKS)
+      return;
+  }
+
+  Chunk chunk = CreateChunk(&m_prefetch_file, group_offset_in_file, group_data_size, chunk_size,
+                            compression_type, exception_lists, rvz_packed_size,
+                            group_offset_in_data);
+
+  // The thread doesn't touch the map, and nodes of an std::map are never moved, so the pointer
+  // stays valid until we erase the entry after it's done.
+  std::lock_guard lk(m_prefetch_mutex);
+  PrefetchedChunk& prefetched_chunk = m_prefetched_chunks[group_offset_in_file];
+  prefetched_chunk.chunk = std::move(chunk);
+  m_prefetch_thread.Push(&prefetched_chunk);
+}
+
+template <bool RVZ>
+std::optional<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::TakePrefetchedChunk(u64 offset_in_file)
+{
+  std::unique_lock lk(m_prefetch_mutex);
+  const auto it = m_prefetched_chunks.find(offset_in_file);
+  if (it == m_prefetched_chunks.end())
+    return std::nullopt;
+
+  // Waiting is never slower than decompressing the chunk again ourselves.
+  m_prefetch_cv.wait(lk, [&] { return it->second.done; });
+
+  std::optional<Chunk> chunk;
+  if (it->second.success)
+    chunk = std::move(it->second.chunk);
+  m_prefetched_chunks.erase(it);
+  return chunk;
 }
 
 template <bool RVZ>
@@ -651,16 +825,35 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::IOFile* file, u64 offset_in_file, u64
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 {
-  if (!m_decompressor || !m_file ||
-      offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
-  {
+  if (!m_decompressor || !m_file || offset + size > GetDecompressedSize())
     return false;
-  }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  if (!DecompressUntil(offset + size))
+    return false;
+
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  return m_decompressor && m_file && DecompressUntil(GetDecompressedSize());
+}
+
+template <bool RVZ>
+size_t WIARVZFileReader<RVZ>::Chunk::GetDecompressedSize() const
+{
+  return m_out.data.size() - m_out_bytes_allocated_for_exceptions;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUntil(u64 end_offset)
+{
+  while (end_offset > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end_offset == GetDecompressedSize())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -673,7 +866,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end_offset - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -753,7 +946,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1067,7 +1259,8 @@ std::optional<std::vector<u8>> WIARVZFileReader<RVZ>::Compress(Compressor* compr
 template <bool RVZ>
 void WIARVZFileReader<RVZ>::SetUpCompressor(std::unique_ptr<Compressor>* compressor,
                                             WIARVZCompressionType compression_type,
-                                            int compression_level, WIAHeader2* header_2)
+                                            int compression_level, WIAHeader2* header_2,
+                                            std::span<const u8> zstd_dictionary)
 {
   switch (compression_type)
   {
@@ -1098,11 +1291,96 @@ void WIARVZFileReader<RVZ>::SetUpCompressor(std::unique_ptr<Compressor>* compres
     break;
   }
   case WIARVZCompressionType::Zstd:
-    *compressor = std::make_unique<ZstdCompressor>(compression_level);
+    *compressor = std::make_unique<ZstdCompressor>(compression_level, zstd_dictionary);
     break;
   }
 }
 
+template <bool RVZ>
+std::vector<u8> WIARVZFileReader<RVZ>::CreateZstdDictionary(BlobReader* infile,
+                                                            const VolumeDisc* infile_volume,
+                                                            int chunk_size)
+{
+  // Sample the files of the game partition rather than the raw disc, since that's the data that
+  // actually ends up getting compressed. (Wii partitions are encrypted on the disc, and padding
+  // is mostly made out of junk data, which RVZ stores separately.)
+  struct SampleSource
+  {
+    u64 offset;
+    u64 size;
+  };
+  std::vector<SampleSource> sources;
+  u64 total_size = 0;
+
+  const Partition partition = infile_volume ? infile_volume->GetGamePartition() : PARTITION_NONE;
+  const FileSystem* file_system =
+      infile_volume ? infile_volume->GetFileSystem(partition) : nullptr;
+  if (file_system && file_system->IsValid())
+  {
+    const auto add_files = [&](const auto& self, const FileInfo& directory) -> void {
+      for (const FileInfo& file_info : directory)
+      {
+        if (file_info.IsDirectory())
+        {
+          self(self, file_info);
+        }
+        else if (file_info.GetSize() != 0)
+        {
+          sources.push_back({file_info.GetOffset(), file_info.GetSize()});
+          total_size += file_info.GetSize();
+        }
+      }
+    };
+    add_files(add_files, file_system->GetRoot());
+  }
+
+  const bool read_from_volume = total_size != 0;
+  if (!read_from_volume)
+  {
+    total_size = infile->GetDataSize();
+    sources.push_back({0, total_size});
+  }
+
+  const u64 sample_size = std::min<u64>(chunk_size, ZSTD_DICTIONARY_MAX_SAMPLE_SIZE);
+  const u64 number_of_samples = ZSTD_DICTIONARY_SAMPLES_SIZE / sample_size;
+
+  std::vector<u8> samples(ZSTD_DICTIONARY_SAMPLES_SIZE);
+  std::vector<size_t> sample_sizes;
+  size_t samples_size = 0;
+  auto source = sources.begin();
+  u64 source_start = 0;
+  for (u64 i = 0; i < number_of_samples; ++i)
+  {
+    // Spread the samples evenly over the data
+    const u64 position = total_size * i / number_of_samples;
+    while (position >= source_start + source->size)
+    {
+      source_start += source->size;
+      ++source;
+    }
+
+    const u64 offset_in_source = position - source_start;
+    const u64 size = std::min(sample_size, source->size - offset_in_source);
+    u8* out_ptr = samples.data() + samples_size;
+    const bool success =
+        read_from_volume ?
+            infile_volume->Read(source->offset + offset_in_source, size, out_ptr, partition) :
+            infile->Read(source->offset + offset_in_source, size, out_ptr);
+    if (!success)
+      continue;
+
+    samples_size += size;
+    sample_sizes.push_back(size);
+  }
+
+  std::vector<u8> dictionary =
+      TrainZstdDictionary(std::span(samples.data(), samples_size), sample_sizes,
+                          ZSTD_DICTIONARY_MAX_SIZE);
+  if (dictionary.empty())
+    WARN_LOG_FMT(DISCIO, "Failed to train a Zstandard dictionary, not using one");
+  return dictionary;
+}
+
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::TryReuse(std::map<ReuseID, GroupEntry>* reusable_groups,
                                      std::mutex* reusable_groups_mutex,
@@ -1741,7 +2019,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, bool zstd_dictionary,
+                               CompressCB callback)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1777,6 +2056,10 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 
   group_entries.resize(total_groups);
 
+  std::vector<u8> dictionary;
+  if (RVZ && zstd_dictionary && compression_type == WIARVZCompressionType::Zstd)
+    dictionary = CreateZstdDictionary(infile, infile_volume, chunk_size);
+
   const size_t partition_entries_size = partition_entries.size() * sizeof(PartitionEntry);
   const size_t raw_data_entries_size = raw_data_entries.size() * sizeof(RawDataEntry);
   const size_t group_entries_size = group_entries.size() * sizeof(GroupEntry);
@@ -1786,7 +2069,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   // fit in that space, we will need to write them at the end of the file instead.
   const u64 headers_size_upper_bound = [&] {
     // 0x100 is added to account for compression overhead (in particular for Purge).
-    u64 upper_bound = sizeof(WIAHeader1) + sizeof(WIAHeader2) + partition_entries_size +
+    u64 upper_bound = sizeof(WIAHeader1) + sizeof(WIAHeader2) +
+                      Common::AlignUp(dictionary.size(), 4) + partition_entries_size +
                       raw_data_entries_size + 0x100;
 
     // Compared to WIA, RVZ adds an extra member to the GroupEntry struct. This added data usually
@@ -1817,7 +2101,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   std::mutex reusable_groups_mutex;
 
   const auto set_up_compress_thread_state = [&](CompressThreadState* state) {
-    SetUpCompressor(&state->compressor, compression_type, compression_level, nullptr);
+    SetUpCompressor(&state->compressor, compression_type, compression_level, nullptr, dictionary);
     return ConversionResultCode::Success;
   };
 
@@ -1946,7 +2230,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
     return status;
 
   std::unique_ptr<Compressor> compressor;
-  SetUpCompressor(&compressor, compression_type, compression_level, &header_2);
+  SetUpCompressor(&compressor, compression_type, compression_level, &header_2, dictionary);
 
   const std::optional<std::vector<u8>> compressed_raw_data_entries = Compress(
       compressor.get(), reinterpret_cast<u8*>(raw_data_entries.data()), raw_data_entries_size);
@@ -1962,6 +2246,20 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   if (!outfile->Seek(sizeof(WIAHeader1) + sizeof(WIAHeader2), File::SeekOrigin::Begin))
     return ConversionResultCode::WriteFailed;
 
+  // The dictionary has to be directly after header 2. It always fits in the reserved space.
+  if (!dictionary.empty())
+  {
+    if (!outfile->WriteBytes(dictionary.data(), dictionary.size()))
+      return ConversionResultCode::WriteFailed;
+    bytes_written += dictionary.size();
+    if (!PadTo4(outfile, &bytes_written))
+      return ConversionResultCode::WriteFailed;
+
+    const u32 dictionary_size = Common::swap32(static_cast<u32>(dictionary.size()));
+    header_2.compressor_data_size = sizeof(dictionary_size);
+    std::memcpy(header_2.compressor_data, &dictionary_size, sizeof(dictionary_size));
+  }
+
   u64 partition_entries_offset;
   if (!WriteHeader(outfile, reinterpret_cast<u8*>(partition_entries.data()), partition_entries_size,
                    headers_size_upper_bound, &bytes_written, &partition_entries_offset))
@@ -2016,8 +2314,12 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 
   header_1.magic = RVZ ? RVZ_MAGIC : WIA_MAGIC;
   header_1.version = Common::swap32(RVZ ? RVZ_VERSION : WIA_VERSION);
-  header_1.version_compatible =
-      Common::swap32(RVZ ? RVZ_VERSION_WRITE_COMPATIBLE : WIA_VERSION_WRITE_COMPATIBLE);
+  if (!RVZ)
+    header_1.version_compatible = Common::swap32(WIA_VERSION_WRITE_COMPATIBLE);
+  else if (dictionary.empty())
+    header_1.version_compatible = Common::swap32(RVZ_VERSION_WRITE_COMPATIBLE);
+  else
+    header_1.version_compatible = Common::swap32(RVZ_VERSION_WRITE_COMPATIBLE_ZSTD_DICTIONARY);
   header_1.header_2_size = Common::swap32(sizeof(WIAHeader2));
   header_1.header_2_hash =
       Common::SHA1::CalculateDigest(reinterpret_cast<const u8*>(&header_2), sizeof(header_2));
@@ -2040,7 +2342,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, const CompressCB& callback)
+                       int chunk_size, const CompressCB& callback, bool zstd_dictionary)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2058,7 +2360,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, zstd_dictionary, callback);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
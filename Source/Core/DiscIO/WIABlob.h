@@ -4,17 +4,22 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -69,7 +74,8 @@ public:
 
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, bool zstd_dictionary,
+                                      CompressCB callback);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -194,6 +200,12 @@ private:
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
 
+    // Decompresses the whole chunk, so that later reads don't need to access the file.
+    bool DecompressAll();
+
+    // The file can be changed when another thread has decompressed the chunk.
+    void SetFile(File::IOFile* file) { m_file = file; }
+
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
                            u64 exception_list_index, u16 additional_offset) const;
@@ -205,11 +217,13 @@ private:
     }
 
   private:
+    bool DecompressUntil(u64 end_offset);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
 
     size_t GetOutBytesWrittenExcludingExceptions() const;
+    size_t GetDecompressedSize() const;
 
     DecompressionBuffer m_in;
     DecompressionBuffer m_out;
@@ -240,6 +254,19 @@ private:
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  Chunk CreateChunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
+                    u64 decompressed_size, WIARVZCompressionType compression_type,
+                    u32 exception_lists, u32 rvz_packed_size, u64 data_offset) const;
+  void InvalidateCachedChunk(u64 offset_in_file);
+
+  // Returns the size of the group's data in the file, which is 0 if the group is all zeroes.
+  u32 GetGroupDataSize(const GroupEntry& group, WIARVZCompressionType* compression_type,
+                       u32* rvz_packed_size) const;
+
+  // Starts decompressing a group on the read-ahead thread, if it isn't cached already.
+  void PrefetchGroup(u64 total_group_index, u64 group_offset_in_data, u64 chunk_size,
+                     u32 exception_lists);
+  std::optional<Chunk> TakePrefetchedChunk(u64 offset_in_file);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -342,7 +369,9 @@ private:
 
   static void SetUpCompressor(std::unique_ptr<Compressor>* compressor,
                               WIARVZCompressionType compression_type, int compression_level,
-                              WIAHeader2* header_2);
+                              WIAHeader2* header_2, std::span<const u8> zstd_dictionary);
+  static std::vector<u8> CreateZstdDictionary(BlobReader* infile, const VolumeDisc* infile_volume,
+                                              int chunk_size);
   static bool TryReuse(std::map<ReuseID, GroupEntry>* reusable_groups,
                        std::mutex* reusable_groups_mutex, OutputParametersEntry* entry);
   static ConversionResult<OutputParameters>
@@ -367,16 +396,47 @@ private:
 
   File::IOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
   WiiEncryptionCache m_encryption_cache;
 
+  // Decompressed chunks are kept around, so that alternating between a few areas of the disc
+  // (e.g. streamed audio and level data) doesn't decompress the same chunks over and over.
+  static constexpr u64 CHUNK_CACHE_MEMORY = 32 * 1024 * 1024;
+  static constexpr size_t MIN_CACHED_CHUNKS = 2;
+  static constexpr size_t MAX_CACHED_CHUNKS = 64;
+
+  struct CachedChunk
+  {
+    u64 offset_in_file = std::numeric_limits<u64>::max();
+    u64 last_use = 0;
+    Chunk chunk;
+  };
+  std::vector<CachedChunk> m_chunk_cache;
+  u64 m_chunk_cache_use_counter = 0;
+
+  // When groups are read in order, the next one is decompressed ahead of time on another thread,
+  // which reads from its own copy of the file.
+  static constexpr size_t MAX_PREFETCHED_CHUNKS = 2;
+
+  struct PrefetchedChunk
+  {
+    Chunk chunk;
+    bool done = false;
+    bool success = false;
+  };
+  u64 m_last_read_group_index = std::numeric_limits<u64>::max();
+  File::IOFile m_prefetch_file;
+  std::mutex m_prefetch_mutex;
+  std::condition_variable m_prefetch_cv;
+  std::map<u64, PrefetchedChunk> m_prefetched_chunks;
+  Common::WorkQueueThread<PrefetchedChunk*> m_prefetch_thread;
+
   std::vector<HashExceptionEntry> m_exception_list;
   bool m_write_to_exception_list = false;
   u64 m_exception_list_last_group_index;
 
   WIAHeader1 m_header_1;
   WIAHeader2 m_header_2;
+  ZstdDecompressionDictionary m_zstd_dictionary;
   std::vector<PartitionEntry> m_partition_entries;
   std::vector<RawDataEntry> m_raw_data_entries;
   std::vector<GroupEntry> m_group_entries;
@@ -391,9 +451,18 @@ private:
   static constexpr u32 WIA_VERSION_WRITE_COMPATIBLE = 0x01000000;
   static constexpr u32 WIA_VERSION_READ_COMPATIBLE = 0x00080000;
 
-  static constexpr u32 RVZ_VERSION = 0x01000000;
+  // RVZ 1.1 adds an optional Zstandard dictionary, which is stored right after header 2 and is
+  // used for all Zstandard data in the file. Its size is stored in compressor_data as a big endian
+  // u32. Files with a dictionary can't be read by older versions, so only they are marked as
+  // requiring 1.1.
+  static constexpr u32 RVZ_VERSION = 0x01010000;
   static constexpr u32 RVZ_VERSION_WRITE_COMPATIBLE = 0x00030000;
+  static constexpr u32 RVZ_VERSION_WRITE_COMPATIBLE_ZSTD_DICTIONARY = 0x01010000;
   static constexpr u32 RVZ_VERSION_READ_COMPATIBLE = 0x00030000;
+
+  static constexpr size_t ZSTD_DICTIONARY_MAX_SIZE = 0x1C000;
+  static constexpr size_t ZSTD_DICTIONARY_SAMPLES_SIZE = 8 * 1024 * 1024;
+  static constexpr u32 ZSTD_DICTIONARY_MAX_SAMPLE_SIZE = 0x10000;
 };
 
 using WIAFileReader = WIARVZFileReader<false>;
@@ -13,6 +13,7 @@
 
 #include <bzlib.h>
 #include <lzma.h>
+#include <zdict.h>
 #include <zstd.h>
 
 #include "Common/Assert.h"
@@ -256,9 +257,40 @@ bool LZMADecompressor::Decompress(const DecompressionBuffer& in, DecompressionBu
   return result == LZMA_OK || result == LZMA_STREAM_END;
 }
 
-ZstdDecompressor::ZstdDecompressor()
+ZstdDecompressionDictionary CreateZstdDecompressionDictionary(std::span<const u8> dictionary)
+{
+  // A dictionary without the magic number would be loaded as raw content, which can't be told
+  // apart from garbage, so only accept proper dictionaries.
+  if (ZDICT_getDictID(dictionary.data(), dictionary.size()) == 0)
+    return nullptr;
+
+  return ZstdDecompressionDictionary(ZSTD_createDDict(dictionary.data(), dictionary.size()));
+}
+
+std::vector<u8> TrainZstdDictionary(std::span<const u8> samples,
+                                    std::span<const size_t> sample_sizes,
+                                    size_t max_dictionary_size)
+{
+  std::vector<u8> dictionary(max_dictionary_size);
+  const size_t result =
+      ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), samples.data(),
+                            sample_sizes.data(), static_cast<unsigned int>(sample_sizes.size()));
+  if (ZDICT_isError(result))
+    return {};
+
+  dictionary.resize(result);
+  return dictionary;
+}
+
+ZstdDecompressor::ZstdDecompressor(const ZSTD_DDict* dictionary)
 {
   m_stream = ZSTD_createDStream();
+
+  if (m_stream && dictionary && ZSTD_isError(ZSTD_DCtx_refDDict(m_stream, dictionary)))
+  {
+    ZSTD_freeDStream(m_stream);
+    m_stream = nullptr;
+  }
 }
 
 ZstdDecompressor::~ZstdDecompressor()
@@ -733,12 +765,15 @@ size_t LZMACompressor::GetSize() const
   return static_cast<size_t>(m_stream.next_out - m_buffer.data());
 }
 
-ZstdCompressor::ZstdCompressor(int compression_level)
+ZstdCompressor::ZstdCompressor(int compression_level, std::span<const u8> dictionary)
 {
   m_stream = ZSTD_createCStream();
 
+  // The dictionary stays loaded when the stream is reset with ZSTD_reset_session_only.
   if (ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_compressionLevel, compression_level)) ||
-      ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_contentSizeFlag, 0)))
+      ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_contentSizeFlag, 0)) ||
+      (!dictionary.empty() &&
+       ZSTD_isError(ZSTD_CCtx_loadDictionary(m_stream, dictionary.data(), dictionary.size()))))
   {
     m_stream = nullptr;
   }
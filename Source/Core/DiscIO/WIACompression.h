@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <bzlib.h>
@@ -102,10 +103,26 @@ private:
   bool m_error_occurred = false;
 };
 
+struct ZstdDictionaryDeleter
+{
+  void operator()(ZSTD_DDict* dictionary) const { ZSTD_freeDDict(dictionary); }
+};
+using ZstdDecompressionDictionary = std::unique_ptr<ZSTD_DDict, ZstdDictionaryDeleter>;
+
+// Returns nullptr if the data isn't a valid Zstandard dictionary.
+ZstdDecompressionDictionary CreateZstdDecompressionDictionary(std::span<const u8> dictionary);
+
+// Trains a dictionary from samples of the data that is going to be compressed.
+// Returns an empty vector on failure (for instance if there's too little sample data).
+std::vector<u8> TrainZstdDictionary(std::span<const u8> samples,
+                                    std::span<const size_t> sample_sizes,
+                                    size_t max_dictionary_size);
+
 class ZstdDecompressor final : public Decompressor
 {
 public:
-  ZstdDecompressor();
+  // The dictionary must outlive the decompressor.
+  explicit ZstdDecompressor(const ZSTD_DDict* dictionary = nullptr);
   ~ZstdDecompressor() override;
 
   bool Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
@@ -228,7 +245,7 @@ private:
 class ZstdCompressor final : public Compressor
 {
 public:
-  ZstdCompressor(int compression_level);
+  ZstdCompressor(int compression_level, std::span<const u8> dictionary = {});
   ~ZstdCompressor() override;
 
   bool Start(std::optional<u64> size) override;
@@ -48,9 +48,20 @@ public:
                      const HashExceptionCallback& hash_exception_callback = {});
 
 private:
+  // Games commonly alternate between a few regions of a partition (for instance streamed audio
+  // and level data), so keeping only the last group would mean re-encrypting groups constantly.
+  static constexpr size_t NUM_CACHED_GROUPS = 4;
+
+  struct CachedGroup
+  {
+    std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> data;
+    u64 offset = std::numeric_limits<u64>::max();
+    u64 last_use = 0;
+  };
+
   BlobReader* m_blob;
-  std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> m_cache;
-  u64 m_cached_offset = 0;
+  std::array<CachedGroup, NUM_CACHED_GROUPS> m_cache;
+  u64 m_use_counter = 0;
 };
 
 }  // namespace DiscIO
@@ -0,0 +1,104 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/Benchmark.h"
+
+#include <utility>
+
+#include "Core/Core.h"
+#include "Core/HW/VideoInterface.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/System.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+Benchmark::Benchmark(u64 num_fields, std::function<void()> on_finished)
+    : m_num_fields(num_fields), m_on_finished(std::move(on_finished))
+{
+  m_vi_end_field_hook = VIEndFieldEvent::Register([this] { OnVIEndField(); }, "Benchmark");
+  m_present_hook = AfterPresentEvent::Register(
+      [this](const PresentInfo& present_info) { OnPresent(present_info); }, "Benchmark");
+}
+
+void Benchmark::OnVIEndField()
+{
+  if (IsFinished())
+    return;
+
+  if (!m_started.load(std::memory_order_relaxed))
+  {
+    // The first field marks the end of booting, which is not measured.
+    m_start_time = Clock::now();
+    m_started.store(true, std::memory_order_release);
+    return;
+  }
+
+  if (++m_fields < m_num_fields)
+    return;
+
+  m_end_time = Clock::now();
+
+  auto& system = Core::System::GetInstance();
+  const auto& video_interface = system.GetVideoInterface();
+  m_target_refresh_rate_numerator = video_interface.GetTargetRefreshRateNumerator();
+  m_target_refresh_rate_denominator = video_interface.GetTargetRefreshRateDenominator();
+  m_jit_blocks = system.GetJitInterface().GetBlockCount();
+
+  m_finished.store(true, std::memory_order_release);
+  m_on_finished();
+}
+
+void Benchmark::OnPresent(const PresentInfo& present_info)
+{
+  if (!m_started.load(std::memory_order_acquire) || IsFinished())
+    return;
+
+  m_pixel_shaders_created = g_stats.num_pixel_shaders_created;
+  m_vertex_shaders_created = g_stats.num_vertex_shaders_created;
+  m_textures_created = g_stats.num_textures_created;
+
+  if (present_info.reason == PresentInfo::PresentReason::VideoInterfaceDuplicate)
+    return;
+
+  const TimePoint now = Clock::now();
+  if (m_has_last_present_time)
+    m_frame_times.Push(now - m_last_present_time);
+  m_last_present_time = now;
+  m_has_last_present_time = true;
+}
+
+picojson::object Benchmark::GetResults() const
+{
+  const double elapsed = IsFinished() ? DT_s(m_end_time - m_start_time).count() : 0.0;
+  const double vps = elapsed > 0 ? m_fields / elapsed : 0.0;
+  const double target_vps =
+      static_cast<double>(m_target_refresh_rate_numerator) / m_target_refresh_rate_denominator;
+
+  const auto to_ms = [](DT time) { return DT_ms(time).count(); };
+  const auto to_fps = [](DT time) { return time > DT::zero() ? DT_s(1.0) / time : 0.0; };
+  const u64 frames = m_frame_times.GetCount();
+
+  picojson::object frame_time;
+  frame_time.emplace("avg", frames ? to_ms(m_frame_times.GetTotal()) / frames : 0.0);
+  frame_time.emplace("p50", to_ms(m_frame_times.GetPercentile(0.5)));
+  frame_time.emplace("p99", to_ms(m_frame_times.GetPercentile(0.99)));
+  frame_time.emplace("p99.9", to_ms(m_frame_times.GetPercentile(0.999)));
+  frame_time.emplace("max", to_ms(m_frame_times.GetMax()));
+
+  picojson::object results;
+  results.emplace("completed", IsFinished());
+  results.emplace("fields", static_cast<double>(m_fields));
+  results.emplace("elapsed_s", elapsed);
+  results.emplace("vps", vps);
+  results.emplace("speed", target_vps > 0 ? vps / target_vps : 0.0);
+  results.emplace("frames", static_cast<double>(frames));
+  results.emplace("fps", elapsed > 0 ? frames / elapsed : 0.0);
+  results.emplace("frame_time_ms", std::move(frame_time));
+  results.emplace("low_1_fps", to_fps(m_frame_times.GetPercentile(0.99)));
+  results.emplace("low_0.1_fps", to_fps(m_frame_times.GetPercentile(0.999)));
+  results.emplace("pixel_shaders_created", static_cast<double>(m_pixel_shaders_created));
+  results.emplace("vertex_shaders_created", static_cast<double>(m_vertex_shaders_created));
+  results.emplace("textures_created", static_cast<double>(m_textures_created));
+  results.emplace("jit_blocks", static_cast<double>(m_jit_blocks));
+  return results;
+}
@@ -0,0 +1,59 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+#include "VideoCommon/FrameTimeHistogram.h"
+
+struct PresentInfo;
+
+// Measures the emulation of a fixed number of VI fields for --benchmark.
+class Benchmark
+{
+public:
+  // on_finished is called on the CPU thread once num_fields fields have been emulated.
+  Benchmark(u64 num_fields, std::function<void()> on_finished);
+
+  Benchmark(const Benchmark&) = delete;
+  Benchmark& operator=(const Benchmark&) = delete;
+
+  bool IsFinished() const { return m_finished.load(std::memory_order_acquire); }
+
+  // Call after emulation has stopped.
+  picojson::object GetResults() const;
+
+private:
+  void OnVIEndField();
+  void OnPresent(const PresentInfo& present_info);
+
+  const u64 m_num_fields;
+  std::function<void()> m_on_finished;
+
+  Common::EventHook m_vi_end_field_hook;
+  Common::EventHook m_present_hook;
+
+  // Written on the CPU thread.
+  u64 m_fields = 0;
+  TimePoint m_start_time{};
+  TimePoint m_end_time{};
+  u32 m_target_refresh_rate_numerator = 0;
+  u32 m_target_refresh_rate_denominator = 1;
+  u64 m_jit_blocks = 0;
+
+  std::atomic<bool> m_started = false;
+  std::atomic<bool> m_finished = false;
+
+  // Written on the GPU thread.
+  FrameTimeHistogram m_frame_times;
+  TimePoint m_last_present_time{};
+  bool m_has_last_present_time = false;
+  int m_pixel_shaders_created = 0;
+  int m_vertex_shaders_created = 0;
+  int m_textures_created = 0;
+};
@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/FifoBenchmark.h"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+#include "Common/JsonUtil.h"
+#include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+FifoBenchmark::FifoBenchmark(std::string name) : m_name(std::move(name))
+{
+  m_frame_end_hook =
+      AfterFrameEvent::Register([this](Core::System&) { OnFrameEnd(); }, "FifoBenchmark");
+  m_present_hook = AfterPresentEvent::Register(
+      [this](const PresentInfo& present_info) { OnPresent(present_info); }, "FifoBenchmark");
+}
+
+void FifoBenchmark::OnFrameEnd()
+{
+  if (!m_started)
+    return;
+
+  // The per-frame statistics are reset before the first draw of the next frame.
+  m_draw_calls += g_stats.this_frame.num_draw_calls;
+  m_primitives += g_stats.this_frame.num_prims + g_stats.this_frame.num_dl_prims;
+  m_pipeline_misses = g_stats.num_pipeline_misses;
+  m_pixel_shaders_created = g_stats.num_pixel_shaders_created;
+  m_vertex_shaders_created = g_stats.num_vertex_shaders_created;
+}
+
+void FifoBenchmark::OnPresent(const PresentInfo& present_info)
+{
+  const TimePoint now = Clock::now();
+  if (!m_started)
+  {
+    // Loading the log happens before the first frame, which is not measured.
+    m_started = true;
+    m_start_time = now;
+    m_last_present_time = now;
+    return;
+  }
+
+  // PerformanceMetrics::CountFrame has already stored the idle time up to this present.
+  m_gpu_idle += g_perf_metrics.GetLastFrameGPUIdle();
+
+  if (present_info.reason == PresentInfo::PresentReason::VideoInterfaceDuplicate)
+    return;
+
+  m_frame_times.Push(now - m_last_present_time);
+  m_last_present_time = now;
+  ++m_frames;
+}
+
+picojson::object FifoBenchmark::GetResults() const
+{
+  const DT elapsed = m_last_present_time - m_start_time;
+  const double elapsed_s = DT_s(elapsed).count();
+  const auto to_ms = [](DT time) { return DT_ms(time).count(); };
+  const auto per_frame = [this](u64 count) {
+    return m_frames ? static_cast<double>(count) / m_frames : 0.0;
+  };
+
+  picojson::object frame_time;
+  frame_time.emplace("avg", m_frames ? to_ms(m_frame_times.GetTotal()) / m_frames : 0.0);
+  frame_time.emplace("p50", to_ms(m_frame_times.GetPercentile(0.5)));
+  frame_time.emplace("p99", to_ms(m_frame_times.GetPercentile(0.99)));
+  frame_time.emplace("max", to_ms(m_frame_times.GetMax()));
+
+  picojson::object results;
+  results.emplace("name", m_name);
+  results.emplace("elapsed_s", elapsed_s);
+  results.emplace("frames", static_cast<double>(m_frames));
+  results.emplace("fps", elapsed_s > 0 ? m_frames / elapsed_s : 0.0);
+  results.emplace("frame_time_ms", std::move(frame_time));
+  results.emplace("gpu_thread_busy_ms_per_frame",
+                  m_frames ? to_ms(std::max(elapsed - m_gpu_idle, DT::zero())) / m_frames : 0.0);
+  results.emplace("draw_calls_per_frame", per_frame(m_draw_calls));
+  results.emplace("primitives_per_frame", per_frame(m_primitives));
+  results.emplace("pipeline_misses", static_cast<double>(m_pipeline_misses));
+  results.emplace("pixel_shaders_created", static_cast<double>(m_pixel_shaders_created));
+  results.emplace("vertex_shaders_created", static_cast<double>(m_vertex_shaders_created));
+  return results;
+}
+
+void FifoBenchmark::CompareWithBaseline(picojson::array* report, const picojson::array& baseline)
+{
+  static constexpr const char* COMPARED_KEYS[] = {"fps", "gpu_thread_busy_ms_per_frame",
+                                                  "draw_calls_per_frame", "pipeline_misses"};
+
+  for (picojson::value& capture : *report)
+  {
+    picojson::object& results = capture.get<picojson::object>();
+    const std::optional<std::string> name = ReadStringFromJson(results, "name");
+
+    const auto baseline_it = std::ranges::find_if(baseline, [&](const picojson::value& value) {
+      return value.is<picojson::object>() &&
+             ReadStringFromJson(value.get<picojson::object>(), "name") == name;
+    });
+    if (baseline_it == baseline.end())
+      continue;
+    const picojson::object& baseline_results = baseline_it->get<picojson::object>();
+
+    picojson::object change_pct;
+    for (const char* key : COMPARED_KEYS)
+    {
+      const std::optional<double> value = ReadNumericFromJson<double>(results, key);
+      const std::optional<double> baseline_value =
+          ReadNumericFromJson<double>(baseline_results, key);
+      if (value && baseline_value && *baseline_value != 0)
+        change_pct.emplace(key, 100.0 * (*value - *baseline_value) / *baseline_value);
+    }
+    results.emplace("change_pct_vs_baseline", std::move(change_pct));
+  }
+}
@@ -0,0 +1,57 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+#include "VideoCommon/FrameTimeHistogram.h"
+
+namespace Core
+{
+class System;
+}
+struct PresentInfo;
+
+// Measures the replay of one FIFO log for --fifo_benchmark. Create it before booting the log and
+// read the results once emulation has stopped.
+class FifoBenchmark
+{
+public:
+  explicit FifoBenchmark(std::string name);
+
+  FifoBenchmark(const FifoBenchmark&) = delete;
+  FifoBenchmark& operator=(const FifoBenchmark&) = delete;
+
+  picojson::object GetResults() const;
+
+  // Adds the relative change of the main results to each capture in report that is also in
+  // baseline, where both are arrays returned by FifoBenchmark::GetResults.
+  static void CompareWithBaseline(picojson::array* report, const picojson::array& baseline);
+
+private:
+  void OnFrameEnd();
+  void OnPresent(const PresentInfo& present_info);
+
+  const std::string m_name;
+
+  Common::EventHook m_frame_end_hook;
+  Common::EventHook m_present_hook;
+
+  // All written on the GPU thread.
+  bool m_started = false;
+  TimePoint m_start_time{};
+  TimePoint m_last_present_time{};
+  FrameTimeHistogram m_frame_times;
+  DT m_gpu_idle{};
+  u64 m_frames = 0;
+  u64 m_draw_calls = 0;
+  u64 m_primitives = 0;
+  int m_pipeline_misses = 0;
+  int m_pixel_shaders_created = 0;
+  int m_vertex_shaders_created = 0;
+};
@@ -4,8 +4,12 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <algorithm>
+#include <atomic>
 #include <csignal>
 #include <cstdio>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -15,14 +19,25 @@
 #include <Windows.h>
 #endif
 
+#include "Common/CommonPaths.h"
+#include "Common/Config/Config.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/JsonUtil.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 #include "Core/System.h"
+#include "DolphinNoGUI/Benchmark.h"
+#include "DolphinNoGUI/FifoBenchmark.h"
 
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
@@ -33,6 +48,7 @@
 #include "VideoCommon/VideoBackendBase.h"
 
 static std::unique_ptr<Platform> s_platform;
+static std::atomic<bool> s_signal_received = false;
 
 static void signal_handler(int)
 {
@@ -45,6 +61,7 @@ static void signal_handler(int)
   }
 #endif
 
+  s_signal_received = true;
   s_platform->RequestShutdown();
 }
 
@@ -183,6 +200,81 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
   return nullptr;
 }
 
+static bool WriteBenchmarkReport(const optparse::Values& options, const picojson::value& report)
+{
+  if (!options.is_set("benchmark_output"))
+  {
+    std::fputs(report.serialize(true).c_str(), stdout);
+    return true;
+  }
+
+  const std::string path = static_cast<const char*>(options.get("benchmark_output"));
+  if (!JsonToFile(path, report, true))
+  {
+    fprintf(stderr, "Could not write the benchmark report to %s\n", path.c_str());
+    return false;
+  }
+  return true;
+}
+
+static int RunFifoBenchmark(const optparse::Values& options, const WindowSystemInfo& wsi)
+{
+  const std::string path = static_cast<const char*>(options.get("fifo_benchmark"));
+  std::vector<std::string> files{path};
+  if (File::IsDirectory(path))
+  {
+    files = Common::DoFileSearch({path}, {".dff"});
+    std::ranges::sort(files);
+  }
+  if (files.empty())
+  {
+    fprintf(stderr, "No FIFO logs found in %s\n", path.c_str());
+    return 1;
+  }
+
+  auto& system = Core::System::GetInstance();
+  const int loops = std::max(1, static_cast<int>(options.get("fifo_benchmark_loops")));
+  system.GetFifoPlayer().SetLoopLimit(loops);
+  Common::ScopeGuard loop_limit_guard([&system] { system.GetFifoPlayer().SetLoopLimit(0); });
+
+  picojson::array report;
+  for (const std::string& file : files)
+  {
+    if (s_signal_received)
+      return 1;
+
+    s_platform->Restart();
+    FifoBenchmark benchmark(PathToFileName(file));
+    if (!BootManager::BootCore(system, BootParameters::GenerateFromFile(file), wsi))
+    {
+      fprintf(stderr, "Could not boot %s\n", file.c_str());
+      return 1;
+    }
+
+    s_platform->MainLoop();
+    Core::Stop(system);
+    Core::Shutdown(system);
+
+    report.emplace_back(benchmark.GetResults());
+  }
+
+  if (options.is_set("benchmark_baseline"))
+  {
+    const std::string baseline_path = static_cast<const char*>(options.get("benchmark_baseline"));
+    picojson::value baseline;
+    std::string error;
+    if (!JsonFromFile(baseline_path, &baseline, &error) || !baseline.is<picojson::array>())
+    {
+      fprintf(stderr, "Could not read the benchmark baseline %s: %s\n", baseline_path.c_str(),
+              error.c_str());
+      return 1;
+    }
+    FifoBenchmark::CompareWithBaseline(&report, baseline.get<picojson::array>());
+  }
+
+  return WriteBenchmarkReport(options, picojson::value(std::move(report))) ? 0 : 1;
+}
+
 #ifdef _WIN32
 #define main app_main
 #endif
@@ -214,6 +306,37 @@ int main(const int argc, char* argv[])
                 "macos"
 #endif
       });
+  parser->add_option("--benchmark")
+      .action("store")
+      .metavar("<fields>")
+      .type("int")
+      .help("Emulate the given number of VI fields after booting, then print statistics as JSON and "
+            "exit. Combine with --movie for repeatable input");
+  parser->add_option("--benchmark_output")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Write the benchmark statistics to a file instead of stdout");
+  parser->add_option("--fifo_benchmark")
+      .action("store")
+      .metavar("<file or directory>")
+      .type("string")
+      .help("Replay a FIFO log, or every .dff file in a directory, and print GPU statistics for "
+            "each as JSON");
+  parser->set_defaults("fifo_benchmark_loops", "1");
+  parser->add_option("--fifo_benchmark_loops")
+      .action("store")
+      .metavar("<loops>")
+      .type("int")
+      .help("How many times to replay each FIFO log");
+  parser->add_option("--benchmark_baseline")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Compare the FIFO benchmark with a report written by an earlier run");
+  parser->add_option("--benchmark_unthrottled")
+      .action("store_true")
+      .help("Run the benchmark with the emulation speed limit and V-Sync disabled");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -254,12 +377,24 @@ int main(const int argc, char* argv[])
     args.erase(args.begin());
     game_specified = true;
   }
-  else
+  else if (!options.is_set("fifo_benchmark"))
   {
     parser->print_help();
     return 0;
   }
 
+  std::optional<u64> benchmark_fields;
+  if (options.is_set("benchmark"))
+  {
+    const int fields = static_cast<int>(options.get("benchmark"));
+    if (fields <= 0)
+    {
+      fprintf(stderr, "The benchmark needs a positive number of fields.\n");
+      return 1;
+    }
+    benchmark_fields = fields;
+  }
+
   std::string user_directory;
   if (options.is_set("user"))
     user_directory = static_cast<const char*>(options.get("user"));
@@ -288,6 +423,30 @@ int main(const int argc, char* argv[])
     return 1;
   }
 
+  if (boot && options.is_set("movie"))
+  {
+    const std::string movie_path = static_cast<const char*>(options.get("movie"));
+    std::optional<std::string> movie_save_state_path;
+    if (!Core::System::GetInstance().GetMovie().PlayInput(movie_path, &movie_save_state_path))
+    {
+      fprintf(stderr, "Could not play the movie %s\n", movie_path.c_str());
+      return 1;
+    }
+    boot->boot_session_data.SetSavestateData(std::move(movie_save_state_path),
+                                             DeleteSavestateAfterBoot::No);
+  }
+
+  std::unique_ptr<Benchmark> benchmark;
+  if (benchmark_fields)
+  {
+    if (static_cast<bool>(options.get("benchmark_unthrottled")))
+    {
+      Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+      Config::SetCurrent(Config::GFX_VSYNC, false);
+    }
+    benchmark = std::make_unique<Benchmark>(*benchmark_fields, [] { s_platform->Stop(); });
+  }
+
   Core::AddOnStateChangedCallback([](const Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -308,6 +467,13 @@ int main(const int argc, char* argv[])
 
   DolphinAnalytics::Instance().ReportDolphinStart("nogui");
 
+  if (options.is_set("fifo_benchmark"))
+  {
+    const int result = RunFifoBenchmark(options, wsi);
+    s_platform.reset();
+    return result;
+  }
+
   if (!BootManager::BootCore(Core::System::GetInstance(), std::move(boot), wsi))
   {
     fprintf(stderr, "Could not boot the specified file\n");
@@ -324,6 +490,15 @@ int main(const int argc, char* argv[])
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
+  if (benchmark)
+  {
+    if (!WriteBenchmarkReport(options, picojson::value(benchmark->GetResults())) ||
+        !benchmark->IsFinished())
+    {
+      return 1;
+    }
+  }
+
   return 0;
 }
 
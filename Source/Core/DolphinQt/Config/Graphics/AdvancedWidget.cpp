@@ -64,6 +64,8 @@ void AdvancedWidget::CreateWidgets()
   m_perf_samp_window->SetTitle(tr("Performance Sample Window (ms)"));
   m_log_render_time = new ConfigBool(tr("Log Render Time to File"),
                                      Config::GFX_LOG_RENDER_TIME_TO_FILE, m_game_layer);
+  m_pipeline_miss_report = new ConfigBool(tr("Write Pipeline Miss Report"),
+                                          Config::GFX_PIPELINE_MISS_REPORT, m_game_layer);
 
   performance_layout->addWidget(m_show_fps, 0, 0);
   performance_layout->addWidget(m_show_ftimes, 0, 1);
@@ -75,6 +77,7 @@ void AdvancedWidget::CreateWidgets()
   performance_layout->addWidget(m_perf_samp_window, 3, 1);
   performance_layout->addWidget(m_log_render_time, 4, 0);
   performance_layout->addWidget(m_show_speed_colors, 4, 1);
+  performance_layout->addWidget(m_pipeline_miss_report, 5, 0);
 
   // Debugging
   auto* debugging_box = new QGroupBox(tr("Debugging"));
@@ -87,6 +90,8 @@ void AdvancedWidget::CreateWidgets()
       new ConfigBool(tr("Show Statistics"), Config::GFX_OVERLAY_STATS, m_game_layer);
   m_show_proj_statistics = new ConfigBool(tr("Show Projection Statistics"),
                                           Config::GFX_OVERLAY_PROJ_STATS, m_game_layer);
+  m_show_gpu_timings =
+      new ConfigBool(tr("Show GPU Timings"), Config::GFX_OVERLAY_GPU_TIMINGS, m_game_layer);
   m_enable_format_overlay =
       new ConfigBool(tr("Texture Format Overlay"), Config::GFX_TEXFMT_OVERLAY_ENABLE, m_game_layer);
   m_enable_api_validation = new ConfigBool(tr("Enable API Validation Layers"),
@@ -97,6 +102,7 @@ void AdvancedWidget::CreateWidgets()
   debugging_layout->addWidget(m_enable_format_overlay, 1, 0);
   debugging_layout->addWidget(m_show_proj_statistics, 1, 1);
   debugging_layout->addWidget(m_enable_api_validation, 2, 0);
+  debugging_layout->addWidget(m_show_gpu_timings, 2, 1);
 
   // Utility
   auto* utility_box = new QGroupBox(tr("Utility"));
@@ -108,6 +114,9 @@ void AdvancedWidget::CreateWidgets()
   m_prefetch_custom_textures = new ConfigBool(tr("Prefetch Custom Textures"),
                                               Config::GFX_CACHE_HIRES_TEXTURES, m_game_layer);
   m_prefetch_custom_textures->setEnabled(m_load_custom_textures->isChecked());
+  m_compress_custom_textures = new ConfigBool(tr("Compress Custom Textures"),
+                                              Config::GFX_TRANSCODE_HIRES_TEXTURES, m_game_layer);
+  m_compress_custom_textures->setEnabled(m_load_custom_textures->isChecked());
   m_dump_efb_target = new ConfigBool(tr("Dump EFB Target"), Config::GFX_DUMP_EFB_TARGET);
   m_dump_xfb_target = new ConfigBool(tr("Dump XFB Target"), Config::GFX_DUMP_XFB_TARGET);
 
@@ -125,12 +134,13 @@ void AdvancedWidget::CreateWidgets()
 
   utility_layout->addWidget(m_load_custom_textures, 0, 0);
   utility_layout->addWidget(m_prefetch_custom_textures, 0, 1);
+  utility_layout->addWidget(m_compress_custom_textures, 1, 0);
 
-  utility_layout->addWidget(m_disable_vram_copies, 1, 0);
-  utility_layout->addWidget(m_enable_graphics_mods, 1, 1);
+  utility_layout->addWidget(m_disable_vram_copies, 2, 0);
+  utility_layout->addWidget(m_enable_graphics_mods, 2, 1);
 
-  utility_layout->addWidget(m_dump_efb_target, 2, 0);
-  utility_layout->addWidget(m_dump_xfb_target, 2, 1);
+  utility_layout->addWidget(m_dump_efb_target, 3, 0);
+  utility_layout->addWidget(m_dump_xfb_target, 3, 1);
 
   // Texture dumping
   auto* texture_dump_box = new QGroupBox(tr("Texture Dumping"));
@@ -173,10 +183,15 @@ void AdvancedWidget::CreateWidgets()
   m_dump_use_lossless =
       new ConfigBool(tr("Use Lossless Codec (Ut Video)"), Config::GFX_USE_LOSSLESS, m_game_layer);
 
+  m_dump_use_hardware_encoder = new ConfigBool(
+      tr("Use Hardware Encoder"), Config::GFX_DUMP_USE_HARDWARE_ENCODER, m_game_layer);
+  m_dump_use_hardware_encoder->setEnabled(!m_dump_use_lossless->isChecked());
+
   m_dump_bitrate = new ConfigInteger(0, 1000000, Config::GFX_BITRATE_KBPS, m_game_layer, 1000);
   m_dump_bitrate->setEnabled(!m_dump_use_lossless->isChecked());
 
   dump_layout->addWidget(m_dump_use_lossless, 1, 0);
+  dump_layout->addWidget(m_dump_use_hardware_encoder, 1, 1);
   dump_layout->addWidget(new QLabel(tr("Bitrate (kbps):")), 2, 0);
   dump_layout->addWidget(m_dump_bitrate, 2, 1);
 #endif
@@ -200,12 +215,15 @@ void AdvancedWidget::CreateWidgets()
       tr("Prefer VS for Point/Line Expansion"), Config::GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION,
       m_game_layer);
   m_cpu_cull = new ConfigBool(tr("Cull Vertices on the CPU"), Config::GFX_CPU_CULL, m_game_layer);
+  m_cpu_cull_partial = new ConfigBool(tr("Cull Individual Triangles on the CPU"),
+                                      Config::GFX_CPU_CULL_PARTIAL, m_game_layer);
 
   misc_layout->addWidget(m_enable_cropping, 0, 0);
   misc_layout->addWidget(m_enable_prog_scan, 0, 1);
   misc_layout->addWidget(m_backend_multithreading, 1, 0);
   misc_layout->addWidget(m_prefer_vs_for_point_line_expansion, 1, 1);
   misc_layout->addWidget(m_cpu_cull, 2, 0);
+  misc_layout->addWidget(m_cpu_cull_partial, 3, 0);
 #ifdef _WIN32
   m_borderless_fullscreen =
       new ConfigBool(tr("Borderless Fullscreen"), Config::GFX_BORDERLESS_FULLSCREEN, m_game_layer);
@@ -223,8 +241,15 @@ void AdvancedWidget::CreateWidgets()
   m_manual_texture_sampling = new ConfigBool(
       tr("Manual Texture Sampling"), Config::GFX_HACK_FAST_TEXTURE_SAMPLING, m_game_layer, true);
 
+  m_cache_vertex_data =
+      new ConfigBool(tr("Cache Vertex Data"), Config::GFX_CACHE_VERTEX_DATA, m_game_layer);
+  m_gpu_vertex_pulling =
+      new ConfigBool(tr("GPU Vertex Pulling"), Config::GFX_GPU_VERTEX_PULLING, m_game_layer);
+
   experimental_layout->addWidget(m_defer_efb_access_invalidation, 0, 0);
   experimental_layout->addWidget(m_manual_texture_sampling, 0, 1);
+  experimental_layout->addWidget(m_cache_vertex_data, 1, 0);
+  experimental_layout->addWidget(m_gpu_vertex_pulling, 1, 1);
 
   main_layout->addWidget(performance_box);
   main_layout->addWidget(debugging_box);
@@ -241,7 +266,10 @@ void AdvancedWidget::CreateWidgets()
 void AdvancedWidget::ConnectWidgets()
 {
   connect(m_load_custom_textures, &QCheckBox::toggled, this,
-          [this](bool checked) { m_prefetch_custom_textures->setEnabled(checked); });
+          [this](bool checked) {
+            m_prefetch_custom_textures->setEnabled(checked);
+            m_compress_custom_textures->setEnabled(checked);
+          });
   connect(m_dump_textures, &QCheckBox::toggled, this, [this](bool checked) {
     m_dump_mip_textures->setEnabled(checked);
     m_dump_base_textures->setEnabled(checked);
@@ -249,8 +277,10 @@ void AdvancedWidget::ConnectWidgets()
   connect(m_enable_graphics_mods, &QCheckBox::toggled, this,
           [](bool checked) { emit Settings::Instance().EnableGfxModsChanged(checked); });
 #if defined(HAVE_FFMPEG)
-  connect(m_dump_use_lossless, &QCheckBox::toggled, this,
-          [this](bool checked) { m_dump_bitrate->setEnabled(!checked); });
+  connect(m_dump_use_lossless, &QCheckBox::toggled, this, [this](bool checked) {
+    m_dump_use_hardware_encoder->setEnabled(!checked);
+    m_dump_bitrate->setEnabled(!checked);
+  });
 #endif
 }
 
@@ -259,6 +289,7 @@ void AdvancedWidget::OnBackendChanged()
   m_backend_multithreading->setEnabled(g_backend_info.bSupportsMultithreading);
   m_prefer_vs_for_point_line_expansion->setEnabled(g_backend_info.bSupportsGeometryShaders &&
                                                    g_backend_info.bSupportsVSLinePointExpand);
+  m_gpu_vertex_pulling->setEnabled(g_backend_info.bSupportsGPUVertexPulling);
   AddDescriptions();
 }
 
@@ -307,6 +338,13 @@ void AdvancedWidget::AddDescriptions()
       "Logs the render time of every frame to User/Logs/render_time.txt.<br><br>Use this "
       "feature to measure Dolphin's performance.<br><br><dolphin_emphasis>If "
       "unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_PIPELINE_MISS_REPORT_DESCRIPTION[] = QT_TR_NOOP(
+      "Records every draw which had to wait for a shader to compile, or used an ubershader or "
+      "was skipped while it compiled in the background. When the game is stopped, a report of "
+      "the shaders to prioritize is written to User/Dump/Debug, along with a .uidcache file "
+      "which can be added to a shader bundle.<br><br>Use this feature to find the causes of "
+      "shader compilation stutter.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_WIREFRAME_DESCRIPTION[] =
       QT_TR_NOOP("Renders the scene as a wireframe.<br><br><dolphin_emphasis>If unsure, leave "
                  "this unchecked.</dolphin_emphasis>");
@@ -316,6 +354,11 @@ void AdvancedWidget::AddDescriptions()
   static const char TR_SHOW_PROJ_STATS_DESCRIPTION[] =
       QT_TR_NOOP("Shows various projection statistics.<br><br><dolphin_emphasis>If unsure, "
                  "leave this unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_GPU_TIMINGS_DESCRIPTION[] = QT_TR_NOOP(
+      "Shows how long the GPU spends on draws, EFB copies, XFB scaling and post-processing, "
+      "and which pipelines take the most time to draw with. Only available on backends which "
+      "support timestamp queries.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_TEXTURE_FORMAT_DESCRIPTION[] =
       QT_TR_NOOP("Modifies textures to show the format they're encoded in.<br><br>May require "
                  "an emulation reset to apply.<br><br><dolphin_emphasis>If unsure, leave this "
@@ -347,6 +390,12 @@ void AdvancedWidget::AddDescriptions()
       "Caches custom textures to system RAM on startup.<br><br>This can require exponentially "
       "more RAM but fixes possible stuttering.<br><br><dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_COMPRESS_CUSTOM_TEXTURE_DESCRIPTION[] = QT_TR_NOOP(
+      "Stores block compressed copies of PNG custom textures in User/Cache/TranscodedTextures/ "
+      "and loads those instead when the textures are unchanged.<br><br>This makes custom "
+      "textures load faster and take up to 8 times less memory, at a small loss in quality. The "
+      "copies are made in the background the first time each texture is loaded.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_DUMP_EFB_DESCRIPTION[] =
       QT_TR_NOOP("Dumps the contents of EFB copies to User/Dump/Textures/.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -380,6 +429,11 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Encodes frame dumps using the Ut Video codec. If this option is unchecked, a "
                  "lossy Xvid codec will be used.<br><br><dolphin_emphasis>If "
                  "unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_USE_HARDWARE_ENCODER_DESCRIPTION[] = QT_TR_NOOP(
+      "Encodes frame dumps on the GPU using NVENC, AMF, Quick Sync, VA-API or VideoToolbox, "
+      "whichever is available first. This frees up the CPU for emulation, but only works with "
+      "codecs the GPU supports, such as H.264 or HEVC, and falls back to encoding on the CPU "
+      "otherwise.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 #endif
   static const char TR_PNG_COMPRESSION_LEVEL_DESCRIPTION[] =
       QT_TR_NOOP("Specifies the zlib compression level to use when saving PNG images (both for "
@@ -413,12 +467,30 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Cull vertices on the CPU to reduce the number of draw calls required.  "
                  "May affect performance and draw statistics.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_CPU_CULL_PARTIAL_DESCRIPTION[] =
+      QT_TR_NOOP("When culling vertices on the CPU, also removes the culled triangles from draws "
+                 "which are only partly visible. Costs CPU time for every draw, but can reduce "
+                 "the load on the GPU.<br><br>"
+                 "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION[] = QT_TR_NOOP(
       "Defers invalidation of the EFB access cache until a GPU synchronization command "
       "is executed. If disabled, the cache will be invalidated with every draw call. "
       "<br><br>May improve performance in some games which rely on CPU EFB Access at the cost "
       "of stability.<br><br><dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_CACHE_VERTEX_DATA_DESCRIPTION[] = QT_TR_NOOP(
+      "Reuses the converted vertices of geometry which the game sends again unchanged, instead "
+      "of converting them every time. Vertices from display lists are always reused.<br><br>"
+      "May improve performance in games which resubmit the same geometry every frame, at the cost "
+      "of hashing all other vertex data.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_GPU_VERTEX_PULLING_DESCRIPTION[] = QT_TR_NOOP(
+      "Uploads the game's vertices unconverted and decodes them in the vertex shader, instead of "
+      "converting them on the CPU. Line and point primitives, and draws which are culled on the "
+      "CPU, are still converted on the CPU.<br><br>"
+      "May improve performance in CPU-limited games. Has no effect when ubershaders are used. "
+      "Only supported by the Vulkan and D3D12 backends.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_MANUAL_TEXTURE_SAMPLING_DESCRIPTION[] = QT_TR_NOOP(
       "Use a manual implementation of texture sampling instead of the graphics backend's built-in "
       "functionality.<br><br>"
@@ -450,11 +522,13 @@ void AdvancedWidget::AddDescriptions()
   m_show_graphs->SetDescription(tr(TR_SHOW_GRAPHS_DESCRIPTION));
   m_show_speed->SetDescription(tr(TR_SHOW_SPEED_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
+  m_pipeline_miss_report->SetDescription(tr(TR_PIPELINE_MISS_REPORT_DESCRIPTION));
   m_show_speed_colors->SetDescription(tr(TR_SHOW_SPEED_COLORS_DESCRIPTION));
 
   m_enable_wireframe->SetDescription(tr(TR_WIREFRAME_DESCRIPTION));
   m_show_statistics->SetDescription(tr(TR_SHOW_STATS_DESCRIPTION));
   m_show_proj_statistics->SetDescription(tr(TR_SHOW_PROJ_STATS_DESCRIPTION));
+  m_show_gpu_timings->SetDescription(tr(TR_SHOW_GPU_TIMINGS_DESCRIPTION));
   m_enable_format_overlay->SetDescription(tr(TR_TEXTURE_FORMAT_DESCRIPTION));
   m_enable_api_validation->SetDescription(tr(TR_VALIDATION_LAYER_DESCRIPTION));
   m_perf_samp_window->SetDescription(tr(TR_PERF_SAMP_WINDOW_DESCRIPTION));
@@ -463,6 +537,7 @@ void AdvancedWidget::AddDescriptions()
   m_dump_base_textures->SetDescription(tr(TR_DUMP_BASE_TEXTURE_DESCRIPTION));
   m_load_custom_textures->SetDescription(tr(TR_LOAD_CUSTOM_TEXTURE_DESCRIPTION));
   m_prefetch_custom_textures->SetDescription(tr(TR_CACHE_CUSTOM_TEXTURE_DESCRIPTION));
+  m_compress_custom_textures->SetDescription(tr(TR_COMPRESS_CUSTOM_TEXTURE_DESCRIPTION));
   m_dump_efb_target->SetDescription(tr(TR_DUMP_EFB_DESCRIPTION));
   m_dump_xfb_target->SetDescription(tr(TR_DUMP_XFB_DESCRIPTION));
   m_disable_vram_copies->SetDescription(tr(TR_DISABLE_VRAM_COPIES_DESCRIPTION));
@@ -470,6 +545,7 @@ void AdvancedWidget::AddDescriptions()
   m_frame_dumps_resolution_type->SetDescription(tr(TR_FRAME_DUMPS_RESOLUTION_TYPE_DESCRIPTION));
 #ifdef HAVE_FFMPEG
   m_dump_use_lossless->SetDescription(tr(TR_USE_LOSSLESS_DESCRIPTION));
+  m_dump_use_hardware_encoder->SetDescription(tr(TR_USE_HARDWARE_ENCODER_DESCRIPTION));
 #endif
   m_png_compression_level->SetDescription(tr(TR_PNG_COMPRESSION_LEVEL_DESCRIPTION));
   m_enable_cropping->SetDescription(tr(TR_CROPPING_DESCRIPTION));
@@ -487,9 +563,12 @@ void AdvancedWidget::AddDescriptions()
   m_prefer_vs_for_point_line_expansion->SetDescription(
       tr(TR_PREFER_VS_FOR_POINT_LINE_EXPANSION_DESCRIPTION).arg(vsexpand_extra));
   m_cpu_cull->SetDescription(tr(TR_CPU_CULL_DESCRIPTION));
+  m_cpu_cull_partial->SetDescription(tr(TR_CPU_CULL_PARTIAL_DESCRIPTION));
 #ifdef _WIN32
   m_borderless_fullscreen->SetDescription(tr(TR_BORDERLESS_FULLSCREEN_DESCRIPTION));
 #endif
   m_defer_efb_access_invalidation->SetDescription(tr(TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION));
   m_manual_texture_sampling->SetDescription(tr(TR_MANUAL_TEXTURE_SAMPLING_DESCRIPTION));
+  m_cache_vertex_data->SetDescription(tr(TR_CACHE_VERTEX_DATA_DESCRIPTION));
+  m_gpu_vertex_pulling->SetDescription(tr(TR_GPU_VERTEX_PULLING_DESCRIPTION));
 }
@@ -32,6 +32,7 @@ private:
   ConfigBool* m_enable_wireframe;
   ConfigBool* m_show_statistics;
   ConfigBool* m_show_proj_statistics;
+  ConfigBool* m_show_gpu_timings;
   ConfigBool* m_enable_format_overlay;
   ConfigBool* m_enable_api_validation;
   ConfigBool* m_show_fps;
@@ -43,9 +44,11 @@ private:
   ConfigBool* m_show_speed_colors;
   ConfigInteger* m_perf_samp_window;
   ConfigBool* m_log_render_time;
+  ConfigBool* m_pipeline_miss_report;
 
   // Utility
   ConfigBool* m_prefetch_custom_textures;
+  ConfigBool* m_compress_custom_textures;
   ConfigBool* m_dump_efb_target;
   ConfigBool* m_dump_xfb_target;
   ConfigBool* m_disable_vram_copies;
@@ -59,6 +62,7 @@ private:
 
   // Frame dumping
   ConfigBool* m_dump_use_lossless;
+  ConfigBool* m_dump_use_hardware_encoder;
   ConfigChoice* m_frame_dumps_resolution_type;
   ConfigInteger* m_dump_bitrate;
   ConfigInteger* m_png_compression_level;
@@ -69,11 +73,14 @@ private:
   ConfigBool* m_backend_multithreading;
   ConfigBool* m_prefer_vs_for_point_line_expansion;
   ConfigBool* m_cpu_cull;
+  ConfigBool* m_cpu_cull_partial;
   ConfigBool* m_borderless_fullscreen;
 
   // Experimental
   ConfigBool* m_defer_efb_access_invalidation;
   ConfigBool* m_manual_texture_sampling;
+  ConfigBool* m_cache_vertex_data;
+  ConfigBool* m_gpu_vertex_pulling;
 
   Config::Layer* m_game_layer = nullptr;
 };
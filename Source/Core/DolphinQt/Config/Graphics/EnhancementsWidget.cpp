@@ -42,9 +42,6 @@ EnhancementsWidget::EnhancementsWidget(GraphicsPane* gfx_pane)
   connect(gfx_pane, &GraphicsPane::UseFastTextureSamplingChanged, this, [this] {
     m_texture_filtering_combo->setEnabled(ReadSetting(Config::GFX_HACK_FAST_TEXTURE_SAMPLING));
   });
-  connect(gfx_pane, &GraphicsPane::UseGPUTextureDecodingChanged, this, [this] {
-    m_arbitrary_mipmap_detection->setEnabled(!ReadSetting(Config::GFX_ENABLE_GPU_TEXTURE_DECODING));
-  });
 }
 
 constexpr int ANISO_1x = Common::ToUnderlying(AnisotropicFilteringMode::Force1x);
@@ -161,8 +158,9 @@ void EnhancementsWidget::CreateWidgets()
   m_arbitrary_mipmap_detection =
       new ConfigBool(tr("Arbitrary Mipmap Detection"),
                      Config::GFX_ENHANCE_ARBITRARY_MIPMAP_DETECTION, m_game_layer);
-  m_arbitrary_mipmap_detection->setEnabled(!ReadSetting(Config::GFX_ENABLE_GPU_TEXTURE_DECODING));
   m_hdr = new ConfigBool(tr("HDR Post-Processing"), Config::GFX_ENHANCE_HDR_OUTPUT, m_game_layer);
+  m_dynamic_resolution =
+      new ConfigBool(tr("Dynamic Resolution"), Config::GFX_DYNAMIC_EFB_SCALE, m_game_layer);
 
   int row = 0;
   enhancements_layout->addWidget(new QLabel(tr("Internal Resolution:")), row, 0);
@@ -206,6 +204,9 @@ void EnhancementsWidget::CreateWidgets()
   enhancements_layout->addWidget(m_hdr, row, 1, 1, -1);
   ++row;
 
+  enhancements_layout->addWidget(m_dynamic_resolution, row, 0);
+  ++row;
+
   // Stereoscopy
   auto* stereoscopy_box = new QGroupBox(tr("Stereoscopy"));
   auto* stereoscopy_layout = new QGridLayout();
@@ -397,7 +398,6 @@ void EnhancementsWidget::OnConfigChanged()
   // Only used for the GameConfigWidget. Bypasses graphics window signals and backend info due to it
   // being global.
   m_texture_filtering_combo->setEnabled(ReadSetting(Config::GFX_HACK_FAST_TEXTURE_SAMPLING));
-  m_arbitrary_mipmap_detection->setEnabled(!ReadSetting(Config::GFX_ENABLE_GPU_TEXTURE_DECODING));
   UpdateAntialiasingOptions();
 
   // Needs to update after deleting a key for 3d settings.
@@ -556,9 +556,9 @@ void EnhancementsWidget::AddDescriptions()
       "effects.<br><br>May have false positives that result in blurry textures at increased "
       "internal "
       "resolution, such as in games that use very low resolution mipmaps. Disabling this can also "
-      "reduce stutter in games that frequently load new textures.<br><br>This setting is disabled "
-      "when GPU Texture Decoding is enabled.<br><br><dolphin_emphasis>If unsure, leave this "
-      "unchecked.</dolphin_emphasis>");
+      "reduce stutter in games that frequently load new textures.<br><br>While this is enabled, "
+      "mipmapped textures are decoded on the CPU even if GPU Texture Decoding is "
+      "enabled.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_HDR_DESCRIPTION[] = QT_TR_NOOP(
       "Enables scRGB HDR output (if supported by your graphics backend and monitor)."
       " Fullscreen might be required."
@@ -567,6 +567,12 @@ void EnhancementsWidget::AddDescriptions()
       "<br><br>Note that games still render in SDR internally."
       "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 
+  static const char TR_DYNAMIC_RESOLUTION_DESCRIPTION[] = QT_TR_NOOP(
+      "Lowers the internal resolution in steps when the GPU can't keep up with the game, and "
+      "raises it back up to the selected internal resolution when there is enough headroom."
+      "<br><br>Requires Dual Core. Changing the resolution causes a brief stutter."
+      "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+
   m_ir_combo->SetTitle(tr("Internal Resolution"));
   m_ir_combo->SetDescription(tr(TR_INTERNAL_RESOLUTION_DESCRIPTION));
 
@@ -601,6 +607,8 @@ void EnhancementsWidget::AddDescriptions()
 
   m_hdr->SetDescription(tr(TR_HDR_DESCRIPTION));
 
+  m_dynamic_resolution->SetDescription(tr(TR_DYNAMIC_RESOLUTION_DESCRIPTION));
+
   m_3d_mode->SetTitle(tr("Stereoscopic 3D Mode"));
   m_3d_mode->SetDescription(tr(TR_3D_MODE_DESCRIPTION));
 
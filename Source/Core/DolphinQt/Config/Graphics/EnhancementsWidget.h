@@ -60,6 +60,7 @@ private:
   ConfigBool* m_disable_copy_filter;
   ConfigBool* m_arbitrary_mipmap_detection;
   ConfigBool* m_hdr;
+  ConfigBool* m_dynamic_resolution;
 
   // Stereoscopy
   ConfigChoice* m_3d_mode;
@@ -75,6 +75,9 @@ void GeneralWidget::CreateWidgets()
 
   m_adapter_combo = new ToolTipComboBox;
   m_enable_vsync = new ConfigBool(tr("V-Sync"), Config::GFX_VSYNC, m_game_layer);
+  m_frame_latency_combo =
+      new ConfigChoice({tr("Default"), tr("1 Frame"), tr("2 Frames"), tr("3 Frames")},
+                       Config::GFX_PRESENT_FRAME_LATENCY, m_game_layer);
   m_enable_fullscreen =
       new ConfigBool(tr("Start in Fullscreen"), Config::MAIN_FULLSCREEN, m_game_layer);
 
@@ -91,6 +94,9 @@ void GeneralWidget::CreateWidgets()
   video_layout->addWidget(m_custom_aspect_width, 3, 1);
   video_layout->addWidget(m_custom_aspect_height, 3, 2);
 
+  video_layout->addWidget(new QLabel(tr("Frame Latency:")), 4, 0);
+  video_layout->addWidget(m_frame_latency_combo, 4, 1, 1, -1);
+
   auto* const basic_grid = new QGridLayout;
   video_layout->addLayout(basic_grid, video_layout->rowCount(), 0, 1, -1);
   basic_grid->addWidget(m_enable_vsync, 0, 0);
@@ -268,6 +274,11 @@ void GeneralWidget::AddDescriptions()
       "if emulation speed is below 100%.<br><br><dolphin_emphasis>If unsure, leave "
       "this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_FRAME_LATENCY_DESCRIPTION[] = QT_TR_NOOP(
+      "Limits how many frames can be queued up for display. Lower values reduce input lag, but "
+      "may cause stuttering if the GPU cannot keep up.<br><br>Switching between Default and a "
+      "frame limit may only take effect after emulation is restarted."
+      "<br><br><dolphin_emphasis>If unsure, select Default.</dolphin_emphasis>");
   static const char TR_SHOW_NETPLAY_PING_DESCRIPTION[] = QT_TR_NOOP(
       "Shows the player's maximum ping while playing on "
       "NetPlay.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -318,6 +329,9 @@ void GeneralWidget::AddDescriptions()
 
   m_enable_vsync->SetDescription(tr(TR_VSYNC_DESCRIPTION));
 
+  m_frame_latency_combo->SetTitle(tr("Frame Latency"));
+  m_frame_latency_combo->SetDescription(tr(TR_FRAME_LATENCY_DESCRIPTION));
+
   m_enable_fullscreen->SetDescription(tr(TR_FULLSCREEN_DESCRIPTION));
 
   m_show_ping->SetDescription(tr(TR_SHOW_NETPLAY_PING_DESCRIPTION));
@@ -49,6 +49,7 @@ private:
   ConfigInteger* m_custom_aspect_width;
   ConfigInteger* m_custom_aspect_height;
   ConfigBool* m_enable_vsync;
+  ConfigChoice* m_frame_latency_combo;
   ConfigBool* m_enable_fullscreen;
 
   // Options
@@ -13,6 +13,7 @@
 #include "Core/Config/MainSettings.h"
 
 #include "DolphinQt/Config/ConfigControls/ConfigBool.h"
+#include "DolphinQt/Config/ConfigControls/ConfigInteger.h"
 #include "DolphinQt/Config/ConfigControls/ConfigSlider.h"
 #include "DolphinQt/Config/GameConfigWidget.h"
 #include "DolphinQt/Config/Graphics/GraphicsPane.h"
@@ -27,8 +28,6 @@ HacksWidget::HacksWidget(GraphicsPane* gfx_pane) : m_game_layer{gfx_pane->GetCon
 
   connect(gfx_pane, &GraphicsPane::BackendChanged, this, &HacksWidget::OnBackendChanged);
   OnBackendChanged(QString::fromStdString(Config::Get(Config::MAIN_GFX_BACKEND)));
-  connect(m_gpu_texture_decoding, &QCheckBox::toggled,
-          [gfx_pane] { emit gfx_pane->UseGPUTextureDecodingChanged(); });
 }
 
 void HacksWidget::CreateWidgets()
@@ -51,7 +50,12 @@ void HacksWidget::CreateWidgets()
   efb_layout->addWidget(m_skip_efb_cpu, 0, 0);
   efb_layout->addWidget(m_ignore_format_changes, 0, 1);
   efb_layout->addWidget(m_store_efb_copies, 1, 0);
+  m_elide_unchanged_efb_copies =
+      new ConfigBool(tr("Skip Unchanged EFB Copies to RAM"),
+                     Config::GFX_HACK_ELIDE_UNCHANGED_EFB_COPIES, m_game_layer);
+
   efb_layout->addWidget(m_defer_efb_copies, 1, 1);
+  efb_layout->addWidget(m_elide_unchanged_efb_copies, 2, 0);
 
   // Texture Cache
   auto* texture_cache_box = new QGroupBox(tr("Texture Cache"));
@@ -104,12 +108,17 @@ void HacksWidget::CreateWidgets()
   m_save_texture_cache_state = new ConfigBool(
       tr("Save Texture Cache to State"), Config::GFX_SAVE_TEXTURE_CACHE_TO_STATE, m_game_layer);
   m_vi_skip = new ConfigBool(tr("VBI Skip"), Config::GFX_HACK_VI_SKIP, m_game_layer);
+  m_fast_forward_frame_skip =
+      new ConfigInteger(0, 9, Config::GFX_HACK_FAST_FORWARD_FRAME_SKIP, m_game_layer);
+  m_fast_forward_frame_skip->SetTitle(tr("Fast-Forward Frame Skip"));
 
   other_layout->addWidget(m_fast_depth_calculation, 0, 0);
   other_layout->addWidget(m_disable_bounding_box, 0, 1);
   other_layout->addWidget(m_vertex_rounding, 1, 0);
   other_layout->addWidget(m_save_texture_cache_state, 1, 1);
   other_layout->addWidget(m_vi_skip, 2, 0);
+  other_layout->addWidget(new QLabel(tr("Fast-Forward Frame Skip:")), 3, 0);
+  other_layout->addWidget(m_fast_forward_frame_skip, 3, 1);
 
   main_layout->addWidget(efb_box);
   main_layout->addWidget(texture_cache_box);
@@ -175,6 +184,12 @@ void HacksWidget::AddDescriptions()
       "many games, at the risk of breaking those which do not safely synchronize with the "
       "emulated GPU.<br><br><dolphin_emphasis>If unsure, leave this "
       "checked.</dolphin_emphasis>");
+  static const char TR_ELIDE_UNCHANGED_EFB_COPIES_DESCRIPTION[] = QT_TR_NOOP(
+      "Compares the contents of EFB copies with RAM before writing them, and skips writing the "
+      "parts which didn't change.<br><br>When EFB copies are only stored in RAM, textures which "
+      "were loaded from an unchanged copy don't have to be loaded again. Can improve performance "
+      "in games which repeat the same copies every frame, but slightly slows down the ones which "
+      "don't.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_ACCUARCY_DESCRIPTION[] = QT_TR_NOOP(
       "Adjusts the accuracy at which the GPU receives texture updates from RAM.<br><br>"
       "The \"Safe\" setting eliminates the likelihood of the GPU missing texture updates "
@@ -203,9 +218,9 @@ void HacksWidget::AddDescriptions()
   static const char TR_GPU_DECODING_DESCRIPTION[] = QT_TR_NOOP(
       "Enables texture decoding using the GPU instead of the CPU.<br><br>This may result in "
       "performance gains in some scenarios, or on systems where the CPU is the "
-      "bottleneck.<br><br>If this setting is enabled, Arbitrary Mipmap Detection will be "
-      "disabled.<br><br>"
-      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+      "bottleneck.<br><br>Small textures, and mipmapped textures while Arbitrary Mipmap "
+      "Detection is enabled, are still decoded on the CPU.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this checked.</dolphin_emphasis>");
   static const char TR_FAST_DEPTH_CALC_DESCRIPTION[] = QT_TR_NOOP(
       "Uses a less accurate algorithm to calculate depth values.<br><br>Causes issues in a few "
       "games, but can result in a decent speed increase depending on the game and/or "
@@ -232,11 +247,19 @@ void HacksWidget::AddDescriptions()
                  "<dolphin_emphasis>WARNING: Can cause freezes and compatibility "
                  "issues.</dolphin_emphasis> <br><br>"
                  "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_FAST_FORWARD_FRAME_SKIP_DESCRIPTION[] = QT_TR_NOOP(
+      "Number of frames which aren't rendered after each rendered frame while the emulation "
+      "speed is unlimited or the throttler is disabled, allowing for faster "
+      "fast-forwarding.<br><br>"
+      "Frames are still rendered whenever the game reads back from the EFB, which includes EFB "
+      "copies and, unless Store XFB Copies to Texture Only is enabled, XFB copies.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this at 0.</dolphin_emphasis>");
 
   m_skip_efb_cpu->SetDescription(tr(TR_SKIP_EFB_CPU_ACCESS_DESCRIPTION));
   m_ignore_format_changes->SetDescription(tr(TR_IGNORE_FORMAT_CHANGE_DESCRIPTION));
   m_store_efb_copies->SetDescription(tr(TR_STORE_EFB_TO_TEXTURE_DESCRIPTION));
   m_defer_efb_copies->SetDescription(tr(TR_DEFER_EFB_COPIES_DESCRIPTION));
+  m_elide_unchanged_efb_copies->SetDescription(tr(TR_ELIDE_UNCHANGED_EFB_COPIES_DESCRIPTION));
   m_accuracy->SetTitle(tr("Texture Cache Accuracy"));
   m_accuracy->SetDescription(tr(TR_ACCUARCY_DESCRIPTION));
   m_store_xfb_copies->SetDescription(tr(TR_STORE_XFB_TO_TEXTURE_DESCRIPTION));
@@ -248,6 +271,7 @@ void HacksWidget::AddDescriptions()
   m_save_texture_cache_state->SetDescription(tr(TR_SAVE_TEXTURE_CACHE_TO_STATE_DESCRIPTION));
   m_vertex_rounding->SetDescription(tr(TR_VERTEX_ROUNDING_DESCRIPTION));
   m_vi_skip->SetDescription(tr(TR_VI_SKIP_DESCRIPTION));
+  m_fast_forward_frame_skip->SetDescription(tr(TR_FAST_FORWARD_FRAME_SKIP_DESCRIPTION));
 }
 
 void HacksWidget::UpdateDeferEFBCopiesEnabled()
@@ -256,6 +280,7 @@ void HacksWidget::UpdateDeferEFBCopiesEnabled()
   // enabled.
   const bool can_defer = m_store_efb_copies->isChecked() && m_store_xfb_copies->isChecked();
   m_defer_efb_copies->setEnabled(!can_defer);
+  m_elide_unchanged_efb_copies->setEnabled(!can_defer);
 }
 
 void HacksWidget::UpdateSkipPresentingDuplicateFramesEnabled()
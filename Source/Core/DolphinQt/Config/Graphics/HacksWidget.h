@@ -6,6 +6,7 @@
 #include <QWidget>
 
 class ConfigBool;
+class ConfigInteger;
 class ConfigSlider;
 class ConfigSliderLabel;
 class GraphicsPane;
@@ -29,6 +30,7 @@ private:
   ConfigBool* m_ignore_format_changes;
   ConfigBool* m_store_efb_copies;
   ConfigBool* m_defer_efb_copies;
+  ConfigBool* m_elide_unchanged_efb_copies;
 
   // Texture Cache
   ConfigSliderLabel* m_accuracy_label;
@@ -46,6 +48,7 @@ private:
   ConfigBool* m_vertex_rounding;
   ConfigBool* m_vi_skip;
   ConfigBool* m_save_texture_cache_state;
+  ConfigInteger* m_fast_forward_frame_skip;
 
   Config::Layer* m_game_layer = nullptr;
 
@@ -3,6 +3,7 @@
 
 #include "DolphinQt/Debugger/MemoryViewWidget.h"
 
+#include <array>
 #include <bit>
 #include <cmath>
 
@@ -292,6 +293,61 @@ constexpr int GetTypeSize(MemoryViewWidget::Type type)
   }
 }
 
+static std::optional<QString> FormatValue(u64 value, MemoryViewWidget::Type type)
+{
+  using Type = MemoryViewWidget::Type;
+
+  switch (type)
+  {
+  case Type::Hex8:
+    return QStringLiteral("%1").arg(static_cast<u8>(value), 2, 16, QLatin1Char('0'));
+  case Type::ASCII:
+  {
+    const char character = static_cast<char>(value);
+    return Common::IsPrintableCharacter(character) ? QString{QChar::fromLatin1(character)} :
+                                                     QString{QChar::fromLatin1('.')};
+  }
+  case Type::Hex16:
+    return QStringLiteral("%1").arg(static_cast<u16>(value), 4, 16, QLatin1Char('0'));
+  case Type::Hex32:
+    return QStringLiteral("%1").arg(static_cast<u32>(value), 8, 16, QLatin1Char('0'));
+  case Type::Hex64:
+    return QStringLiteral("%1").arg(value, 16, 16, QLatin1Char('0'));
+  case Type::Unsigned8:
+    return QString::number(static_cast<u8>(value));
+  case Type::Unsigned16:
+    return QString::number(static_cast<u16>(value));
+  case Type::Unsigned32:
+    return QString::number(static_cast<u32>(value));
+  case Type::Signed8:
+    return QString::number(std::bit_cast<s8>(static_cast<u8>(value)));
+  case Type::Signed16:
+    return QString::number(std::bit_cast<s16>(static_cast<u16>(value)));
+  case Type::Signed32:
+    return QString::number(std::bit_cast<s32>(static_cast<u32>(value)));
+  case Type::Float32:
+  {
+    QString string = QString::number(std::bit_cast<float>(static_cast<u32>(value)), 'g', 4);
+    // Align to first digit.
+    if (!string.startsWith(QLatin1Char('-')))
+      string.prepend(QLatin1Char(' '));
+
+    return string;
+  }
+  case Type::Double:
+  {
+    QString string = QString::number(std::bit_cast<double>(value), 'g', 4);
+    // Align to first digit.
+    if (!string.startsWith(QLatin1Char('-')))
+      string.prepend(QLatin1Char(' '));
+
+    return string;
+  }
+  default:
+    return std::nullopt;
+  }
+}
+
 constexpr int GetCharacterCount(MemoryViewWidget::Type type)
 {
   // Max number of characters +1 for spacing between columns.
@@ -350,13 +406,18 @@ void MemoryViewWidget::UpdateDispatcher(UpdateType type)
   case UpdateType::Values:
     if (Core::GetState(m_system) == Core::State::Paused)
       GetValues();
+    else if (AddressSpace::GetAccessors(m_address_space)->SupportsUnsynchronizedReads())
+      GetValuesUnsynchronized();
     UpdateColumns();
     [[fallthrough]];
   case UpdateType::Symbols:
     UpdateSymbols();
     break;
   case UpdateType::Auto:
-    // Values were captured on CPU thread while doing a callback.
+    // Unless the address space can be read from here, the values were captured on CPU thread while
+    // doing a callback.
+    if (AddressSpace::GetAccessors(m_address_space)->SupportsUnsynchronizedReads())
+      GetValuesUnsynchronized();
     if (m_values.size() != 0)
       UpdateColumns();
   default:
@@ -629,31 +690,36 @@ void MemoryViewWidget::UpdateOnFrameEnd()
   std::unique_lock lock(m_updating, std::try_to_lock);
   if (lock)
   {
-    GetValues();
+    // Address spaces which can be read without pausing are read on the main thread instead, so
+    // that formatting the values doesn't hold up the CPU thread.
+    if (!AddressSpace::GetAccessors(m_address_space)->SupportsUnsynchronizedReads())
+      GetValues();
     // Should not directly trigger widget updates on a cpu thread. Signal main thread to do it.
     emit AutoUpdate();
   }
 }
 
+MemoryViewWidget::Type MemoryViewWidget::GetDualViewType() const
+{
+  if (!m_dual_view)
+    return Type::Null;
+
+  if (GetTypeSize(m_type) == 1)
+    return Type::Hex8;
+  else if (GetTypeSize(m_type) == 2)
+    return Type::Hex16;
+  else if (GetTypeSize(m_type) == 8)
+    return Type::Hex64;
+  else
+    return Type::Hex32;
+}
+
 void MemoryViewWidget::GetValues()
 {
   m_values.clear();
   m_values_dual_view.clear();
 
-  // Check for dual view type
-  Type type = Type::Null;
-
-  if (m_dual_view)
-  {
-    if (GetTypeSize(m_type) == 1)
-      type = Type::Hex8;
-    else if (GetTypeSize(m_type) == 2)
-      type = Type::Hex16;
-    else if (GetTypeSize(m_type) == 8)
-      type = Type::Hex64;
-    else
-      type = Type::Hex32;
-  }
+  const Type type = GetDualViewType();
 
   // Grab memory values as QStrings
   Core::CPUThreadGuard guard(m_system);
@@ -672,6 +738,43 @@ void MemoryViewWidget::GetValues()
   }
 }
 
+// Reads the values without pausing the emulation, see
+// AddressSpace::Accessors::CopyFromEmuUnsynchronized.
+void MemoryViewWidget::GetValuesUnsynchronized()
+{
+  m_values.clear();
+  m_values_dual_view.clear();
+
+  const Type type = GetDualViewType();
+  const AddressSpace::Accessors* accessors = AddressSpace::GetAccessors(m_address_space);
+
+  const u32 type_size = static_cast<u32>(GetTypeSize(m_type));
+  const auto& [range_begin, range_end] = m_address_range;
+  const u32 address_count = (range_end - range_begin) / type_size;
+
+  for (u32 i = 0; i < address_count; ++i)
+  {
+    const u32 address = range_begin + i * type_size;
+
+    std::array<u8, sizeof(u64)> bytes;
+    if (!accessors->CopyFromEmuUnsynchronized(m_system, address, bytes.data(), type_size))
+    {
+      m_values.insert(std::pair(address, std::nullopt));
+      if (m_dual_view)
+        m_values_dual_view.insert(std::pair(address, std::nullopt));
+      continue;
+    }
+
+    u64 value = 0;
+    for (u32 j = 0; j < type_size; ++j)
+      value = value << 8 | bytes[j];
+
+    m_values.insert(std::pair(address, FormatValue(value, m_type)));
+    if (m_dual_view)
+      m_values_dual_view.insert(std::pair(address, FormatValue(value, type)));
+  }
+}
+
 // May only be called if we have taken on the role of the CPU thread
 std::optional<QString> MemoryViewWidget::ValueToString(const Core::CPUThreadGuard& guard,
                                                        u32 address, Type type)
@@ -680,67 +783,16 @@ std::optional<QString> MemoryViewWidget::ValueToString(const Core::CPUThreadGuar
   if (!accessors->IsValidAddress(guard, address))
     return std::nullopt;
 
-  switch (type)
-  {
-  case Type::Hex8:
-  {
-    const u8 value = accessors->ReadU8(guard, address);
-    return QStringLiteral("%1").arg(value, 2, 16, QLatin1Char('0'));
-  }
-  case Type::ASCII:
-  {
-    const char value = accessors->ReadU8(guard, address);
-    return Common::IsPrintableCharacter(value) ? QString{QChar::fromLatin1(value)} :
-                                                 QString{QChar::fromLatin1('.')};
-  }
-  case Type::Hex16:
-  {
-    const u16 value = accessors->ReadU16(guard, address);
-    return QStringLiteral("%1").arg(value, 4, 16, QLatin1Char('0'));
-  }
-  case Type::Hex32:
+  switch (GetTypeSize(type))
   {
-    const u32 value = accessors->ReadU32(guard, address);
-    return QStringLiteral("%1").arg(value, 8, 16, QLatin1Char('0'));
-  }
-  case Type::Hex64:
-  {
-    const u64 value = accessors->ReadU64(guard, address);
-    return QStringLiteral("%1").arg(value, 16, 16, QLatin1Char('0'));
-  }
-  case Type::Unsigned8:
-    return QString::number(accessors->ReadU8(guard, address));
-  case Type::Unsigned16:
-    return QString::number(accessors->ReadU16(guard, address));
-  case Type::Unsigned32:
-    return QString::number(accessors->ReadU32(guard, address));
-  case Type::Signed8:
-    return QString::number(std::bit_cast<s8>(accessors->ReadU8(guard, address)));
-  case Type::Signed16:
-    return QString::number(std::bit_cast<s16>(accessors->ReadU16(guard, address)));
-  case Type::Signed32:
-    return QString::number(std::bit_cast<s32>(accessors->ReadU32(guard, address)));
-  case Type::Float32:
-  {
-    QString string = QString::number(accessors->ReadF32(guard, address), 'g', 4);
-    // Align to first digit.
-    if (!string.startsWith(QLatin1Char('-')))
-      string.prepend(QLatin1Char(' '));
-
-    return string;
-  }
-  case Type::Double:
-  {
-    QString string =
-        QString::number(std::bit_cast<double>(accessors->ReadU64(guard, address)), 'g', 4);
-    // Align to first digit.
-    if (!string.startsWith(QLatin1Char('-')))
-      string.prepend(QLatin1Char(' '));
-
-    return string;
-  }
+  case 1:
+    return FormatValue(accessors->ReadU8(guard, address), type);
+  case 2:
+    return FormatValue(accessors->ReadU16(guard, address), type);
+  case 4:
+    return FormatValue(accessors->ReadU32(guard, address), type);
   default:
-    return std::nullopt;
+    return FormatValue(accessors->ReadU64(guard, address), type);
   }
 }
 
@@ -97,6 +97,7 @@ public:
   void UpdateSymbols();
   void UpdateOnFrameEnd();
   void GetValues();
+  void GetValuesUnsynchronized();
   void UpdateFont(const QFont& font);
   void ToggleBreakpoint(u32 addr, bool row);
 
@@ -130,6 +131,7 @@ private:
   void ScrollbarActionTriggered(int action);
   void ScrollbarSliderReleased();
 
+  Type GetDualViewType() const;
   std::optional<QString> ValueToString(const Core::CPUThreadGuard& guard, u32 address, Type type);
 
   Core::System& m_system;
@@ -3,22 +3,46 @@
 
 #include "DolphinQt/GameList/GridProxyModel.h"
 
+#include <algorithm>
+#include <utility>
+
 #include <QImage>
 #include <QPainter>
 #include <QPixmap>
 #include <QSize>
 
 #include "DolphinQt/GameList/GameListModel.h"
+#include "DolphinQt/QtUtils/QueueOnObject.h"
+#include "DolphinQt/Resources.h"
 
 #include "Core/Config/UISettings.h"
 
 #include "UICommon/GameFile.h"
 
 const QSize LARGE_BANNER_SIZE(144, 48);
+const QSize COVER_SIZE(160, 224);
+const QSize MISSING_BANNER_SIZE(96, 32);
+
+// In KiB, enough for several screens' worth of covers
+constexpr int PIXMAP_CACHE_SIZE = 128 * 1024;
 
-GridProxyModel::GridProxyModel(QObject* parent) : QSortFilterProxyModel(parent)
+GridProxyModel::GridProxyModel(QObject* parent)
+    : QSortFilterProxyModel(parent), m_pixmap_cache(PIXMAP_CACHE_SIZE)
 {
   setDynamicSortFilter(true);
+
+  m_render_thread.Reset("GridProxyModel Render", [this](ImageRequest request) {
+    const QString path = QString::fromStdString(request.game->GetFilePath());
+    QImage image = RenderImage(request);
+    QueueOnObject(this, [this, path, request = std::move(request), image = std::move(image)] {
+      OnImageRendered(path, request, image);
+    });
+  });
+}
+
+GridProxyModel::~GridProxyModel()
+{
+  m_render_thread.StopAndCancel();
 }
 
 QVariant GridProxyModel::data(const QModelIndex& i, int role) const
@@ -33,43 +57,92 @@ QVariant GridProxyModel::data(const QModelIndex& i, int role) const
   else if (role == Qt::DecorationRole)
   {
     auto* model = static_cast<GameListModel*>(sourceModel());
+    const std::shared_ptr<const UICommon::GameFile> game = model->GetGameFile(source_index.row());
 
-    const auto& buffer = model->GetGameFile(source_index.row())->GetCoverImage().buffer;
+    const bool use_cover =
+        Config::Get(Config::MAIN_USE_GAME_COVERS) && !game->GetCoverImage().buffer.empty();
+    const QSize size = (use_cover ? COVER_SIZE : LARGE_BANNER_SIZE) * model->GetScale() *
+                       QPixmap().devicePixelRatio();
 
-    QSize size = Config::Get(Config::MAIN_USE_GAME_COVERS) ? QSize(160, 224) : LARGE_BANNER_SIZE;
-    QPixmap pixmap(size * model->GetScale() * QPixmap().devicePixelRatio());
+    const QString path = QString::fromStdString(game->GetFilePath());
+    const CachedPixmap* cached = m_pixmap_cache.object(path);
+    const bool same_game = cached && cached->game.lock() == game;
+    if (same_game && cached->size == size && cached->use_cover == use_cover)
+      return cached->pixmap;
 
-    if (buffer.empty() || !Config::Get(Config::MAIN_USE_GAME_COVERS))
+    if (!m_pending_images.contains(path))
     {
-      QPixmap banner = model
-                           ->data(model->index(source_index.row(),
-                                               static_cast<int>(GameListModel::Column::Banner)),
-                                  Qt::DecorationRole)
-                           .value<QPixmap>();
-
-      banner = banner.scaled(pixmap.size(), Qt::KeepAspectRatio, Qt::SmoothTransformation);
-
-      pixmap.fill();
-
-      QPainter painter(&pixmap);
+      if (m_missing_banner.isNull())
+      {
+        m_missing_banner = Resources::GetMisc(Resources::MiscID::BannerMissing)
+                               .pixmap(MISSING_BANNER_SIZE)
+                               .toImage();
+      }
+
+      m_pending_images.insert(path, QPersistentModelIndex(i));
+      m_render_thread.EmplaceItem(ImageRequest{game, size, use_cover, m_missing_banner});
+    }
 
-      painter.drawPixmap(0, pixmap.height() / 2 - banner.height() / 2, banner.width(),
-                         banner.height(), banner);
+    // Keep showing the old tile while it's being rescaled.
+    if (same_game)
+      return cached->pixmap;
 
-      return pixmap;
-    }
-    else
+    if (m_placeholder.size() != size)
     {
-      pixmap = QPixmap::fromImage(QImage::fromData(
-          reinterpret_cast<const unsigned char*>(&buffer[0]), static_cast<int>(buffer.size())));
-
-      return pixmap.scaled(QSize(160, 224) * model->GetScale() * pixmap.devicePixelRatio(),
-                           Qt::KeepAspectRatio, Qt::SmoothTransformation);
+      m_placeholder = QPixmap(size);
+      m_placeholder.fill();
     }
+    return m_placeholder;
   }
   return QVariant();
 }
 
+QImage GridProxyModel::RenderImage(const ImageRequest& request)
+{
+  if (request.use_cover)
+  {
+    const auto& buffer = request.game->GetCoverImage().buffer;
+    const QImage cover = QImage::fromData(reinterpret_cast<const unsigned char*>(buffer.data()),
+                                          static_cast<int>(buffer.size()));
+    if (!cover.isNull())
+      return cover.scaled(request.size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  }
+
+  const UICommon::GameBanner& game_banner = request.game->GetBannerImage();
+  QImage banner = request.missing_banner;
+  if (!game_banner.empty())
+  {
+    const auto* ptr = reinterpret_cast<const uchar*>(game_banner.buffer.data());
+    banner = QImage(ptr, game_banner.width, game_banner.height, QImage::Format_RGBX8888)
+                 .rgbSwapped();
+  }
+  banner = banner.scaled(request.size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+  QImage image(request.size, QImage::Format_ARGB32_Premultiplied);
+  image.fill(Qt::white);
+
+  QPainter painter(&image);
+  painter.drawImage(0, image.height() / 2 - banner.height() / 2, banner);
+  painter.end();
+
+  return image;
+}
+
+void GridProxyModel::OnImageRendered(const QString& path, const ImageRequest& request,
+                                     const QImage& image)
+{
+  QPixmap pixmap = QPixmap::fromImage(image);
+  const int cost = std::max<int>(static_cast<int>(pixmap.width() * pixmap.height() * 4 / 1024), 1);
+  m_pixmap_cache.insert(path, new CachedPixmap{request.game, request.size, request.use_cover,
+                                               std::move(pixmap)},
+                        cost);
+
+  // If the tile changed size or game in the meantime, this asks for it to be rendered again.
+  const QPersistentModelIndex index = m_pending_images.take(path);
+  if (index.isValid())
+    emit dataChanged(index, index, {Qt::DecorationRole});
+}
+
 bool GridProxyModel::filterAcceptsRow(int source_row, const QModelIndex& source_parent) const
 {
   GameListModel* glm = qobject_cast<GameListModel*>(sourceModel());
@@ -3,19 +3,70 @@
 
 #pragma once
 
+#include <memory>
+
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QPersistentModelIndex>
+#include <QPixmap>
+#include <QSize>
 #include <QSortFilterProxyModel>
+#include <QString>
+
+#include "Common/WorkQueueThread.h"
+
+namespace UICommon
+{
+class GameFile;
+}
 
 // This subclass of QSortFilterProxyModel transforms the raw data into a
 // single-column large icon + name to be displayed in a QListView.
+//
+// Decoding and scaling covers is too slow to do on the UI thread for every tile that gets painted,
+// so it happens on a worker thread the first time a tile is requested. A blank tile is shown until
+// then, and the results are kept in a cache of recently shown tiles.
 class GridProxyModel final : public QSortFilterProxyModel
 {
   Q_OBJECT
 
 public:
   explicit GridProxyModel(QObject* parent = nullptr);
+  ~GridProxyModel() override;
+
   QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
 
 protected:
   bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
   bool lessThan(const QModelIndex& left, const QModelIndex& right) const override;
+
+private:
+  struct ImageRequest
+  {
+    std::shared_ptr<const UICommon::GameFile> game;
+    QSize size;
+    bool use_cover;
+    QImage missing_banner;
+  };
+
+  struct CachedPixmap
+  {
+    std::weak_ptr<const UICommon::GameFile> game;
+    QSize size;
+    bool use_cover;
+    QPixmap pixmap;
+  };
+
+  // Runs on the worker thread.
+  static QImage RenderImage(const ImageRequest& request);
+
+  void OnImageRendered(const QString& path, const ImageRequest& request, const QImage& image);
+
+  mutable QCache<QString, CachedPixmap> m_pixmap_cache;
+  // The tiles which are being rendered, by game path.
+  mutable QHash<QString, QPersistentModelIndex> m_pending_images;
+  mutable QImage m_missing_banner;
+  mutable QPixmap m_placeholder;
+  mutable Common::WorkQueueThread<ImageRequest> m_render_thread;
 };
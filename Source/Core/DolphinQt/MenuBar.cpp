@@ -24,6 +24,7 @@
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/StringUtil.h"
+#include "Common/Trace.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CommonTitles.h"
@@ -31,7 +32,9 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
 #include "Core/Debugger/RSO.h"
+#include "Core/Debugger/SamplingProfiler.h"
 #include "Core/HLE/HLE.h"
 #include "Core/HW/AddressSpace.h"
 #include "Core/HW/Memmap.h"
@@ -144,6 +147,7 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   {
     m_recording_stop->setEnabled(false);
     m_recording_export->setEnabled(false);
+    m_recording_seek->setEnabled(false);
   }
   const bool can_start_from_boot = m_game_selected && state == Core::State::Uninitialized;
   const bool can_start_from_savestate =
@@ -164,6 +168,10 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_search_instruction->setEnabled(running);
   m_jit_wipe_profiling_data->setEnabled(jit_exists);
   m_jit_write_cache_log_dump->setEnabled(jit_exists);
+  m_jit_write_event_trace->setEnabled(running);
+  // Recording stops when emulation does.
+  m_jit_record_guest_profile->setChecked(
+      Core::System::GetInstance().GetPowerPC().GetSamplingProfiler().IsRunning());
 
   // Symbols
   m_symbols->setEnabled(running);
@@ -178,6 +186,8 @@ void MenuBar::OnConfigChanged()
 {
   const QSignalBlocker blocker(m_jit_profile_blocks);
   m_jit_profile_blocks->setChecked(Config::Get(Config::MAIN_DEBUG_JIT_ENABLE_PROFILING));
+  const QSignalBlocker event_blocker(m_jit_profile_events);
+  m_jit_profile_events->setChecked(Config::Get(Config::MAIN_DEBUG_EVENT_PROFILING));
 }
 
 void MenuBar::OnDebugModeToggled(bool enabled)
@@ -240,6 +250,76 @@ void MenuBar::OnWriteJitBlockLogDump()
   }
 }
 
+void MenuBar::OnWriteEventTrace()
+{
+  const std::string filename = fmt::format("{}{}_events.json", File::GetUserPath(D_DUMPDEBUG_IDX),
+                                           SConfig::GetInstance().GetGameID());
+  auto& system = Core::System::GetInstance();
+  bool success;
+  {
+    Core::CPUThreadGuard guard(system);
+    success = system.GetCoreTiming().WriteEventTrace(filename);
+  }
+  if (!success)
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\".").arg(QString::fromStdString(filename)));
+}
+
+void MenuBar::OnWriteGuestProfile()
+{
+  // Stops the recording, so that the profile isn't written while it's being updated.
+  m_jit_record_guest_profile->setChecked(false);
+
+  const auto& profiler = Core::System::GetInstance().GetPowerPC().GetSamplingProfiler();
+  const std::string path = fmt::format("{}{}_profile", File::GetUserPath(D_DUMPDEBUG_IDX),
+                                       SConfig::GetInstance().GetGameID());
+  const std::string folded_filename = path + ".folded";
+  const std::string report_filename = path + ".txt";
+  const auto show_error = [this](const std::string& filename) {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+  };
+  if (!profiler.WriteFoldedStacks(folded_filename))
+  {
+    show_error(folded_filename);
+    return;
+  }
+  if (!profiler.WriteReport(report_filename))
+  {
+    show_error(report_filename);
+    return;
+  }
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\" and \"%2\".")
+                                   .arg(QString::fromStdString(folded_filename))
+                                   .arg(QString::fromStdString(report_filename)));
+}
+
+void MenuBar::OnWriteThreadTrace()
+{
+  // Stops the recording, so that the trace ends where it was written.
+  m_jit_record_thread_trace->setChecked(false);
+
+  const std::string filename = fmt::format("{}{}_trace.json", File::GetUserPath(D_DUMPDEBUG_IDX),
+                                           SConfig::GetInstance().GetGameID());
+  if (!Common::Trace::WriteChromeTrace(filename))
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\".").arg(QString::fromStdString(filename)));
+}
+
 void MenuBar::AddFileMenu()
 {
   QMenu* file_menu = addMenu(tr("&File"));
@@ -823,11 +903,14 @@ void MenuBar::AddMovieMenu()
                                            [this] { emit StopRecording(); });
   m_recording_export =
       movie_menu->addAction(tr("Export Recording..."), this, [this] { emit ExportRecording(); });
+  m_recording_seek =
+      movie_menu->addAction(tr("Seek to Frame..."), this, [this] { emit SeekRecording(); });
 
   m_recording_start->setEnabled(false);
   m_recording_play->setEnabled(false);
   m_recording_stop->setEnabled(false);
   m_recording_export->setEnabled(false);
+  m_recording_seek->setEnabled(false);
 
   m_recording_read_only = movie_menu->addAction(tr("&Read-Only Mode"));
   m_recording_read_only->setCheckable(true);
@@ -968,6 +1051,45 @@ void MenuBar::AddJITMenu()
 
   m_jit->addSeparator();
 
+  m_jit_profile_events = m_jit->addAction(tr("Enable Event Profiling"));
+  m_jit_profile_events->setCheckable(true);
+  m_jit_profile_events->setChecked(Config::Get(Config::MAIN_DEBUG_EVENT_PROFILING));
+  connect(m_jit_profile_events, &QAction::toggled, [](bool enabled) {
+    Config::SetBaseOrCurrent(Config::MAIN_DEBUG_EVENT_PROFILING, enabled);
+  });
+  m_jit_write_event_trace =
+      m_jit->addAction(tr("Write Event Trace"), this, &MenuBar::OnWriteEventTrace);
+
+  m_jit->addSeparator();
+
+  m_jit_record_thread_trace = m_jit->addAction(tr("Record Thread Trace"));
+  m_jit_record_thread_trace->setCheckable(true);
+  m_jit_record_thread_trace->setChecked(Common::Trace::IsRunning());
+  connect(m_jit_record_thread_trace, &QAction::toggled, [](bool enabled) {
+    if (enabled)
+      Common::Trace::Start();
+    else
+      Common::Trace::Stop();
+  });
+  m_jit_write_thread_trace =
+      m_jit->addAction(tr("Write Thread Trace"), this, &MenuBar::OnWriteThreadTrace);
+
+  m_jit_record_guest_profile = m_jit->addAction(tr("Record Guest Profile"));
+  m_jit_record_guest_profile->setCheckable(true);
+  m_jit_record_guest_profile->setEnabled(Core::SamplingProfiler::IsSupported());
+  connect(m_jit_record_guest_profile, &QAction::toggled, [](bool enabled) {
+    auto& system = Core::System::GetInstance();
+    auto& profiler = system.GetPowerPC().GetSamplingProfiler();
+    if (enabled)
+      profiler.Start(system);
+    else
+      profiler.Stop();
+  });
+  m_jit_write_guest_profile =
+      m_jit->addAction(tr("Write Guest Profile"), this, &MenuBar::OnWriteGuestProfile);
+
+  m_jit->addSeparator();
+
   m_jit_off = m_jit->addAction(tr("JIT Off (JIT Core)"));
   m_jit_off->setCheckable(true);
   m_jit_off->setChecked(Config::Get(Config::MAIN_DEBUG_JIT_OFF));
@@ -1443,6 +1565,7 @@ void MenuBar::OnRecordingStatusChanged(bool recording)
   m_recording_start->setEnabled(!recording && (can_start_from_boot || can_start_from_savestate));
   m_recording_stop->setEnabled(recording);
   m_recording_export->setEnabled(recording);
+  m_recording_seek->setEnabled(recording);
 }
 
 void MenuBar::OnReadOnlyModeChanged(bool read_only)
@@ -126,6 +126,7 @@ signals:
   void StartRecording();
   void StopRecording();
   void ExportRecording();
+  void SeekRecording();
   void ShowTASInput();
 
   void SelectionChanged(std::shared_ptr<const UICommon::GameFile> game_file);
@@ -196,6 +197,9 @@ private:
   void OnDebugModeToggled(bool enabled);
   void OnWipeJitBlockProfilingData();
   void OnWriteJitBlockLogDump();
+  void OnWriteEventTrace();
+  void OnWriteThreadTrace();
+  void OnWriteGuestProfile();
 
   QString GetSignatureSelector() const;
 
@@ -247,6 +251,7 @@ private:
 
   // Movie
   QAction* m_recording_export;
+  QAction* m_recording_seek;
   QAction* m_recording_play;
   QAction* m_recording_start;
   QAction* m_recording_stop;
@@ -287,6 +292,12 @@ private:
   QAction* m_jit_profile_blocks;
   QAction* m_jit_wipe_profiling_data;
   QAction* m_jit_write_cache_log_dump;
+  QAction* m_jit_profile_events;
+  QAction* m_jit_write_event_trace;
+  QAction* m_jit_record_thread_trace;
+  QAction* m_jit_write_thread_trace;
+  QAction* m_jit_record_guest_profile;
+  QAction* m_jit_write_guest_profile;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
   QAction* m_jit_loadstore_lbzx_off;
@@ -65,6 +65,7 @@
 
 #include "VideoCommon/NetPlayChatUI.h"
 #include "VideoCommon/NetPlayGolfUI.h"
+#include "VideoCommon/NetPlayLatencyUI.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace
@@ -208,6 +209,14 @@ void NetPlayDialog::CreateMainLayout()
   m_network_mode_group->addAction(m_golf_mode_action);
   m_fixed_delay_action->setChecked(true);
 
+  m_network_menu->addSeparator();
+  m_adaptive_buffer_action = m_network_menu->addAction(tr("Adaptive Buffer"));
+  m_adaptive_buffer_action->setToolTip(
+      tr("Automatically adjusts the buffer to the measured ping and jitter of the players.
+"
+         "Only used in Fair Input Delay mode."));
+  m_adaptive_buffer_action->setCheckable(true);
+
   m_game_digest_menu = m_menu_bar->addMenu(tr("Checksum"));
   m_game_digest_menu->addAction(tr("Current game"), this, [this] {
     Settings::Instance().GetNetPlayServer()->ComputeGameDigest(m_current_game_identifier);
@@ -230,6 +239,8 @@ void NetPlayDialog::CreateMainLayout()
   m_record_input_action->setCheckable(true);
   m_golf_mode_overlay_action = m_other_menu->addAction(tr("Show Golf Mode Overlay"));
   m_golf_mode_overlay_action->setCheckable(true);
+  m_latency_graph_overlay_action = m_other_menu->addAction(tr("Show Latency Graph Overlay"));
+  m_latency_graph_overlay_action->setCheckable(true);
   m_hide_remote_gbas_action = m_other_menu->addAction(tr("Hide Remote GBAs"));
   m_hide_remote_gbas_action->setCheckable(true);
 
@@ -421,6 +432,8 @@ void NetPlayDialog::ConnectWidgets()
   connect(m_host_input_authority_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_golf_mode_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_golf_mode_overlay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
+  connect(m_latency_graph_overlay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
+  connect(m_adaptive_buffer_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_fixed_delay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_hide_remote_gbas_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
 }
@@ -881,6 +894,9 @@ void NetPlayDialog::OnMsgStartGame()
     g_netplay_golf_ui = std::make_unique<NetPlayGolfUI>(Settings::Instance().GetNetPlayClient());
   }
 
+  g_netplay_latency_ui =
+      std::make_unique<NetPlayLatencyUI>(Settings::Instance().GetNetPlayClient());
+
   QueueOnObject(this, [this] {
     const auto client = Settings::Instance().GetNetPlayClient();
 
@@ -899,6 +915,7 @@ void NetPlayDialog::OnMsgStopGame()
 {
   g_netplay_chat_ui.reset();
   g_netplay_golf_ui.reset();
+  g_netplay_latency_ui.reset();
   QueueOnObject(this, [this] { UpdateDiscordPresence(); });
 }
 
@@ -1135,6 +1152,8 @@ void NetPlayDialog::LoadSettings()
   const bool record_inputs = Config::Get(Config::NETPLAY_RECORD_INPUTS);
   const bool strict_settings_sync = Config::Get(Config::NETPLAY_STRICT_SETTINGS_SYNC);
   const bool golf_mode_overlay = Config::Get(Config::NETPLAY_GOLF_MODE_OVERLAY);
+  const bool latency_graph_overlay = Config::Get(Config::NETPLAY_LATENCY_GRAPH_OVERLAY);
+  const bool adaptive_buffer = Config::Get(Config::NETPLAY_ADAPTIVE_BUFFER);
   const bool hide_remote_gbas = Config::Get(Config::NETPLAY_HIDE_REMOTE_GBAS);
 
   m_buffer_size_box->setValue(buffer_size);
@@ -1151,6 +1170,8 @@ void NetPlayDialog::LoadSettings()
   m_record_input_action->setChecked(record_inputs);
   m_strict_settings_sync_action->setChecked(strict_settings_sync);
   m_golf_mode_overlay_action->setChecked(golf_mode_overlay);
+  m_latency_graph_overlay_action->setChecked(latency_graph_overlay);
+  m_adaptive_buffer_action->setChecked(adaptive_buffer);
   m_hide_remote_gbas_action->setChecked(hide_remote_gbas);
 
   const std::string network_mode = Config::Get(Config::NETPLAY_NETWORK_MODE);
@@ -1194,6 +1215,9 @@ void NetPlayDialog::SaveSettings()
   Config::SetBase(Config::NETPLAY_RECORD_INPUTS, m_record_input_action->isChecked());
   Config::SetBase(Config::NETPLAY_STRICT_SETTINGS_SYNC, m_strict_settings_sync_action->isChecked());
   Config::SetBase(Config::NETPLAY_GOLF_MODE_OVERLAY, m_golf_mode_overlay_action->isChecked());
+  Config::SetBase(Config::NETPLAY_LATENCY_GRAPH_OVERLAY,
+                  m_latency_graph_overlay_action->isChecked());
+  Config::SetBase(Config::NETPLAY_ADAPTIVE_BUFFER, m_adaptive_buffer_action->isChecked());
   Config::SetBase(Config::NETPLAY_HIDE_REMOTE_GBAS, m_hide_remote_gbas_action->isChecked());
 
   std::string network_mode;
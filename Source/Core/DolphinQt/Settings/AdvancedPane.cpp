@@ -91,6 +91,16 @@ void AdvancedPane::CreateLayout()
          "needed.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>"));
   cpu_options_group_layout->addWidget(m_accurate_cpu_cache_checkbox);
 
+  m_thread_placement_checkbox =
+      new ConfigBool(tr("Optimize Thread Placement"), Config::MAIN_THREAD_PLACEMENT);
+  m_thread_placement_checkbox->SetDescription(
+      tr("Keeps the emulated CPU and GPU threads on the fastest cores, and moves shader compiling "
+         "to the slower cores of CPUs which have performance and efficiency cores.<br>Only has an "
+         "effect on CPUs with cores of different speeds or several separate caches.<br>Takes "
+         "effect when emulation starts.<br><br><dolphin_emphasis>If unsure, leave this "
+         "checked.</dolphin_emphasis>"));
+  cpu_options_group_layout->addWidget(m_thread_placement_checkbox);
+
   auto* const timing_group = new QGroupBox(tr("Timing"));
   main_layout->addWidget(timing_group);
   auto* timing_group_layout = new QVBoxLayout{timing_group};
@@ -315,6 +325,7 @@ void AdvancedPane::Update()
   m_cpu_emulation_engine_combobox->setEnabled(is_uninitialized);
   m_enable_mmu_checkbox->setEnabled(is_uninitialized);
   m_pause_on_panic_checkbox->setEnabled(is_uninitialized);
+  m_thread_placement_checkbox->setEnabled(is_uninitialized);
 
   {
     QFont bf = font();
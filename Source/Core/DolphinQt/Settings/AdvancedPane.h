@@ -38,6 +38,7 @@ private:
   ConfigBool* m_enable_mmu_checkbox;
   ConfigBool* m_pause_on_panic_checkbox;
   ConfigBool* m_accurate_cpu_cache_checkbox;
+  ConfigBool* m_thread_placement_checkbox;
   ConfigBool* m_cpu_clock_override_checkbox;
   ConfigFloatSlider* m_cpu_clock_override_slider;
   QLabel* m_cpu_label;
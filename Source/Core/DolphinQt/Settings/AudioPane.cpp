@@ -160,20 +160,21 @@ void AudioPane::CreateWidgets()
   auto* playback_layout = new QGridLayout;
   playback_box->setLayout(playback_layout);
 
-  ConfigSlider* audio_buffer_size = new ConfigSlider(16, 512, Config::MAIN_AUDIO_BUFFER_SIZE, 8);
+  ConfigSlider* audio_buffer_size = new ConfigSlider(4, 512, Config::MAIN_AUDIO_BUFFER_SIZE, 8);
   QLabel* audio_buffer_size_label = new QLabel;
 
-  audio_buffer_size->setSingleStep(8);
+  audio_buffer_size->setSingleStep(4);
   audio_buffer_size->setPageStep(8);
 
   audio_buffer_size->SetDescription(
       tr("Controls the number of audio samples buffered."
-         " Lower values reduce latency but may cause more crackling or stuttering."
+         " Lower values reduce latency but may cause more crackling or stuttering. The buffer is"
+         " automatically kept large enough for the amount of audio the backend requests at once."
          "<br><br><dolphin_emphasis>If unsure, set this to 80 ms.</dolphin_emphasis>"));
 
   // Connect the slider to update the value label live
   connect(audio_buffer_size, &QSlider::valueChanged, this, [=](int value) {
-    int stepped_value = (value / 8) * 8;
+    int stepped_value = (value / 4) * 4;
     audio_buffer_size->setValue(stepped_value);
     audio_buffer_size_label->setText(tr("%1 ms").arg(stepped_value));
   });
@@ -198,6 +198,15 @@ void GameCubePane::CreateWidgets()
   gba_layout->addWidget(m_gba_threads, gba_row, 0, 1, -1);
   gba_row++;
 
+  m_gba_relaxed_sync = new QCheckBox(tr("Let GBA Cores Run Ahead of Link Transfers"));
+  m_gba_relaxed_sync->setToolTip(
+      tr("Lets GBA cores in dedicated threads run slightly ahead of the emulated GameCube, so link "
+         "transfers don't have to wait for them to catch up. This speeds up games with several "
+         "connected GBAs, but makes link timing inaccurate.<br><br>Has no effect during NetPlay "
+         "or while recording or playing back a movie."));
+  gba_layout->addWidget(m_gba_relaxed_sync, gba_row, 0, 1, -1);
+  gba_row++;
+
   m_gba_bios_edit = new QLineEdit();
   m_gba_browse_bios = new NonDefaultQPushButton(QStringLiteral("..."));
   gba_layout->addWidget(new QLabel(tr("BIOS:")), gba_row, 0);
@@ -273,6 +282,7 @@ void GameCubePane::ConnectWidgets()
 #ifdef HAS_LIBMGBA
   // GBA Settings
   connect(m_gba_threads, &QCheckBox::stateChanged, this, &GameCubePane::SaveSettings);
+  connect(m_gba_relaxed_sync, &QCheckBox::stateChanged, this, &GameCubePane::SaveSettings);
   connect(m_gba_bios_edit, &QLineEdit::editingFinished, this, &GameCubePane::SaveSettings);
   connect(m_gba_browse_bios, &QPushButton::clicked, this, &GameCubePane::BrowseGBABios);
   connect(m_gba_save_rom_path, &QCheckBox::stateChanged, this, &GameCubePane::SaveRomPathChanged);
@@ -296,6 +306,7 @@ void GameCubePane::OnEmulationStateChanged()
 #ifdef HAS_LIBMGBA
   bool gba_enabled = !NetPlay::IsNetPlayRunning();
   m_gba_threads->setEnabled(gba_enabled);
+  m_gba_relaxed_sync->setEnabled(gba_enabled);
   m_gba_bios_edit->setEnabled(gba_enabled);
   m_gba_browse_bios->setEnabled(gba_enabled);
   m_gba_save_rom_path->setEnabled(gba_enabled);
@@ -752,6 +763,7 @@ void GameCubePane::LoadSettings()
 #ifdef HAS_LIBMGBA
   // GBA Settings
   SignalBlocking(m_gba_threads)->setChecked(Config::Get(Config::MAIN_GBA_THREADS));
+  SignalBlocking(m_gba_relaxed_sync)->setChecked(Config::Get(Config::MAIN_GBA_RELAXED_SYNC));
   SignalBlocking(m_gba_bios_edit)
       ->setText(QString::fromStdString(File::GetUserPath(F_GBABIOS_IDX)));
   SignalBlocking(m_gba_save_rom_path)->setChecked(Config::Get(Config::MAIN_GBA_SAVES_IN_ROM_PATH));
@@ -795,6 +807,7 @@ void GameCubePane::SaveSettings()
   if (!NetPlay::IsNetPlayRunning())
   {
     Config::SetBaseOrCurrent(Config::MAIN_GBA_THREADS, m_gba_threads->isChecked());
+    Config::SetBaseOrCurrent(Config::MAIN_GBA_RELAXED_SYNC, m_gba_relaxed_sync->isChecked());
     Config::SetBaseOrCurrent(Config::MAIN_GBA_BIOS_PATH, m_gba_bios_edit->text().toStdString());
     Config::SetBaseOrCurrent(Config::MAIN_GBA_SAVES_IN_ROM_PATH, m_gba_save_rom_path->isChecked());
     Config::SetBaseOrCurrent(Config::MAIN_GBA_SAVES_PATH, m_gba_saves_edit->text().toStdString());
@@ -72,6 +72,7 @@ private:
   Common::EnumMap<QLineEdit*, ExpansionInterface::MAX_MEMCARD_SLOT> m_gci_paths;
 
   QCheckBox* m_gba_threads;
+  QCheckBox* m_gba_relaxed_sync;
   QCheckBox* m_gba_save_rom_path;
   QPushButton* m_gba_browse_bios;
   QLineEdit* m_gba_bios_edit;
@@ -90,6 +90,7 @@ void GeneralPane::OnEmulationStateChanged(Core::State state)
 
   m_checkbox_dualcore->setEnabled(!running);
   m_checkbox_cheats->setEnabled(!running);
+  m_checkbox_gecko_native_writes->setEnabled(!running);
   m_checkbox_override_region_settings->setEnabled(!running);
 #ifdef USE_DISCORD_PRESENCE
   m_checkbox_discord_presence->setEnabled(!running);
@@ -145,6 +146,10 @@ void GeneralPane::CreateBasic()
   m_checkbox_cheats = new ConfigBool(tr("Enable Cheats"), Config::MAIN_ENABLE_CHEATS);
   basic_group_layout->addWidget(m_checkbox_cheats);
 
+  m_checkbox_gecko_native_writes =
+      new ConfigBool(tr("Apply Gecko Write Codes Natively"), Config::MAIN_GECKO_NATIVE_WRITES);
+  basic_group_layout->addWidget(m_checkbox_gecko_native_writes);
+
   m_checkbox_override_region_settings =
       new ConfigBool(tr("Allow Mismatched Region Settings"), Config::MAIN_OVERRIDE_REGION_SETTINGS);
   basic_group_layout->addWidget(m_checkbox_override_region_settings);
@@ -377,6 +382,12 @@ void GeneralPane::AddDescriptions()
       "These codes can be configured with the Cheats Manager in the Tools menu."
       "<br><br>This setting cannot be changed while emulation is active."
       "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static constexpr char TR_GECKO_NATIVE_WRITES_DESCRIPTION[] = QT_TR_NOOP(
+      "Applies Gecko codes which only write constant values to memory directly, instead of "
+      "running them in the emulated Gecko code handler. This reduces the time taken by many "
+      "active codes, but breaks codes which rely on the base address set by an earlier code."
+      "<br><br>This setting cannot be changed while emulation is active."
+      "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static constexpr char TR_OVERRIDE_REGION_SETTINGS_DESCRIPTION[] =
       QT_TR_NOOP("Lets you use languages and other region-related settings that the game may not "
                  "be designed for. May cause various crashes and bugs."
@@ -441,6 +452,8 @@ void GeneralPane::AddDescriptions()
 
   m_checkbox_cheats->SetDescription(tr(TR_CHEATS_DESCRIPTION));
 
+  m_checkbox_gecko_native_writes->SetDescription(tr(TR_GECKO_NATIVE_WRITES_DESCRIPTION));
+
   m_checkbox_override_region_settings->SetDescription(tr(TR_OVERRIDE_REGION_SETTINGS_DESCRIPTION));
 
   m_checkbox_auto_disc_change->SetDescription(tr(TR_AUTO_DISC_CHANGE_DESCRIPTION));
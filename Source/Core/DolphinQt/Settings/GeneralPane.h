@@ -47,6 +47,7 @@ private:
   ToolTipComboBox* m_combobox_fallback_region;
   ConfigBool* m_checkbox_dualcore;
   ConfigBool* m_checkbox_cheats;
+  ConfigBool* m_checkbox_gecko_native_writes;
   ConfigBool* m_checkbox_override_region_settings;
   ConfigBool* m_checkbox_auto_disc_change;
 #ifdef USE_DISCORD_PRESENCE
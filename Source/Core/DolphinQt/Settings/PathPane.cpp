@@ -110,6 +110,18 @@ void PathPane::BrowseWFS()
   }
 }
 
+void PathPane::BrowseShaderCache()
+{
+  const QString dir = QDir::toNativeSeparators(DolphinFileDialog::getExistingDirectory(
+      this, tr("Select Shader Cache Path"),
+      QString::fromStdString(File::GetUserPath(D_SHADERCACHE_IDX))));
+  if (!dir.isEmpty())
+  {
+    m_shader_cache_edit->setText(dir);
+    Config::SetBase(Config::MAIN_SHADER_CACHE_PATH, dir.toStdString());
+  }
+}
+
 void PathPane::OnNANDPathChanged()
 {
   Config::SetBase(Config::MAIN_FS_PATH, m_nand_edit->text().toStdString());
@@ -232,6 +244,18 @@ QGridLayout* PathPane::MakePathsLayout()
   layout->addWidget(m_wfs_edit, 5, 1);
   layout->addWidget(wfs_open, 5, 2);
 
+  // Several instances of Dolphin can use the same shader cache at once.
+  m_shader_cache_edit =
+      new QLineEdit(QString::fromStdString(File::GetUserPath(D_SHADERCACHE_IDX)));
+  connect(m_shader_cache_edit, &QLineEdit::editingFinished, [this] {
+    Config::SetBase(Config::MAIN_SHADER_CACHE_PATH, m_shader_cache_edit->text().toStdString());
+  });
+  QPushButton* shader_cache_open = new NonDefaultQPushButton(QStringLiteral("..."));
+  connect(shader_cache_open, &QPushButton::clicked, this, &PathPane::BrowseShaderCache);
+  layout->addWidget(new QLabel(tr("Shader Cache Path:")), 6, 0);
+  layout->addWidget(m_shader_cache_edit, 6, 1);
+  layout->addWidget(shader_cache_open, 6, 2);
+
   return layout;
 }
 
@@ -25,6 +25,7 @@ private:
   void BrowseLoad();
   void BrowseResourcePack();
   void BrowseWFS();
+  void BrowseShaderCache();
   QGroupBox* MakeGameFolderBox();
   QGridLayout* MakePathsLayout();
   void RemovePath();
@@ -38,6 +39,7 @@ private:
   QLineEdit* m_load_edit;
   QLineEdit* m_resource_pack_edit;
   QLineEdit* m_wfs_edit;
+  QLineEdit* m_shader_cache_edit;
 
   QPushButton* m_remove_path;
 };
@@ -3,11 +3,16 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
@@ -15,6 +20,8 @@
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -56,6 +63,243 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+namespace
+{
+struct ConversionSettings
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+  bool zstd_dictionary;
+};
+
+// In batch mode, several files are converted at once, so each message is printed with the name
+// of the file it's about.
+class MessagePrinter
+{
+public:
+  explicit MessagePrinter(std::string prefix) : m_prefix(std::move(prefix)) {}
+
+  template <typename... Args>
+  void Print(fmt::format_string<Args...> format, Args&&... args) const
+  {
+    const std::string message = fmt::format(format, std::forward<Args>(args)...);
+    std::lock_guard lk(s_mutex);
+    fmt::print(std::cerr, "{}{}\n", m_prefix, message);
+  }
+
+private:
+  static inline std::mutex s_mutex;
+  std::string m_prefix;
+};
+}  // namespace
+
+static const char* GetExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
+static bool ConvertFile(const std::string& input_file_path, const std::string& output_file_path,
+                        const ConversionSettings& settings, const MessagePrinter& printer,
+                        u64* bytes_converted)
+{
+  const DiscIO::BlobType format = settings.format;
+  const bool scrub = settings.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    printer.Print("Error: The input file could not be opened.");
+    return false;
+  }
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      printer.Print("Error: Scrubbing is only supported for GC/Wii disc images.");
+      return false;
+    }
+
+    printer.Print("Warning: The input file is not a GC/Wii disc image. Continuing anyway.");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      printer.Print("Error: Scrubbing a Datel disc is not supported.");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      printer.Print("Error: Unable to process disc image. Try again without --scrub.");
+      return false;
+    }
+  }
+
+  if (scrub && format == DiscIO::BlobType::RVZ)
+  {
+    printer.Print("Warning: Scrubbing an RVZ container does not offer significant space "
+                  "advantages. Continuing anyway.");
+  }
+
+  if (scrub && format == DiscIO::BlobType::PLAIN)
+  {
+    printer.Print("Warning: Scrubbing does not save space when converting to ISO unless "
+                  "using external compression. Continuing anyway.");
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    printer.Print("Warning: Converting Wii disc images to GCZ without scrubbing may not "
+                  "offer space advantages over ISO. Continuing anyway.");
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    printer.Print(
+        "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.");
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(settings.block_size.value(), volume->GetDataSize()))
+  {
+    printer.Print("Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
+                  "must be an integer multiple of the block size and must not be an integer "
+                  "multiple of the block size multiplied by 32. Continuing anyway.");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   settings.block_size.value(), NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, output_file_path, format == DiscIO::BlobType::RVZ,
+        settings.compression.value(), settings.compression_level.value(),
+        settings.block_size.value(), NOOP_STATUS_CALLBACK, settings.zstd_dictionary);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  if (!success)
+  {
+    printer.Print("Error: Conversion failed");
+    return false;
+  }
+
+  *bytes_converted = blob_reader->GetDataSize();
+  return true;
+}
+
+static int ConvertBatch(const std::vector<std::string>& input_file_paths,
+                        const std::string& output_directory, const ConversionSettings& settings,
+                        int jobs)
+{
+  const auto start_time = std::chrono::steady_clock::now();
+
+  std::atomic<size_t> next_index = 0;
+  std::atomic<size_t> files_succeeded = 0;
+  std::atomic<u64> total_bytes_converted = 0;
+  const auto worker = [&] {
+    for (size_t i = next_index++; i < input_file_paths.size(); i = next_index++)
+    {
+      const std::string& input_file_path = input_file_paths[i];
+      std::string name;
+      SplitPath(WithUnifiedPathSeparators(input_file_path), nullptr, &name, nullptr);
+      const std::string output_file_path =
+          output_directory + '/' + name + GetExtension(settings.format);
+
+      const MessagePrinter printer(input_file_path + ": ");
+      if (File::Exists(output_file_path))
+      {
+        printer.Print("Error: The output file {} already exists", output_file_path);
+        continue;
+      }
+
+      u64 bytes_converted = 0;
+      if (ConvertFile(input_file_path, output_file_path, settings, printer, &bytes_converted))
+      {
+        printer.Print("Converted to {}", output_file_path);
+        ++files_succeeded;
+        total_bytes_converted += bytes_converted;
+      }
+    }
+  };
+
+  // The compression work of all jobs shares the same pool of CPU slots (see GetCompressionSlots),
+  // so running several jobs mainly serves to overlap the I/O of one job with the compression of
+  // another.
+  std::vector<std::thread> threads;
+  for (int i = 1; i < jobs; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  const double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  const double mebibytes = total_bytes_converted / double(1024 * 1024);
+  fmt::print(std::cout, "Converted {} of {} files, {:.1f} MiB in {:.1f} s ({:.1f} MiB/s)\n",
+             files_succeeded.load(), input_file_paths.size(), mebibytes, seconds,
+             seconds > 0 ? mebibytes / seconds : 0.0);
+
+  return files_succeeded == input_file_paths.size() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -81,6 +325,19 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Path to the destination FILE.")
       .metavar("FILE");
 
+  parser.add_option("-d", "--output_directory")
+      .type("string")
+      .action("store")
+      .help("Batch mode: convert every input FILE into this DIRECTORY, keeping the file names. "
+            "Input files can be passed as positional arguments.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Batch mode: number of files to convert at the same time. Default is 2.")
+      .set_default(2);
+
   parser.add_option("-f", "--format")
       .type("string")
       .action("store")
@@ -110,7 +367,14 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("--zstd_dictionary")
+      .action("store_true")
+      .help("Train a Zstandard dictionary from the disc and store it in the RVZ file. This "
+            "improves the compression ratio for small block sizes, but the file can only be read "
+            "by newer versions of Dolphin.");
+
   const optparse::Values& options = parser.parse_args(args);
+  const bool batch_mode = options.is_set("output_directory");
 
   // Initialize the dolphin user directory, required for temporary processing files
   // If this is not set, destructive file operations could occur due to path confusion
@@ -120,96 +384,51 @@ int ConvertCommand(const std::vector<std::string>& args)
   // Validate options
 
   // --input
-  if (!options.is_set("input"))
+  std::vector<std::string> input_file_paths = parser.args();
+  if (options.is_set("input"))
+    input_file_paths.insert(input_file_paths.begin(), options["input"]);
+  if (input_file_paths.empty())
   {
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
-
-  // --output
-  if (!options.is_set("output"))
+  if (input_file_paths.size() > 1 && !batch_mode)
   {
-    fmt::print(std::cerr, "Error: No output set\n");
+    fmt::print(std::cerr, "Error: Converting multiple files requires --output_directory\n");
     return EXIT_FAILURE;
   }
-  const std::string& output_file_path = options["output"];
 
-  // --format
-  const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
-  if (!format_o.has_value())
+  // --output, --output_directory
+  if (batch_mode == options.is_set("output"))
   {
-    fmt::print(std::cerr, "Error: No output format set\n");
+    fmt::print(std::cerr, "Error: Exactly one of --output and --output_directory must be set\n");
     return EXIT_FAILURE;
   }
-  const DiscIO::BlobType format = format_o.value();
-
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
+  if (batch_mode && !File::IsDirectory(options["output_directory"]))
   {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
+    fmt::print(std::cerr, "Error: The output directory does not exist\n");
     return EXIT_FAILURE;
   }
 
-  // --scrub
-  const bool scrub = static_cast<bool>(options.get("scrub"));
-
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
+  // --jobs
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 1)
   {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
-  if (scrub && format == DiscIO::BlobType::RVZ)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
-                          "advantages. Continuing anyway.\n");
-  }
-
-  if (scrub && format == DiscIO::BlobType::PLAIN)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing does not save space when converting to ISO unless "
-                          "using external compression. Continuing anyway.\n");
+    fmt::print(std::cerr, "Error: The number of jobs must be at least 1\n");
+    return EXIT_FAILURE;
   }
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  // --format
+  const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
+  if (!format_o.has_value())
   {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
+    fmt::print(std::cerr, "Error: No output format set\n");
+    return EXIT_FAILURE;
   }
+  const DiscIO::BlobType format = format_o.value();
 
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
+  // --scrub
+  const bool scrub = static_cast<bool>(options.get("scrub"));
 
   // --block_size
   std::optional<int> block_size_o;
@@ -237,15 +456,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,55 +506,25 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
-
-  switch (format)
-  {
-  case DiscIO::BlobType::PLAIN:
-  {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
-  }
-
-  case DiscIO::BlobType::GCZ:
+  // --zstd_dictionary
+  const bool zstd_dictionary = static_cast<bool>(options.get("zstd_dictionary"));
+  if (zstd_dictionary && (format != DiscIO::BlobType::RVZ ||
+                          compression_o != DiscIO::WIARVZCompressionType::Zstd))
   {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
-    {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
-    }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
+    fmt::print(std::cerr, "Error: A Zstandard dictionary can only be used for RVZ with zstd\n");
+    return EXIT_FAILURE;
   }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
-  {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
-  }
+  const ConversionSettings settings{
+      format, scrub, block_size_o, compression_o, compression_level_o, zstd_dictionary};
 
-  default:
-  {
-    ASSERT(false);
-    break;
-  }
-  }
+  if (batch_mode)
+    return ConvertBatch(input_file_paths, options["output_directory"], settings, jobs);
 
-  if (!success)
+  u64 bytes_converted;
+  if (!ConvertFile(input_file_paths.front(), options["output"], settings, MessagePrinter(""),
+                   &bytes_converted))
   {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
     return EXIT_FAILURE;
   }
 
@@ -0,0 +1,115 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TexturePackCommand.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+#include "VideoCommon/Assets/TextureAssetUtils.h"
+
+namespace DolphinTool
+{
+static constexpr std::string_view TEXTURE_PREFIX = "tex1_";
+
+// Mip levels are stored in separate files named like their base level with a _mip<N> suffix,
+// and are picked up together with the base level
+static bool IsMipLevelFile(std::string_view filename)
+{
+  const size_t mip_index = filename.rfind("_mip");
+  if (mip_index == std::string_view::npos || mip_index + 4 == filename.size())
+    return false;
+
+  return filename.substr(mip_index + 4).find_first_not_of("0123456789") == std::string_view::npos;
+}
+
+int TexturePackCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: texturepack [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the custom texture DIRECTORY.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the destination texture pack FILE.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const std::string& input_path = options["input"];
+  if (input_path.empty() || !File::IsDirectory(input_path))
+  {
+    fmt::print(std::cerr, "Error: No input directory set\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string& output_path = options["output"];
+  if (output_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  VideoCommon::TexturePackWriter writer;
+  if (!writer.Open(output_path))
+  {
+    fmt::print(std::cerr, "Error: Unable to create {}\n", output_path);
+    return EXIT_FAILURE;
+  }
+
+  const auto texture_paths = Common::DoFileSearch({input_path}, {".png", ".dds"}, true);
+  for (const auto& path : texture_paths)
+  {
+    std::string filename;
+    SplitPath(path, nullptr, &filename, nullptr);
+    if (!filename.starts_with(TEXTURE_PREFIX) || IsMipLevelFile(filename))
+      continue;
+
+    const size_t arb_index = filename.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      filename.erase(arb_index, 4);
+
+    VideoCommon::CustomTextureData data;
+    if (!VideoCommon::LoadTextureDataFromFile(filename, StringToPath(path),
+                                              AbstractTextureType::Texture_2D, &data) ||
+        !VideoCommon::PurgeInvalidMipsFromTextureData(filename, &data))
+    {
+      fmt::print(std::cerr, "Warning: Skipping {}, it could not be loaded\n", path);
+      continue;
+    }
+
+    if (!writer.AddTexture(filename, has_arbitrary_mipmaps, data))
+      fmt::print(std::cerr, "Warning: Skipping {}, it could not be added\n", path);
+  }
+
+  if (!writer.Finish())
+  {
+    fmt::print(std::cerr, "Error: Unable to write {}\n", output_path);
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Packed {} textures into {}\n", writer.GetNumTextures(), output_path);
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -4,6 +4,7 @@
 #include "InputCommon/ControlReference/ExpressionParser.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <functional>
@@ -280,6 +281,11 @@ Expression* Expression::GetLValue()
   return this;
 }
 
+void Expression::Compile(CompiledExpression& program)
+{
+  program.AddExpression(this);
+}
+
 class ControlExpression : public Expression
 {
 public:
@@ -303,7 +309,7 @@ public:
     // FYI: Clamping values greater than 1.0 is purposely not done to support unbounded values in
     // the future. (e.g. raw accelerometer/gyro data)
 
-    return std::max(0.0, m_input->GetState());
+    return std::max(0.0, m_device->GetInputState(m_input_index));
   }
   void SetValue(ControlState value) override
   {
@@ -311,11 +317,31 @@ public:
       m_output->SetState(value);
   }
   int CountNumControls() const override { return (m_input || m_output) ? 1 : 0; }
+  void Compile(CompiledExpression& program) override
+  {
+    if (m_input)
+      program.AddInput(m_device.get(), m_input_index, m_input);
+    else
+      program.AddConstant(0.0);
+  }
   void UpdateReferences(ControlEnvironment& env) override
   {
     m_device = env.FindDevice(m_qualifier);
     m_input = env.FindInput(m_qualifier);
     m_output = env.FindOutput(m_qualifier);
+
+    // The index is used to look the input up in the device's input state snapshots.
+    if (m_input && m_device)
+    {
+      const auto& inputs = m_device->Inputs();
+      m_input_index = std::ranges::find(inputs, m_input) - inputs.begin();
+      if (m_input_index == inputs.size())
+        m_input = nullptr;
+    }
+    else
+    {
+      m_input = nullptr;
+    }
   }
 
   Device::Input* GetInput() const { return m_input; }
@@ -325,6 +351,7 @@ private:
   std::shared_ptr<Device> m_device;
   ControlQualifier m_qualifier;
   Device::Input* m_input = nullptr;
+  size_t m_input_index = 0;
   Device::Output* m_output = nullptr;
 };
 
@@ -449,6 +476,20 @@ public:
     }
   }
 
+  void Compile(CompiledExpression& program) override
+  {
+    const CompiledExpression::BinaryFunction function = GetFunction(op);
+    if (!function)
+    {
+      program.AddExpression(this);
+      return;
+    }
+
+    lhs->Compile(program);
+    rhs->Compile(program);
+    program.AddBinaryFunction(function);
+  }
+
   void SetValue(ControlState value) override
   {
     // Don't do anything special with the op we have.
@@ -467,6 +508,43 @@ public:
     lhs->UpdateReferences(env);
     rhs->UpdateReferences(env);
   }
+
+private:
+  template <TokenType Op>
+  static ControlState Calculate(ControlState lhs_value, ControlState rhs_value)
+  {
+    return CalculateValue(Op, lhs_value, rhs_value);
+  }
+
+  static CompiledExpression::BinaryFunction GetFunction(TokenType op)
+  {
+    switch (op)
+    {
+    case TOK_AND:
+      return &Calculate<TOK_AND>;
+    case TOK_OR:
+      return &Calculate<TOK_OR>;
+    case TOK_ADD:
+      return &Calculate<TOK_ADD>;
+    case TOK_SUB:
+      return &Calculate<TOK_SUB>;
+    case TOK_MUL:
+      return &Calculate<TOK_MUL>;
+    case TOK_DIV:
+      return &Calculate<TOK_DIV>;
+    case TOK_MOD:
+      return &Calculate<TOK_MOD>;
+    case TOK_LTHAN:
+      return &Calculate<TOK_LTHAN>;
+    case TOK_GTHAN:
+      return &Calculate<TOK_GTHAN>;
+    case TOK_XOR:
+      return &Calculate<TOK_XOR>;
+    default:
+      // Assignments and commas have side effects.
+      return nullptr;
+    }
+  }
 };
 
 class CompoundAssignmentExpression : public BinaryExpression
@@ -476,6 +554,8 @@ public:
 
   ControlState GetValue() override { return GetLValue()->GetValue(); }
 
+  void Compile(CompiledExpression& program) override { program.AddExpression(this); }
+
   Expression* GetLValue() override
   {
     Expression* const lvalue = lhs->GetLValue();
@@ -512,6 +592,8 @@ public:
 
   ControlState GetValue() override { return m_value; }
 
+  void Compile(CompiledExpression& program) override { program.AddConstant(m_value); }
+
   std::string GetName() const override { return ValueToString(m_value); }
 
 private:
@@ -534,6 +616,14 @@ public:
 
   ControlState GetValue() override { return m_variable_ptr ? *m_variable_ptr : 0; }
 
+  void Compile(CompiledExpression& program) override
+  {
+    if (m_variable_ptr)
+      program.AddVariable(m_variable_ptr.get());
+    else
+      program.AddConstant(0.0);
+  }
+
   void SetValue(ControlState value) override
   {
     if (m_variable_ptr)
@@ -650,6 +740,7 @@ public:
 
   ControlState GetValue() override { return GetActiveChild()->GetValue(); }
   void SetValue(ControlState value) override { GetActiveChild()->SetValue(value); }
+  void Compile(CompiledExpression& program) override { GetActiveChild()->Compile(program); }
 
   int CountNumControls() const override { return GetActiveChild()->CountNumControls(); }
   void UpdateReferences(ControlEnvironment& env) override
@@ -668,6 +759,119 @@ private:
   std::unique_ptr<Expression> m_rhs;
 };
 
+void CompiledExpression::Compile(Expression* expression)
+{
+  m_instructions.clear();
+  m_stack_depth = 0;
+  m_max_stack_depth = 0;
+
+  if (!expression)
+    return;
+
+  expression->Compile(*this);
+
+  if (m_max_stack_depth > MAX_STACK_DEPTH)
+  {
+    m_instructions.clear();
+    m_stack_depth = 0;
+    m_max_stack_depth = 0;
+    AddExpression(expression);
+  }
+}
+
+void CompiledExpression::Push(const Instruction& instruction)
+{
+  m_instructions.push_back(instruction);
+  m_max_stack_depth = std::max(m_max_stack_depth, ++m_stack_depth);
+}
+
+void CompiledExpression::AddConstant(ControlState value)
+{
+  Push({.opcode = Opcode::Constant, .constant = value});
+}
+
+void CompiledExpression::AddInput(Device* device, size_t input_index, Device::Input* input)
+{
+  Push({.opcode = Opcode::Input, .device = device, .input_index = input_index, .input = input});
+}
+
+void CompiledExpression::AddVariable(const ControlState* variable)
+{
+  Push({.opcode = Opcode::Variable, .variable = variable});
+}
+
+void CompiledExpression::AddExpression(Expression* expression)
+{
+  Push({.opcode = Opcode::Expression, .expression = expression});
+}
+
+void CompiledExpression::AddUnaryFunction(UnaryFunction function)
+{
+  Instruction& argument = m_instructions.back();
+  if (argument.opcode == Opcode::Constant)
+  {
+    argument.constant = function(argument.constant);
+    return;
+  }
+
+  m_instructions.push_back({.opcode = Opcode::UnaryFunction, .unary_function = function});
+}
+
+void CompiledExpression::AddBinaryFunction(BinaryFunction function)
+{
+  --m_stack_depth;
+
+  const size_t size = m_instructions.size();
+  Instruction& lhs = m_instructions[size - 2];
+  const Instruction& rhs = m_instructions[size - 1];
+  if (lhs.opcode == Opcode::Constant && rhs.opcode == Opcode::Constant)
+  {
+    lhs.constant = function(lhs.constant, rhs.constant);
+    m_instructions.pop_back();
+    return;
+  }
+
+  m_instructions.push_back({.opcode = Opcode::BinaryFunction, .binary_function = function});
+}
+
+ControlState CompiledExpression::GetValue()
+{
+  std::array<ControlState, MAX_STACK_DEPTH> stack;
+  size_t top = 0;
+
+  for (const Instruction& instruction : m_instructions)
+  {
+    switch (instruction.opcode)
+    {
+    case Opcode::Constant:
+      stack[top++] = instruction.constant;
+      break;
+    case Opcode::Input:
+      // Matches ControlExpression::GetValue.
+      if (s_hotkey_suppressions.IsSuppressed(instruction.input))
+        stack[top++] = 0.0;
+      else
+        stack[top++] = std::max(0.0, instruction.device->GetInputState(instruction.input_index));
+      break;
+    case Opcode::Variable:
+      stack[top++] = *instruction.variable;
+      break;
+    case Opcode::Expression:
+      stack[top++] = instruction.expression->GetValue();
+      break;
+    case Opcode::UnaryFunction:
+      stack[top - 1] = instruction.unary_function(stack[top - 1]);
+      break;
+    case Opcode::BinaryFunction:
+      --top;
+      stack[top - 1] = instruction.binary_function(stack[top - 1], stack[top]);
+      break;
+    }
+  }
+
+  return top != 0 ? stack[0] : 0.0;
+}
+
 std::shared_ptr<Device> ControlEnvironment::FindDevice(const ControlQualifier& qualifier) const
 {
   if (qualifier.has_device)
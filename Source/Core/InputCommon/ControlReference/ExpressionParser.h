@@ -7,7 +7,9 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
+#include "Common/CommonTypes.h"
 #include "InputCommon/ControllerInterface/CoreDevice.h"
 
 namespace ciface::ExpressionParser
@@ -168,6 +170,8 @@ private:
   const Core::DeviceQualifier& default_device;
 };
 
+class CompiledExpression;
+
 class Expression
 {
 public:
@@ -179,6 +183,67 @@ public:
 
   // Perform any side effects and return Expression to be SetValue'd.
   virtual Expression* GetLValue();
+
+  // Appends instructions that compute GetValue() to the program. Expressions with state or side
+  // effects keep the default, which makes the program call GetValue().
+  virtual void Compile(CompiledExpression& program);
+};
+
+// An expression tree lowered to a flat list of stack machine instructions, with constant
+// subexpressions folded and bound inputs accessed directly, so that reading its value doesn't
+// need to walk the tree through virtual calls.
+// The expression must outlive the program, and it has to be recompiled whenever its references
+// are updated.
+class CompiledExpression
+{
+public:
+  using UnaryFunction = ControlState (*)(ControlState);
+  using BinaryFunction = ControlState (*)(ControlState, ControlState);
+
+  void Compile(Expression* expression);
+  ControlState GetValue();
+
+  // Used by Expression::Compile.
+  void AddConstant(ControlState value);
+  void AddInput(Core::Device* device, size_t input_index, Core::Device::Input* input);
+  void AddVariable(const ControlState* variable);
+  void AddExpression(Expression* expression);
+  // These pop their arguments and push the result.
+  void AddUnaryFunction(UnaryFunction function);
+  void AddBinaryFunction(BinaryFunction function);
+
+private:
+  // Programs that would need a deeper stack are evaluated through the expression tree instead.
+  static constexpr size_t MAX_STACK_DEPTH = 32;
+
+  enum class Opcode : u8
+  {
+    Constant,
+    Input,
+    Variable,
+    Expression,
+    UnaryFunction,
+    BinaryFunction,
+  };
+
+  struct Instruction
+  {
+    Opcode opcode;
+    ControlState constant = 0;
+    const ControlState* variable = nullptr;
+    Core::Device* device = nullptr;
+    size_t input_index = 0;
+    Core::Device::Input* input = nullptr;
+    Expression* expression = nullptr;
+    UnaryFunction unary_function = nullptr;
+    BinaryFunction binary_function = nullptr;
+  };
+
+  void Push(const Instruction& instruction);
+
+  std::vector<Instruction> m_instructions;
+  size_t m_stack_depth = 0;
+  size_t m_max_stack_depth = 0;
 };
 
 class ParseResult
@@ -63,7 +63,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return 1.0 - GetArg(0).GetValue(); }
+  static ControlState Calculate(ControlState value) { return 1.0 - value; }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
   void SetValue(ControlState value) override { GetArg(0).SetValue(1.0 - value); }
 };
 
@@ -79,7 +81,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return std::abs(GetArg(0).GetValue()); }
+  static ControlState Calculate(ControlState value) { return std::abs(value); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: sin(expression)
@@ -94,7 +98,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return std::sin(GetArg(0).GetValue()); }
+  static ControlState Calculate(ControlState value) { return std::sin(value); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: cos(expression)
@@ -109,7 +115,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return std::cos(GetArg(0).GetValue()); }
+  static ControlState Calculate(ControlState value) { return std::cos(value); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: tan(expression)
@@ -124,7 +132,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return std::tan(GetArg(0).GetValue()); }
+  static ControlState Calculate(ControlState value) { return std::tan(value); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: asin(expression)
@@ -139,7 +149,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return std::asin(GetArg(0).GetValue()); }
+  static ControlState Calculate(ControlState value) { return std::asin(value); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: acos(expression)
@@ -154,7 +166,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return std::acos(GetArg(0).GetValue()); }
+  static ControlState Calculate(ControlState value) { return std::acos(value); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: atan(expression)
@@ -169,7 +183,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return std::atan(GetArg(0).GetValue()); }
+  static ControlState Calculate(ControlState value) { return std::atan(value); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: atan2(y, x)
@@ -184,10 +200,9 @@ private:
       return ExpectedArguments{"y, x"};
   }
 
-  ControlState GetValue() override
-  {
-    return std::atan2(GetArg(0).GetValue(), GetArg(1).GetValue());
-  }
+  static ControlState Calculate(ControlState y, ControlState x) { return std::atan2(y, x); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: sqrt(expression)
@@ -202,7 +217,9 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override { return std::sqrt(GetArg(0).GetValue()); }
+  static ControlState Calculate(ControlState value) { return std::sqrt(value); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: pow(base, exponent)
@@ -217,7 +234,12 @@ private:
       return ExpectedArguments{"base, exponent"};
   }
 
-  ControlState GetValue() override { return std::pow(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+  static ControlState Calculate(ControlState base, ControlState exponent)
+  {
+    return std::pow(base, exponent);
+  }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: min(a, b)
@@ -232,7 +254,9 @@ private:
       return ExpectedArguments{"a, b"};
   }
 
-  ControlState GetValue() override { return std::min(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+  static ControlState Calculate(ControlState a, ControlState b) { return std::min(a, b); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: max(a, b)
@@ -247,7 +271,9 @@ private:
       return ExpectedArguments{"a, b"};
   }
 
-  ControlState GetValue() override { return std::max(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+  static ControlState Calculate(ControlState a, ControlState b) { return std::max(a, b); }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: clamp(value, min, max)
@@ -342,11 +368,13 @@ private:
       return ExpectedArguments{"expression"};
   }
 
-  ControlState GetValue() override
+  static ControlState Calculate(ControlState value)
   {
     // Subtraction for clarity:
-    return 0.0 - GetArg(0).GetValue();
+    return 0.0 - value;
   }
+  ControlState GetValue() override { return Calculate(GetArg(0).GetValue()); }
+  void Compile(CompiledExpression& program) override { CompileCall(program, &Calculate); }
 };
 
 // usage: plus(expression)
@@ -362,6 +390,7 @@ private:
   }
 
   ControlState GetValue() override { return GetArg(0).GetValue(); }
+  void Compile(CompiledExpression& program) override { GetArg(0).Compile(program); }
 };
 
 // usage: deadzone(input, amount)
@@ -711,6 +740,21 @@ void FunctionExpression::SetArguments(std::vector<std::unique_ptr<Expression>>&&
   m_args = std::move(args);
 }
 
+void FunctionExpression::CompileCall(CompiledExpression& program,
+                                     CompiledExpression::UnaryFunction function)
+{
+  m_args[0]->Compile(program);
+  program.AddUnaryFunction(function);
+}
+
+void FunctionExpression::CompileCall(CompiledExpression& program,
+                                     CompiledExpression::BinaryFunction function)
+{
+  m_args[0]->Compile(program);
+  m_args[1]->Compile(program);
+  program.AddBinaryFunction(function);
+}
+
 Expression& FunctionExpression::GetArg(u32 number)
 {
   return *m_args[number];
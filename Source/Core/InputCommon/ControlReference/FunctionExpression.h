@@ -39,6 +39,10 @@ public:
   void SetValue(ControlState value) override;
 
 protected:
+  // Compiles the arguments followed by a call to the function, for functions without side effects.
+  void CompileCall(CompiledExpression& program, CompiledExpression::UnaryFunction function);
+  void CompileCall(CompiledExpression& program, CompiledExpression::BinaryFunction function);
+
   Expression& GetArg(u32 number);
   u32 GetArgCount() const;
 
@@ -7,6 +7,7 @@
 
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
+#include "Common/Thread.h"
 #include "Core/HW/WiimoteReal/WiimoteReal.h"
 
 #ifdef CIFACE_USE_WIN32
@@ -47,6 +48,9 @@ static thread_local ciface::InputChannel tls_input_channel = ciface::InputChanne
 
 static thread_local bool tls_is_updating_devices = false;
 
+// Incremented on every emulation input update while input snapshots are read.
+static thread_local u64 tls_input_snapshot_generation = 0;
+
 void ControllerInterface::Initialize(const WindowSystemInfo& wsi)
 {
   if (m_is_init)
@@ -187,6 +191,8 @@ void ControllerInterface::Shutdown()
   if (!m_is_init)
     return;
 
+  SetInputPollingRate(0);
+
   // Prevent additional devices from being added during shutdown.
   m_is_init = false;
   // Additional safety measure to avoid InvokeDevicesChangedCallbacks()
@@ -327,6 +333,23 @@ void ControllerInterface::UpdateInput()
   if (!m_is_init)
     return;
 
+  const auto channel = GetCurrentInputChannel();
+  if (m_input_polling_thread_running.IsSet() &&
+      (channel == ciface::InputChannel::SerialInterface ||
+       channel == ciface::InputChannel::Bluetooth))
+  {
+    ciface::Core::Device::SetCurrentSnapshotGeneration(++tls_input_snapshot_generation);
+    UpdateInput(UpdateTarget::InlineDevices);
+  }
+  else
+  {
+    ciface::Core::Device::SetCurrentSnapshotGeneration(0);
+    UpdateInput(UpdateTarget::AllDevices);
+  }
+}
+
+void ControllerInterface::UpdateInput(UpdateTarget target)
+{
   // We add the devices to remove while we still have the "m_devices_mutex" locked.
   // This guarantees that:
   // -We won't try to lock "m_devices_population_mutex" while it was already locked and waiting
@@ -347,15 +370,26 @@ void ControllerInterface::UpdateInput()
 
     tls_is_updating_devices = true;
 
-    for (auto& backend : m_input_backends)
-      backend->UpdateInput(devices_to_remove);
+    if (target != UpdateTarget::InlineDevices)
+    {
+      for (auto& backend : m_input_backends)
+        backend->UpdateInput(devices_to_remove);
+    }
 
     for (const auto& d : m_devices)
     {
+      if (target != UpdateTarget::AllDevices &&
+          d->SupportsInputSnapshots() != (target == UpdateTarget::SnapshotDevices))
+      {
+        continue;
+      }
+
       // Theoretically we could avoid updating input on devices that don't have any references to
       // them, but in practice a few devices types could break in different ways, so we don't
       if (d->UpdateInput() == ciface::Core::DeviceRemoval::Remove)
         devices_to_remove.push_back(d);
+      else if (target == UpdateTarget::SnapshotDevices)
+        d->PublishInputSnapshot();
     }
 
     tls_is_updating_devices = false;
@@ -370,6 +404,40 @@ void ControllerInterface::UpdateInput()
   }
 }
 
+void ControllerInterface::SetInputPollingRate(u32 rate)
+{
+  if (m_input_polling_thread.joinable())
+  {
+    m_input_polling_thread_running.Clear();
+    m_input_polling_thread.join();
+  }
+
+  if (rate == 0 || !m_is_init)
+    return;
+
+  rate = std::clamp(rate, MIN_INPUT_POLLING_RATE, MAX_INPUT_POLLING_RATE);
+  INFO_LOG_FMT(CONTROLLERINTERFACE, "Polling input on a separate thread at {} Hz", rate);
+
+  m_input_polling_thread_running.Set();
+  m_input_polling_thread = std::thread(&ControllerInterface::InputPollingThread, this,
+                                       std::chrono::nanoseconds(std::nano::den / rate));
+}
+
+void ControllerInterface::InputPollingThread(std::chrono::nanoseconds period)
+{
+  Common::SetCurrentThreadName("Input Polling");
+
+  auto next_poll = std::chrono::steady_clock::now();
+  while (m_input_polling_thread_running.IsSet())
+  {
+    UpdateInput(UpdateTarget::SnapshotDevices);
+
+    // Don't try to catch up if polling took longer than the period (e.g. on device hotplug).
+    next_poll = std::max(next_poll + period, std::chrono::steady_clock::now());
+    std::this_thread::sleep_until(next_poll);
+  }
+}
+
 void ControllerInterface::SetCurrentInputChannel(ciface::InputChannel input_channel)
 {
   tls_input_channel = input_channel;
@@ -4,11 +4,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <thread>
 
+#include "Common/CommonTypes.h"
+#include "Common/Flag.h"
 #include "Common/Matrix.h"
 #include "Common/WindowSystemInfo.h"
 #include "InputCommon/ControllerInterface/CoreDevice.h"
@@ -102,6 +106,14 @@ public:
   bool IsInit() const { return m_is_init; }
   void UpdateInput();
 
+  // Polls devices on a dedicated thread at the given rate (in Hz), publishing snapshots of their
+  // input states which the emulation input channels read without taking any locks, instead of
+  // polling them inline. Devices that don't support snapshots are still polled inline.
+  // A rate of 0 stops the thread.
+  void SetInputPollingRate(u32 rate);
+  static constexpr u32 MIN_INPUT_POLLING_RATE = 60;
+  static constexpr u32 MAX_INPUT_POLLING_RATE = 2000;
+
   // Set adjustment from the full render window aspect-ratio to the drawn aspect-ratio.
   // Used to fit mouse cursor inputs to the relevant region of the render window.
   void SetAspectRatioAdjustment(float);
@@ -125,7 +137,18 @@ public:
   WindowSystemInfo GetWindowSystemInfo() const;
 
 private:
+  enum class UpdateTarget
+  {
+    AllDevices,
+    // Backends and devices that support input snapshots, on the input polling thread.
+    SnapshotDevices,
+    // Devices that don't support input snapshots, while the input polling thread is running.
+    InlineDevices,
+  };
+
   void ClearDevices();
+  void UpdateInput(UpdateTarget target);
+  void InputPollingThread(std::chrono::nanoseconds period);
 
   std::list<std::function<void()>> m_devices_changed_callbacks;
   mutable std::recursive_mutex m_devices_population_mutex;
@@ -140,6 +163,9 @@ private:
   std::atomic<bool> m_requested_mouse_centering = false;
 
   std::vector<std::unique_ptr<ciface::InputBackend>> m_input_backends;
+
+  std::thread m_input_polling_thread;
+  Common::Flag m_input_polling_thread_running;
 };
 
 namespace ciface
@@ -21,6 +21,8 @@ namespace ciface::Core
 // Note: Detect() logic assumes this is greater than 0.5.
 constexpr ControlState INPUT_DETECT_THRESHOLD = 0.55;
 
+static thread_local u64 tls_snapshot_generation = 0;
+
 class CombinedInput final : public Device::Input
 {
 public:
@@ -72,6 +74,8 @@ std::optional<int> Device::GetPreferredId() const
 void Device::AddInput(Device::Input* const i)
 {
   m_inputs.push_back(i);
+  if (dynamic_cast<RelativeInput*>(i))
+    m_has_relative_inputs = true;
 }
 
 void Device::AddOutput(Device::Output* const o)
@@ -79,6 +83,46 @@ void Device::AddOutput(Device::Output* const o)
   m_outputs.push_back(o);
 }
 
+void Device::PublishInputSnapshot()
+{
+  std::vector<ControlState>& snapshot = m_input_snapshots[m_published_snapshot];
+  snapshot.resize(m_inputs.size());
+  for (size_t i = 0; i < m_inputs.size(); ++i)
+    snapshot[i] = m_inputs[i]->GetState();
+
+  m_published_snapshot =
+      m_shared_snapshot.exchange(m_published_snapshot | SNAPSHOT_FRESH, std::memory_order_acq_rel) &
+      SNAPSHOT_INDEX_MASK;
+}
+
+void Device::SetCurrentSnapshotGeneration(u64 generation)
+{
+  tls_snapshot_generation = generation;
+}
+
+ControlState Device::GetInputState(size_t index)
+{
+  const u64 generation = tls_snapshot_generation;
+  if (generation == 0 || m_has_relative_inputs)
+    return m_inputs[index]->GetState();
+
+  if (m_latched_generation != generation)
+  {
+    m_latched_generation = generation;
+    if (m_shared_snapshot.load(std::memory_order_relaxed) & SNAPSHOT_FRESH)
+    {
+      m_latched_snapshot =
+          m_shared_snapshot.exchange(m_latched_snapshot, std::memory_order_acq_rel) &
+          SNAPSHOT_INDEX_MASK;
+    }
+  }
+
+  const std::vector<ControlState>& snapshot = m_input_snapshots[m_latched_snapshot];
+  if (index >= snapshot.size())
+    return m_inputs[index]->GetState();
+  return snapshot[index];
+}
+
 std::string Device::GetQualifiedName() const
 {
   return fmt::format("{}/{}/{}", GetSource(), GetId(), GetName());
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <limits>
 #include <memory>
@@ -160,6 +162,23 @@ public:
   Input* FindInput(std::string_view name) const;
   Output* FindOutput(std::string_view name) const;
 
+  // Input state snapshots allow a device to be polled on the input polling thread while the
+  // emulation thread reads the states of its inputs without taking any locks.
+  // Devices with relative inputs don't support them, as those are tracked per input channel.
+  bool SupportsInputSnapshots() const { return !m_has_relative_inputs; }
+
+  // Captures the current state of all inputs. Only called by the input polling thread.
+  void PublishInputSnapshot();
+
+  // Makes the current thread read input states from snapshots. Each device picks up its latest
+  // snapshot once per generation, so all reads within one generation see the same snapshot.
+  // Only one thread may read snapshots. A generation of 0 makes the thread read live states.
+  static void SetCurrentSnapshotGeneration(u64 generation);
+
+  // Returns the state of Inputs()[index], from the latest snapshot if the current thread reads
+  // snapshots and one was published, or the live state otherwise.
+  ControlState GetInputState(size_t index);
+
 protected:
   void AddInput(Input* const i);
   void AddOutput(Output* const o);
@@ -179,6 +198,17 @@ private:
   int m_id = 0;
   std::vector<Input*> m_inputs;
   std::vector<Output*> m_outputs;
+  bool m_has_relative_inputs = false;
+
+  // Triple buffer: the polling thread fills m_input_snapshots[m_published_snapshot] and swaps it
+  // with the shared one, which the emulation thread swaps with m_latched_snapshot when it's newer.
+  static constexpr u8 SNAPSHOT_INDEX_MASK = 0x3;
+  static constexpr u8 SNAPSHOT_FRESH = 0x4;
+  std::array<std::vector<ControlState>, 3> m_input_snapshots;
+  std::atomic<u8> m_shared_snapshot = 1;
+  u8 m_published_snapshot = 0;
+  u8 m_latched_snapshot = 2;
+  u64 m_latched_generation = 0;
 };
 
 //
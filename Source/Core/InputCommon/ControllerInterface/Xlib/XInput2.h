@@ -93,11 +93,10 @@ private:
     std::string name;
   };
 
-  class RelativeMouse : public Input
+  class RelativeMouse : public RelativeInput
   {
   public:
     std::string GetName() const override { return name; }
-    bool IsDetectable() const override { return false; }
     RelativeMouse(u8 index, bool positive, const float* axis);
     ControlState GetState() const override;
 
@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstring>
 #include <mutex>
 #include <optional>
 
@@ -61,6 +63,10 @@ namespace GCAdapter
 
 constexpr unsigned int USB_TIMEOUT_MS = 100;
 
+// Input reports are read through several queued transfers, so that a transfer is always pending
+// when the adapter sends a new report, even while the previous one is being processed.
+constexpr size_t READ_TRANSFER_COUNT = 4;
+
 static bool CheckDeviceAccess(libusb_device* device);
 static void AddGCAdapter(libusb_device* device);
 static void ResetRumbleLockNeeded();
@@ -114,16 +120,27 @@ constexpr size_t CONTROLLER_OUTPUT_RUMBLE_PAYLOAD_SIZE = 5;
 
 struct PortState
 {
+  // Only access with s_read_mutex held!
   GCPadStatus origin = {};
-  GCPadStatus status = {};
 
-  ControllerType controller_type = ControllerType::None;
-  bool is_new_connection = false;
+  std::atomic<ControllerType> controller_type = ControllerType::None;
+  std::atomic<bool> is_new_connection = false;
 };
 
-// Only access with s_mutex held!
 static std::array<PortState, SerialInterface::MAX_SI_CHANNELS> s_port_states;
 
+// The latest status of all ports and when it was received. It's written by the thread processing
+// input reports and read by Input without locking, through a sequence lock: the sequence number is
+// odd while an update is in progress, and readers retry if it changed while they were reading.
+struct InputState
+{
+  std::array<GCPadStatus, SerialInterface::MAX_SI_CHANNELS> status = {};
+  TimePoint timestamp = {};
+};
+
+static InputState s_input_state;
+static std::atomic<u32> s_input_state_sequence = 0;
+
 static std::array<u8, CONTROLLER_OUTPUT_RUMBLE_PAYLOAD_SIZE> s_controller_write_payload;
 static std::atomic<int> s_controller_write_payload_size{0};
 
@@ -145,6 +162,19 @@ static std::thread s_adapter_detect_thread;
 static Common::Flag s_adapter_detect_thread_running;
 
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
+struct ReadTransfer
+{
+  libusb_transfer* transfer = nullptr;
+  std::array<u8, CONTROLLER_INPUT_PAYLOAD_EXPECTED_SIZE> buffer = {};
+  std::atomic<bool> is_pending = false;
+};
+
+static std::array<ReadTransfer, READ_TRANSFER_COUNT> s_read_transfers;
+static std::atomic<size_t> s_pending_read_transfer_count = 0;
+// Set when a read transfer completes without being resubmitted.
+static Common::Event s_read_transfer_stopped;
+static Common::Flag s_read_transfer_io_error;
+
 static Common::Event s_hotplug_event;
 
 static std::function<void(void)> s_detect_callback;
@@ -171,6 +201,109 @@ static std::optional<Config::ConfigChangedCallbackID> s_config_callback_id = std
 static bool s_is_adapter_wanted = false;
 static std::array<bool, SerialInterface::MAX_SI_CHANNELS> s_config_rumble_enabled{};
 
+static void WriteInputState(const InputState& state)
+{
+  const u32 sequence = s_input_state_sequence.load(std::memory_order_relaxed);
+  s_input_state_sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(&s_input_state, &state, sizeof(state));
+  s_input_state_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+static InputState ReadInputState()
+{
+  InputState state;
+  u32 sequence;
+  do
+  {
+    sequence = s_input_state_sequence.load(std::memory_order_acquire);
+    std::memcpy(&state, &s_input_state, sizeof(state));
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((sequence & 1) != 0 ||
+           sequence != s_input_state_sequence.load(std::memory_order_relaxed));
+  return state;
+}
+
+static void ResetPortStates()
+{
+  {
+    std::lock_guard lk(s_read_mutex);
+    for (PortState& port_state : s_port_states)
+    {
+      port_state.origin = {};
+      port_state.controller_type = ControllerType::None;
+      port_state.is_new_connection = false;
+    }
+  }
+  WriteInputState({});
+}
+
+#if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
+static void LIBUSB_CALL ReadTransferCallback(libusb_transfer* transfer)
+{
+  auto* const read_transfer = static_cast<ReadTransfer*>(transfer->user_data);
+
+  switch (transfer->status)
+  {
+  case LIBUSB_TRANSFER_COMPLETED:
+    ProcessInputPayload(transfer->buffer, transfer->actual_length);
+    break;
+  case LIBUSB_TRANSFER_TIMED_OUT:
+  case LIBUSB_TRANSFER_CANCELLED:
+    break;
+  case LIBUSB_TRANSFER_ERROR:
+    ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: transfer failed with an I/O error");
+    s_read_transfer_io_error.Set();
+    break;
+  default:
+    ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: transfer failed: {}",
+                  static_cast<int>(transfer->status));
+    break;
+  }
+
+  // Resubmit right away unless something went wrong, which the read thread deals with.
+  if ((transfer->status == LIBUSB_TRANSFER_COMPLETED ||
+       transfer->status == LIBUSB_TRANSFER_TIMED_OUT) &&
+      s_read_adapter_thread_running.IsSet())
+  {
+    const int error = libusb_submit_transfer(transfer);
+    if (error == LIBUSB_SUCCESS)
+      return;
+
+    ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: libusb_submit_transfer failed: {}",
+                  LibusbUtils::ErrorWrap(error));
+  }
+
+  read_transfer->is_pending = false;
+  s_pending_read_transfer_count.fetch_sub(1);
+  s_read_transfer_stopped.Set();
+}
+
+static void SubmitReadTransfers()
+{
+  for (ReadTransfer& read_transfer : s_read_transfers)
+  {
+    if (read_transfer.is_pending)
+      continue;
+
+    libusb_fill_interrupt_transfer(read_transfer.transfer, s_handle, s_endpoint_in,
+                                   read_transfer.buffer.data(), int(read_transfer.buffer.size()),
+                                   ReadTransferCallback, &read_transfer, USB_TIMEOUT_MS);
+    read_transfer.is_pending = true;
+    s_pending_read_transfer_count.fetch_add(1);
+
+    const int error = libusb_submit_transfer(read_transfer.transfer);
+    if (error != LIBUSB_SUCCESS)
+    {
+      ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: libusb_submit_transfer failed: {}",
+                    LibusbUtils::ErrorWrap(error));
+      read_transfer.is_pending = false;
+      s_pending_read_transfer_count.fetch_sub(1);
+    }
+  }
+}
+#endif
+
 static void ReadThreadFunc()
 {
   Common::SetCurrentThreadName("GCAdapter Read Thread");
@@ -207,25 +340,25 @@ static void ReadThreadFunc()
   // Reset rumble once on initial reading
   ResetRumble();
 
+#if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
+  // The reports are processed by the transfer callbacks, on the libusb event thread. This thread
+  // only restarts the transfers when something went wrong.
+  for (ReadTransfer& read_transfer : s_read_transfers)
+    read_transfer.transfer = libusb_alloc_transfer(0);
+  SubmitReadTransfers();
+#endif
+
   while (s_read_adapter_thread_running.IsSet())
   {
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
-    std::array<u8, CONTROLLER_INPUT_PAYLOAD_EXPECTED_SIZE> input_buffer;
+    s_read_transfer_stopped.WaitFor(std::chrono::milliseconds(USB_TIMEOUT_MS));
 
-    int payload_size = 0;
-    int error = libusb_interrupt_transfer(s_handle, s_endpoint_in, input_buffer.data(),
-                                          int(input_buffer.size()), &payload_size, USB_TIMEOUT_MS);
-    if (error != LIBUSB_SUCCESS)
-    {
-      ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: libusb_interrupt_transfer failed: {}",
-                    LibusbUtils::ErrorWrap(error));
-    }
-    if (error == LIBUSB_ERROR_IO)
+    if (s_read_transfer_io_error.TestAndClear())
     {
       // s_read_adapter_thread_running is cleared by the joiner, not the stopper.
 
       // Reset the device, which may trigger a replug.
-      error = libusb_reset_device(s_handle);
+      const int error = libusb_reset_device(s_handle);
       ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: libusb_reset_device: {}",
                     LibusbUtils::ErrorWrap(error));
 
@@ -233,8 +366,8 @@ static void ReadThreadFunc()
       // and cleanup program state without getting another thread to call Reset().
     }
 
-    ProcessInputPayload(input_buffer.data(), payload_size);
-
+    if (s_read_adapter_thread_running.IsSet())
+      SubmitReadTransfers();
 #elif GCADAPTER_USE_ANDROID_IMPLEMENTATION
     const int payload_size = env->CallStaticIntMethod(s_adapter_class, input_func);
     jbyte* const java_data = env->GetByteArrayElements(*java_controller_payload, nullptr);
@@ -248,10 +381,25 @@ static void ReadThreadFunc()
       first_read = false;
       s_fd = env->CallStaticIntMethod(s_adapter_class, getfd_func);
     }
-#endif
 
     Common::YieldCPU();
+#endif
+  }
+
+#if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
+  for (ReadTransfer& read_transfer : s_read_transfers)
+  {
+    if (read_transfer.is_pending)
+      libusb_cancel_transfer(read_transfer.transfer);
   }
+  while (s_pending_read_transfer_count != 0)
+    s_read_transfer_stopped.WaitFor(std::chrono::milliseconds(USB_TIMEOUT_MS));
+  for (ReadTransfer& read_transfer : s_read_transfers)
+  {
+    libusb_free_transfer(read_transfer.transfer);
+    read_transfer.transfer = nullptr;
+  }
+#endif
 
   // Terminate the write thread on leaving
   if (s_write_adapter_thread_running.TestAndClear())
@@ -500,7 +648,7 @@ static void Setup()
   if (s_status == AdapterStatus::Error)
     s_status = AdapterStatus::NotDetected;
 
-  s_port_states.fill({});
+  ResetPortStates();
   s_controller_rumble.fill(0);
 
   const int ret = s_libusb_context->GetDeviceList([](libusb_device* device) {
@@ -731,7 +879,7 @@ static void Reset(CalledFromReadThread called_from_read_thread)
   }
   // The read thread will close the write thread
 
-  s_port_states.fill({});
+  ResetPortStates();
 
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
   s_status = AdapterStatus::NotDetected;
@@ -757,7 +905,7 @@ static void Reset(CalledFromReadThread called_from_read_thread)
   NOTICE_LOG_FMT(CONTROLLERINTERFACE, "GC Adapter detached");
 }
 
-GCPadStatus Input(int chan)
+GCPadStatus Input(int chan, TimePoint* timestamp)
 {
   if (!UseAdapter())
     return {};
@@ -770,18 +918,23 @@ GCPadStatus Input(int chan)
     return {};
 #endif
 
-  std::lock_guard lk(s_read_mutex);
-
   auto& pad_state = s_port_states[chan];
 
   // Return the "origin" state for the first input on a new connection.
   if (pad_state.is_new_connection)
   {
-    pad_state.is_new_connection = false;
-    return pad_state.origin;
+    std::lock_guard lk(s_read_mutex);
+    if (pad_state.is_new_connection)
+    {
+      pad_state.is_new_connection = false;
+      return pad_state.origin;
+    }
   }
 
-  return pad_state.status;
+  const InputState state = ReadInputState();
+  if (timestamp)
+    *timestamp = state.timestamp;
+  return state.status[chan];
 }
 
 // Get ControllerType from first byte in input payload.
@@ -813,7 +966,8 @@ void ProcessInputPayload(const u8* data, std::size_t size)
   }
   else
   {
-    std::lock_guard lk(s_read_mutex);
+    InputState state;
+    state.timestamp = Clock::now();
 
     for (int chan = 0; chan != SerialInterface::MAX_SI_CHANNELS; ++chan)
     {
@@ -878,25 +1032,26 @@ void ProcessInputPayload(const u8* data, std::size_t size)
                        chan + 1, channel_data[0]);
 
         pad.button |= PAD_GET_ORIGIN;
+        std::lock_guard lk(s_read_mutex);
         pad_state.origin = pad;
         pad_state.is_new_connection = true;
       }
 
       pad_state.controller_type = type;
-      pad_state.status = pad;
+      state.status[chan] = pad;
     }
+
+    WriteInputState(state);
   }
 }
 
 bool DeviceConnected(int chan)
 {
-  std::lock_guard lk(s_read_mutex);
   return s_port_states[chan].controller_type != ControllerType::None;
 }
 
 void ResetDeviceType(int chan)
 {
-  std::lock_guard lk(s_read_mutex);
   s_port_states[chan].controller_type = ControllerType::None;
 }
 
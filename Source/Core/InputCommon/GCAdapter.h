@@ -20,7 +20,9 @@ void StopScanThread();
 
 // Buttons have PAD_GET_ORIGIN set on new connection
 // Netplay and CSIDevice_GCAdapter make use of this.
-GCPadStatus Input(int chan);
+// If timestamp isn't null, it's set to when the returned status was received from the adapter
+// (or left alone for the origin state), or to a default TimePoint if nothing was received yet.
+GCPadStatus Input(int chan, TimePoint* timestamp = nullptr);
 
 void Output(int chan, u8 rumble_command);
 bool IsDetected(const char** error_message);
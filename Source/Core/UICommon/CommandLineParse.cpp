@@ -14,6 +14,7 @@
 #include "Common/Config/Config.h"
 #include "Common/StringUtil.h"
 #include "Common/Version.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "Core/Config/MainSettings.h"
 
 namespace CommandLineParse
@@ -22,7 +23,8 @@ class CommandLineConfigLayerLoader final : public Config::ConfigLayerLoader
 {
 public:
   CommandLineConfigLayerLoader(const std::list<std::string>& args, const std::string& video_backend,
-                               const std::string& audio_backend, bool batch, bool debugger)
+                               const std::string& audio_backend,
+                               const std::string& perf_export_file, bool batch, bool debugger)
       : ConfigLayerLoader(Config::LayerType::CommandLine)
   {
     if (!video_backend.empty())
@@ -34,6 +36,9 @@ public:
                             ValueToString(audio_backend == "HLE"));
     }
 
+    if (!perf_export_file.empty())
+      m_values.emplace_back(Config::GFX_PERF_EXPORT_FILE.GetLocation(), perf_export_file);
+
     // Batch mode hides the main window, and render to main hides the render window. To avoid a
     // situation where we would have no window at all, disable render to main when using batch mode.
     if (batch)
@@ -120,10 +125,17 @@ std::unique_ptr<optparse::OptionParser> CreateParser(ParserOptions options)
 
   parser->set_defaults("video_backend", "");
   parser->set_defaults("audio_emulation", "");
+  parser->set_defaults("perf_export", "");
   parser->add_option("-v", "--video_backend").action("store").help("Specify a video backend");
   parser->add_option("-a", "--audio_emulation")
       .choices({"HLE", "LLE"})
       .help("Choose audio emulation from [%choices]");
+  parser->add_option("--perf_export")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Periodically write frame time and thread busy statistics to a CSV file, or to a "
+            "JSON lines file if the name ends with .json");
 
   return parser;
 }
@@ -137,7 +149,7 @@ static void AddConfigLayer(const optparse::Values& options)
   Config::AddLayer(std::make_unique<CommandLineConfigLayerLoader>(
       std::move(config_args), static_cast<const char*>(options.get("video_backend")),
       static_cast<const char*>(options.get("audio_emulation")),
-      static_cast<bool>(options.get("batch")), static_cast<bool>(options.get("debugger"))));
+      static_cast<const char*>(options.get("perf_export")), static_cast<bool>(options.get("batch")), static_cast<bool>(options.get("debugger"))));
 }
 
 optparse::Values& ParseArguments(optparse::OptionParser* parser, int argc, char** argv)
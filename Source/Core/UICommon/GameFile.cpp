@@ -7,6 +7,7 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -99,11 +100,20 @@ GameFile::LookupUsingConfigLanguage(const std::map<DiscIO::Language, std::string
   return Lookup(GetConfigLanguage(), strings);
 }
 
+static s64 GetModificationTime(const std::string& path)
+{
+  std::error_code error;
+  const auto time = std::filesystem::last_write_time(StringToPath(path), error);
+  return error ? 0 : static_cast<s64>(time.time_since_epoch().count());
+}
+
 GameFile::GameFile() = default;
 
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
   m_file_name = PathToFileName(m_file_path);
+  m_file_size_on_host = File::GetSize(m_file_path);
+  m_file_modification_time = GetModificationTime(m_file_path);
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -297,6 +307,8 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_valid);
   p.Do(m_file_path);
   p.Do(m_file_name);
+  p.Do(m_file_size_on_host);
+  p.Do(m_file_modification_time);
 
   p.Do(m_file_size);
   p.Do(m_volume_size);
@@ -336,6 +348,12 @@ void GameFile::DoState(PointerWrap& p)
   m_custom_cover.DoState(p);
 }
 
+bool GameFile::FileChanged() const
+{
+  return File::GetSize(m_file_path) != m_file_size_on_host ||
+         GetModificationTime(m_file_path) != m_file_modification_time;
+}
+
 std::string GameFile::GetExtension() const
 {
   std::string extension;
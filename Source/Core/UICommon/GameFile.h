@@ -113,6 +113,8 @@ public:
   const GameBanner& GetBannerImage() const;
   const GameCover& GetCoverImage() const;
   void DoState(PointerWrap& p);
+  // Returns true if the size or modification time of the file has changed since it was scanned.
+  bool FileChanged() const;
   bool XMLMetadataChanged();
   void XMLMetadataCommit();
   bool WiiBannerChanged();
@@ -145,6 +147,8 @@ private:
   bool m_valid{};
   std::string m_file_path;
   std::string m_file_name;
+  u64 m_file_size_on_host{};
+  s64 m_file_modification_time{};
 
   u64 m_file_size{};
   u64 m_volume_size{};
@@ -4,12 +4,16 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -19,6 +23,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/TaskScheduler.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -26,7 +31,30 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 26;  // Last changed in PR 10084
+static constexpr u32 CACHE_REVISION = 27;
+
+namespace
+{
+enum class RecordType : u32
+{
+  GameFile = 0,
+  Removal = 1,
+};
+
+struct CacheFileHeader
+{
+  u32 revision;
+  u32 padding;
+};
+
+struct RecordHeader
+{
+  RecordType type;
+  u32 size;
+};
+}  // namespace
+
+static_assert(sizeof(RecordHeader) == 8);
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -60,6 +88,80 @@ void GameFileCache::Clear(DeleteOnDisk delete_on_disk)
     File::Delete(m_path);
 
   m_cached_files.clear();
+  m_changed_paths.clear();
+  m_removed_paths.clear();
+  m_num_records_in_file = 0;
+  m_cache_file_in_sync = false;
+}
+
+void GameFileCache::MarkChanged(const std::string& path)
+{
+  m_changed_paths.insert(path);
+}
+
+void GameFileCache::MarkRemoved(const std::string& path)
+{
+  m_changed_paths.erase(path);
+  m_removed_paths.insert(path);
+}
+
+// Creates GameFiles for the paths using background tasks.
+// game_scanned is called on the calling thread for each valid file as soon as it has been scanned.
+static void
+ScanGameFiles(const std::vector<std::string>& paths, const std::atomic_bool& processing_halted,
+              const std::function<void(std::shared_ptr<GameFile>)>& game_scanned)
+{
+  if (paths.empty())
+    return;
+
+  const size_t num_tasks = std::min<size_t>(paths.size(), Common::GetTaskThreadBudget());
+
+  std::atomic<size_t> next_path = 0;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::shared_ptr<GameFile>> scanned_files;
+  size_t running_tasks = num_tasks;
+
+  Common::TaskGroup tasks(Common::TaskPriority::Background);
+  for (size_t i = 0; i < num_tasks; ++i)
+  {
+    tasks.Run([&] {
+      size_t index;
+      while (!processing_halted && (index = next_path++) < paths.size())
+      {
+        auto file = std::make_shared<GameFile>(paths[index]);
+        if (!file->IsValid())
+          continue;
+
+        std::lock_guard lk(mutex);
+        scanned_files.push_back(std::move(file));
+        cv.notify_one();
+      }
+
+      std::lock_guard lk(mutex);
+      --running_tasks;
+      cv.notify_one();
+    });
+  }
+
+  std::vector<std::shared_ptr<GameFile>> files_to_report;
+  std::unique_lock lk(mutex);
+  while (true)
+  {
+    cv.wait(lk, [&] { return !scanned_files.empty() || running_tasks == 0; });
+    if (scanned_files.empty())
+      break;
+
+    std::swap(files_to_report, scanned_files);
+    lk.unlock();
+    for (std::shared_ptr<GameFile>& file : files_to_report)
+      game_scanned(std::move(file));
+    files_to_report.clear();
+    lk.lock();
+  }
+  lk.unlock();
+
+  tasks.Wait();
 }
 
 std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
@@ -76,7 +178,10 @@ std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
   }
   std::shared_ptr<GameFile>& result = found ? *it : m_cached_files.back();
   if (UpdateAdditionalMetadata(&result) || !found)
+  {
+    MarkChanged(path);
     *cache_changed = true;
+  }
 
   return result;
 }
@@ -101,6 +206,8 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
 
   // Delete paths that aren't in game_paths from m_cached_files,
   // while simultaneously deleting paths that are in m_cached_files from game_paths.
+  // Files that have changed on disk are deleted from m_cached_files but kept in game_paths,
+  // so that they get scanned again below.
   // For the sake of speed, we don't care about maintaining the order of m_cached_files.
   {
     auto it = m_cached_files.begin();
@@ -110,15 +217,19 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
       if (processing_halted)
         break;
 
-      if (game_paths.erase((*it)->GetFilePath()))
+      const std::string& path = (*it)->GetFilePath();
+      const auto game_path = game_paths.find(path);
+      if (game_path != game_paths.end() && !(*it)->FileChanged())
       {
+        game_paths.erase(game_path);
         ++it;
       }
       else
       {
         if (game_removed_from_cache)
-          game_removed_from_cache((*it)->GetFilePath());
+          game_removed_from_cache(path);
 
+        MarkRemoved(path);
         cache_changed = true;
         --end;
         *it = std::move(*end);
@@ -129,21 +240,15 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
-  {
-    if (processing_halted)
-      break;
-
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
-    {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
-
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
-    }
-  }
+  const std::vector<std::string> paths_to_scan(game_paths.begin(), game_paths.end());
+  ScanGameFiles(paths_to_scan, processing_halted, [&](std::shared_ptr<GameFile> file) {
+    if (game_added_to_cache)
+      game_added_to_cache(file);
+
+    MarkChanged(file->GetFilePath());
+    cache_changed = true;
+    m_cached_files.push_back(std::move(file));
+  });
 
   return cache_changed;
 }
@@ -159,8 +264,12 @@ bool GameFileCache::UpdateAdditionalMetadata(const GameUpdatedFn& game_updated,
       break;
 
     const bool updated = UpdateAdditionalMetadata(&file);
-    cache_changed |= updated;
-    if (game_updated && updated)
+    if (!updated)
+      continue;
+
+    MarkChanged(file->GetFilePath());
+    cache_changed = true;
+    if (game_updated)
       game_updated(file);
   }
 
@@ -206,79 +315,198 @@ bool GameFileCache::UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_fil
 
 bool GameFileCache::Load()
 {
-  return SyncCacheFile(false);
-}
+  m_cached_files.clear();
+  m_changed_paths.clear();
+  m_removed_paths.clear();
+  m_num_records_in_file = 0;
+  m_cache_file_in_sync = false;
 
-bool GameFileCache::Save()
-{
-  return SyncCacheFile(true);
-}
+  std::vector<u8> buffer;
+  {
+    File::IOFile f(m_path, "rb");
+    if (!f)
+      return false;
 
-bool GameFileCache::SyncCacheFile(bool save)
-{
-  const char* open_mode = save ? "wb" : "rb";
-  File::IOFile f(m_path, open_mode);
-  if (!f)
-    return false;
-  bool success = false;
-  if (save)
+    buffer.resize(f.GetSize());
+    if (buffer.size() < sizeof(CacheFileHeader) || !f.ReadBytes(buffer.data(), buffer.size()))
+      buffer.clear();
+  }
+
+  CacheFileHeader header{};
+  if (buffer.size() >= sizeof(header))
+    std::memcpy(&header, buffer.data(), sizeof(header));
+  if (header.revision != CACHE_REVISION)
   {
-    // Measure the size of the buffer.
-    u8* ptr = nullptr;
-    PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-    DoState(&p_measure);
-    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-    // Then actually do the write.
-    std::vector<u8> buffer(buffer_size);
-    ptr = buffer.data();
-    PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-    DoState(&p, buffer_size);
-    if (f.WriteBytes(buffer.data(), buffer.size()))
-      success = true;
+    File::Delete(m_path);
+    return false;
   }
-  else
+
+  std::unordered_map<std::string, size_t> indices;
+  bool success = true;
+  size_t offset = sizeof(header);
+  while (buffer.size() - offset >= sizeof(RecordHeader))
   {
-    std::vector<u8> buffer(f.GetSize());
-    if (!buffer.empty() && f.ReadBytes(buffer.data(), buffer.size()))
+    RecordHeader record;
+    std::memcpy(&record, buffer.data() + offset, sizeof(record));
+    offset += sizeof(record);
+
+    // A truncated record at the end is what's left of an interrupted append, so it's not an error
+    if (record.size > buffer.size() - offset)
+      break;
+
+    u8* ptr = buffer.data() + offset;
+    offset += record.size;
+    ++m_num_records_in_file;
+
+    if (record.type == RecordType::Removal)
     {
-      u8* ptr = buffer.data();
-      PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
-      DoState(&p, buffer.size());
-      if (p.IsReadMode())
-        success = true;
+      const auto it = indices.find(std::string(reinterpret_cast<const char*>(ptr), record.size));
+      if (it == indices.end())
+        continue;
+
+      // Keep the indices valid while removing the entry by moving the last one into its place
+      const size_t index = it->second;
+      indices.erase(it);
+      if (index != m_cached_files.size() - 1)
+      {
+        m_cached_files[index] = std::move(m_cached_files.back());
+        indices[m_cached_files[index]->GetFilePath()] = index;
+      }
+      m_cached_files.pop_back();
+      continue;
     }
+
+    if (record.type != RecordType::GameFile)
+    {
+      success = false;
+      break;
+    }
+
+    auto file = std::make_shared<GameFile>();
+    PointerWrap p(&ptr, record.size, PointerWrap::Mode::Read);
+    file->DoState(p);
+    if (!p.IsReadMode())
+    {
+      success = false;
+      break;
+    }
+
+    const auto [it, inserted] = indices.try_emplace(file->GetFilePath(), m_cached_files.size());
+    if (inserted)
+      m_cached_files.push_back(std::move(file));
+    else
+      m_cached_files[it->second] = std::move(file);
+  }
+
+  if (!success)
+  {
+    // Try to delete the probably-corrupted cache
+    File::Delete(m_path);
+    m_cached_files.clear();
+    m_num_records_in_file = 0;
+    return false;
   }
+
+  m_cache_file_in_sync = true;
+  return true;
+}
+
+bool GameFileCache::Save()
+{
+  // Outdated records only get dropped when the file is rewritten, which is done once they make
+  // up more than half of the file.
+  const size_t num_records_after_append =
+      m_num_records_in_file + m_changed_paths.size() + m_removed_paths.size();
+  const bool rewrite =
+      !m_cache_file_in_sync || num_records_after_append > m_cached_files.size() * 2;
+
+  const bool success = rewrite ? RewriteCacheFile() : AppendToCacheFile();
+  m_changed_paths.clear();
+  m_removed_paths.clear();
+  m_cache_file_in_sync = success;
   if (!success)
   {
     // If some file operation failed, try to delete the probably-corrupted cache
-    f.Close();
     File::Delete(m_path);
+    m_num_records_in_file = 0;
   }
   return success;
 }
 
-void GameFileCache::DoState(PointerWrap* p, u64 size)
+static bool WriteRecord(File::IOFile& f, RecordType type, const u8* data, size_t size)
+{
+  const RecordHeader header{type, static_cast<u32>(size)};
+  return f.WriteBytes(&header, sizeof(header)) && f.WriteBytes(data, size);
+}
+
+static bool WriteGameFileRecord(File::IOFile& f, GameFile& file, std::vector<u8>* buffer)
+{
+  // Measure the size of the buffer.
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  file.DoState(p_measure);
+  const size_t size = reinterpret_cast<size_t>(ptr);
+
+  // Then actually do the write.
+  buffer->resize(size);
+  ptr = buffer->data();
+  PointerWrap p(&ptr, size, PointerWrap::Mode::Write);
+  file.DoState(p);
+
+  return WriteRecord(f, RecordType::GameFile, buffer->data(), size);
+}
+
+bool GameFileCache::AppendToCacheFile()
 {
-  struct
+  if (m_changed_paths.empty() && m_removed_paths.empty())
+    return true;
+
+  File::IOFile f(m_path, "ab");
+  if (!f)
+    return false;
+
+  // Removals go first, so that a file which was removed and then added again ends up in the cache
+  for (const std::string& path : m_removed_paths)
   {
-    u32 revision;
-    u64 expected_size;
-  } header = {CACHE_REVISION, size};
-  p->Do(header);
-  if (p->IsReadMode())
+    const u8* data = reinterpret_cast<const u8*>(path.data());
+    if (!WriteRecord(f, RecordType::Removal, data, path.size()))
+      return false;
+  }
+  m_num_records_in_file += m_removed_paths.size();
+
+  std::vector<u8> buffer;
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
   {
-    if (header.revision != CACHE_REVISION || header.expected_size != size)
-    {
-      p->SetMeasureMode();
-      return;
-    }
+    if (!m_changed_paths.contains(file->GetFilePath()))
+      continue;
+
+    if (!WriteGameFileRecord(f, *file, &buffer))
+      return false;
+    ++m_num_records_in_file;
   }
-  p->DoEachElement(m_cached_files, [](PointerWrap& state, std::shared_ptr<GameFile>& elem) {
-    if (state.IsReadMode())
-      elem = std::make_shared<GameFile>();
-    elem->DoState(state);
-  });
+
+  return true;
+}
+
+bool GameFileCache::RewriteCacheFile()
+{
+  File::IOFile f(m_path, "wb");
+  if (!f)
+    return false;
+
+  const CacheFileHeader header{CACHE_REVISION, 0};
+  if (!f.WriteBytes(&header, sizeof(header)))
+    return false;
+
+  std::vector<u8> buffer;
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
+  {
+    if (!WriteGameFileRecord(f, *file, &buffer))
+      return false;
+  }
+
+  m_num_records_in_file = m_cached_files.size();
+  return true;
 }
 
 }  // namespace UICommon
@@ -9,12 +9,11 @@
 #include <memory>
 #include <span>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 
-class PointerWrap;
-
 namespace UICommon
 {
 class GameFile;
@@ -47,6 +46,8 @@ public:
   std::shared_ptr<const GameFile> AddOrGet(const std::string& path, bool* cache_changed);
 
   // These functions return true if the call modified the cache.
+  // Update rescans files whose size or modification time has changed, and scans new files on
+  // several threads. The callbacks are only called on the calling thread.
   bool Update(std::span<const std::string> all_game_paths,
               const GameAddedToCacheFn& game_added_to_cache = {},
               const GameRemovedFromCacheFn& game_removed_from_cache = {},
@@ -55,16 +56,28 @@ public:
                                 const std::atomic_bool& processing_halted = false);
 
   bool Load();
+  // Appends the entries that were changed since the last Load or Save to the cache file, or
+  // rewrites the whole file if it has accumulated too many outdated entries.
   bool Save();
 
 private:
   bool UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_file);
 
-  bool SyncCacheFile(bool save);
-  void DoState(PointerWrap* p, u64 size = 0);
+  void MarkChanged(const std::string& path);
+  void MarkRemoved(const std::string& path);
+
+  bool AppendToCacheFile();
+  bool RewriteCacheFile();
 
   std::string m_path;
   std::vector<std::shared_ptr<GameFile>> m_cached_files;
+
+  // The cache file is a log of records, each either storing one GameFile or removing one. These
+  // track what has to be appended to bring the file up to date with m_cached_files.
+  std::unordered_set<std::string> m_changed_paths;
+  std::unordered_set<std::string> m_removed_paths;
+  size_t m_num_records_in_file = 0;
+  bool m_cache_file_in_sync = false;
 };
 
 }  // namespace UICommon
@@ -26,6 +26,24 @@ Common::IniFile GetPackConfig()
 
   return file;
 }
+
+// Lists the paths of the installed packs, highest priority first. The custom texture loader reads
+// the textures of these packs directly from their zip files.
+void SaveInstalledPaths(Common::IniFile& file)
+{
+  file.DeleteSection("InstalledPaths");
+  auto* paths = file.GetOrCreateSection("InstalledPaths");
+  const auto* install = file.GetOrCreateSection("Installed");
+
+  size_t index = 0;
+  for (const auto& pack : packs)
+  {
+    bool installed;
+    install->Get(pack.GetManifest()->GetID(), &installed, false);
+    if (installed)
+      paths->Set(std::to_string(index++), pack.GetPath());
+  }
+}
 }  // Anonymous namespace
 
 bool Init()
@@ -130,9 +148,11 @@ ResourcePack* Add(const std::string& path, int offset)
   for (int i = offset; i < static_cast<int>(packs.size()); i++)
     order->Set(packs[i].GetManifest()->GetID(), i + 1);
 
+  auto it = packs.insert(packs.begin() + offset, std::move(pack));
+
+  SaveInstalledPaths(file);
   file.Save(packs_path);
 
-  auto it = packs.insert(packs.begin() + offset, std::move(pack));
   return &*it;
 }
 
@@ -159,10 +179,11 @@ bool Remove(ResourcePack& pack)
   for (int i = offset + 1; i < static_cast<int>(packs.size()); i++)
     order->Set(packs[i].GetManifest()->GetID(), i - 1);
 
-  file.Save(packs_path);
-
   packs.erase(pack_iterator);
 
+  SaveInstalledPaths(file);
+  file.Save(packs_path);
+
   return true;
 }
 
@@ -177,6 +198,7 @@ void SetInstalled(const ResourcePack& pack, bool installed)
   else
     install->Delete(pack.GetManifest()->GetID());
 
+  SaveInstalledPaths(file);
   file.Save(packs_path);
 }
 
@@ -3,31 +3,21 @@
 
 #include "UICommon/ResourcePack/ResourcePack.h"
 
-#include <algorithm>
 #include <memory>
 
 #include <mz.h>
-#include <mz_os.h>
 #include <mz_strm.h>
 #include <mz_zip.h>
 #include <mz_zip_rw.h>
 
-#include "Common/CommonPaths.h"
-#include "Common/Contains.h"
-#include "Common/FileSearch.h"
-#include "Common/FileUtil.h"
-#include "Common/IOFile.h"
 #include "Common/MinizipUtil.h"
 #include "Common/ScopeGuard.h"
-#include "Common/StringUtil.h"
 
 #include "UICommon/ResourcePack/Manager.h"
 #include "UICommon/ResourcePack/Manifest.h"
 
 namespace ResourcePack
 {
-constexpr char TEXTURE_PATH[] = HIRES_TEXTURES_DIR DIR_SEP;
-
 ResourcePack::ResourcePack(const std::string& path) : m_path(path)
 {
   void* zip_reader = mz_zip_reader_create();
@@ -155,94 +145,8 @@ bool ResourcePack::Install(const std::string& path)
     return false;
   }
 
-  void* zip_reader = mz_zip_reader_create();
-  if (!zip_reader)
-  {
-    m_valid = false;
-    m_error = "Failed to create zip reader";
-    return false;
-  }
-
-  Common::ScopeGuard file_guard{[&] { mz_zip_reader_delete(&zip_reader); }};
-
-  if (mz_zip_reader_open_file(zip_reader, m_path.c_str()) != MZ_OK)
-  {
-    m_valid = false;
-    m_error = "Failed to open resource pack";
-    return false;
-  }
-
-  if (mz_zip_reader_goto_first_entry(zip_reader) != MZ_OK)
-    return false;
-
-  do
-  {
-    mz_zip_file* texture_info{};
-    if (mz_zip_reader_entry_get_info(zip_reader, &texture_info) != MZ_OK)
-    {
-      return false;
-    }
-
-    const std::string texture_zip_path = texture_info->filename;
-
-    const std::string texture_zip_path_prefix = "textures/";
-    if (!texture_zip_path.starts_with(texture_zip_path_prefix))
-      continue;
-    const std::string texture_name = texture_zip_path.substr(texture_zip_path_prefix.size());
-
-    auto texture_it = std::ranges::find_if(m_textures, [&texture_name](const std::string& texture) {
-      return mz_path_compare_wc(texture.c_str(), texture_name.c_str(), 1) == MZ_OK;
-    });
-    if (texture_it == m_textures.cend())
-      continue;
-    const auto texture = *texture_it;
-
-    // Check if a higher priority pack already provides a given texture, don't overwrite it
-    bool provided_by_other_pack = false;
-    for (const auto& pack : GetHigherPriorityPacks(*this))
-    {
-      if (Common::Contains(pack->GetTextures(), texture))
-      {
-        provided_by_other_pack = true;
-        break;
-      }
-    }
-    if (provided_by_other_pack)
-      continue;
-
-    const std::string texture_path = path + TEXTURE_PATH + texture;
-    std::string texture_full_dir;
-    if (!SplitPath(texture_path, &texture_full_dir, nullptr, nullptr))
-      continue;
-
-    if (!File::CreateFullPath(texture_full_dir))
-    {
-      m_error = "Failed to create full path " + texture_full_dir;
-      return false;
-    }
-
-    const size_t data_size = static_cast<size_t>(texture_info->uncompressed_size);
-    auto data = std::make_unique<u8[]>(data_size);
-    if (!Common::ReadFileFromZip(zip_reader, data.get(), data_size))
-    {
-      m_error = "Failed to read texture " + texture;
-      return false;
-    }
-
-    File::IOFile out(texture_path, "wb");
-    if (!out)
-    {
-      m_error = "Failed to open " + texture;
-      return false;
-    }
-    if (!out.WriteBytes(data.get(), data_size))
-    {
-      m_error = "Failed to write " + texture;
-      return false;
-    }
-
-  } while (mz_zip_reader_goto_next_entry(zip_reader) == MZ_OK);
-
+  // Nothing is extracted, the custom texture loader reads the textures of installed packs directly
+  // from their zip files.
   SetInstalled(*this, true);
   return true;
 }
@@ -255,65 +159,7 @@ bool ResourcePack::Uninstall(const std::string& path)
     return false;
   }
 
-  auto lower = GetLowerPriorityPacks(*this);
-
   SetInstalled(*this, false);
-
-  for (const auto& texture : m_textures)
-  {
-    bool provided_by_other_pack = false;
-
-    // Check if a higher priority pack already provides a given texture, don't delete it
-    for (const auto& pack : GetHigherPriorityPacks(*this))
-    {
-      if (::ResourcePack::IsInstalled(*pack) && Common::Contains(pack->GetTextures(), texture))
-      {
-        provided_by_other_pack = true;
-        break;
-      }
-    }
-
-    if (provided_by_other_pack)
-      continue;
-
-    // Check if a lower priority pack provides a given texture - if so, install it.
-    for (auto& pack : lower)
-    {
-      if (::ResourcePack::IsInstalled(*pack) && Common::Contains(pack->GetTextures(), texture))
-      {
-        pack->Install(path);
-
-        provided_by_other_pack = true;
-        break;
-      }
-    }
-
-    if (provided_by_other_pack)
-      continue;
-
-    const std::string texture_path = path + TEXTURE_PATH + texture;
-    if (File::Exists(texture_path) && !File::Delete(texture_path))
-    {
-      m_error = "Failed to delete texture " + texture;
-      return false;
-    }
-
-    // Recursively delete empty directories
-
-    std::string dir;
-    SplitPath(texture_path, &dir, nullptr, nullptr);
-
-    while (dir.length() > (path + TEXTURE_PATH).length())
-    {
-      auto is_empty = Common::DoFileSearch({dir}).empty();
-
-      if (is_empty)
-        File::DeleteDir(dir);
-
-      SplitPath(dir.substr(0, dir.size() - 2), &dir, nullptr, nullptr);
-    }
-  }
-
   return true;
 }
 
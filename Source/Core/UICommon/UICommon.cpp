@@ -102,6 +102,12 @@ static void CreateWFSPath(const std::string& path)
     File::SetUserPath(D_WFSROOT_IDX, path + '/');
 }
 
+static void CreateShaderCachePath(const std::string& path)
+{
+  if (!path.empty())
+    File::SetUserPath(D_SHADERCACHE_IDX, path + '/');
+}
+
 static void InitCustomPaths()
 {
   File::SetUserPath(D_WIIROOT_IDX, Config::Get(Config::MAIN_FS_PATH));
@@ -109,6 +115,7 @@ static void InitCustomPaths()
   CreateDumpPath(Config::Get(Config::MAIN_DUMP_PATH));
   CreateResourcePackPath(Config::Get(Config::MAIN_RESOURCEPACK_PATH));
   CreateWFSPath(Config::Get(Config::MAIN_WFS_PATH));
+  CreateShaderCachePath(Config::Get(Config::MAIN_SHADER_CACHE_PATH));
   File::SetUserPath(F_WIISDCARDIMAGE_IDX, Config::Get(Config::MAIN_WII_SD_CARD_IMAGE_PATH));
   File::SetUserPath(D_WIISDCARDSYNCFOLDER_IDX,
                     Config::Get(Config::MAIN_WII_SD_CARD_SYNC_FOLDER_PATH));
@@ -27,6 +27,7 @@ ComPtr<IDXGIFactory> dxgi_factory;
 ComPtr<ID3D11Device> device;
 ComPtr<ID3D11Device1> device1;
 ComPtr<ID3D11DeviceContext> context;
+ComPtr<ID3D11DeviceContext1> context1;
 D3D_FEATURE_LEVEL feature_level;
 
 static ComPtr<ID3D11Debug> s_debug;
@@ -129,6 +130,18 @@ bool Create(u32 adapter_index, bool enable_debug_layer)
                  "Missing Direct3D 11.1 support. Logical operations will not be supported.\n{}",
                  DX11HRWrap(hr));
   }
+  else
+  {
+    // Streaming uniforms through one buffer needs both offsets and NO_OVERWRITE maps, which
+    // Windows 7 drivers don't necessarily provide even with Direct3D 11.1.
+    D3D11_FEATURE_DATA_D3D11_OPTIONS options{};
+    if (SUCCEEDED(
+            device1->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))) &&
+        options.ConstantBufferOffsetting && options.MapNoOverwriteOnDynamicConstantBuffer)
+    {
+      context.As(&context1);
+    }
+  }
 
   stateman = std::make_unique<StateManager>();
   return true;
@@ -141,6 +154,7 @@ void Destroy()
   context->ClearState();
   context->Flush();
 
+  context1.Reset();
   context.Reset();
   device1.Reset();
 
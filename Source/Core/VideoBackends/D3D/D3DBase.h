@@ -24,6 +24,9 @@ extern ComPtr<IDXGIFactory> dxgi_factory;
 extern ComPtr<ID3D11Device> device;
 extern ComPtr<ID3D11Device1> device1;
 extern ComPtr<ID3D11DeviceContext> context;
+// Only set when the driver supports binding constant buffers at an offset, which is what it's
+// used for.
+extern ComPtr<ID3D11DeviceContext1> context1;
 extern D3D_FEATURE_LEVEL feature_level;
 
 bool Create(u32 adapter_index, bool enable_debug_layer);
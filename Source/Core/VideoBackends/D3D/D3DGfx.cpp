@@ -26,6 +26,7 @@
 #include "VideoBackends/D3D/DXPipeline.h"
 #include "VideoBackends/D3D/DXShader.h"
 #include "VideoBackends/D3D/DXTexture.h"
+#include "VideoBackends/D3DCommon/D3DCommon.h"
 
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/FramebufferManager.h"
@@ -281,4 +282,14 @@ SurfaceInfo Gfx::GetSurfaceInfo() const
           m_swap_chain ? m_swap_chain->GetFormat() : AbstractTextureFormat::Undefined};
 }
 
+std::optional<VideoMemoryInfo> Gfx::GetVideoMemoryInfo() const
+{
+  ComPtr<IDXGIDevice> dxgi_device;
+  ComPtr<IDXGIAdapter> adapter;
+  if (FAILED(D3D::device.As(&dxgi_device)) || FAILED(dxgi_device->GetAdapter(&adapter)))
+    return std::nullopt;
+
+  return D3DCommon::QueryVideoMemoryInfo(adapter.Get());
+}
+
 }  // namespace DX11
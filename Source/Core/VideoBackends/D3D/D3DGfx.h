@@ -72,6 +72,7 @@ public:
   void OnConfigChanged(u32 bits) override;
 
   SurfaceInfo GetSurfaceInfo() const override;
+  std::optional<VideoMemoryInfo> GetVideoMemoryInfo() const override;
 
 private:
   void CheckForSwapChainChanges();
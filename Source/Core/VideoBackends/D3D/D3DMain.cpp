@@ -113,8 +113,10 @@ void VideoBackend::FillBackendInfo()
   g_backend_info.bSupportsLodBiasInSampler = true;
   g_backend_info.bSupportsLogicOp = D3D::SupportsLogicOp(g_Config.iAdapter);
   g_backend_info.bSupportsSettingObjectNames = true;
-  g_backend_info.bSupportsPartialMultisampleResolve = true;
+  // ResolveSubresource always resolves the whole texture, so resolve small regions with a shader.
+  g_backend_info.bSupportsPartialMultisampleResolve = false;
   g_backend_info.bSupportsDynamicVertexLoader = false;
+  g_backend_info.bSupportsGPUVertexPulling = false;
   g_backend_info.bSupportsHDROutput = true;
 
   g_backend_info.Adapters = D3DCommon::GetAdapterNames();
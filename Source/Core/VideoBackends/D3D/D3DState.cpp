@@ -23,6 +23,25 @@ namespace D3D
 {
 std::unique_ptr<StateManager> stateman;
 
+// Binds a constant buffer to consecutive slots, at an offset if the range isn't empty.
+template <auto SetConstantBuffers, auto SetConstantBuffers1>
+static void SetConstantBuffer(UINT slot, UINT count, ID3D11Buffer* buffer,
+                              const StateManager::ConstantBufferRange& range)
+{
+  const std::array<ID3D11Buffer*, 2> buffers = {buffer, buffer};
+  if (range.count != 0)
+  {
+    const std::array<UINT, 2> first = {range.first, range.first};
+    const std::array<UINT, 2> num = {range.count, range.count};
+    (D3D::context1.Get()->*SetConstantBuffers1)(slot, count, buffers.data(), first.data(),
+                                                num.data());
+  }
+  else
+  {
+    (D3D::context.Get()->*SetConstantBuffers)(slot, count, buffers.data());
+  }
+}
+
 StateManager::StateManager() = default;
 StateManager::~StateManager() = default;
 
@@ -69,20 +88,27 @@ void StateManager::Apply()
 
   if (dirtyConstants)
   {
-    if (m_current.pixelConstants[0] != m_pending.pixelConstants[0] ||
-        m_current.pixelConstants[1] != m_pending.pixelConstants[1])
+    if (m_current.pixelConstants != m_pending.pixelConstants ||
+        m_current.pixelConstantsRange != m_pending.pixelConstantsRange)
     {
-      D3D::context->PSSetConstantBuffers(0, 1, &m_pending.pixelConstants[0]);
-      D3D::context->PSSetConstantBuffers(1, 1, &m_pending.pixelConstants[1]);
-      m_current.pixelConstants[0] = m_pending.pixelConstants[0];
-      m_current.pixelConstants[1] = m_pending.pixelConstants[1];
+      for (u32 i = 0; i < 2; i++)
+      {
+        SetConstantBuffer<&ID3D11DeviceContext::PSSetConstantBuffers,
+                          &ID3D11DeviceContext1::PSSetConstantBuffers1>(
+            i, 1, m_pending.pixelConstants[i], m_pending.pixelConstantsRange[i]);
+      }
+      m_current.pixelConstants = m_pending.pixelConstants;
+      m_current.pixelConstantsRange = m_pending.pixelConstantsRange;
     }
 
-    if (m_current.vertexConstants != m_pending.vertexConstants)
+    if (m_current.vertexConstants != m_pending.vertexConstants ||
+        m_current.vertexConstantsRange != m_pending.vertexConstantsRange)
     {
-      D3D::context->VSSetConstantBuffers(0, 1, &m_pending.vertexConstants);
-      D3D::context->VSSetConstantBuffers(1, 1, &m_pending.vertexConstants);
+      SetConstantBuffer<&ID3D11DeviceContext::VSSetConstantBuffers,
+                        &ID3D11DeviceContext1::VSSetConstantBuffers1>(
+          0, 2, m_pending.vertexConstants, m_pending.vertexConstantsRange);
       m_current.vertexConstants = m_pending.vertexConstants;
+      m_current.vertexConstantsRange = m_pending.vertexConstantsRange;
     }
 
     if (m_current.customConstants != m_pending.customConstants)
@@ -92,10 +118,14 @@ void StateManager::Apply()
       m_current.customConstants = m_pending.customConstants;
     }
 
-    if (m_current.geometryConstants != m_pending.geometryConstants)
+    if (m_current.geometryConstants != m_pending.geometryConstants ||
+        m_current.geometryConstantsRange != m_pending.geometryConstantsRange)
     {
-      D3D::context->GSSetConstantBuffers(0, 1, &m_pending.geometryConstants);
+      SetConstantBuffer<&ID3D11DeviceContext::GSSetConstantBuffers,
+                        &ID3D11DeviceContext1::GSSetConstantBuffers1>(
+          0, 1, m_pending.geometryConstants, m_pending.geometryConstantsRange);
       m_current.geometryConstants = m_pending.geometryConstants;
+      m_current.geometryConstantsRange = m_pending.geometryConstantsRange;
     }
   }
 
@@ -251,10 +281,14 @@ void StateManager::SetComputeShader(ID3D11ComputeShader* shader)
 
 void StateManager::SyncComputeBindings()
 {
-  if (m_compute_constants != m_pending.pixelConstants[0])
+  if (m_compute_constants != m_pending.pixelConstants[0] ||
+      m_compute_constants_range != m_pending.pixelConstantsRange[0])
   {
     m_compute_constants = m_pending.pixelConstants[0];
-    D3D::context->CSSetConstantBuffers(0, 1, &m_compute_constants);
+    m_compute_constants_range = m_pending.pixelConstantsRange[0];
+    SetConstantBuffer<&ID3D11DeviceContext::CSSetConstantBuffers,
+                      &ID3D11DeviceContext1::CSSetConstantBuffers1>(0, 1, m_compute_constants,
+                                                                    m_compute_constants_range);
   }
 
   for (u32 start = 0; start < static_cast<u32>(m_compute_textures.size());)
@@ -51,6 +51,16 @@ public:
   StateManager();
   ~StateManager();
 
+  // A range of a constant buffer, in 16-byte constants. Binding a range requires context1. The
+  // default, an empty range, binds the whole buffer.
+  struct ConstantBufferRange
+  {
+    UINT first = 0;
+    UINT count = 0;
+
+    bool operator==(const ConstantBufferRange&) const = default;
+  };
+
   void SetBlendState(ID3D11BlendState* state)
   {
     if (m_current.blendState != state)
@@ -91,21 +101,28 @@ public:
     m_pending.samplers[index] = sampler;
   }
 
-  void SetPixelConstants(ID3D11Buffer* buffer0, ID3D11Buffer* buffer1 = nullptr)
+  void SetPixelConstants(ID3D11Buffer* buffer0, ID3D11Buffer* buffer1 = nullptr,
+                         ConstantBufferRange range0 = {}, ConstantBufferRange range1 = {})
   {
-    if (m_current.pixelConstants[0] != buffer0 || m_current.pixelConstants[1] != buffer1)
+    if (m_current.pixelConstants[0] != buffer0 || m_current.pixelConstants[1] != buffer1 ||
+        m_current.pixelConstantsRange[0] != range0 || m_current.pixelConstantsRange[1] != range1)
+    {
       m_dirtyFlags.set(DirtyFlag_PixelConstants);
+    }
 
     m_pending.pixelConstants[0] = buffer0;
     m_pending.pixelConstants[1] = buffer1;
+    m_pending.pixelConstantsRange[0] = range0;
+    m_pending.pixelConstantsRange[1] = range1;
   }
 
-  void SetVertexConstants(ID3D11Buffer* buffer)
+  void SetVertexConstants(ID3D11Buffer* buffer, ConstantBufferRange range = {})
   {
-    if (m_current.vertexConstants != buffer)
+    if (m_current.vertexConstants != buffer || m_current.vertexConstantsRange != range)
       m_dirtyFlags.set(DirtyFlag_VertexConstants);
 
     m_pending.vertexConstants = buffer;
+    m_pending.vertexConstantsRange = range;
   }
 
   void SetCustomConstants(ID3D11Buffer* buffer)
@@ -116,12 +133,13 @@ public:
     m_pending.customConstants = buffer;
   }
 
-  void SetGeometryConstants(ID3D11Buffer* buffer)
+  void SetGeometryConstants(ID3D11Buffer* buffer, ConstantBufferRange range = {})
   {
-    if (m_current.geometryConstants != buffer)
+    if (m_current.geometryConstants != buffer || m_current.geometryConstantsRange != range)
       m_dirtyFlags.set(DirtyFlag_GeometryConstants);
 
     m_pending.geometryConstants = buffer;
+    m_pending.geometryConstantsRange = range;
   }
 
   void SetVertexBuffer(ID3D11Buffer* buffer, u32 stride, u32 offset)
@@ -265,6 +283,9 @@ private:
     ID3D11Buffer* vertexConstants;
     ID3D11Buffer* customConstants;
     ID3D11Buffer* geometryConstants;
+    std::array<ConstantBufferRange, 2> pixelConstantsRange;
+    ConstantBufferRange vertexConstantsRange;
+    ConstantBufferRange geometryConstantsRange;
     ID3D11Buffer* vertexBuffer;
     ID3D11Buffer* indexBuffer;
     u32 vertexBufferStride;
@@ -287,6 +308,7 @@ private:
 
   // Compute resources are synced with the graphics resources when we need them.
   ID3D11Buffer* m_compute_constants = nullptr;
+  ConstantBufferRange m_compute_constants_range;
   std::array<ID3D11ShaderResourceView*, VideoCommon::MAX_COMPUTE_SHADER_SAMPLERS>
       m_compute_textures{};
   std::array<ID3D11SamplerState*, VideoCommon::MAX_COMPUTE_SHADER_SAMPLERS> m_compute_samplers{};
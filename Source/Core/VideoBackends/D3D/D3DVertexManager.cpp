@@ -29,6 +29,9 @@
 
 namespace DX11
 {
+// Constant buffers can only be bound at offsets, and with sizes, of multiples of 16 constants.
+constexpr u32 CONSTANT_BUFFER_OFFSET_ALIGNMENT = 16 * 16;
+
 static ComPtr<ID3D11Buffer> AllocateConstantBuffer(u32 size)
 {
   const u32 cbsize = Common::AlignUp(size, 16u);  // must be a multiple of 16
@@ -94,6 +97,16 @@ bool VertexManager::Initialize()
   if (!m_vertex_constant_buffer || !m_geometry_constant_buffer || !m_pixel_constant_buffer)
     return false;
 
+  if (D3D::context1)
+  {
+    m_uniform_buffer = AllocateConstantBuffer(UNIFORM_STREAM_BUFFER_SIZE);
+    if (!m_uniform_buffer)
+      return false;
+
+    // The first map of a dynamic buffer must discard it.
+    m_uniform_buffer_offset = UNIFORM_STREAM_BUFFER_SIZE;
+  }
+
   CD3D11_BUFFER_DESC texel_buf_desc(TEXEL_STREAM_BUFFER_SIZE, D3D11_BIND_SHADER_RESOURCE,
                                     D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
   HRESULT hr = D3D::device->CreateBuffer(&texel_buf_desc, nullptr, &m_texel_buffer);
@@ -123,6 +136,20 @@ void VertexManager::UploadUtilityUniforms(const void* uniforms, u32 uniforms_siz
 {
   // Just use the one buffer for all three.
   InvalidateConstants();
+  if (m_uniform_buffer)
+  {
+    u8* const dst = MapUniformBuffer(uniforms_size);
+    if (!dst)
+      return;
+
+    const ConstantBufferRange range = UploadStreamedUniforms(dst, uniforms, uniforms_size);
+    D3D::context->Unmap(m_uniform_buffer.Get(), 0);
+    D3D::stateman->SetVertexConstants(m_uniform_buffer.Get(), range);
+    D3D::stateman->SetGeometryConstants(m_uniform_buffer.Get(), range);
+    D3D::stateman->SetPixelConstants(m_uniform_buffer.Get(), nullptr, range);
+    return;
+  }
+
   UpdateConstantBuffer(m_vertex_constant_buffer.Get(), uniforms, uniforms_size);
   D3D::stateman->SetVertexConstants(m_vertex_constant_buffer.Get());
   D3D::stateman->SetGeometryConstants(m_vertex_constant_buffer.Get());
@@ -260,8 +287,88 @@ void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_in
   D3D::stateman->SetIndexBuffer(m_buffers[m_current_buffer].Get());
 }
 
+u8* VertexManager::MapUniformBuffer(u32 required_size)
+{
+  D3D11_MAP map_type = D3D11_MAP_WRITE_NO_OVERWRITE;
+  if (m_uniform_buffer_offset + required_size > UNIFORM_STREAM_BUFFER_SIZE)
+  {
+    // Restart buffer. The driver renames it, so the GPU can still read the earlier uniforms.
+    map_type = D3D11_MAP_WRITE_DISCARD;
+    m_uniform_buffer_offset = 0;
+  }
+
+  D3D11_MAPPED_SUBRESOURCE sr;
+  HRESULT hr = D3D::context->Map(m_uniform_buffer.Get(), 0, map_type, 0, &sr);
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to map uniform buffer: {}", DX11HRWrap(hr));
+  if (FAILED(hr))
+    return nullptr;
+
+  return static_cast<u8*>(sr.pData);
+}
+
+VertexManager::ConstantBufferRange VertexManager::UploadStreamedUniforms(u8* dst, const void* data,
+                                                                         u32 data_size)
+{
+  const u32 size = Common::AlignUp(data_size, CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+  std::memcpy(dst + m_uniform_buffer_offset, data, data_size);
+  const ConstantBufferRange range = {m_uniform_buffer_offset / 16, size / 16};
+  m_uniform_buffer_offset += size;
+
+  ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, data_size);
+  return range;
+}
+
+void VertexManager::UploadStreamedUniforms()
+{
+  auto& system = Core::System::GetInstance();
+  auto& vertex_shader_manager = system.GetVertexShaderManager();
+  auto& geometry_shader_manager = system.GetGeometryShaderManager();
+  auto& pixel_shader_manager = system.GetPixelShaderManager();
+  if (!vertex_shader_manager.dirty && !geometry_shader_manager.dirty &&
+      !pixel_shader_manager.dirty)
+  {
+    return;
+  }
+
+  // Restarting the buffer loses the uniforms of the stages which aren't dirty, so there must
+  // always be room for all of them.
+  constexpr u32 total_size =
+      Common::AlignUp(u32(sizeof(VertexShaderConstants)), CONSTANT_BUFFER_OFFSET_ALIGNMENT) +
+      Common::AlignUp(u32(sizeof(GeometryShaderConstants)), CONSTANT_BUFFER_OFFSET_ALIGNMENT) +
+      Common::AlignUp(u32(sizeof(PixelShaderConstants)), CONSTANT_BUFFER_OFFSET_ALIGNMENT);
+  const bool restart = m_uniform_buffer_offset + total_size > UNIFORM_STREAM_BUFFER_SIZE;
+  u8* const dst = MapUniformBuffer(total_size);
+  if (!dst)
+    return;
+
+  if (vertex_shader_manager.dirty || restart)
+  {
+    m_vertex_constants_range = UploadStreamedUniforms(dst, &vertex_shader_manager.constants,
+                                                      sizeof(VertexShaderConstants));
+    vertex_shader_manager.dirty = false;
+  }
+  if (geometry_shader_manager.dirty || restart)
+  {
+    m_geometry_constants_range = UploadStreamedUniforms(dst, &geometry_shader_manager.constants,
+                                                        sizeof(GeometryShaderConstants));
+    geometry_shader_manager.dirty = false;
+  }
+  if (pixel_shader_manager.dirty || restart)
+  {
+    m_pixel_constants_range = UploadStreamedUniforms(dst, &pixel_shader_manager.constants,
+                                                     sizeof(PixelShaderConstants));
+    pixel_shader_manager.dirty = false;
+  }
+
+  D3D::context->Unmap(m_uniform_buffer.Get(), 0);
+}
+
 void VertexManager::UploadUniforms()
 {
+  // This leaves nothing dirty for the separate buffers below.
+  if (m_uniform_buffer)
+    UploadStreamedUniforms();
+
   auto& system = Core::System::GetInstance();
 
   auto& vertex_shader_manager = system.GetVertexShaderManager();
@@ -302,11 +409,23 @@ void VertexManager::UploadUniforms()
     pixel_shader_manager.custom_constants_dirty = false;
   }
 
-  D3D::stateman->SetPixelConstants(
-      m_pixel_constant_buffer.Get(),
-      g_ActiveConfig.bEnablePixelLighting ? m_vertex_constant_buffer.Get() : nullptr);
-  D3D::stateman->SetVertexConstants(m_vertex_constant_buffer.Get());
-  D3D::stateman->SetGeometryConstants(m_geometry_constant_buffer.Get());
+  if (m_uniform_buffer)
+  {
+    const bool pixel_lighting = g_ActiveConfig.bEnablePixelLighting;
+    D3D::stateman->SetPixelConstants(
+        m_uniform_buffer.Get(), pixel_lighting ? m_uniform_buffer.Get() : nullptr,
+        m_pixel_constants_range, pixel_lighting ? m_vertex_constants_range : ConstantBufferRange{});
+    D3D::stateman->SetVertexConstants(m_uniform_buffer.Get(), m_vertex_constants_range);
+    D3D::stateman->SetGeometryConstants(m_uniform_buffer.Get(), m_geometry_constants_range);
+  }
+  else
+  {
+    D3D::stateman->SetPixelConstants(
+        m_pixel_constant_buffer.Get(),
+        g_ActiveConfig.bEnablePixelLighting ? m_vertex_constant_buffer.Get() : nullptr);
+    D3D::stateman->SetVertexConstants(m_vertex_constant_buffer.Get());
+    D3D::stateman->SetGeometryConstants(m_geometry_constant_buffer.Get());
+  }
   D3D::stateman->SetCustomConstants(m_custom_constant_buffer.Get());
 }
 }  // namespace DX11
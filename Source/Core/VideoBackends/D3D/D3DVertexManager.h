@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "VideoBackends/D3D/D3DBase.h"
+#include "VideoBackends/D3D/D3DState.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/VertexManagerBase.h"
 
@@ -58,7 +59,12 @@ private:
   static constexpr u32 BUFFER_SIZE =
       (VERTEX_STREAM_BUFFER_SIZE + INDEX_STREAM_BUFFER_SIZE) / BUFFER_COUNT;
 
+  using ConstantBufferRange = D3D::StateManager::ConstantBufferRange;
+
   bool MapTexelBuffer(u32 required_size, D3D11_MAPPED_SUBRESOURCE& sr);
+  u8* MapUniformBuffer(u32 required_size);
+  ConstantBufferRange UploadStreamedUniforms(u8* dst, const void* data, u32 data_size);
+  void UploadStreamedUniforms();
 
   ComPtr<ID3D11Buffer> m_buffers[BUFFER_COUNT] = {};
   u32 m_current_buffer = 0;
@@ -68,6 +74,14 @@ private:
   ComPtr<ID3D11Buffer> m_geometry_constant_buffer = nullptr;
   ComPtr<ID3D11Buffer> m_pixel_constant_buffer = nullptr;
 
+  // With Direct3D 11.1, the vertex, geometry and pixel uniforms are sub-allocated from one large
+  // buffer instead, which is mapped with NO_OVERWRITE, avoiding buffer renames in the driver.
+  ComPtr<ID3D11Buffer> m_uniform_buffer = nullptr;
+  u32 m_uniform_buffer_offset = 0;
+  ConstantBufferRange m_vertex_constants_range;
+  ConstantBufferRange m_geometry_constants_range;
+  ConstantBufferRange m_pixel_constants_range;
+
   ComPtr<ID3D11Buffer> m_custom_constant_buffer = nullptr;
   std::size_t m_last_custom_buffer_size = 0;
 
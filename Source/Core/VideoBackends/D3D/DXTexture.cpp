@@ -194,6 +194,18 @@ void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
                                   buffer, static_cast<UINT>(src_pitch), 0);
 }
 
+void DXTexture::LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length,
+                           const u8* buffer, size_t buffer_size, u32 layer)
+{
+  ASSERT(!IsCompressedFormat(m_config.format));
+
+  const size_t src_pitch = CalculateStrideForFormat(m_config.format, row_length);
+  const D3D11_BOX box = {x, y, 0, x + width, y + height, 1};
+  D3D::context->UpdateSubresource(m_texture.Get(),
+                                  D3D11CalcSubresource(level, layer, m_config.levels), &box,
+                                  buffer, static_cast<UINT>(src_pitch), 0);
+}
+
 DXStagingTexture::DXStagingTexture(StagingTextureType type, const TextureConfig& config,
                                    ComPtr<ID3D11Texture2D> tex)
     : AbstractStagingTexture(type, config), m_tex(std::move(tex))
@@ -26,33 +26,67 @@ bool D3D12BoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> D3D12BoundingBox::Read(u32 index, u32 length)
+void D3D12BoundingBox::CopyToReadbackBuffer(u32 offset)
 {
-  // Copy from GPU->CPU buffer, and wait for the GPU to finish the copy.
   ResourceBarrier(g_dx_context->GetCommandList(), m_gpu_buffer.Get(),
                   D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE);
-  g_dx_context->GetCommandList()->CopyBufferRegion(m_readback_buffer.Get(), 0, m_gpu_buffer.Get(),
-                                                   0, BUFFER_SIZE);
+  g_dx_context->GetCommandList()->CopyBufferRegion(m_readback_buffer.Get(), offset,
+                                                   m_gpu_buffer.Get(), 0, BUFFER_SIZE);
   ResourceBarrier(g_dx_context->GetCommandList(), m_gpu_buffer.Get(),
                   D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
-  Gfx::GetInstance()->ExecuteCommandList(true);
+}
 
-  // Read back to cached values.
-  std::vector<BBoxType> values(length);
-  static constexpr D3D12_RANGE read_range = {0, BUFFER_SIZE};
+void D3D12BoundingBox::ReadFromReadbackBuffer(u32 offset, BBoxType* values, u32 length)
+{
+  const D3D12_RANGE read_range = {offset, offset + sizeof(BBoxType) * length};
   void* mapped_pointer;
   HRESULT hr = m_readback_buffer->Map(0, &read_range, &mapped_pointer);
   ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Map bounding box CPU buffer failed: {}", DX12HRWrap(hr));
   if (FAILED(hr))
-    return values;
+    return;
 
-  // Copy out the values we want
-  std::memcpy(values.data(), static_cast<const u8*>(mapped_pointer) + sizeof(BBoxType) * index,
-              sizeof(BBoxType) * length);
+  std::memcpy(values, static_cast<const u8*>(mapped_pointer) + offset, sizeof(BBoxType) * length);
 
   static constexpr D3D12_RANGE write_range = {0, 0};
   m_readback_buffer->Unmap(0, &write_range);
+}
+
+std::vector<BBoxType> D3D12BoundingBox::Read(u32 index, u32 length)
+{
+  // Copy from GPU->CPU buffer, and wait for the GPU to finish the copy.
+  CopyToReadbackBuffer(0);
+  Gfx::GetInstance()->ExecuteCommandList(true);
+
+  // Copy out the values we want
+  std::vector<BBoxType> values(length);
+  ReadFromReadbackBuffer(sizeof(BBoxType) * index, values.data(), length);
+  return values;
+}
+
+bool D3D12BoundingBox::QueueRead(u32 slot)
+{
+  CopyToReadbackBuffer((slot + 1) * BUFFER_SIZE);
+  m_queued_fence_values[slot] = g_dx_context->GetCurrentFenceValue();
+
+  // Submit the copy so that it completes as soon as possible, but don't wait for it.
+  Gfx::GetInstance()->ExecuteCommandList(false);
+  return true;
+}
+
+std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> D3D12BoundingBox::ReadQueued(u32 slot,
+                                                                                  bool wait)
+{
+  const u64 fence_value = m_queued_fence_values[slot];
+  if (g_dx_context->GetCompletedFenceValue() < fence_value)
+  {
+    if (!wait)
+      return std::nullopt;
+
+    g_dx_context->WaitForFence(fence_value);
+  }
 
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  ReadFromReadbackBuffer((slot + 1) * BUFFER_SIZE, values.data(), NUM_BBOX_VALUES);
   return values;
 }
 
@@ -112,6 +146,7 @@ bool D3D12BoundingBox::CreateBuffers()
   g_dx_context->GetDevice()->CreateUnorderedAccessView(m_gpu_buffer.Get(), nullptr, &uav_desc,
                                                        m_gpu_descriptor.cpu_handle);
 
+  buffer_desc.Width = READBACK_BUFFER_SIZE;
   buffer_desc.Flags = D3D12_RESOURCE_FLAG_NONE;
   hr = g_dx_context->GetDevice()->CreateCommittedResource(
       &cpu_heap_properties, D3D12_HEAP_FLAG_NONE, &buffer_desc, D3D12_RESOURCE_STATE_COPY_DEST,
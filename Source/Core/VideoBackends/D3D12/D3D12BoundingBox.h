@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include "VideoBackends/D3D12/Common.h"
 #include "VideoBackends/D3D12/D3D12StreamBuffer.h"
@@ -23,18 +24,26 @@ protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
 
+  bool QueueRead(u32 slot) override;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> ReadQueued(u32 slot, bool wait) override;
+
 private:
   static constexpr u32 BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
+  // Synchronous reads use the start of the readback buffer, followed by one slot per queued read.
+  static constexpr u32 READBACK_BUFFER_SIZE = BUFFER_SIZE * (1 + MAX_QUEUED_READBACKS);
   static constexpr u32 MAX_UPDATES_PER_FRAME = 128;
   static constexpr u32 STREAM_BUFFER_SIZE = BUFFER_SIZE * MAX_UPDATES_PER_FRAME;
 
   bool CreateBuffers();
+  void CopyToReadbackBuffer(u32 offset);
+  void ReadFromReadbackBuffer(u32 offset, BBoxType* values, u32 length);
 
   // Three buffers: GPU for read/write, CPU for reading back, and CPU for staging changes.
   ComPtr<ID3D12Resource> m_gpu_buffer;
   ComPtr<ID3D12Resource> m_readback_buffer;
   StreamBuffer m_upload_buffer;
   DescriptorHandle m_gpu_descriptor{};
+  std::array<u64, MAX_QUEUED_READBACKS> m_queued_fence_values = {};
 };
 
 }  // namespace DX12
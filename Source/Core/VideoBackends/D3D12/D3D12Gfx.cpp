@@ -3,6 +3,10 @@
 
 #include "VideoBackends/D3D12/D3D12Gfx.h"
 
+#include <algorithm>
+
+#include <dxgi1_4.h>
+
 #include "Common/Logging/Log.h"
 
 #include "VideoBackends/D3D12/Common.h"
@@ -24,6 +28,7 @@ static bool UsesDynamicVertexLoader(const AbstractPipeline* pipeline)
 {
   const AbstractPipelineUsage usage = static_cast<const DXPipeline*>(pipeline)->GetUsage();
   return (g_backend_info.bSupportsDynamicVertexLoader && usage == AbstractPipelineUsage::GXUber) ||
+         (g_ActiveConfig.UseGPUVertexPulling() && usage == AbstractPipelineUsage::GX) ||
          (g_ActiveConfig.UseVSForLinePointExpand() && usage != AbstractPipelineUsage::Utility);
 }
 
@@ -37,6 +42,9 @@ Gfx::Gfx(std::unique_ptr<SwapChain> swap_chain, float backbuffer_scale)
     m_state.textures[i].ptr = g_dx_context->GetNullSRVDescriptor().cpu_handle.ptr;
     m_state.samplers.states[i] = RenderState::GetPointSamplerState();
   }
+
+  if (g_backend_info.bSupportsTimestampQueries && !CreateTimestampQueryHeap())
+    g_backend_info.bSupportsTimestampQueries = false;
 }
 
 Gfx::~Gfx() = default;
@@ -410,6 +418,104 @@ SurfaceInfo Gfx::GetSurfaceInfo() const
           m_swap_chain ? m_swap_chain->GetFormat() : AbstractTextureFormat::Undefined};
 }
 
+std::optional<VideoMemoryInfo> Gfx::GetVideoMemoryInfo() const
+{
+  ComPtr<IDXGIFactory4> factory;
+  ComPtr<IDXGIAdapter> adapter;
+  if (FAILED(g_dx_context->GetDXGIFactory()->QueryInterface(IID_PPV_ARGS(&factory))) ||
+      FAILED(factory->EnumAdapterByLuid(g_dx_context->GetDevice()->GetAdapterLuid(),
+                                        IID_PPV_ARGS(&adapter))))
+  {
+    return std::nullopt;
+  }
+
+  return D3DCommon::QueryVideoMemoryInfo(adapter.Get());
+}
+
+bool Gfx::CreateTimestampQueryHeap()
+{
+  constexpr D3D12_QUERY_HEAP_DESC desc = {D3D12_QUERY_HEAP_TYPE_TIMESTAMP, TIMESTAMP_QUERY_COUNT};
+  HRESULT hr =
+      g_dx_context->GetDevice()->CreateQueryHeap(&desc, IID_PPV_ARGS(&m_timestamp_query_heap));
+  if (FAILED(hr))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to create timestamp query heap: {}", DX12HRWrap(hr));
+    return false;
+  }
+
+  constexpr D3D12_HEAP_PROPERTIES heap_properties = {D3D12_HEAP_TYPE_READBACK};
+  constexpr D3D12_RESOURCE_DESC resource_desc = {D3D12_RESOURCE_DIMENSION_BUFFER,
+                                                 0,
+                                                 TIMESTAMP_QUERY_COUNT * sizeof(u64),
+                                                 1,
+                                                 1,
+                                                 1,
+                                                 DXGI_FORMAT_UNKNOWN,
+                                                 {1, 0},
+                                                 D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                                 D3D12_RESOURCE_FLAG_NONE};
+  hr = g_dx_context->GetDevice()->CreateCommittedResource(
+      &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_COPY_DEST,
+      nullptr, IID_PPV_ARGS(&m_timestamp_readback_buffer));
+  if (FAILED(hr))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to create timestamp readback buffer: {}", DX12HRWrap(hr));
+    return false;
+  }
+
+  return true;
+}
+
+void Gfx::WriteTimestamp(u32 index)
+{
+  g_dx_context->GetCommandList()->EndQuery(m_timestamp_query_heap.Get(),
+                                           D3D12_QUERY_TYPE_TIMESTAMP, index);
+}
+
+void Gfx::ResolveTimestamps(u32 index, u32 count)
+{
+  g_dx_context->GetCommandList()->ResolveQueryData(
+      m_timestamp_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, index, count,
+      m_timestamp_readback_buffer.Get(), index * sizeof(u64));
+
+  const u64 fence_value = g_dx_context->GetCurrentFenceValue();
+  std::fill_n(m_timestamp_fence_values.begin() + index, count, fence_value);
+}
+
+bool Gfx::ReadTimestamps(u32 index, u32 count, u64* nanoseconds)
+{
+  const u64 completed_fence_value = g_dx_context->GetCompletedFenceValue();
+  if (std::any_of(m_timestamp_fence_values.begin() + index,
+                  m_timestamp_fence_values.begin() + index + count,
+                  [&](u64 fence_value) { return fence_value > completed_fence_value; }))
+  {
+    return false;
+  }
+
+  UINT64 frequency;
+  if (FAILED(g_dx_context->GetCommandQueue()->GetTimestampFrequency(&frequency)) || frequency == 0)
+    return false;
+
+  const D3D12_RANGE read_range = {index * sizeof(u64), (index + count) * sizeof(u64)};
+  u8* mapped_ptr;
+  HRESULT hr =
+      m_timestamp_readback_buffer->Map(0, &read_range, reinterpret_cast<void**>(&mapped_ptr));
+  if (FAILED(hr))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to map timestamp readback buffer: {}", DX12HRWrap(hr));
+    return false;
+  }
+
+  const u64* ticks = reinterpret_cast<const u64*>(mapped_ptr + read_range.Begin);
+  const double nanoseconds_per_tick = 1e9 / static_cast<double>(frequency);
+  for (u32 i = 0; i < count; i++)
+    nanoseconds[i] = static_cast<u64>(ticks[i] * nanoseconds_per_tick);
+
+  constexpr D3D12_RANGE write_range = {0, 0};
+  m_timestamp_readback_buffer->Unmap(0, &write_range);
+  return true;
+}
+
 void Gfx::OnConfigChanged(u32 bits)
 {
   AbstractGfx::OnConfigChanged(bits);
@@ -659,18 +765,12 @@ void Gfx::UpdateDescriptorTables()
 
 bool Gfx::UpdateSRVDescriptorTable()
 {
-  static constexpr std::array<UINT, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> src_sizes = {
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
-  DescriptorHandle dst_base_handle;
-  const UINT dst_handle_sizes = VideoCommon::MAX_PIXEL_SHADER_SAMPLERS;
-  if (!g_dx_context->GetDescriptorAllocator()->Allocate(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
-                                                        &dst_base_handle))
+  if (!g_dx_context->GetDescriptorAllocator()->GetTextureGroupHandle(
+          m_state.textures, &m_state.srv_descriptor_base))
+  {
     return false;
+  }
 
-  g_dx_context->GetDevice()->CopyDescriptors(
-      1, &dst_base_handle.cpu_handle, &dst_handle_sizes, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
-      m_state.textures.data(), src_sizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-  m_state.srv_descriptor_base = dst_base_handle.gpu_handle;
   m_dirty_bits = (m_dirty_bits & ~DirtyState_Textures) | DirtyState_SRV_Descriptor;
   return true;
 }
@@ -73,6 +73,11 @@ public:
   void PresentBackbuffer() override;
 
   SurfaceInfo GetSurfaceInfo() const override;
+  std::optional<VideoMemoryInfo> GetVideoMemoryInfo() const override;
+
+  void WriteTimestamp(u32 index) override;
+  void ResolveTimestamps(u32 index, u32 count) override;
+  bool ReadTimestamps(u32 index, u32 count, u64* nanoseconds) override;
 
   // Completes the current render pass, executes the command buffer, and restores state ready for
   // next render. Use when you want to kick the current buffer to make room for new data.
@@ -138,6 +143,8 @@ private:
 
   void CheckForSwapChainChanges();
 
+  bool CreateTimestampQueryHeap();
+
   void BindFramebuffer(DXFramebuffer* fb);
   void SetRootSignatures();
   void SetDescriptorHeaps();
@@ -152,6 +159,10 @@ private:
 
   // Owned objects
   std::unique_ptr<SwapChain> m_swap_chain;
+  ComPtr<ID3D12QueryHeap> m_timestamp_query_heap;
+  ComPtr<ID3D12Resource> m_timestamp_readback_buffer;
+  // Fence value after which each timestamp can be read from the readback buffer.
+  std::array<u64, TIMESTAMP_QUERY_COUNT> m_timestamp_fence_values = {};
 
   // Current state
   struct
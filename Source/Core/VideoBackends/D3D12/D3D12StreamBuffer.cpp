@@ -8,12 +8,18 @@
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/D3D12/DX12Context.h"
+#include "VideoCommon/Statistics.h"
 
 namespace DX12
 {
+// Each stream buffer may use at most a small fraction of VRAM, so that the remainder is available
+// for textures.
+static constexpr u64 MAX_HEAP_FRACTION_PER_BUFFER = 16;
+
 StreamBuffer::StreamBuffer() = default;
 
 StreamBuffer::~StreamBuffer()
@@ -29,7 +35,7 @@ StreamBuffer::~StreamBuffer()
     m_buffer->Release();
 }
 
-bool StreamBuffer::AllocateBuffer(u32 size)
+bool StreamBuffer::AllocateBuffer(u32 size, bool prefer_device_local)
 {
   static const D3D12_HEAP_PROPERTIES heap_properties = {D3D12_HEAP_TYPE_UPLOAD};
   const D3D12_RESOURCE_DESC resource_desc = {D3D12_RESOURCE_DIMENSION_BUFFER,
@@ -43,9 +49,27 @@ bool StreamBuffer::AllocateBuffer(u32 size)
                                              D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
                                              D3D12_RESOURCE_FLAG_NONE};
 
-  HRESULT hr = g_dx_context->GetDevice()->CreateCommittedResource(
-      &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_GENERIC_READ,
-      nullptr, IID_PPV_ARGS(&m_buffer));
+  HRESULT hr = E_FAIL;
+#ifdef __ID3D12Device13_INTERFACE_DEFINED__
+  const u64 heap_size = g_dx_context->GetGPUUploadHeapSize();
+  if (prefer_device_local && size <= heap_size / MAX_HEAP_FRACTION_PER_BUFFER)
+  {
+    static const D3D12_HEAP_PROPERTIES gpu_upload_heap_properties = {D3D12_HEAP_TYPE_GPU_UPLOAD};
+    hr = g_dx_context->GetDevice()->CreateCommittedResource(
+        &gpu_upload_heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc,
+        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_buffer));
+    if (SUCCEEDED(hr))
+      INFO_LOG_FMT(VIDEO, "Using GPU upload heap for {} byte stream buffer", size);
+  }
+#endif
+
+  // Fall back to system memory if there is no GPU upload heap, or it's exhausted.
+  if (FAILED(hr))
+  {
+    hr = g_dx_context->GetDevice()->CreateCommittedResource(
+        &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr, IID_PPV_ARGS(&m_buffer));
+  }
   ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to allocate buffer of size {}: {}", size,
              DX12HRWrap(hr));
   if (FAILED(hr))
@@ -127,6 +151,7 @@ bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
   // We tried everything we could, and still couldn't get anything. This means that too much space
   // in the buffer is being used by the command buffer currently being recorded. Therefore, the
   // only option is to execute it, and wait until it's done.
+  INCSTAT(g_stats.this_frame.num_stream_buffer_stalls);
   return false;
 }
 
@@ -238,6 +263,7 @@ bool StreamBuffer::WaitForClearSpace(u32 num_bytes)
     return false;
 
   // Wait until this fence is signaled. This will fire the callback, updating the GPU position.
+  INCSTAT(g_stats.this_frame.num_stream_buffer_stalls);
   g_dx_context->WaitForFence(iter->first);
   m_tracked_fences.erase(m_tracked_fences.begin(),
                          m_current_offset == iter->second ? m_tracked_fences.end() : ++iter);
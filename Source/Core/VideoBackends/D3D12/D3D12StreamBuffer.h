@@ -17,7 +17,9 @@ public:
   StreamBuffer();
   ~StreamBuffer();
 
-  bool AllocateBuffer(u32 size);
+  // If prefer_device_local is set, the buffer is placed in VRAM when the CPU can write to it
+  // directly, which cuts the latency of the GPU reading it.
+  bool AllocateBuffer(u32 size, bool prefer_device_local = false);
 
   ID3D12Resource* GetBuffer() const { return m_buffer; }
   D3D12_GPU_VIRTUAL_ADDRESS GetGPUPointer() const { return m_gpu_pointer; }
@@ -33,10 +33,10 @@ bool VertexManager::Initialize()
   if (!VertexManagerBase::Initialize())
     return false;
 
-  if (!m_vertex_stream_buffer.AllocateBuffer(VERTEX_STREAM_BUFFER_SIZE) ||
-      !m_index_stream_buffer.AllocateBuffer(INDEX_STREAM_BUFFER_SIZE) ||
-      !m_uniform_stream_buffer.AllocateBuffer(UNIFORM_STREAM_BUFFER_SIZE) ||
-      !m_texel_stream_buffer.AllocateBuffer(TEXEL_STREAM_BUFFER_SIZE))
+  if (!m_vertex_stream_buffer.AllocateBuffer(VERTEX_STREAM_BUFFER_SIZE, true) ||
+      !m_index_stream_buffer.AllocateBuffer(INDEX_STREAM_BUFFER_SIZE, true) ||
+      !m_uniform_stream_buffer.AllocateBuffer(UNIFORM_STREAM_BUFFER_SIZE, true) ||
+      !m_texel_stream_buffer.AllocateBuffer(TEXEL_STREAM_BUFFER_SIZE, true))
   {
     PanicAlertFmt("Failed to allocate streaming buffers");
     return false;
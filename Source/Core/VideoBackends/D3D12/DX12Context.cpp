@@ -205,6 +205,23 @@ bool DXContext::CreateDevice(u32 adapter_index, bool enable_debug_layer)
     }
   }
 
+  // GPU upload heaps require a recent SDK to build, and a recent runtime to use.
+#ifdef __ID3D12Device13_INTERFACE_DEFINED__
+  D3D12_FEATURE_DATA_D3D12_OPTIONS16 options16 = {};
+  if (SUCCEEDED(m_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS16, &options16,
+                                              sizeof(options16))) &&
+      options16.GPUUploadHeapSupported)
+  {
+    DXGI_ADAPTER_DESC adapter_desc = {};
+    if ((adapter || SUCCEEDED(m_dxgi_factory->EnumAdapters(0, &adapter))) &&
+        SUCCEEDED(adapter->GetDesc(&adapter_desc)))
+    {
+      m_gpu_upload_heap_size = adapter_desc.DedicatedVideoMemory;
+    }
+  }
+#endif
+  INFO_LOG_FMT(VIDEO, "GPU upload heap size: {} MiB", m_gpu_upload_heap_size >> 20);
+
   return true;
 }
 
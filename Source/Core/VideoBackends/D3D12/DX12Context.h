@@ -106,6 +106,10 @@ public:
   // Feature level to use when compiling shaders.
   D3D_FEATURE_LEVEL GetFeatureLevel() const { return m_feature_level; }
 
+  // Amount of VRAM which can be allocated from GPU upload heaps, which the CPU can write to
+  // directly. Zero if the device does not support them (i.e. without Resizable BAR).
+  u64 GetGPUUploadHeapSize() const { return m_gpu_upload_heap_size; }
+
   // Test for support for the specified texture format.
   bool SupportsTextureFormat(DXGI_FORMAT format);
 
@@ -184,6 +188,7 @@ private:
   std::array<ID3D12DescriptorHeap*, 2> m_gpu_descriptor_heaps = {};
   DescriptorHandle m_null_srv_descriptor;
   D3D_FEATURE_LEVEL m_feature_level = D3D_FEATURE_LEVEL_11_0;
+  u64 m_gpu_upload_heap_size = 0;
 
   ComPtr<ID3D12RootSignature> m_gx_root_signature;
   ComPtr<ID3D12RootSignature> m_utility_root_signature;
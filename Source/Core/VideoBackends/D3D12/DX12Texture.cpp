@@ -236,6 +236,12 @@ bool DXTexture::CreateUAVDescriptor()
 
 void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
                      size_t buffer_size, u32 layer)
+{
+  LoadRegion(level, 0, 0, width, height, row_length, buffer, buffer_size, layer);
+}
+
+void DXTexture::LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length,
+                           const u8* buffer, size_t buffer_size, u32 layer)
 {
   // Textures greater than 1024*1024 will be put in staging textures that are released after
   // execution instead. A 2048x2048 texture is 16MB, and we'd only fit four of these in our
@@ -340,7 +346,7 @@ void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
       {{upload_buffer_offset, D3DCommon::GetDXGIFormatForAbstractFormat(m_config.format, false),
         aligned_width, aligned_height, 1, upload_stride}}};
   const D3D12_BOX src_box{0, 0, 0, aligned_width, aligned_height, 1};
-  g_dx_context->GetCommandList()->CopyTextureRegion(&dst_loc, 0, 0, 0, &src_loc, &src_box);
+  g_dx_context->GetCommandList()->CopyTextureRegion(&dst_loc, x, y, 0, &src_loc, &src_box);
 
   // Preemptively transition to shader read only after uploading the last mip level, as we're
   // likely finished with writes to this texture for now.
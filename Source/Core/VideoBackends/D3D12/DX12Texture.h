@@ -27,6 +27,8 @@ public:
 
   void Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer, size_t buffer_size,
             u32 layer) override;
+  void LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length, const u8* buffer,
+                  size_t buffer_size, u32 layer) override;
   void CopyRectangleFromTexture(const AbstractTexture* src,
                                 const MathUtil::Rectangle<int>& src_rect, u32 src_layer,
                                 u32 src_level, const MathUtil::Rectangle<int>& dst_rect,
@@ -47,6 +47,40 @@ bool DescriptorAllocator::Allocate(u32 num_handles, DescriptorHandle* out_base_h
 void DescriptorAllocator::Reset()
 {
   m_current_offset = 0;
+  m_texture_group_map.clear();
+}
+
+bool DescriptorAllocator::GetTextureGroupHandle(
+    const std::array<D3D12_CPU_DESCRIPTOR_HANDLE, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>& textures,
+    D3D12_GPU_DESCRIPTOR_HANDLE* handle)
+{
+  // The source descriptors are only freed once the GPU is done with them, so they can't be
+  // replaced by different textures before this allocator is reset.
+  TextureGroup group;
+  for (u32 i = 0; i < VideoCommon::MAX_PIXEL_SHADER_SAMPLERS; i++)
+    group[i] = textures[i].ptr;
+
+  auto it = m_texture_group_map.find(group);
+  if (it != m_texture_group_map.end())
+  {
+    *handle = it->second;
+    return true;
+  }
+
+  DescriptorHandle allocation;
+  if (!Allocate(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS, &allocation))
+    return false;
+
+  static constexpr std::array<UINT, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> source_sizes = {
+      {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
+  const UINT dest_size = VideoCommon::MAX_PIXEL_SHADER_SAMPLERS;
+  g_dx_context->GetDevice()->CopyDescriptors(1, &allocation.cpu_handle, &dest_size,
+                                             VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
+                                             textures.data(), source_sizes.data(),
+                                             D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  *handle = allocation.gpu_handle;
+  m_texture_group_map.emplace(group, allocation.gpu_handle);
+  return true;
 }
 
 bool operator==(const SamplerStateSet& lhs, const SamplerStateSet& rhs)
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
@@ -24,7 +25,17 @@ public:
   bool Allocate(u32 num_handles, DescriptorHandle* out_base_handle);
   void Reset();
 
+  // Copies the pixel shader textures into a descriptor table. Tables are reused until the next
+  // reset, so switching back to a set of textures which was already used doesn't need any copies.
+  bool GetTextureGroupHandle(const std::array<D3D12_CPU_DESCRIPTOR_HANDLE,
+                                              VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>& textures,
+                             D3D12_GPU_DESCRIPTOR_HANDLE* handle);
+
 protected:
+  using TextureGroup = std::array<SIZE_T, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>;
+
+  std::map<TextureGroup, D3D12_GPU_DESCRIPTOR_HANDLE> m_texture_group_map;
+
   ComPtr<ID3D12DescriptorHeap> m_descriptor_heap;
   u32 m_descriptor_increment_size = 0;
   u32 m_num_descriptors = 0;
@@ -90,7 +90,9 @@ void VideoBackend::FillBackendInfo()
   g_backend_info.bSupportsPartialMultisampleResolve = true;
   g_backend_info.bSupportsDynamicVertexLoader = true;
   g_backend_info.bSupportsVSLinePointExpand = true;
+  g_backend_info.bSupportsGPUVertexPulling = true;
   g_backend_info.bSupportsHDROutput = true;
+  g_backend_info.bSupportsTimestampQueries = true;
 
   // We can only check texture support once we have a device.
   if (g_dx_context)
@@ -14,6 +14,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
+#include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -120,6 +121,19 @@ std::vector<std::string> GetAdapterNames()
   return adapters;
 }
 
+std::optional<VideoMemoryInfo> QueryVideoMemoryInfo(IDXGIAdapter* adapter)
+{
+  Microsoft::WRL::ComPtr<IDXGIAdapter3> adapter3;
+  if (!adapter || FAILED(adapter->QueryInterface(IID_PPV_ARGS(adapter3.GetAddressOf()))))
+    return std::nullopt;
+
+  DXGI_QUERY_VIDEO_MEMORY_INFO memory_info;
+  if (FAILED(adapter3->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &memory_info)))
+    return std::nullopt;
+
+  return VideoMemoryInfo{memory_info.Budget, memory_info.CurrentUsage};
+}
+
 DXGI_FORMAT GetDXGIFormatForAbstractFormat(AbstractTextureFormat format, bool typeless)
 {
   switch (format)
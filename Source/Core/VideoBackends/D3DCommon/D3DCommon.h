@@ -5,13 +5,16 @@
 
 #include <d3dcompiler.h>
 #include <dxgiformat.h>
+#include <optional>
 #include <string>
 #include <vector>
 #include <wrl/client.h>
 
 #include "Common/CommonTypes.h"
 
+struct IDXGIAdapter;
 struct IDXGIFactory;
+struct VideoMemoryInfo;
 
 enum class AbstractTextureFormat : u32;
 
@@ -27,6 +30,9 @@ std::vector<std::string> GetAdapterNames();
 // Helper function which creates a DXGI factory.
 Microsoft::WRL::ComPtr<IDXGIFactory> CreateDXGIFactory(bool debug_device);
 
+// Queries the local video memory budget and usage of the adapter. Requires DXGI 1.4.
+std::optional<VideoMemoryInfo> QueryVideoMemoryInfo(IDXGIAdapter* adapter);
+
 // Globally-accessible D3DCompiler function.
 extern pD3DCompile d3d_compile;
 
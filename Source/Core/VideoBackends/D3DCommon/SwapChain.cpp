@@ -59,7 +59,10 @@ bool SwapChain::WantsHDR()
 u32 SwapChain::GetSwapChainFlags() const
 {
   // This flag is necessary if we want to use a flip-model swapchain without locking the framerate
-  return m_allow_tearing_supported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+  u32 flags = m_allow_tearing_supported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+  if (m_frame_latency_waitable)
+    flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+  return flags;
 }
 
 bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
@@ -80,6 +83,7 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
   if (SUCCEEDED(hr))
   {
     m_allow_tearing_supported = IsTearingSupported(dxgi_factory2.Get());
+    m_frame_latency_waitable = g_ActiveConfig.iPresentFrameLatency > 0;
 
     DXGI_SWAP_CHAIN_DESC1 swap_chain_desc = {};
     swap_chain_desc.Width = m_width;
@@ -110,6 +114,14 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
     }
 
     m_swap_chain = swap_chain1;
+
+    Microsoft::WRL::ComPtr<IDXGISwapChain2> swap_chain2;
+    if (SUCCEEDED(hr) && m_frame_latency_waitable && SUCCEEDED(swap_chain1.As(&swap_chain2)))
+    {
+      m_frame_latency = static_cast<u32>(g_ActiveConfig.iPresentFrameLatency);
+      swap_chain2->SetMaximumFrameLatency(m_frame_latency);
+      m_frame_latency_waitable_object = swap_chain2->GetFrameLatencyWaitableObject();
+    }
   }
 
   // Flip-model swapchains aren't supported on Windows 7, so here we fall back to a legacy
@@ -133,6 +145,7 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
     desc.Flags = 0;
 
     m_allow_tearing_supported = false;
+    m_frame_latency_waitable = false;
     hr = m_dxgi_factory->CreateSwapChain(m_d3d_device.Get(), &desc, &m_swap_chain);
   }
 
@@ -199,6 +212,12 @@ void SwapChain::DestroySwapChain()
   if (m_swap_chain && GetFullscreenState(m_swap_chain.Get()))
     m_swap_chain->SetFullscreenState(FALSE, nullptr);
 
+  if (m_frame_latency_waitable_object)
+  {
+    CloseHandle(m_frame_latency_waitable_object);
+    m_frame_latency_waitable_object = nullptr;
+  }
+
   m_swap_chain.Reset();
 }
 
@@ -309,9 +328,30 @@ bool SwapChain::Present()
     return false;
   }
 
+  WaitForFrameLatency();
   return true;
 }
 
+void SwapChain::WaitForFrameLatency()
+{
+  if (!m_frame_latency_waitable_object)
+    return;
+
+  // The latency can be changed at runtime, but switching between waitable and non-waitable swap
+  // chains requires them to be recreated.
+  const u32 latency = static_cast<u32>(std::max(g_ActiveConfig.iPresentFrameLatency, 1));
+  Microsoft::WRL::ComPtr<IDXGISwapChain2> swap_chain2;
+  if (latency != m_frame_latency && SUCCEEDED(m_swap_chain.As(&swap_chain2)))
+  {
+    swap_chain2->SetMaximumFrameLatency(latency);
+    m_frame_latency = latency;
+  }
+
+  // Waiting after presenting, rather than before rendering, means the GPU thread doesn't start
+  // on the next frame until there is room for it in the queue.
+  WaitForSingleObjectEx(m_frame_latency_waitable_object, 1000, TRUE);
+}
+
 bool SwapChain::ChangeSurface(void* native_handle)
 {
   DestroySwapChain();
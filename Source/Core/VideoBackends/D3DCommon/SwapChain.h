@@ -55,6 +55,9 @@ protected:
   bool CreateSwapChain(bool stereo = false, bool hdr = false);
   void DestroySwapChain();
 
+  // Blocks until fewer than the configured number of frames are queued for display.
+  void WaitForFrameLatency();
+
   virtual bool CreateSwapChainBuffers() = 0;
   virtual void DestroySwapChainBuffers() = 0;
 
@@ -71,6 +74,9 @@ protected:
   bool m_stereo = false;
   bool m_hdr = false;
   bool m_allow_tearing_supported = false;
+  bool m_frame_latency_waitable = false;
+  HANDLE m_frame_latency_waitable_object = nullptr;
+  u32 m_frame_latency = 0;
   bool m_has_fullscreen = false;
   bool m_fullscreen_request = false;
 };
@@ -72,6 +72,9 @@ public:
 
   SurfaceInfo GetSurfaceInfo() const override;
 
+  void WriteTimestamp(u32 index) override;
+  bool ReadTimestamps(u32 index, u32 count, u64* nanoseconds) override;
+
 private:
   MRCOwned<CAMetalLayer*> m_layer;
   MRCOwned<id<CAMetalDrawable>> m_drawable;
@@ -506,6 +506,10 @@ void Metal::Gfx::SetupSurface()
 
   [m_layer setDrawableSize:{static_cast<double>(info.width), static_cast<double>(info.height)}];
 
+  // CAMetalLayer only allows two or three drawables. With two, nextDrawable blocks until the
+  // previous frame is on screen, so there is never more than a single frame queued.
+  [m_layer setMaximumDrawableCount:g_ActiveConfig.iPresentFrameLatency == 1 ? 2 : 3];
+
   TextureConfig cfg(info.width, info.height, 1, 1, 1, info.format, AbstractTextureFlag_RenderTarget,
                     AbstractTextureType::Texture_2DArray);
   m_bb_texture = std::make_unique<Texture>(nullptr, cfg);
@@ -527,3 +531,19 @@ SurfaceInfo Metal::Gfx::GetSurfaceInfo() const
   return {static_cast<u32>(size.width * scale), static_cast<u32>(size.height * scale), scale,
           Util::ToAbstract([m_layer pixelFormat])};
 }
+
+void Metal::Gfx::WriteTimestamp(u32 index)
+{
+  @autoreleasepool
+  {
+    g_state_tracker->WriteTimestamp(index);
+  }
+}
+
+bool Metal::Gfx::ReadTimestamps(u32 index, u32 count, u64* nanoseconds)
+{
+  @autoreleasepool
+  {
+    return g_state_tracker->ReadTimestamps(index, count, nanoseconds);
+  }
+}
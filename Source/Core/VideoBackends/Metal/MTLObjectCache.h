@@ -5,6 +5,7 @@
 
 #include <Metal/Metal.h>
 #include <memory>
+#include <unordered_map>
 
 #include "VideoBackends/Metal/MRCHelpers.h"
 
@@ -88,6 +89,16 @@ public:
 
   id<MTLSamplerState> GetSampler(SamplerState state) { return GetSampler(SamplerSelector(state)); }
 
+  /// Samplers in argument buffers can't have their LOD clamped when bound, so the clamp is part of
+  /// the sampler itself
+  id<MTLSamplerState> GetArgumentBufferSampler(SamplerState state)
+  {
+    MRCOwned<id<MTLSamplerState>>& sampler = m_argument_buffer_samplers[state];
+    if (!sampler) [[unlikely]]
+      sampler = CreateSampler(SamplerSelector(state), &state);
+    return sampler;
+  }
+
   void ReloadSamplers();
 
   std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractPipelineConfig& config);
@@ -96,9 +107,11 @@ public:
 private:
   class Internal;
   std::unique_ptr<Internal> m_internal;
-  MRCOwned<id<MTLSamplerState>> CreateSampler(SamplerSelector sel);
+  MRCOwned<id<MTLSamplerState>> CreateSampler(SamplerSelector sel,
+                                              const SamplerState* lod_state = nullptr);
   MRCOwned<id<MTLDepthStencilState>> m_dss[DepthStencilSelector::N_VALUES];
   MRCOwned<id<MTLSamplerState>> m_samplers[SamplerSelector::N_VALUES];
+  std::unordered_map<SamplerState, MRCOwned<id<MTLSamplerState>>> m_argument_buffer_samplers;
 };
 
 extern std::unique_ptr<ObjectCache> g_object_cache;
@@ -3,11 +3,15 @@
 
 #include "VideoBackends/Metal/MTLObjectCache.h"
 
+#include <cctype>
 #include <map>
 #include <mutex>
 #include <optional>
+#include <string>
 
 #include "Common/Assert.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/Metal/MTLPipeline.h"
@@ -16,6 +20,7 @@
 
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/ShaderGenCommon.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
@@ -46,6 +51,8 @@ void Metal::ObjectCache::Initialize(MRCOwned<id<MTLDevice>> device)
 
 void Metal::ObjectCache::Shutdown()
 {
+  if (g_object_cache)
+    g_object_cache->m_internal->SaveArchive();
   g_object_cache.reset();
   g_queue = nullptr;
   g_device = nullptr;
@@ -161,7 +168,8 @@ static const char* to_string(WrapMode wrap)
 
 // clang-format on
 
-MRCOwned<id<MTLSamplerState>> Metal::ObjectCache::CreateSampler(SamplerSelector sel)
+MRCOwned<id<MTLSamplerState>> Metal::ObjectCache::CreateSampler(SamplerSelector sel,
+                                                                const SamplerState* lod_state)
 {
   @autoreleasepool
   {
@@ -172,6 +180,13 @@ MRCOwned<id<MTLSamplerState>> Metal::ObjectCache::CreateSampler(SamplerSelector
     [desc setSAddressMode:Convert(sel.WrapU())];
     [desc setTAddressMode:Convert(sel.WrapV())];
     [desc setMaxAnisotropy:1 << sel.AnisotropicFiltering()];
+    if (lod_state)
+    {
+      // Same clamps as StateTracker passes when binding samplers directly
+      [desc setLodMinClamp:lod_state->tm1.min_lod];
+      [desc setLodMaxClamp:lod_state->tm1.max_lod];
+      [desc setSupportArgumentBuffers:YES];
+    }
     [desc setLabel:MRCTransfer([[NSString alloc]
                        initWithFormat:@"%s%s%s %s%s%d", to_string(sel.MinFilter()),
                                       to_string(sel.MagFilter()), to_string(sel.MipFilter()),
@@ -185,6 +200,7 @@ void Metal::ObjectCache::ReloadSamplers()
 {
   for (auto& sampler : m_samplers)
     sampler = nullptr;
+  m_argument_buffer_samplers.clear();
 }
 
 // MARK: Pipelines
@@ -380,6 +396,101 @@ public:
   std::map<const Shader*, std::vector<PipelineID>> m_shaders;
   std::array<u32, 3> m_pipeline_counter;
 
+  // Compiled pipelines are kept in a binary archive which is saved with the shader cache, so the
+  // driver doesn't have to compile them from their MSL again in the next session.
+  std::mutex m_archive_mtx;
+  MRCOwned<id<MTLBinaryArchive>> m_archive;
+  std::string m_archive_filename;
+  bool m_archive_dirty = false;
+
+  Internal() { LoadArchive(); }
+
+  static std::string GetArchiveFileName()
+  {
+    // Archives only hold binaries for a single device, so keep one per device
+    std::string device_name = [[g_device name] UTF8String];
+    for (char& c : device_name)
+    {
+      if (!std::isalnum(static_cast<unsigned char>(c)))
+        c = '_';
+    }
+    const std::string type = "BinaryArchive-" + device_name;
+    return GetDiskShaderCacheFileName(APIType::Metal, type.c_str(), false, true);
+  }
+
+  void LoadArchive()
+  {
+    if (!g_ActiveConfig.bShaderCache)
+      return;
+
+    m_archive_filename = GetArchiveFileName();
+    auto desc = MRCTransfer([MTLBinaryArchiveDescriptor new]);
+    NSError* err = nullptr;
+    if (File::Exists(m_archive_filename))
+    {
+      NSString* path = [NSString stringWithUTF8String:m_archive_filename.c_str()];
+      [desc setUrl:[NSURL fileURLWithPath:path]];
+      m_archive = MRCTransfer([g_device newBinaryArchiveWithDescriptor:desc error:&err]);
+      if (m_archive)
+        return;
+
+      // Most likely written by a different driver version, start over with an empty archive
+      WARN_LOG_FMT(VIDEO, "Failed to load Metal binary archive {}: {}", m_archive_filename,
+                   [[err localizedDescription] UTF8String]);
+      File::Delete(m_archive_filename);
+      [desc setUrl:nil];
+      err = nullptr;
+    }
+
+    m_archive = MRCTransfer([g_device newBinaryArchiveWithDescriptor:desc error:&err]);
+    if (!m_archive)
+    {
+      WARN_LOG_FMT(VIDEO, "Failed to create Metal binary archive: {}",
+                   [[err localizedDescription] UTF8String]);
+    }
+  }
+
+  void AddToArchive(MTLRenderPipelineDescriptor* desc)
+  {
+    std::lock_guard<std::mutex> lock(m_archive_mtx);
+    NSError* err = nullptr;
+    if ([m_archive addRenderPipelineFunctionsWithDescriptor:desc error:&err])
+    {
+      m_archive_dirty = true;
+    }
+    else
+    {
+      WARN_LOG_FMT(VIDEO, "Failed to add pipeline {} to the Metal binary archive: {}",
+                   [[desc label] UTF8String], [[err localizedDescription] UTF8String]);
+    }
+  }
+
+  void SaveArchive()
+  {
+    std::lock_guard<std::mutex> lock(m_archive_mtx);
+    if (!m_archive || !m_archive_dirty)
+      return;
+
+    @autoreleasepool
+    {
+      // The loaded archive may still be reading from its file, so write a new one next to it
+      const std::string temp_filename = m_archive_filename + ".tmp";
+      NSURL* url = [NSURL fileURLWithPath:[NSString stringWithUTF8String:temp_filename.c_str()]];
+      NSError* err = nullptr;
+      if ([m_archive serializeToURL:url error:&err])
+      {
+        File::Rename(temp_filename, m_archive_filename);
+        m_archive_dirty = false;
+      }
+      else
+      {
+        WARN_LOG_FMT(VIDEO, "Failed to save Metal binary archive {}: {}", m_archive_filename,
+                     [[err localizedDescription] UTF8String]);
+        File::Delete(temp_filename);
+      }
+    }
+  }
+
   StoredPipeline CreatePipeline(const AbstractPipelineConfig& config)
   {
     @autoreleasepool
@@ -439,11 +550,28 @@ public:
         [desc setStencilAttachmentPixelFormat:Util::FromAbstract(fs.depth_texture_format)];
       NSError* err = nullptr;
       MTLRenderPipelineReflection* reflection = nullptr;
-      id<MTLRenderPipelineState> pipe =
-          [g_device newRenderPipelineStateWithDescriptor:desc
-                                                 options:MTLPipelineOptionArgumentInfo
-                                              reflection:&reflection
-                                                   error:&err];
+      id<MTLRenderPipelineState> pipe = nil;
+      if (m_archive)
+      {
+        // Look the pipeline up in the archive first. On a miss, compile it into the archive, after
+        // which creating it below is a hit, so the pipeline is still only compiled once.
+        [desc setBinaryArchives:@[ m_archive.Get() ]];
+        pipe = [g_device
+            newRenderPipelineStateWithDescriptor:desc
+                                         options:MTLPipelineOptionArgumentInfo |
+                                                 MTLPipelineOptionFailOnBinaryArchiveMiss
+                                      reflection:&reflection
+                                           error:nil];
+        if (!pipe)
+          AddToArchive(desc);
+      }
+      if (!pipe)
+      {
+        pipe = [g_device newRenderPipelineStateWithDescriptor:desc
+                                                      options:MTLPipelineOptionArgumentInfo
+                                                   reflection:&reflection
+                                                        error:&err];
+      }
       if (err)
       {
         static int counter;
@@ -509,7 +637,14 @@ public:
         return std::make_pair(nullptr, PipelineReflection());
       }
 
-      return std::make_pair(MRCTransfer(pipe), PipelineReflection(reflection));
+      PipelineReflection pipe_reflection(reflection);
+      if (pipe_reflection.fragment_buffers & (1 << PIXEL_ARGUMENT_BUFFER_INDEX))
+      {
+        id<MTLFunction> fragment = [desc fragmentFunction];
+        pipe_reflection.argument_encoder =
+            MRCTransfer([fragment newArgumentEncoderWithBufferIndex:PIXEL_ARGUMENT_BUFFER_INDEX]);
+      }
+      return std::make_pair(MRCTransfer(pipe), pipe_reflection);
     }
   }
 
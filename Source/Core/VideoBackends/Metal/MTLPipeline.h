@@ -20,6 +20,8 @@ struct PipelineReflection
   u32 samplers = 0;
   u32 vertex_buffers = 0;
   u32 fragment_buffers = 0;
+  /// Encodes the pixel shader's argument buffer, if it has one
+  MRCOwned<id<MTLArgumentEncoder>> argument_encoder;
   PipelineReflection() = default;
   explicit PipelineReflection(MTLRenderPipelineReflection* reflection);
 };
@@ -41,6 +43,7 @@ public:
   u32 GetSamplers() const { return m_reflection.samplers; }
   u32 GetVertexBuffers() const { return m_reflection.vertex_buffers; }
   u32 GetFragmentBuffers() const { return m_reflection.fragment_buffers; }
+  id<MTLArgumentEncoder> GetArgumentEncoder() const { return m_reflection.argument_encoder; }
   bool UsesVertexBuffer(u32 index) const { return m_reflection.vertex_buffers & (1 << index); }
   bool UsesFragmentBuffer(u32 index) const { return m_reflection.fragment_buffers & (1 << index); }
 
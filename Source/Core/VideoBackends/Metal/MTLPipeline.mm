@@ -5,12 +5,35 @@
 
 #include "Common/MsgHandler.h"
 
+#include "VideoBackends/Metal/MTLUtil.h"
+
+#include "VideoCommon/Constants.h"
+
 static void MarkAsUsed(u32* list, u32 start, u32 length)
 {
   for (u32 i = start; i < start + length; ++i)
     *list |= 1 << i;
 }
 
+static void GetArgumentBufferMembers(MTLStructType* type, u32* textures, u32* samplers)
+{
+  for (MTLStructMember* member in [type members])
+  {
+    const u32 idx = [member argumentIndex];
+    MTLDataType data_type = [member dataType];
+    u32 length = 1;
+    if (data_type == MTLDataTypeArray)
+    {
+      data_type = [[member arrayType] elementType];
+      length = [[member arrayType] arrayLength];
+    }
+    if (data_type == MTLDataTypeTexture)
+      MarkAsUsed(textures, idx, length);
+    else if (data_type == MTLDataTypeSampler)
+      MarkAsUsed(samplers, idx - VideoCommon::MAX_PIXEL_SHADER_SAMPLERS, length);
+  }
+}
+
 static void GetArguments(NSArray<MTLArgument*>* arguments, u32* textures, u32* samplers,
                          u32* buffers)
 {
@@ -40,6 +63,11 @@ static void GetArguments(NSArray<MTLArgument*>* arguments, u32* textures, u32* s
       break;
     case MTLArgumentTypeBuffer:
       MarkAsUsed(buffers, idx, length);
+      if (textures && idx == Metal::PIXEL_ARGUMENT_BUFFER_INDEX &&
+          [argument bufferDataType] == MTLDataTypeStruct)
+      {
+        GetArgumentBufferMembers([argument bufferStructType], textures, samplers);
+      }
       break;
     default:
       break;
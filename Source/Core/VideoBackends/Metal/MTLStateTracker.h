@@ -108,6 +108,8 @@ public:
   void DispatchComputeShader(u32 groupsize_x, u32 groupsize_y, u32 groupsize_z, u32 groups_x,
                              u32 groups_y, u32 groups_z);
   void ResolveTexture(id<MTLTexture> src, id<MTLTexture> dst, u32 layer, u32 level);
+  void WriteTimestamp(u32 index);
+  bool ReadTimestamps(u32 index, u32 count, u64* nanoseconds);
 
   size_t Align(size_t amt, AlignMask align)
   {
@@ -170,6 +172,8 @@ private:
   struct Backref;
   struct PerfQueryTracker;
 
+  bool CreateTimestampBuffer();
+
   std::shared_ptr<Backref> m_backref;
   std::vector<std::shared_ptr<PerfQueryTracker>> m_perf_query_tracker_cache;
   MRCOwned<id<MTLFence>> m_fence;
@@ -190,6 +194,13 @@ private:
 
   MRCOwned<id<MTLTexture>> m_dummy_texture;
 
+  MRCOwned<id<MTLCounterSampleBuffer>> m_timestamp_buffer;
+  // The draw number of the command buffer which sampled each timestamp
+  std::vector<u64> m_timestamp_draws;
+  // CPU (in nanoseconds) and GPU time when timestamps were first sampled, to convert between them
+  MTLTimestamp m_timestamp_calibration_cpu = 0;
+  MTLTimestamp m_timestamp_calibration_gpu = 0;
+
   // Compute has a set of samplers and a set of writable images
   static constexpr u32 MAX_COMPUTE_TEXTURES = VideoCommon::MAX_COMPUTE_SHADER_SAMPLERS * 2;
   static constexpr u32 MAX_PIXEL_TEXTURES = VideoCommon::MAX_PIXEL_SHADER_SAMPLERS;
@@ -237,7 +248,8 @@ private:
     NSString* label;
     id<MTLRenderPipelineState> pipeline;
     std::array<id<MTLBuffer>, 2> vertex_buffers;
-    std::array<id<MTLBuffer>, 3> fragment_buffers;
+    std::array<id<MTLBuffer>, 4> fragment_buffers;
+    id<MTLArgumentEncoder> argument_encoder;
     u32 width;
     u32 height;
     MathUtil::Rectangle<int> scissor_rect;
@@ -283,6 +295,8 @@ private:
   void SetManualBufferUpload(bool enable);
   std::shared_ptr<PerfQueryTracker> NewPerfQueryTracker();
   void SetSamplerForce(u32 idx, const SamplerState& sampler);
+  id<MTLSamplerState> GetSampler(const SamplerState& sampler);
+  void EncodeArgumentBuffer(const Pipeline* pipe);
   void Sync(BufferPair& buffer);
   Map CommitPreallocation(UploadBuffer buffer_idx, size_t actual_amt);
   void CheckViewport();
@@ -9,6 +9,7 @@
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
+#include "Common/Logging/Log.h"
 
 #include "Core/System.h"
 
@@ -18,6 +19,7 @@
 #include "VideoBackends/Metal/MTLTexture.h"
 #include "VideoBackends/Metal/MTLUtil.h"
 
+#include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Statistics.h"
@@ -127,6 +129,8 @@ Metal::StateTracker::StateTracker() : m_backref(std::make_shared<Backref>(this))
     SetSamplerForce(i, RenderState::GetLinearSamplerState());
     SetTexture(i, m_dummy_texture);
   }
+  if (g_backend_info.bSupportsTimestampQueries && !CreateTimestampBuffer())
+    g_backend_info.bSupportsTimestampQueries = false;
 }
 
 Metal::StateTracker::~StateTracker()
@@ -442,7 +446,7 @@ void Metal::StateTracker::WaitForFlushedEncoders()
 void Metal::StateTracker::ReloadSamplers()
 {
   for (size_t i = 0; i < std::size(m_state.samplers); ++i)
-    m_state.samplers[i] = g_object_cache->GetSampler(m_state.sampler_states[i]);
+    m_state.samplers[i] = GetSampler(m_state.sampler_states[i]);
 }
 
 void Metal::StateTracker::SetManualBufferUpload(bool enabled)
@@ -522,13 +526,20 @@ void Metal::StateTracker::SetTexture(u32 idx, id<MTLTexture> texture)
 
 void Metal::StateTracker::SetSamplerForce(u32 idx, const SamplerState& sampler)
 {
-  m_state.samplers[idx] = g_object_cache->GetSampler(sampler);
+  m_state.samplers[idx] = GetSampler(sampler);
   m_state.sampler_min_lod[idx] = sampler.tm1.min_lod;
   m_state.sampler_max_lod[idx] = sampler.tm1.max_lod;
   m_state.sampler_states[idx] = sampler;
   m_dirty_samplers |= 1 << idx;
 }
 
+id<MTLSamplerState> Metal::StateTracker::GetSampler(const SamplerState& sampler)
+{
+  if (g_features.argument_buffers)
+    return g_object_cache->GetArgumentBufferSampler(sampler);
+  return g_object_cache->GetSampler(sampler);
+}
+
 void Metal::StateTracker::SetSampler(u32 idx, const SamplerState& sampler)
 {
   ASSERT(idx < std::size(m_state.samplers));
@@ -703,6 +714,43 @@ static NSRange RangeOfBits(u32 value)
   return NSMakeRange(low, high + 1 - low);
 }
 
+void Metal::StateTracker::EncodeArgumentBuffer(const Pipeline* pipe)
+{
+  // Every texture and sampler the pipeline uses is rewritten into a fresh allocation, so buffers
+  // still read by previous draws are left alone
+  id<MTLArgumentEncoder> arguments = pipe->GetArgumentEncoder();
+  Map map = Allocate(UploadBuffer::Uniform, [arguments encodedLength], AlignMask::Uniform);
+  // The CPU side of the allocation is at the same offset of the upload buffer
+  const BufferPair& buffer = m_upload_buffers[static_cast<int>(UploadBuffer::Uniform)];
+  [arguments setArgumentBuffer:buffer.cpubuffer offset:map.gpu_offset];
+
+  std::array<id<MTLResource>, MAX_TEXTURES> resources;
+  u32 num_resources = 0;
+  for (u32 bits = pipe->GetTextures(); bits; bits &= bits - 1)
+  {
+    const u32 idx = std::countr_zero(bits);
+    [arguments setTexture:m_state.textures[idx] atIndex:idx];
+    resources[num_resources++] = m_state.textures[idx];
+  }
+  for (u32 bits = pipe->GetSamplers(); bits; bits &= bits - 1)
+  {
+    const u32 idx = std::countr_zero(bits);
+    [arguments setSamplerState:m_state.samplers[idx]
+                       atIndex:VideoCommon::MAX_PIXEL_SHADER_SAMPLERS + idx];
+  }
+
+  // Textures referenced only through the argument buffer have to be made resident explicitly
+  if (num_resources)
+  {
+    [m_current_render_encoder useResources:resources.data()
+                                     count:num_resources
+                                     usage:MTLResourceUsageRead
+                                    stages:MTLRenderStageFragment];
+  }
+  SetFragmentBufferNow(PIXEL_ARGUMENT_BUFFER_INDEX, map.gpu_buffer, map.gpu_offset);
+  ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, [arguments encodedLength]);
+}
+
 void Metal::StateTracker::PrepareRender()
 {
   // BeginRenderPass needs this
@@ -782,20 +830,34 @@ void Metal::StateTracker::PrepareRender()
     if (m_state.vertices)
       SetVertexBufferNow(0, m_state.vertices, 0);
   }
-  if (u32 dirty = m_dirty_textures & pipe->GetTextures())
+  if (id<MTLArgumentEncoder> arguments = pipe->GetArgumentEncoder())
   {
-    m_dirty_textures &= ~pipe->GetTextures();
-    NSRange range = RangeOfBits(dirty);
-    [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+    if ((m_dirty_textures & pipe->GetTextures()) || (m_dirty_samplers & pipe->GetSamplers()) ||
+        m_current.argument_encoder != arguments)
+    {
+      m_dirty_textures &= ~pipe->GetTextures();
+      m_dirty_samplers &= ~pipe->GetSamplers();
+      m_current.argument_encoder = arguments;
+      EncodeArgumentBuffer(pipe);
+    }
   }
-  if (u32 dirty = m_dirty_samplers & pipe->GetSamplers())
+  else
   {
-    m_dirty_samplers &= ~pipe->GetSamplers();
-    NSRange range = RangeOfBits(dirty);
-    [enc setFragmentSamplerStates:&m_state.samplers[range.location]
-                     lodMinClamps:&m_state.sampler_min_lod[range.location]
-                     lodMaxClamps:&m_state.sampler_max_lod[range.location]
-                        withRange:range];
+    if (u32 dirty = m_dirty_textures & pipe->GetTextures())
+    {
+      m_dirty_textures &= ~pipe->GetTextures();
+      NSRange range = RangeOfBits(dirty);
+      [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+    }
+    if (u32 dirty = m_dirty_samplers & pipe->GetSamplers())
+    {
+      m_dirty_samplers &= ~pipe->GetSamplers();
+      NSRange range = RangeOfBits(dirty);
+      [enc setFragmentSamplerStates:&m_state.samplers[range.location]
+                       lodMinClamps:&m_state.sampler_min_lod[range.location]
+                       lodMaxClamps:&m_state.sampler_max_lod[range.location]
+                          withRange:range];
+    }
   }
   if (m_state.perf_query_group != m_current.perf_query_group)
   {
@@ -976,3 +1038,94 @@ void Metal::StateTracker::ResolveTexture(id<MTLTexture> src, id<MTLTexture> dst,
   [enc setLabel:@"Multisample Resolve"];
   [enc endEncoding];
 }
+
+// MARK: Timestamps
+
+bool Metal::StateTracker::CreateTimestampBuffer()
+{
+  id<MTLCounterSet> timestamp_set = nil;
+  for (id<MTLCounterSet> set in [g_device counterSets])
+  {
+    if ([[set name] isEqualToString:MTLCommonCounterSetTimestamp])
+      timestamp_set = set;
+  }
+  if (!timestamp_set)
+    return false;
+
+  auto desc = MRCTransfer([MTLCounterSampleBufferDescriptor new]);
+  [desc setCounterSet:timestamp_set];
+  [desc setStorageMode:MTLStorageModeShared];
+  [desc setSampleCount:AbstractGfx::TIMESTAMP_QUERY_COUNT];
+  [desc setLabel:@"Timestamps"];
+  NSError* err = nullptr;
+  m_timestamp_buffer = MRCTransfer([g_device newCounterSampleBufferWithDescriptor:desc error:&err]);
+  if (!m_timestamp_buffer)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to create timestamp sample buffer: {}",
+                  [[err localizedDescription] UTF8String]);
+    return false;
+  }
+
+  m_timestamp_draws.resize(AbstractGfx::TIMESTAMP_QUERY_COUNT);
+  [g_device sampleTimestamps:&m_timestamp_calibration_cpu
+                gpuTimestamp:&m_timestamp_calibration_gpu];
+  return true;
+}
+
+void Metal::StateTracker::WriteTimestamp(u32 index)
+{
+  if (m_current_render_encoder)
+  {
+    [m_current_render_encoder sampleCountersInBuffer:m_timestamp_buffer
+                                       atSampleIndex:index
+                                         withBarrier:YES];
+  }
+  else if (m_current_compute_encoder)
+  {
+    [m_current_compute_encoder sampleCountersInBuffer:m_timestamp_buffer
+                                        atSampleIndex:index
+                                          withBarrier:YES];
+  }
+  else
+  {
+    id<MTLBlitCommandEncoder> enc = [GetRenderCmdBuf() blitCommandEncoder];
+    [enc setLabel:@"Timestamp"];
+    [enc sampleCountersInBuffer:m_timestamp_buffer atSampleIndex:index withBarrier:YES];
+    [enc endEncoding];
+  }
+  m_timestamp_draws[index] = m_current_draw;
+}
+
+bool Metal::StateTracker::ReadTimestamps(u32 index, u32 count, u64* nanoseconds)
+{
+  const u64 last_finished_draw = m_last_finished_draw.load(std::memory_order_acquire);
+  if (std::any_of(m_timestamp_draws.begin() + index, m_timestamp_draws.begin() + index + count,
+                  [&](u64 draw) { return draw > last_finished_draw; }))
+  {
+    return false;
+  }
+
+  NSData* data = [m_timestamp_buffer resolveCounterRange:NSMakeRange(index, count)];
+  if (!data)
+    return false;
+
+  // GPU timestamps aren't necessarily in nanoseconds, so scale them by how much CPU time passed per
+  // GPU tick since the buffer was created.
+  MTLTimestamp cpu_time, gpu_time;
+  [g_device sampleTimestamps:&cpu_time gpuTimestamp:&gpu_time];
+  const double nanoseconds_per_tick =
+      gpu_time > m_timestamp_calibration_gpu ?
+          static_cast<double>(cpu_time - m_timestamp_calibration_cpu) /
+              static_cast<double>(gpu_time - m_timestamp_calibration_gpu) :
+          1.0;
+
+  const MTLCounterResultTimestamp* results =
+      static_cast<const MTLCounterResultTimestamp*>([data bytes]);
+  for (u32 i = 0; i < count; i++)
+  {
+    const u64 timestamp = results[i].timestamp;
+    nanoseconds[i] =
+        timestamp == MTLCounterErrorValue ? 0 : static_cast<u64>(timestamp * nanoseconds_per_tick);
+  }
+  return true;
+}
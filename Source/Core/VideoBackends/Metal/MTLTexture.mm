@@ -57,6 +57,12 @@ static constexpr u32 STAGING_TEXTURE_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
 
 void Metal::Texture::Load(u32 level, u32 width, u32 height, u32 row_length,  //
                           const u8* buffer, size_t buffer_size, u32 layer)
+{
+  LoadRegion(level, 0, 0, width, height, row_length, buffer, buffer_size, layer);
+}
+
+void Metal::Texture::LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height,
+                                u32 row_length, const u8* buffer, size_t buffer_size, u32 layer)
 {
   @autoreleasepool
   {
@@ -91,7 +97,7 @@ void Metal::Texture::Load(u32 level, u32 width, u32 height, u32 row_length,  //
                   toTexture:m_tex
            destinationSlice:layer
            destinationLevel:level
-          destinationOrigin:MTLOriginMake(0, 0, 0)];
+          destinationOrigin:MTLOriginMake(x, y, 0)];
   }
 }
 
@@ -23,8 +23,14 @@ struct DeviceFeatures
   /// previous render.  This is the case unless a game uses features like bbox or texture downloads.
   bool manual_buffer_upload;
   bool subgroup_ops;
+  /// Bind pixel shader textures and samplers through a Tier 2 argument buffer, so that changing
+  /// them only needs a single buffer offset update at draw time
+  bool argument_buffers;
 };
 
+/// Fragment buffer index of the argument buffer, whose sampler ids follow the texture ids
+constexpr u32 PIXEL_ARGUMENT_BUFFER_INDEX = 3;
+
 extern DeviceFeatures g_features;
 
 namespace Util
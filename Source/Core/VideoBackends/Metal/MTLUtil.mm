@@ -77,8 +77,11 @@ void Metal::Util::PopulateBackendInfo(BackendInfo* backend_info)
   backend_info->bSupportsPartialMultisampleResolve = false;
   backend_info->bSupportsDynamicVertexLoader = true;
   backend_info->bSupportsVSLinePointExpand = true;
+  // Metal allocates each batch separately, so the vertex shader can't address appended arrays.
+  backend_info->bSupportsGPUVertexPulling = false;
   backend_info->bSupportsHDROutput =
       1.0 < [[NSScreen deepestScreen] maximumPotentialExtendedDynamicRangeColorComponentValue];
+  backend_info->bSupportsTimestampQueries = false;
 }
 
 void Metal::Util::PopulateBackendInfoAdapters(BackendInfo* backend_info,
@@ -300,6 +303,9 @@ void Metal::Util::PopulateBackendInfoFeatures(const VideoConfig& config, Backend
     break;
   }
 
+  g_features.argument_buffers =
+      config.bUseArgumentBuffers && [device argumentBuffersSupport] == MTLArgumentBuffersTier2;
+
   g_features.subgroup_ops =
       [device supportsFamily:MTLGPUFamilyMac2] || [device supportsFamily:MTLGPUFamilyApple7];
   if (g_features.subgroup_ops)
@@ -321,6 +327,13 @@ void Metal::Util::PopulateBackendInfoFeatures(const VideoConfig& config, Backend
 
   if (DriverDetails::HasBug(DriverDetails::BUG_BROKEN_DYNAMIC_SAMPLER_INDEXING))
     backend_info->bSupportsDynamicSamplerIndexing = false;
+
+  // A span of GPU work can begin or end between any draws, dispatches or blits. Apple GPUs only
+  // sample counters at stage boundaries, which isn't fine-grained enough.
+  backend_info->bSupportsTimestampQueries =
+      [device supportsCounterSampling:MTLCounterSamplingPointAtDrawBoundary] &&
+      [device supportsCounterSampling:MTLCounterSamplingPointAtDispatchBoundary] &&
+      [device supportsCounterSampling:MTLCounterSamplingPointAtBlitBoundary];
 }
 
 // clang-format off
@@ -561,18 +574,32 @@ std::optional<std::string> Metal::Util::TranslateShaderToMSL(ShaderStage stage,
 
   spirv_cross::CompilerMSL compiler(std::move(*code));
 
+  const bool argument_buffers = stage == ShaderStage::Pixel && Metal::g_features.argument_buffers;
+
   options.set_msl_version(2, 3);
   options.use_framebuffer_fetch_subpasses = true;
+  if (argument_buffers)
+  {
+    // Only the samplers (set 1) go in the argument buffer
+    options.argument_buffers = true;
+    options.argument_buffers_tier = spirv_cross::CompilerMSL::Options::ArgumentBuffersTier::Tier2;
+    compiler.add_discrete_descriptor_set(0);
+    compiler.add_discrete_descriptor_set(2);
+    compiler.add_msl_resource_binding(
+        MakeResourceBinding(spv::ExecutionModelFragment, 1, spirv_cross::kArgumentBufferBinding,
+                            PIXEL_ARGUMENT_BUFFER_INDEX, 0, 0));
+  }
   compiler.set_msl_options(options);
 
   for (auto& binding : resource_bindings)
     compiler.add_msl_resource_binding(binding);
   if (stage == ShaderStage::Pixel)
   {
+    const u32 sampler_base = argument_buffers ? VideoCommon::MAX_PIXEL_SHADER_SAMPLERS : 0;
     for (u32 i = 0; i < VideoCommon::MAX_PIXEL_SHADER_SAMPLERS; i++)  // ps/samp0-N
     {
       compiler.add_msl_resource_binding(
-          MakeResourceBinding(spv::ExecutionModelFragment, 1, i, 0, i, i));
+          MakeResourceBinding(spv::ExecutionModelFragment, 1, i, 0, i, sampler_base + i));
     }
   }
   else if (stage == ShaderStage::Compute)
@@ -59,6 +59,7 @@ void VideoBackend::InitBackendInfo(const WindowSystemInfo& wsi)
   g_backend_info.bSupportsSettingObjectNames = false;
   g_backend_info.bSupportsPartialMultisampleResolve = true;
   g_backend_info.bSupportsDynamicVertexLoader = false;
+  g_backend_info.bSupportsGPUVertexPulling = false;
 
   // aamodes: We only support 1 sample, so no MSAA
   g_backend_info.Adapters.clear();
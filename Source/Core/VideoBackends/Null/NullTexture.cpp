@@ -25,6 +25,11 @@ void NullTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u
 {
 }
 
+void NullTexture::LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length,
+                             const u8* buffer, size_t buffer_size, u32 layer)
+{
+}
+
 NullStagingTexture::NullStagingTexture(StagingTextureType type, const TextureConfig& config)
     : AbstractStagingTexture(type, config)
 {
@@ -12,6 +12,13 @@ OGLBoundingBox::~OGLBoundingBox()
 {
   if (m_buffer_id)
     glDeleteBuffers(1, &m_buffer_id);
+  if (m_readback_buffer_id)
+    glDeleteBuffers(1, &m_readback_buffer_id);
+  for (GLsync fence : m_readback_fences)
+  {
+    if (fence)
+      glDeleteSync(fence);
+  }
 }
 
 bool OGLBoundingBox::Initialize()
@@ -23,6 +30,11 @@ bool OGLBoundingBox::Initialize()
   glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(initial_values), initial_values, GL_DYNAMIC_DRAW);
   glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_buffer_id);
 
+  glGenBuffers(1, &m_readback_buffer_id);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, m_readback_buffer_id);
+  glBufferData(GL_COPY_WRITE_BUFFER, BUFFER_SIZE * MAX_QUEUED_READBACKS, nullptr, GL_STREAM_READ);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
   return true;
 }
 
@@ -74,4 +86,52 @@ void OGLBoundingBox::Write(u32 index, std::span<const BBoxType> values)
   glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 }
 
+bool OGLBoundingBox::QueueRead(u32 slot)
+{
+  // Make the shader writes visible to the copy.
+  glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+  glBindBuffer(GL_COPY_READ_BUFFER, m_buffer_id);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, m_readback_buffer_id);
+  glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, BUFFER_SIZE * slot,
+                      BUFFER_SIZE);
+  glBindBuffer(GL_COPY_READ_BUFFER, 0);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+  if (m_readback_fences[slot])
+    glDeleteSync(m_readback_fences[slot]);
+  m_readback_fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  // Make sure the copy gets submitted, without waiting for it.
+  glFlush();
+  return true;
+}
+
+std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> OGLBoundingBox::ReadQueued(u32 slot,
+                                                                                bool wait)
+{
+  GLsync fence = m_readback_fences[slot];
+  if (fence)
+  {
+    const GLenum result = glClientWaitSync(fence, 0, wait ? GL_TIMEOUT_IGNORED : 0);
+    if (result == GL_TIMEOUT_EXPIRED)
+      return std::nullopt;
+
+    glDeleteSync(fence);
+    m_readback_fences[slot] = nullptr;
+  }
+
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  glBindBuffer(GL_COPY_WRITE_BUFFER, m_readback_buffer_id);
+  void* ptr = glMapBufferRange(GL_COPY_WRITE_BUFFER, BUFFER_SIZE * slot, BUFFER_SIZE,
+                               GL_MAP_READ_BIT);
+  if (ptr)
+  {
+    std::memcpy(values.data(), ptr, BUFFER_SIZE);
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+  }
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  return values;
+}
+
 }  // namespace OGL
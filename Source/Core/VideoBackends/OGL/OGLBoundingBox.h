@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "Common/CommonTypes.h"
 #include "Common/GL/GLUtil.h"
 
@@ -21,8 +23,17 @@ protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
 
+  bool QueueRead(u32 slot) override;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> ReadQueued(u32 slot, bool wait) override;
+
 private:
+  static constexpr u32 BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
+
   GLuint m_buffer_id = 0;
+
+  // Queued reads are copied into a separate buffer, one slot per read, with a fence each.
+  GLuint m_readback_buffer_id = 0;
+  std::array<GLsync, MAX_QUEUED_READBACKS> m_readback_fences = {};
 };
 
 }  // namespace OGL
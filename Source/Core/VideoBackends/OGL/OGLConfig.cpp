@@ -345,6 +345,8 @@ bool PopulateConfig(GLContext* m_main_gl_context)
       GLExtensions::Supports("GL_ARB_derivative_control") || GLExtensions::Version() >= 450;
   g_backend_info.bSupportsTextureQueryLevels =
       GLExtensions::Supports("GL_ARB_texture_query_levels") || GLExtensions::Version() >= 430;
+  g_backend_info.bSupportsTimestampQueries = GLExtensions::Supports("GL_ARB_timer_query") ||
+                                             GLExtensions::Supports("GL_EXT_disjoint_timer_query");
 
   if (GLExtensions::Supports("GL_ARB_shader_storage_buffer_object"))
   {
@@ -689,8 +691,20 @@ bool PopulateConfig(GLContext* m_main_gl_context)
                                                g_backend_info.bSupportsComputeShaders &&
                                                g_ogl_config.bSupportsImageLoadStore;
 
-  // Background compiling is supported only when shared contexts aren't broken.
+  // With KHR_parallel_shader_compile, the driver compiles in the background by itself, and we
+  // only poll for completion. The ARB extension behaves the same.
+  g_ogl_config.bSupportsParallelShaderCompile =
+      GLExtensions::Supports("GL_KHR_parallel_shader_compile") ||
+      GLExtensions::Supports("GL_ARB_parallel_shader_compile");
+  if (g_ogl_config.bSupportsParallelShaderCompile)
+  {
+    // Let the driver use as many threads as it likes.
+    glMaxShaderCompilerThreads(0xFFFFFFFF);
+  }
+
+  // Otherwise, background compiling is supported only when shared contexts aren't broken.
   g_backend_info.bSupportsBackgroundCompiling =
+      g_ogl_config.bSupportsParallelShaderCompile ||
       !DriverDetails::HasBug(DriverDetails::BUG_SHARED_CONTEXT_SHADER_COMPILATION);
 
   // Program binaries are supported on GL4.1+, ARB_get_program_binary, or ES3.
@@ -740,7 +754,7 @@ bool PopulateConfig(GLContext* m_main_gl_context)
                g_ogl_config.gl_version);
 
   const std::string missing_extensions = fmt::format(
-      "{}{}{}{}{}{}{}{}{}{}{}{}{}{}",
+      "{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}",
       g_backend_info.bSupportsDualSourceBlend ? "" : "DualSourceBlend ",
       g_backend_info.bSupportsPrimitiveRestart ? "" : "PrimitiveRestart ",
       g_backend_info.bSupportsEarlyZ ? "" : "EarlyZ ",
@@ -753,7 +767,8 @@ bool PopulateConfig(GLContext* m_main_gl_context)
       g_backend_info.bSupportsGSInstancing ? "" : "GSInstancing ",
       g_backend_info.bSupportsClipControl ? "" : "ClipControl ",
       g_ogl_config.bSupportsCopySubImage ? "" : "CopyImageSubData ",
-      g_backend_info.bSupportsDepthClamp ? "" : "DepthClamp ");
+      g_backend_info.bSupportsDepthClamp ? "" : "DepthClamp ",
+      g_ogl_config.bSupportsParallelShaderCompile ? "" : "ParallelShaderCompile ");
 
   if (missing_extensions.empty())
     INFO_LOG_FMT(VIDEO, "All used OGL Extensions are available.");
@@ -192,6 +192,9 @@ OGLGfx::OGLGfx(std::unique_ptr<GLContext> main_gl_context, float backbuffer_scal
   glGenFramebuffers(1, &m_shared_read_framebuffer);
   glGenFramebuffers(1, &m_shared_draw_framebuffer);
 
+  if (g_backend_info.bSupportsTimestampQueries)
+    glGenQueries(TIMESTAMP_QUERY_COUNT, m_timestamp_queries.data());
+
   if (g_backend_info.bSupportsPrimitiveRestart)
     GLUtil::EnablePrimitiveRestart(m_main_gl_context.get());
 
@@ -202,6 +205,9 @@ OGLGfx::~OGLGfx()
 {
   glDeleteFramebuffers(1, &m_shared_draw_framebuffer);
   glDeleteFramebuffers(1, &m_shared_read_framebuffer);
+
+  if (g_backend_info.bSupportsTimestampQueries)
+    glDeleteQueries(TIMESTAMP_QUERY_COUNT, m_timestamp_queries.data());
 }
 
 bool OGLGfx::IsHeadless() const
@@ -700,6 +706,8 @@ void OGLGfx::UnbindTexture(const AbstractTexture* texture)
 
 std::unique_ptr<VideoCommon::AsyncShaderCompiler> OGLGfx::CreateAsyncShaderCompiler()
 {
+  if (g_ogl_config.bSupportsParallelShaderCompile)
+    return std::make_unique<ParallelAsyncShaderCompiler>();
   return std::make_unique<SharedContextAsyncShaderCompiler>();
 }
 
@@ -732,4 +740,38 @@ SurfaceInfo OGLGfx::GetSurfaceInfo() const
           AbstractTextureFormat::RGBA8};
 }
 
+void OGLGfx::WriteTimestamp(u32 index)
+{
+  glQueryCounter(m_timestamp_queries[index], GL_TIMESTAMP);
+}
+
+bool OGLGfx::ReadTimestamps(u32 index, u32 count, u64* nanoseconds)
+{
+  // Timestamps complete in order, so the last one being available means all of them are.
+  GLuint available = GL_FALSE;
+  glGetQueryObjectuiv(m_timestamp_queries[index + count - 1], GL_QUERY_RESULT_AVAILABLE,
+                      &available);
+  if (!available)
+    return false;
+
+  for (u32 i = 0; i < count; i++)
+  {
+    GLuint64 result;
+    glGetQueryObjectui64v(m_timestamp_queries[index + i], GL_QUERY_RESULT, &result);
+    nanoseconds[i] = result;
+  }
+
+  // With EXT_disjoint_timer_query, the GPU may have changed frequency or been reset while the
+  // timestamps were written, which makes them meaningless.
+  if (m_main_gl_context->IsGLES())
+  {
+    GLint disjoint = GL_FALSE;
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+    if (disjoint)
+      std::fill_n(nanoseconds, count, 0);
+  }
+
+  return true;
+}
+
 }  // namespace OGL
@@ -92,6 +92,9 @@ public:
 
   SurfaceInfo GetSurfaceInfo() const override;
 
+  void WriteTimestamp(u32 index) override;
+  bool ReadTimestamps(u32 index, u32 count, u64* nanoseconds) override;
+
 private:
   void CheckForSurfaceChange();
   void CheckForSurfaceResize();
@@ -111,6 +114,7 @@ private:
   BlendingState m_current_blend_state;
   u32 m_shared_read_framebuffer = 0;
   u32 m_shared_draw_framebuffer = 0;
+  std::array<u32, TIMESTAMP_QUERY_COUNT> m_timestamp_queries{};
   float m_backbuffer_scale;
 };
 
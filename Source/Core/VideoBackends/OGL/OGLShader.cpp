@@ -68,8 +68,11 @@ std::unique_ptr<OGLShader> OGLShader::CreateFromSource(ShaderStage stage, std::s
     if (!shader_id)
       return nullptr;
 
-    return std::make_unique<OGLShader>(stage, shader_type, shader_id, std::move(source_str),
-                                       std::move(name_str));
+    auto shader = std::make_unique<OGLShader>(stage, shader_type, shader_id, std::move(source_str),
+                                              std::move(name_str));
+    if (ProgramShaderCache::IsCompilingInBackground())
+      ProgramShaderCache::AddBackgroundCompile(shader.get());
+    return shader;
   }
 
   // Compute shaders.
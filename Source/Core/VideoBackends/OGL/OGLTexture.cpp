@@ -399,6 +399,44 @@ void OGLTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 }
 
+void OGLTexture::LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length,
+                            const u8* buffer, size_t buffer_size, u32 layer)
+{
+  ASSERT(!IsCompressedFormat(m_config.format));
+  ASSERT(level < m_config.levels && layer < m_config.layers);
+
+  // The level was already allocated by Load, so it can always be updated with glTexSubImage.
+  const GLenum target = GetGLTarget();
+  glActiveTexture(GL_MUTABLE_TEXTURE_INDEX);
+  glBindTexture(target, m_texId);
+
+  if (row_length != width)
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length);
+
+  const GLenum gl_format = GetGLFormatForTextureFormat(m_config.format);
+  const GLenum gl_type = GetGLTypeForTextureFormat(m_config.format);
+  if (m_config.type == AbstractTextureType::Texture_CubeMap)
+  {
+    glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + layer, level, x, y, width, height, gl_format,
+                    gl_type, buffer);
+  }
+  else if (m_config.type == AbstractTextureType::Texture_2D)
+  {
+    glTexSubImage2D(target, level, x, y, width, height, gl_format, gl_type, buffer);
+  }
+  else if (m_config.type == AbstractTextureType::Texture_2DArray)
+  {
+    glTexSubImage3D(target, level, x, y, layer, width, height, 1, gl_format, gl_type, buffer);
+  }
+  else
+  {
+    PanicAlertFmt("Failed to handle texture load - unhandled type");
+  }
+
+  if (row_length != width)
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
 GLenum OGLTexture::GetGLFormatForImageTexture() const
 {
   return GetGLInternalFormatForTextureFormat(m_config.format, true);
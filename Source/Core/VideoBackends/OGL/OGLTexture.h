@@ -30,6 +30,8 @@ public:
                           u32 layer, u32 level) override;
   void Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer, size_t buffer_size,
             u32 layer) override;
+  void LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length, const u8* buffer,
+                  size_t buffer_size, u32 layer) override;
 
   GLuint GetGLTextureId() const { return m_texId; }
   GLenum GetGLTarget() const
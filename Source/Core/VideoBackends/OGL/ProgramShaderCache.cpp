@@ -3,10 +3,12 @@
 
 #include "VideoBackends/OGL/ProgramShaderCache.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -51,6 +53,8 @@ static int num_failures = 0;
 static GLuint CurrentProgram = 0;
 ProgramShaderCache::PipelineProgramMap ProgramShaderCache::s_pipeline_programs;
 std::mutex ProgramShaderCache::s_pipeline_program_lock;
+bool ProgramShaderCache::s_compiling_in_background = false;
+std::vector<ProgramShaderCache::BackgroundCompile> ProgramShaderCache::s_background_compiles;
 static std::string s_glsl_header;
 static std::atomic<u64> s_shader_counter{0};
 static thread_local bool s_is_shared_context = false;
@@ -343,7 +347,8 @@ GLuint ProgramShaderCache::CompileSingleShader(GLenum type, std::string_view cod
   glShaderSource(result, num_strings, src.data(), src_sizes.data());
   glCompileShader(result);
 
-  if (!CheckShaderCompileResult(result, type, code))
+  // Querying the compile status would wait for a background compile to finish.
+  if (!s_compiling_in_background && !CheckShaderCompileResult(result, type, code))
   {
     // Don't try to use this shader
     glDeleteShader(result);
@@ -626,7 +631,8 @@ PipelineProgram* ProgramShaderCache::GetPipelineProgram(const GLVertexFormat* ve
     if (!s_is_shared_context && vao != s_last_VAO)
       glBindVertexArray(s_last_VAO);
 
-    if (!CheckProgramLinkResult(prog->shader.glprogid,
+    if (!s_compiling_in_background &&
+        !CheckProgramLinkResult(prog->shader.glprogid,
                                 vertex_shader ? vertex_shader->GetSource() : std::string_view{},
                                 geometry_shader ? geometry_shader->GetSource() : std::string_view{},
                                 pixel_shader ? pixel_shader->GetSource() : std::string_view{}))
@@ -648,8 +654,20 @@ PipelineProgram* ProgramShaderCache::GetPipelineProgram(const GLVertexFormat* ve
   }
 
   // Set program variables on the shader which will be returned.
-  // This is only needed for drivers which don't support binding layout.
-  prog->shader.SetProgramVariables();
+  // This is only needed for drivers which don't support binding layout. A program which is still
+  // linking in the background gets them once it's complete, as setting them would wait for it.
+  if (s_compiling_in_background && !prog->binary_retrieved)
+  {
+    s_background_compiles.push_back(
+        {.program = prog.get(),
+         .vertex_shader = vertex_shader,
+         .geometry_shader = geometry_shader,
+         .pixel_shader = pixel_shader});
+  }
+  else
+  {
+    prog->shader.SetProgramVariables();
+  }
 
   // If this is a shared context, ensure we sync before we return the program to
   // the main thread. If we don't do this, some driver can lock up (e.g. AMD).
@@ -908,6 +926,59 @@ u64 ProgramShaderCache::GenerateShaderID()
   return s_shader_counter++;
 }
 
+void ProgramShaderCache::BeginBackgroundCompile()
+{
+  ASSERT(!s_compiling_in_background && s_background_compiles.empty());
+  s_compiling_in_background = true;
+}
+
+std::vector<ProgramShaderCache::BackgroundCompile> ProgramShaderCache::EndBackgroundCompile()
+{
+  s_compiling_in_background = false;
+  return std::exchange(s_background_compiles, {});
+}
+
+bool ProgramShaderCache::IsCompilingInBackground()
+{
+  return s_compiling_in_background;
+}
+
+void ProgramShaderCache::AddBackgroundCompile(const OGLShader* shader)
+{
+  s_background_compiles.push_back({.shader = shader});
+}
+
+bool ProgramShaderCache::IsBackgroundCompileComplete(const BackgroundCompile& compile)
+{
+  GLint complete = GL_FALSE;
+  if (compile.shader)
+    glGetShaderiv(compile.shader->GetGLShaderID(), GL_COMPLETION_STATUS_KHR, &complete);
+  else
+    glGetProgramiv(compile.program->shader.glprogid, GL_COMPLETION_STATUS_KHR, &complete);
+  return complete == GL_TRUE;
+}
+
+void ProgramShaderCache::FinishBackgroundCompile(const BackgroundCompile& compile)
+{
+  // A failed compile has already been handed out, so it's only reported here. Drawing with it
+  // reports GL errors, just like a program which was never linked.
+  if (compile.shader)
+  {
+    CheckShaderCompileResult(compile.shader->GetGLShaderID(), compile.shader->GetGLShaderType(),
+                             compile.shader->GetSource());
+    return;
+  }
+
+  if (CheckProgramLinkResult(
+          compile.program->shader.glprogid,
+          compile.vertex_shader ? compile.vertex_shader->GetSource() : std::string_view{},
+          compile.geometry_shader ? compile.geometry_shader->GetSource() : std::string_view{},
+          compile.pixel_shader ? compile.pixel_shader->GetSource() : std::string_view{}))
+  {
+    compile.program->shader.SetProgramVariables();
+  }
+}
+
 bool SharedContextAsyncShaderCompiler::WorkerThreadInitMainThread(void** param)
 {
   std::unique_ptr<GLContext> context = GetOGLGfx()->GetMainGLContext()->CreateSharedContext();
@@ -952,4 +1023,41 @@ void SharedContextAsyncShaderCompiler::WorkerThreadExit(void* param)
   context->ClearCurrent();
   delete context;
 }
+
+bool ParallelAsyncShaderCompiler::CompilesInBackground() const
+{
+  return true;
+}
+
+void ParallelAsyncShaderCompiler::CompileInBackground(WorkItemPtr item)
+{
+  ProgramShaderCache::BeginBackgroundCompile();
+  item->Compile();
+  m_background_work.push_back({std::move(item), ProgramShaderCache::EndBackgroundCompile()});
+}
+
+size_t ParallelAsyncShaderCompiler::PollBackgroundWork()
+{
+  // The driver doesn't necessarily finish compiles in order, so every item is checked.
+  for (auto it = m_background_work.begin(); it != m_background_work.end();)
+  {
+    if (!std::ranges::all_of(it->compiles, ProgramShaderCache::IsBackgroundCompileComplete))
+    {
+      ++it;
+      continue;
+    }
+
+    for (const ProgramShaderCache::BackgroundCompile& compile : it->compiles)
+      ProgramShaderCache::FinishBackgroundCompile(compile);
+    AddCompletedWork(std::move(it->item));
+    it = m_background_work.erase(it);
+  }
+
+  return m_background_work.size();
+}
+
+void ParallelAsyncShaderCompiler::ClearBackgroundWork()
+{
+  m_background_work.clear();
+}
 }  // namespace OGL
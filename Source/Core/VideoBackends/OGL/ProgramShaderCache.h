@@ -8,6 +8,7 @@
 #include <mutex>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/GL/GLUtil.h"
 #include "VideoCommon/AsyncShaderCompiler.h"
@@ -103,6 +104,24 @@ public:
                                              size_t cache_data_size);
   static void ReleasePipelineProgram(PipelineProgram* prog);
 
+  // With KHR_parallel_shader_compile, shaders and programs created between these calls are not
+  // waited on. Their results are checked once the driver reports that they are complete.
+  struct BackgroundCompile
+  {
+    // Either a shader, or a pipeline program along with the shaders it is linked from.
+    const OGLShader* shader = nullptr;
+    PipelineProgram* program = nullptr;
+    const OGLShader* vertex_shader = nullptr;
+    const OGLShader* geometry_shader = nullptr;
+    const OGLShader* pixel_shader = nullptr;
+  };
+  static void BeginBackgroundCompile();
+  static std::vector<BackgroundCompile> EndBackgroundCompile();
+  static bool IsCompilingInBackground();
+  static void AddBackgroundCompile(const OGLShader* shader);
+  static bool IsBackgroundCompileComplete(const BackgroundCompile& compile);
+  static void FinishBackgroundCompile(const BackgroundCompile& compile);
+
 private:
   using PipelineProgramMap =
       std::unordered_map<PipelineProgramKey, std::unique_ptr<PipelineProgram>,
@@ -113,6 +132,9 @@ private:
   static PipelineProgramMap s_pipeline_programs;
   static std::mutex s_pipeline_program_lock;
 
+  static bool s_compiling_in_background;
+  static std::vector<BackgroundCompile> s_background_compiles;
+
   static u32 s_ubo_buffer_size;
   static s32 s_ubo_align;
 
@@ -129,4 +151,23 @@ protected:
   void WorkerThreadExit(void* param) override;
 };
 
+// Compiles on the GPU thread, leaving it to the driver to finish the compiles in the background.
+class ParallelAsyncShaderCompiler : public VideoCommon::AsyncShaderCompiler
+{
+protected:
+  bool CompilesInBackground() const override;
+  void CompileInBackground(WorkItemPtr item) override;
+  size_t PollBackgroundWork() override;
+  void ClearBackgroundWork() override;
+
+private:
+  struct BackgroundWorkItem
+  {
+    WorkItemPtr item;
+    std::vector<ProgramShaderCache::BackgroundCompile> compiles;
+  };
+
+  std::vector<BackgroundWorkItem> m_background_work;
+};
+
 }  // namespace OGL
@@ -4,15 +4,27 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/Thread.h"
+
+#include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
 #include "VideoBackends/Software/Tev.h"
+#include "VideoBackends/Software/TextureSampler.h"
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/PerfQueryBase.h"
@@ -94,21 +106,106 @@ struct Slope
   }
 };
 
+// Height of the horizontal EFB strips that triangles are binned into. Each strip is drawn by a
+// single thread, in submission order, which keeps the output identical to drawing every triangle
+// in order on one thread. This must be a multiple of BLOCK_SIZE.
+static constexpr s32 BIN_HEIGHT = 16;
+static constexpr u32 NUM_BINS = (EFB_HEIGHT + BIN_HEIGHT - 1) / BIN_HEIGHT;
+static_assert(BIN_HEIGHT % BLOCK_SIZE == 0);
+
+// Queued triangles are drawn once this many are pending, to bound memory usage.
+static constexpr size_t MAX_QUEUED_TRIANGLES = 4096;
+
+// Batches with fewer bin entries than this are drawn on the calling thread, since waking up
+// the workers would cost more than it saves.
+static constexpr size_t MIN_PARALLEL_BIN_ENTRIES = 4;
+
+static constexpr u32 MAX_THREADS = 16;
+
+// Everything that is needed to rasterize a triangle once it has been set up.
+struct TriangleSetup
+{
+  Slope z_slope;
+  Slope w_slope;
+  Slope color_slopes[2][4];
+  Slope tex_slopes[8][3];
+
+  // Half-edge constants and fixed-point deltas
+  s32 C1, C2, C3;
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+
+  // Bounding rectangle, clipped to the scissor rectangle
+  s32 minx, maxx, miny, maxy;
+};
+
+// State owned by a single drawing thread.
+struct DrawContext
+{
+  Tev tev;
+  RasterBlock raster_block;
+};
+
+// The z slope is set up in submission order even for rejected triangles, since zfreeze
+// depends on it.
 static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
 
-static Tev tev;
-static RasterBlock rasterBlock;
+static std::vector<TriangleSetup> s_triangles;
+static std::array<std::vector<u32>, NUM_BINS> s_bins;
+static size_t s_num_bin_entries = 0;
+
+// s_contexts[0] belongs to the thread that submits triangles, the others to the workers.
+static std::vector<std::unique_ptr<DrawContext>> s_contexts;
+static std::vector<std::thread> s_workers;
+static std::mutex s_worker_mutex;
+static std::condition_variable s_work_available;
+static std::condition_variable s_work_done;
+static u64 s_work_generation = 0;
+static u32 s_busy_workers = 0;
+static bool s_exit_workers = false;
+static std::atomic<u32> s_next_bin = 0;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+static void WorkerThread(DrawContext* context);
+
 void Init()
 {
+  Shutdown();
+
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  int num_threads = Config::Get(Config::GFX_SW_RASTERIZER_THREADS);
+  if (num_threads <= 0)
+    num_threads = cpu_info.num_cores;
+  num_threads = std::clamp<int>(num_threads, 1, MAX_THREADS);
+
+  for (int i = 0; i < num_threads; ++i)
+    s_contexts.push_back(std::make_unique<DrawContext>());
+
+  s_exit_workers = false;
+  for (int i = 1; i < num_threads; ++i)
+    s_workers.emplace_back(WorkerThread, s_contexts[i].get());
+}
+
+void Shutdown()
+{
+  {
+    std::lock_guard lk(s_worker_mutex);
+    s_exit_workers = true;
+  }
+  s_work_available.notify_all();
+  for (std::thread& worker : s_workers)
+    worker.join();
+  s_workers.clear();
+  s_contexts.clear();
+
+  s_triangles.clear();
+  for (std::vector<u32>& bin : s_bins)
+    bin.clear();
+  s_num_bin_entries = 0;
 }
 
 void ScissorChanged()
@@ -140,29 +237,36 @@ static inline int iround(float x)
 
 void SetTevKonstColors()
 {
-  tev.SetKonstColors();
+  // Queued triangles must be drawn with the colors that were set when they were submitted.
+  Flush();
+
+  for (auto& context : s_contexts)
+    context->tev.SetKonstColors();
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(DrawContext& context, const TriangleSetup& setup, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.raster_block;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  tev.Counters.rasterized_pixels++;
+
+  s32 z = (s32)std::clamp<float>(setup.z_slope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    tev.Counters.perf_query_pixels[PQ_ZCOMP_INPUT_ZCOMPLOC]++;
     if (bpmem.zmode.test_enable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
         return;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    tev.Counters.perf_query_pixels[PQ_ZCOMP_OUTPUT_ZCOMPLOC]++;
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -173,7 +277,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      const float color = ColorSlopes[i][comp].GetValue(x, y);
+      const float color = setup.color_slopes[i][comp].GetValue(x, y);
       tev.Color[i][comp] = (u8)std::clamp<float>(color, 0.0f, 255.0f);
     }
   }
@@ -201,7 +305,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -212,9 +317,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -252,7 +357,8 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterBlock& rasterBlock, const TriangleSetup& setup, s32 blockX,
+                       s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
@@ -263,19 +369,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / setup.w_slope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = setup.tex_slopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = setup.tex_slopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = setup.tex_slopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -285,7 +391,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -297,7 +404,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -314,34 +422,21 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+// Draws the part of a triangle that lies within rows [band_top, band_bottom).
+static void RasterizeTriangle(DrawContext& context, const TriangleSetup& setup, s32 band_top,
+                              s32 band_bottom)
 {
-  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
-  // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
-
-  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
-
-  // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
-  // could also take floor and adjust -8
-  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+  const s32 C1 = setup.C1;
+  const s32 C2 = setup.C2;
+  const s32 C3 = setup.C3;
 
-  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+  const s32 DX12 = setup.DX12;
+  const s32 DX23 = setup.DX23;
+  const s32 DX31 = setup.DX31;
 
-  // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
-
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
+  const s32 DY12 = setup.DY12;
+  const s32 DY23 = setup.DY23;
+  const s32 DY31 = setup.DY31;
 
   // Fixed-point deltas
   const s32 FDX12 = DX12 * 16;
@@ -352,69 +447,17 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 FDY23 = DY23 * 16;
   const s32 FDY31 = DY31 * 16;
 
-  // Bounding rectangle
-  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
-  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
-  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
-  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
-
-  // scissor
-  ASSERT(scissor.rect.left >= 0);
-  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
-  ASSERT(scissor.rect.top >= 0);
-  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
-
-  minx = std::max(minx, scissor.rect.left);
-  maxx = std::min(maxx, scissor.rect.right);
-  miny = std::max(miny, scissor.rect.top);
-  maxy = std::min(maxy, scissor.rect.bottom);
-
-  if (minx >= maxx || miny >= maxy)
-    return;
-
-  // Set up the remaining slopes
-  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
-                         scissor.y_off);
-
-  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
-                1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
-
-  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
-  {
-    for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
-  }
-
-  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
-  {
-    TexSlopes[i][0] =
-        Slope(v0->texCoords[i].x * w[0], v1->texCoords[i].x * w[1], v2->texCoords[i].x * w[2], ctx);
-    TexSlopes[i][1] =
-        Slope(v0->texCoords[i].y * w[0], v1->texCoords[i].y * w[1], v2->texCoords[i].y * w[2], ctx);
-    TexSlopes[i][2] =
-        Slope(v0->texCoords[i].z * w[0], v1->texCoords[i].z * w[1], v2->texCoords[i].z * w[2], ctx);
-  }
-
-  // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
-
-  // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
+  const s32 minx = setup.minx;
+  const s32 maxx = setup.maxx;
+  const s32 miny = std::max(setup.miny, band_top);
+  const s32 maxy = std::min(setup.maxy, band_bottom);
 
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
   s32 block_miny = miny & ~(BLOCK_SIZE - 1);
 
   // Loop through blocks
-  for (s32 y = block_miny & ~(BLOCK_SIZE - 1); y < maxy; y += BLOCK_SIZE)
+  for (s32 y = block_miny; y < maxy; y += BLOCK_SIZE)
   {
     for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
     {
@@ -450,7 +493,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(context.raster_block, setup, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -460,7 +503,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(context, setup, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -483,7 +526,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(context, setup, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -500,6 +543,197 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   }
 }
 
+static void DrawBin(DrawContext& context, u32 bin)
+{
+  const s32 band_top = static_cast<s32>(bin) * BIN_HEIGHT;
+  const s32 band_bottom = band_top + BIN_HEIGHT;
+  for (const u32 triangle : s_bins[bin])
+    RasterizeTriangle(context, s_triangles[triangle], band_top, band_bottom);
+}
+
+// Draws bins until none are left. Bins are handed out dynamically, since the amount of work per
+// bin varies a lot.
+static void DrawBins(DrawContext& context)
+{
+  for (u32 bin = s_next_bin.fetch_add(1, std::memory_order_relaxed); bin < NUM_BINS;
+       bin = s_next_bin.fetch_add(1, std::memory_order_relaxed))
+  {
+    DrawBin(context, bin);
+  }
+}
+
+static void WorkerThread(DrawContext* context)
+{
+  Common::SetCurrentThreadName("SW Rasterizer");
+
+  u64 last_generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock lk(s_worker_mutex);
+      s_work_available.wait(lk,
+                            [&] { return s_exit_workers || s_work_generation != last_generation; });
+      if (s_exit_workers)
+        return;
+      last_generation = s_work_generation;
+    }
+
+    DrawBins(*context);
+
+    {
+      std::lock_guard lk(s_worker_mutex);
+      --s_busy_workers;
+    }
+    s_work_done.notify_one();
+  }
+}
+
+void Flush()
+{
+  if (s_triangles.empty())
+    return;
+
+  TextureSampler::InvalidateCache();
+
+  if (s_workers.empty() || s_num_bin_entries < MIN_PARALLEL_BIN_ENTRIES)
+  {
+    for (u32 bin = 0; bin < NUM_BINS; ++bin)
+      DrawBin(*s_contexts[0], bin);
+  }
+  else
+  {
+    s_next_bin.store(0, std::memory_order_relaxed);
+    {
+      std::lock_guard lk(s_worker_mutex);
+      s_busy_workers = static_cast<u32>(s_workers.size());
+      ++s_work_generation;
+    }
+    s_work_available.notify_all();
+
+    DrawBins(*s_contexts[0]);
+
+    std::unique_lock lk(s_worker_mutex);
+    s_work_done.wait(lk, [] { return s_busy_workers == 0; });
+  }
+
+  // Merge the counters in a fixed order, so that the results don't depend on which thread drew
+  // which bin.
+  for (auto& context : s_contexts)
+    context->tev.FlushCounters();
+
+  s_triangles.clear();
+  for (std::vector<u32>& bin : s_bins)
+    bin.clear();
+  s_num_bin_entries = 0;
+}
+
+static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
+                                  const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor)
+{
+  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
+  // zfreeze depends on it
+  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+
+  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
+
+  // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
+  // could also take floor and adjust -8
+  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+
+  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+
+  // Bounding rectangle
+  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
+  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
+  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
+  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
+
+  // scissor
+  ASSERT(scissor.rect.left >= 0);
+  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
+  ASSERT(scissor.rect.top >= 0);
+  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
+
+  minx = std::max(minx, scissor.rect.left);
+  maxx = std::min(maxx, scissor.rect.right);
+  miny = std::max(miny, scissor.rect.top);
+  maxy = std::min(maxy, scissor.rect.bottom);
+
+  if (minx >= maxx || miny >= maxy)
+    return;
+
+  if (s_triangles.size() >= MAX_QUEUED_TRIANGLES)
+    Flush();
+
+  TriangleSetup& setup = s_triangles.emplace_back();
+  setup.z_slope = ZSlope;
+  setup.minx = minx;
+  setup.maxx = maxx;
+  setup.miny = miny;
+  setup.maxy = maxy;
+
+  // Set up the remaining slopes
+  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
+                         scissor.y_off);
+
+  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
+                1.0f / v2->projectedPosition.w};
+  setup.w_slope = Slope(w[0], w[1], w[2], ctx);
+
+  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
+  {
+    for (int comp = 0; comp < 4; comp++)
+    {
+      setup.color_slopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
+  }
+
+  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
+  {
+    setup.tex_slopes[i][0] =
+        Slope(v0->texCoords[i].x * w[0], v1->texCoords[i].x * w[1], v2->texCoords[i].x * w[2], ctx);
+    setup.tex_slopes[i][1] =
+        Slope(v0->texCoords[i].y * w[0], v1->texCoords[i].y * w[1], v2->texCoords[i].y * w[2], ctx);
+    setup.tex_slopes[i][2] =
+        Slope(v0->texCoords[i].z * w[0], v1->texCoords[i].z * w[1], v2->texCoords[i].z * w[2], ctx);
+  }
+
+  // Deltas
+  setup.DX12 = X1 - X2;
+  setup.DX23 = X2 - X3;
+  setup.DX31 = X3 - X1;
+
+  setup.DY12 = Y1 - Y2;
+  setup.DY23 = Y2 - Y3;
+  setup.DY31 = Y3 - Y1;
+
+  // Half-edge constants
+  setup.C1 = setup.DY12 * X1 - setup.DX12 * Y1;
+  setup.C2 = setup.DY23 * X2 - setup.DX23 * Y2;
+  setup.C3 = setup.DY31 * X3 - setup.DX31 * Y3;
+
+  // Correct for fill convention
+  if (setup.DY12 < 0 || (setup.DY12 == 0 && setup.DX12 > 0))
+    setup.C1++;
+  if (setup.DY23 < 0 || (setup.DY23 == 0 && setup.DX23 > 0))
+    setup.C2++;
+  if (setup.DY31 < 0 || (setup.DY31 == 0 && setup.DX31 > 0))
+    setup.C3++;
+
+  const u32 index = static_cast<u32>(s_triangles.size() - 1);
+  const u32 first_bin = static_cast<u32>(miny / BIN_HEIGHT);
+  const u32 last_bin = static_cast<u32>((maxy - 1) / BIN_HEIGHT);
+  for (u32 bin = first_bin; bin <= last_bin; ++bin)
+    s_bins[bin].push_back(index);
+  s_num_bin_entries += last_bin - first_bin + 1;
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
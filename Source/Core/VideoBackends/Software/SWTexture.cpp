@@ -3,6 +3,7 @@
 
 #include "VideoBackends/Software/SWTexture.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "Common/Assert.h"
@@ -102,6 +103,20 @@ void SWTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   }
 }
 
+void SWTexture::LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length,
+                           const u8* buffer, size_t buffer_size, u32 layer)
+{
+  const u32 level_width = std::max(1u, m_config.width >> level);
+  ASSERT(x + width <= level_width && y + height <= std::max(1u, m_config.height >> level));
+
+  u8* data = GetData(layer, level);
+  for (u32 row = 0; row < height; row++)
+  {
+    memcpy(&data[((y + row) * level_width + x) * sizeof(Pixel)],
+           &buffer[row * row_length * sizeof(Pixel)], width * sizeof(Pixel));
+  }
+}
+
 const u8* SWTexture::GetData(u32 layer, u32 level) const
 {
   return m_data[layer][level].data();
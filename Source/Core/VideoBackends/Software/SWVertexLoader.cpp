@@ -3,6 +3,7 @@
 
 #include "VideoBackends/Software/SWVertexLoader.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 
@@ -68,28 +69,51 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
   m_setup_unit.Init(primitive_type);
   Rasterizer::SetTevKonstColors();
 
-  for (u32 i = 0; i < m_index_generator.GetIndexLen(); i++)
+  // Most vertices are shared by several triangles, as strips and fans are drawn as lists. Each of
+  // them is only transformed the first time it's used, as the transform only depends on the vertex
+  // and on state which doesn't change during a batch.
+  const u32 num_indices_in_batch = m_index_generator.GetIndexLen();
+  const u16 max_index = num_indices_in_batch == 0 ?
+                            0 :
+                            *std::max_element(m_cpu_index_buffer.begin(),
+                                              m_cpu_index_buffer.begin() + num_indices_in_batch);
+  m_transformed_vertices.resize(max_index + 1);
+  m_vertex_transformed.assign(max_index + 1, false);
+
+  const PortableVertexDeclaration& vdec =
+      VertexLoaderManager::GetCurrentVertexFormat()->GetVertexDeclaration();
+  for (u32 i = 0; i < num_indices_in_batch; i++)
   {
     const u16 index = m_cpu_index_buffer[i];
-    memset(static_cast<void*>(&m_vertex), 0, sizeof(m_vertex));
-
-    // parse the videocommon format to our own struct format (m_vertex)
-    SetFormat();
-    ParseVertex(VertexLoaderManager::GetCurrentVertexFormat()->GetVertexDeclaration(), index);
-
-    // transform this vertex so that it can be used for rasterization (outVertex)
-    OutputVertexData* outVertex = m_setup_unit.GetVertex();
-    TransformUnit::TransformPosition(&m_vertex, outVertex);
-    TransformUnit::TransformNormal(&m_vertex, outVertex);
-    TransformUnit::TransformColor(&m_vertex, outVertex);
-    TransformUnit::TransformTexCoord(&m_vertex, outVertex);
+    OutputVertexData& transformed = m_transformed_vertices[index];
+    if (!m_vertex_transformed[index])
+    {
+      memset(static_cast<void*>(&m_vertex), 0, sizeof(m_vertex));
+
+      // parse the videocommon format to our own struct format (m_vertex)
+      SetFormat();
+      ParseVertex(vdec, index);
+
+      // transform this vertex so that it can be used for rasterization
+      transformed = {};
+      TransformUnit::TransformPosition(&m_vertex, &transformed);
+      TransformUnit::TransformNormal(&m_vertex, &transformed);
+      TransformUnit::TransformColor(&m_vertex, &transformed);
+      TransformUnit::TransformTexCoord(&m_vertex, &transformed);
+      m_vertex_transformed[index] = true;
+    }
 
-    // assemble and rasterize the primitive
+    // assemble and rasterize the primitive. The setup unit modifies its copy while clipping.
+    *m_setup_unit.GetVertex() = transformed;
     m_setup_unit.SetupVertex();
 
     INCSTAT(g_stats.this_frame.num_vertices_loaded);
   }
 
+  // Draw the queued triangles. The EFB has to be up to date once the batch is done, since the
+  // state used by the triangles might change after this.
+  Rasterizer::Flush();
+
   INCSTAT(g_stats.this_frame.num_drawn_objects);
 }
 
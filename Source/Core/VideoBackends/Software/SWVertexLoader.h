@@ -30,4 +30,8 @@ protected:
 
   InputVertexData m_vertex{};
   SetupUnit m_setup_unit;
+
+  // The vertices of the current batch, transformed when they're first used
+  std::vector<OutputVertexData> m_transformed_vertices;
+  std::vector<bool> m_vertex_transformed;
 };
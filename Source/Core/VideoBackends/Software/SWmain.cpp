@@ -85,6 +85,7 @@ void VideoSoftware::InitBackendInfo(const WindowSystemInfo& wsi)
   g_backend_info.bSupportsSettingObjectNames = false;
   g_backend_info.bSupportsPartialMultisampleResolve = true;
   g_backend_info.bSupportsDynamicVertexLoader = false;
+  g_backend_info.bSupportsGPUVertexPulling = false;
 
   // aamodes
   g_backend_info.AAModes = {1};
@@ -107,6 +108,7 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 
 void VideoSoftware::Shutdown()
 {
+  Rasterizer::Shutdown();
   ShutdownShared();
 }
 }  // namespace SW
@@ -21,6 +21,12 @@
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/XFMemory.h"
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 static inline s16 Clamp255(s16 in)
 {
   return std::clamp<s16>(in, 0, 255);
@@ -190,6 +196,138 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
     Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
 }
 
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+void Tev::DrawRegular(const TevStageCombiner::ColorCombiner& cc,
+                      const TevStageCombiner::AlphaCombiner& ac)
+{
+  // This evaluates DrawColorRegular and DrawAlphaRegular for all four channels at once, with one
+  // lane per channel (in ABGR order, like TevColor), followed by the clamping done in Draw.
+  // The results are identical to the scalar code.
+  alignas(16) s16 in_a[4], in_b[4], in_c[4], in_d[4];
+  in_a[ALP_C] = m_AlphaInputLUT[ac.a].a;
+  in_b[ALP_C] = m_AlphaInputLUT[ac.b].a;
+  in_c[ALP_C] = m_AlphaInputLUT[ac.c].a;
+  in_d[ALP_C] = m_AlphaInputLUT[ac.d].a;
+  in_a[BLU_C] = m_ColorInputLUT[cc.a].b;
+  in_b[BLU_C] = m_ColorInputLUT[cc.b].b;
+  in_c[BLU_C] = m_ColorInputLUT[cc.c].b;
+  in_d[BLU_C] = m_ColorInputLUT[cc.d].b;
+  in_a[GRN_C] = m_ColorInputLUT[cc.a].g;
+  in_b[GRN_C] = m_ColorInputLUT[cc.b].g;
+  in_c[GRN_C] = m_ColorInputLUT[cc.c].g;
+  in_d[GRN_C] = m_ColorInputLUT[cc.d].g;
+  in_a[RED_C] = m_ColorInputLUT[cc.a].r;
+  in_b[RED_C] = m_ColorInputLUT[cc.b].r;
+  in_c[RED_C] = m_ColorInputLUT[cc.c].r;
+  in_d[RED_C] = m_ColorInputLUT[cc.d].r;
+
+  // Per-lane stage setup. The left shift of the scale is applied as a multiplication, and the
+  // subtraction is applied as a negation, which happens after the rounding shift for color but
+  // before it for alpha.
+  alignas(16) s16 scale_mul[4], bias[4], clamp_min[4], clamp_max[4];
+  alignas(16) s32 round[4], negate_before[4], negate_after[4], divide[4];
+  for (int i = ALP_C; i <= RED_C; i++)
+  {
+    const bool is_alpha = i == ALP_C;
+    const TevScale scale = is_alpha ? ac.scale.Value() : cc.scale.Value();
+    const bool sub = (is_alpha ? ac.op.Value() : cc.op.Value()) == TevOp::Sub;
+    const bool clamp = is_alpha ? ac.clamp.Value() : cc.clamp.Value();
+
+    scale_mul[i] = 1 << s_ScaleLShiftLUT[scale];
+    bias[i] = s_BiasLUT[is_alpha ? ac.bias.Value() : cc.bias.Value()];
+    clamp_min[i] = clamp ? 0 : -1024;
+    clamp_max[i] = clamp ? 255 : 1023;
+    round[i] = (scale == TevScale::Divide2) ? 0 : sub ? 127 : 128;
+    negate_before[i] = (is_alpha && sub) ? -1 : 0;
+    negate_after[i] = (!is_alpha && sub) ? -1 : 0;
+    divide[i] = s_ScaleRShiftLUT[scale] ? -1 : 0;
+  }
+
+  alignas(16) s16 output[4];
+
+#if defined(_M_X86_64)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i mask8 = _mm_set1_epi16(0xFF);
+  const __m128i mul = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(scale_mul));
+
+  // a, b and c are truncated to 8 bits and d to 11 bits, like the InputRegType bitfields
+  const __m128i a = _mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in_a)), mask8);
+  const __m128i b = _mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in_b)), mask8);
+  __m128i c = _mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in_c)), mask8);
+  const __m128i d =
+      _mm_srai_epi16(_mm_slli_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in_d)), 5), 5);
+  c = _mm_add_epi16(c, _mm_srli_epi16(c, 7));
+
+  // (a * (256 - c) + b * c) << scale
+  const __m128i weight_a = _mm_mullo_epi16(_mm_sub_epi16(_mm_set1_epi16(256), c), mul);
+  const __m128i weight_b = _mm_mullo_epi16(c, mul);
+  __m128i temp =
+      _mm_madd_epi16(_mm_unpacklo_epi16(a, b), _mm_unpacklo_epi16(weight_a, weight_b));
+  temp = _mm_add_epi32(temp, _mm_load_si128(reinterpret_cast<const __m128i*>(round)));
+
+  const __m128i neg_before = _mm_load_si128(reinterpret_cast<const __m128i*>(negate_before));
+  const __m128i neg_after = _mm_load_si128(reinterpret_cast<const __m128i*>(negate_after));
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, neg_before), neg_before);
+  temp = _mm_srai_epi32(temp, 8);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, neg_after), neg_after);
+
+  // ((d + bias) << scale) + temp
+  const __m128i d_bias = _mm_add_epi16(d, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(bias)));
+  __m128i result = _mm_add_epi32(
+      _mm_madd_epi16(_mm_unpacklo_epi16(d_bias, zero), _mm_unpacklo_epi16(mul, zero)), temp);
+
+  const __m128i div = _mm_load_si128(reinterpret_cast<const __m128i*>(divide));
+  result = _mm_or_si128(_mm_and_si128(div, _mm_srai_epi32(result, 1)),
+                        _mm_andnot_si128(div, result));
+
+  // The result always fits in 16 bits, so the saturation never triggers
+  __m128i out = _mm_packs_epi32(result, result);
+  out = _mm_min_epi16(out, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(clamp_max)));
+  out = _mm_max_epi16(out, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(clamp_min)));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(output), out);
+#elif defined(_M_ARM_64)
+  const int16x4_t mask8 = vdup_n_s16(0xFF);
+  const int16x4_t mul = vld1_s16(scale_mul);
+
+  // a, b and c are truncated to 8 bits and d to 11 bits, like the InputRegType bitfields
+  const int16x4_t a = vand_s16(vld1_s16(in_a), mask8);
+  const int16x4_t b = vand_s16(vld1_s16(in_b), mask8);
+  int16x4_t c = vand_s16(vld1_s16(in_c), mask8);
+  const int16x4_t d = vshr_n_s16(vshl_n_s16(vld1_s16(in_d), 5), 5);
+  c = vadd_s16(c, vshr_n_s16(c, 7));
+
+  // (a * (256 - c) + b * c) << scale
+  const int16x4_t weight_a = vmul_s16(vsub_s16(vdup_n_s16(256), c), mul);
+  const int16x4_t weight_b = vmul_s16(c, mul);
+  int32x4_t temp = vmlal_s16(vmull_s16(a, weight_a), b, weight_b);
+  temp = vaddq_s32(temp, vld1q_s32(round));
+
+  const uint32x4_t neg_before = vreinterpretq_u32_s32(vld1q_s32(negate_before));
+  const uint32x4_t neg_after = vreinterpretq_u32_s32(vld1q_s32(negate_after));
+  temp = vbslq_s32(neg_before, vnegq_s32(temp), temp);
+  temp = vshrq_n_s32(temp, 8);
+  temp = vbslq_s32(neg_after, vnegq_s32(temp), temp);
+
+  // ((d + bias) << scale) + temp
+  int32x4_t result = vmlal_s16(temp, vadd_s16(d, vld1_s16(bias)), mul);
+
+  const uint32x4_t div = vreinterpretq_u32_s32(vld1q_s32(divide));
+  result = vbslq_s32(div, vshrq_n_s32(result, 1), result);
+
+  // The result always fits in 16 bits, so the saturation never triggers
+  int16x4_t out = vqmovn_s32(result);
+  out = vmin_s16(out, vld1_s16(clamp_max));
+  out = vmax_s16(out, vld1_s16(clamp_min));
+  vst1_s16(output, out);
+#endif
+
+  Reg[cc.dest].b = output[BLU_C];
+  Reg[cc.dest].g = output[GRN_C];
+  Reg[cc.dest].r = output[RED_C];
+  Reg[ac.dest].a = output[ALP_C];
+}
+#endif
+
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
 {
   switch (comp)
@@ -389,7 +527,7 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  Counters.tev_pixels_in++;
 
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
@@ -488,6 +626,14 @@ void Tev::Draw()
     // set color
     SetRasColor(order.getColorChan(stageOdd), ac.rswap);
 
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+    if (cc.bias != TevBias::Compare && ac.bias != TevBias::Compare)
+    {
+      DrawRegular(cc, ac);
+      continue;
+    }
+#endif
+
     // combine inputs
     InputRegType inputs[4];
     inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
@@ -663,21 +809,23 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    Counters.perf_query_pixels[PQ_ZCOMP_INPUT]++;
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    Counters.perf_query_pixels[PQ_ZCOMP_OUTPUT]++;
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  Counters.bbox_left = std::min(Counters.bbox_left, static_cast<u16>(Position[0] & ~1));
+  Counters.bbox_right = std::max(Counters.bbox_right, static_cast<u16>(Position[0] | 1));
+  Counters.bbox_top = std::min(Counters.bbox_top, static_cast<u16>(Position[1] & ~1));
+  Counters.bbox_bottom = std::max(Counters.bbox_bottom, static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  Counters.tev_pixels_out++;
+  Counters.perf_query_pixels[PQ_BLEND_INPUT]++;
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
@@ -695,3 +843,27 @@ void Tev::SetKonstColors()
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
 }
+
+void Tev::FlushCounters()
+{
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, Counters.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, Counters.tev_pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, Counters.tev_pixels_out);
+
+  for (u32 i = 0; i < PQ_NUM_MEMBERS; ++i)
+  {
+    if (Counters.perf_query_pixels[i] != 0)
+    {
+      EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(i),
+                                            Counters.perf_query_pixels[i]);
+    }
+  }
+
+  if (Counters.bbox_left <= Counters.bbox_right)
+  {
+    BBoxManager::Update(Counters.bbox_left, Counters.bbox_right, Counters.bbox_top,
+                        Counters.bbox_bottom);
+  }
+
+  Counters = {};
+}
@@ -5,8 +5,10 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -211,6 +213,10 @@ class Tev
   void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
   void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
 
+  // Vectorized version of DrawColorRegular and DrawAlphaRegular, including the clamping.
+  void DrawRegular(const TevStageCombiner::ColorCombiner& cc,
+                   const TevStageCombiner::AlphaCombiner& ac);
+
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
 public:
@@ -230,6 +236,23 @@ public:
     RED_C
   };
 
+  // Statistics, performance counter and bounding box updates made while drawing. These are
+  // collected per instance so that several Tev instances can draw at the same time, and are
+  // applied to the global state by FlushCounters.
+  struct PixelCounters
+  {
+    u32 rasterized_pixels = 0;
+    u32 tev_pixels_in = 0;
+    u32 tev_pixels_out = 0;
+    std::array<u32, PQ_NUM_MEMBERS> perf_query_pixels{};
+    u16 bbox_left = 0xFFFF;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xFFFF;
+    u16 bbox_bottom = 0;
+  };
+  PixelCounters Counters;
+
   void SetKonstColors();
   void Draw();
+  void FlushCounters();
 };
@@ -3,9 +3,18 @@
 
 #include "VideoBackends/Software/TextureEncoder.h"
 
+#include <array>
+#include <cstring>
+
+#if defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/Align.h"
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 
@@ -1423,29 +1432,267 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
   }
 }
 
-namespace
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+// Vectorized encoders for the most common copies. They work on one row of a block at a time and
+// have to give exactly the same results as the loops above.
+
+// Shuffles indexing 16 bytes, where 0x80 selects zero on both SSSE3 and NEON
+using ShuffleTable = std::array<u8, 16>;
+
+// 4 pixels of B G R become A R pairs followed by G B pairs, with A left for the caller
+alignas(16) constexpr ShuffleTable RGB8_TO_AR_GB = {0x80, 2, 0x80, 5, 0x80, 8, 0x80, 11,
+                                                    1,    0, 4,    3, 7,    6, 10,   9};
+// 4 pixels of 24 bits each get a 32-bit lane
+alignas(16) constexpr ShuffleTable SPREAD_24_TO_32 = {0, 1, 2,  0x80, 3, 4,  5,  0x80,
+                                                      6, 7, 8,  0x80, 9, 10, 11, 0x80};
+// 4 lanes of A R G B bytes become A R pairs followed by G B pairs
+alignas(16) constexpr ShuffleTable ARGB_TO_AR_GB = {0, 1, 4, 5, 8, 9, 12, 13,
+                                                    2, 3, 6, 7, 10, 11, 14, 15};
+
+#if defined(_M_X86_64)
+FUNCTION_TARGET_SSSE3
+static inline __m128i LoadShuffle(const ShuffleTable& table)
 {
-void EncodeEfbCopy(u8* dst, const EFBCopyParams& params, u32 native_width, u32 bytes_per_row,
-                   u32 num_blocks_y, u32 memory_stride, const MathUtil::Rectangle<int>& src_rect,
-                   bool scale_by_half)
+  return _mm_load_si128(reinterpret_cast<const __m128i*>(table.data()));
+}
+
+FUNCTION_TARGET_SSSE3
+static inline __m128i Load4Pixels(const u8* src)
 {
-  const u8* src = EfbInterface::GetPixelPointer(src_rect.left, src_rect.top, params.depth);
+  // Only the 12 bytes of the pixels are read, as the last row may end at the end of the EFB
+  u64 low;
+  u32 high;
+  std::memcpy(&low, src, sizeof(low));
+  std::memcpy(&high, src + sizeof(low), sizeof(high));
+  return _mm_set_epi64x(high, low);
+}
+
+FUNCTION_TARGET_SSSE3
+static inline void StoreARGB(u8* dst, __m128i ar_gb)
+{
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), ar_gb);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 32), _mm_unpackhi_epi64(ar_gb, ar_gb));
+}
+#else
+static inline uint8x16_t LoadShuffle(const ShuffleTable& table)
+{
+  return vld1q_u8(table.data());
+}
+
+static inline uint8x16_t Load4Pixels(const u8* src)
+{
+  // Only the 12 bytes of the pixels are read, as the last row may end at the end of the EFB
+  std::array<u8, 16> pixels{};
+  std::memcpy(pixels.data(), src, 12);
+  return vld1q_u8(pixels.data());
+}
+
+static inline void StoreARGB(u8* dst, uint8x16_t ar_gb)
+{
+  vst1_u8(dst, vget_low_u8(ar_gb));
+  vst1_u8(dst + 32, vget_high_u8(ar_gb));
+}
+#endif
+
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRGBA8RowFromRGB8(u8* dst, const u8* src)
+{
+#if defined(_M_X86_64)
+  const __m128i alpha = _mm_set_epi64x(0, 0x00ff00ff00ff00ff);
+  const __m128i ar_gb = _mm_shuffle_epi8(Load4Pixels(src), LoadShuffle(RGB8_TO_AR_GB));
+  StoreARGB(dst, _mm_or_si128(ar_gb, alpha));
+#else
+  const uint8x16_t alpha = vcombine_u8(vreinterpret_u8_u16(vdup_n_u16(0x00ff)), vdup_n_u8(0));
+  const uint8x16_t ar_gb = vqtbl1q_u8(Load4Pixels(src), LoadShuffle(RGB8_TO_AR_GB));
+  StoreARGB(dst, vorrq_u8(ar_gb, alpha));
+#endif
+}
+
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRGBA8RowFromRGBA6(u8* dst, const u8* src)
+{
+  // Each pixel is A B G R from the lowest bits up, with 6 bits each. These are moved into bytes in
+  // the order A R G B and converted to 8 bits like Convert6To8.
+#if defined(_M_X86_64)
+  const __m128i pixels = _mm_shuffle_epi8(Load4Pixels(src), LoadShuffle(SPREAD_24_TO_32));
+  const __m128i mask = _mm_set1_epi32(0x3f);
+  const __m128i a = _mm_and_si128(pixels, mask);
+  const __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 6), mask);
+  const __m128i g = _mm_and_si128(_mm_srli_epi32(pixels, 12), mask);
+  const __m128i r = _mm_srli_epi32(pixels, 18);
+  __m128i argb = _mm_or_si128(_mm_or_si128(a, _mm_slli_epi32(r, 8)),
+                              _mm_or_si128(_mm_slli_epi32(g, 16), _mm_slli_epi32(b, 24)));
+  argb = _mm_or_si128(_mm_slli_epi32(argb, 2),
+                      _mm_and_si128(_mm_srli_epi32(argb, 4), _mm_set1_epi8(0x03)));
+  StoreARGB(dst, _mm_shuffle_epi8(argb, LoadShuffle(ARGB_TO_AR_GB)));
+#else
+  const uint32x4_t pixels =
+      vreinterpretq_u32_u8(vqtbl1q_u8(Load4Pixels(src), LoadShuffle(SPREAD_24_TO_32)));
+  const uint32x4_t mask = vdupq_n_u32(0x3f);
+  const uint32x4_t a = vandq_u32(pixels, mask);
+  const uint32x4_t b = vandq_u32(vshrq_n_u32(pixels, 6), mask);
+  const uint32x4_t g = vandq_u32(vshrq_n_u32(pixels, 12), mask);
+  const uint32x4_t r = vshrq_n_u32(pixels, 18);
+  uint32x4_t argb = vorrq_u32(vorrq_u32(a, vshlq_n_u32(r, 8)),
+                              vorrq_u32(vshlq_n_u32(g, 16), vshlq_n_u32(b, 24)));
+  argb = vorrq_u32(vshlq_n_u32(argb, 2), vandq_u32(vshrq_n_u32(argb, 4), vdupq_n_u32(0x03030303)));
+  StoreARGB(dst, vqtbl1q_u8(vreinterpretq_u8_u32(argb), LoadShuffle(ARGB_TO_AR_GB)));
+#endif
+}
+
+#if defined(_M_X86_64)
+// 8 pixels of B G R, split over the first 16 bytes and the last 8 bytes, become 16-bit lanes
+alignas(16) constexpr ShuffleTable R_FROM_LOW = {2,    0x80, 5,    0x80, 8,    0x80, 11,   0x80,
+                                                 14,   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80};
+alignas(16) constexpr ShuffleTable R_FROM_HIGH = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+                                                  0x80, 0x80, 1,    0x80, 4,    0x80, 7,    0x80};
+alignas(16) constexpr ShuffleTable G_FROM_LOW = {1,    0x80, 4,    0x80, 7,    0x80, 10,   0x80,
+                                                 13,   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80};
+alignas(16) constexpr ShuffleTable G_FROM_HIGH = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+                                                  0x80, 0x80, 0,    0x80, 3,    0x80, 6,    0x80};
+alignas(16) constexpr ShuffleTable B_FROM_LOW = {0,    0x80, 3,    0x80, 6,    0x80, 9,    0x80,
+                                                 12,   0x80, 15,   0x80, 0x80, 0x80, 0x80, 0x80};
+alignas(16) constexpr ShuffleTable B_FROM_HIGH = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+                                                  0x80, 0x80, 0x80, 0x80, 2,    0x80, 5,    0x80};
+#endif
+
+FUNCTION_TARGET_SSSE3
+static inline void EncodeI8RowFromRGB8(u8* dst, const u8* src)
+{
+  // Same as RGB8_to_I for 8 pixels
+#if defined(_M_X86_64)
+  const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i high = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 16));
+  const __m128i r = _mm_or_si128(_mm_shuffle_epi8(low, LoadShuffle(R_FROM_LOW)),
+                                 _mm_shuffle_epi8(high, LoadShuffle(R_FROM_HIGH)));
+  const __m128i g = _mm_or_si128(_mm_shuffle_epi8(low, LoadShuffle(G_FROM_LOW)),
+                                 _mm_shuffle_epi8(high, LoadShuffle(G_FROM_HIGH)));
+  const __m128i b = _mm_or_si128(_mm_shuffle_epi8(low, LoadShuffle(B_FROM_LOW)),
+                                 _mm_shuffle_epi8(high, LoadShuffle(B_FROM_HIGH)));
+  __m128i val = _mm_add_epi16(_mm_set1_epi16(4096), _mm_mullo_epi16(r, _mm_set1_epi16(66)));
+  val = _mm_add_epi16(val, _mm_mullo_epi16(g, _mm_set1_epi16(129)));
+  val = _mm_add_epi16(val, _mm_mullo_epi16(b, _mm_set1_epi16(25)));
+  val = _mm_srli_epi16(val, 8);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(val, val));
+#else
+  const uint8x8x3_t bgr = vld3_u8(src);
+  uint16x8_t val = vmlal_u8(vdupq_n_u16(4096), bgr.val[2], vdup_n_u8(66));
+  val = vmlal_u8(val, bgr.val[1], vdup_n_u8(129));
+  val = vmlal_u8(val, bgr.val[0], vdup_n_u8(25));
+  vst1_u8(dst, vshrn_n_u16(val, 8));
+#endif
+}
 
+template <void (*EncodeRow)(u8*, const u8*)>
+FUNCTION_TARGET_SSSE3 static void EncodeRGBA8Vectorized(u8* dst, const u8* src)
+{
+  u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
+  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  u8* dstBlockStart = dst;
+
+  SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
+  SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+  for (int tBlk = 0; tBlk < tBlkCount; tBlk++)
+  {
+    dst = dstBlockStart;
+    for (int sBlk = 0; sBlk < sBlkCount; sBlk++)
+    {
+      // A R pairs go in the first 32 bytes of the block, and G B pairs in the next 32
+      for (int t = 0; t < tBlkSize; t++)
+      {
+        EncodeRow(dst, src);
+        src += sBlkSize * 3 + tSpan;
+        dst += 8;
+      }
+      src += sBlkSpan;
+      dst += 32;
+    }
+    src += tBlkSpan;
+    dstBlockStart += writeStride;
+  }
+}
+
+FUNCTION_TARGET_SSSE3
+static void EncodeI8Vectorized(u8* dst, const u8* src)
+{
+  u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
+  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  u8* dstBlockStart = dst;
+
+  SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
+  SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+  for (int tBlk = 0; tBlk < tBlkCount; tBlk++)
+  {
+    dst = dstBlockStart;
+    for (int sBlk = 0; sBlk < sBlkCount; sBlk++)
+    {
+      for (int t = 0; t < tBlkSize; t++)
+      {
+        EncodeI8RowFromRGB8(dst, src);
+        src += sBlkSize * 3 + tSpan;
+        dst += 8;
+      }
+      src += sBlkSpan;
+    }
+    src += tBlkSpan;
+    dstBlockStart += writeStride;
+  }
+}
+#endif
+
+static bool EncodeVectorized(u8* dst, const u8* src, PixelFormat efb_format,
+                             EFBCopyFormat copy_format, bool yuv)
+{
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+#if defined(_M_X86_64)
+  if (!cpu_info.bSSSE3)
+    return false;
+#endif
+
+  // RGB565 is stored as RGB8 in the software EFB, and Z24 has the same layout for these formats
+  const bool rgb8_layout = efb_format == PixelFormat::RGB8_Z24 ||
+                           efb_format == PixelFormat::RGB565_Z16 || efb_format == PixelFormat::Z24;
+
+  if (copy_format == EFBCopyFormat::RGBA8)
+  {
+    if (efb_format == PixelFormat::RGBA6_Z24)
+      EncodeRGBA8Vectorized<EncodeRGBA8RowFromRGBA6>(dst, src);
+    else if (rgb8_layout)
+      EncodeRGBA8Vectorized<EncodeRGBA8RowFromRGB8>(dst, src);
+    else
+      return false;
+    return true;
+  }
+
+  if (yuv && efb_format != PixelFormat::Z24 && rgb8_layout &&
+      (copy_format == EFBCopyFormat::R8 || copy_format == EFBCopyFormat::R8_0x1))
+  {
+    EncodeI8Vectorized(dst, src);
+    return true;
+  }
+#endif
+
+  return false;
+}
+
+void EncodeEfbPixels(u8* dst, const u8* src, PixelFormat efb_format, EFBCopyFormat copy_format,
+                     bool yuv, bool scale_by_half, bool allow_vectorized)
+{
   if (scale_by_half)
   {
-    switch (params.efb_format)
+    switch (efb_format)
     {
     case PixelFormat::RGBA6_Z24:
-      EncodeRGBA6halfscale(dst, src, params.copy_format, params.yuv);
+      EncodeRGBA6halfscale(dst, src, copy_format, yuv);
       break;
     case PixelFormat::RGB8_Z24:
-      EncodeRGB8halfscale(dst, src, params.copy_format, params.yuv);
+      EncodeRGB8halfscale(dst, src, copy_format, yuv);
       break;
     case PixelFormat::RGB565_Z16:
-      EncodeRGB8halfscale(dst, src, params.copy_format, params.yuv);
+      EncodeRGB8halfscale(dst, src, copy_format, yuv);
       break;
     case PixelFormat::Z24:
-      EncodeZ24halfscale(dst, src, params.copy_format);
+      EncodeZ24halfscale(dst, src, copy_format);
       break;
     default:
       break;
@@ -1453,25 +1700,38 @@ void EncodeEfbCopy(u8* dst, const EFBCopyParams& params, u32 native_width, u32 b
   }
   else
   {
-    switch (params.efb_format)
+    if (allow_vectorized && EncodeVectorized(dst, src, efb_format, copy_format, yuv))
+      return;
+
+    switch (efb_format)
     {
     case PixelFormat::RGBA6_Z24:
-      EncodeRGBA6(dst, src, params.copy_format, params.yuv);
+      EncodeRGBA6(dst, src, copy_format, yuv);
       break;
     case PixelFormat::RGB8_Z24:
-      EncodeRGB8(dst, src, params.copy_format, params.yuv);
+      EncodeRGB8(dst, src, copy_format, yuv);
       break;
     case PixelFormat::RGB565_Z16:
-      EncodeRGB8(dst, src, params.copy_format, params.yuv);
+      EncodeRGB8(dst, src, copy_format, yuv);
       break;
     case PixelFormat::Z24:
-      EncodeZ24(dst, src, params.copy_format);
+      EncodeZ24(dst, src, copy_format);
       break;
     default:
       break;
     }
   }
 }
+
+namespace
+{
+void EncodeEfbCopy(u8* dst, const EFBCopyParams& params, u32 native_width, u32 bytes_per_row,
+                   u32 num_blocks_y, u32 memory_stride, const MathUtil::Rectangle<int>& src_rect,
+                   bool scale_by_half)
+{
+  const u8* src = EfbInterface::GetPixelPointer(src_rect.left, src_rect.top, params.depth);
+  EncodeEfbPixels(dst, src, params.efb_format, params.copy_format, params.yuv, scale_by_half);
+}
 }  // namespace
 
 void Encode(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
@@ -13,4 +13,10 @@ void Encode(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native
             u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
             const MathUtil::Rectangle<int>& src_rect, bool scale_by_half, float y_scale,
             float gamma);
+
+// Encodes the pixels at src, which are laid out like the EFB with rows of 640 pixels of 3 bytes
+// each, using the copy size and stride set in bpmem. Vectorized encoders are used for some formats
+// when the CPU supports them, unless allow_vectorized is false for testing them.
+void EncodeEfbPixels(u8* dst, const u8* src, PixelFormat efb_format, EFBCopyFormat copy_format,
+                     bool yuv, bool scale_by_half, bool allow_vectorized = true);
 }
@@ -4,8 +4,12 @@
 #include "VideoBackends/Software/TextureSampler.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstring>
 #include <span>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
@@ -115,6 +119,124 @@ void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample)
   }
 }
 
+namespace
+{
+// Everything a texel is decoded from
+struct TexelSource
+{
+  std::span<const u8> image;
+  std::span<const u8> image_odd;
+  std::span<const u8> tlut;
+  TextureFormat format;
+  TLUTFormat tlut_format;
+  int width_minus_1;
+  int height_minus_1;
+  bool rgba8_from_tmem;
+
+  bool operator==(const TexelSource& other) const
+  {
+    return image.data() == other.image.data() && image.size() == other.image.size() &&
+           image_odd.data() == other.image_odd.data() && tlut.data() == other.tlut.data() &&
+           format == other.format && tlut_format == other.tlut_format &&
+           width_minus_1 == other.width_minus_1 && height_minus_1 == other.height_minus_1 &&
+           rgba8_from_tmem == other.rgba8_from_tmem;
+  }
+};
+
+void DecodeTexel(const TexelSource& source, int s, int t, u8* texel)
+{
+  if (source.rgba8_from_tmem)
+  {
+    TexDecoder_DecodeTexelRGBA8FromTmem(texel, source.image, source.image_odd, s, t,
+                                        source.width_minus_1);
+  }
+  else
+  {
+    TexDecoder_DecodeTexel(texel, source.image, s, t, source.width_minus_1, source.format,
+                           source.tlut, source.tlut_format);
+  }
+}
+
+// Decoding a texel takes much longer than filtering it, and neighboring pixels mostly sample the
+// same texels. So the texels of each texture level are decoded into RGBA8 a tile at a time, as
+// they're first sampled, and kept until the next flush of the rasterizer, after which the texture
+// memory or state may have changed.
+constexpr int TILE_SIZE = 8;
+constexpr u32 MAX_CACHED_MIPS = 12;
+
+struct CachedLevel
+{
+  u64 generation = 0;
+  TexelSource source{};
+  int width = 0;
+  int tiles_wide = 0;
+  std::vector<u8> texels;
+  std::vector<bool> decoded_tiles;
+
+  const u8* GetTexel(int s, int t)
+  {
+    const size_t tile = static_cast<size_t>(t / TILE_SIZE) * tiles_wide + s / TILE_SIZE;
+    if (!decoded_tiles[tile])
+    {
+      DecodeTile(s / TILE_SIZE * TILE_SIZE, t / TILE_SIZE * TILE_SIZE);
+      decoded_tiles[tile] = true;
+    }
+    return &texels[(static_cast<size_t>(t) * width + s) * 4];
+  }
+
+  void DecodeTile(int tile_s, int tile_t)
+  {
+    const int end_s = std::min(tile_s + TILE_SIZE, width);
+    const int end_t = std::min(tile_t + TILE_SIZE, source.height_minus_1 + 1);
+    for (int t = tile_t; t < end_t; t++)
+    {
+      for (int s = tile_s; s < end_s; s++)
+        DecodeTexel(source, s, t, &texels[(static_cast<size_t>(t) * width + s) * 4]);
+    }
+  }
+};
+
+std::atomic<u64> s_cache_generation = 1;
+// Each rasterizer thread has its own cache.
+thread_local std::array<std::array<CachedLevel, MAX_CACHED_MIPS>, 8> s_cached_levels;
+
+CachedLevel* GetCachedLevel(u8 texmap, s32 mip, const TexelSource& source)
+{
+  if (static_cast<u32>(mip) >= MAX_CACHED_MIPS)
+    return nullptr;
+
+  CachedLevel& level = s_cached_levels[texmap][mip];
+  const u64 generation = s_cache_generation.load(std::memory_order_relaxed);
+  if (level.generation == generation && level.source == source)
+    return &level;
+
+  const int width = source.width_minus_1 + 1;
+  const int height = source.height_minus_1 + 1;
+  level.generation = generation;
+  level.source = source;
+  level.width = width;
+  level.tiles_wide = (width + TILE_SIZE - 1) / TILE_SIZE;
+  level.texels.resize(static_cast<size_t>(width) * height * 4);
+  level.decoded_tiles.assign(
+      static_cast<size_t>(level.tiles_wide) * ((height + TILE_SIZE - 1) / TILE_SIZE), false);
+  return &level;
+}
+
+const u8* FetchTexel(CachedLevel* level, const TexelSource& source, int s, int t, u8* scratch)
+{
+  if (level)
+    return level->GetTexel(s, t);
+
+  DecodeTexel(source, s, t, scratch);
+  return scratch;
+}
+}  // namespace
+
+void InvalidateCache()
+{
+  s_cache_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
 void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
@@ -150,6 +272,7 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
 
   // reduce sample location and texture size to mip level
   // move texture pointer to mip location
+  const s32 cached_mip = mip;
   if (mip)
   {
     int mipWidth = image_width_minus_1 + 1;
@@ -177,6 +300,17 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     }
   }
 
+  const TexelSource source{image_src,
+                           image_src_odd,
+                           tlut,
+                           texfmt,
+                           tlutfmt,
+                           image_width_minus_1,
+                           image_height_minus_1,
+                           texfmt == TextureFormat::RGBA8 &&
+                               texUnit.texImage1.cache_manually_managed};
+  CachedLevel* const level = GetCachedLevel(texmap, cached_mip, source);
+
   if (linear)
   {
     // offset linear sampling
@@ -194,7 +328,7 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     int imageTPlus1 = imageT + 1;
     const int fractT = t & 0x7f;
 
-    u8 sampledTex[4];
+    u8 scratch[4][4];
     u32 texel[4];
 
     WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
@@ -202,42 +336,15 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     WrapCoord(&imageSPlus1, tm0.wrap_s, image_width_minus_1 + 1);
     WrapCoord(&imageTPlus1, tm0.wrap_t, image_height_minus_1 + 1);
 
-    if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1.cache_manually_managed))
-    {
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageS, imageT, image_width_minus_1, texfmt,
-                             tlut, tlutfmt);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageSPlus1, imageT, image_width_minus_1,
-                             texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageS, imageTPlus1, image_width_minus_1,
-                             texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageSPlus1, imageTPlus1, image_width_minus_1,
-                             texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
-    }
-    else
-    {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageS, imageT,
-                                          image_width_minus_1);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageSPlus1, imageT,
-                                          image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
+    const u8* texel_00 = FetchTexel(level, source, imageS, imageT, scratch[0]);
+    const u8* texel_10 = FetchTexel(level, source, imageSPlus1, imageT, scratch[1]);
+    const u8* texel_01 = FetchTexel(level, source, imageS, imageTPlus1, scratch[2]);
+    const u8* texel_11 = FetchTexel(level, source, imageSPlus1, imageTPlus1, scratch[3]);
 
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageS, imageTPlus1,
-                                          image_width_minus_1);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageSPlus1,
-                                          imageTPlus1, image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
-    }
+    SetTexel(texel_00, texel, (128 - fractS) * (128 - fractT));
+    AddTexel(texel_10, texel, (fractS) * (128 - fractT));
+    AddTexel(texel_01, texel, (128 - fractS) * (fractT));
+    AddTexel(texel_11, texel, (fractS) * (fractT));
 
     sample[0] = (u8)(texel[0] >> 14);
     sample[1] = (u8)(texel[1] >> 14);
@@ -254,16 +361,10 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
     WrapCoord(&imageT, tm0.wrap_t, image_height_minus_1 + 1);
 
-    if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1.cache_manually_managed))
-    {
-      TexDecoder_DecodeTexel(sample, image_src, imageS, imageT, image_width_minus_1, texfmt, tlut,
-                             tlutfmt);
-    }
+    if (level)
+      std::memcpy(sample, level->GetTexel(imageS, imageT), 4);
     else
-    {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sample, image_src, image_src_odd, imageS, imageT,
-                                          image_width_minus_1);
-    }
+      DecodeTexel(source, imageS, imageT, sample);
   }
 }
 }  // namespace TextureSampler
@@ -11,6 +11,10 @@ void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample);
 
 void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample);
 
+// Texels are cached between samples. This has to be called before drawing if the texture memory
+// or the texture state could have changed since the last draw.
+void InvalidateCache();
+
 enum
 {
   RED_SMP,
@@ -94,6 +94,9 @@ bool CommandBufferManager::CreateCommandBuffers(size_t swapchain_image_count)
       LOG_VULKAN_ERROR(res, "vkCreateSemaphore failed: ");
       return false;
     }
+
+    if (g_vulkan_context->HasTransferQueue() && !CreateTransferCommandBuffer(&resources))
+      return false;
   }
 
   m_present_semaphores.reserve(swapchain_image_count);
@@ -115,6 +118,44 @@ bool CommandBufferManager::CreateCommandBuffers(size_t swapchain_image_count)
   return true;
 }
 
+bool CommandBufferManager::CreateTransferCommandBuffer(CmdBufferResources* resources)
+{
+  static constexpr VkSemaphoreCreateInfo semaphore_create_info = {
+      VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, nullptr, 0};
+
+  VkDevice device = g_vulkan_context->GetDevice();
+  resources->transfer_command_buffer_used = false;
+
+  VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, nullptr, 0,
+                                       g_vulkan_context->GetTransferQueueFamilyIndex()};
+  VkResult res =
+      vkCreateCommandPool(device, &pool_info, nullptr, &resources->transfer_command_pool);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateCommandPool failed: ");
+    return false;
+  }
+
+  VkCommandBufferAllocateInfo buffer_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                             nullptr, resources->transfer_command_pool,
+                                             VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
+  res = vkAllocateCommandBuffers(device, &buffer_info, &resources->transfer_command_buffer);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
+    return false;
+  }
+
+  res = vkCreateSemaphore(device, &semaphore_create_info, nullptr, &resources->transfer_semaphore);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateSemaphore failed: ");
+    return false;
+  }
+
+  return true;
+}
+
 void CommandBufferManager::DestroyCommandBuffers()
 {
   VkDevice device = g_vulkan_context->GetDevice();
@@ -127,6 +168,8 @@ void CommandBufferManager::DestroyCommandBuffers()
     // objects which are pending destruction being in-use.
     if (resources.command_pool != VK_NULL_HANDLE)
       vkDestroyCommandPool(device, resources.command_pool, nullptr);
+    if (resources.transfer_command_pool != VK_NULL_HANDLE)
+      vkDestroyCommandPool(device, resources.transfer_command_pool, nullptr);
 
     // Destroy any pending objects.
     for (auto& it : resources.cleanup_resources)
@@ -134,6 +177,8 @@ void CommandBufferManager::DestroyCommandBuffers()
 
     if (resources.semaphore != VK_NULL_HANDLE)
       vkDestroySemaphore(device, resources.semaphore, nullptr);
+    if (resources.transfer_semaphore != VK_NULL_HANDLE)
+      vkDestroySemaphore(device, resources.transfer_semaphore, nullptr);
 
     if (resources.fence != VK_NULL_HANDLE)
       vkDestroyFence(device, resources.fence, nullptr);
@@ -326,6 +371,16 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
                     static_cast<int>(res));
     }
   }
+  if (resources.transfer_command_buffer != VK_NULL_HANDLE)
+  {
+    VkResult res = vkEndCommandBuffer(resources.transfer_command_buffer);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkEndCommandBuffer failed: ");
+      PanicAlertFmt("Failed to end transfer command buffer: {} ({})", VkResultToString(res),
+                    static_cast<int>(res));
+    }
+  }
 
   // Submitting off-thread?
   if (m_use_threaded_submission && submit_on_worker_thread && !wait_for_completion)
@@ -397,12 +452,13 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
   CmdBufferResources& resources = m_command_buffers[command_buffer_index];
 
   // This may be executed on the worker thread, so don't modify any state of the manager class.
-  uint32_t wait_bits = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+  std::array<VkSemaphore, 2> wait_semaphores;
+  std::array<VkPipelineStageFlags, 2> wait_bits;
   VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
                               nullptr,
                               0,
-                              nullptr,
-                              &wait_bits,
+                              wait_semaphores.data(),
+                              wait_bits.data(),
                               static_cast<u32>(resources.command_buffers.size()),
                               resources.command_buffers.data(),
                               0,
@@ -417,8 +473,37 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
 
   if (resources.semaphore_used)
   {
-    submit_info.pWaitSemaphores = &resources.semaphore;
-    submit_info.waitSemaphoreCount = 1;
+    wait_semaphores[submit_info.waitSemaphoreCount] = resources.semaphore;
+    wait_bits[submit_info.waitSemaphoreCount] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    submit_info.waitSemaphoreCount++;
+  }
+
+  // Kick off the uploads on the transfer queue first, they can run while the graphics queue is
+  // still busy with earlier command buffers. The ownership transfers of the uploaded textures in
+  // the init command buffer must wait for them.
+  if (resources.transfer_command_buffer_used)
+  {
+    const VkSubmitInfo transfer_submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                                               nullptr,
+                                               0,
+                                               nullptr,
+                                               nullptr,
+                                               1,
+                                               &resources.transfer_command_buffer,
+                                               1,
+                                               &resources.transfer_semaphore};
+    VkResult res = vkQueueSubmit(g_vulkan_context->GetTransferQueue(), 1, &transfer_submit_info,
+                                 VK_NULL_HANDLE);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkQueueSubmit failed: ");
+      PanicAlertFmt("Failed to submit transfer command buffer: {} ({})", VkResultToString(res),
+                    static_cast<int>(res));
+    }
+
+    wait_semaphores[submit_info.waitSemaphoreCount] = resources.transfer_semaphore;
+    wait_bits[submit_info.waitSemaphoreCount] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    submit_info.waitSemaphoreCount++;
   }
 
   if (present_swap_chain != VK_NULL_HANDLE)
@@ -460,14 +545,9 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
         LOG_VULKAN_ERROR(m_last_present_result, "vkQueuePresentKHR failed: ");
       }
 
-      // Don't treat VK_SUBOPTIMAL_KHR as fatal on Android. Android 10+ requires prerotation.
-      // See https://twitter.com/Themaister/status/1207062674011574273
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-      if (m_last_present_result != VK_SUBOPTIMAL_KHR)
-        m_last_present_failed.Set();
-#else
+      // On Android, VK_SUBOPTIMAL_KHR means that the device was rotated since the swap chain was
+      // created with the current transform, so it gets recreated pre-rotated for the new one.
       m_last_present_failed.Set();
-#endif
     }
   }
 }
@@ -491,6 +571,12 @@ void CommandBufferManager::BeginCommandBuffer()
   res = vkResetCommandPool(g_vulkan_context->GetDevice(), resources.command_pool, 0);
   if (res != VK_SUCCESS)
     LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+  if (resources.transfer_command_pool != VK_NULL_HANDLE)
+  {
+    res = vkResetCommandPool(g_vulkan_context->GetDevice(), resources.transfer_command_pool, 0);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+  }
 
   // Enable commands to be recorded to the two buffers again.
   VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr,
@@ -501,9 +587,16 @@ void CommandBufferManager::BeginCommandBuffer()
     if (res != VK_SUCCESS)
       LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
   }
+  if (resources.transfer_command_buffer != VK_NULL_HANDLE)
+  {
+    res = vkBeginCommandBuffer(resources.transfer_command_buffer, &begin_info);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
+  }
 
   // Reset upload command buffer state
   resources.init_command_buffer_used = false;
+  resources.transfer_command_buffer_used = false;
   resources.semaphore_used = false;
   resources.fence_counter = m_next_fence_counter++;
   resources.frame_index = m_current_frame;
@@ -36,6 +36,14 @@ public:
     const CmdBufferResources& cmd_buffer_resources = m_command_buffers[m_current_cmd_buffer];
     return cmd_buffer_resources.command_buffers[1];
   }
+  // Only available if VulkanContext::HasTransferQueue(). This command buffer is submitted to the
+  // transfer queue before the init and draw command buffers, which wait for it to complete.
+  VkCommandBuffer GetCurrentTransferCommandBuffer()
+  {
+    CmdBufferResources& cmd_buffer_resources = GetCurrentCmdBufferResources();
+    cmd_buffer_resources.transfer_command_buffer_used = true;
+    return cmd_buffer_resources.transfer_command_buffer;
+  }
   // Allocates a descriptors set from the pool reserved for the current frame.
   VkDescriptorSet AllocateDescriptorSet(VkDescriptorSetLayout set_layout);
 
@@ -121,6 +129,12 @@ private:
     std::atomic<bool> waiting_for_submit{false};
     u32 frame_index = 0;
 
+    // Uploads on the transfer queue, if there is one. The semaphore is signalled when they're done.
+    VkCommandPool transfer_command_pool = VK_NULL_HANDLE;
+    VkCommandBuffer transfer_command_buffer = VK_NULL_HANDLE;
+    VkSemaphore transfer_semaphore = VK_NULL_HANDLE;
+    bool transfer_command_buffer_used = false;
+
     std::vector<std::function<void()>> cleanup_resources;
   };
 
@@ -137,6 +151,8 @@ private:
     return m_command_buffers[m_current_cmd_buffer];
   }
 
+  bool CreateTransferCommandBuffer(CmdBufferResources* resources);
+
   u64 m_next_fence_counter = 1;
   u64 m_completed_fence_counter = 0;
 
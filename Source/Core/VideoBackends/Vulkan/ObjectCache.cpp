@@ -36,6 +36,7 @@ ObjectCache::~ObjectCache()
   DestroySamplers();
   DestroyPipelineLayouts();
   DestroyDescriptorSetLayouts();
+  DestroyPipelineLibraries();
   DestroyRenderPassCache();
   m_dummy_texture.reset();
 }
@@ -203,6 +204,10 @@ bool ObjectCache::CreateDescriptorSetLayouts()
        static_cast<u32>(compute_set_bindings.size()), compute_set_bindings.data()},
   }};
 
+  // The vertex shader offsets each view itself with multiview.
+  if (g_backend_info.bSupportsMultiview)
+    ubo_bindings[UBO_DESCRIPTOR_SET_BINDING_GS].stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
+
   // Don't set the GS bit if geometry shaders aren't available.
   if (g_ActiveConfig.UseVSForLinePointExpand())
   {
@@ -285,8 +290,9 @@ bool ObjectCache::CreatePipelineLayouts()
        static_cast<u32>(compute_sets.size()), compute_sets.data(), 0, nullptr},
   }};
 
-  const bool ssbos_in_standard =
-      g_backend_info.bSupportsBBox || g_ActiveConfig.UseVSForLinePointExpand();
+  const bool ssbos_in_standard = g_backend_info.bSupportsBBox ||
+                                 g_ActiveConfig.UseVSForLinePointExpand() ||
+                                 g_backend_info.bSupportsGPUVertexPulling;
 
   // If bounding box is unsupported, don't bother with the SSBO descriptor set.
   if (!ssbos_in_standard)
@@ -418,10 +424,10 @@ VkSampler ObjectCache::GetSampler(const SamplerState& info)
 
 VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_format,
                                         u32 multisamples, VkAttachmentLoadOp load_op,
-                                        u8 additional_attachment_count)
+                                        u8 additional_attachment_count, u32 view_mask)
 {
-  auto key =
-      std::tie(color_format, depth_format, multisamples, load_op, additional_attachment_count);
+  auto key = std::tie(color_format, depth_format, multisamples, load_op,
+                      additional_attachment_count, view_mask);
   auto it = m_render_pass_cache.find(key);
   if (it != m_render_pass_cache.end())
     return it->second;
@@ -488,6 +494,14 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
                                       0,
                                       nullptr};
 
+  // The same mask is used for correlation, as all views are rendered from nearly the same
+  // position.
+  VkRenderPassMultiviewCreateInfo multiview_info = {
+      VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO, nullptr, 1, &view_mask, 0, nullptr, 1,
+      &view_mask};
+  if (view_mask != 0)
+    pass_info.pNext = &multiview_info;
+
   VkRenderPass pass;
   VkResult res = vkCreateRenderPass(g_vulkan_context->GetDevice(), &pass_info, nullptr, &pass);
   if (res != VK_SUCCESS)
@@ -507,6 +521,28 @@ void ObjectCache::DestroyRenderPassCache()
   m_render_pass_cache.clear();
 }
 
+VkPipeline ObjectCache::GetFragmentOutputLibrary(const BlendingState& blending_state,
+                                                 const FramebufferState& framebuffer_state) const
+{
+  const auto it = m_fragment_output_libraries.find({blending_state.hex, framebuffer_state.hex});
+  return it != m_fragment_output_libraries.end() ? it->second : VK_NULL_HANDLE;
+}
+
+void ObjectCache::AddFragmentOutputLibrary(const BlendingState& blending_state,
+                                           const FramebufferState& framebuffer_state,
+                                           VkPipeline library)
+{
+  m_fragment_output_libraries.emplace(std::make_pair(blending_state.hex, framebuffer_state.hex),
+                                      library);
+}
+
+void ObjectCache::DestroyPipelineLibraries()
+{
+  for (auto& it : m_fragment_output_libraries)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+  m_fragment_output_libraries.clear();
+}
+
 class PipelineCacheReadCallback : public Common::LinearDiskCacheReader<u32, u8>
 {
 public:
@@ -561,7 +597,7 @@ bool ObjectCache::LoadPipelineCache()
   std::vector<u8> disk_data;
   Common::LinearDiskCache<u32, u8> disk_cache;
   PipelineCacheReadCallback read_callback(&disk_data);
-  if (disk_cache.OpenAndRead(m_pipeline_cache_filename, read_callback) != 1)
+  if (disk_cache.OpenAndRead(m_pipeline_cache_filename, read_callback, true) != 1)
     disk_data.clear();
 
   if (!disk_data.empty() && !ValidatePipelineCache(disk_data.data(), disk_data.size()))
@@ -687,7 +723,7 @@ void ObjectCache::SavePipelineCache()
   // of data without specifying a key.
   Common::LinearDiskCache<u32, u8> disk_cache;
   PipelineCacheReadIgnoreCallback callback;
-  disk_cache.OpenAndRead(m_pipeline_cache_filename, callback);
+  disk_cache.OpenAndRead(m_pipeline_cache_filename, callback, true);
   disk_cache.Append(1, data.data(), static_cast<u32>(data.size()));
   disk_cache.Close();
 }
@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <unordered_map>
 
 #include "Common/CommonTypes.h"
@@ -58,9 +59,17 @@ public:
   VkSampler GetLinearSampler() const { return m_linear_sampler; }
   VkSampler GetSampler(const SamplerState& info);
 
-  // Render pass cache.
+  // Render pass cache. A non-zero view mask creates a multiview render pass, which renders to
+  // each layer in the mask at once.
   VkRenderPass GetRenderPass(VkFormat color_format, VkFormat depth_format, u32 multisamples,
-                             VkAttachmentLoadOp load_op, u8 additional_attachment_count = 0);
+                             VkAttachmentLoadOp load_op, u8 additional_attachment_count = 0,
+                             u32 view_mask = 0);
+
+  // Fragment output pipeline library parts, see VKPipeline::CreateFastLinked.
+  VkPipeline GetFragmentOutputLibrary(const BlendingState& blending_state,
+                                      const FramebufferState& framebuffer_state) const;
+  void AddFragmentOutputLibrary(const BlendingState& blending_state,
+                                const FramebufferState& framebuffer_state, VkPipeline library);
 
   // Pipeline cache. Used when creating pipelines for drivers to store compiled programs.
   VkPipelineCache GetPipelineCache() const { return m_pipeline_cache; }
@@ -83,6 +92,7 @@ private:
   bool CreateStaticSamplers();
   void DestroySamplers();
   void DestroyRenderPassCache();
+  void DestroyPipelineLibraries();
   bool CreatePipelineCache();
   bool LoadPipelineCache();
   bool ValidatePipelineCache(const u8* data, size_t data_length);
@@ -102,9 +112,13 @@ private:
   std::unique_ptr<VKTexture> m_dummy_texture;
 
   // Render pass cache
-  using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, std::size_t>;
+  using RenderPassCacheKey =
+      std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, std::size_t, u32>;
   std::map<RenderPassCacheKey, VkRenderPass> m_render_pass_cache;
 
+  // Fragment output pipeline libraries, by blending and framebuffer state
+  std::map<std::pair<u32, u32>, VkPipeline> m_fragment_output_libraries;
+
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
   std::string m_pipeline_cache_filename;
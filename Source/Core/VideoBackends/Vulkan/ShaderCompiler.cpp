@@ -99,6 +99,8 @@ static std::string GetShaderCode(std::string_view source, std::string_view heade
     full_source_code.append(header);
     if (g_vulkan_context->SupportsShaderSubgroupOperations())
       full_source_code.append(SUBGROUP_HELPER_HEADER, subgroup_helper_header_length);
+    if (g_backend_info.bSupportsMultiview)
+      full_source_code.append("#extension GL_EXT_multiview : enable\n");
     if (DriverDetails::HasBug(DriverDetails::BUG_INVERTED_IS_HELPER))
     {
       full_source_code.append("#define gl_HelperInvocation !gl_HelperInvocation "
@@ -136,6 +136,8 @@ bool StagingBuffer::AllocateBuffer(STAGING_BUFFER_TYPE type, VkDeviceSize size,
       0,                                     // uint32_t               queueFamilyIndexCount
       nullptr                                // const uint32_t*        pQueueFamilyIndices
   };
+  if (type == STAGING_BUFFER_TYPE_UPLOAD)
+    g_vulkan_context->SetTransferSourceSharingMode(&buffer_create_info);
 
   VmaAllocationCreateInfo alloc_create_info = {};
   alloc_create_info.flags =
@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Vulkan/StateTracker.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
@@ -112,7 +114,7 @@ void StateTracker::SetVertexBuffer(VkBuffer buffer, VkDeviceSize offset, u32 siz
     m_bindings.gx_uber_vertex_ssbo.buffer = buffer;
     m_bindings.gx_uber_vertex_ssbo.offset = offset;
     m_bindings.gx_uber_vertex_ssbo.range = size;
-    m_dirty_flags |= DIRTY_FLAG_GX_SSBO;
+    m_dirty_flags |= DIRTY_FLAG_GX_VERTEX_SSBO;
   }
 }
 
@@ -131,6 +133,8 @@ void StateTracker::SetFramebuffer(VKFramebuffer* framebuffer)
 {
   // Should not be changed within a render pass.
   ASSERT(!InRenderPass());
+  if (m_framebuffer != framebuffer)
+    m_discard_framebuffer_contents = false;
   m_framebuffer = framebuffer;
 }
 
@@ -257,6 +261,21 @@ void StateTracker::UnbindTexture(VkImageView view)
     }
   }
 
+  // The handle of the destroyed view can be reused by a new one, so sets which reference it can't
+  // be looked up anymore.
+  for (u32 i = 0; i < m_num_cached_sampler_sets;)
+  {
+    const auto& samplers = m_cached_sampler_sets[i].samplers;
+    if (std::ranges::none_of(samplers, [view](const auto& info) { return info.imageView == view; }))
+    {
+      i++;
+      continue;
+    }
+
+    m_cached_sampler_sets[i] = m_cached_sampler_sets[--m_num_cached_sampler_sets];
+    m_next_cached_sampler_set = m_num_cached_sampler_sets;
+  }
+
   for (VkDescriptorImageInfo& it : m_bindings.image_textures)
   {
     if (it.imageView == view)
@@ -269,6 +288,9 @@ void StateTracker::UnbindTexture(VkImageView view)
 
 void StateTracker::InvalidateCachedState()
 {
+  // Descriptor sets are allocated from the command buffer's pool, so they can't be reused after
+  // switching to the next command buffer.
+  ClearCachedSamplerSets();
   m_gx_descriptor_sets.fill(VK_NULL_HANDLE);
   m_utility_descriptor_sets.fill(VK_NULL_HANDLE);
   m_compute_descriptor_set = VK_NULL_HANDLE;
@@ -281,38 +303,83 @@ void StateTracker::InvalidateCachedState()
     m_dirty_flags |= DIRTY_FLAG_INDEX_BUFFER;
 }
 
-void StateTracker::BeginRenderPass()
+void StateTracker::ClearCachedSamplerSets()
 {
-  if (InRenderPass())
-    return;
+  m_num_cached_sampler_sets = 0;
+  m_next_cached_sampler_set = 0;
+}
 
-  m_current_render_pass = m_framebuffer->GetLoadRenderPass();
-  m_framebuffer_render_area = m_framebuffer->GetRect();
+VkDescriptorSet StateTracker::FindCachedSamplerSet() const
+{
+  // VkDescriptorImageInfo can contain padding, so compare the fields rather than the memory.
+  const auto matches = [](const VkDescriptorImageInfo& a, const VkDescriptorImageInfo& b) {
+    return a.sampler == b.sampler && a.imageView == b.imageView && a.imageLayout == b.imageLayout;
+  };
 
-  VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-                                      nullptr,
-                                      m_current_render_pass,
-                                      m_framebuffer->GetFB(),
-                                      m_framebuffer_render_area,
-                                      0,
-                                      nullptr};
+  for (u32 i = 0; i < m_num_cached_sampler_sets; i++)
+  {
+    const CachedSamplerSet& cached = m_cached_sampler_sets[i];
+    if (std::ranges::equal(cached.samplers, m_bindings.samplers, matches))
+      return cached.set;
+  }
 
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+  return VK_NULL_HANDLE;
 }
 
-void StateTracker::BeginDiscardRenderPass()
+void StateTracker::AddCachedSamplerSet(VkDescriptorSet set)
+{
+  u32 index;
+  if (m_num_cached_sampler_sets < MAX_CACHED_SAMPLER_SETS)
+  {
+    index = m_num_cached_sampler_sets++;
+  }
+  else
+  {
+    index = m_next_cached_sampler_set;
+    m_next_cached_sampler_set = (m_next_cached_sampler_set + 1) % MAX_CACHED_SAMPLER_SETS;
+  }
+
+  m_cached_sampler_sets[index] = {m_bindings.samplers, set};
+}
+
+bool StateTracker::InMultiviewRenderPass() const
+{
+  return InRenderPass() &&
+         (m_current_render_pass == m_framebuffer->GetMultiviewLoadRenderPass() ||
+          m_current_render_pass == m_framebuffer->GetMultiviewDiscardRenderPass());
+}
+
+bool StateTracker::UseMultiviewRenderPass() const
+{
+  return m_pipeline && m_pipeline->IsMultiview() && m_framebuffer->HasMultiview();
+}
+
+void StateTracker::BeginRenderPass()
 {
   if (InRenderPass())
     return;
 
-  m_current_render_pass = m_framebuffer->GetDiscardRenderPass();
+  // Only the first pass after a discard may drop the contents, later ones must load what it drew.
+  const bool multiview = UseMultiviewRenderPass();
+  if (multiview)
+  {
+    m_current_render_pass = m_discard_framebuffer_contents ?
+                                m_framebuffer->GetMultiviewDiscardRenderPass() :
+                                m_framebuffer->GetMultiviewLoadRenderPass();
+  }
+  else
+  {
+    m_current_render_pass = m_discard_framebuffer_contents ? m_framebuffer->GetDiscardRenderPass() :
+                                                             m_framebuffer->GetLoadRenderPass();
+  }
+  m_discard_framebuffer_contents = false;
   m_framebuffer_render_area = m_framebuffer->GetRect();
 
   VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
                                       nullptr,
                                       m_current_render_pass,
-                                      m_framebuffer->GetFB(),
+                                      multiview ? m_framebuffer->GetMultiviewFB() :
+                                                  m_framebuffer->GetFB(),
                                       m_framebuffer_render_area,
                                       0,
                                       nullptr};
@@ -330,11 +397,19 @@ void StateTracker::EndRenderPass()
   m_current_render_pass = VK_NULL_HANDLE;
 }
 
+void StateTracker::DiscardFramebufferContents()
+{
+  EndRenderPass();
+  m_discard_framebuffer_contents = true;
+}
+
 void StateTracker::BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
                                         u32 num_clear_values)
 {
   ASSERT(!InRenderPass());
 
+  // The clear render pass doesn't load anything either.
+  m_discard_framebuffer_contents = false;
   m_current_render_pass = m_framebuffer->GetClearRenderPass();
   m_framebuffer_render_area = area;
 
@@ -378,6 +453,11 @@ bool StateTracker::Bind()
   if (m_current_render_pass == m_framebuffer->GetClearRenderPass() && !IsViewportWithinRenderArea())
     EndRenderPass();
 
+  // Stereoscopic game draws use a multiview render pass, utility draws duplicate their geometry
+  // to each layer in a regular one.
+  if (InRenderPass() && InMultiviewRenderPass() != UseMultiviewRenderPass())
+    EndRenderPass();
+
   // Get a new descriptor set if any parts have changed
   UpdateDescriptorSet();
 
@@ -519,30 +599,43 @@ void StateTracker::UpdateGXDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
   {
-    m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
-        g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
-
-    writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                            nullptr,
-                            m_gx_descriptor_sets[1],
-                            0,
-                            0,
-                            static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS),
-                            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                            m_bindings.samplers.data(),
-                            nullptr,
-                            nullptr};
+    m_gx_descriptor_sets[1] = FindCachedSamplerSet();
+    if (m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
+    {
+      m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
+          g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
+
+      writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                              nullptr,
+                              m_gx_descriptor_sets[1],
+                              0,
+                              0,
+                              static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS),
+                              VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                              m_bindings.samplers.data(),
+                              nullptr,
+                              nullptr};
+      if (m_gx_descriptor_sets[1] != VK_NULL_HANDLE)
+        AddCachedSamplerSet(m_gx_descriptor_sets[1]);
+    }
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_SAMPLERS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
   const bool needs_bbox_ssbo = g_backend_info.bSupportsBBox;
   const bool needs_vertex_ssbo = (g_backend_info.bSupportsDynamicVertexLoader &&
                                   m_pipeline->GetUsage() == AbstractPipelineUsage::GXUber) ||
+                                 (g_ActiveConfig.UseGPUVertexPulling() &&
+                                  m_pipeline->GetUsage() == AbstractPipelineUsage::GX) ||
                                  g_ActiveConfig.UseVSForLinePointExpand();
   const bool needs_ssbo = needs_bbox_ssbo || needs_vertex_ssbo;
 
+  // The vertex buffer offset changes with nearly every draw. Pipelines which don't read vertices
+  // from the SSBO can keep using a set with a stale vertex binding, rather than getting a new set
+  // allocated and written for each draw just for the bounding box buffer.
+  const u32 ssbo_dirty_flags =
+      DIRTY_FLAG_GX_SSBO | (needs_vertex_ssbo ? DIRTY_FLAG_GX_VERTEX_SSBO : 0);
   if (needs_ssbo &&
-      (m_dirty_flags & DIRTY_FLAG_GX_SSBO || m_gx_descriptor_sets[2] == VK_NULL_HANDLE))
+      (m_dirty_flags & ssbo_dirty_flags || m_gx_descriptor_sets[2] == VK_NULL_HANDLE))
   {
     m_gx_descriptor_sets[2] =
         g_command_buffer_mgr->AllocateDescriptorSet(g_object_cache->GetDescriptorSetLayout(
@@ -566,7 +659,8 @@ void StateTracker::UpdateGXDescriptorSet()
                               nullptr};
     }
 
-    m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_SSBO) | DIRTY_FLAG_DESCRIPTOR_SETS;
+    m_dirty_flags = (m_dirty_flags & ~(DIRTY_FLAG_GX_SSBO | DIRTY_FLAG_GX_VERTEX_SSBO)) |
+                    DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
   if (num_writes > 0)
@@ -50,14 +50,23 @@ public:
   // Set dirty flags on everything to force re-bind at next draw time.
   void InvalidateCachedState();
 
+  // Forgets the sampler descriptor sets written for this command buffer, e.g. when the samplers
+  // they reference are about to be destroyed.
+  void ClearCachedSamplerSets();
+
   // Ends a render pass if we're currently in one.
   // When Bind() is next called, the pass will be restarted.
   // Calling this function is allowed even if a pass has not begun.
   bool InRenderPass() const { return m_current_render_pass != VK_NULL_HANDLE; }
+  bool InMultiviewRenderPass() const;
   void BeginRenderPass();
-  void BeginDiscardRenderPass();
   void EndRenderPass();
 
+  // Ends the current render pass, and makes the next one discard the framebuffer's contents instead
+  // of loading them. The pass is only begun once something is drawn, so a clear in between can
+  // still use a clear render pass, and nothing is loaded if the command buffer is flushed first.
+  void DiscardFramebufferContents();
+
   // Ends the current render pass if it was a clear render pass.
   void BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
                             u32 num_clear_values);
@@ -104,14 +113,20 @@ private:
     DIRTY_FLAG_COMPUTE_SHADER = (1 << 13),
     DIRTY_FLAG_DESCRIPTOR_SETS = (1 << 14),
     DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET = (1 << 15),
+    // The vertex buffer binding of the SSBO set, which only some pipelines read
+    DIRTY_FLAG_GX_VERTEX_SSBO = (1 << 16),
 
     DIRTY_FLAG_ALL_DESCRIPTORS = DIRTY_FLAG_GX_UBOS | DIRTY_FLAG_UTILITY_UBO |
                                  DIRTY_FLAG_GX_SAMPLERS | DIRTY_FLAG_GX_SSBO |
-                                 DIRTY_FLAG_UTILITY_BINDINGS | DIRTY_FLAG_COMPUTE_BINDINGS
+                                 DIRTY_FLAG_GX_VERTEX_SSBO | DIRTY_FLAG_UTILITY_BINDINGS |
+                                 DIRTY_FLAG_COMPUTE_BINDINGS
   };
 
   bool Initialize();
 
+  // Whether the current pipeline has to be drawn in a multiview render pass.
+  bool UseMultiviewRenderPass() const;
+
   // Check that the specified viewport is within the render area.
   // If not, ends the render pass if it is a clear render pass.
   bool IsViewportWithinRenderArea() const;
@@ -121,6 +136,9 @@ private:
   void UpdateUtilityDescriptorSet();
   void UpdateComputeDescriptorSet();
 
+  VkDescriptorSet FindCachedSamplerSet() const;
+  void AddCachedSamplerSet(VkDescriptorSet set);
+
   // Which bindings/state has to be updated before the next draw.
   u32 m_dirty_flags = 0;
 
@@ -152,6 +170,19 @@ private:
   std::array<VkDescriptorSet, NUM_UTILITY_DESCRIPTOR_SETS> m_utility_descriptor_sets = {};
   VkDescriptorSet m_compute_descriptor_set = VK_NULL_HANDLE;
 
+  // Sampler descriptor sets which were already written in the current command buffer. Games tend
+  // to switch between a small number of texture combinations, so this avoids allocating and
+  // writing a new set for most texture changes.
+  static constexpr u32 MAX_CACHED_SAMPLER_SETS = 32;
+  struct CachedSamplerSet
+  {
+    std::array<VkDescriptorImageInfo, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> samplers;
+    VkDescriptorSet set;
+  };
+  std::array<CachedSamplerSet, MAX_CACHED_SAMPLER_SETS> m_cached_sampler_sets = {};
+  u32 m_num_cached_sampler_sets = 0;
+  u32 m_next_cached_sampler_set = 0;
+
   // rasterization
   VkViewport m_viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
   VkRect2D m_scissor = {{0, 0}, {1, 1}};
@@ -163,5 +194,6 @@ private:
   VKFramebuffer* m_framebuffer = nullptr;
   VkRenderPass m_current_render_pass = VK_NULL_HANDLE;
   VkRect2D m_framebuffer_render_area = {};
+  bool m_discard_framebuffer_contents = false;
 };
 }  // namespace Vulkan
@@ -37,7 +37,7 @@ bool VKBoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+void VKBoundingBox::CopyToReadbackBuffer(VkDeviceSize offset)
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -52,7 +52,7 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
                                         VK_PIPELINE_STAGE_TRANSFER_BIT);
 
   // Copy from GPU -> readback buffer.
-  VkBufferCopy region = {0, 0, BUFFER_SIZE};
+  VkBufferCopy region = {0, offset, BUFFER_SIZE};
   vkCmdCopyBuffer(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
                   m_readback_buffer->GetBuffer(), 1, &region);
 
@@ -63,12 +63,17 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
   m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
+
+std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+{
+  CopyToReadbackBuffer(0);
 
   // Wait until these commands complete.
   VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
 
   // Cache is now valid.
-  m_readback_buffer->InvalidateCPUCache();
+  m_readback_buffer->InvalidateCPUCache(0, BUFFER_SIZE);
 
   // Read out the values and return
   std::vector<BBoxType> values(length);
@@ -77,6 +82,33 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool VKBoundingBox::QueueRead(u32 slot)
+{
+  CopyToReadbackBuffer((slot + 1) * BUFFER_SIZE);
+  m_queued_fence_counters[slot] = g_command_buffer_mgr->GetCurrentFenceCounter();
+
+  // Submit the copy so that it completes as soon as possible, but don't wait for it.
+  VKGfx::GetInstance()->ExecuteCommandBuffer(true, false);
+  return true;
+}
+
+std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> VKBoundingBox::ReadQueued(u32 slot,
+                                                                               bool wait)
+{
+  const u64 fence_counter = m_queued_fence_counters[slot];
+  if (g_command_buffer_mgr->GetCompletedFenceCounter() < fence_counter)
+  {
+    if (!wait)
+      return std::nullopt;
+
+    g_command_buffer_mgr->WaitForFenceCounter(fence_counter);
+  }
+
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  m_readback_buffer->Read((slot + 1) * BUFFER_SIZE, values.data(), BUFFER_SIZE, true);
+  return values;
+}
+
 void VKBoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   // We can't issue vkCmdUpdateBuffer within a render pass.
@@ -142,7 +174,7 @@ bool VKBoundingBox::CreateGPUBuffer()
 
 bool VKBoundingBox::CreateReadbackBuffer()
 {
-  m_readback_buffer = StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK, BUFFER_SIZE,
+  m_readback_buffer = StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK, READBACK_BUFFER_SIZE,
                                             VK_BUFFER_USAGE_TRANSFER_DST_BIT);
 
   if (!m_readback_buffer || !m_readback_buffer->Map())
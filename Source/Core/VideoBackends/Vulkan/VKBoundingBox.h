@@ -28,16 +28,25 @@ protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
 
+  bool QueueRead(u32 slot) override;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> ReadQueued(u32 slot, bool wait) override;
+
 private:
   bool CreateGPUBuffer();
   bool CreateReadbackBuffer();
+  void CopyToReadbackBuffer(VkDeviceSize offset);
 
   VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
   VmaAllocation m_gpu_allocation = VK_NULL_HANDLE;
 
   static constexpr size_t BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
 
+  // The first BUFFER_SIZE bytes are used for synchronous reads, followed by one slot per queued
+  // readback.
+  static constexpr size_t READBACK_BUFFER_SIZE = BUFFER_SIZE * (1 + MAX_QUEUED_READBACKS);
+
   std::unique_ptr<StagingBuffer> m_readback_buffer;
+  std::array<u64, MAX_QUEUED_READBACKS> m_queued_fence_counters = {};
 };
 
 }  // namespace Vulkan
@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Vulkan/VKGfx.h"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdio>
 
@@ -19,6 +21,7 @@
 #include "VideoBackends/Vulkan/VKSwapChain.h"
 #include "VideoBackends/Vulkan/VKTexture.h"
 #include "VideoBackends/Vulkan/VKVertexFormat.h"
+#include "VideoBackends/Vulkan/VulkanContext.h"
 
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
@@ -35,12 +38,19 @@ VKGfx::VKGfx(std::unique_ptr<SwapChain> swap_chain, float backbuffer_scale)
   for (SamplerState& sampler_state : m_sampler_states)
     sampler_state = RenderState::GetPointSamplerState();
 
+  if (g_backend_info.bSupportsTimestampQueries && !CreateTimestampQueryPool())
+    g_backend_info.bSupportsTimestampQueries = false;
+
   // Various initialization routines will have executed commands on the command buffer.
   // Execute what we have done before beginning the first frame.
   ExecuteCommandBuffer(true, false);
 }
 
-VKGfx::~VKGfx() = default;
+VKGfx::~VKGfx()
+{
+  if (m_timestamp_query_pool != VK_NULL_HANDLE)
+    vkDestroyQueryPool(g_vulkan_context->GetDevice(), m_timestamp_query_pool, nullptr);
+}
 
 bool VKGfx::IsHeadless() const
 {
@@ -84,6 +94,12 @@ std::unique_ptr<AbstractPipeline> VKGfx::CreatePipeline(const AbstractPipelineCo
   return VKPipeline::Create(config);
 }
 
+std::unique_ptr<AbstractPipeline>
+VKGfx::CreateFastLinkedPipeline(const AbstractPipelineConfig& config)
+{
+  return VKPipeline::CreateFastLinked(config);
+}
+
 std::unique_ptr<AbstractFramebuffer>
 VKGfx::CreateFramebuffer(AbstractTexture* color_attachment, AbstractTexture* depth_attachment,
                          std::vector<AbstractTexture*> additional_color_attachments)
@@ -193,6 +209,10 @@ void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_en
       }
       StateTracker::GetInstance()->BeginRenderPass();
 
+      // Multiview render passes clear every view, but only one layer may be given.
+      if (StateTracker::GetInstance()->InMultiviewRenderPass())
+        vk_rect.layerCount = 1;
+
       vkCmdClearAttachments(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                             static_cast<uint32_t>(clear_attachments.size()),
                             clear_attachments.data(), 1, &vk_rect);
@@ -268,6 +288,9 @@ bool VKGfx::BindBackbuffer(const ClearColor& clear_color)
     {
       INFO_LOG_FMT(VIDEO, "Resizing swap chain due to suboptimal/out-of-date");
       m_swap_chain->ResizeSwapChain();
+
+      // The size the window is seen at changes when a pre-rotated swap chain is rotated.
+      OnSwapChainResized();
     }
     else
     {
@@ -310,6 +333,7 @@ void VKGfx::PresentBackbuffer()
   // End drawing to backbuffer
   StateTracker::GetInstance()->EndRenderPass();
 
+  const u64 present_fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
   if (m_swap_chain->IsCurrentImageValid())
   {
     // Transition the backbuffer to PRESENT_SRC to ensure all commands drawing
@@ -329,6 +353,24 @@ void VKGfx::PresentBackbuffer()
     g_command_buffer_mgr->SubmitCommandBuffer(true, false, true);
   }
 
+  // Bound the number of frames in flight, so that we don't get ahead of the display. There is no
+  // way to wait for the presentation engine itself without VK_KHR_present_wait, but with FIFO, the
+  // image acquire throttles us to the display once the GPU is kept from queueing up frames.
+  const size_t max_frame_latency = static_cast<size_t>(g_ActiveConfig.iPresentFrameLatency);
+  if (max_frame_latency > 0)
+  {
+    m_present_fence_counters.push_back(present_fence_counter);
+    while (m_present_fence_counters.size() > max_frame_latency)
+    {
+      g_command_buffer_mgr->WaitForFenceCounter(m_present_fence_counters.front());
+      m_present_fence_counters.pop_front();
+    }
+  }
+  else
+  {
+    m_present_fence_counters.clear();
+  }
+
   // New cmdbuffer, so invalidate state.
   StateTracker::GetInstance()->InvalidateCachedState();
 }
@@ -455,15 +497,13 @@ void VKGfx::SetFramebuffer(AbstractFramebuffer* framebuffer)
 
 void VKGfx::SetAndDiscardFramebuffer(AbstractFramebuffer* framebuffer)
 {
-  if (m_current_framebuffer == framebuffer)
-    return;
-
+  // The contents are discarded even if the framebuffer is already bound, e.g. when the same EFB
+  // peek tile or copy destination is rendered to repeatedly, so tilers don't load them from memory.
   VKFramebuffer* vkfb = static_cast<VKFramebuffer*>(framebuffer);
-  BindFramebuffer(vkfb);
+  if (m_current_framebuffer != framebuffer)
+    BindFramebuffer(vkfb);
 
-  // If we're discarding, begin the discard pass, then switch to a load pass.
-  // This way if the command buffer is flushed, we don't start another discard pass.
-  StateTracker::GetInstance()->BeginDiscardRenderPass();
+  StateTracker::GetInstance()->DiscardFramebufferContents();
 }
 
 void VKGfx::SetAndClearFramebuffer(AbstractFramebuffer* framebuffer, const ClearColor& color_value,
@@ -559,11 +599,49 @@ void VKGfx::ResetSamplerStates()
   }
 
   // Invalidate all sampler objects (some will be unused now).
+  StateTracker::GetInstance()->ClearCachedSamplerSets();
   g_object_cache->ClearSamplerCache();
 }
 
-void VKGfx::SetScissorRect(const MathUtil::Rectangle<int>& rc)
+// Maps a rectangle of a pre-rotated backbuffer, given the way the window is seen, to where it is in
+// the swap chain image. This matches the rotation which the vertex shaders apply in clip space.
+template <typename T>
+static MathUtil::Rectangle<T> RotateBackbufferRectangle(const MathUtil::Rectangle<T>& rc,
+                                                        u32 rotation, T width, T height)
 {
+  switch (rotation)
+  {
+  case 1:
+    return {height - rc.bottom, rc.left, height - rc.top, rc.right};
+  case 2:
+    return {width - rc.right, height - rc.bottom, width - rc.left, height - rc.top};
+  case 3:
+    return {rc.top, width - rc.right, rc.bottom, width - rc.left};
+  default:
+    return rc;
+  }
+}
+
+u32 VKGfx::GetCurrentFramebufferRotation() const
+{
+  if (!m_swap_chain || !m_swap_chain->IsCurrentImageValid() ||
+      m_current_framebuffer != m_swap_chain->GetCurrentFramebuffer())
+  {
+    return 0;
+  }
+
+  return m_swap_chain->GetRotation();
+}
+
+void VKGfx::SetScissorRect(const MathUtil::Rectangle<int>& scissor_rc)
+{
+  MathUtil::Rectangle<int> rc = scissor_rc;
+  if (const u32 rotation = GetCurrentFramebufferRotation(); rotation != 0)
+  {
+    rc = RotateBackbufferRectangle(rc, rotation, static_cast<int>(m_swap_chain->GetWidth()),
+                                   static_cast<int>(m_swap_chain->GetHeight()));
+  }
+
   VkRect2D scissor = {{rc.left, rc.top},
                       {static_cast<u32>(rc.GetWidth()), static_cast<u32>(rc.GetHeight())}};
 
@@ -585,6 +663,18 @@ void VKGfx::SetScissorRect(const MathUtil::Rectangle<int>& rc)
 void VKGfx::SetViewport(float x, float y, float width, float height, float near_depth,
                         float far_depth)
 {
+  if (const u32 rotation = GetCurrentFramebufferRotation(); rotation != 0)
+  {
+    const MathUtil::Rectangle<float> rc = RotateBackbufferRectangle(
+        MathUtil::Rectangle<float>(x, y, x + width, y + height), rotation,
+        static_cast<float>(m_swap_chain->GetWidth()),
+        static_cast<float>(m_swap_chain->GetHeight()));
+    x = rc.left;
+    y = rc.top;
+    width = rc.GetWidth();
+    height = rc.GetHeight();
+  }
+
   VkViewport viewport = {x, y, width, height, near_depth, far_depth};
   StateTracker::GetInstance()->SetViewport(viewport);
 }
@@ -621,4 +711,98 @@ SurfaceInfo VKGfx::GetSurfaceInfo() const
           m_swap_chain ? m_swap_chain->GetTextureFormat() : AbstractTextureFormat::Undefined};
 }
 
+std::optional<VideoMemoryInfo> VKGfx::GetVideoMemoryInfo() const
+{
+  // Without VK_EXT_memory_budget, VMA only knows about its own allocations, and guesses the budget.
+  if (!g_vulkan_context->SupportsDeviceExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+    return std::nullopt;
+
+  const VmaAllocator allocator = g_vulkan_context->GetMemoryAllocator();
+  const VkPhysicalDeviceMemoryProperties* memory_properties;
+  vmaGetMemoryProperties(allocator, &memory_properties);
+  std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets;
+  vmaGetHeapBudgets(allocator, budgets.data());
+
+  VideoMemoryInfo info;
+  for (u32 i = 0; i < memory_properties->memoryHeapCount; i++)
+  {
+    if (memory_properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+    {
+      info.budget += budgets[i].budget;
+      info.usage += budgets[i].usage;
+    }
+  }
+  return info;
+}
+
+bool VKGfx::CreateTimestampQueryPool()
+{
+  VkQueryPoolCreateInfo info = {
+      VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,  // VkStructureType                  sType
+      nullptr,                                   // const void*                      pNext
+      0,                                         // VkQueryPoolCreateFlags           flags
+      VK_QUERY_TYPE_TIMESTAMP,                   // VkQueryType                      queryType
+      TIMESTAMP_QUERY_COUNT,                     // uint32_t                         queryCount
+      0  // VkQueryPipelineStatisticFlags    pipelineStatistics;
+  };
+
+  VkResult res =
+      vkCreateQueryPool(g_vulkan_context->GetDevice(), &info, nullptr, &m_timestamp_query_pool);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateQueryPool failed: ");
+    return false;
+  }
+
+  return true;
+}
+
+void VKGfx::ResetTimestamps(u32 index, u32 count)
+{
+  // Queries can't be reset inside a render pass.
+  StateTracker::GetInstance()->EndRenderPass();
+  vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_timestamp_query_pool,
+                      index, count);
+}
+
+void VKGfx::WriteTimestamp(u32 index)
+{
+  vkCmdWriteTimestamp(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_timestamp_query_pool, index);
+}
+
+void VKGfx::ResolveTimestamps(u32 index, u32 count)
+{
+  const u64 fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+  std::fill_n(m_timestamp_fence_counters.begin() + index, count, fence_counter);
+}
+
+bool VKGfx::ReadTimestamps(u32 index, u32 count, u64* nanoseconds)
+{
+  const u64 completed_fence_counter = g_command_buffer_mgr->GetCompletedFenceCounter();
+  if (std::any_of(m_timestamp_fence_counters.begin() + index,
+                  m_timestamp_fence_counters.begin() + index + count,
+                  [&](u64 fence_counter) { return fence_counter > completed_fence_counter; }))
+  {
+    return false;
+  }
+
+  // Without VK_QUERY_RESULT_WAIT_BIT, this returns VK_NOT_READY if any of the timestamps are not
+  // available yet.
+  VkResult res = vkGetQueryPoolResults(g_vulkan_context->GetDevice(), m_timestamp_query_pool,
+                                       index, count, count * sizeof(u64), nanoseconds,
+                                       sizeof(u64), VK_QUERY_RESULT_64_BIT);
+  if (res != VK_SUCCESS)
+  {
+    if (res != VK_NOT_READY)
+      LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+    return false;
+  }
+
+  const double period = g_vulkan_context->GetDeviceInfo().timestampPeriod;
+  for (u32 i = 0; i < count; i++)
+    nanoseconds[i] = static_cast<u64>(nanoseconds[i] * period);
+  return true;
+}
+
 }  // namespace Vulkan
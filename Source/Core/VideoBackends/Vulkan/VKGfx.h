@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <memory>
 #include <string_view>
 
@@ -48,6 +49,8 @@ public:
   std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractPipelineConfig& config,
                                                    const void* cache_data = nullptr,
                                                    size_t cache_data_length = 0) override;
+  std::unique_ptr<AbstractPipeline>
+  CreateFastLinkedPipeline(const AbstractPipelineConfig& config) override;
 
   SwapChain* GetSwapChain() const { return m_swap_chain.get(); }
 
@@ -63,6 +66,7 @@ public:
   void SetAndDiscardFramebuffer(AbstractFramebuffer* framebuffer) override;
   void SetAndClearFramebuffer(AbstractFramebuffer* framebuffer, const ClearColor& color_value = {},
                               float depth_value = 0.0f) override;
+  u32 GetCurrentFramebufferRotation() const override;
   void SetScissorRect(const MathUtil::Rectangle<int>& rc) override;
   void SetTexture(u32 index, const AbstractTexture* texture) override;
   void SetSamplerState(u32 index, const SamplerState& state) override;
@@ -80,6 +84,12 @@ public:
   bool IsFullscreen() const override;
 
   SurfaceInfo GetSurfaceInfo() const override;
+  std::optional<VideoMemoryInfo> GetVideoMemoryInfo() const override;
+
+  void ResetTimestamps(u32 index, u32 count) override;
+  void WriteTimestamp(u32 index) override;
+  void ResolveTimestamps(u32 index, u32 count) override;
+  bool ReadTimestamps(u32 index, u32 count, u64* nanoseconds) override;
 
   // Completes the current render pass, executes the command buffer, and restores state ready for
   // next render. Use when you want to kick the current buffer to make room for new data.
@@ -94,9 +104,19 @@ private:
   void OnSwapChainResized();
   void BindFramebuffer(VKFramebuffer* fb);
 
+  bool CreateTimestampQueryPool();
+
   std::unique_ptr<SwapChain> m_swap_chain;
   float m_backbuffer_scale;
 
+  // Fence counters of the command buffers which presented the most recent frames
+  std::deque<u64> m_present_fence_counters;
+
+  VkQueryPool m_timestamp_query_pool = VK_NULL_HANDLE;
+  // Fence counter of the command buffer which wrote each timestamp. Until it completes, the query
+  // may still hold an available result from before it was reset.
+  std::array<u64, TIMESTAMP_QUERY_COUNT> m_timestamp_fence_counters = {};
+
   // Keep a copy of sampler states to avoid cache lookups every draw
   std::array<SamplerState, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> m_sampler_states = {};
 };
@@ -168,7 +168,7 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   // Now we can create the Vulkan device. VulkanContext takes ownership of the instance and surface.
   g_vulkan_context =
       VulkanContext::Create(instance, gpu_list[selected_adapter_index], surface, enable_debug_utils,
-                            enable_validation_layer, vk_api_version);
+                            enable_validation_layer, g_Config.bTransferQueue, vk_api_version);
   if (!g_vulkan_context)
   {
     PanicAlertFmt("Failed to create Vulkan device");
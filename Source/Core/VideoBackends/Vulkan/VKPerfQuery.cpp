@@ -134,6 +134,12 @@ void PerfQuery::FlushResults()
   ASSERT(IsFlushed());
 }
 
+void PerfQuery::PollResults()
+{
+  if (!IsFlushed())
+    PartialFlush(false);
+}
+
 bool PerfQuery::IsFlushed() const
 {
   return m_query_count.load(std::memory_order_relaxed) == 0;
@@ -4,6 +4,7 @@
 #include "VideoBackends/Vulkan/VKPipeline.h"
 
 #include <array>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/EnumMap.h"
@@ -240,39 +241,102 @@ GetVulkanColorBlendState(const BlendingState& state,
   return vk_state;
 }
 
-std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
+namespace
+{
+// Everything that goes into a graphics pipeline, so that it can be used to create either a whole
+// pipeline or the separate parts of a pipeline library.
+struct GraphicsPipelineState
+{
+  VkRenderPass render_pass = VK_NULL_HANDLE;
+  VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+  const VkPipelineVertexInputStateCreateInfo* vertex_input_state = nullptr;
+  VkPipelineInputAssemblyStateCreateInfo input_assembly_state = {};
+  std::array<VkPipelineShaderStageCreateInfo, 3> shader_stages = {};
+  uint32_t num_shader_stages = 0;
+  VkPipelineRasterizationStateCreateInfo rasterization_state = {};
+  VkPipelineMultisampleStateCreateInfo multisample_state = {};
+  VkPipelineDepthStencilStateCreateInfo depth_stencil_state = {};
+  std::vector<VkPipelineColorBlendAttachmentState> blend_attachment_states;
+  VkPipelineColorBlendStateCreateInfo blend_state = {};
+};
+}  // namespace
+
+static const VkPipelineViewportStateCreateInfo* GetVulkanViewportState()
+{
+  static const VkDepthClampRangeEXT clamp_range = {0.0f, MAX_EFB_DEPTH};
+  static const VkPipelineViewportDepthClampControlCreateInfoEXT depth_clamp_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLAMP_CONTROL_CREATE_INFO_EXT, nullptr,
+      VK_DEPTH_CLAMP_MODE_USER_DEFINED_RANGE_EXT,  // VkDepthClampModeEXT            depthClampMode
+      &clamp_range  // const VkDepthClampRangeEXT*    pDepthClampRange
+  };
+
+  // This viewport isn't used, but needs to be specified anyway.
+  static const VkViewport viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
+  static const VkRect2D scissor = {{0, 0}, {1, 1}};
+  static const VkPipelineViewportStateCreateInfo viewport_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+      g_backend_info.bSupportsUnrestrictedDepthRange ? &depth_clamp_state : nullptr,
+      0,          // VkPipelineViewportStateCreateFlags    flags;
+      1,          // uint32_t                              viewportCount
+      &viewport,  // const VkViewport*                     pViewports
+      1,          // uint32_t                              scissorCount
+      &scissor    // const VkRect2D*                       pScissors
+  };
+
+  return &viewport_state;
+}
+
+static const VkPipelineDynamicStateCreateInfo* GetVulkanDynamicState()
+{
+  // Set viewport and scissor dynamic state so we can change it elsewhere.
+  static const std::array<VkDynamicState, 2> dynamic_states{
+      VK_DYNAMIC_STATE_VIEWPORT,
+      VK_DYNAMIC_STATE_SCISSOR,
+  };
+  static const VkPipelineDynamicStateCreateInfo dynamic_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr,
+      0,                                        // VkPipelineDynamicStateCreateFlags    flags
+      static_cast<u32>(dynamic_states.size()),  // uint32_t dynamicStateCount
+      dynamic_states.data()  // const VkDynamicState*                pDynamicStates
+  };
+
+  return &dynamic_state;
+}
+
+static bool GetGraphicsPipelineState(const AbstractPipelineConfig& config,
+                                     GraphicsPipelineState* state)
 {
   DEBUG_ASSERT(config.vertex_shader && config.pixel_shader);
 
-  // Get render pass for config.
-  VkRenderPass render_pass = g_object_cache->GetRenderPass(
+  // Get render pass for config. Multiview is only used for stereoscopy, so it renders two layers.
+  const u32 view_mask = config.framebuffer_state.multiview ? 0b11 : 0;
+  state->render_pass = g_object_cache->GetRenderPass(
       VKTexture::GetVkFormatForHostTextureFormat(config.framebuffer_state.color_texture_format),
       VKTexture::GetVkFormatForHostTextureFormat(config.framebuffer_state.depth_texture_format),
       config.framebuffer_state.samples, VK_ATTACHMENT_LOAD_OP_LOAD,
-      config.framebuffer_state.additional_color_attachment_count);
+      config.framebuffer_state.additional_color_attachment_count, view_mask);
 
-  if (render_pass == VK_NULL_HANDLE)
+  if (state->render_pass == VK_NULL_HANDLE)
   {
     PanicAlertFmt("Failed to get render pass");
-    return nullptr;
+    return false;
   }
 
   // Get pipeline layout.
-  VkPipelineLayout pipeline_layout;
   switch (config.usage)
   {
   case AbstractPipelineUsage::GX:
-    pipeline_layout = g_object_cache->GetPipelineLayout(PIPELINE_LAYOUT_STANDARD);
+    state->pipeline_layout = g_object_cache->GetPipelineLayout(PIPELINE_LAYOUT_STANDARD);
     break;
   case AbstractPipelineUsage::GXUber:
-    pipeline_layout = g_object_cache->GetPipelineLayout(PIPELINE_LAYOUT_UBER);
+    state->pipeline_layout = g_object_cache->GetPipelineLayout(PIPELINE_LAYOUT_UBER);
     break;
   case AbstractPipelineUsage::Utility:
-    pipeline_layout = g_object_cache->GetPipelineLayout(PIPELINE_LAYOUT_UTILITY);
+    state->pipeline_layout = g_object_cache->GetPipelineLayout(PIPELINE_LAYOUT_UTILITY);
     break;
   default:
     PanicAlertFmt("Unknown pipeline layout.");
-    return nullptr;
+    return false;
   }
 
   // Declare descriptors for empty vertex buffers/attributes
@@ -287,16 +351,16 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
   };
 
   // Vertex inputs
-  const VkPipelineVertexInputStateCreateInfo& vertex_input_state =
+  state->vertex_input_state =
       config.vertex_format ?
-          static_cast<const VertexFormat*>(config.vertex_format)->GetVertexInputStateInfo() :
-          empty_vertex_input_state;
+          &static_cast<const VertexFormat*>(config.vertex_format)->GetVertexInputStateInfo() :
+          &empty_vertex_input_state;
 
   // Input assembly
   static constexpr std::array<VkPrimitiveTopology, 4> vk_primitive_topologies = {
       {VK_PRIMITIVE_TOPOLOGY_POINT_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
        VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP}};
-  VkPipelineInputAssemblyStateCreateInfo input_assembly_state = {
+  state->input_assembly_state = {
       VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO, nullptr, 0,
       vk_primitive_topologies[static_cast<u32>(config.rasterization_state.primitive.Value())],
       VK_FALSE};
@@ -307,14 +371,14 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
   // VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_WITH_ADJACENCY or VK_PRIMITIVE_TOPOLOGY_PATCH_LIST,
   // primitiveRestartEnable must be VK_FALSE
   if (g_backend_info.bSupportsPrimitiveRestart &&
-      IsStripPrimitiveTopology(input_assembly_state.topology))
+      IsStripPrimitiveTopology(state->input_assembly_state.topology))
   {
-    input_assembly_state.primitiveRestartEnable = VK_TRUE;
+    state->input_assembly_state.primitiveRestartEnable = VK_TRUE;
   }
 
-  // Shaders to stages
-  VkPipelineShaderStageCreateInfo shader_stages[3];
-  uint32_t num_shader_stages = 0;
+  // Shaders to stages. The pixel shader must stay last, pipeline libraries rely on it.
+  auto& shader_stages = state->shader_stages;
+  uint32_t& num_shader_stages = state->num_shader_stages;
   if (config.vertex_shader)
   {
     shader_stages[num_shader_stages++] = {
@@ -347,16 +411,13 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
   }
 
   // Fill in Vulkan descriptor structs from our state structures.
-  VkPipelineRasterizationStateCreateInfo rasterization_state =
-      GetVulkanRasterizationState(config.rasterization_state);
-  VkPipelineMultisampleStateCreateInfo multisample_state =
-      GetVulkanMultisampleState(config.framebuffer_state);
-  VkPipelineDepthStencilStateCreateInfo depth_stencil_state =
-      GetVulkanDepthStencilState(config.depth_state);
+  state->rasterization_state = GetVulkanRasterizationState(config.rasterization_state);
+  state->multisample_state = GetVulkanMultisampleState(config.framebuffer_state);
+  state->depth_stencil_state = GetVulkanDepthStencilState(config.depth_state);
   VkPipelineColorBlendAttachmentState blend_attachment_state =
       GetVulkanAttachmentBlendState(config.blending_state, config.usage);
 
-  std::vector<VkPipelineColorBlendAttachmentState> blend_attachment_states;
+  auto& blend_attachment_states = state->blend_attachment_states;
   blend_attachment_states.push_back(blend_attachment_state);
   // Right now all our attachments have the same state
   for (u8 i = 0; i < static_cast<u8>(config.framebuffer_state.additional_color_attachment_count);
@@ -364,63 +425,40 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
   {
     blend_attachment_states.push_back(blend_attachment_state);
   }
-  VkPipelineColorBlendStateCreateInfo blend_state =
+  state->blend_state =
       GetVulkanColorBlendState(config.blending_state, blend_attachment_states.data(),
                                static_cast<uint32_t>(blend_attachment_states.size()));
 
-  static const VkDepthClampRangeEXT clamp_range = {0.0f, MAX_EFB_DEPTH};
-  static const VkPipelineViewportDepthClampControlCreateInfoEXT depth_clamp_state = {
-      VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLAMP_CONTROL_CREATE_INFO_EXT, nullptr,
-      VK_DEPTH_CLAMP_MODE_USER_DEFINED_RANGE_EXT,  // VkDepthClampModeEXT            depthClampMode
-      &clamp_range  // const VkDepthClampRangeEXT*    pDepthClampRange
-  };
-
-  // This viewport isn't used, but needs to be specified anyway.
-  static const VkViewport viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
-  static const VkRect2D scissor = {{0, 0}, {1, 1}};
-  static const VkPipelineViewportStateCreateInfo viewport_state = {
-      VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
-      g_backend_info.bSupportsUnrestrictedDepthRange ? &depth_clamp_state : nullptr,
-      0,          // VkPipelineViewportStateCreateFlags    flags;
-      1,          // uint32_t                              viewportCount
-      &viewport,  // const VkViewport*                     pViewports
-      1,          // uint32_t                              scissorCount
-      &scissor    // const VkRect2D*                       pScissors
-  };
+  return true;
+}
 
-  // Set viewport and scissor dynamic state so we can change it elsewhere.
-  static const std::array<VkDynamicState, 2> dynamic_states{
-      VK_DYNAMIC_STATE_VIEWPORT,
-      VK_DYNAMIC_STATE_SCISSOR,
-  };
-  static const VkPipelineDynamicStateCreateInfo dynamic_state = {
-      VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr,
-      0,                                        // VkPipelineDynamicStateCreateFlags    flags
-      static_cast<u32>(dynamic_states.size()),  // uint32_t dynamicStateCount
-      dynamic_states.data()  // const VkDynamicState*                pDynamicStates
-  };
+std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
+{
+  GraphicsPipelineState state;
+  if (!GetGraphicsPipelineState(config, &state))
+    return nullptr;
 
   // Combine to full pipeline info structure.
   VkGraphicsPipelineCreateInfo pipeline_info = {
-      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-      nullptr,                // VkStructureType sType
-      0,                      // VkPipelineCreateFlags                            flags
-      num_shader_stages,      // uint32_t                                         stageCount
-      shader_stages,          // const VkPipelineShaderStageCreateInfo*           pStages
-      &vertex_input_state,    // const VkPipelineVertexInputStateCreateInfo*      pVertexInputState
-      &input_assembly_state,  // const VkPipelineInputAssemblyStateCreateInfo* pInputAssemblyState
-      nullptr,                // const VkPipelineTessellationStateCreateInfo*     pTessellationState
-      &viewport_state,        // const VkPipelineViewportStateCreateInfo*         pViewportState
-      &rasterization_state,  // const VkPipelineRasterizationStateCreateInfo*    pRasterizationState
-      &multisample_state,    // const VkPipelineMultisampleStateCreateInfo*      pMultisampleState
-      &depth_stencil_state,  // const VkPipelineDepthStencilStateCreateInfo*     pDepthStencilState
-      &blend_state,          // const VkPipelineColorBlendStateCreateInfo*       pColorBlendState
-      &dynamic_state,        // const VkPipelineDynamicStateCreateInfo*          pDynamicState
-      pipeline_layout,       // VkPipelineLayout                                 layout
-      render_pass,           // VkRenderPass                                     renderPass
-      0,                     // uint32_t                                         subpass
-      VK_NULL_HANDLE,        // VkPipeline                                       basePipelineHandle
-      -1                     // int32_t                                          basePipelineIndex
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,  // VkStructureType sType
+      nullptr,                      // const void*                                   pNext
+      0,                            // VkPipelineCreateFlags                         flags
+      state.num_shader_stages,      // uint32_t                                      stageCount
+      state.shader_stages.data(),   // const VkPipelineShaderStageCreateInfo*        pStages
+      state.vertex_input_state,     // const VkPipelineVertexInputStateCreateInfo*   pVertexInput
+      &state.input_assembly_state,  // const VkPipelineInputAssemblyStateCreateInfo* pInputAssembly
+      nullptr,                      // const VkPipelineTessellationStateCreateInfo*  pTessellation
+      GetVulkanViewportState(),     // const VkPipelineViewportStateCreateInfo*      pViewportState
+      &state.rasterization_state,   // const VkPipelineRasterizationStateCreateInfo* pRasterization
+      &state.multisample_state,     // const VkPipelineMultisampleStateCreateInfo*   pMultisample
+      &state.depth_stencil_state,   // const VkPipelineDepthStencilStateCreateInfo*  pDepthStencil
+      &state.blend_state,           // const VkPipelineColorBlendStateCreateInfo*    pColorBlend
+      GetVulkanDynamicState(),      // const VkPipelineDynamicStateCreateInfo*       pDynamicState
+      state.pipeline_layout,        // VkPipelineLayout                              layout
+      state.render_pass,            // VkRenderPass                                  renderPass
+      0,                            // uint32_t                                      subpass
+      VK_NULL_HANDLE,               // VkPipeline                                    basePipeline
+      -1                            // int32_t                                       basePipelineIdx
   };
 
   VkPipeline pipeline;
@@ -433,6 +471,145 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
     return VK_NULL_HANDLE;
   }
 
-  return std::make_unique<VKPipeline>(config, pipeline, pipeline_layout, config.usage);
+  return std::make_unique<VKPipeline>(config, pipeline, state.pipeline_layout, config.usage);
+}
+
+static VkPipeline CreatePipelineLibrary(VkGraphicsPipelineCreateInfo* pipeline_info,
+                                        VkGraphicsPipelineLibraryFlagsEXT flags)
+{
+  VkGraphicsPipelineLibraryCreateInfoEXT library_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT, nullptr, flags};
+  pipeline_info->sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  pipeline_info->pNext = &library_info;
+  pipeline_info->flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+
+  VkPipeline library;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, pipeline_info, nullptr, &library);
+  pipeline_info->pNext = nullptr;
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines for pipeline library failed: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return library;
+}
+
+std::unique_ptr<VKPipeline> VKPipeline::CreateFastLinked(const AbstractPipelineConfig& config)
+{
+  // Only specialized GX pipelines are created often enough during gameplay to be worth it.
+  if (!g_backend_info.bSupportsFastPipelineLinking || config.usage != AbstractPipelineUsage::GX ||
+      !config.vertex_format)
+  {
+    return nullptr;
+  }
+
+  GraphicsPipelineState state;
+  if (!GetGraphicsPipelineState(config, &state))
+    return nullptr;
+
+  const auto* vertex_format = static_cast<const VertexFormat*>(config.vertex_format);
+  const auto* vertex_shader = static_cast<const VKShader*>(config.vertex_shader);
+  const auto* pixel_shader = static_cast<const VKShader*>(config.pixel_shader);
+  const VkShaderModule geometry_module =
+      config.geometry_shader ?
+          static_cast<const VKShader*>(config.geometry_shader)->GetShaderModule() :
+          VK_NULL_HANDLE;
+
+  // Each part is built once and shared by every pipeline which only differs in the other parts.
+  const u32 primitive = static_cast<u32>(config.rasterization_state.primitive.Value());
+  VkPipeline vertex_input = vertex_format->GetPipelineLibrary(primitive);
+  if (vertex_input == VK_NULL_HANDLE)
+  {
+    VkGraphicsPipelineCreateInfo info = {};
+    info.pVertexInputState = state.vertex_input_state;
+    info.pInputAssemblyState = &state.input_assembly_state;
+    vertex_input =
+        CreatePipelineLibrary(&info, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT);
+    if (vertex_input == VK_NULL_HANDLE)
+      return nullptr;
+    vertex_format->AddPipelineLibrary(primitive, vertex_input);
+  }
+
+  const VKShader::PipelineLibraryKey pre_rasterization_key = {
+      geometry_module, config.rasterization_state.hex, config.framebuffer_state.hex};
+  VkPipeline pre_rasterization = vertex_shader->GetPipelineLibrary(pre_rasterization_key);
+  if (pre_rasterization == VK_NULL_HANDLE)
+  {
+    // Everything but the pixel shader, which is always the last stage.
+    VkGraphicsPipelineCreateInfo info = {};
+    info.stageCount = state.num_shader_stages - 1;
+    info.pStages = state.shader_stages.data();
+    info.pViewportState = GetVulkanViewportState();
+    info.pRasterizationState = &state.rasterization_state;
+    info.pDynamicState = GetVulkanDynamicState();
+    info.layout = state.pipeline_layout;
+    info.renderPass = state.render_pass;
+    pre_rasterization = CreatePipelineLibrary(
+        &info, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT);
+    if (pre_rasterization == VK_NULL_HANDLE)
+      return nullptr;
+    vertex_shader->AddPipelineLibrary(pre_rasterization_key, pre_rasterization);
+  }
+
+  const VKShader::PipelineLibraryKey fragment_shader_key = {
+      VK_NULL_HANDLE, config.depth_state.hex, config.framebuffer_state.hex};
+  VkPipeline fragment_shader = pixel_shader->GetPipelineLibrary(fragment_shader_key);
+  if (fragment_shader == VK_NULL_HANDLE)
+  {
+    VkGraphicsPipelineCreateInfo info = {};
+    info.stageCount = 1;
+    info.pStages = &state.shader_stages[state.num_shader_stages - 1];
+    info.pMultisampleState = &state.multisample_state;
+    info.pDepthStencilState = &state.depth_stencil_state;
+    info.layout = state.pipeline_layout;
+    info.renderPass = state.render_pass;
+    fragment_shader =
+        CreatePipelineLibrary(&info, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT);
+    if (fragment_shader == VK_NULL_HANDLE)
+      return nullptr;
+    pixel_shader->AddPipelineLibrary(fragment_shader_key, fragment_shader);
+  }
+
+  VkPipeline fragment_output = g_object_cache->GetFragmentOutputLibrary(
+      config.blending_state, config.framebuffer_state);
+  if (fragment_output == VK_NULL_HANDLE)
+  {
+    VkGraphicsPipelineCreateInfo info = {};
+    info.pMultisampleState = &state.multisample_state;
+    info.pColorBlendState = &state.blend_state;
+    info.renderPass = state.render_pass;
+    fragment_output = CreatePipelineLibrary(
+        &info, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+    if (fragment_output == VK_NULL_HANDLE)
+      return nullptr;
+    g_object_cache->AddFragmentOutputLibrary(config.blending_state, config.framebuffer_state,
+                                             fragment_output);
+  }
+
+  // Linking without link time optimization is what makes this fast. The libraries don't have to
+  // outlive the linked pipeline.
+  const std::array<VkPipeline, 4> libraries = {vertex_input, pre_rasterization, fragment_shader,
+                                               fragment_output};
+  const VkPipelineLibraryCreateInfoKHR library_info = {
+      VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, nullptr,
+      static_cast<u32>(libraries.size()), libraries.data()};
+  VkGraphicsPipelineCreateInfo pipeline_info = {};
+  pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  pipeline_info.pNext = &library_info;
+  pipeline_info.layout = state.pipeline_layout;
+
+  VkPipeline pipeline;
+  VkResult res = vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), VK_NULL_HANDLE, 1,
+                                           &pipeline_info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines for linked pipeline failed: ");
+    return nullptr;
+  }
+
+  return std::make_unique<VKPipeline>(config, pipeline, state.pipeline_layout, config.usage);
 }
 }  // namespace Vulkan
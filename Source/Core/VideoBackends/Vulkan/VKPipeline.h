@@ -20,8 +20,14 @@ public:
   VkPipeline GetVkPipeline() const { return m_pipeline; }
   VkPipelineLayout GetVkPipelineLayout() const { return m_pipeline_layout; }
   AbstractPipelineUsage GetUsage() const { return m_usage; }
+  bool IsMultiview() const { return m_config.framebuffer_state.multiview; }
   static std::unique_ptr<VKPipeline> Create(const AbstractPipelineConfig& config);
 
+  // Links a pipeline from separately built pipeline library parts, which are reused between
+  // pipelines sharing the same shaders or state. This is much faster than Create, but the result
+  // may run slower. Returns nullptr if VK_EXT_graphics_pipeline_library isn't available.
+  static std::unique_ptr<VKPipeline> CreateFastLinked(const AbstractPipelineConfig& config);
+
 private:
   VkPipeline m_pipeline;
   VkPipelineLayout m_pipeline_layout;
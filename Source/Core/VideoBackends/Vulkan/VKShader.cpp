@@ -47,12 +47,26 @@ VKShader::VKShader(std::vector<u32> spv, VkPipeline compute_pipeline, std::strin
 
 VKShader::~VKShader()
 {
+  for (const auto& [key, library] : m_pipeline_libraries)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), library, nullptr);
+
   if (m_stage != ShaderStage::Compute)
     vkDestroyShaderModule(g_vulkan_context->GetDevice(), m_module, nullptr);
   else
     vkDestroyPipeline(g_vulkan_context->GetDevice(), m_compute_pipeline, nullptr);
 }
 
+VkPipeline VKShader::GetPipelineLibrary(const PipelineLibraryKey& key) const
+{
+  const auto it = m_pipeline_libraries.find(key);
+  return it != m_pipeline_libraries.end() ? it->second : VK_NULL_HANDLE;
+}
+
+void VKShader::AddPipelineLibrary(const PipelineLibraryKey& key, VkPipeline library) const
+{
+  m_pipeline_libraries.emplace(key, library);
+}
+
 AbstractShader::BinaryData VKShader::GetBinary() const
 {
   BinaryData ret(sizeof(u32) * m_spv.size());
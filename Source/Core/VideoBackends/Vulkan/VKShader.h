@@ -4,9 +4,11 @@
 #pragma once
 
 #include <cstddef>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -26,6 +28,12 @@ public:
   VkPipeline GetComputePipeline() const { return m_compute_pipeline; }
   BinaryData GetBinary() const override;
 
+  // Pipeline library parts built from this shader by VKPipeline::CreateFastLinked, keyed by the
+  // other shader module and state they include. Only used from the video thread.
+  using PipelineLibraryKey = std::tuple<VkShaderModule, u32, u32>;
+  VkPipeline GetPipelineLibrary(const PipelineLibraryKey& key) const;
+  void AddPipelineLibrary(const PipelineLibraryKey& key, VkPipeline library) const;
+
   static std::unique_ptr<VKShader> CreateFromSource(ShaderStage stage, std::string_view source,
                                                     std::string_view name);
   static std::unique_ptr<VKShader> CreateFromBinary(ShaderStage stage, const void* data,
@@ -36,6 +44,7 @@ private:
   VkShaderModule m_module;
   VkPipeline m_compute_pipeline;
   std::string m_name;
+  mutable std::map<PipelineLibraryKey, VkPipeline> m_pipeline_libraries;
 };
 
 }  // namespace Vulkan
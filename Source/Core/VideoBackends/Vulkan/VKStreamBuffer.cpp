@@ -9,13 +9,22 @@
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
+#include "VideoCommon/Statistics.h"
 
 namespace Vulkan
 {
+// Without Resizable BAR, drivers expose a 256 MiB window of VRAM to the CPU, which is easily
+// exhausted and is better left to the driver. Only when the whole heap is mappable (Resizable
+// BAR, or unified memory) do stream buffers go to VRAM, and each may use at most a small fraction
+// of the heap, so that the remainder is available for textures.
+static constexpr VkDeviceSize MIN_HOST_VISIBLE_DEVICE_LOCAL_HEAP_SIZE = 256 * 1024 * 1024;
+static constexpr VkDeviceSize MAX_HEAP_FRACTION_PER_BUFFER = 16;
+
 StreamBuffer::StreamBuffer(VkBufferUsageFlags usage, u32 size) : m_usage(usage), m_size(size)
 {
 }
@@ -49,6 +58,8 @@ bool StreamBuffer::AllocateBuffer()
       0,                                     // uint32_t               queueFamilyIndexCount
       nullptr                                // const uint32_t*        pQueueFamilyIndices
   };
+  if (m_usage & VK_BUFFER_USAGE_TRANSFER_SRC_BIT)
+    g_vulkan_context->SetTransferSourceSharingMode(&buffer_create_info);
 
   VmaAllocationCreateInfo alloc_create_info = {};
   alloc_create_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
@@ -65,8 +76,30 @@ bool StreamBuffer::AllocateBuffer()
   VkBuffer buffer = VK_NULL_HANDLE;
   VmaAllocation alloc = VK_NULL_HANDLE;
   VmaAllocationInfo alloc_info;
-  VkResult res = vmaCreateBuffer(g_vulkan_context->GetMemoryAllocator(), &buffer_create_info,
-                                 &alloc_create_info, &buffer, &alloc, &alloc_info);
+  VkResult res = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+
+  // Buffers which are read by draws, rather than copied from, benefit from being in VRAM.
+  const VkDeviceSize heap_size = g_vulkan_context->GetHostVisibleDeviceLocalHeapSize();
+  if (!(m_usage & VK_BUFFER_USAGE_TRANSFER_SRC_BIT) &&
+      heap_size > MIN_HOST_VISIBLE_DEVICE_LOCAL_HEAP_SIZE &&
+      m_size <= heap_size / MAX_HEAP_FRACTION_PER_BUFFER)
+  {
+    VmaAllocationCreateInfo device_alloc_create_info = alloc_create_info;
+    device_alloc_create_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+    device_alloc_create_info.requiredFlags =
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    res = vmaCreateBuffer(g_vulkan_context->GetMemoryAllocator(), &buffer_create_info,
+                          &device_alloc_create_info, &buffer, &alloc, &alloc_info);
+    if (res == VK_SUCCESS)
+      INFO_LOG_FMT(VIDEO, "Vulkan: Using device local memory for {} byte stream buffer", m_size);
+  }
+
+  // Fall back to host memory if there is no suitable heap, or it's out of budget.
+  if (res != VK_SUCCESS)
+  {
+    res = vmaCreateBuffer(g_vulkan_context->GetMemoryAllocator(), &buffer_create_info,
+                          &alloc_create_info, &buffer, &alloc, &alloc_info);
+  }
   if (res != VK_SUCCESS)
   {
     LOG_VULKAN_ERROR(res, "vmaCreateBuffer failed: ");
@@ -152,6 +185,7 @@ bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
   // We tried everything we could, and still couldn't get anything. This means that too much space
   // in the buffer is being used by the command buffer currently being recorded. Therefore, the
   // only option is to execute it, and wait until it's done.
+  INCSTAT(g_stats.this_frame.num_stream_buffer_stalls);
   return false;
 }
 
@@ -273,6 +307,7 @@ bool StreamBuffer::WaitForClearSpace(u32 num_bytes)
   }
 
   // Wait until this fence is signaled. This will fire the callback, updating the GPU position.
+  INCSTAT(g_stats.this_frame.num_stream_buffer_stalls);
   g_command_buffer_mgr->WaitForFenceCounter(iter->first);
   m_tracked_fences.erase(m_tracked_fences.begin(),
                          m_current_offset == iter->second ? m_tracked_fences.end() : ++iter);
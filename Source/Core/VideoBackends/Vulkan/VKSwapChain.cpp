@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <utility>
 
 #include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
@@ -272,6 +273,22 @@ bool SwapChain::SelectPresentMode()
   return true;
 }
 
+// Returns the number of clockwise quarter turns of a transform, or 0 if it's mirrored.
+static u32 GetTransformRotation(VkSurfaceTransformFlagBitsKHR transform)
+{
+  switch (transform)
+  {
+  case VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR:
+    return 1;
+  case VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR:
+    return 2;
+  case VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR:
+    return 3;
+  default:
+    return 0;
+  }
+}
+
 bool SwapChain::CreateSwapChain()
 {
   // Look up surface properties to determine image count and dimensions
@@ -295,23 +312,34 @@ bool SwapChain::CreateSwapChain()
   if (surface_capabilities.maxImageCount > 0)
     image_count = std::min(image_count, surface_capabilities.maxImageCount);
 
+  // Prefer identity transform if possible. On Android, the compositor rotates every frame of an
+  // identity swap chain with an extra pass whenever the device isn't in its natural orientation,
+  // so we render pre-rotated with the current transform instead.
+  VkSurfaceTransformFlagBitsKHR transform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+  if (!(surface_capabilities.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR) ||
+      (m_wsi.type == WindowSystemType::Android &&
+       GetTransformRotation(surface_capabilities.currentTransform) != 0))
+  {
+    transform = surface_capabilities.currentTransform;
+  }
+  const u32 rotation = GetTransformRotation(transform);
+
   // Determine the dimensions of the swap chain. Values of -1 indicate the size we specify here
-  // determines window size?
+  // determines window size? m_width and m_height are the size the window is seen at, while images
+  // which are pre-rotated by a quarter turn are in the natural orientation of the display.
   VkExtent2D size = surface_capabilities.currentExtent;
   if (size.width == UINT32_MAX)
   {
     size.width = std::max(g_presenter->GetBackbufferWidth(), 1);
     size.height = std::max(g_presenter->GetBackbufferHeight(), 1);
   }
-  size.width = std::clamp(size.width, surface_capabilities.minImageExtent.width,
-                          surface_capabilities.maxImageExtent.width);
-  size.height = std::clamp(size.height, surface_capabilities.minImageExtent.height,
-                           surface_capabilities.maxImageExtent.height);
-
-  // Prefer identity transform if possible
-  VkSurfaceTransformFlagBitsKHR transform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
-  if (!(surface_capabilities.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR))
-    transform = surface_capabilities.currentTransform;
+  VkExtent2D image_size = size;
+  if (rotation % 2 != 0)
+    std::swap(image_size.width, image_size.height);
+  image_size.width = std::clamp(image_size.width, surface_capabilities.minImageExtent.width,
+                                surface_capabilities.maxImageExtent.width);
+  image_size.height = std::clamp(image_size.height, surface_capabilities.minImageExtent.height,
+                                 surface_capabilities.maxImageExtent.height);
 
   // Select swap chain flags, we only need a colour attachment
   VkImageUsageFlags image_usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
@@ -336,7 +364,7 @@ bool SwapChain::CreateSwapChain()
                                               image_count,
                                               m_surface_format.format,
                                               m_surface_format.colorSpace,
-                                              size,
+                                              image_size,
                                               image_layers,
                                               image_usage,
                                               VK_SHARING_MODE_EXCLUSIVE,
@@ -399,9 +427,10 @@ bool SwapChain::CreateSwapChain()
   if (old_swap_chain != VK_NULL_HANDLE)
     vkDestroySwapchainKHR(g_vulkan_context->GetDevice(), old_swap_chain, nullptr);
 
-  m_width = size.width;
-  m_height = size.height;
+  m_width = rotation % 2 != 0 ? image_size.height : image_size.width;
+  m_height = rotation % 2 != 0 ? image_size.width : image_size.height;
   m_layers = image_layers;
+  m_rotation = rotation;
   return true;
 }
 
@@ -423,8 +452,10 @@ bool SwapChain::SetupSwapChainImages()
                                 images.data());
   ASSERT(res == VK_SUCCESS);
 
+  const bool rotated_quarter_turn = m_rotation % 2 != 0;
   const TextureConfig texture_config(
-      TextureConfig(m_width, m_height, 1, m_layers, 1, m_texture_format,
+      TextureConfig(rotated_quarter_turn ? m_height : m_width,
+                    rotated_quarter_turn ? m_width : m_height, 1, m_layers, 1, m_texture_format,
                     AbstractTextureFlag_RenderTarget, AbstractTextureType::Texture_2DArray));
   const VkRenderPass load_render_pass = g_object_cache->GetRenderPass(
       m_surface_format.format, VK_FORMAT_UNDEFINED, 1, VK_ATTACHMENT_LOAD_OP_LOAD);
@@ -35,8 +35,13 @@ public:
   VkSurfaceFormatKHR GetSurfaceFormat() const { return m_surface_format; }
   AbstractTextureFormat GetTextureFormat() const { return m_texture_format; }
   VkSwapchainKHR GetSwapChain() const { return m_swap_chain; }
+  // The size the window is seen at. When the swap chain is pre-rotated by a quarter turn, the
+  // images are this size with the width and height swapped.
   u32 GetWidth() const { return m_width; }
   u32 GetHeight() const { return m_height; }
+  // Clockwise quarter turns which the images are pre-rotated by, for the presentation engine to
+  // show them without rotating them itself.
+  u32 GetRotation() const { return m_rotation; }
   u32 GetCurrentImageIndex() const { return m_current_swap_chain_image_index; }
   bool IsCurrentImageValid() const { return m_current_swap_chain_image_is_valid; }
   size_t GetSwapChainImageCount() const { return m_swap_chain_images.size(); }
@@ -109,6 +114,7 @@ private:
   u32 m_width = 0;
   u32 m_height = 0;
   u32 m_layers = 0;
+  u32 m_rotation = 0;
 };
 
 }  // namespace Vulkan
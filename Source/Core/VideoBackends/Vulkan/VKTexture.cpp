@@ -350,10 +350,16 @@ void VKTexture::ResolveFromTexture(const AbstractTexture* src, const MathUtil::R
 
 void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
                      size_t buffer_size, u32 layer)
+{
+  LoadRegion(level, 0, 0, width, height, row_length, buffer, buffer_size, layer);
+}
+
+void VKTexture::LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length,
+                           const u8* buffer, size_t buffer_size, u32 layer)
 {
   // Can't copy data larger than the texture extents.
-  width = std::max(1u, std::min(width, GetWidth() >> level));
-  height = std::max(1u, std::min(height, GetHeight() >> level));
+  width = std::max(1u, std::min(width, (GetWidth() >> level) - x));
+  height = std::max(1u, std::min(height, (GetHeight() >> level) - y));
 
   // We don't care about the existing contents of the texture, so we could the image layout to
   // VK_IMAGE_LAYOUT_UNDEFINED here. However, under section 2.2.1, Queue Operation of the Vulkan
@@ -371,8 +377,28 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   // When the last mip level is uploaded, we transition to SHADER_READ_ONLY, ready for use. This is
   // because we can't transition in a render pass, and we don't necessarily know when this texture
   // is going to be used.
-  TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
-                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+  //
+  // Textures which have never been used have no contents the graphics queue would have to hand
+  // over, so they can be uploaded on the transfer queue instead, alongside rendering. They stay
+  // owned by the transfer queue until the last level is uploaded, or until they're used.
+  const bool use_transfer_queue =
+      g_vulkan_context->HasTransferQueue() &&
+      (m_transfer_queue_owned || (m_layout == VK_IMAGE_LAYOUT_UNDEFINED &&
+                                  m_compute_layout == ComputeImageLayout::Undefined));
+  if (use_transfer_queue)
+  {
+    if (!m_transfer_queue_owned)
+    {
+      TransitionToLayout(g_command_buffer_mgr->GetCurrentTransferCommandBuffer(),
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+      m_transfer_queue_owned = true;
+    }
+  }
+  else
+  {
+    TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
+                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+  }
 
   // For unaligned textures, we can save some memory in the transfer buffer by skipping the rows
   // that lie outside of the texture's dimensions.
@@ -425,15 +451,19 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
 
   // Copy from the streaming buffer to the actual image.
   VkBufferImageCopy image_copy = {
-      upload_buffer_offset,                          // VkDeviceSize             bufferOffset
-      row_length,                                    // uint32_t                 bufferRowLength
-      0,                                             // uint32_t                 bufferImageHeight
-      {VK_IMAGE_ASPECT_COLOR_BIT, level, layer, 1},  // VkImageSubresourceLayers imageSubresource
-      {0, 0, 0},                                     // VkOffset3D               imageOffset
-      {width, height, 1}                             // VkExtent3D               imageExtent
+      upload_buffer_offset,                           // VkDeviceSize             bufferOffset
+      row_length,                                     // uint32_t                 bufferRowLength
+      0,                                              // uint32_t                 bufferImageHeight
+      {VK_IMAGE_ASPECT_COLOR_BIT, level, layer, 1},   // VkImageSubresourceLayers imageSubresource
+      {static_cast<s32>(x), static_cast<s32>(y), 0},  // VkOffset3D               imageOffset
+      {width, height, 1}                              // VkExtent3D               imageExtent
   };
-  vkCmdCopyBufferToImage(g_command_buffer_mgr->GetCurrentInitCommandBuffer(), upload_buffer,
-                         m_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &image_copy);
+  // Reserving memory may have executed the command buffer, so get the current one again.
+  const VkCommandBuffer command_buffer =
+      use_transfer_queue ? g_command_buffer_mgr->GetCurrentTransferCommandBuffer() :
+                           g_command_buffer_mgr->GetCurrentInitCommandBuffer();
+  vkCmdCopyBufferToImage(command_buffer, upload_buffer, m_image,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &image_copy);
 
   // Preemptively transition to shader read only after uploading the last mip level, as we're
   // likely finished with writes to this texture for now. We can't do this in common with a
@@ -441,11 +471,50 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   // don't want to interrupt the render pass with calls which were executed ages before.
   if (level == (m_config.levels - 1) && layer == (m_config.layers - 1))
   {
-    TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
-                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    if (m_transfer_queue_owned)
+    {
+      AcquireFromTransferQueue(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+    else
+    {
+      TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
+                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
   }
 }
 
+void VKTexture::AcquireFromTransferQueue(VkImageLayout new_layout) const
+{
+  // The release on the transfer queue and the acquire on the graphics queue must match, and
+  // together they perform the layout transition. The init command buffer waits for the transfer
+  // queue's semaphore, so the acquire happens after the release.
+  VkImageMemoryBarrier barrier = {
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,  // VkStructureType            sType
+      nullptr,                                 // const void*                pNext
+      VK_ACCESS_TRANSFER_WRITE_BIT,            // VkAccessFlags              srcAccessMask
+      0,                                       // VkAccessFlags              dstAccessMask
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,    // VkImageLayout              oldLayout
+      new_layout,                              // VkImageLayout              newLayout
+      g_vulkan_context->GetTransferQueueFamilyIndex(),  // uint32_t srcQueueFamilyIndex
+      g_vulkan_context->GetGraphicsQueueFamilyIndex(),  // uint32_t dstQueueFamilyIndex
+      m_image,                                          // VkImage                    image
+      {GetImageAspectForFormat(GetFormat()), 0, GetLevels(), 0,
+       GetLayers()}  // VkImageSubresourceRange    subresourceRange
+  };
+  vkCmdPipelineBarrier(g_command_buffer_mgr->GetCurrentTransferCommandBuffer(),
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0,
+                       nullptr, 0, nullptr, 1, &barrier);
+
+  barrier.srcAccessMask = 0;
+  barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+  vkCmdPipelineBarrier(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
+                       VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                       nullptr, 0, nullptr, 1, &barrier);
+
+  m_layout = new_layout;
+  m_transfer_queue_owned = false;
+}
+
 void VKTexture::FinishedRendering()
 {
   if (m_layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
@@ -463,6 +532,10 @@ void VKTexture::OverrideImageLayout(VkImageLayout new_layout)
 
 void VKTexture::TransitionToLayout(VkCommandBuffer command_buffer, VkImageLayout new_layout) const
 {
+  // Used before all levels were uploaded on the transfer queue.
+  if (m_transfer_queue_owned)
+    AcquireFromTransferQueue(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
   if (m_layout == new_layout)
     return;
 
@@ -610,6 +683,9 @@ void VKTexture::TransitionToLayout(VkCommandBuffer command_buffer,
                                    ComputeImageLayout new_layout) const
 {
   ASSERT(new_layout != ComputeImageLayout::Undefined);
+  if (m_transfer_queue_owned)
+    AcquireFromTransferQueue(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
   if (m_compute_layout == new_layout)
     return;
 
@@ -1027,6 +1103,8 @@ VKFramebuffer::VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attac
 VKFramebuffer::~VKFramebuffer()
 {
   g_command_buffer_mgr->DeferFramebufferDestruction(m_fb);
+  if (m_multiview_fb != VK_NULL_HANDLE)
+    g_command_buffer_mgr->DeferFramebufferDestruction(m_multiview_fb);
 }
 
 std::unique_ptr<VKFramebuffer>
@@ -1073,6 +1151,24 @@ VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
     return nullptr;
   }
 
+  VkRenderPass multiview_load_render_pass = VK_NULL_HANDLE;
+  VkRenderPass multiview_discard_render_pass = VK_NULL_HANDLE;
+  if (layers > 1 && g_backend_info.bSupportsMultiview)
+  {
+    const u32 view_mask = (1u << layers) - 1;
+    multiview_load_render_pass = g_object_cache->GetRenderPass(
+        vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_LOAD,
+        static_cast<u8>(additional_color_attachments.size()), view_mask);
+    multiview_discard_render_pass = g_object_cache->GetRenderPass(
+        vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+        static_cast<u8>(additional_color_attachments.size()), view_mask);
+    if (multiview_load_render_pass == VK_NULL_HANDLE ||
+        multiview_discard_render_pass == VK_NULL_HANDLE)
+    {
+      return nullptr;
+    }
+  }
+
   VkFramebufferCreateInfo framebuffer_info = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
                                               nullptr,
                                               0,
@@ -1092,9 +1188,29 @@ VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
     return nullptr;
   }
 
-  return std::make_unique<VKFramebuffer>(
+  // A multiview framebuffer has a single layer, the views select the layers of the attachments.
+  VkFramebuffer multiview_fb = VK_NULL_HANDLE;
+  if (multiview_load_render_pass != VK_NULL_HANDLE)
+  {
+    framebuffer_info.renderPass = multiview_load_render_pass;
+    framebuffer_info.layers = 1;
+    res = vkCreateFramebuffer(g_vulkan_context->GetDevice(), &framebuffer_info, nullptr,
+                              &multiview_fb);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkCreateFramebuffer for multiview failed: ");
+      vkDestroyFramebuffer(g_vulkan_context->GetDevice(), fb, nullptr);
+      return nullptr;
+    }
+  }
+
+  auto framebuffer = std::make_unique<VKFramebuffer>(
       color_attachment, depth_attachment, std::move(additional_color_attachments), width, height,
       layers, samples, fb, load_render_pass, discard_render_pass, clear_render_pass);
+  framebuffer->m_multiview_fb = multiview_fb;
+  framebuffer->m_multiview_load_render_pass = multiview_load_render_pass;
+  framebuffer->m_multiview_discard_render_pass = multiview_discard_render_pass;
+  return framebuffer;
 }
 
 void VKFramebuffer::Unbind()
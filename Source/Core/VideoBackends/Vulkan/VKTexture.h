@@ -48,6 +48,8 @@ public:
                           u32 layer, u32 level) override;
   void Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer, size_t buffer_size,
             u32 layer) override;
+  void LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length, const u8* buffer,
+                  size_t buffer_size, u32 layer) override;
   void FinishedRendering() override;
 
   VkImage GetImage() const { return m_image; }
@@ -73,11 +75,16 @@ public:
 private:
   bool CreateView(VkImageViewType type);
 
+  // Hands a texture which is being uploaded on the transfer queue over to the graphics queue, in
+  // the init command buffer.
+  void AcquireFromTransferQueue(VkImageLayout new_layout) const;
+
   VmaAllocation m_alloc;
   VkImage m_image;
   VkImageView m_view = VK_NULL_HANDLE;
   mutable VkImageLayout m_layout = VK_IMAGE_LAYOUT_UNDEFINED;
   mutable ComputeImageLayout m_compute_layout = ComputeImageLayout::Undefined;
+  mutable bool m_transfer_queue_owned = false;
   std::string m_name;
 };
 
@@ -139,6 +146,13 @@ public:
   VkRenderPass GetDiscardRenderPass() const { return m_discard_render_pass; }
   VkRenderPass GetClearRenderPass() const { return m_clear_render_pass; }
 
+  // Multiview render passes render all layers at once, for pipelines with the multiview
+  // framebuffer state. Only layered framebuffers have them, when the device supports multiview.
+  bool HasMultiview() const { return m_multiview_fb != VK_NULL_HANDLE; }
+  VkFramebuffer GetMultiviewFB() const { return m_multiview_fb; }
+  VkRenderPass GetMultiviewLoadRenderPass() const { return m_multiview_load_render_pass; }
+  VkRenderPass GetMultiviewDiscardRenderPass() const { return m_multiview_discard_render_pass; }
+
   void Unbind();
   void TransitionForRender();
 
@@ -158,6 +172,10 @@ protected:
   VkRenderPass m_load_render_pass;
   VkRenderPass m_discard_render_pass;
   VkRenderPass m_clear_render_pass;
+
+  VkFramebuffer m_multiview_fb = VK_NULL_HANDLE;
+  VkRenderPass m_multiview_load_render_pass = VK_NULL_HANDLE;
+  VkRenderPass m_multiview_discard_render_pass = VK_NULL_HANDLE;
 };
 
 }  // namespace Vulkan
@@ -8,6 +8,7 @@
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
 #include "VideoBackends/Vulkan/ObjectCache.h"
+#include "VideoBackends/Vulkan/VulkanContext.h"
 
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexShaderGen.h"
@@ -69,6 +70,15 @@ VertexFormat::VertexFormat(const PortableVertexDeclaration& vtx_decl) : NativeVe
   SetupInputState();
 }
 
+VertexFormat::~VertexFormat()
+{
+  for (VkPipeline library : m_pipeline_libraries)
+  {
+    if (library != VK_NULL_HANDLE)
+      vkDestroyPipeline(g_vulkan_context->GetDevice(), library, nullptr);
+  }
+}
+
 const VkPipelineVertexInputStateCreateInfo& VertexFormat::GetVertexInputStateInfo() const
 {
   return m_input_state_info;
@@ -16,10 +16,19 @@ class VertexFormat : public ::NativeVertexFormat
 {
 public:
   VertexFormat(const PortableVertexDeclaration& vtx_decl);
+  ~VertexFormat() override;
 
   // Passed to pipeline state creation
   const VkPipelineVertexInputStateCreateInfo& GetVertexInputStateInfo() const;
 
+  // Vertex input pipeline library parts, see VKPipeline::CreateFastLinked. These are indexed by
+  // primitive type, as the input assembly state is part of the same library.
+  VkPipeline GetPipelineLibrary(u32 primitive) const { return m_pipeline_libraries[primitive]; }
+  void AddPipelineLibrary(u32 primitive, VkPipeline library) const
+  {
+    m_pipeline_libraries[primitive] = library;
+  }
+
   // Converting PortableVertexDeclaration -> Vulkan types
   void MapAttributes();
   void SetupInputState();
@@ -35,5 +44,7 @@ private:
   VkPipelineVertexInputStateCreateInfo m_input_state_info = {};
 
   uint32_t m_num_attributes = 0;
+
+  mutable std::array<VkPipeline, 4> m_pipeline_libraries = {};
 };
 }  // namespace Vulkan
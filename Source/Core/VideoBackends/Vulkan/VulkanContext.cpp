@@ -86,6 +86,7 @@ VulkanContext::PhysicalDeviceInfo::PhysicalDeviceInfo(VkPhysicalDevice device)
   framebufferDepthSampleCounts = properties.limits.framebufferDepthSampleCounts;
   memcpy(pointSizeRange, properties.limits.pointSizeRange, sizeof(pointSizeRange));
   maxSamplerAnisotropy = properties.limits.maxSamplerAnisotropy;
+  timestampPeriod = properties.limits.timestampPeriod;
 
   dualSrcBlend = features.dualSrcBlend != VK_FALSE;
   geometryShader = features.geometryShader != VK_FALSE;
@@ -458,8 +459,12 @@ void VulkanContext::PopulateBackendInfo(BackendInfo* backend_info)
   backend_info->bSupportsPartialMultisampleResolve = true;  // Assumed support.
   backend_info->bSupportsDynamicVertexLoader = true;        // Assumed support.
   backend_info->bSupportsVSLinePointExpand = true;          // Assumed support.
+  backend_info->bSupportsGPUVertexPulling = true;           // Assumed support.
   backend_info->bSupportsHDROutput = true;                  // Assumed support.
   backend_info->bSupportsUnrestrictedDepthRange = false;    // Dependent on features.
+  backend_info->bSupportsFastPipelineLinking = false;       // Dependent on features.
+  backend_info->bSupportsTimestampQueries = false;          // Dependent on features.
+  backend_info->bSupportsMultiview = false;                 // Dependent on features.
 }
 
 void VulkanContext::PopulateBackendInfoAdapters(BackendInfo* backend_info, const GPUList& gpu_list)
@@ -587,7 +592,7 @@ void VulkanContext::PopulateBackendInfoMultisampleModes(BackendInfo* backend_inf
 std::unique_ptr<VulkanContext> VulkanContext::Create(VkInstance instance, VkPhysicalDevice gpu,
                                                      VkSurfaceKHR surface, bool enable_debug_utils,
                                                      bool enable_validation_layer,
-                                                     u32 vk_api_version)
+                                                     bool use_transfer_queue, u32 vk_api_version)
 {
   std::unique_ptr<VulkanContext> context = std::make_unique<VulkanContext>(instance, gpu);
 
@@ -599,7 +604,7 @@ std::unique_ptr<VulkanContext> VulkanContext::Create(VkInstance instance, VkPhys
     context->EnableDebugUtils();
 
   // Attempt to create the device.
-  if (!context->CreateDevice(surface, enable_validation_layer) ||
+  if (!context->CreateDevice(surface, enable_validation_layer, use_transfer_queue) ||
       !context->CreateAllocator(vk_api_version))
   {
     // Since we are destroying the instance, we're also responsible for destroying the surface.
@@ -674,6 +679,63 @@ bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
         AddExtension(VK_EXT_DEPTH_RANGE_UNRESTRICTED_EXTENSION_NAME, false);
   }
 
+  // Graphics pipeline libraries let us link specialized pipelines from separately compiled parts
+  // quickly, but only if the driver actually implements fast linking.
+  auto IsExtensionAvailable = [&](const char* name) {
+    return Common::Contains(available_extension_list, std::string_view{name},
+                            &VkExtensionProperties::extensionName);
+  };
+  m_device_info.graphicsPipelineLibrary = false;
+  if (vkGetPhysicalDeviceFeatures2 && vkGetPhysicalDeviceProperties2 &&
+      IsExtensionAvailable(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+      IsExtensionAvailable(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+  {
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT library_features = {};
+    library_features.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+    VkPhysicalDeviceFeatures2 features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    InsertIntoChain(&features2, &library_features);
+    vkGetPhysicalDeviceFeatures2(m_physical_device, &features2);
+
+    VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT library_properties = {};
+    library_properties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+    VkPhysicalDeviceProperties2 properties2 = {};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    InsertIntoChain(&properties2, &library_properties);
+    vkGetPhysicalDeviceProperties2(m_physical_device, &properties2);
+
+    if (library_features.graphicsPipelineLibrary &&
+        library_properties.graphicsPipelineLibraryFastLinking)
+    {
+      AddExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, false);
+      AddExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, false);
+      m_device_info.graphicsPipelineLibrary = true;
+    }
+  }
+  g_backend_info.bSupportsFastPipelineLinking = m_device_info.graphicsPipelineLibrary;
+
+  // Multiview renders both eyes of stereoscopic 3D in one pass. Lines and points are still
+  // expanded in the geometry shader within these passes, and the utility shaders write each
+  // layer from it, so geometry shaders have to keep working.
+  m_device_info.multiview = false;
+  if (vkGetPhysicalDeviceFeatures2 && m_device_info.geometryShader &&
+      m_device_info.shaderTessellationAndGeometryPointSize &&
+      IsExtensionAvailable(VK_KHR_MULTIVIEW_EXTENSION_NAME))
+  {
+    VkPhysicalDeviceMultiviewFeatures multiview_features = {};
+    multiview_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
+    VkPhysicalDeviceFeatures2 features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    InsertIntoChain(&features2, &multiview_features);
+    vkGetPhysicalDeviceFeatures2(m_physical_device, &features2);
+
+    if (multiview_features.multiview && multiview_features.multiviewGeometryShader)
+      m_device_info.multiview = AddExtension(VK_KHR_MULTIVIEW_EXTENSION_NAME, false);
+  }
+  g_backend_info.bSupportsMultiview = m_device_info.multiview;
+
   return true;
 }
 
@@ -688,7 +750,8 @@ void VulkanContext::WarnMissingDeviceFeatures()
   }
 }
 
-bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer)
+bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer,
+                                 bool use_transfer_queue)
 {
   u32 queue_family_count;
   vkGetPhysicalDeviceQueueFamilyProperties(m_physical_device, &queue_family_count, nullptr);
@@ -752,6 +815,29 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
     ERROR_LOG_FMT(VIDEO, "Vulkan: Failed to find an acceptable present queue.");
     return false;
   }
+  m_graphics_queue_properties = queue_family_properties[m_graphics_queue_family_index];
+
+  // Only a family without graphics or compute is a separate copy engine which can run alongside
+  // rendering. Uploads copy whole mip levels at any offset, so it must not need coarser copies.
+  m_transfer_queue_family_index = queue_family_count;
+  for (u32 i = 0; use_transfer_queue && i < queue_family_count; i++)
+  {
+    const VkQueueFamilyProperties& properties = queue_family_properties[i];
+    const VkExtent3D& granularity = properties.minImageTransferGranularity;
+    if ((properties.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0 &&
+        (properties.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0 && properties.queueCount > 0 &&
+        granularity.width == 1 && granularity.height == 1 && granularity.depth == 1)
+    {
+      m_transfer_queue_family_index = i;
+      break;
+    }
+  }
+  if (use_transfer_queue && m_transfer_queue_family_index == queue_family_count)
+    WARN_LOG_FMT(VIDEO, "Vulkan: No dedicated transfer queue, uploading on the graphics queue.");
+
+  // Timestamps are only written on the graphics queue.
+  g_backend_info.bSupportsTimestampQueries =
+      m_device_info.timestampPeriod > 0.0f && m_graphics_queue_properties.timestampValidBits != 0;
 
   VkDeviceCreateInfo device_info = {};
   device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -775,17 +861,26 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   present_queue_info.queueCount = 1;
   present_queue_info.pQueuePriorities = queue_priorities;
 
-  std::array<VkDeviceQueueCreateInfo, 2> queue_infos = {{
+  VkDeviceQueueCreateInfo transfer_queue_info = {};
+  transfer_queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+  transfer_queue_info.pNext = nullptr;
+  transfer_queue_info.flags = 0;
+  transfer_queue_info.queueFamilyIndex = m_transfer_queue_family_index;
+  transfer_queue_info.queueCount = 1;
+  transfer_queue_info.pQueuePriorities = queue_priorities;
+
+  std::array<VkDeviceQueueCreateInfo, 3> queue_infos = {{
       graphics_queue_info,
-      present_queue_info,
   }};
 
   device_info.queueCreateInfoCount = 1;
   if (m_graphics_queue_family_index != m_present_queue_family_index &&
       m_present_queue_family_index != queue_family_count)
   {
-    device_info.queueCreateInfoCount = 2;
+    queue_infos[device_info.queueCreateInfoCount++] = present_queue_info;
   }
+  if (m_transfer_queue_family_index != queue_family_count)
+    queue_infos[device_info.queueCreateInfoCount++] = transfer_queue_info;
   device_info.pQueueCreateInfos = queue_infos.data();
 
   if (!SelectDeviceExtensions(surface != VK_NULL_HANDLE))
@@ -806,6 +901,22 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   VkPhysicalDeviceFeatures device_features = m_device_info.features();
   device_info.pEnabledFeatures = &device_features;
 
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT library_features = {};
+  library_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+  library_features.graphicsPipelineLibrary = VK_TRUE;
+  if (m_device_info.graphicsPipelineLibrary)
+    device_info.pNext = &library_features;
+
+  VkPhysicalDeviceMultiviewFeatures multiview_features = {};
+  multiview_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
+  multiview_features.multiview = VK_TRUE;
+  multiview_features.multiviewGeometryShader = VK_TRUE;
+  if (m_device_info.multiview)
+  {
+    multiview_features.pNext = m_device_info.graphicsPipelineLibrary ? &library_features : nullptr;
+    device_info.pNext = &multiview_features;
+  }
+
   // Enable debug layer on debug builds
   if (enable_validation_layer)
   {
@@ -830,9 +941,27 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   {
     vkGetDeviceQueue(m_device, m_present_queue_family_index, 0, &m_present_queue);
   }
+  if (m_transfer_queue_family_index != queue_family_count)
+  {
+    vkGetDeviceQueue(m_device, m_transfer_queue_family_index, 0, &m_transfer_queue);
+    m_transfer_source_queue_family_indices = {m_graphics_queue_family_index,
+                                              m_transfer_queue_family_index};
+    INFO_LOG_FMT(VIDEO, "Vulkan: Uploading textures on transfer queue family {}",
+                 m_transfer_queue_family_index);
+  }
   return true;
 }
 
+void VulkanContext::SetTransferSourceSharingMode(VkBufferCreateInfo* info) const
+{
+  if (!HasTransferQueue())
+    return;
+
+  info->sharingMode = VK_SHARING_MODE_CONCURRENT;
+  info->queueFamilyIndexCount = static_cast<u32>(m_transfer_source_queue_family_indices.size());
+  info->pQueueFamilyIndices = m_transfer_source_queue_family_indices.data();
+}
+
 bool VulkanContext::CreateAllocator(u32 vk_api_version)
 {
   VmaAllocatorCreateInfo allocator_info = {};
@@ -858,6 +987,24 @@ bool VulkanContext::CreateAllocator(u32 vk_api_version)
     return false;
   }
 
+  const VkPhysicalDeviceMemoryProperties* memory_properties;
+  vmaGetMemoryProperties(m_allocator, &memory_properties);
+  constexpr VkMemoryPropertyFlags host_visible_device_local =
+      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+  for (u32 i = 0; i < memory_properties->memoryTypeCount; i++)
+  {
+    const VkMemoryType& type = memory_properties->memoryTypes[i];
+    if ((type.propertyFlags & host_visible_device_local) == host_visible_device_local)
+    {
+      m_host_visible_device_local_heap_size =
+          std::max(m_host_visible_device_local_heap_size,
+                   memory_properties->memoryHeaps[type.heapIndex].size);
+    }
+  }
+  INFO_LOG_FMT(VIDEO, "Vulkan: Host visible device local heap size: {} MiB",
+               m_host_visible_device_local_heap_size >> 20);
+
   return true;
 }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <optional>
 #include <string>
@@ -38,6 +39,7 @@ public:
     VkSampleCountFlags framebufferDepthSampleCounts;
     float pointSizeRange[2];
     float maxSamplerAnisotropy;
+    float timestampPeriod;
     u32 subgroupSize = 1;
     VkDriverId driverID = static_cast<VkDriverId>(0);
     bool dualSrcBlend;
@@ -54,6 +56,8 @@ public:
     bool depthClamp;
     bool textureCompressionBC;
     bool shaderSubgroupOperations = false;
+    bool graphicsPipelineLibrary = false;
+    bool multiview = false;
   };
 
   VulkanContext(VkInstance instance, VkPhysicalDevice physical_device);
@@ -84,7 +88,8 @@ public:
   // been called for the specified VideoConfig.
   static std::unique_ptr<VulkanContext> Create(VkInstance instance, VkPhysicalDevice gpu,
                                                VkSurfaceKHR surface, bool enable_debug_utils,
-                                               bool enable_validation_layer, u32 api_version);
+                                               bool enable_validation_layer,
+                                               bool use_transfer_queue, u32 api_version);
 
   // Enable/disable debug message runtime.
   bool EnableDebugUtils();
@@ -98,6 +103,13 @@ public:
   u32 GetGraphicsQueueFamilyIndex() const { return m_graphics_queue_family_index; }
   VkQueue GetPresentQueue() const { return m_present_queue; }
   u32 GetPresentQueueFamilyIndex() const { return m_present_queue_family_index; }
+  // The dedicated transfer queue, if one was requested and the device has one.
+  bool HasTransferQueue() const { return m_transfer_queue != VK_NULL_HANDLE; }
+  VkQueue GetTransferQueue() const { return m_transfer_queue; }
+  u32 GetTransferQueueFamilyIndex() const { return m_transfer_queue_family_index; }
+  // Buffers which are copied from on both the graphics and the transfer queue are shared between
+  // their queue families, so they don't need ownership transfers.
+  void SetTransferSourceSharingMode(VkBufferCreateInfo* info) const;
   const VkQueueFamilyProperties& GetGraphicsQueueProperties() const
   {
     return m_graphics_queue_properties;
@@ -125,6 +137,13 @@ public:
 
   VmaAllocator GetMemoryAllocator() const { return m_allocator; }
 
+  // Size of the largest device local heap which the CPU can map and write to directly, or zero
+  // if there is none.
+  VkDeviceSize GetHostVisibleDeviceLocalHeapSize() const
+  {
+    return m_host_visible_device_local_heap_size;
+  }
+
 #ifdef WIN32
   // Returns the platform-specific exclusive fullscreen structure.
   VkSurfaceFullScreenExclusiveWin32InfoEXT
@@ -137,7 +156,7 @@ private:
                                        bool validation_layer_enabled);
   bool SelectDeviceExtensions(bool enable_surface);
   void WarnMissingDeviceFeatures();
-  bool CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer);
+  bool CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer, bool use_transfer_queue);
   void InitDriverDetails();
   bool CreateAllocator(u32 vk_api_version);
 
@@ -145,11 +164,15 @@ private:
   VkPhysicalDevice m_physical_device = VK_NULL_HANDLE;
   VkDevice m_device = VK_NULL_HANDLE;
   VmaAllocator m_allocator = VK_NULL_HANDLE;
+  VkDeviceSize m_host_visible_device_local_heap_size = 0;
 
   VkQueue m_graphics_queue = VK_NULL_HANDLE;
   u32 m_graphics_queue_family_index = 0;
   VkQueue m_present_queue = VK_NULL_HANDLE;
   u32 m_present_queue_family_index = 0;
+  VkQueue m_transfer_queue = VK_NULL_HANDLE;
+  u32 m_transfer_queue_family_index = 0;
+  std::array<u32, 2> m_transfer_source_queue_family_indices = {};
   VkQueueFamilyProperties m_graphics_queue_properties = {};
 
   VkDebugUtilsMessengerEXT m_debug_utils_messenger = VK_NULL_HANDLE;
@@ -136,6 +136,13 @@ void AbstractGfx::ScaleTexture(AbstractFramebuffer* dst_framebuffer,
     dst_framebuffer->GetColorAttachment()->FinishedRendering();
 }
 
+std::array<float, 2> AbstractGfx::GetClipSpaceRotation() const
+{
+  static constexpr std::array<std::array<float, 2>, 4> rotations = {
+      {{1.0f, 0.0f}, {0.0f, 1.0f}, {-1.0f, 0.0f}, {0.0f, -1.0f}}};
+  return rotations[GetCurrentFramebufferRotation() % 4];
+}
+
 MathUtil::Rectangle<int>
 AbstractGfx::ConvertFramebufferRectangle(const MathUtil::Rectangle<int>& rect,
                                          const AbstractFramebuffer* framebuffer) const
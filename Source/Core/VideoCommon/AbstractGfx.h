@@ -10,6 +10,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <vector>
 
 class AbstractFramebuffer;
@@ -34,6 +35,14 @@ struct SurfaceInfo
   AbstractTextureFormat format = {};
 };
 
+struct VideoMemoryInfo
+{
+  // Local video memory which the driver lets the process use before it starts paging, in bytes
+  u64 budget = 0;
+  // Local video memory currently used by the process, in bytes
+  u64 usage = 0;
+};
+
 namespace VideoCommon
 {
 class AsyncShaderCompiler;
@@ -122,8 +131,26 @@ public:
                                                            const void* cache_data = nullptr,
                                                            size_t cache_data_length = 0) = 0;
 
+  // Creates a pipeline which is quick to build but may be slower to draw with, as a stand-in until
+  // the pipeline from CreatePipeline is ready. Only called if bSupportsFastPipelineLinking is set.
+  virtual std::unique_ptr<AbstractPipeline>
+  CreateFastLinkedPipeline(const AbstractPipelineConfig& config)
+  {
+    return nullptr;
+  }
+
   AbstractFramebuffer* GetCurrentFramebuffer() const { return m_current_framebuffer; }
 
+  // Clockwise quarter turns which draws to the current framebuffer have to be rotated by. This is
+  // only non-zero for a backbuffer which is presented pre-rotated. Viewports and scissor rectangles
+  // are given as if it wasn't rotated and rotated by the backend, but vertex shaders have to rotate
+  // their output positions with GetClipSpaceRotation.
+  virtual u32 GetCurrentFramebufferRotation() const { return 0; }
+
+  // The cosine and sine of GetCurrentFramebufferRotation. Vertex shaders rotate their output by
+  // opos.xy = float2(opos.x * c - opos.y * s, opos.x * s + opos.y * c).
+  std::array<float, 2> GetClipSpaceRotation() const;
+
   // Sets viewport and scissor to the specified rectangle. rect is assumed to be in framebuffer
   // coordinates, i.e. lower-left origin in OpenGL.
   void SetViewportAndScissor(const MathUtil::Rectangle<int>& rect, float min_depth = 0.0f,
@@ -169,6 +196,27 @@ public:
   // Returns info about the main surface (aka backbuffer)
   virtual SurfaceInfo GetSurfaceInfo() const = 0;
 
+  // Returns the video memory budget and usage reported by the driver, if it can be queried.
+  virtual std::optional<VideoMemoryInfo> GetVideoMemoryInfo() const { return std::nullopt; }
+
+  // GPU timestamp queries, only used if bSupportsTimestampQueries is set. The backend provides a
+  // pool of TIMESTAMP_QUERY_COUNT timestamps, which VideoCommon::GPUTimings splits between frames.
+  static constexpr u32 TIMESTAMP_QUERY_COUNT = 8192;
+
+  // Prepares timestamps [index, index + count) to be written again.
+  virtual void ResetTimestamps(u32 index, u32 count) {}
+
+  // Writes the time at which the GPU has finished all previously recorded work to timestamp index.
+  virtual void WriteTimestamp(u32 index) {}
+
+  // Called once all of timestamps [index, index + count) have been written. They become readable
+  // when the GPU has executed the work recorded up to this point.
+  virtual void ResolveTimestamps(u32 index, u32 count) {}
+
+  // Reads timestamps [index, index + count) in nanoseconds, without waiting for the GPU. Returns
+  // false if they are not all available yet.
+  virtual bool ReadTimestamps(u32 index, u32 count, u64* nanoseconds) { return false; }
+
 protected:
   AbstractFramebuffer* m_current_framebuffer = nullptr;
   const AbstractPipeline* m_current_pipeline = nullptr;
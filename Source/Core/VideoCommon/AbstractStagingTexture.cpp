@@ -66,6 +66,41 @@ void AbstractStagingTexture::ReadTexels(const MathUtil::Rectangle<int>& rect, vo
   }
 }
 
+bool AbstractStagingTexture::ReadTexelsIfChanged(const MathUtil::Rectangle<int>& rect,
+                                                 void* out_ptr, u32 out_stride)
+{
+  ASSERT(m_type != StagingTextureType::Upload);
+  if (!PrepareForAccess())
+    return false;
+
+  ASSERT(rect.left >= 0 && static_cast<u32>(rect.right) <= m_config.width && rect.top >= 0 &&
+         static_cast<u32>(rect.bottom) <= m_config.height);
+
+  const char* current_ptr = m_map_pointer;
+  current_ptr += rect.top * m_map_stride;
+  current_ptr += rect.left * m_texel_size;
+
+  // Rows are compared separately, so that a copy which only partly changed only dirties the
+  // rows which did.
+  const size_t copy_size =
+      std::min(static_cast<size_t>(rect.GetWidth() * m_texel_size), m_map_stride);
+  const int copy_height = rect.GetHeight();
+  char* dst_ptr = static_cast<char*>(out_ptr);
+  bool changed = false;
+  for (int row = 0; row < copy_height; row++)
+  {
+    if (std::memcmp(dst_ptr, current_ptr, copy_size) != 0)
+    {
+      std::memcpy(dst_ptr, current_ptr, copy_size);
+      changed = true;
+    }
+    current_ptr += m_map_stride;
+    dst_ptr += out_stride;
+  }
+
+  return changed;
+}
+
 void AbstractStagingTexture::ReadTexel(u32 x, u32 y, void* out_ptr)
 {
   ASSERT(m_type != StagingTextureType::Upload);
@@ -73,6 +73,10 @@ public:
   void ReadTexels(const MathUtil::Rectangle<int>& rect, void* out_ptr, u32 out_stride);
   void ReadTexel(u32 x, u32 y, void* out_ptr);
 
+  // Same as ReadTexels, but compares each row with out_ptr first and only writes the rows which
+  // differ. Returns false if out_ptr already held the same contents, and nothing was written.
+  bool ReadTexelsIfChanged(const MathUtil::Rectangle<int>& rect, void* out_ptr, u32 out_stride);
+
   // Copies the texels from in_ptr to the staging texture, which can be read by the GPU, with the
   // specified stride (length in bytes of each row). After updating the staging texture with all
   // changes, call CopyToTexture() to update the GPU copy.
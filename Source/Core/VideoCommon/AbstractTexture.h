@@ -31,6 +31,10 @@ public:
                                   u32 layer, u32 level) = 0;
   virtual void Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
                     size_t buffer_size, u32 layer = 0) = 0;
+  // Updates the width x height rectangle starting at (x, y) of the level, leaving the rest of it
+  // as it was. Only supports uncompressed formats.
+  virtual void LoadRegion(u32 level, u32 x, u32 y, u32 width, u32 height, u32 row_length,
+                          const u8* buffer, size_t buffer_size, u32 layer = 0) = 0;
 
   // Hints to the backend that we have finished rendering to this texture, and it will be used
   // as a shader resource and sampled. For Vulkan, this transitions the image layout.
@@ -0,0 +1,233 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/BlockCompression.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace VideoCommon
+{
+namespace
+{
+using Pixel = std::array<u8, 4>;
+using Block = std::array<Pixel, 16>;
+
+Block FetchBlock(const u8* src, u32 width, u32 height, u32 row_length, u32 block_x, u32 block_y)
+{
+  Block block;
+  for (u32 y = 0; y < 4; y++)
+  {
+    const u32 src_y = std::min(block_y * 4 + y, height - 1);
+    for (u32 x = 0; x < 4; x++)
+    {
+      const u32 src_x = std::min(block_x * 4 + x, width - 1);
+      std::memcpy(block[y * 4 + x].data(), src + (src_y * row_length + src_x) * 4, 4);
+    }
+  }
+  return block;
+}
+
+u16 ToRGB565(const Pixel& pixel)
+{
+  const u32 r = (pixel[0] * 31 + 127) / 255;
+  const u32 g = (pixel[1] * 63 + 127) / 255;
+  const u32 b = (pixel[2] * 31 + 127) / 255;
+  return static_cast<u16>((r << 11) | (g << 5) | b);
+}
+
+std::array<s32, 3> FromRGB565(u16 color)
+{
+  const s32 r = color >> 11;
+  const s32 g = (color >> 5) & 0x3f;
+  const s32 b = color & 0x1f;
+  return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+void EncodeColorBlock(const Block& block, u8* dst)
+{
+  // The colors furthest apart along the principal axis of the block are used as the endpoints.
+  std::array<float, 3> mean{};
+  for (const Pixel& pixel : block)
+  {
+    for (int i = 0; i < 3; i++)
+      mean[i] += pixel[i];
+  }
+  for (float& channel : mean)
+    channel /= block.size();
+
+  std::array<std::array<float, 3>, 3> covariance{};
+  for (const Pixel& pixel : block)
+  {
+    const std::array<float, 3> d{pixel[0] - mean[0], pixel[1] - mean[1], pixel[2] - mean[2]};
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+        covariance[i][j] += d[i] * d[j];
+    }
+  }
+
+  // A few rounds of power iteration are plenty to find the axis, when starting from the column of
+  // the channel which varies the most.
+  int widest_channel = 0;
+  for (int i = 1; i < 3; i++)
+  {
+    if (covariance[i][i] > covariance[widest_channel][widest_channel])
+      widest_channel = i;
+  }
+  std::array<float, 3> axis = covariance[widest_channel];
+  for (int iteration = 0; iteration < 4; iteration++)
+  {
+    std::array<float, 3> next{};
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+        next[i] += covariance[i][j] * axis[j];
+    }
+
+    const float scale = std::max({std::abs(next[0]), std::abs(next[1]), std::abs(next[2])});
+    if (scale == 0.0f)
+      break;
+    for (int i = 0; i < 3; i++)
+      axis[i] = next[i] / scale;
+  }
+
+  float min_projection = std::numeric_limits<float>::max();
+  float max_projection = std::numeric_limits<float>::lowest();
+  const Pixel* min_pixel = &block[0];
+  const Pixel* max_pixel = &block[0];
+  for (const Pixel& pixel : block)
+  {
+    const float projection = pixel[0] * axis[0] + pixel[1] * axis[1] + pixel[2] * axis[2];
+    if (projection < min_projection)
+    {
+      min_projection = projection;
+      min_pixel = &pixel;
+    }
+    if (projection > max_projection)
+    {
+      max_projection = projection;
+      max_pixel = &pixel;
+    }
+  }
+
+  // The first endpoint has to be the larger one, or the block is decoded in 3-color mode.
+  u16 color0 = ToRGB565(*max_pixel);
+  u16 color1 = ToRGB565(*min_pixel);
+  if (color0 < color1)
+    std::swap(color0, color1);
+
+  u32 indices = 0;
+  if (color0 != color1)
+  {
+    const std::array<s32, 3> c0 = FromRGB565(color0);
+    const std::array<s32, 3> c1 = FromRGB565(color1);
+    std::array<std::array<s32, 3>, 4> palette;
+    for (int i = 0; i < 3; i++)
+    {
+      palette[0][i] = c0[i];
+      palette[1][i] = c1[i];
+      palette[2][i] = (2 * c0[i] + c1[i]) / 3;
+      palette[3][i] = (c0[i] + 2 * c1[i]) / 3;
+    }
+
+    for (size_t i = 0; i < block.size(); i++)
+    {
+      u32 best_index = 0;
+      s32 best_error = std::numeric_limits<s32>::max();
+      for (u32 index = 0; index < palette.size(); index++)
+      {
+        const s32 dr = block[i][0] - palette[index][0];
+        const s32 dg = block[i][1] - palette[index][1];
+        const s32 db = block[i][2] - palette[index][2];
+        const s32 error = dr * dr + dg * dg + db * db;
+        if (error < best_error)
+        {
+          best_error = error;
+          best_index = index;
+        }
+      }
+      indices |= best_index << (i * 2);
+    }
+  }
+
+  std::memcpy(dst, &color0, sizeof(color0));
+  std::memcpy(dst + 2, &color1, sizeof(color1));
+  std::memcpy(dst + 4, &indices, sizeof(indices));
+}
+
+void EncodeAlphaBlock(const Block& block, u8* dst)
+{
+  u8 min_alpha = 255;
+  u8 max_alpha = 0;
+  for (const Pixel& pixel : block)
+  {
+    min_alpha = std::min(min_alpha, pixel[3]);
+    max_alpha = std::max(max_alpha, pixel[3]);
+  }
+
+  // With the first endpoint larger than the second, the endpoints are interpolated in 8 steps.
+  u64 indices = 0;
+  if (min_alpha != max_alpha)
+  {
+    std::array<s32, 8> palette{max_alpha, min_alpha};
+    for (s32 index = 2; index < 8; index++)
+      palette[index] = ((8 - index) * max_alpha + (index - 1) * min_alpha) / 7;
+
+    for (size_t i = 0; i < block.size(); i++)
+    {
+      u64 best_index = 0;
+      s32 best_error = std::numeric_limits<s32>::max();
+      for (u32 index = 0; index < palette.size(); index++)
+      {
+        const s32 error = std::abs(block[i][3] - palette[index]);
+        if (error < best_error)
+        {
+          best_error = error;
+          best_index = index;
+        }
+      }
+      indices |= best_index << (i * 3);
+    }
+  }
+
+  dst[0] = max_alpha;
+  dst[1] = min_alpha;
+  for (int i = 0; i < 6; i++)
+    dst[2 + i] = static_cast<u8>(indices >> (i * 8));
+}
+
+template <size_t BlockSize, typename EncodeFunction>
+void EncodeBlocks(const u8* src, u32 width, u32 height, u32 row_length, u8* dst,
+                  EncodeFunction encode)
+{
+  const u32 blocks_wide = std::max((width + 3) / 4, 1u);
+  const u32 blocks_high = std::max((height + 3) / 4, 1u);
+  for (u32 block_y = 0; block_y < blocks_high; block_y++)
+  {
+    for (u32 block_x = 0; block_x < blocks_wide; block_x++)
+    {
+      encode(FetchBlock(src, width, height, row_length, block_x, block_y), dst);
+      dst += BlockSize;
+    }
+  }
+}
+}  // namespace
+
+void EncodeBC1(const u8* src, u32 width, u32 height, u32 row_length, u8* dst)
+{
+  EncodeBlocks<8>(src, width, height, row_length, dst, EncodeColorBlock);
+}
+
+void EncodeBC3(const u8* src, u32 width, u32 height, u32 row_length, u8* dst)
+{
+  EncodeBlocks<16>(src, width, height, row_length, dst, [](const Block& block, u8* block_dst) {
+    EncodeAlphaBlock(block, block_dst);
+    EncodeColorBlock(block, block_dst + 8);
+  });
+}
+}  // namespace VideoCommon
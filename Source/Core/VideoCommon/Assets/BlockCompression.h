@@ -0,0 +1,19 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace VideoCommon
+{
+// Quick encoders for the BC1 (DXT1) and BC3 (DXT5) formats. They go for decent quality at a low
+// cost rather than the best possible result.
+//
+// src is RGBA8 with row_length pixels per row. dst receives ceil(width / 4) * ceil(height / 4)
+// blocks, of 8 bytes for BC1 and 16 bytes for BC3. Partial blocks at the right and bottom edges
+// repeat the last column and row. BC1 is encoded without its 1-bit alpha mode, so it's only meant
+// for opaque images.
+void EncodeBC1(const u8* src, u32 width, u32 height, u32 row_length, u8* dst);
+void EncodeBC3(const u8* src, u32 width, u32 height, u32 row_length, u8* dst);
+}  // namespace VideoCommon
@@ -3,10 +3,11 @@
 
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include "Common/Logging/Log.h"
-#include "Common/Thread.h"
 
 #include "UICommon/UICommon.h"
 
@@ -14,7 +15,8 @@ namespace VideoCommon
 {
 void CustomAssetLoader::Initialize()
 {
-  ResizeWorkerThreads(2);
+  std::lock_guard guard(m_assets_to_load_lock);
+  m_max_load_tasks = 2;
 }
 
 void CustomAssetLoader::Shutdown()
@@ -22,74 +24,44 @@ void CustomAssetLoader::Shutdown()
   Reset(false);
 }
 
-bool CustomAssetLoader::StartWorkerThreads(u32 num_worker_threads)
+void CustomAssetLoader::StartLoadTasks()
 {
-  for (u32 i = 0; i < num_worker_threads; i++)
+  while (m_running_load_tasks < std::min<size_t>(m_max_load_tasks, m_assets_to_load.size()))
   {
-    m_worker_threads.emplace_back(&CustomAssetLoader::WorkerThreadRun, this, i);
+    m_load_tasks.Run([this, task_index = m_running_load_tasks] { LoadAssets(task_index); });
+    m_running_load_tasks++;
   }
-
-  return HasWorkerThreads();
-}
-
-bool CustomAssetLoader::ResizeWorkerThreads(u32 num_worker_threads)
-{
-  if (m_worker_threads.size() == num_worker_threads)
-    return true;
-
-  StopWorkerThreads();
-  return StartWorkerThreads(num_worker_threads);
-}
-
-bool CustomAssetLoader::HasWorkerThreads() const
-{
-  return !m_worker_threads.empty();
 }
 
-void CustomAssetLoader::StopWorkerThreads()
+void CustomAssetLoader::StopLoadTasks()
 {
-  if (!HasWorkerThreads())
-    return;
-
-  // Signal worker threads to stop, and wake all of them.
+  // Signal the load tasks to stop, and wait for them to return.
   {
     std::lock_guard guard(m_assets_to_load_lock);
     m_exit_flag.Set();
-    m_worker_thread_wake.notify_all();
   }
 
-  // Wait for worker threads to exit.
-  for (std::thread& thr : m_worker_threads)
-    thr.join();
-  m_worker_threads.clear();
+  m_load_tasks.Wait();
   m_exit_flag.Clear();
 }
 
-void CustomAssetLoader::WorkerThreadRun(u32 thread_index)
+void CustomAssetLoader::LoadAssets(u32 task_index)
 {
-  Common::SetCurrentThreadName(fmt::format("Asset Loader {}", thread_index).c_str());
-
   std::unique_lock load_lock(m_assets_to_load_lock);
-  while (true)
+  while (!m_assets_to_load.empty() && !m_exit_flag.IsSet())
   {
-    m_worker_thread_wake.wait(load_lock,
-                              [&] { return !m_assets_to_load.empty() || m_exit_flag.IsSet(); });
-
-    if (m_exit_flag.IsSet())
-      return;
-
     // If more memory than allowed has already been loaded, we will load nothing more
     //  until the next ScheduleAssetsToLoad from Manager.
     if (m_change_in_memory > m_allowed_memory)
     {
       m_assets_to_load.clear();
-      continue;
+      break;
     }
 
     auto* const item = m_assets_to_load.front();
     m_assets_to_load.pop_front();
 
-    // Make sure another thread isn't loading this handle.
+    // Make sure another task isn't loading this handle.
     if (!m_handles_in_progress.insert(item->GetHandle()).second)
       continue;
 
@@ -104,19 +76,21 @@ void CustomAssetLoader::WorkerThreadRun(u32 thread_index)
     load_lock.lock();
 
     {
-      INFO_LOG_FMT(VIDEO, "CustomAssetLoader thread {} loaded: {} ({})", thread_index,
+      INFO_LOG_FMT(VIDEO, "CustomAssetLoader task {} loaded: {} ({})", task_index,
                    item->GetAssetId(), UICommon::FormatSize(bytes_loaded));
 
       std::lock_guard lk{m_assets_loaded_lock};
       m_asset_handles_loaded.emplace_back(item->GetHandle(), bytes_loaded > 0);
 
-      // Make sure no other threads try to re-process this item.
+      // Make sure no other tasks try to re-process this item.
       // Manager will take the handles and re-ScheduleAssetsToLoad based on timestamps if needed.
       std::erase(m_assets_to_load, item);
     }
 
     m_handles_in_progress.erase(item->GetHandle());
   }
+
+  m_running_load_tasks--;
 }
 
 auto CustomAssetLoader::TakeLoadResults() -> LoadResults
@@ -131,27 +105,25 @@ void CustomAssetLoader::ScheduleAssetsToLoad(std::list<CustomAsset*> assets_to_l
   if (assets_to_load.empty()) [[unlikely]]
     return;
 
-  // There's new assets to process, notify worker threads
+  // There's new assets to process, start load tasks for them
   std::lock_guard guard(m_assets_to_load_lock);
   m_allowed_memory = allowed_memory;
   m_assets_to_load = std::move(assets_to_load);
-  m_worker_thread_wake.notify_all();
+  StartLoadTasks();
 }
 
-void CustomAssetLoader::Reset(bool restart_worker_threads)
+void CustomAssetLoader::Reset(bool restart_load_tasks)
 {
-  const std::size_t worker_thread_count = m_worker_threads.size();
-  StopWorkerThreads();
+  StopLoadTasks();
 
+  std::lock_guard guard(m_assets_to_load_lock);
   m_assets_to_load.clear();
   m_asset_handles_loaded.clear();
   m_allowed_memory = 0;
   m_change_in_memory = 0;
 
-  if (restart_worker_threads)
-  {
-    StartWorkerThreads(static_cast<u32>(worker_thread_count));
-  }
+  if (!restart_load_tasks)
+    m_max_load_tasks = 0;
 }
 
 }  // namespace VideoCommon
@@ -4,21 +4,20 @@
 #pragma once
 
 #include <atomic>
-#include <condition_variable>
 #include <list>
 #include <mutex>
 #include <set>
-#include <thread>
 #include <vector>
 
 #include "Common/Flag.h"
+#include "Common/TaskScheduler.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 
 namespace VideoCommon
 {
 // This class takes any number of assets
-// and loads them across a configurable
-// thread pool
+// and loads them across a few tasks
+// on the shared task scheduler
 class CustomAssetLoader
 {
 public:
@@ -44,28 +43,28 @@ public:
   //  and the change in memory.
   LoadResults TakeLoadResults();
 
-  // Schedule assets to load on the worker threads
+  // Schedule assets to load on the load tasks
   //  and set how much memory is available for loading these additional assets.
   void ScheduleAssetsToLoad(std::list<CustomAsset*> assets_to_load, u64 allowed_memory);
 
-  void Reset(bool restart_worker_threads = true);
+  void Reset(bool restart_load_tasks = true);
 
 private:
-  bool StartWorkerThreads(u32 num_worker_threads);
-  bool ResizeWorkerThreads(u32 num_worker_threads);
-  bool HasWorkerThreads() const;
-  void StopWorkerThreads();
+  // Must be called with m_assets_to_load_lock held.
+  void StartLoadTasks();
+  void StopLoadTasks();
 
-  void WorkerThreadRun(u32 thread_index);
+  // Loads assets until there are none left to load.
+  void LoadAssets(u32 task_index);
 
   Common::Flag m_exit_flag;
 
-  std::vector<std::thread> m_worker_threads;
-
   std::mutex m_assets_to_load_lock;
   std::list<CustomAsset*> m_assets_to_load;
 
-  std::condition_variable m_worker_thread_wake;
+  // The most assets that are loaded at once, and the tasks currently loading them.
+  u32 m_max_load_tasks = 0;
+  u32 m_running_load_tasks = 0;
 
   std::vector<AssetHandle> m_asset_handles_loaded;
 
@@ -78,5 +77,8 @@ private:
   std::mutex m_assets_loaded_lock;
 
   std::set<std::size_t> m_handles_in_progress;
+
+  // Destroyed first, so that the load tasks have returned before anything they use is destroyed.
+  Common::TaskGroup m_load_tasks{Common::TaskPriority::FrameBound};
 };
 }  // namespace VideoCommon
@@ -3,6 +3,10 @@
 
 #include "VideoCommon/Assets/CustomResourceManager.h"
 
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 
@@ -10,10 +14,15 @@
 
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
 
 namespace VideoCommon
 {
+// Pending loads of assets that the game hasn't requested for this many frames are cancelled.
+// The game keeps requesting assets it's still waiting on, so they get requested again if needed.
+constexpr u64 CANCEL_LOAD_AFTER_FRAMES = 60;
+
 void CustomResourceManager::Initialize()
 {
   // Use half of available system memory but leave at least 2GiB unused for system stability.
@@ -51,6 +60,7 @@ void CustomResourceManager::Reset()
   m_texture_data_asset_cache.clear();
   m_dirty_assets.clear();
   m_ram_used = 0;
+  m_frame_count = 1;
 }
 
 void CustomResourceManager::MarkAssetDirty(const CustomAssetLibrary::AssetID& asset_id)
@@ -68,6 +78,7 @@ CustomResourceManager::TextureTimePair CustomResourceManager::GetTextureDataFrom
       resource.asset_data->load_status == AssetData::LoadStatus::ResourceDataAvailable)
   {
     m_active_assets.MakeAssetHighestPriority(resource.asset->GetHandle(), resource.asset);
+    MarkAssetRequested(resource.asset_data);
     return {resource.texture_data, resource.asset->GetLastLoadedTime()};
   }
 
@@ -77,10 +88,43 @@ CustomResourceManager::TextureTimePair CustomResourceManager::GetTextureDataFrom
 
   LoadTextureDataAsset(asset_id, std::move(library), &resource);
   m_active_assets.MakeAssetHighestPriority(resource.asset->GetHandle(), resource.asset);
+  MarkAssetRequested(resource.asset_data);
 
   return {};
 }
 
+void CustomResourceManager::PreloadTextureDataFromAsset(
+    const CustomAssetLibrary::AssetID& asset_id,
+    std::shared_ptr<VideoCommon::CustomAssetLibrary> library)
+{
+  auto& resource = m_texture_data_asset_cache[asset_id];
+  if (resource.asset_data != nullptr &&
+      (resource.asset_data->load_status == AssetData::LoadStatus::ResourceDataAvailable ||
+       resource.asset_data->has_load_error))
+  {
+    return;
+  }
+
+  LoadTextureDataAsset(asset_id, std::move(library), &resource);
+  if (resource.asset_data->load_status != AssetData::LoadStatus::ResourceDataAvailable)
+    resource.asset_data->is_preload = true;
+}
+
+void CustomResourceManager::MarkAssetRequested(AssetData* asset_data)
+{
+  // The score is halved for every frame without a request, so it roughly counts the requests
+  // made over the last couple of frames.
+  if (asset_data->last_request_frame != m_frame_count)
+  {
+    const u64 frames_since_request = m_frame_count - asset_data->last_request_frame;
+    asset_data->request_score >>= std::min<u64>(frames_since_request, 31);
+    asset_data->last_request_frame = m_frame_count;
+  }
+
+  if (asset_data->request_score != std::numeric_limits<u32>::max())
+    asset_data->request_score++;
+}
+
 void CustomResourceManager::LoadTextureDataAsset(
     const CustomAssetLibrary::AssetID& asset_id,
     std::shared_ptr<VideoCommon::CustomAssetLibrary> library, InternalTextureDataResource* resource)
@@ -111,8 +155,11 @@ void CustomResourceManager::XFBTriggered()
 {
   ProcessDirtyAssets();
   ProcessLoadedAssets();
+  CancelStaleLoadRequests();
+  m_frame_count++;
 
-  if (m_ram_used > m_max_ram_available)
+  const u64 max_ram_available = GetMaxRamAvailable();
+  if (m_ram_used > max_ram_available)
   {
     RemoveAssetsUntilBelowMemoryLimit();
   }
@@ -120,11 +167,50 @@ void CustomResourceManager::XFBTriggered()
   if (m_pending_assets.IsEmpty())
     return;
 
-  if (m_ram_used > m_max_ram_available)
+  if (m_ram_used > max_ram_available)
     return;
 
-  const u64 allowed_memory = m_max_ram_available - m_ram_used;
-  m_asset_loader.ScheduleAssetsToLoad(m_pending_assets.Elements(), allowed_memory);
+  // Load the assets requested most recently first, and of those the most frequently requested.
+  // Preloads were never requested by the game, so they go last.
+  std::list<CustomAsset*> assets_to_load = m_pending_assets.Elements();
+  assets_to_load.sort([this](const CustomAsset* a, const CustomAsset* b) {
+    const AssetData& a_data = m_asset_handle_to_data[a->GetHandle()];
+    const AssetData& b_data = m_asset_handle_to_data[b->GetHandle()];
+    return std::tie(a_data.last_request_frame, a_data.request_score) >
+           std::tie(b_data.last_request_frame, b_data.request_score);
+  });
+
+  const u64 allowed_memory = max_ram_available - m_ram_used;
+  m_asset_loader.ScheduleAssetsToLoad(std::move(assets_to_load), allowed_memory);
+}
+
+u64 CustomResourceManager::GetMaxRamAvailable() const
+{
+  if (g_ActiveConfig.iCustomAssetMemoryBudget > 0)
+    return u64(g_ActiveConfig.iCustomAssetMemoryBudget) * 1024 * 1024;
+
+  return m_max_ram_available;
+}
+
+void CustomResourceManager::CancelStaleLoadRequests()
+{
+  std::vector<std::size_t> stale_handles;
+  for (const CustomAsset* asset : m_pending_assets.Elements())
+  {
+    const AssetData& asset_data = m_asset_handle_to_data[asset->GetHandle()];
+    if (!asset_data.is_preload &&
+        m_frame_count - asset_data.last_request_frame > CANCEL_LOAD_AFTER_FRAMES)
+    {
+      stale_handles.push_back(asset->GetHandle());
+    }
+  }
+
+  // The assets stay pending a reload, so they get queued again once they are requested
+  for (const std::size_t handle : stale_handles)
+    m_pending_assets.RemoveAsset(handle);
+
+  if (!stale_handles.empty())
+    DEBUG_LOG_FMT(VIDEO, "Cancelled {} stale asset load requests", stale_handles.size());
 }
 
 void CustomResourceManager::ProcessDirtyAssets()
@@ -180,6 +266,7 @@ void CustomResourceManager::ProcessLoadedAssets()
     m_pending_assets.RemoveAsset(handle);
 
     asset_data.load_request_time = {};
+    asset_data.is_preload = false;
     if (!load_successful)
     {
       asset_data.has_load_error = true;
@@ -194,7 +281,7 @@ void CustomResourceManager::ProcessLoadedAssets()
 
 void CustomResourceManager::RemoveAssetsUntilBelowMemoryLimit()
 {
-  const u64 threshold_ram = m_max_ram_available * 8 / 10;
+  const u64 threshold_ram = GetMaxRamAvailable() * 8 / 10;
 
   if (m_ram_used > threshold_ram)
   {
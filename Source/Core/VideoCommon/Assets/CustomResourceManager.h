@@ -23,9 +23,11 @@ class TextureAsset;
 
 // The resource manager manages custom resources (textures, shaders, meshes)
 // called assets.  These assets are loaded using a priority system,
-// where assets requested more often gets loaded first.  This system
-// also tracks memory usage and if memory usage goes over a calculated limit,
-// then assets will be purged with older assets being targeted first.
+// where the most recently requested assets get loaded first, and among those
+// the ones requested most often.  Load requests that are no longer repeated
+// by the game get cancelled.  This system also tracks memory usage and if
+// memory usage goes over a calculated or configured limit, then assets will
+// be purged with older assets being targeted first.
 class CustomResourceManager
 {
 public:
@@ -47,6 +49,11 @@ public:
   TextureTimePair GetTextureDataFromAsset(const CustomAssetLibrary::AssetID& asset_id,
                                           std::shared_ptr<VideoCommon::CustomAssetLibrary> library);
 
+  // Requests that the texture data be loaded ahead of its first use.  Unlike requests made
+  // through GetTextureDataFromAsset, the request is kept until the load finishes.
+  void PreloadTextureDataFromAsset(const CustomAssetLibrary::AssetID& asset_id,
+                                   std::shared_ptr<VideoCommon::CustomAssetLibrary> library);
+
 private:
   // A generic interface to describe an assets' type
   // and load state
@@ -56,6 +63,13 @@ private:
     CustomAsset::TimeType load_request_time = {};
     bool has_load_error = false;
 
+    // The frame the asset was last requested on, and how often it has been requested recently
+    u64 last_request_frame = 0;
+    u32 request_score = 0;
+
+    // Preload requests are not cancelled when the asset stops being requested
+    bool is_preload = false;
+
     enum class AssetType
     {
       TextureData
@@ -85,9 +99,13 @@ private:
                             std::shared_ptr<VideoCommon::CustomAssetLibrary> library,
                             InternalTextureDataResource* resource);
 
+  void MarkAssetRequested(AssetData* asset_data);
+
   void ProcessDirtyAssets();
   void ProcessLoadedAssets();
+  void CancelStaleLoadRequests();
   void RemoveAssetsUntilBelowMemoryLimit();
+  u64 GetMaxRamAvailable() const;
 
   template <typename T>
   T* CreateAsset(const CustomAssetLibrary::AssetID& asset_id, AssetData::AssetType asset_type,
@@ -199,9 +217,12 @@ private:
   // Memory used by currently "loaded" assets.
   u64 m_ram_used = 0;
 
-  // A calculated amount of memory to avoid exceeding.
+  // A calculated amount of memory to avoid exceeding, unless a budget is configured.
   u64 m_max_ram_available = 0;
 
+  // Incremented each frame, used to age load requests.
+  u64 m_frame_count = 1;
+
   std::map<CustomAssetLibrary::AssetID, InternalTextureDataResource> m_texture_data_asset_cache;
 
   std::mutex m_dirty_mutex;
@@ -256,7 +256,8 @@ static void ConvertTexture_R8G8B8(VideoCommon::CustomTextureData::ArraySlice::Le
   level->data = std::move(new_data);
 }
 
-static bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
+template <typename Stream>
+bool ParseDDSHeader(Stream& file, DDSLoadInfo* info)
 {
   // Exit as early as possible for non-DDS textures, since all extensions are currently
   // passed through this function.
@@ -456,10 +457,10 @@ static bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
   return true;
 }
 
-static bool ReadMipLevel(VideoCommon::CustomTextureData::ArraySlice::Level* level,
-                         File::IOFile& file, const std::string& filename, u32 mip_level,
-                         const DDSLoadInfo& info, u32 width, u32 height, u32 row_length,
-                         size_t size)
+template <typename Stream>
+bool ReadMipLevel(VideoCommon::CustomTextureData::ArraySlice::Level* level, Stream& file,
+                  const std::string& filename, u32 mip_level, const DDSLoadInfo& info, u32 width,
+                  u32 height, u32 row_length, size_t size)
 {
   // D3D11 cannot handle block compressed textures where the first mip level is
   // not a multiple of the block size.
@@ -489,16 +490,44 @@ static bool ReadMipLevel(VideoCommon::CustomTextureData::ArraySlice::Level* leve
   return true;
 }
 
-}  // namespace
-
-namespace VideoCommon
+// Reads from a buffer through the part of the File::IOFile interface used by the DDS loader
+class BufferReader
 {
-bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename)
+public:
+  explicit BufferReader(std::span<const u8> buffer) : m_buffer(buffer) {}
+
+  bool ReadBytes(void* data, size_t length)
+  {
+    if (length > m_buffer.size() - m_position)
+      return false;
+    std::memcpy(data, m_buffer.data() + m_position, length);
+    m_position += length;
+    return true;
+  }
+
+  bool Seek(s64 offset, File::SeekOrigin origin)
+  {
+    if (origin != File::SeekOrigin::Begin || offset < 0 ||
+        static_cast<u64>(offset) > m_buffer.size())
+    {
+      return false;
+    }
+    m_position = static_cast<size_t>(offset);
+    return true;
+  }
+
+  u64 GetSize() const { return m_buffer.size(); }
+
+private:
+  std::span<const u8> m_buffer;
+  size_t m_position = 0;
+};
+
+template <typename Stream>
+bool ReadDDSTexture(VideoCommon::CustomTextureData* texture, Stream& file,
+                    const std::string& filename)
 {
-  File::IOFile file;
-  file.Open(filename, "rb");
-  if (!file.IsOpen())
-    return false;
+  using VideoCommon::CustomTextureData;
 
   DDSLoadInfo info;
   if (!ParseDDSHeader(file, &info))
@@ -546,6 +575,39 @@ bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename)
   return true;
 }
 
+template <typename Stream>
+bool ReadDDSMipLevel(VideoCommon::CustomTextureData::ArraySlice::Level* level, Stream& file,
+                     const std::string& filename, u32 mip_level)
+{
+  DDSLoadInfo info;
+  if (!ParseDDSHeader(file, &info))
+    return false;
+
+  return ReadMipLevel(level, file, filename, mip_level, info, info.width, info.height,
+                      info.first_mip_row_length, info.first_mip_size);
+}
+
+}  // namespace
+
+namespace VideoCommon
+{
+bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename)
+{
+  File::IOFile file;
+  file.Open(filename, "rb");
+  if (!file.IsOpen())
+    return false;
+
+  return ReadDDSTexture(texture, file, filename);
+}
+
+bool LoadDDSTexture(CustomTextureData* texture, std::span<const u8> buffer,
+                    const std::string& name)
+{
+  BufferReader reader(buffer);
+  return ReadDDSTexture(texture, reader, name);
+}
+
 bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename,
                     u32 mip_level)
 {
@@ -555,12 +617,14 @@ bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, const std::stri
   if (!file.IsOpen())
     return false;
 
-  DDSLoadInfo info;
-  if (!ParseDDSHeader(file, &info))
-    return false;
+  return ReadDDSMipLevel(level, file, filename, mip_level);
+}
 
-  return ReadMipLevel(level, file, filename, mip_level, info, info.width, info.height,
-                      info.first_mip_row_length, info.first_mip_size);
+bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, std::span<const u8> buffer,
+                    const std::string& name, u32 mip_level)
+{
+  BufferReader reader(buffer);
+  return ReadDDSMipLevel(level, reader, name, mip_level);
 }
 
 bool LoadPNGTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename)
@@ -592,4 +656,47 @@ bool LoadPNGTexture(CustomTextureData::ArraySlice::Level* level, std::span<const
   level->row_length = level->width;
   return true;
 }
+
+bool SaveDDSTexture(const std::string& filename, const CustomTextureData::ArraySlice& slice)
+{
+  if (slice.m_levels.empty())
+    return false;
+
+  const auto& first_level = slice.m_levels[0];
+  u32 fourcc;
+  if (first_level.format == AbstractTextureFormat::DXT1)
+    fourcc = MAKEFOURCC('D', 'X', 'T', '1');
+  else if (first_level.format == AbstractTextureFormat::DXT5)
+    fourcc = MAKEFOURCC('D', 'X', 'T', '5');
+  else
+    return false;
+
+  const u32 mip_count = static_cast<u32>(slice.m_levels.size());
+  DDS_HEADER header{};
+  header.dwSize = sizeof(header);
+  header.dwFlags = DDS_HEADER_FLAGS_TEXTURE | DDS_HEADER_FLAGS_LINEARSIZE;
+  if (mip_count > 1)
+    header.dwFlags |= DDS_HEADER_FLAGS_MIPMAP;
+  header.dwHeight = first_level.height;
+  header.dwWidth = first_level.width;
+  header.dwPitchOrLinearSize = static_cast<u32>(first_level.data.size());
+  header.dwMipMapCount = mip_count;
+  header.ddspf = {sizeof(DDS_PIXELFORMAT), DDS_FOURCC, fourcc, 0, 0, 0, 0, 0};
+  // DDSCAPS_TEXTURE, and DDSCAPS_COMPLEX | DDSCAPS_MIPMAP for mipmapped textures
+  header.dwCaps = mip_count > 1 ? 0x00401008 : 0x00001000;
+
+  File::IOFile file(filename, "wb");
+  if (!file.WriteBytes(&DDS_MAGIC, sizeof(DDS_MAGIC)) || !file.WriteBytes(&header, sizeof(header)))
+    return false;
+
+  for (const auto& level : slice.m_levels)
+  {
+    if (level.format != first_level.format)
+      return false;
+    if (!file.WriteBytes(level.data.data(), level.data.size()))
+      return false;
+  }
+
+  return true;
+}
 }  // namespace VideoCommon
@@ -31,8 +31,16 @@ public:
 };
 
 bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename);
+bool LoadDDSTexture(CustomTextureData* texture, std::span<const u8> buffer,
+                    const std::string& name);
 bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename,
                     u32 mip_level);
+bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, std::span<const u8> buffer,
+                    const std::string& name, u32 mip_level);
 bool LoadPNGTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename);
 bool LoadPNGTexture(CustomTextureData::ArraySlice::Level* level, std::span<const u8> buffer);
+
+// Writes a block compressed slice which LoadDDSTexture can read back. The levels have to be DXT1
+// or DXT5 without any padding between rows of blocks.
+bool SaveDDSTexture(const std::string& filename, const CustomTextureData::ArraySlice& slice);
 }  // namespace VideoCommon
@@ -4,10 +4,14 @@
 #include "VideoCommon/Assets/TextureAssetUtils.h"
 
 #include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "VideoCommon/Assets/TextureTranscoder.h"
 
 namespace VideoCommon
 {
@@ -64,6 +68,24 @@ bool LoadMips(const std::filesystem::path& asset_path, CustomTextureData::ArrayS
 
   return true;
 }
+
+// The texture file and the _mip<N> files which LoadMips would load after it
+std::vector<std::string> GetTextureFiles(const std::filesystem::path& asset_path)
+{
+  std::string path;
+  std::string filename;
+  std::string extension;
+  SplitPath(PathToString(asset_path), &path, &filename, &extension);
+
+  std::vector<std::string> files{PathToString(asset_path)};
+  for (u32 mip_level = 1;; mip_level++)
+  {
+    std::string mip_path = fmt::format("{}{}_mip{}{}", path, filename, mip_level, extension);
+    if (!File::Exists(mip_path))
+      return files;
+    files.push_back(std::move(mip_path));
+  }
+}
 }  // namespace
 bool LoadTextureDataFromFile(const CustomAssetLibrary::AssetID& asset_id,
                              const std::filesystem::path& asset_path, AbstractTextureType type,
@@ -99,6 +121,14 @@ bool LoadTextureDataFromFile(const CustomAssetLibrary::AssetID& asset_id,
       return {};
     }
 
+    std::optional<Common::Hash128> source_hash;
+    if (TextureTranscoder::IsEnabled())
+    {
+      source_hash = TextureTranscoder::GetSourceHash(GetTextureFiles(asset_path));
+      if (source_hash && TextureTranscoder::LoadCached(*source_hash, data))
+        return true;
+    }
+
     // If we have no slices, create one
     if (data->m_slices.empty())
       data->m_slices.emplace_back();
@@ -117,6 +147,9 @@ bool LoadTextureDataFromFile(const CustomAssetLibrary::AssetID& asset_id,
     if (!LoadMips(asset_path, &slice))
       return false;
 
+    if (source_hash)
+      TextureTranscoder::Queue(*source_hash, *data);
+
     return true;
   }
 
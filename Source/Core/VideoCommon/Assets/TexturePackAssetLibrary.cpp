@@ -0,0 +1,288 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include <xxhash.h>
+
+#include "Common/Logging/Log.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TextureAssetUtils.h"
+
+namespace VideoCommon
+{
+static_assert(sizeof(TexturePackAssetLibrary::Header) == 32);
+static_assert(sizeof(TexturePackAssetLibrary::IndexEntry) == 32);
+static_assert(sizeof(TexturePackAssetLibrary::PayloadHeader) == 8);
+static_assert(sizeof(TexturePackAssetLibrary::LevelHeader) == 16);
+
+std::shared_ptr<TexturePackAssetLibrary> TexturePackAssetLibrary::Open(const std::string& path)
+{
+  auto library = std::make_shared<TexturePackAssetLibrary>();
+  library->m_path = path;
+  if (!library->m_file.Open(path, "rb"))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' could not be opened", path);
+    return nullptr;
+  }
+
+  const u64 file_size = library->m_file.GetSize();
+  Header header;
+  if (!library->m_file.ReadBytes(&header, sizeof(header)) || header.magic != MAGIC ||
+      header.version != VERSION || header.index_offset > file_size ||
+      header.names_offset > file_size ||
+      (file_size - header.index_offset) / sizeof(IndexEntry) < header.num_entries)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an invalid header", path);
+    return nullptr;
+  }
+
+  library->m_index.resize(header.num_entries);
+  library->m_names.resize(file_size - header.names_offset);
+  if (!library->m_file.Seek(header.index_offset, File::SeekOrigin::Begin) ||
+      !library->m_file.ReadArray(library->m_index.data(), library->m_index.size()) ||
+      !library->m_file.Seek(header.names_offset, File::SeekOrigin::Begin) ||
+      !library->m_file.ReadBytes(library->m_names.data(), library->m_names.size()))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' could not be read", path);
+    return nullptr;
+  }
+
+  const bool valid_entries = std::ranges::all_of(library->m_index, [&](const IndexEntry& entry) {
+    return entry.offset <= file_size && entry.size <= file_size - entry.offset &&
+           entry.name_offset <= library->m_names.size() &&
+           entry.name_length <= library->m_names.size() - entry.name_offset;
+  });
+  if (!valid_entries || !std::ranges::is_sorted(library->m_index, {}, &IndexEntry::name_hash))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has an invalid index", path);
+    return nullptr;
+  }
+
+  return library;
+}
+
+u64 TexturePackAssetLibrary::HashName(std::string_view name)
+{
+  return XXH3_64bits(name.data(), name.size());
+}
+
+std::string_view TexturePackAssetLibrary::GetName(const IndexEntry& entry) const
+{
+  return std::string_view(m_names).substr(entry.name_offset, entry.name_length);
+}
+
+const TexturePackAssetLibrary::IndexEntry*
+TexturePackAssetLibrary::FindEntry(std::string_view name) const
+{
+  const u64 hash = HashName(name);
+  auto it = std::ranges::lower_bound(m_index, hash, {}, &IndexEntry::name_hash);
+  for (; it != m_index.end() && it->name_hash == hash; ++it)
+  {
+    if (GetName(*it) == name)
+      return &*it;
+  }
+
+  return nullptr;
+}
+
+std::optional<bool> TexturePackAssetLibrary::FindTexture(std::string_view name) const
+{
+  const IndexEntry* entry = FindEntry(name);
+  if (!entry)
+    return std::nullopt;
+
+  return (entry->flags & FLAG_ARBITRARY_MIPMAPS) != 0;
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  CustomTextureData* data)
+{
+  const IndexEntry* entry = FindEntry(asset_id);
+  if (!entry)
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' is not in texture pack '{}'", asset_id, m_path);
+    return {};
+  }
+
+  std::vector<u8> payload(entry->size);
+  {
+    std::lock_guard lk(m_file_lock);
+    m_file.ClearError();
+    if (!m_file.Seek(entry->offset, File::SeekOrigin::Begin) ||
+        !m_file.ReadBytes(payload.data(), payload.size()))
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' could not be read from texture pack '{}'", asset_id,
+                    m_path);
+      return {};
+    }
+  }
+
+  const auto invalid_payload = [&] {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' in texture pack '{}' is invalid", asset_id, m_path);
+    return LoadInfo{};
+  };
+
+  PayloadHeader payload_header;
+  if (payload.size() < sizeof(payload_header))
+    return invalid_payload();
+  std::memcpy(&payload_header, payload.data(), sizeof(payload_header));
+
+  const size_t level_headers_size = size_t{payload_header.num_levels} * sizeof(LevelHeader);
+  if (payload_header.format >= static_cast<u32>(AbstractTextureFormat::Undefined) ||
+      payload_header.num_levels == 0 ||
+      level_headers_size > payload.size() - sizeof(payload_header))
+  {
+    return invalid_payload();
+  }
+
+  data->m_slices.clear();
+  auto& slice = data->m_slices.emplace_back();
+  size_t level_header_offset = sizeof(payload_header);
+  size_t level_data_offset = level_header_offset + level_headers_size;
+  for (u32 i = 0; i < payload_header.num_levels; i++)
+  {
+    LevelHeader level_header;
+    std::memcpy(&level_header, payload.data() + level_header_offset, sizeof(level_header));
+    level_header_offset += sizeof(level_header);
+
+    if (level_header.data_size > payload.size() - level_data_offset)
+      return invalid_payload();
+
+    auto& level = slice.m_levels.emplace_back();
+    level.format = static_cast<AbstractTextureFormat>(payload_header.format);
+    level.width = level_header.width;
+    level.height = level_header.height;
+    level.row_length = level_header.row_length;
+    level.data.reset(level_header.data_size);
+    std::memcpy(level.data.data(), payload.data() + level_data_offset, level_header.data_size);
+    level_data_offset += level_header.data_size;
+  }
+
+  if (!PurgeInvalidMipsFromTextureData(asset_id, data))
+    return {};
+
+  return LoadInfo{payload.size()};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  TextureAndSamplerData* data)
+{
+  data->type = AbstractTextureType::Texture_2D;
+  return LoadTexture(asset_id, &data->texture_data);
+}
+
+CustomAssetLibrary::LoadInfo
+TexturePackAssetLibrary::LoadRasterSurfaceShader(const AssetID& asset_id,
+                                                 RasterSurfaceShaderData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMaterial(const AssetID& asset_id,
+                                                                   MaterialData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMesh(const AssetID& asset_id,
+                                                               MeshData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures", asset_id);
+  return {};
+}
+
+bool TexturePackWriter::Open(const std::string& path)
+{
+  if (!m_file.Open(path, "wb"))
+    return false;
+
+  // The header is written last, once the offsets are known.
+  const TexturePackAssetLibrary::Header header{};
+  m_offset = sizeof(header);
+  return m_file.WriteBytes(&header, sizeof(header));
+}
+
+bool TexturePackWriter::AddTexture(std::string name, bool has_arbitrary_mipmaps,
+                                   const CustomTextureData& data)
+{
+  if (data.m_slices.size() != 1 || data.m_slices[0].m_levels.empty() ||
+      name.size() > std::numeric_limits<u16>::max() || !m_added_names.insert(name).second)
+  {
+    return false;
+  }
+
+  const auto& levels = data.m_slices[0].m_levels;
+  const TexturePackAssetLibrary::PayloadHeader payload_header{
+      static_cast<u32>(levels[0].format), static_cast<u32>(levels.size())};
+  std::vector<TexturePackAssetLibrary::LevelHeader> level_headers;
+  u64 size = sizeof(payload_header);
+  for (const auto& level : levels)
+  {
+    level_headers.push_back({level.width, level.height, level.row_length,
+                             static_cast<u32>(level.data.size())});
+    size += sizeof(TexturePackAssetLibrary::LevelHeader) + level.data.size();
+  }
+
+  if (size > std::numeric_limits<u32>::max())
+    return false;
+
+  if (!m_file.WriteBytes(&payload_header, sizeof(payload_header)) ||
+      !m_file.WriteArray(level_headers.data(), level_headers.size()))
+  {
+    return false;
+  }
+  for (const auto& level : levels)
+  {
+    if (!m_file.WriteBytes(level.data.data(), level.data.size()))
+      return false;
+  }
+
+  TexturePackAssetLibrary::IndexEntry entry{};
+  entry.name_hash = TexturePackAssetLibrary::HashName(name);
+  entry.offset = m_offset;
+  entry.size = static_cast<u32>(size);
+  entry.name_length = static_cast<u16>(name.size());
+  entry.flags = has_arbitrary_mipmaps ? TexturePackAssetLibrary::FLAG_ARBITRARY_MIPMAPS : 0;
+  m_index.push_back(entry);
+  m_names.push_back(std::move(name));
+  m_offset += size;
+  return true;
+}
+
+bool TexturePackWriter::Finish()
+{
+  // Sort the index by hash, with the names in the same order.
+  std::vector<size_t> order(m_index.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::ranges::sort(order, {}, [this](size_t i) { return m_index[i].name_hash; });
+
+  std::vector<TexturePackAssetLibrary::IndexEntry> index;
+  std::string names;
+  for (const size_t i : order)
+  {
+    TexturePackAssetLibrary::IndexEntry& entry = index.emplace_back(m_index[i]);
+    entry.name_offset = static_cast<u32>(names.size());
+    names += m_names[i];
+  }
+
+  TexturePackAssetLibrary::Header header{};
+  header.magic = TexturePackAssetLibrary::MAGIC;
+  header.version = TexturePackAssetLibrary::VERSION;
+  header.num_entries = static_cast<u32>(index.size());
+  header.index_offset = m_offset;
+  header.names_offset = m_offset + index.size() * sizeof(TexturePackAssetLibrary::IndexEntry);
+
+  return m_file.WriteArray(index.data(), index.size()) && m_file.WriteString(names) &&
+         m_file.Seek(0, File::SeekOrigin::Begin) && m_file.WriteBytes(&header, sizeof(header)) &&
+         m_file.Close();
+}
+}  // namespace VideoCommon
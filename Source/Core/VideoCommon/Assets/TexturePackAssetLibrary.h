@@ -0,0 +1,139 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+
+namespace VideoCommon
+{
+// A texture pack stores a whole directory of custom textures in a single file, already decoded
+// into the format they are uploaded in (including any mip levels), so that neither a directory
+// scan nor image decoding is needed at runtime.
+//
+// Layout (all values little endian):
+//   Header
+//   Texture payloads, each a PayloadHeader, its LevelHeaders and then the level data
+//   Index, one IndexEntry per texture sorted by name hash
+//   Name table, the texture names referenced by the index
+//
+// Opening a pack only reads the index and the name table. Textures are read from the file when
+// they are requested.
+class TexturePackAssetLibrary final : public CustomAssetLibrary
+{
+public:
+  static constexpr std::string_view FILE_EXTENSION = ".dtp";
+
+  struct Header
+  {
+    u32 magic;
+    u32 version;
+    u32 num_entries;
+    u32 padding;
+    u64 index_offset;
+    u64 names_offset;
+  };
+
+  struct IndexEntry
+  {
+    u64 name_hash;
+    u64 offset;
+    u32 size;
+    u32 name_offset;
+    u16 name_length;
+    u8 flags;
+    u8 padding[5];
+  };
+
+  struct PayloadHeader
+  {
+    u32 format;
+    u32 num_levels;
+  };
+
+  struct LevelHeader
+  {
+    u32 width;
+    u32 height;
+    u32 row_length;
+    u32 data_size;
+  };
+
+  static constexpr u32 MAGIC = 0x4B505444;  // DTPK
+  static constexpr u32 VERSION = 1;
+  static constexpr u8 FLAG_ARBITRARY_MIPMAPS = 1;
+
+  static std::shared_ptr<TexturePackAssetLibrary> Open(const std::string& path);
+
+  static u64 HashName(std::string_view name);
+
+  struct TextureEntry
+  {
+    std::string_view name;
+    bool has_arbitrary_mipmaps;
+  };
+
+  // Looks up a texture by its full name, returning whether it has arbitrary mipmaps.
+  std::optional<bool> FindTexture(std::string_view name) const;
+
+  template <typename Function>
+  void ForEachTexture(Function func) const
+  {
+    for (const IndexEntry& entry : m_index)
+      func(TextureEntry{GetName(entry), (entry.flags & FLAG_ARBITRARY_MIPMAPS) != 0});
+  }
+
+  size_t GetNumTextures() const { return m_index.size(); }
+  const std::string& GetPath() const { return m_path; }
+
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureAndSamplerData* data) override;
+  LoadInfo LoadTexture(const AssetID& asset_id, CustomTextureData* data) override;
+  LoadInfo LoadRasterSurfaceShader(const AssetID& asset_id, RasterSurfaceShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+  LoadInfo LoadMesh(const AssetID& asset_id, MeshData* data) override;
+
+private:
+  const IndexEntry* FindEntry(std::string_view name) const;
+  std::string_view GetName(const IndexEntry& entry) const;
+
+  std::string m_path;
+  std::vector<IndexEntry> m_index;
+  std::string m_names;
+
+  std::mutex m_file_lock;
+  File::IOFile m_file;
+};
+
+// Builds a texture pack, writing texture payloads as they are added.
+class TexturePackWriter
+{
+public:
+  bool Open(const std::string& path);
+
+  // Returns false if a texture with the same name was already added, or on a write error.
+  bool AddTexture(std::string name, bool has_arbitrary_mipmaps, const CustomTextureData& data);
+
+  // Writes the index and the header. Returns false on a write error.
+  bool Finish();
+
+  size_t GetNumTextures() const { return m_index.size(); }
+
+private:
+  File::IOFile m_file;
+  std::vector<TexturePackAssetLibrary::IndexEntry> m_index;
+  std::vector<std::string> m_names;
+  std::unordered_set<std::string> m_added_names;
+  u64 m_offset = 0;
+};
+}  // namespace VideoCommon
@@ -0,0 +1,181 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TextureTranscoder.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/WorkQueueThread.h"
+#include "VideoCommon/Assets/BlockCompression.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace VideoCommon::TextureTranscoder
+{
+namespace
+{
+struct WorkItem
+{
+  Common::Hash128 hash;
+  CustomTextureData::ArraySlice slice;
+};
+
+std::mutex s_lock;
+Common::WorkQueueThread<WorkItem> s_worker;
+bool s_worker_started = false;
+// Hashes of textures which have been queued since the worker was started
+std::unordered_set<Common::Hash128> s_queued;
+
+std::string GetCachePath(const Common::Hash128& hash)
+{
+  return fmt::format("{}TranscodedTextures/{:016x}{:016x}.dds",
+                     File::GetUserPath(D_CACHE_IDX), hash.low, hash.high);
+}
+
+void Transcode(WorkItem item)
+{
+  // One format for the whole texture, as all levels of a DDS file share it.
+  const bool has_alpha = std::ranges::any_of(item.slice.m_levels, [](const auto& level) {
+    for (size_t i = 3; i < level.data.size(); i += 4)
+    {
+      if (level.data[i] != 255)
+        return true;
+    }
+    return false;
+  });
+
+  CustomTextureData::ArraySlice compressed;
+  for (const auto& level : item.slice.m_levels)
+  {
+    const u32 blocks_wide = std::max((level.width + 3) / 4, 1u);
+    const u32 blocks_high = std::max((level.height + 3) / 4, 1u);
+
+    auto& compressed_level = compressed.m_levels.emplace_back();
+    compressed_level.format = has_alpha ? AbstractTextureFormat::DXT5 : AbstractTextureFormat::DXT1;
+    compressed_level.width = level.width;
+    compressed_level.height = level.height;
+    compressed_level.row_length = blocks_wide * 4;
+    compressed_level.data.reset(static_cast<size_t>(blocks_wide) * blocks_high *
+                                (has_alpha ? 16 : 8));
+    if (has_alpha)
+    {
+      EncodeBC3(level.data.data(), level.width, level.height, level.row_length,
+                compressed_level.data.data());
+    }
+    else
+    {
+      EncodeBC1(level.data.data(), level.width, level.height, level.row_length,
+                compressed_level.data.data());
+    }
+  }
+
+  // Written under a temporary name so that a partial file is never picked up.
+  const std::string path = GetCachePath(item.hash);
+  const std::string temp_path = path + ".tmp";
+  if (!File::CreateFullPath(path) || !SaveDDSTexture(temp_path, compressed) ||
+      !File::Rename(temp_path, path))
+  {
+    File::Delete(temp_path, File::IfAbsentBehavior::NoConsoleWarning);
+    ERROR_LOG_FMT(VIDEO, "Failed to write transcoded texture '{}'", path);
+  }
+}
+}  // namespace
+
+bool IsEnabled()
+{
+  return g_ActiveConfig.bTranscodeHiresTextures && g_backend_info.bSupportsST3CTextures;
+}
+
+std::optional<Common::Hash128> GetSourceHash(const std::vector<std::string>& files)
+{
+  std::vector<Common::Hash128> hashes;
+  hashes.reserve(files.size());
+  std::vector<u8> buffer;
+  for (const std::string& file_path : files)
+  {
+    File::IOFile file(file_path, "rb");
+    buffer.resize(file.GetSize());
+    if (!file.ReadBytes(buffer.data(), buffer.size()))
+      return std::nullopt;
+    hashes.push_back(Common::ComputeHash128(buffer.data(), buffer.size()));
+  }
+  return Common::ComputeHash128(hashes.data(), hashes.size() * sizeof(Common::Hash128));
+}
+
+bool LoadCached(const Common::Hash128& hash, CustomTextureData* data)
+{
+  const std::string path = GetCachePath(hash);
+  if (!File::Exists(path))
+    return false;
+
+  CustomTextureData cached;
+  if (!LoadDDSTexture(&cached, path))
+    return false;
+
+  *data = std::move(cached);
+  return true;
+}
+
+void Queue(const Common::Hash128& hash, const CustomTextureData& data)
+{
+  if (data.m_slices.size() != 1 || data.m_slices[0].m_levels.empty())
+    return;
+
+  // D3D requires the first level of block compressed textures to be a multiple of the block size.
+  const auto& levels = data.m_slices[0].m_levels;
+  if (levels[0].width % 4 != 0 || levels[0].height % 4 != 0)
+    return;
+
+  // Only the levels which the DDS loader would expect after the first one can be kept.
+  WorkItem item{hash, {}};
+  u32 width = levels[0].width;
+  u32 height = levels[0].height;
+  for (const auto& level : levels)
+  {
+    if (level.format != AbstractTextureFormat::RGBA8 || level.width != width ||
+        level.height != height)
+    {
+      break;
+    }
+
+    auto& copy = item.slice.m_levels.emplace_back();
+    copy.format = level.format;
+    copy.width = level.width;
+    copy.height = level.height;
+    copy.row_length = level.row_length;
+    copy.data.reset(level.data.size());
+    std::ranges::copy(level.data, copy.data.begin());
+
+    width = std::max(width / 2, 1u);
+    height = std::max(height / 2, 1u);
+  }
+  if (item.slice.m_levels.empty())
+    return;
+
+  std::lock_guard lk(s_lock);
+  if (!s_queued.insert(hash).second)
+    return;
+
+  if (!s_worker_started)
+  {
+    s_worker.Reset("Texture Transcoder", Transcode);
+    s_worker_started = true;
+  }
+  s_worker.Push(std::move(item));
+}
+
+void Shutdown()
+{
+  std::lock_guard lk(s_lock);
+  s_worker.StopAndCancel();
+  s_worker_started = false;
+  s_queued.clear();
+}
+}  // namespace VideoCommon::TextureTranscoder
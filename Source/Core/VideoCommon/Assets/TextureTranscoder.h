@@ -0,0 +1,33 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/Hash.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+
+// Custom textures which are loaded from PNG files are big and slow to decode. When enabled, a
+// block compressed copy of each one is made on a worker thread and stored in the cache directory.
+// Later loads use the copy as long as the source files are byte for byte the same, which takes a
+// quarter (BC3) or an eighth (BC1) of the memory and skips decoding the PNGs.
+namespace VideoCommon::TextureTranscoder
+{
+bool IsEnabled();
+
+// Hashes the contents of the files a texture is loaded from.
+std::optional<Common::Hash128> GetSourceHash(const std::vector<std::string>& files);
+
+// Returns true and replaces the contents of data if a copy of the files with this hash exists.
+bool LoadCached(const Common::Hash128& hash, CustomTextureData* data);
+
+// Copies the decoded texture, and compresses it in the background. Textures which can't be block
+// compressed as they are are ignored.
+void Queue(const Common::Hash128& hash, const CustomTextureData& data);
+
+// Drops textures which haven't been compressed yet and stops the worker thread.
+void Shutdown();
+}  // namespace VideoCommon::TextureTranscoder
@@ -0,0 +1,251 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/ZipAssetLibrary.h"
+
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+
+#include <fmt/format.h>
+#include <mz.h>
+#include <mz_zip.h>
+#include <mz_zip_rw.h>
+
+#include "Common/Logging/Log.h"
+#include "Common/ScopeGuard.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TextureAssetUtils.h"
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr std::string_view TEXTURES_PREFIX = "textures/";
+constexpr std::string_view FORMAT_PREFIX = "tex1_";
+
+// Returns the directory directly inside textures/ which a file is in, or an empty string for
+// files which aren't in one.
+std::string_view GetTopDirectory(std::string_view path)
+{
+  const size_t separator = path.find('/');
+  return separator == std::string_view::npos ? std::string_view{} : path.substr(0, separator);
+}
+}  // namespace
+
+ZipAssetLibrary::~ZipAssetLibrary()
+{
+  if (m_zip_reader)
+    mz_zip_reader_delete(&m_zip_reader);
+}
+
+std::shared_ptr<ZipAssetLibrary> ZipAssetLibrary::Open(const std::string& path,
+                                                       const std::string& game_id)
+{
+  auto library = std::make_shared<ZipAssetLibrary>();
+  library->m_path = path;
+  library->m_zip_reader = mz_zip_reader_create();
+  if (!library->m_zip_reader ||
+      mz_zip_reader_open_file(library->m_zip_reader, path.c_str()) != MZ_OK ||
+      mz_zip_reader_get_zip_handle(library->m_zip_reader, &library->m_zip_handle) != MZ_OK)
+  {
+    ERROR_LOG_FMT(VIDEO, "Resource pack '{}' could not be opened", path);
+    return nullptr;
+  }
+
+  // Paths are relative to textures/
+  std::vector<std::pair<std::string, Entry>> files;
+  void* const zip_handle = library->m_zip_handle;
+  for (s32 result = mz_zip_goto_first_entry(zip_handle); result == MZ_OK;
+       result = mz_zip_goto_next_entry(zip_handle))
+  {
+    mz_zip_file* file_info;
+    if (mz_zip_entry_get_info(zip_handle, &file_info) != MZ_OK)
+      continue;
+
+    const std::string_view file_path = file_info->filename;
+    if (!file_path.starts_with(TEXTURES_PREFIX) || file_path.ends_with('/'))
+      continue;
+
+    files.emplace_back(file_path.substr(TEXTURES_PREFIX.size()),
+                       Entry{mz_zip_get_entry(zip_handle),
+                             static_cast<u64>(file_info->uncompressed_size)});
+  }
+
+  // Like GetTextureDirectoriesWithGameId: the directory named after the game ID, or else after
+  // the region-free ID, and any directory with a <game ID>.txt or all.txt file in it.
+  const std::string region_free_id = game_id.substr(0, 3);
+  const bool has_game_id_directory = std::ranges::any_of(
+      files, [&](const auto& file) { return GetTopDirectory(file.first) == game_id; });
+  std::unordered_set<std::string_view> directories{has_game_id_directory ? game_id :
+                                                                           region_free_id};
+  for (const auto& [file_path, entry] : files)
+  {
+    std::string filename;
+    std::string extension;
+    SplitPath(file_path, nullptr, &filename, &extension);
+    if (extension == ".txt" &&
+        (filename == game_id || filename == region_free_id || filename == "all"))
+    {
+      directories.insert(GetTopDirectory(file_path));
+    }
+  }
+
+  for (const auto& [file_path, entry] : files)
+  {
+    const std::string_view directory = GetTopDirectory(file_path);
+    if (directory.empty() || !directories.contains(directory))
+      continue;
+
+    library->m_entries.emplace(file_path, entry);
+
+    std::string filename;
+    std::string extension;
+    SplitPath(file_path, nullptr, &filename, &extension);
+    Common::ToLower(&extension);
+    if ((extension != ".png" && extension != ".dds") || !filename.starts_with(FORMAT_PREFIX))
+      continue;
+
+    const size_t arb_index = filename.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      filename.erase(arb_index, 4);
+
+    library->m_textures.try_emplace(std::move(filename), Texture{file_path, has_arbitrary_mipmaps});
+  }
+
+  return library;
+}
+
+bool ZipAssetLibrary::ReadEntry(const Entry& entry, std::vector<u8>* data)
+{
+  std::lock_guard lk(m_zip_lock);
+
+  if (mz_zip_goto_entry(m_zip_handle, entry.cd_pos) != MZ_OK ||
+      mz_zip_entry_read_open(m_zip_handle, 0, nullptr) != MZ_OK)
+  {
+    return false;
+  }
+
+  Common::ScopeGuard guard{[&] { mz_zip_entry_close(m_zip_handle); }};
+
+  // Stored entries are copied straight from the file, deflated ones are inflated as they're read.
+  data->resize(entry.size);
+  u8* destination = data->data();
+  u64 bytes_to_go = entry.size;
+  while (bytes_to_go > 0)
+  {
+    const s32 read_len = static_cast<s32>(std::min<u64>(bytes_to_go, 0x100000));
+    const s32 bytes_read = mz_zip_entry_read(m_zip_handle, destination, read_len);
+    if (bytes_read <= 0)
+      return false;
+
+    bytes_to_go -= bytes_read;
+    destination += bytes_read;
+  }
+
+  return true;
+}
+
+CustomAssetLibrary::LoadInfo ZipAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                          CustomTextureData* data)
+{
+  const auto texture = m_textures.find(asset_id);
+  if (texture == m_textures.end())
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' is not in resource pack '{}'", asset_id, m_path);
+    return {};
+  }
+
+  const std::string& texture_path = texture->second.path;
+  std::string extension;
+  SplitPath(texture_path, nullptr, nullptr, &extension);
+  std::string extension_lower = extension;
+  Common::ToLower(&extension_lower);
+  const bool is_dds = extension_lower == ".dds";
+
+  std::vector<u8> buffer;
+  if (!ReadEntry(m_entries.at(texture_path), &buffer))
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' could not be read from resource pack '{}'", asset_id, m_path);
+    return {};
+  }
+  size_t bytes_loaded = buffer.size();
+
+  data->m_slices.clear();
+  if (is_dds)
+  {
+    if (!LoadDDSTexture(data, buffer, texture_path))
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' error - could not load dds texture!", asset_id);
+      return {};
+    }
+  }
+  else
+  {
+    auto& level = data->m_slices.emplace_back().m_levels.emplace_back();
+    if (!LoadPNGTexture(&level, buffer))
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' error - could not load png texture!", asset_id);
+      return {};
+    }
+  }
+
+  // Load additional mip levels until a _mip<N> texture is not found
+  const std::string_view base_path =
+      std::string_view(texture_path).substr(0, texture_path.size() - extension.size());
+  auto& slice = data->m_slices[0];
+  for (u32 mip_level = static_cast<u32>(slice.m_levels.size());; mip_level++)
+  {
+    const auto mip = m_entries.find(fmt::format("{}_mip{}{}", base_path, mip_level, extension));
+    if (mip == m_entries.end())
+      break;
+
+    CustomTextureData::ArraySlice::Level level;
+    if (!ReadEntry(mip->second, &buffer) ||
+        !(is_dds ? LoadDDSTexture(&level, buffer, mip->first, mip_level) :
+                   LoadPNGTexture(&level, buffer)))
+    {
+      ERROR_LOG_FMT(VIDEO, "Custom mipmap '{}' failed to load", mip->first);
+      return {};
+    }
+    bytes_loaded += buffer.size();
+
+    slice.m_levels.push_back(std::move(level));
+  }
+
+  if (!PurgeInvalidMipsFromTextureData(asset_id, data))
+    return {};
+
+  return LoadInfo{bytes_loaded};
+}
+
+CustomAssetLibrary::LoadInfo ZipAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                          TextureAndSamplerData* data)
+{
+  data->type = AbstractTextureType::Texture_2D;
+  return LoadTexture(asset_id, &data->texture_data);
+}
+
+CustomAssetLibrary::LoadInfo ZipAssetLibrary::LoadRasterSurfaceShader(const AssetID& asset_id,
+                                                                      RasterSurfaceShaderData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - resource packs only contain textures", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo ZipAssetLibrary::LoadMaterial(const AssetID& asset_id,
+                                                           MaterialData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - resource packs only contain textures", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo ZipAssetLibrary::LoadMesh(const AssetID& asset_id, MeshData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - resource packs only contain textures", asset_id);
+  return {};
+}
+}  // namespace VideoCommon
@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+
+namespace VideoCommon
+{
+// Reads custom textures directly from the textures/ directory of a resource pack zip file, so the
+// pack doesn't have to be extracted first. Opening a pack only reads the central directory of the
+// zip. Textures are read, and decompressed if needed, when they are requested.
+class ZipAssetLibrary final : public CustomAssetLibrary
+{
+public:
+  // Use Open.
+  ZipAssetLibrary() = default;
+  ~ZipAssetLibrary() override;
+
+  ZipAssetLibrary(const ZipAssetLibrary&) = delete;
+  ZipAssetLibrary& operator=(const ZipAssetLibrary&) = delete;
+
+  // Only the textures for the given game are indexed, chosen the same way as the texture
+  // directories in the Load directory.
+  static std::shared_ptr<ZipAssetLibrary> Open(const std::string& path,
+                                               const std::string& game_id);
+
+  struct TextureEntry
+  {
+    std::string_view name;
+    bool has_arbitrary_mipmaps;
+  };
+
+  template <typename Function>
+  void ForEachTexture(Function func) const
+  {
+    for (const auto& [name, texture] : m_textures)
+      func(TextureEntry{name, texture.has_arbitrary_mipmaps});
+  }
+
+  size_t GetNumTextures() const { return m_textures.size(); }
+  const std::string& GetPath() const { return m_path; }
+
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureAndSamplerData* data) override;
+  LoadInfo LoadTexture(const AssetID& asset_id, CustomTextureData* data) override;
+  LoadInfo LoadRasterSurfaceShader(const AssetID& asset_id, RasterSurfaceShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+  LoadInfo LoadMesh(const AssetID& asset_id, MeshData* data) override;
+
+private:
+  struct Entry
+  {
+    // Position of the entry in the central directory
+    s64 cd_pos;
+    u64 size;
+  };
+
+  struct Texture
+  {
+    // Path of the file in the zip
+    std::string path;
+    bool has_arbitrary_mipmaps;
+  };
+
+  bool ReadEntry(const Entry& entry, std::vector<u8>* data);
+
+  std::string m_path;
+  std::unordered_map<std::string, Entry> m_entries;
+  std::unordered_map<std::string, Texture> m_textures;
+
+  std::mutex m_zip_lock;
+  void* m_zip_reader = nullptr;
+  void* m_zip_handle = nullptr;
+};
+}  // namespace VideoCommon
@@ -6,9 +6,13 @@
 #include <thread>
 
 #include "Common/Assert.h"
+#include "Common/CPUTopology.h"
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Common/Trace.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/System.h"
 
@@ -27,22 +31,30 @@ AsyncShaderCompiler::~AsyncShaderCompiler()
 
 void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
 {
+  if (CompilesInBackground())
+  {
+    CompileInBackground(std::move(item));
+  }
   // If no worker threads are available, compile synchronously.
-  if (!HasWorkerThreads())
+  else if (!HasWorkerThreads())
   {
     item->Compile();
-    m_completed_work.push_back(std::move(item));
+    AddCompletedWork(std::move(item));
   }
   else
   {
     std::lock_guard<std::mutex> guard(m_pending_work_lock);
     m_pending_work.emplace(priority, std::move(item));
     m_worker_thread_wake.notify_one();
+    if (m_urgent_priority_limit == 0 || priority < m_urgent_priority_limit)
+      m_urgent_worker_thread_wake.notify_one();
   }
 }
 
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
+  PollBackgroundWork();
+
   std::deque<WorkItemPtr> completed_work;
   {
     std::lock_guard<std::mutex> guard(m_completed_work_lock);
@@ -58,6 +70,9 @@ void AsyncShaderCompiler::RetrieveWorkItems()
 
 bool AsyncShaderCompiler::HasPendingWork()
 {
+  if (PollBackgroundWork() != 0)
+    return true;
+
   std::lock_guard<std::mutex> guard(m_pending_work_lock);
   return !m_pending_work.empty() || m_busy_workers.load() != 0;
 }
@@ -68,6 +83,29 @@ bool AsyncShaderCompiler::HasCompletedWork()
   return !m_completed_work.empty();
 }
 
+void AsyncShaderCompiler::ClearPendingWork()
+{
+  ClearBackgroundWork();
+
+  {
+    std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
+    m_pending_work.clear();
+
+    // There's no way to interrupt a compile in progress.
+    m_workers_idle.wait(pending_lock, [this] { return m_busy_workers.load() == 0; });
+  }
+
+  std::lock_guard<std::mutex> guard(m_completed_work_lock);
+  m_completed_work.clear();
+}
+
+void AsyncShaderCompiler::SetUrgentPriorityLimit(u32 priority)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  m_urgent_priority_limit = priority;
+  m_urgent_worker_thread_wake.notify_all();
+}
+
 bool AsyncShaderCompiler::WaitUntilCompletion(
     const std::function<void(size_t, size_t)>& progress_callback)
 {
@@ -86,23 +124,23 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   }
 
   // Grab the number of pending items. We use this to work out how many are left.
-  size_t total_items;
+  size_t total_items = PollBackgroundWork();
   {
     // Safe to hold both locks here, since nowhere else does.
     std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
     std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-    total_items = m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
+    total_items += m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
   }
 
   // Update progress while the compiles complete.
   while (Core::GetState(Core::System::GetInstance()) != Core::State::Stopping)
   {
-    size_t remaining_items;
+    size_t remaining_items = PollBackgroundWork();
     {
       std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
-      if (m_pending_work.empty() && !m_busy_workers.load())
+      if (m_pending_work.empty() && !m_busy_workers.load() && remaining_items == 0)
         return true;
-      remaining_items = m_pending_work.size();
+      remaining_items += m_pending_work.size();
     }
 
     progress_callback(total_items - remaining_items, total_items);
@@ -113,7 +151,7 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
 
 bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
 {
-  if (num_worker_threads == 0)
+  if (num_worker_threads == 0 || CompilesInBackground())
     return true;
 
   for (u32 i = 0; i < num_worker_threads; i++)
@@ -127,7 +165,11 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
 
     m_worker_thread_start_result.store(false);
 
-    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param);
+    // The last thread is the one kept free for urgent work. If starting any thread fails, it
+    // doesn't exist, so there's always a thread taking everything else.
+    const bool urgent_only = i != 0 && i == num_worker_threads - 1;
+    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param,
+                    urgent_only);
     m_init_event.Wait();
 
     if (!m_worker_thread_start_result.load())
@@ -167,6 +209,7 @@ void AsyncShaderCompiler::StopWorkerThreads()
     std::lock_guard<std::mutex> guard(m_pending_work_lock);
     m_exit_flag.Set();
     m_worker_thread_wake.notify_all();
+    m_urgent_worker_thread_wake.notify_all();
   }
 
   // Wait for worker threads to exit.
@@ -190,10 +233,40 @@ void AsyncShaderCompiler::WorkerThreadExit(void* param)
 {
 }
 
-void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
+bool AsyncShaderCompiler::CompilesInBackground() const
+{
+  return false;
+}
+
+void AsyncShaderCompiler::CompileInBackground(WorkItemPtr item)
+{
+  item->Compile();
+  AddCompletedWork(std::move(item));
+}
+
+size_t AsyncShaderCompiler::PollBackgroundWork()
+{
+  return 0;
+}
+
+void AsyncShaderCompiler::ClearBackgroundWork()
+{
+}
+
+void AsyncShaderCompiler::AddCompletedWork(WorkItemPtr item)
+{
+  std::lock_guard<std::mutex> guard(m_completed_work_lock);
+  m_completed_work.push_back(std::move(item));
+}
+
+void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param, bool urgent_only)
 {
   Common::SetCurrentThreadName("AsyncShaderCompiler Worker");
 
+  // Urgent compiles stall the GPU thread, so only the other workers are moved out of its way.
+  if (!urgent_only && Config::Get(Config::MAIN_THREAD_PLACEMENT))
+    Common::SetCurrentThreadRole(Common::ThreadRole::Background);
+
   // Initialize worker thread with backend-specific method.
   if (!WorkerThreadInitWorkerThread(param))
   {
@@ -206,19 +279,28 @@ void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
   m_worker_thread_start_result.store(true);
   m_init_event.Set();
 
-  WorkerThreadRun();
+  WorkerThreadRun(urgent_only);
 
   WorkerThreadExit(param);
 }
 
-void AsyncShaderCompiler::WorkerThreadRun()
+void AsyncShaderCompiler::WorkerThreadRun(bool urgent_only)
 {
+  std::condition_variable& wake = urgent_only ? m_urgent_worker_thread_wake : m_worker_thread_wake;
+  const auto has_work = [this, urgent_only] {
+    // The lowest priority value comes first, so only the first item needs checking.
+    return !m_pending_work.empty() &&
+           (!urgent_only || m_urgent_priority_limit == 0 ||
+            m_pending_work.begin()->first < m_urgent_priority_limit);
+  };
+
   std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
   while (!m_exit_flag.IsSet())
   {
-    m_worker_thread_wake.wait(pending_lock);
+    // Items may have been queued before this thread started, e.g. when resizing.
+    wake.wait(pending_lock, [&] { return has_work() || m_exit_flag.IsSet(); });
 
-    while (!m_pending_work.empty() && !m_exit_flag.IsSet())
+    while (has_work() && !m_exit_flag.IsSet())
     {
       m_busy_workers++;
       auto iter = m_pending_work.begin();
@@ -226,14 +308,20 @@ void AsyncShaderCompiler::WorkerThreadRun()
       m_pending_work.erase(iter);
       pending_lock.unlock();
 
-      if (item->Compile())
+      bool compiled;
+      {
+        TRACE_SCOPE("AsyncShaderCompiler::Compile");
+        compiled = item->Compile();
+      }
+      if (compiled)
       {
         std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
         m_completed_work.push_back(std::move(item));
       }
 
       pending_lock.lock();
-      m_busy_workers--;
+      if (--m_busy_workers == 0)
+        m_workers_idle.notify_all();
     }
   }
 }
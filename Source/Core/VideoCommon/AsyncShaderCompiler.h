@@ -49,6 +49,15 @@ public:
   bool HasPendingWork();
   bool HasCompletedWork();
 
+  // Drops all work items which haven't been retrieved yet, waiting for the ones which are
+  // currently being compiled. Their Retrieve methods are not called.
+  void ClearPendingWork();
+
+  // With more than one worker thread, one of them only picks up work items with a priority below
+  // the limit, so that they never have to wait for a long queue of less important work to drain.
+  // Zero, the default, disables this.
+  void SetUrgentPriorityLimit(u32 priority);
+
   // Calls progress_callback periodically, with completed_items, and total_items.
   // Returns false if interrupted.
   bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback);
@@ -64,9 +73,20 @@ protected:
   virtual bool WorkerThreadInitWorkerThread(void* param);
   virtual void WorkerThreadExit(void* param);
 
+  // Backends whose driver compiles in the background by itself don't need worker threads. Work
+  // items are then compiled on the thread which queues them, and the backend holds on to them
+  // until PollBackgroundWork finds them complete and passes them to AddCompletedWork.
+  virtual bool CompilesInBackground() const;
+  virtual void CompileInBackground(WorkItemPtr item);
+  // Returns the number of work items which are still compiling.
+  virtual size_t PollBackgroundWork();
+  // Drops the work items which are still compiling. Their Retrieve methods are not called.
+  virtual void ClearBackgroundWork();
+  void AddCompletedWork(WorkItemPtr item);
+
 private:
-  void WorkerThreadEntryPoint(void* param);
-  void WorkerThreadRun();
+  void WorkerThreadEntryPoint(void* param, bool urgent_only);
+  void WorkerThreadRun(bool urgent_only);
 
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
@@ -79,7 +99,10 @@ private:
   std::multimap<u32, WorkItemPtr> m_pending_work;
   std::mutex m_pending_work_lock;
   std::condition_variable m_worker_thread_wake;
+  std::condition_variable m_urgent_worker_thread_wake;
+  std::condition_variable m_workers_idle;
   std::atomic_size_t m_busy_workers{0};
+  u32 m_urgent_priority_limit = 0;
 
   std::deque<WorkItemPtr> m_completed_work;
   std::mutex m_completed_work_lock;
@@ -1604,6 +1604,13 @@ union ZMode
   BitField<4, 1, bool, u32> update_enable;
 
   u32 hex;
+
+  // Whether the depth of a fragment can make any difference, i.e. it's either compared or written.
+  bool IsDepthUsed() const
+  {
+    return test_enable && func != CompareMode::Never &&
+           (update_enable || func != CompareMode::Always);
+  }
 };
 template <>
 struct fmt::formatter<ZMode>
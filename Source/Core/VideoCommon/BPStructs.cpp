@@ -37,6 +37,7 @@
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -88,6 +89,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
           bp.address == BPMEM_TEXINVALIDATE || bp.address == BPMEM_PRELOAD_MODE ||
           bp.address == BPMEM_CLEAR_PIXEL_PERF))
     {
+      INCSTAT(g_stats.this_frame.num_redundant_state_writes);
       return;
     }
   }
@@ -306,6 +308,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
       // bpmem.zcontrol.pixel_format to PixelFormat::Z24 is when the game wants to copy from ZBuffer
       // (Zbuffer uses 24-bit Format)
       bool is_depth_copy = bpmem.zcontrol.pixel_format == PixelFormat::Z24;
+      g_vertex_manager->OnEFBRead();
       g_texture_cache->CopyRenderTargetToTexture(
           destAddr, PE_copy.tp_realFormat(), copy_width, copy_height, destStride, is_depth_copy,
           srcRect, PE_copy.intensity_fmt && PE_copy.auto_conv, PE_copy.half_scale, 1.0f,
@@ -335,11 +338,18 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
                     destAddr, srcRect.left, srcRect.top, srcRect.right, srcRect.bottom,
                     bpmem.copyTexSrcWH.x + 1, destStride, height, yScale);
 
-      bool is_depth_copy = bpmem.zcontrol.pixel_format == PixelFormat::Z24;
-      g_texture_cache->CopyRenderTargetToTexture(
-          destAddr, EFBCopyFormat::XFB, copy_width, height, destStride, is_depth_copy, srcRect,
-          false, false, yScale, s_gammaLUT[PE_copy.gamma], bpmem.triggerEFBCopy.clamp_top,
-          bpmem.triggerEFBCopy.clamp_bottom, bpmem.copyfilter.GetCoefficients());
+      // The XFB copy of a skipped frame is only displayed, so the previous one is shown again
+      // instead. If it's copied to RAM, the game may read it, so frames aren't skipped then.
+      if (!g_ActiveConfig.bSkipXFBCopyToRam)
+        g_vertex_manager->OnEFBRead();
+      if (!g_vertex_manager->IsSkippingFrame() || !g_ActiveConfig.bSkipXFBCopyToRam)
+      {
+        bool is_depth_copy = bpmem.zcontrol.pixel_format == PixelFormat::Z24;
+        g_texture_cache->CopyRenderTargetToTexture(
+            destAddr, EFBCopyFormat::XFB, copy_width, height, destStride, is_depth_copy, srcRect,
+            false, false, yScale, s_gammaLUT[PE_copy.gamma], bpmem.triggerEFBCopy.clamp_top,
+            bpmem.triggerEFBCopy.clamp_bottom, bpmem.copyfilter.GetCoefficients());
+      }
 
       // This is as closest as we have to an "end of the frame"
       // It works 99% of the time.
@@ -413,6 +423,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     if (OpcodeDecoder::g_record_fifo_data)
       system.GetFifoRecorder().UseMemory(addr, tmem_transfer_count, MemoryUpdate::Type::TMEM);
 
+    TMEM::Overwritten(tmem_addr, tmem_transfer_count);
     TMEM::InvalidateAll();
 
     return;
@@ -606,6 +617,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
           auto& system = Core::System::GetInstance();
           auto& memory = system.GetMemory();
           memory.CopyFromEmu(s_tex_mem.data() + tmem_addr_even, src_addr, bytes_read);
+          TMEM::Preloaded(tmem_addr_even, bytes_read);
         }
       }
       else  // RGBA8 tiles (and CI14, but that might just be stupid libogc!)
@@ -616,6 +628,8 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
         // AR and GB tiles are stored in separate TMEM banks => can't use a single memcpy for
         // everything
         u32 tmem_addr_odd = tmem_cfg.preload_tmem_odd * TMEM_LINE_SIZE;
+        const u32 tmem_start_even = tmem_addr_even;
+        const u32 tmem_start_odd = tmem_addr_odd;
 
         for (u32 i = 0; i < tmem_cfg.preload_tile_info.count; ++i)
         {
@@ -633,6 +647,10 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
           tmem_addr_odd += TMEM_LINE_SIZE;
           bytes_read += TMEM_LINE_SIZE * 2;
         }
+
+        // If the banks overlap, the second preload forgets the first one.
+        TMEM::Preloaded(tmem_start_even, tmem_addr_even - tmem_start_even);
+        TMEM::Preloaded(tmem_start_odd, tmem_addr_odd - tmem_start_odd);
       }
 
       if (OpcodeDecoder::g_record_fifo_data)
@@ -60,16 +60,62 @@ void BoundingBox::Readback()
   if (!g_backend_info.bSupportsBBox)
     return;
 
-  auto read_values = Read(0, NUM_BBOX_VALUES);
+  const u32 latency =
+      std::min<u32>(std::max(g_ActiveConfig.iBBoxReadbackLatency, 0), MAX_QUEUED_READBACKS);
+  if (latency == 0 || !ReadbackQueued(latency))
+    ApplyReadValues(Read(0, NUM_BBOX_VALUES));
 
+  m_is_valid = true;
+}
+
+bool BoundingBox::ReadbackQueued(u32 latency)
+{
+  // Pick up the newest values which have already arrived. If the ring is full, the oldest
+  // readback has to be waited for to make room, which bounds how stale the values can get.
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> read_values;
+  while (m_num_queued_readbacks > 0)
+  {
+    auto values = ReadQueued(m_queued_readback_start, m_num_queued_readbacks >= latency);
+    if (!values)
+      break;
+
+    read_values = values;
+    m_queued_readback_start = (m_queued_readback_start + 1) % MAX_QUEUED_READBACKS;
+    m_num_queued_readbacks--;
+  }
+
+  const u32 slot = (m_queued_readback_start + m_num_queued_readbacks) % MAX_QUEUED_READBACKS;
+  if (!QueueRead(slot))
+    return false;
+  m_num_queued_readbacks++;
+
+  // The first read has nothing to fall back on, so it has to wait.
+  if (!read_values && !m_has_queued_values)
+  {
+    read_values = ReadQueued(slot, true);
+    m_queued_readback_start = (m_queued_readback_start + 1) % MAX_QUEUED_READBACKS;
+    m_num_queued_readbacks--;
+  }
+
+  // Otherwise the game continues with the values from the previous read until the new ones
+  // arrive, trading accuracy for not stalling on the GPU.
+  if (read_values)
+  {
+    ApplyReadValues(*read_values);
+    m_has_queued_values = true;
+  }
+
+  return true;
+}
+
+void BoundingBox::ApplyReadValues(std::span<const BBoxType> values)
+{
   // Preserve dirty values, that way we don't need to sync.
   for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
   {
     if (!m_dirty[i])
-      m_values[i] = read_values[i];
+      m_values[i] = values[i];
   }
-
-  m_is_valid = true;
 }
 
 u16 BoundingBox::Get(u32 index)
@@ -120,6 +166,11 @@ void BoundingBox::DoState(PointerWrap& p)
   {
     p.Do(backend_values);
 
+    // Queued readbacks hold values from before the state was loaded.
+    m_queued_readback_start = 0;
+    m_num_queued_readbacks = 0;
+    m_has_queued_values = false;
+
     if (g_backend_info.bSupportsBBox)
       Write(0, backend_values);
   }
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -37,12 +38,26 @@ public:
   // otherwise unexpected exceptions can occur
   virtual bool Initialize() = 0;
 
+  // Number of readbacks which can be in flight when a readback latency is configured.
+  static constexpr u32 MAX_QUEUED_READBACKS = 4;
+
 protected:
   virtual std::vector<BBoxType> Read(u32 index, u32 length) = 0;
   virtual void Write(u32 index, std::span<const BBoxType> values) = 0;
 
+  // Asynchronous readback. QueueRead copies the current values into the given slot without
+  // waiting for the GPU, and returns false if the backend can't do that. ReadQueued returns the
+  // values once the copy has completed, or std::nullopt if it hasn't and wait is false.
+  virtual bool QueueRead(u32 slot) { return false; }
+  virtual std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> ReadQueued(u32 slot, bool wait)
+  {
+    return std::nullopt;
+  }
+
 private:
   void Readback();
+  bool ReadbackQueued(u32 latency);
+  void ApplyReadValues(std::span<const BBoxType> values);
 
   bool m_is_active = false;
 
@@ -50,6 +65,11 @@ private:
   std::array<bool, NUM_BBOX_VALUES> m_dirty = {};
   bool m_is_valid = true;
 
+  // Ring of readbacks which are in flight, oldest first.
+  u32 m_queued_readback_start = 0;
+  u32 m_num_queued_readbacks = 0;
+  bool m_has_queued_values = false;
+
   // Nintendo's SDK seems to write "default" bounding box values before every draw (1023 0 1023 0
   // are the only values encountered so far, which happen to be the extents allowed by the BP
   // registers) to reset the registers for comparison in the pixel engine, and presumably to detect
@@ -200,6 +200,34 @@ void CPState::LoadCPReg(u8 sub_cmd, u32 value)
   }
 }
 
+bool CPState::IsRedundantWrite(u8 sub_cmd, u32 value) const
+{
+  switch (sub_cmd & CP_COMMAND_MASK)
+  {
+  case MATINDEX_A:
+    return sub_cmd == MATINDEX_A && matrix_index_a.Hex == value;
+  case MATINDEX_B:
+    return sub_cmd == MATINDEX_B && matrix_index_b.Hex == value;
+  case VCD_LO:
+    return sub_cmd == VCD_LO && vtx_desc.low.Hex == value;
+  case VCD_HI:
+    return sub_cmd == VCD_HI && vtx_desc.high.Hex == value;
+  case CP_VAT_REG_A:
+    return vtx_attr[sub_cmd & CP_VAT_MASK].g0.Hex == value;
+  case CP_VAT_REG_B:
+    return vtx_attr[sub_cmd & CP_VAT_MASK].g1.Hex == value;
+  case CP_VAT_REG_C:
+    return vtx_attr[sub_cmd & CP_VAT_MASK].g2.Hex == value;
+  case ARRAY_BASE:
+    return array_bases[static_cast<CPArray>(sub_cmd & CP_ARRAY_MASK)] ==
+           (value & CommandProcessor::GetPhysicalAddressMask(Core::System::GetInstance().IsWii()));
+  case ARRAY_STRIDE:
+    return array_strides[static_cast<CPArray>(sub_cmd & CP_ARRAY_MASK)] == (value & 0xFF);
+  default:
+    return false;
+  }
+}
+
 void CPState::FillCPMemoryArray(u32* memory) const
 {
   memory[MATINDEX_A] = matrix_index_a.Hex;
@@ -748,6 +748,8 @@ struct CPState final
 
   // Mutates the CP state based on the given command and value.
   void LoadCPReg(u8 sub_cmd, u32 value);
+  // Whether LoadCPReg would leave the state as it is.
+  bool IsRedundantWrite(u8 sub_cmd, u32 value) const;
   // Fills memory with data from CP regs.  There should be space for 0x100 values in memory.
   void FillCPMemoryArray(u32* memory) const;
 
@@ -3,10 +3,14 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Thread.h"
 #include "Core/System.h"
 
 #include "VideoCommon/CPMemory.h"
@@ -54,10 +58,14 @@
 #include "VideoCommon/CPUCullImpl.h"
 #define USE_FMA
 #include "VideoCommon/CPUCullImpl.h"
+#define USE_AVX512
+#include "VideoCommon/CPUCullImpl.h"
 #endif
 
 #if defined(USE_SSE)
-#if defined(__AVX__) && defined(__FMA__)
+#if defined(__AVX512F__)
+static constexpr int MIN_SSE = 60;
+#elif defined(__AVX__) && defined(__FMA__)
 static constexpr int MIN_SSE = 51;
 #elif defined(__AVX__)
 static constexpr int MIN_SSE = 50;
@@ -74,7 +82,9 @@ template <bool PositionHas3Elems, bool PerVertexPosMtx>
 static CPUCull::TransformFunction GetTransformFunction()
 {
 #if defined(USE_SSE)
-  if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
+  if (MIN_SSE >= 60 || (cpu_info.bAVX512F && cpu_info.bFMA))
+    return CPUCull_AVX512::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
+  else if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
     return CPUCull_FMA::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
   else if (MIN_SSE >= 50 || cpu_info.bAVX)
     return CPUCull_AVX::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
@@ -121,7 +131,38 @@ static Common::EnumMap<CPUCull::CullFunction, CullMode::All> GetCullFunction1()
   };
 }
 
-CPUCull::~CPUCull() = default;
+template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
+static CPUCull::VisibleFunction GetVisibleFunction0()
+{
+#if defined(USE_SSE)
+  if (MIN_SSE >= 50 || cpu_info.bAVX)
+    return CPUCull_AVX::GetVisibleTriangles<Primitive, Mode>;
+  else if (MIN_SSE >= 30 || cpu_info.bSSE3)
+    return CPUCull_SSE3::GetVisibleTriangles<Primitive, Mode>;
+  else
+    return CPUCull_SSE::GetVisibleTriangles<Primitive, Mode>;
+#elif defined(USE_NEON)
+  return CPUCull_NEON::GetVisibleTriangles<Primitive, Mode>;
+#else
+  return CPUCull_Scalar::GetVisibleTriangles<Primitive, Mode>;
+#endif
+}
+
+template <OpcodeDecoder::Primitive Primitive>
+static Common::EnumMap<CPUCull::VisibleFunction, CullMode::All> GetVisibleFunction1()
+{
+  return {
+      GetVisibleFunction0<Primitive, CullMode::None>(),
+      GetVisibleFunction0<Primitive, CullMode::Back>(),
+      GetVisibleFunction0<Primitive, CullMode::Front>(),
+      GetVisibleFunction0<Primitive, CullMode::All>(),
+  };
+}
+
+CPUCull::~CPUCull()
+{
+  StopWorkers();
+}
 
 void CPUCull::Init()
 {
@@ -135,6 +176,12 @@ void CPUCull::Init()
   m_cull_table[Prim::GX_DRAW_TRIANGLES] = GetCullFunction1<Prim::GX_DRAW_TRIANGLES>();
   m_cull_table[Prim::GX_DRAW_TRIANGLE_STRIP] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_STRIP>();
   m_cull_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
+  m_visible_table[Prim::GX_DRAW_QUADS] = GetVisibleFunction1<Prim::GX_DRAW_QUADS>();
+  m_visible_table[Prim::GX_DRAW_QUADS_2] = GetVisibleFunction1<Prim::GX_DRAW_QUADS>();
+  m_visible_table[Prim::GX_DRAW_TRIANGLES] = GetVisibleFunction1<Prim::GX_DRAW_TRIANGLES>();
+  m_visible_table[Prim::GX_DRAW_TRIANGLE_STRIP] =
+      GetVisibleFunction1<Prim::GX_DRAW_TRIANGLE_STRIP>();
+  m_visible_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetVisibleFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
 }
 
 bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
@@ -142,6 +189,30 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
 {
   ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
              "CPUCull should not be called on lines or points");
+  const CullMode cull_mode = TransformVertices(loader, src, count);
+  const CullFunction cull = m_cull_table[primitive][cull_mode];
+  return cull(m_transform_buffer.get(), count);
+}
+
+std::span<const u16> CPUCull::GetVisibleTriangles(VertexLoaderBase* loader,
+                                                  OpcodeDecoder::Primitive primitive,
+                                                  const u8* src, u32 count)
+{
+  ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
+             "CPUCull should not be called on lines or points");
+  const CullMode cull_mode = TransformVertices(loader, src, count);
+
+  // No primitive has more triangles than vertices
+  if (m_visible_triangles.size() < count * 3)
+    m_visible_triangles.resize(count * 3);
+
+  const VisibleFunction visible = m_visible_table[primitive][cull_mode];
+  const u32 num_indices = visible(m_transform_buffer.get(), count, m_visible_triangles.data());
+  return std::span(m_visible_triangles).first(num_indices);
+}
+
+CullMode CPUCull::TransformVertices(VertexLoaderBase* loader, const u8* src, u32 count)
+{
   const u32 stride = loader->m_native_vtx_decl.stride;
   const bool posHas3Elems = loader->m_native_vtx_decl.position.components >= 3;
   const bool perVertexPosMtx = loader->m_native_vtx_decl.posmtx.enable;
@@ -164,9 +235,89 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cull_mode = cullmode_invert[cull_mode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
-  transform(m_transform_buffer.get(), src, stride, count);
-  const CullFunction cull = m_cull_table[primitive][cull_mode];
-  return cull(m_transform_buffer.get(), count);
+
+  UpdateWorkers();
+  if (m_workers.empty() || count < MIN_PARALLEL_VERTICES)
+  {
+    transform(m_transform_buffer.get(), src, stride, count);
+    return cull_mode;
+  }
+
+  // Keep the parts a multiple of 4 vertices, so that every thread uses the widest SIMD path
+  const u32 num_parts = static_cast<u32>(m_workers.size()) + 1;
+  m_work = {transform, src, stride, count, Common::AlignUp((count + num_parts - 1) / num_parts, 4)};
+  {
+    std::lock_guard lk(m_worker_mutex);
+    m_busy_workers = static_cast<u32>(m_workers.size());
+    ++m_work_generation;
+  }
+  m_work_available.notify_all();
+
+  TransformPart(0);
+
+  std::unique_lock lk(m_worker_mutex);
+  m_work_done.wait(lk, [this] { return m_busy_workers == 0; });
+  return cull_mode;
+}
+
+void CPUCull::TransformPart(u32 part)
+{
+  const u32 first = part * m_work.part_size;
+  if (first >= m_work.count)
+    return;
+
+  const u32 count = std::min(m_work.part_size, m_work.count - first);
+  m_work.transform(m_transform_buffer.get() + first, m_work.src + first * m_work.stride,
+                   m_work.stride, count);
+}
+
+void CPUCull::UpdateWorkers()
+{
+  const u32 num_workers = std::clamp(g_ActiveConfig.iCPUCullThreads, 1, MAX_THREADS) - 1;
+  if (num_workers == m_workers.size()) [[likely]]
+    return;
+
+  StopWorkers();
+  m_exit_workers = false;
+  for (u32 i = 0; i < num_workers; ++i)
+    m_workers.emplace_back(&CPUCull::WorkerThread, this, i + 1, m_work_generation);
+}
+
+void CPUCull::StopWorkers()
+{
+  {
+    std::lock_guard lk(m_worker_mutex);
+    m_exit_workers = true;
+  }
+  m_work_available.notify_all();
+  for (std::thread& worker : m_workers)
+    worker.join();
+  m_workers.clear();
+}
+
+void CPUCull::WorkerThread(u32 part, u64 last_generation)
+{
+  Common::SetCurrentThreadName("CPUCull Worker");
+
+  while (true)
+  {
+    {
+      std::unique_lock lk(m_worker_mutex);
+      m_work_available.wait(lk,
+                            [&] { return m_exit_workers || m_work_generation != last_generation; });
+      if (m_exit_workers)
+        return;
+      last_generation = m_work_generation;
+    }
+
+    TransformPart(part);
+
+    {
+      std::lock_guard lk(m_worker_mutex);
+      --m_busy_workers;
+    }
+    m_work_done.notify_one();
+  }
 }
 
 template <typename T>
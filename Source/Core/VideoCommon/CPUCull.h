@@ -3,6 +3,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -15,6 +21,12 @@ public:
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
 
+  // Culls each triangle of the primitive separately, and returns the ones which are still visible
+  // as triples of vertex indices. The result is valid until the next call.
+  std::span<const u16> GetVisibleTriangles(VertexLoaderBase* loader,
+                                           OpcodeDecoder::Primitive primitive, const u8* src,
+                                           u32 count);
+
   struct alignas(16) TransformedVertex
   {
     float x, y, z, w;
@@ -22,8 +34,20 @@ public:
 
   using TransformFunction = void (*)(void*, const void*, u32, int);
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
+  using VisibleFunction = u32 (*)(const CPUCull::TransformedVertex*, int, u16*);
 
 private:
+  // Draws with fewer vertices than this are transformed on the calling thread, since waking up
+  // the workers would take longer than the transform itself.
+  static constexpr u32 MIN_PARALLEL_VERTICES = 8192;
+  static constexpr int MAX_THREADS = 8;
+
+  CullMode TransformVertices(VertexLoaderBase* loader, const u8* src, u32 count);
+  void TransformPart(u32 part);
+  void UpdateWorkers();
+  void StopWorkers();
+  void WorkerThread(u32 part, u64 last_generation);
+
   template <typename T>
   struct BufferDeleter
   {
@@ -35,4 +59,27 @@ private:
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
       m_cull_table{};
+  Common::EnumMap<Common::EnumMap<VisibleFunction, CullMode::All>,
+                  OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
+      m_visible_table{};
+  std::vector<u16> m_visible_triangles;
+
+  // Large draws have their vertices split into one part per thread, with the calling thread
+  // transforming the first part.
+  struct TransformWork
+  {
+    TransformFunction transform;
+    const u8* src;
+    u32 stride;
+    u32 count;
+    u32 part_size;
+  };
+  TransformWork m_work{};
+  std::vector<std::thread> m_workers;
+  std::mutex m_worker_mutex;
+  std::condition_variable m_work_available;
+  std::condition_variable m_work_done;
+  u64 m_work_generation = 0;
+  u32 m_busy_workers = 0;
+  bool m_exit_workers = false;
 };
@@ -1,7 +1,9 @@
 // Copyright 2022 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#if defined(USE_FMA)
+#if defined(USE_AVX512)
+#define VECTOR_NAMESPACE CPUCull_AVX512
+#elif defined(USE_FMA)
 #define VECTOR_NAMESPACE CPUCull_FMA
 #elif defined(USE_AVX)
 #define VECTOR_NAMESPACE CPUCull_AVX
@@ -19,7 +21,9 @@
 #error This file is meant to be used by CPUCull.cpp only!
 #endif
 
-#if defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
+#if defined(__GNUC__) && defined(USE_AVX512) && !defined(__AVX512F__)
+#define ATTR_TARGET __attribute__((target("avx512f,avx,fma")))
+#elif defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
 #define ATTR_TARGET __attribute__((target("avx,fma")))
 #elif defined(__GNUC__) && defined(USE_AVX) && !defined(__AVX__)
 #define ATTR_TARGET __attribute__((target("avx")))
@@ -72,6 +76,13 @@ ATTR_TARGET DOLPHIN_FORCE_INLINE static __m256 vector_broadcast(__m256 v)
   return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i));
 }
 #endif
+#ifdef USE_AVX512
+template <int i>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 vector_broadcast(__m512 v)
+{
+  return _mm512_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i));
+}
+#endif
 
 #ifdef USE_AVX
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void TransposeYMM(__m256& o0, __m256& o1,  //
@@ -236,6 +247,46 @@ LoadTransform2Vertices(const u8* v0data, const u8* v1data,                  //
 
 #endif
 
+#ifdef USE_AVX512
+// Takes a YMM register holding the same vector in both halves
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 BroadcastZMM(__m256 v)
+{
+  return _mm512_broadcast_f32x4(_mm256_castps256_ps128(v));
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m128 LoadPosition(const u8* data)
+{
+  if constexpr (PositionHas3Elems)
+    return _mm_loadu_ps(reinterpret_cast<const float*>(data));
+  else
+    return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(data));
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 LoadTransform4Vertices(
+    const u8* data, u32 stride, __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+    __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  __m512 v = _mm512_castps128_ps512(LoadPosition<PositionHas3Elems>(data));
+  v = _mm512_insertf32x4(v, LoadPosition<PositionHas3Elems>(data + stride), 1);
+  v = _mm512_insertf32x4(v, LoadPosition<PositionHas3Elems>(data + stride * 2), 2);
+  v = _mm512_insertf32x4(v, LoadPosition<PositionHas3Elems>(data + stride * 3), 3);
+
+  __m512 output = pos3;  // vertex.w is always 1.0
+  output = _mm512_fmadd_ps(vector_broadcast<0>(v), pos0, output);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(v), pos1, output);
+  if constexpr (PositionHas3Elems)
+    output = _mm512_fmadd_ps(vector_broadcast<2>(v), pos2, output);
+
+  __m512 result = _mm512_mul_ps(vector_broadcast<0>(output), proj0);
+  result = _mm512_fmadd_ps(vector_broadcast<1>(output), proj1, result);
+  result = _mm512_fmadd_ps(vector_broadcast<2>(output), proj2, result);
+  result = _mm512_fmadd_ps(vector_broadcast<3>(output), proj3, result);
+  return result;
+}
+#endif
+
 #ifndef USE_AVX
 // Note: Assumes 16-byte aligned source
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposed(const void* source, Vector& o0,
@@ -517,6 +568,25 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
   __m256 pos0, pos1, pos2, pos3;
   LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
   LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
+#ifdef USE_AVX512
+  // With a per-vertex position matrix, each vertex needs its own matrix gathered, which doesn't
+  // get any faster with wider vectors. The remaining vertices go through the AVX loop.
+  if constexpr (!PerVertexPosMtx)
+  {
+    const __m512 zproj0 = BroadcastZMM(proj0), zproj1 = BroadcastZMM(proj1);
+    const __m512 zproj2 = BroadcastZMM(proj2), zproj3 = BroadcastZMM(proj3);
+    const __m512 zpos0 = BroadcastZMM(pos0), zpos1 = BroadcastZMM(pos1);
+    const __m512 zpos2 = BroadcastZMM(pos2), zpos3 = BroadcastZMM(pos3);
+    for (; count >= 4; count -= 4)
+    {
+      __m512 v0123 = LoadTransform4Vertices<PositionHas3Elems>(
+          cvertices, stride, zpos0, zpos1, zpos2, zpos3, zproj0, zproj1, zproj2, zproj3);
+      _mm512_storeu_ps(reinterpret_cast<float*>(voutput), v0123);
+      cvertices += stride * 4;
+      voutput += 4;
+    }
+  }
+#endif
   for (int i = 1; i < count; i += 2)
   {
     const u8* v0data = cvertices;
@@ -708,6 +778,64 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
   return true;
 }
 
+template <CullMode Mode>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static u16* AddTriangleIfVisible(
+    u16* output, const CPUCull::TransformedVertex* transformed, u32 a, u32 b, u32 c)
+{
+  if (!CullTriangle<Mode>(transformed[a], transformed[b], transformed[c]))
+  {
+    *output++ = static_cast<u16>(a);
+    *output++ = static_cast<u16>(b);
+    *output++ = static_cast<u16>(c);
+  }
+  return output;
+}
+
+// Triangles are visited in the same order and with the same winding as IndexGenerator uses when
+// converting the primitive to a triangle list.
+template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
+ATTR_TARGET static u32 GetVisibleTriangles(const CPUCull::TransformedVertex* transformed, int count,
+                                           u16* output)
+{
+  u16* const start = output;
+  switch (Primitive)
+  {
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
+  {
+    int i = 3;
+    for (; i < count; i += 4)
+    {
+      output = AddTriangleIfVisible<Mode>(output, transformed, i - 3, i - 2, i - 1);
+      output = AddTriangleIfVisible<Mode>(output, transformed, i - 3, i - 1, i - 0);
+    }
+    if (i == count)
+      output = AddTriangleIfVisible<Mode>(output, transformed, i - 3, i - 2, i - 1);
+    break;
+  }
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
+    for (int i = 2; i < count; i += 3)
+      output = AddTriangleIfVisible<Mode>(output, transformed, i - 2, i - 1, i - 0);
+    break;
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
+  {
+    bool wind = false;
+    for (int i = 2; i < count; ++i)
+    {
+      output = AddTriangleIfVisible<Mode>(output, transformed, i - 2, i - !wind, i - wind);
+      wind = !wind;
+    }
+    break;
+  }
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
+    for (int i = 2; i < count; ++i)
+      output = AddTriangleIfVisible<Mode>(output, transformed, 0, i - 1, i);
+    break;
+  }
+
+  return static_cast<u32>(output - start);
+}
+
 }  // namespace VECTOR_NAMESPACE
 
 #undef ATTR_TARGET
@@ -103,6 +103,11 @@ struct alignas(16) VertexShaderConstants
   u32 vertex_offset_posmtx;
   std::array<u32, 2> vertex_offset_colors;
   std::array<u32, 8> vertex_offset_texcoords;
+  // For GPU vertex pulling, indexed by CPArray
+  std::array<uint4, 3> pulled_array_base;
+  std::array<uint4, 3> pulled_array_stride;
+  // [0].x - position, [0].y to [2].z - texture coordinates
+  std::array<float4, 3> pulled_frac_scale;
 };
 
 enum class VSExpand : u32
@@ -15,9 +15,11 @@
 #include "Core/System.h"
 
 #include "VideoCommon/AsyncRequests.h"
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -67,6 +69,8 @@ u32 EFBInterfaceBase::PeekColor(u16 x, u16 y)
   if (ShouldSkipAccess(x, y))
     return 0;
 
+  g_vertex_manager->OnEFBRead();
+  Core::System::GetInstance().GetFifo().SyncGPU(Fifo::SyncGPUReason::EFBPeek);
   u32 color = PeekColorInternal(x, y);
 
   // check what to do with the alpha channel (GX_PokeAlphaRead)
@@ -127,6 +131,8 @@ u32 EFBInterfaceBase::PeekDepth(u16 x, u16 y)
   if (ShouldSkipAccess(x, y))
     return 0;
 
+  g_vertex_manager->OnEFBRead();
+  Core::System::GetInstance().GetFifo().SyncGPU(Fifo::SyncGPUReason::EFBPeek);
   return PeekDepthInternal(x, y);
 }
 
@@ -140,6 +146,7 @@ void HardwareEFBInterface::PokeColor(u16 x, u16 y, u32 poke_data)
   const u32 color =
       ((poke_data & 0xFF00FF00) | ((poke_data >> 16) & 0xFF) | ((poke_data << 16) & 0xFF0000));
 
+  Core::System::GetInstance().GetFifo().SyncGPU(Fifo::SyncGPUReason::EFBPoke);
   AsyncRequests::GetInstance()->PushEvent([x, y, color] {
     INCSTAT(g_stats.this_frame.num_efb_pokes);
     g_framebuffer_manager->PokeEFBColor(x, y, color);
@@ -156,6 +163,7 @@ void HardwareEFBInterface::PokeDepth(u16 x, u16 y, u32 poke_data)
   if (!g_backend_info.bSupportsReversedDepthRange)
     depth = 1.0f - depth;
 
+  Core::System::GetInstance().GetFifo().SyncGPU(Fifo::SyncGPUReason::EFBPoke);
   AsyncRequests::GetInstance()->PushEvent([x, y, depth] {
     INCSTAT(g_stats.this_frame.num_efb_pokes);
     g_framebuffer_manager->PokeEFBDepth(x, y, depth);
@@ -13,6 +13,7 @@
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Trace.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -28,6 +29,7 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -36,6 +38,9 @@ namespace Fifo
 {
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
 
+// Upper bound for how long the GPU thread spins for new commands before it goes to sleep
+static constexpr std::chrono::microseconds GPU_THREAD_MAX_SPIN{200};
+
 FifoManager::FifoManager(Core::System& system) : m_system{system}
 {
 }
@@ -61,6 +66,7 @@ void FifoManager::DoState(PointerWrap& p)
   {
     // We're good and paused, right?
     m_video_buffer_seen_ptr = m_video_buffer_pp_read_ptr = m_video_buffer_read_ptr;
+    m_video_buffer_swap_ptr = nullptr;
   }
 
   p.Do(m_sync_ticks);
@@ -150,10 +156,27 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
-    m_gpu_mainloop.Wait();
+    // The CP and PE state which the CPU can read is emulated while preprocessing, so only reading
+    // back what the GPU thread renders (EFB peeks, bounding box, perf queries) and making space in
+    // the buffers depend on it catching up. At swaps and register accesses, the buffers are only
+    // compacted if it happens to be idle.
+    if (reason == SyncGPUReason::Swap || reason == SyncGPUReason::RegisterAccess)
+    {
+      if (!m_gpu_mainloop.IsDone())
+        return;
+    }
+    else
+    {
+      WaitForGpuLoop();
+    }
     if (!m_gpu_mainloop.IsRunning())
       return;
 
+    // The GPU thread has processed everything, including the last frame.
+    m_video_buffer_swap_ptr = nullptr;
+    if (m_pending_swap)
+      AsyncRequests::GetInstance()->PushEvent(std::move(m_pending_swap));
+
     // Opportunistically reset FIFOs so we don't wrap around.
     if (may_move_read_ptr && m_fifo_aux_write_ptr != m_fifo_aux_read_ptr)
     {
@@ -184,6 +207,28 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
   }
 }
 
+void FifoManager::PushSwapEvent(Common::MoveOnlyFunction<void()> swap)
+{
+  if (!m_use_deterministic_gpu_thread)
+  {
+    AsyncRequests::GetInstance()->PushEvent(std::move(swap));
+    return;
+  }
+
+  // The GPU thread runs the events it gets before the commands which it hasn't seen yet, so the
+  // swap is held back until it has processed the frame. Waiting for that at the next swap lets it
+  // stay up to a frame behind instead of syncing every frame.
+  if (m_pending_swap)
+  {
+    WaitForGpuProgress(m_video_buffer_swap_ptr);
+    AsyncRequests::GetInstance()->PushEvent(std::move(m_pending_swap));
+  }
+  m_video_buffer_swap_ptr = m_video_buffer_write_ptr;
+  m_pending_swap = std::move(swap);
+
+  SyncGPU(SyncGPUReason::Swap);
+}
+
 void FifoManager::PushFifoAuxBuffer(const void* ptr, size_t size)
 {
   if (size > (size_t)(m_fifo_aux_data + FIFO_SIZE - m_fifo_aux_write_ptr))
@@ -279,6 +324,7 @@ void FifoManager::ResetVideoBuffer()
   m_video_buffer_write_ptr = m_video_buffer;
   m_video_buffer_seen_ptr = m_video_buffer;
   m_video_buffer_pp_read_ptr = m_video_buffer;
+  m_video_buffer_swap_ptr = nullptr;
   m_fifo_aux_write_ptr = m_fifo_aux_data;
   m_fifo_aux_read_ptr = m_fifo_aux_data;
 }
@@ -290,8 +336,11 @@ void FifoManager::RunGpuLoop()
   AsyncRequests::GetInstance()->SetEnable(true);
   AsyncRequests::GetInstance()->SetPassthrough(false);
 
+  m_gpu_mainloop.SetAdaptiveSpin(GPU_THREAD_MAX_SPIN);
   m_gpu_mainloop.Run(
       [this] {
+        g_perf_metrics.CountGPUIdle(m_gpu_mainloop.TakeIdleTime());
+
         // Run events from the CPU thread.
         AsyncRequests::GetInstance()->PullEvents();
 
@@ -299,6 +348,8 @@ void FifoManager::RunGpuLoop()
         if (!m_emu_running_state.IsSet())
           return;
 
+        TRACE_SCOPE("Fifo::RunGpuLoop");
+
         if (m_use_deterministic_gpu_thread)
         {
           // All the fifo/CP stuff is on the CPU.  We just need to run the opcode decoder.
@@ -310,6 +361,8 @@ void FifoManager::RunGpuLoop()
             m_video_buffer_read_ptr =
                 OpcodeDecoder::RunFifo(DataReader(m_video_buffer_read_ptr, write_ptr), nullptr);
             m_video_buffer_seen_ptr = write_ptr;
+            if (m_waiting_for_gpu_progress)
+              m_gpu_progress_event.Set();
           }
         }
         else
@@ -401,7 +454,34 @@ void FifoManager::FlushGpu()
   if (!m_system.IsDualCoreMode() || m_use_deterministic_gpu_thread)
     return;
 
+  WaitForGpuLoop();
+}
+
+void FifoManager::WaitForGpuLoop()
+{
+  if (m_gpu_mainloop.IsDone())
+    return;
+
+  const TimePoint wait_start = Clock::now();
   m_gpu_mainloop.Wait();
+  g_perf_metrics.CountCPUWait(Clock::now() - wait_start);
+}
+
+// The deterministic_gpu_thread version. Waits until the GPU thread has processed the video buffer
+// up to the target.
+void FifoManager::WaitForGpuProgress(const u8* target)
+{
+  if (m_video_buffer_seen_ptr >= target || m_gpu_mainloop.IsDone())
+    return;
+
+  const TimePoint wait_start = Clock::now();
+  m_waiting_for_gpu_progress = true;
+  // The timeout covers the GPU thread finishing without passing the target, which can't happen
+  // before it's done with all its work.
+  while (m_video_buffer_seen_ptr < target && !m_gpu_mainloop.IsDone())
+    m_gpu_progress_event.WaitFor(std::chrono::milliseconds(1));
+  m_waiting_for_gpu_progress = false;
+  g_perf_metrics.CountCPUWait(Clock::now() - wait_start);
 }
 
 void FifoManager::GpuMaySleep()
@@ -529,6 +609,7 @@ void FifoManager::UpdateWantDeterminism(bool want)
     {
       // These haven't been updated in non-deterministic mode.
       m_video_buffer_seen_ptr = m_video_buffer_pp_read_ptr = m_video_buffer_read_ptr;
+      m_video_buffer_swap_ptr = nullptr;
       CopyPreprocessCPStateFromMain();
       VertexLoaderManager::MarkAllDirty();
     }
@@ -559,7 +640,11 @@ int FifoManager::WaitForGpuThread(int ticks)
 
   // Wait for GPU
   if (now >= m_config_sync_gpu_max_distance)
+  {
+    const TimePoint wait_start = Clock::now();
     m_sync_wakeup_event.Wait();
+    g_perf_metrics.CountCPUWait(Clock::now() - wait_start);
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -586,7 +671,7 @@ void FifoManager::SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLat
 
 void FifoManager::SyncGPUForRegisterAccess()
 {
-  SyncGPU(SyncGPUReason::Other);
+  SyncGPU(SyncGPUReason::RegisterAccess);
 
   if (!m_system.IsDualCoreMode() || m_use_deterministic_gpu_thread)
     RunGpuOnCpu(GPU_TIME_SLOT_SIZE);
@@ -12,6 +12,7 @@
 #include "Common/Config/Config.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/Functional.h"
 
 class PointerWrap;
 
@@ -26,11 +27,14 @@ struct EventType;
 
 namespace Fifo
 {
-// Used for diagnostics.
+// In deterministic GPU thread mode, this decides whether the CPU thread has to wait for the GPU
+// thread to catch up.
 enum class SyncGPUReason
 {
   Other,
+  RegisterAccess,
   Wraparound,
+  EFBPeek,
   EFBPoke,
   PerfQuery,
   BBox,
@@ -57,13 +61,18 @@ public:
   bool UseDeterministicGPUThread() const { return m_use_deterministic_gpu_thread; }
   bool UseSyncGPU() const { return m_config_sync_gpu; }
 
-  // In deterministic GPU thread mode this waits for the GPU to be done with pending work.
+  // In deterministic GPU thread mode this waits for the GPU to be done with pending work, unless
+  // nothing the emulated CPU can observe depends on it.
   void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr = true);
 
   // In single core mode, this runs the GPU for a single slice.
   // In dual core mode, this synchronizes with the GPU thread.
   void SyncGPUForRegisterAccess();
 
+  // Passes an XFB swap to the GPU thread. In deterministic GPU thread mode, it's only passed once
+  // the GPU thread has caught up with the frame.
+  void PushSwapEvent(Common::MoveOnlyFunction<void()> swap);
+
   void PushFifoAuxBuffer(const void* ptr, size_t size);
   void* PopFifoAuxBuffer(size_t size);
 
@@ -81,6 +90,8 @@ private:
   void ReadDataFromFifoOnCPU(u32 read_ptr);
   int RunGpuOnCpu(int ticks);
   int WaitForGpuThread(int ticks);
+  void WaitForGpuLoop();
+  void WaitForGpuProgress(const u8* target);
   static void SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate);
 
   static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
@@ -117,6 +128,12 @@ private:
   // FIFO.  Maybe someday it will be under the lock.  For now, because RunGpuLoop
   // polls, it's just atomic.
   // - The pp_read_ptr is the CPU preprocessing version of the read_ptr.
+  // - The swap_ptr is the write_ptr at the last XFB swap, if the GPU thread may not have
+  // processed the frame yet. The swap is held in pending_swap until the GPU thread gets past it.
+  u8* m_video_buffer_swap_ptr = nullptr;
+  Common::MoveOnlyFunction<void()> m_pending_swap;
+  std::atomic<bool> m_waiting_for_gpu_progress = false;
+  Common::Event m_gpu_progress_event;
 
   std::atomic<int> m_sync_ticks = 0;
   bool m_syncing_suspended = false;
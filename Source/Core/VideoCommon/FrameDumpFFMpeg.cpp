@@ -10,6 +10,7 @@
 
 #include <array>
 #include <string>
+#include <vector>
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -18,6 +19,7 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavutil/error.h>
+#include <libavutil/hwcontext.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
 #include <libavutil/opt.h>
@@ -48,6 +50,9 @@ struct FrameDumpContext
   AVCodecContext* codec = nullptr;
   AVFrame* src_frame = nullptr;
   AVFrame* scaled_frame = nullptr;
+  // Only used by hardware encoders which need their input in a device's frames.
+  AVFrame* hw_frame = nullptr;
+  AVBufferRef* hw_device = nullptr;
   SwsContext* sws = nullptr;
 
   s64 last_pts = AV_NOPTS_VALUE;
@@ -162,6 +167,182 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+// Suffixes of the FFmpeg hardware encoders to try, in order, for the "Use Hardware Encoder"
+// setting. An encoder is skipped if this FFmpeg build lacks it or it has no device to run on.
+constexpr std::array<const char*, 5> HARDWARE_ENCODER_SUFFIXES = {"nvenc", "amf", "qsv", "vaapi",
+                                                                  "videotoolbox"};
+
+// Returns the list of pixel formats terminated by AV_PIX_FMT_NONE, or nullptr if unknown.
+const AVPixelFormat* GetSupportedPixelFormats(const AVCodec* codec)
+{
+#if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(61, 13, 100)
+  const void* formats = nullptr;
+  if (avcodec_get_supported_config(nullptr, codec, AV_CODEC_CONFIG_PIX_FORMAT, 0, &formats,
+                                   nullptr) < 0)
+  {
+    return nullptr;
+  }
+  return static_cast<const AVPixelFormat*>(formats);
+#else
+  return codec->pix_fmts;
+#endif
+}
+
+bool IsPixelFormatSupported(const AVPixelFormat* formats, AVPixelFormat pix_fmt)
+{
+  if (!formats)
+    return true;
+
+  for (; *formats != AV_PIX_FMT_NONE; ++formats)
+  {
+    if (*formats == pix_fmt)
+      return true;
+  }
+  return false;
+}
+
+// Creates a device and a pool of its frames for encoders which only take hardware frames,
+// e.g. VAAPI. Returns the software pixel format frames have to be uploaded from.
+AVPixelFormat SetUpHardwareFrames(FrameDumpContext& context, const AVCodec* codec,
+                                  const AVPixelFormat* formats)
+{
+  for (int i = 0; const AVCodecHWConfig* config = avcodec_get_hw_config(codec, i); ++i)
+  {
+    if (!(config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_FRAMES_CTX) ||
+        !IsPixelFormatSupported(formats, config->pix_fmt))
+    {
+      continue;
+    }
+
+    if (const int error =
+            av_hwdevice_ctx_create(&context.hw_device, config->device_type, nullptr, nullptr, 0))
+    {
+      WARN_LOG_FMT(FRAMEDUMP, "Could not create {} device: {}",
+                   av_hwdevice_get_type_name(config->device_type), AVErrorString(error));
+      continue;
+    }
+
+    AVBufferRef* frames_ref = av_hwframe_ctx_alloc(context.hw_device);
+    if (!frames_ref)
+      return AV_PIX_FMT_NONE;
+
+    auto* const frames = reinterpret_cast<AVHWFramesContext*>(frames_ref->data);
+    frames->format = config->pix_fmt;
+    frames->sw_format = AV_PIX_FMT_NV12;
+    frames->width = context.width;
+    frames->height = context.height;
+    frames->initial_pool_size = 4;
+    if (const int error = av_hwframe_ctx_init(frames_ref))
+    {
+      WARN_LOG_FMT(FRAMEDUMP, "Could not create hardware frames: {}", AVErrorString(error));
+      av_buffer_unref(&frames_ref);
+      return AV_PIX_FMT_NONE;
+    }
+
+    // The codec context takes ownership of the reference.
+    context.codec->hw_frames_ctx = frames_ref;
+    context.codec->pix_fmt = config->pix_fmt;
+    return frames->sw_format;
+  }
+
+  return AV_PIX_FMT_NONE;
+}
+
+// Allocates and opens an encoder context for codec. Returns the pixel format the encoder's input
+// has to be converted to, or AV_PIX_FMT_NONE if the encoder can't be used, which is expected for
+// hardware encoders without a matching device.
+AVPixelFormat OpenEncoder(FrameDumpContext& context, const AVCodec* codec,
+                          const AVOutputFormat* output_format, s64* max_denominator)
+{
+  context.codec = avcodec_alloc_context3(codec);
+  if (!context.codec)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not allocate codec context");
+    return AV_PIX_FMT_NONE;
+  }
+
+  *max_denominator = std::numeric_limits<s64>::max();
+
+  // Force XVID FourCC for better compatibility when using H.263
+  if (codec->id == AV_CODEC_ID_MPEG4)
+  {
+    context.codec->codec_tag = MKTAG('X', 'V', 'I', 'D');
+    *max_denominator = std::numeric_limits<unsigned short>::max();
+  }
+
+  const auto time_base = GetTimeBaseForCurrentRefreshRate(*max_denominator);
+
+  INFO_LOG_FMT(FRAMEDUMP, "Creating video file: {} x {} @ {}/{} fps with {}", context.width,
+               context.height, time_base.den, time_base.num, codec->name);
+
+  const bool is_hardware = (codec->capabilities & AV_CODEC_CAP_HARDWARE) != 0;
+
+  context.codec->codec_type = AVMEDIA_TYPE_VIDEO;
+  context.codec->bit_rate = static_cast<int64_t>(Config::Get(Config::GFX_BITRATE_KBPS)) * 1000;
+  context.codec->width = context.width;
+  context.codec->height = context.height;
+  context.codec->time_base = time_base;
+  context.codec->gop_size = 1;
+  // Hardware encoders check the level against the resolution, so let them pick it.
+  if (!is_hardware)
+    context.codec->level = 1;
+
+  AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
+
+  const std::string pixel_format_string = Config::Get(Config::GFX_DUMP_PIXEL_FORMAT);
+  if (!pixel_format_string.empty())
+  {
+    pix_fmt = av_get_pix_fmt(pixel_format_string.c_str());
+    if (pix_fmt == AV_PIX_FMT_NONE)
+      WARN_LOG_FMT(FRAMEDUMP, "Invalid pixel format {}", pixel_format_string);
+  }
+
+  if (pix_fmt == AV_PIX_FMT_NONE)
+  {
+    if (context.codec->codec_id == AV_CODEC_ID_FFV1)
+      pix_fmt = AV_PIX_FMT_BGR0;
+    else if (context.codec->codec_id == AV_CODEC_ID_UTVIDEO)
+      pix_fmt = AV_PIX_FMT_GBRP;
+    else
+      pix_fmt = AV_PIX_FMT_YUV420P;
+  }
+
+  context.codec->pix_fmt = pix_fmt;
+
+  // Hardware encoders take a few formats of their own, e.g. NV12, or only frames on their device.
+  const AVPixelFormat* const supported_formats = GetSupportedPixelFormats(codec);
+  if (!IsPixelFormatSupported(supported_formats, pix_fmt))
+  {
+    const AVPixelFormat sw_pix_fmt = SetUpHardwareFrames(context, codec, supported_formats);
+    if (sw_pix_fmt != AV_PIX_FMT_NONE)
+    {
+      pix_fmt = sw_pix_fmt;
+    }
+    else
+    {
+      pix_fmt = avcodec_find_best_pix_fmt_of_list(supported_formats, AV_PIX_FMT_RGBA, 0, nullptr);
+      context.codec->pix_fmt = pix_fmt;
+    }
+
+    INFO_LOG_FMT(FRAMEDUMP, "Encoder {} doesn't support the pixel format, using {}", codec->name,
+                 av_get_pix_fmt_name(pix_fmt) ? av_get_pix_fmt_name(pix_fmt) : "none");
+  }
+
+  if (context.codec->codec_id == AV_CODEC_ID_UTVIDEO)
+    av_opt_set_int(context.codec->priv_data, "pred", 3, 0);  // median
+
+  if (output_format->flags & AVFMT_GLOBALHEADER)
+    context.codec->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+
+  if (const int error = avcodec_open2(context.codec, codec, nullptr))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not open encoder {}: {}", codec->name, AVErrorString(error));
+    return AV_PIX_FMT_NONE;
+  }
+
+  return pix_fmt;
+}
+
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -235,84 +416,54 @@ bool FFMpegFrameDump::CreateVideoFile()
       WARN_LOG_FMT(FRAMEDUMP, "Invalid codec {}", codec_name);
   }
 
-  const AVCodec* codec = nullptr;
+  std::vector<const AVCodec*> encoders;
   const std::string dump_encoder = Config::Get(Config::GFX_DUMP_ENCODER);
   if (!dump_encoder.empty())
   {
-    codec = avcodec_find_encoder_by_name(dump_encoder.c_str());
-    if (!codec)
+    if (const AVCodec* const encoder = avcodec_find_encoder_by_name(dump_encoder.c_str()))
+      encoders.push_back(encoder);
+    else
       WARN_LOG_FMT(FRAMEDUMP, "Invalid encoder {}", dump_encoder);
   }
-  if (!codec)
-    codec = avcodec_find_encoder(codec_id);
-
-  m_context->codec = avcodec_alloc_context3(codec);
-  if (!codec || !m_context->codec)
+  if (encoders.empty() && Config::Get(Config::GFX_DUMP_USE_HARDWARE_ENCODER))
   {
-    ERROR_LOG_FMT(FRAMEDUMP, "Could not find encoder or allocate codec context");
-    return false;
-  }
-
-  m_max_denominator = std::numeric_limits<s64>::max();
-
-  // Force XVID FourCC for better compatibility when using H.263
-  if (codec->id == AV_CODEC_ID_MPEG4)
-  {
-    m_context->codec->codec_tag = MKTAG('X', 'V', 'I', 'D');
-    m_max_denominator = std::numeric_limits<unsigned short>::max();
+    for (const char* suffix : HARDWARE_ENCODER_SUFFIXES)
+    {
+      const std::string name = fmt::format("{}_{}", avcodec_get_name(codec_id), suffix);
+      if (const AVCodec* const encoder = avcodec_find_encoder_by_name(name.c_str()))
+        encoders.push_back(encoder);
+    }
   }
+  if (const AVCodec* const encoder = avcodec_find_encoder(codec_id))
+    encoders.push_back(encoder);
 
-  const auto time_base = GetTimeBaseForCurrentRefreshRate(m_max_denominator);
-
-  INFO_LOG_FMT(FRAMEDUMP, "Creating video file: {} x {} @ {}/{} fps", m_context->width,
-               m_context->height, time_base.den, time_base.num);
-
-  m_context->codec->codec_type = AVMEDIA_TYPE_VIDEO;
-  m_context->codec->bit_rate = static_cast<int64_t>(Config::Get(Config::GFX_BITRATE_KBPS)) * 1000;
-  m_context->codec->width = m_context->width;
-  m_context->codec->height = m_context->height;
-  m_context->codec->time_base = time_base;
-  m_context->codec->gop_size = 1;
-  m_context->codec->level = 1;
-
-  AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
-
-  const std::string pixel_format_string = Config::Get(Config::GFX_DUMP_PIXEL_FORMAT);
-  if (!pixel_format_string.empty())
+  const AVCodec* codec = nullptr;
+  AVPixelFormat input_pix_fmt = AV_PIX_FMT_NONE;
+  for (const AVCodec* encoder : encoders)
   {
-    pix_fmt = av_get_pix_fmt(pixel_format_string.c_str());
-    if (pix_fmt == AV_PIX_FMT_NONE)
-      WARN_LOG_FMT(FRAMEDUMP, "Invalid pixel format {}", pixel_format_string);
-  }
+    input_pix_fmt = OpenEncoder(*m_context, encoder, output_format, &m_max_denominator);
+    if (input_pix_fmt != AV_PIX_FMT_NONE)
+    {
+      codec = encoder;
+      break;
+    }
 
-  if (pix_fmt == AV_PIX_FMT_NONE)
-  {
-    if (m_context->codec->codec_id == AV_CODEC_ID_FFV1)
-      pix_fmt = AV_PIX_FMT_BGR0;
-    else if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
-      pix_fmt = AV_PIX_FMT_GBRP;
-    else
-      pix_fmt = AV_PIX_FMT_YUV420P;
+    avcodec_free_context(&m_context->codec);
+    av_buffer_unref(&m_context->hw_device);
   }
 
-  m_context->codec->pix_fmt = pix_fmt;
-
-  if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
-    av_opt_set_int(m_context->codec->priv_data, "pred", 3, 0);  // median
-
-  if (output_format->flags & AVFMT_GLOBALHEADER)
-    m_context->codec->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
-
-  if (avcodec_open2(m_context->codec, codec, nullptr) < 0)
+  if (!codec)
   {
-    ERROR_LOG_FMT(FRAMEDUMP, "Could not open codec");
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not find or open an encoder");
     return false;
   }
 
   m_context->src_frame = av_frame_alloc();
   m_context->scaled_frame = av_frame_alloc();
+  if (m_context->codec->hw_frames_ctx)
+    m_context->hw_frame = av_frame_alloc();
 
-  m_context->scaled_frame->format = m_context->codec->pix_fmt;
+  m_context->scaled_frame->format = input_pix_fmt;
   m_context->scaled_frame->width = m_context->width;
   m_context->scaled_frame->height = m_context->height;
 
@@ -337,7 +488,7 @@ bool FFMpegFrameDump::CreateVideoFile()
     return false;
   }
 
-  if (av_cmp_q(m_context->stream->time_base, time_base) != 0)
+  if (av_cmp_q(m_context->stream->time_base, m_context->codec->time_base) != 0)
   {
     WARN_LOG_FMT(FRAMEDUMP, "Stream time base differs at {}/{}", m_context->stream->time_base.den,
                  m_context->stream->time_base.num);
@@ -397,7 +548,8 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   // Convert image from RGBA to desired pixel format.
   m_context->sws = sws_getCachedContext(
       m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+      static_cast<AVPixelFormat>(m_context->scaled_frame->format), SWS_BICUBIC, nullptr, nullptr,
+      nullptr);
   if (m_context->sws)
   {
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
@@ -407,7 +559,28 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   m_context->last_pts = pts;
   m_context->scaled_frame->pts = pts;
 
-  if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
+  AVFrame* encoder_frame = m_context->scaled_frame;
+  if (m_context->hw_frame)
+  {
+    // Upload the converted image to the encoder's device.
+    int upload_error =
+        av_hwframe_get_buffer(m_context->codec->hw_frames_ctx, m_context->hw_frame, 0);
+    if (!upload_error)
+      upload_error = av_hwframe_transfer_data(m_context->hw_frame, m_context->scaled_frame, 0);
+    if (upload_error)
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Error uploading frame: {}", AVErrorString(upload_error));
+      av_frame_unref(m_context->hw_frame);
+      return;
+    }
+    m_context->hw_frame->pts = pts;
+    encoder_frame = m_context->hw_frame;
+  }
+
+  const int error = avcodec_send_frame(m_context->codec, encoder_frame);
+  if (m_context->hw_frame)
+    av_frame_unref(m_context->hw_frame);
+  if (error)
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
     return;
@@ -480,8 +653,10 @@ void FFMpegFrameDump::CloseVideoFile()
 {
   av_frame_free(&m_context->src_frame);
   av_frame_free(&m_context->scaled_frame);
+  av_frame_free(&m_context->hw_frame);
 
   avcodec_free_context(&m_context->codec);
+  av_buffer_unref(&m_context->hw_device);
 
   if (m_context->format)
     avio_closep(&m_context->format->pb);
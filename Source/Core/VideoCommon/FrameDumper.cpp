@@ -30,7 +30,7 @@ static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
 FrameDumper::FrameDumper()
 {
   m_frame_end_handle =
-      AfterFrameEvent::Register([this](Core::System&) { FlushFrameDump(); }, "FrameDumper");
+      AfterFrameEvent::Register([this](Core::System&) { FlushPendingFrames(); }, "FrameDumper");
 }
 
 FrameDumper::~FrameDumper()
@@ -61,13 +61,21 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  // Make room in the ring, and make sure the thread isn't still encoding from the readback we are
+  // about to overwrite.
+  if (m_readback_count == m_readbacks.size())
+    QueueOldestReadback();
+  const size_t index = (m_readback_first + m_readback_count) % m_readbacks.size();
+  if (m_frame_dump_frame_running && index == m_readback_encoding)
+    FinishFrameData();
+
+  Readback& readback = m_readbacks[index];
+  if (!CheckFrameDumpReadbackTexture(readback.texture, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  readback.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, readback.texture->GetRect());
+  readback.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  ++m_readback_count;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -98,9 +106,9 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                                  u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -117,32 +125,50 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  FlushReadbacks(0);
+}
+
+void FrameDumper::FlushPendingFrames()
+{
+  // Screenshots are taken right away, only frame dumps are worth delaying.
+  FlushReadbacks(Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES) ? READBACK_LATENCY : 0);
+}
+
+void FrameDumper::FlushReadbacks(size_t max_pending)
+{
+  if (m_readback_count <= max_pending)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
+  while (m_readback_count > max_pending)
+    QueueOldestReadback();
+
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
+    ShutdownFrameDumping();
+}
+
+void FrameDumper::QueueOldestReadback()
+{
+  // Ensure dumping thread is done with the previous frame before queueing another one.
   FinishFrameData();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  const size_t index = m_readback_first;
+  m_readback_first = (m_readback_first + 1) % m_readbacks.size();
+  --m_readback_count;
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
+  Readback& readback = m_readbacks[index];
+  auto& output = readback.texture;
   output->Flush();
-  if (output->Map())
-  {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
-  }
-  else
+  if (!output->Map())
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    return;
   }
 
-  m_frame_dump_needs_flush = false;
-
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
+  m_readback_encoding = index;
+  DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
+                output->GetConfig().height, static_cast<int>(output->GetMappedStride()),
+                readback.state);
 }
 
 void FrameDumper::ShutdownFrameDumping()
@@ -164,13 +190,14 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  for (Readback& readback : m_readbacks)
+    readback.texture.reset();
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride,
+                                const FrameState& state)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  m_frame_dump_data = FrameData{data, w, h, stride, state};
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -193,7 +220,7 @@ void FrameDumper::FinishFrameData()
   m_frame_dump_done.Wait();
   m_frame_dump_frame_running = false;
 
-  m_frame_dump_output_texture->Unmap();
+  m_readbacks[m_readback_encoding].texture->Unmap();
 }
 
 void FrameDumper::FrameDumpThreadFunc()
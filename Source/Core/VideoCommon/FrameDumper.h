@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -38,6 +41,19 @@ public:
   void DoState(PointerWrap& p);
 
 private:
+  struct Readback
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    // Holds emulation state during the frame the texture was filled with.
+    FrameState state;
+  };
+
+  // Frames are sent to the encoder this many frames after they were rendered, so that mapping the
+  // readback texture doesn't have to wait for the GPU to finish the latest frame.
+  static constexpr size_t READBACK_LATENCY = 2;
+  // One more frame is being rendered, and one more is being encoded by the frame dump thread.
+  static constexpr size_t READBACK_RING_SIZE = READBACK_LATENCY + 2;
+
   // NOTE: The methods below are called on the framedumping thread.
   void FrameDumpThreadFunc();
   bool StartFrameDumpToFFMPEG(const FrameData&);
@@ -52,11 +68,18 @@ private:
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Checks that a frame dump readback texture exists and is the correct size.
+  bool CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& texture,
+                                     u32 target_width, u32 target_height);
+
+  // Sends the oldest read back frames to the encoder until at most max_pending are left.
+  void FlushReadbacks(size_t max_pending);
+  // Called after every frame, leaving the latest frames in the ring while dumping.
+  void FlushPendingFrames();
+  void QueueOldestReadback();
 
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
@@ -70,9 +93,6 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
   // Communication of frame between video and dump threads.
   FrameData m_frame_dump_data;
 
@@ -80,12 +100,14 @@ private:
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
+  // Ring of readbacks, holding m_readback_count frames which need to be dumped starting at
+  // m_readback_first.
+  std::array<Readback, READBACK_RING_SIZE> m_readbacks;
+  size_t m_readback_first = 0;
+  size_t m_readback_count = 0;
+  // The readback the thread is processing, while m_frame_dump_frame_running is set.
+  size_t m_readback_encoding = 0;
+  // Set when thread is processing a readback texture.
   bool m_frame_dump_frame_running = false;
 
   // Used to generate screenshot names.
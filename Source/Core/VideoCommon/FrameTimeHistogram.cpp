@@ -0,0 +1,43 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FrameTimeHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+void FrameTimeHistogram::Reset()
+{
+  m_buckets.fill(0);
+  m_count = 0;
+  m_total = DT::zero();
+  m_max = DT::zero();
+}
+
+void FrameTimeHistogram::Push(DT frame_time)
+{
+  frame_time = std::max(frame_time, DT::zero());
+
+  const auto bucket = static_cast<std::size_t>(frame_time / BUCKET_WIDTH);
+  ++m_buckets[std::min(bucket, NUM_BUCKETS)];
+  ++m_count;
+  m_total += frame_time;
+  m_max = std::max(m_max, frame_time);
+}
+
+DT FrameTimeHistogram::GetPercentile(double fraction) const
+{
+  if (m_count == 0)
+    return DT::zero();
+
+  const u64 target =
+      std::clamp<u64>(static_cast<u64>(std::ceil(fraction * m_count)), 1, m_count);
+  u64 seen = 0;
+  for (std::size_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    seen += m_buckets[i];
+    if (seen >= target)
+      return std::min<DT>(BUCKET_WIDTH * (i + 1), m_max);
+  }
+  return m_max;
+}
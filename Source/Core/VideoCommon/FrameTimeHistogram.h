@@ -0,0 +1,39 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// Distribution of frame times in a fixed amount of memory, so that percentiles such as 1% lows
+// can be computed over arbitrarily long runs. Frame times are counted in buckets of BUCKET_WIDTH,
+// and the ones that are too long for the last bucket share an overflow bucket.
+//
+// Not thread safe.
+class FrameTimeHistogram
+{
+public:
+  static constexpr DT BUCKET_WIDTH = std::chrono::microseconds{100};
+  static constexpr std::size_t NUM_BUCKETS = 2500;
+
+  void Reset();
+  void Push(DT frame_time);
+
+  u64 GetCount() const { return m_count; }
+  DT GetTotal() const { return m_total; }
+  DT GetMax() const { return m_max; }
+
+  // The frame time that the given fraction of frames did not exceed, rounded up to the end of its
+  // bucket. E.g. GetPercentile(0.99) is the frame time of the 1% lows.
+  DT GetPercentile(double fraction) const;
+
+private:
+  std::array<u32, NUM_BUCKETS + 1> m_buckets{};
+  u64 m_count = 0;
+  DT m_total{};
+  DT m_max{};
+};
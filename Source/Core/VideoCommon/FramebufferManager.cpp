@@ -3,8 +3,11 @@
 
 #include "VideoCommon/FramebufferManager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <fmt/format.h>
 #include <memory>
+#include <utility>
 
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
@@ -20,6 +23,7 @@
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -29,6 +33,13 @@
 // Maximum number of pixels poked in one batch * 6
 constexpr size_t MAX_POKE_VERTICES = 32768;
 
+static bool RectangleContains(const MathUtil::Rectangle<int>& outer,
+                              const MathUtil::Rectangle<int>& inner)
+{
+  return outer.left <= inner.left && outer.top <= inner.top && outer.right >= inner.right &&
+         outer.bottom >= inner.bottom;
+}
+
 std::unique_ptr<FramebufferManager> g_framebuffer_manager;
 
 FramebufferManager::FramebufferManager() : m_prev_efb_format(PixelFormat::INVALID_FMT)
@@ -94,6 +105,7 @@ void FramebufferManager::RecreateEFBFramebuffer()
 {
   FlushEFBPokes();
   InvalidatePeekCache(true);
+  InvalidateEFBResolves();
 
   DestroyReadbackFramebuffer();
   DestroyEFBFramebuffer();
@@ -101,6 +113,73 @@ void FramebufferManager::RecreateEFBFramebuffer()
     PanicAlertFmt("Failed to recreate EFB framebuffer");
 }
 
+bool FramebufferManager::UpdateDynamicEFBScale()
+{
+  // Number of consecutive frames a condition has to hold before the scale changes, and how long
+  // the scale is left alone afterwards, so that the new load can settle.
+  static constexpr u32 DOWNSCALE_FRAMES = 30;
+  static constexpr u32 UPSCALE_FRAMES = 300;
+  static constexpr u32 HOLD_FRAMES = 120;
+
+  const TimePoint now = Clock::now();
+  const DT frame_time = now - std::exchange(m_last_frame_time, now);
+
+  if (!g_ActiveConfig.bDynamicEFBScale)
+  {
+    const bool was_active = m_dynamic_efb_scale != 0;
+    m_dynamic_efb_scale = 0;
+    return was_active;
+  }
+
+  const u32 max_scale = std::max(GetConfiguredEFBScale(), 1u);
+  const u32 min_scale = std::clamp<u32>(std::max(g_ActiveConfig.iDynamicEFBScaleMin, 1), 1,
+                                        max_scale);
+  const u32 current_scale =
+      m_dynamic_efb_scale != 0 ? std::clamp(m_dynamic_efb_scale, min_scale, max_scale) : max_scale;
+
+  // Skip over pauses and loading screens.
+  if (frame_time <= DT::zero() || frame_time > std::chrono::seconds(1))
+    return false;
+
+  if (m_dynamic_scale_hold_frames > 0)
+  {
+    m_dynamic_scale_hold_frames--;
+    return false;
+  }
+
+  const double gpu_idle = std::min(DT_us(g_perf_metrics.GetLastFrameGPUIdle()) / frame_time, 1.0);
+  const double cpu_wait = DT_us(g_perf_metrics.GetLastFrameCPUWait()) / frame_time;
+
+  // The CPU thread waiting on the GPU thread while the game runs below full speed means the GPU
+  // can't keep up. Going up a step increases the pixel count by ((scale + 1) / scale)^2, so only
+  // do that if there is enough idle time to absorb it. Without a separate GPU thread, neither
+  // condition is ever met and the scale stays where it is.
+  const double step = static_cast<double>(current_scale + 1) / current_scale;
+  const bool overloaded = cpu_wait > 0.05 && g_perf_metrics.GetSpeed() < 0.98;
+  const bool underloaded = !overloaded && (1.0 - gpu_idle) * step * step < 0.85;
+
+  m_dynamic_scale_overloaded_frames = overloaded ? m_dynamic_scale_overloaded_frames + 1 : 0;
+  m_dynamic_scale_underloaded_frames = underloaded ? m_dynamic_scale_underloaded_frames + 1 : 0;
+
+  u32 new_scale = current_scale;
+  if (m_dynamic_scale_overloaded_frames >= DOWNSCALE_FRAMES && current_scale > min_scale)
+    new_scale = current_scale - 1;
+  else if (m_dynamic_scale_underloaded_frames >= UPSCALE_FRAMES && current_scale < max_scale)
+    new_scale = current_scale + 1;
+
+  if (new_scale == current_scale)
+    return false;
+
+  INFO_LOG_FMT(VIDEO, "Dynamic resolution: changing internal resolution from {}x to {}x",
+               current_scale, new_scale);
+
+  m_dynamic_efb_scale = new_scale;
+  m_dynamic_scale_overloaded_frames = 0;
+  m_dynamic_scale_underloaded_frames = 0;
+  m_dynamic_scale_hold_frames = HOLD_FRAMES;
+  return new_scale != GetEFBScale();
+}
+
 void FramebufferManager::RecompileShaders()
 {
   DestroyPokePipelines();
@@ -210,12 +289,21 @@ float FramebufferManager::EFBToScaledYf(float y) const
   return y * ((float)GetEFBHeight() / (float)EFB_HEIGHT);
 }
 
-std::tuple<u32, u32> FramebufferManager::CalculateTargetSize()
+u32 FramebufferManager::GetConfiguredEFBScale() const
 {
   if (g_ActiveConfig.iEFBScale == EFB_SCALE_AUTO_INTEGRAL)
-    m_efb_scale = g_presenter->AutoIntegralScale();
+    return g_presenter->AutoIntegralScale();
   else
-    m_efb_scale = g_ActiveConfig.iEFBScale;
+    return g_ActiveConfig.iEFBScale;
+}
+
+std::tuple<u32, u32> FramebufferManager::CalculateTargetSize()
+{
+  m_efb_scale = GetConfiguredEFBScale();
+
+  // Dynamic resolution only ever lowers the configured scale.
+  if (g_ActiveConfig.bDynamicEFBScale && m_dynamic_efb_scale != 0)
+    m_efb_scale = std::min(m_efb_scale, static_cast<float>(m_dynamic_efb_scale));
 
   const u32 max_size = g_backend_info.MaxTextureSize;
   if (max_size < EFB_WIDTH * m_efb_scale)
@@ -326,6 +414,10 @@ AbstractTexture* FramebufferManager::ResolveEFBColorTexture(const MathUtil::Rect
   MathUtil::Rectangle<int> clamped_region = region;
   clamped_region.ClampUL(0, 0, GetEFBWidth(), GetEFBHeight());
 
+  // Nothing has been drawn since this part of the EFB was last resolved.
+  if (RectangleContains(m_efb_color_resolved_rect, clamped_region))
+    return m_efb_resolve_color_texture.get();
+
   // Resolve to our already-created texture.
   if (g_backend_info.bSupportsPartialMultisampleResolve)
   {
@@ -334,6 +426,13 @@ AbstractTexture* FramebufferManager::ResolveEFBColorTexture(const MathUtil::Rect
       m_efb_resolve_color_texture->ResolveFromTexture(m_efb_color_texture.get(), clamped_region,
                                                       layer, 0);
     }
+
+    // Only one region is remembered, as the bounds of two regions could cover unresolved pixels.
+    if (clamped_region.GetWidth() * clamped_region.GetHeight() >=
+        m_efb_color_resolved_rect.GetWidth() * m_efb_color_resolved_rect.GetHeight())
+    {
+      m_efb_color_resolved_rect = clamped_region;
+    }
   }
   else
   {
@@ -347,6 +446,9 @@ AbstractTexture* FramebufferManager::ResolveEFBColorTexture(const MathUtil::Rect
     g_gfx->Draw(0, 3);
     m_efb_resolve_color_texture->FinishedRendering();
     g_gfx->EndUtilityDrawing();
+
+    // The rest of the texture was discarded.
+    m_efb_color_resolved_rect = clamped_region;
   }
   m_efb_resolve_color_texture->FinishedRendering();
   return m_efb_resolve_color_texture.get();
@@ -365,6 +467,9 @@ AbstractTexture* FramebufferManager::ResolveEFBDepthTexture(const MathUtil::Rect
   MathUtil::Rectangle<int> clamped_region = region;
   clamped_region.ClampUL(0, 0, GetEFBWidth(), GetEFBHeight());
 
+  if (RectangleContains(m_efb_depth_resolved_rect, clamped_region))
+    return m_efb_depth_resolve_texture.get();
+
   m_efb_depth_texture->FinishedRendering();
   g_gfx->BeginUtilityDrawing();
   g_gfx->SetAndDiscardFramebuffer(m_efb_depth_resolve_framebuffer.get());
@@ -377,6 +482,7 @@ AbstractTexture* FramebufferManager::ResolveEFBDepthTexture(const MathUtil::Rect
   m_efb_depth_resolve_texture->FinishedRendering();
   g_gfx->EndUtilityDrawing();
 
+  m_efb_depth_resolved_rect = clamped_region;
   return m_efb_depth_resolve_texture.get();
 }
 
@@ -402,6 +508,7 @@ bool FramebufferManager::ReinterpretPixelData(EFBReinterpretType convtype)
   std::swap(m_efb_framebuffer, m_efb_convert_framebuffer);
   g_gfx->EndUtilityDrawing();
   InvalidatePeekCache(true);
+  InvalidateEFBResolves();
   return true;
 }
 
@@ -483,7 +590,7 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
-    PopulateEFBCache(false, tile_index);
+    PopulateEFBCacheForPeek(false, tile_index);
 
   m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -506,7 +613,7 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
-    PopulateEFBCache(true, tile_index);
+    PopulateEFBCacheForPeek(true, tile_index);
 
   m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -601,6 +708,9 @@ void FramebufferManager::InvalidatePeekCache(bool forced)
 
 void FramebufferManager::FlagPeekCacheAsOutOfDate()
 {
+  // This is called whenever the EFB is drawn to, so the resolved copies are stale as well.
+  InvalidateEFBResolves();
+
   if (m_efb_color_cache.has_active_tiles)
     m_efb_color_cache.out_of_date = true;
   if (m_efb_depth_cache.has_active_tiles)
@@ -610,6 +720,12 @@ void FramebufferManager::FlagPeekCacheAsOutOfDate()
     InvalidatePeekCache();
 }
 
+void FramebufferManager::InvalidateEFBResolves()
+{
+  m_efb_color_resolved_rect = {};
+  m_efb_depth_resolved_rect = {};
+}
+
 void FramebufferManager::EndOfFrame()
 {
   for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
@@ -855,6 +971,21 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
   data.tiles[tile_index].present = true;
 }
 
+void FramebufferManager::PopulateEFBCacheForPeek(bool depth, u32 tile_index)
+{
+  // Reading back the requested tile stalls until the GPU catches up. Tiles which were peeked in
+  // recent frames are likely to be peeked again before the EFB changes, so queue their readbacks
+  // first, and wait for all of them with the requested one instead of stalling once per tile.
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  for (u32 i = 0; i < data.tiles.size(); i++)
+  {
+    if (i != tile_index && data.tiles[i].frame_access_mask != 0 && !data.tiles[i].present)
+      PopulateEFBCache(depth, i, true);
+  }
+
+  PopulateEFBCache(depth, tile_index);
+}
+
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool color_enable,
                                   bool alpha_enable, bool z_enable, u32 color, u32 z)
 {
@@ -1041,6 +1172,7 @@ void FramebufferManager::DrawPokeVertices(const EFBPokeVertex* vertices, u32 ver
   g_gfx->SetPipeline(pipeline);
   g_gfx->Draw(base_vertex, vertex_count);
   g_gfx->EndUtilityDrawing();
+  InvalidateEFBResolves();
 }
 
 bool FramebufferManager::CompilePokePipelines()
@@ -1141,6 +1273,7 @@ void FramebufferManager::DoLoadState(PointerWrap& p)
 {
   // Invalidate any peek cache tiles.
   InvalidatePeekCache(true);
+  InvalidateEFBResolves();
 
   // Deserialize the color and depth textures. This could fail.
   auto color_tex = g_texture_cache->DeserializeTexture(p);
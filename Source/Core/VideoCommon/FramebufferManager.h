@@ -90,13 +90,18 @@ public:
   // Recreate EFB framebuffers, call when the EFB size (IR) changes.
   void RecreateEFBFramebuffer();
 
+  // Adjusts the internal resolution to the GPU load when dynamic resolution is enabled. Called
+  // once per frame, returns true if the EFB has to be recreated at a different scale.
+  bool UpdateDynamicEFBScale();
+
   // Recompile shaders, use when MSAA mode changes.
   void RecompileShaders();
 
   // This is virtual, because D3D has both normalized and integer framebuffers.
   void BindEFBFramebuffer();
 
-  // Resolve color/depth textures to a non-msaa texture, and return it.
+  // Resolve color/depth textures to a non-msaa texture, and return it. Only the region is resolved,
+  // and nothing is done if it's still current from an earlier resolve.
   AbstractTexture* ResolveEFBColorTexture(const MathUtil::Rectangle<int>& region);
   AbstractTexture* ResolveEFBDepthTexture(const MathUtil::Rectangle<int>& region,
                                           bool force_r32f = false);
@@ -121,6 +126,7 @@ public:
   void InvalidatePeekCache(bool forced = true);
   void RefreshPeekCache();
   void FlagPeekCacheAsOutOfDate();
+  void InvalidateEFBResolves();
   void EndOfFrame();
 
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
@@ -182,6 +188,7 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void PopulateEFBCacheForPeek(bool depth, u32 tile_index);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -189,12 +196,20 @@ protected:
   void DrawPokeVertices(const EFBPokeVertex* vertices, u32 vertex_count,
                         const AbstractPipeline* pipeline);
 
+  u32 GetConfiguredEFBScale() const;
   std::tuple<u32, u32> CalculateTargetSize();
 
   void DoLoadState(PointerWrap& p);
   void DoSaveState(PointerWrap& p);
 
   float m_efb_scale = 1.0f;
+
+  // Dynamic resolution state. A scale of 0 means the configured scale is used.
+  u32 m_dynamic_efb_scale = 0;
+  u32 m_dynamic_scale_overloaded_frames = 0;
+  u32 m_dynamic_scale_underloaded_frames = 0;
+  u32 m_dynamic_scale_hold_frames = 0;
+  TimePoint m_last_frame_time{};
   PixelFormat m_prev_efb_format;
 
   std::unique_ptr<AbstractTexture> m_efb_color_texture;
@@ -203,6 +218,10 @@ protected:
   std::unique_ptr<AbstractTexture> m_efb_resolve_color_texture;
   std::unique_ptr<AbstractTexture> m_efb_depth_resolve_texture;
 
+  // Parts of the EFB which the resolve textures are up to date with, empty after drawing.
+  MathUtil::Rectangle<int> m_efb_color_resolved_rect;
+  MathUtil::Rectangle<int> m_efb_depth_resolved_rect;
+
   std::unique_ptr<AbstractFramebuffer> m_efb_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_convert_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_color_resolve_framebuffer;
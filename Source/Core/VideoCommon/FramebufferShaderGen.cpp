@@ -655,6 +655,7 @@ std::string GenerateImGuiVertexShader()
   EmitUniformBufferDeclaration(code);
   code.Write("{{\n"
              "float2 u_rcp_viewport_size_mul2;\n"
+             "float2 u_clip_space_rotation;\n"
              "}};\n\n");
 
   EmitVertexMainDeclaration(code, 1, 1, true, 1, 1);
@@ -664,9 +665,14 @@ std::string GenerateImGuiVertexShader()
              "  opos = float4(rawpos.x * u_rcp_viewport_size_mul2.x - 1.0,"
              "                1.0 - rawpos.y * u_rcp_viewport_size_mul2.y, 0.0, 1.0);\n");
 
-  // NDC space is flipped in Vulkan.
+  // NDC space is flipped in Vulkan. The backbuffer can also be pre-rotated there.
   if (GetAPIType() == APIType::Vulkan)
-    code.Write("  opos.y = -opos.y;\n");
+  {
+    code.Write("  opos.y = -opos.y;\n"
+               "  float2 rotation = u_clip_space_rotation;\n"
+               "  opos.xy = float2(opos.x * rotation.x - opos.y * rotation.y,\n"
+               "                   opos.x * rotation.y + opos.y * rotation.x);\n");
+  }
 
   code.Write("}}\n");
   return code.GetBuffer();
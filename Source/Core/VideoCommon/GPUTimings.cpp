@@ -0,0 +1,191 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/GPUTimings.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/VideoConfig.h"
+
+std::unique_ptr<VideoCommon::GPUTimings> g_gpu_timings;
+
+namespace VideoCommon
+{
+const char* GetGPUTimingCategoryName(GPUTimingCategory category)
+{
+  switch (category)
+  {
+  case GPUTimingCategory::Draws:
+    return "Draws";
+  case GPUTimingCategory::EFBCopies:
+    return "EFB copies";
+  case GPUTimingCategory::XFBScaling:
+    return "XFB scaling";
+  case GPUTimingCategory::PostProcessing:
+    return "Post-processing";
+  default:
+    return "";
+  }
+}
+
+void GPUTimings::Begin(GPUTimingCategory category)
+{
+  if (m_active)
+    BeginSpan(category, nullptr);
+}
+
+void GPUTimings::End()
+{
+  if (m_active)
+    EndSpan();
+}
+
+void GPUTimings::OnDraw(const AbstractPipeline* pipeline)
+{
+  if (!m_active)
+    return;
+
+  // Keep measuring the current batch of draws if the pipeline did not change.
+  const Frame& frame = m_frames[m_current_frame];
+  if (m_span_open && frame.spans.back().category == GPUTimingCategory::Draws &&
+      frame.spans.back().pipeline == pipeline)
+  {
+    return;
+  }
+
+  BeginSpan(GPUTimingCategory::Draws, pipeline);
+}
+
+void GPUTimings::EndFrame()
+{
+  if (m_active)
+  {
+    EndSpan();
+
+    Frame& frame = m_frames[m_current_frame];
+    if (!frame.spans.empty())
+    {
+      g_gfx->ResolveTimestamps(GetTimestampIndex(m_current_frame, 0),
+                               static_cast<u32>(frame.spans.size() * 2));
+      frame.pending = true;
+    }
+    m_current_frame = (m_current_frame + 1) % NUM_FRAMES;
+  }
+
+  ReadBackFrames();
+
+  m_active = g_backend_info.bSupportsTimestampQueries && g_ActiveConfig.bOverlayGPUTimings;
+  if (m_active)
+    BeginFrame();
+  else
+    m_last_frame_times = {};
+}
+
+void GPUTimings::BeginFrame()
+{
+  static_assert(NUM_FRAMES * TIMESTAMPS_PER_FRAME <= AbstractGfx::TIMESTAMP_QUERY_COUNT);
+
+  // If the GPU is so far behind that this frame's timestamps have still not been read back, they
+  // are dropped.
+  Frame& frame = m_frames[m_current_frame];
+  frame.spans.clear();
+  frame.dropped_spans = 0;
+  frame.pending = false;
+
+  g_gfx->ResetTimestamps(GetTimestampIndex(m_current_frame, 0), TIMESTAMPS_PER_FRAME);
+}
+
+void GPUTimings::BeginSpan(GPUTimingCategory category, const AbstractPipeline* pipeline)
+{
+  EndSpan();
+
+  Frame& frame = m_frames[m_current_frame];
+  if (frame.spans.size() == MAX_SPANS_PER_FRAME)
+  {
+    frame.dropped_spans++;
+    return;
+  }
+
+  g_gfx->WriteTimestamp(
+      GetTimestampIndex(m_current_frame, static_cast<u32>(frame.spans.size() * 2)));
+  frame.spans.push_back(
+      {category, pipeline, pipeline ? pipeline->m_config.usage : AbstractPipelineUsage::Utility});
+  m_span_open = true;
+}
+
+void GPUTimings::EndSpan()
+{
+  if (!m_span_open)
+    return;
+
+  const Frame& frame = m_frames[m_current_frame];
+  g_gfx->WriteTimestamp(
+      GetTimestampIndex(m_current_frame, static_cast<u32>(frame.spans.size() * 2 - 1)));
+  m_span_open = false;
+}
+
+void GPUTimings::ReadBackFrames()
+{
+  // Frames complete in order, so start with the oldest one and stop at the first which the GPU has
+  // not finished yet.
+  for (u32 i = 0; i < NUM_FRAMES; i++)
+  {
+    const u32 frame_index = (m_current_frame + i) % NUM_FRAMES;
+    if (m_frames[frame_index].pending && !ReadBackFrame(frame_index))
+      break;
+  }
+}
+
+bool GPUTimings::ReadBackFrame(u32 frame_index)
+{
+  Frame& frame = m_frames[frame_index];
+  const u32 timestamp_count = static_cast<u32>(frame.spans.size() * 2);
+  m_timestamps.resize(timestamp_count);
+  if (!g_gfx->ReadTimestamps(GetTimestampIndex(frame_index, 0), timestamp_count,
+                             m_timestamps.data()))
+  {
+    return false;
+  }
+  frame.pending = false;
+
+  FrameTimes times;
+  times.dropped_spans = frame.dropped_spans;
+  m_pipeline_indices.clear();
+  for (size_t i = 0; i < frame.spans.size(); i++)
+  {
+    const Span& span = frame.spans[i];
+    const u64 begin = m_timestamps[i * 2];
+    const u64 end = m_timestamps[i * 2 + 1];
+    const double milliseconds = end > begin ? (end - begin) / 1000000.0 : 0.0;
+    times.milliseconds[static_cast<size_t>(span.category)] += milliseconds;
+
+    if (span.category != GPUTimingCategory::Draws)
+      continue;
+
+    const auto [it, inserted] =
+        m_pipeline_indices.try_emplace(span.pipeline, times.pipelines.size());
+    if (inserted)
+      times.pipelines.push_back({span.pipeline, span.usage, 0, 0.0});
+    PipelineTime& pipeline_time = times.pipelines[it->second];
+    pipeline_time.spans++;
+    pipeline_time.milliseconds += milliseconds;
+  }
+
+  std::ranges::sort(times.pipelines, std::ranges::greater{}, &PipelineTime::milliseconds);
+  m_last_frame_times = std::move(times);
+  return true;
+}
+
+GPUTimingScope::GPUTimingScope(GPUTimingCategory category)
+{
+  g_gpu_timings->Begin(category);
+}
+
+GPUTimingScope::~GPUTimingScope()
+{
+  g_gpu_timings->End();
+}
+}  // namespace VideoCommon
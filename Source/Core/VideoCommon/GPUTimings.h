@@ -0,0 +1,124 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/AbstractPipeline.h"
+
+namespace VideoCommon
+{
+enum class GPUTimingCategory : u32
+{
+  Draws,
+  EFBCopies,
+  XFBScaling,
+  PostProcessing,
+  Count
+};
+
+const char* GetGPUTimingCategoryName(GPUTimingCategory category);
+
+// Measures how long the GPU spends on each kind of work in a frame, using the backend's timestamp
+// queries. A timestamp is written before and after each span of work, and the timestamps of a frame
+// are read back a few frames later so that the CPU never waits for the GPU. Consecutive draws with
+// the same pipeline form a single span, and draw time is also reported per pipeline.
+//
+// Only used on the video thread.
+class GPUTimings
+{
+public:
+  struct PipelineTime
+  {
+    // Only identifies the pipeline, it may have been destroyed since.
+    const AbstractPipeline* pipeline;
+    AbstractPipelineUsage usage;
+    u32 spans;
+    double milliseconds;
+  };
+
+  struct FrameTimes
+  {
+    std::array<double, static_cast<size_t>(GPUTimingCategory::Count)> milliseconds{};
+    // Draw time by pipeline, longest first.
+    std::vector<PipelineTime> pipelines;
+    // Spans which did not fit in the frame's share of timestamps, and were not measured.
+    u32 dropped_spans = 0;
+  };
+
+  // Whether timestamps are being written for the current frame.
+  bool IsActive() const { return m_active; }
+
+  // Starts measuring GPU work of the given category, until End() or the next span begins.
+  void Begin(GPUTimingCategory category);
+  void End();
+
+  // Called before a GX draw with the given pipeline.
+  void OnDraw(const AbstractPipeline* pipeline);
+
+  // Called once all of a frame's GPU work has been recorded, before it is presented.
+  void EndFrame();
+
+  // The times of the most recent frame whose timestamps have been read back.
+  const FrameTimes& GetLastFrameTimes() const { return m_last_frame_times; }
+
+private:
+  static constexpr u32 NUM_FRAMES = 4;
+  static constexpr u32 TIMESTAMPS_PER_FRAME = 2048;
+  static constexpr u32 MAX_SPANS_PER_FRAME = TIMESTAMPS_PER_FRAME / 2;
+
+  struct Span
+  {
+    GPUTimingCategory category;
+    const AbstractPipeline* pipeline;
+    AbstractPipelineUsage usage;
+  };
+
+  struct Frame
+  {
+    std::vector<Span> spans;
+    u32 dropped_spans = 0;
+    // Timestamps have been written, and not read back yet.
+    bool pending = false;
+  };
+
+  static u32 GetTimestampIndex(u32 frame, u32 timestamp)
+  {
+    return frame * TIMESTAMPS_PER_FRAME + timestamp;
+  }
+
+  void BeginFrame();
+  void BeginSpan(GPUTimingCategory category, const AbstractPipeline* pipeline);
+  void EndSpan();
+  void ReadBackFrames();
+  bool ReadBackFrame(u32 frame_index);
+
+  std::array<Frame, NUM_FRAMES> m_frames;
+  u32 m_current_frame = 0;
+  bool m_active = false;
+  bool m_span_open = false;
+
+  std::vector<u64> m_timestamps;
+  std::unordered_map<const AbstractPipeline*, size_t> m_pipeline_indices;
+  FrameTimes m_last_frame_times;
+};
+
+// Measures the GPU work recorded during its lifetime.
+class GPUTimingScope final
+{
+public:
+  explicit GPUTimingScope(GPUTimingCategory category);
+  ~GPUTimingScope();
+
+  GPUTimingScope(const GPUTimingScope&) = delete;
+  GPUTimingScope& operator=(const GPUTimingScope&) = delete;
+};
+}  // namespace VideoCommon
+
+extern std::unique_ptr<VideoCommon::GPUTimings> g_gpu_timings;
@@ -7,6 +7,8 @@
 #include <string_view>
 #include <variant>
 
+#include <xxhash.h>
+
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/VariantUtil.h"
@@ -78,6 +80,19 @@ private:
   GraphicsModConfig m_mod;
 };
 
+void GraphicsModManager::TargetNameFilter::Insert(std::string_view name)
+{
+  const u64 hash = XXH3_64bits(name.data(), name.size());
+  m_bits.set(hash % NUM_BITS);
+  m_bits.set((hash >> 32) % NUM_BITS);
+}
+
+bool GraphicsModManager::TargetNameFilter::MayContain(std::string_view name) const
+{
+  const u64 hash = XXH3_64bits(name.data(), name.size());
+  return m_bits.test(hash % NUM_BITS) && m_bits.test((hash >> 32) % NUM_BITS);
+}
+
 bool GraphicsModManager::Initialize()
 {
   if (g_ActiveConfig.bGraphicMods)
@@ -118,6 +133,12 @@ const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
                                                 const std::string& texture_name) const
 {
+  if (m_projection_texture_target_to_actions.empty() ||
+      !m_projection_texture_filter.MayContain(texture_name))
+  {
+    return m_default;
+  }
+
   const auto lookup = fmt::format("{}_{}", texture_name, static_cast<int>(projection_type));
   if (const auto it = m_projection_texture_target_to_actions.find(lookup);
       it != m_projection_texture_target_to_actions.end())
@@ -131,6 +152,9 @@ GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
 {
+  if (m_draw_started_target_to_actions.empty() || !m_draw_started_filter.MayContain(texture_name))
+    return m_default;
+
   if (const auto it = m_draw_started_target_to_actions.find(texture_name);
       it != m_draw_started_target_to_actions.end())
   {
@@ -143,6 +167,9 @@ GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
 {
+  if (m_load_texture_target_to_actions.empty() || !m_load_texture_filter.MayContain(texture_name))
+    return m_default;
+
   if (const auto it = m_load_texture_target_to_actions.find(texture_name);
       it != m_load_texture_target_to_actions.end())
   {
@@ -155,6 +182,12 @@ GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetTextureCreateActions(const std::string& texture_name) const
 {
+  if (m_create_texture_target_to_actions.empty() ||
+      !m_create_texture_filter.MayContain(texture_name))
+  {
+    return m_default;
+  }
+
   if (const auto it = m_create_texture_target_to_actions.find(texture_name);
       it != m_create_texture_target_to_actions.end())
   {
@@ -166,6 +199,9 @@ GraphicsModManager::GetTextureCreateActions(const std::string& texture_name) con
 
 const std::vector<GraphicsModAction*>& GraphicsModManager::GetEFBActions(const FBInfo& efb) const
 {
+  if (m_efb_target_to_actions.empty())
+    return m_default;
+
   if (const auto it = m_efb_target_to_actions.find(efb); it != m_efb_target_to_actions.end())
   {
     return it->second;
@@ -176,7 +212,10 @@ const std::vector<GraphicsModAction*>& GraphicsModManager::GetEFBActions(const F
 
 const std::vector<GraphicsModAction*>& GraphicsModManager::GetXFBActions(const FBInfo& xfb) const
 {
-  if (const auto it = m_efb_target_to_actions.find(xfb); it != m_efb_target_to_actions.end())
+  if (m_xfb_target_to_actions.empty())
+    return m_default;
+
+  if (const auto it = m_xfb_target_to_actions.find(xfb); it != m_xfb_target_to_actions.end())
   {
     return it->second;
   }
@@ -262,14 +301,17 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
                 [&](const DrawStartedTextureTarget& the_target) {
                   m_draw_started_target_to_actions[the_target.m_texture_info_string].push_back(
                       m_actions.back().get());
+                  m_draw_started_filter.Insert(the_target.m_texture_info_string);
                 },
                 [&](const LoadTextureTarget& the_target) {
                   m_load_texture_target_to_actions[the_target.m_texture_info_string].push_back(
                       m_actions.back().get());
+                  m_load_texture_filter.Insert(the_target.m_texture_info_string);
                 },
                 [&](const CreateTextureTarget& the_target) {
                   m_create_texture_target_to_actions[the_target.m_texture_info_string].push_back(
                       m_actions.back().get());
+                  m_create_texture_filter.Insert(the_target.m_texture_info_string);
                 },
                 [&](const EFBTarget& the_target) {
                   FBInfo info;
@@ -292,6 +334,7 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
                                                     static_cast<int>(the_target.m_projection_type));
                     m_projection_texture_target_to_actions[lookup].push_back(
                         m_actions.back().get());
+                    m_projection_texture_filter.Insert(*the_target.m_texture_info_string);
                   }
                   else
                   {
@@ -366,4 +409,8 @@ void GraphicsModManager::Reset()
   m_create_texture_target_to_actions.clear();
   m_efb_target_to_actions.clear();
   m_xfb_target_to_actions.clear();
+  m_projection_texture_filter.Clear();
+  m_draw_started_filter.Clear();
+  m_load_texture_filter.Clear();
+  m_create_texture_filter.Clear();
 }
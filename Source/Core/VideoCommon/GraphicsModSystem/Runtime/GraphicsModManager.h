@@ -3,13 +3,16 @@
 
 #pragma once
 
+#include <bitset>
 #include <list>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModAction.h"
 #include "VideoCommon/TextureInfo.h"
@@ -43,6 +46,20 @@ private:
 
   class DecoratedAction;
 
+  // A bloom filter over the texture names of a target map.  Most draws and textures aren't
+  // targeted by any mod, and this rejects nearly all of them without a map lookup.
+  class TargetNameFilter
+  {
+  public:
+    void Insert(std::string_view name);
+    bool MayContain(std::string_view name) const;
+    void Clear() { m_bits.reset(); }
+
+  private:
+    static constexpr u32 NUM_BITS = 1 << 14;
+    std::bitset<NUM_BITS> m_bits;
+  };
+
   static inline const std::vector<GraphicsModAction*> m_default = {};
   std::list<std::unique_ptr<GraphicsModAction>> m_actions;
   std::unordered_map<ProjectionType, std::vector<GraphicsModAction*>>
@@ -56,6 +73,12 @@ private:
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_efb_target_to_actions;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_xfb_target_to_actions;
 
+  // The projection filter holds the texture names without the projection type suffix
+  TargetNameFilter m_projection_texture_filter;
+  TargetNameFilter m_draw_started_filter;
+  TargetNameFilter m_load_texture_filter;
+  TargetNameFilter m_create_texture_filter;
+
   std::unordered_set<std::string> m_groups;
 
   Common::EventHook m_end_of_frame_event;
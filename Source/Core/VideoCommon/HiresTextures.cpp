@@ -19,6 +19,7 @@
 #include "Common/CommonPaths.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/IniFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Core/Config/GraphicsSettings.h"
@@ -26,6 +27,9 @@
 #include "Core/System.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+#include "VideoCommon/Assets/TextureTranscoder.h"
+#include "VideoCommon/Assets/ZipAssetLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -36,8 +40,36 @@ static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 
+// Textures which are stored in a texture pack or a resource pack rather than as loose files
+static std::unordered_map<std::string, std::shared_ptr<VideoCommon::CustomAssetLibrary>>
+    s_hires_texture_id_to_pack;
+
 namespace
 {
+std::shared_ptr<VideoCommon::CustomAssetLibrary> GetLibrary(const std::string& texture_id)
+{
+  if (auto iter = s_hires_texture_id_to_pack.find(texture_id);
+      iter != s_hires_texture_id_to_pack.end())
+  {
+    return iter->second;
+  }
+  return s_file_library;
+}
+
+// The resource pack manager lists the installed packs in Packs.ini, highest priority first.
+std::vector<std::string> GetInstalledResourcePacks()
+{
+  Common::IniFile file;
+  file.Load(File::GetUserPath(D_RESOURCEPACK_IDX) + "/Packs.ini");
+
+  std::vector<std::string> paths;
+  const Common::IniFile::Section* section = file.GetSection("InstalledPaths");
+  std::string path;
+  while (section && section->Get(std::to_string(paths.size()), &path))
+    paths.push_back(std::move(path));
+  return paths;
+}
+
 std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 {
   if (s_hires_texture_id_to_arbmipmap.empty())
@@ -79,6 +111,7 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 void HiresTexture::Shutdown()
 {
   Clear();
+  VideoCommon::TextureTranscoder::Shutdown();
 }
 
 void HiresTexture::Update()
@@ -94,15 +127,80 @@ void HiresTexture::Update()
       GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
   const std::vector<std::string> extensions{".png", ".dds"};
 
+  // Installed resource packs are read straight from their zip files, and take priority over loose
+  // textures.
+  for (const std::string& pack_path : GetInstalledResourcePacks())
+  {
+    const auto pack = VideoCommon::ZipAssetLibrary::Open(pack_path, game_id);
+    if (!pack)
+      continue;
+
+    s_hires_texture_id_to_arbmipmap.reserve(s_hires_texture_id_to_arbmipmap.size() +
+                                            pack->GetNumTextures());
+    pack->ForEachTexture([&](const VideoCommon::ZipAssetLibrary::TextureEntry& entry) {
+      std::string texture_id(entry.name);
+      const auto [it, inserted] =
+          s_hires_texture_id_to_arbmipmap.try_emplace(texture_id, entry.has_arbitrary_mipmaps);
+      // A higher priority pack already provides this texture
+      if (!inserted)
+        return;
+
+      s_hires_texture_id_to_pack.try_emplace(texture_id, pack);
+      if (g_ActiveConfig.bCacheHiresTextures)
+      {
+        auto hires_texture =
+            std::make_shared<HiresTexture>(entry.has_arbitrary_mipmaps, texture_id);
+        hires_texture->Preload();
+        s_hires_texture_cache.try_emplace(std::move(texture_id), std::move(hires_texture));
+      }
+    });
+  }
+
   for (const auto& texture_directory : texture_directories)
   {
     // Watch this directory for any texture reloads
     s_file_library->Watch(texture_directory);
 
+    bool failed_insert = false;
+
+    // Texture packs already carry a sorted index, so only the index is read here and the texture
+    // data is read from the pack on demand
+    const auto pack_paths =
+        Common::DoFileSearch({texture_directory},
+                             {std::string(VideoCommon::TexturePackAssetLibrary::FILE_EXTENSION)},
+                             /*recursive*/ true);
+    for (const auto& pack_path : pack_paths)
+    {
+      const auto pack = VideoCommon::TexturePackAssetLibrary::Open(pack_path);
+      if (!pack)
+        continue;
+
+      s_hires_texture_id_to_arbmipmap.reserve(s_hires_texture_id_to_arbmipmap.size() +
+                                              pack->GetNumTextures());
+      pack->ForEachTexture([&](const VideoCommon::TexturePackAssetLibrary::TextureEntry& entry) {
+        std::string texture_id(entry.name);
+        const auto [it, inserted] =
+            s_hires_texture_id_to_arbmipmap.try_emplace(texture_id, entry.has_arbitrary_mipmaps);
+        if (!inserted)
+        {
+          failed_insert = true;
+          return;
+        }
+
+        s_hires_texture_id_to_pack.try_emplace(texture_id, pack);
+        if (g_ActiveConfig.bCacheHiresTextures)
+        {
+          auto hires_texture =
+              std::make_shared<HiresTexture>(entry.has_arbitrary_mipmaps, texture_id);
+          hires_texture->Preload();
+          s_hires_texture_cache.try_emplace(std::move(texture_id), std::move(hires_texture));
+        }
+      });
+    }
+
     const auto texture_paths =
         Common::DoFileSearch({texture_directory}, extensions, /*recursive*/ true);
 
-    bool failed_insert = false;
     for (auto& path : texture_paths)
     {
       std::string filename;
@@ -132,7 +230,7 @@ void HiresTexture::Update()
           {
             auto hires_texture =
                 std::make_shared<HiresTexture>(has_arbitrary_mipmaps, std::move(filename));
-            static_cast<void>(hires_texture->LoadTexture());
+            hires_texture->Preload();
             s_hires_texture_cache.try_emplace(hires_texture->GetId(), hires_texture);
           }
         }
@@ -162,6 +260,7 @@ void HiresTexture::Clear()
 {
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
+  s_hires_texture_id_to_pack.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 }
 
@@ -195,7 +294,14 @@ VideoCommon::CustomResourceManager::TextureTimePair HiresTexture::LoadTexture()
 {
   auto& system = Core::System::GetInstance();
   auto& custom_resource_manager = system.GetCustomResourceManager();
-  return custom_resource_manager.GetTextureDataFromAsset(m_id, s_file_library);
+  return custom_resource_manager.GetTextureDataFromAsset(m_id, GetLibrary(m_id));
+}
+
+void HiresTexture::Preload() const
+{
+  auto& system = Core::System::GetInstance();
+  auto& custom_resource_manager = system.GetCustomResourceManager();
+  custom_resource_manager.PreloadTextureDataFromAsset(m_id, GetLibrary(m_id));
 }
 
 std::set<std::string> GetTextureDirectoriesWithGameId(const std::string& root_directory,
@@ -31,6 +31,7 @@ public:
 
   bool HasArbitraryMipmaps() const { return m_has_arbitrary_mipmaps; }
   VideoCommon::CustomResourceManager::TextureTimePair LoadTexture() const;
+  void Preload() const;
   const std::string& GetId() const { return m_id; }
 
 private:
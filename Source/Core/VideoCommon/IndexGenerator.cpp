@@ -3,11 +3,17 @@
 
 #include "VideoCommon/IndexGenerator.h"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
 
+#if defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VideoConfig.h"
@@ -27,10 +33,157 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
   return index_ptr;
 }
 
+// Most primitives turn into a fixed pattern of indices which repeats every few vertices. The
+// bulk of those is written a vector at a time, by adding the first vertex of each group of
+// repetitions to a precomputed pattern covering a whole number of vectors. Only whole groups are
+// written, so nothing is written past the indices of the primitive, and the rest is left to the
+// scalar code.
+template <size_t N>
+struct IndexPattern
+{
+  static_assert(N % 8 == 0, "Patterns must consist of whole vectors of 8 indices");
+
+  std::array<u16, N> indices{};
+  // Zero for indices which are the same in every group, like the center of a fan
+  std::array<u16, N> advancing{};
+  // How far the indices advance between groups
+  u32 advance = 0;
+};
+
+// Builds a pattern from period, repeated for every period_advance vertices. Restart indices stay
+// as they are, and the index in fixed_lane (if any) doesn't advance.
+template <size_t N, size_t P>
+constexpr IndexPattern<N> MakePattern(const std::array<u16, P>& period, u32 period_advance,
+                                      size_t fixed_lane = P)
+{
+  static_assert(N % P == 0);
+
+  IndexPattern<N> pattern;
+  for (size_t i = 0; i < N; ++i)
+  {
+    const size_t lane = i % P;
+    const u32 repetition = static_cast<u32>(i / P);
+    if (period[lane] == s_primitive_restart || lane == fixed_lane)
+    {
+      pattern.indices[i] = period[lane];
+      pattern.advancing[i] = lane == fixed_lane ? 0 : UINT16_MAX;
+    }
+    else
+    {
+      pattern.indices[i] = static_cast<u16>(period[lane] + repetition * period_advance);
+      pattern.advancing[i] = UINT16_MAX;
+    }
+  }
+  pattern.advance = period_advance * static_cast<u32>(N / P);
+  return pattern;
+}
+
+// Writes num_groups repetitions of the pattern, starting at index. Adding with unsigned saturation
+// keeps restart indices intact, and can't affect any other index since those are lower than the
+// restart index.
+template <size_t N>
+u16* WritePattern(u16* index_ptr, const IndexPattern<N>& pattern, u32 num_groups, u32 index)
+{
+#if defined(_M_X86_64)
+  const __m128i fixed_base = _mm_set1_epi16(static_cast<s16>(index));
+  for (u32 group = 0; group < num_groups; ++group)
+  {
+    const __m128i base = _mm_set1_epi16(static_cast<s16>(index + group * pattern.advance));
+    for (size_t i = 0; i < N; i += 8)
+    {
+      const __m128i indices =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.indices[i]));
+      const __m128i advancing =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.advancing[i]));
+      const __m128i offset =
+          _mm_or_si128(_mm_and_si128(advancing, base), _mm_andnot_si128(advancing, fixed_base));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr), _mm_adds_epu16(indices, offset));
+      index_ptr += 8;
+    }
+  }
+#elif defined(_M_ARM_64)
+  const uint16x8_t fixed_base = vdupq_n_u16(static_cast<u16>(index));
+  for (u32 group = 0; group < num_groups; ++group)
+  {
+    const uint16x8_t base = vdupq_n_u16(static_cast<u16>(index + group * pattern.advance));
+    for (size_t i = 0; i < N; i += 8)
+    {
+      const uint16x8_t indices = vld1q_u16(&pattern.indices[i]);
+      const uint16x8_t advancing = vld1q_u16(&pattern.advancing[i]);
+      const uint16x8_t offset = vbslq_u16(advancing, base, fixed_base);
+      vst1q_u16(index_ptr, vqaddq_u16(indices, offset));
+      index_ptr += 8;
+    }
+  }
+#else
+  for (u32 group = 0; group < num_groups; ++group)
+  {
+    const u32 base = index + group * pattern.advance;
+    for (size_t i = 0; i < N; ++i)
+    {
+      const u32 offset = pattern.advancing[i] ? base : index;
+      *index_ptr++ = static_cast<u16>(std::min<u32>(pattern.indices[i] + offset, UINT16_MAX));
+    }
+  }
+#endif
+  return index_ptr;
+}
+
+constexpr u16 R = s_primitive_restart;
+
+// The patterns have the same layout as the scalar code below, relative to the first vertex
+constexpr auto s_list_pattern = MakePattern<24>(std::array<u16, 3>{0, 1, 2}, 3);
+constexpr auto s_list_pr_pattern = MakePattern<24>(std::array<u16, 4>{0, 1, 2, R}, 3);
+constexpr auto s_sequence_pattern = MakePattern<8>(std::array<u16, 1>{0}, 1);
+constexpr auto s_strip_pattern = MakePattern<24>(std::array<u16, 6>{0, 1, 2, 1, 3, 2}, 2);
+constexpr auto s_fan_pattern = MakePattern<24>(std::array<u16, 3>{0, 1, 2}, 1, 0);
+constexpr auto s_fan_pr_pattern = MakePattern<24>(std::array<u16, 6>{1, 2, 0, 3, 4, R}, 3, 2);
+constexpr auto s_quad_pattern = MakePattern<24>(std::array<u16, 6>{0, 1, 2, 0, 2, 3}, 4);
+constexpr auto s_quad_pr_pattern = MakePattern<40>(std::array<u16, 5>{1, 2, 0, 3, R}, 4);
+constexpr auto s_line_strip_pattern = MakePattern<8>(std::array<u16, 2>{0, 1}, 1);
+
+// Vertex shader expansion uses four indices per vertex
+template <bool pr, u32 vertex_advance>
+constexpr auto MakeLinesVSExpandPattern()
+{
+  if constexpr (pr)
+    return MakePattern<40>(std::array<u16, 5>{0, 1, 6, 7, R}, vertex_advance * 4);
+  else
+    return MakePattern<24>(std::array<u16, 6>{0, 1, 6, 1, 6, 7}, vertex_advance * 4);
+}
+
+template <bool pr>
+constexpr auto MakePointsVSExpandPattern()
+{
+  if constexpr (pr)
+    return MakePattern<40>(std::array<u16, 5>{0, 1, 2, 3, R}, 4);
+  else
+    return MakePattern<24>(std::array<u16, 6>{0, 1, 2, 1, 2, 3}, 4);
+}
+
+// Writes as many whole groups of the pattern as fit in num_verts vertices, and returns the number
+// of vertices they covered.
+template <size_t N>
+u32 WritePatternGroups(u16*& index_ptr, const IndexPattern<N>& pattern, u32 num_verts, u32 index)
+{
+  const u32 num_groups = num_verts / pattern.advance;
+  index_ptr = WritePattern(index_ptr, pattern, num_groups, index);
+  return num_groups * pattern.advance;
+}
+
+// Number of triangles in strips and fans, which is also the number of vertices covered by their
+// patterns
+u32 GetNumStripTriangles(u32 num_verts)
+{
+  return num_verts >= 2 ? num_verts - 2 : 0;
+}
+
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  const u32 covered = WritePatternGroups(index_ptr, pr ? s_list_pr_pattern : s_list_pattern,
+                                         num_verts, index);
+  for (u32 i = 2 + covered; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -42,7 +195,8 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    const u32 covered = WritePatternGroups(index_ptr, s_sequence_pattern, num_verts, index);
+    for (u32 i = covered; i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -50,8 +204,11 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    // The pattern covers an even number of triangles, so the winding starts out the same
+    const u32 covered =
+        WritePatternGroups(index_ptr, s_strip_pattern, GetNumStripTriangles(num_verts), index);
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = 2 + covered; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -84,6 +241,8 @@ template <bool pr>
 u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 {
   u32 i = 2;
+  i += WritePatternGroups(index_ptr, pr ? s_fan_pr_pattern : s_fan_pattern,
+                          GetNumStripTriangles(num_verts), index);
 
   if constexpr (pr)
   {
@@ -135,6 +294,10 @@ template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
   u32 i = 3;
+  if constexpr (pr)
+    i += WritePatternGroups(index_ptr, s_quad_pr_pattern, num_verts, index);
+  else
+    i += WritePatternGroups(index_ptr, s_quad_pattern, num_verts, index);
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -161,6 +324,17 @@ u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
   return index_ptr;
 }
 
+template <bool pr>
+u16* AddTriangleList(u16* index_ptr, std::span<const u16> triangles, u32 index)
+{
+  for (size_t i = 0; i < triangles.size(); i += 3)
+  {
+    index_ptr = WriteTriangle<pr>(index_ptr, index + triangles[i], index + triangles[i + 1],
+                                  index + triangles[i + 2]);
+  }
+  return index_ptr;
+}
+
 template <bool pr>
 u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
 {
@@ -170,7 +344,8 @@ u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; i += 2)
+  const u32 covered = WritePatternGroups(index_ptr, s_sequence_pattern, num_verts, index);
+  for (u32 i = 1 + covered; i < num_verts; i += 2)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -182,7 +357,9 @@ u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 // so converting them to lists
 u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; ++i)
+  const u32 num_lines = num_verts >= 1 ? num_verts - 1 : 0;
+  const u32 covered = WritePatternGroups(index_ptr, s_line_strip_pattern, num_lines, index);
+  for (u32 i = 1 + covered; i < num_verts; ++i)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -198,7 +375,13 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
   // Bit 1 indicates which point of the line (top/bottom for a vertical line)
   // VS Expand assumes the two points will be adjacent vertices
   constexpr u32 advance = linestrip ? 1 : 2;
-  for (u32 i = 1; i < num_verts; i += advance)
+  static constexpr auto pattern = MakeLinesVSExpandPattern<pr, advance>();
+  constexpr u32 lines_per_group = pattern.advance / (advance * 4);
+  const u32 num_lines = linestrip ? (num_verts >= 1 ? num_verts - 1 : 0) : num_verts / 2;
+  const u32 num_groups = num_lines / lines_per_group;
+  index_ptr = WritePattern(index_ptr, pattern, num_groups, index << 2);
+
+  for (u32 i = 1 + num_groups * lines_per_group * advance; i < num_verts; i += advance)
   {
     u32 p0 = (index + i - 1) << 2;
     u32 p1 = (index + i - 0) << 2;
@@ -225,7 +408,8 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
+  const u32 covered = WritePatternGroups(index_ptr, s_sequence_pattern, num_verts, index);
+  for (u32 i = covered; i != num_verts; ++i)
   {
     *index_ptr++ = index + i;
   }
@@ -237,7 +421,12 @@ u16* AddPoints_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 {
   // VS Expand uses (index >> 2) as the base vertex
   // Bottom two bits indicate which of (TL, TR, BL, BR) this is
-  for (u32 i = 0; i < num_verts; ++i)
+  static constexpr auto pattern = MakePointsVSExpandPattern<pr>();
+  constexpr u32 points_per_group = pattern.advance / 4;
+  const u32 num_groups = num_verts / points_per_group;
+  index_ptr = WritePattern(index_ptr, pattern, num_groups, index << 2);
+
+  for (u32 i = num_groups * points_per_group; i < num_verts; ++i)
   {
     u32 base = (index + i) << 2;
     if constexpr (pr)
@@ -266,6 +455,7 @@ void IndexGenerator::Init()
 {
   using OpcodeDecoder::Primitive;
 
+  m_primitive_restart = g_backend_info.bSupportsPrimitiveRestart;
   if (g_backend_info.bSupportsPrimitiveRestart)
   {
     m_primitive_table[Primitive::GX_DRAW_QUADS] = AddQuads<true>;
@@ -319,6 +509,31 @@ void IndexGenerator::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vert
   m_base_index += num_vertices;
 }
 
+bool IndexGenerator::AddTriangles(OpcodeDecoder::Primitive primitive,
+                                  std::span<const u16> triangles, u32 num_vertices)
+{
+  if (m_primitive_restart)
+  {
+    // Without primitive restart, every primitive is written as a list of the same triangles
+    // anyway, as are triangle lists with it. The strips used for everything else take at least
+    // one index per vertex, which is enough for the triangles if at most a quarter remain.
+    if (primitive != OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES &&
+        triangles.size() / 3 * 4 > num_vertices)
+    {
+      return false;
+    }
+    m_index_buffer_current = AddTriangleList<true>(m_index_buffer_current, triangles, m_base_index);
+  }
+  else
+  {
+    m_index_buffer_current =
+        AddTriangleList<false>(m_index_buffer_current, triangles, m_base_index);
+  }
+
+  m_base_index += num_vertices;
+  return true;
+}
+
 void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices)
 {
   std::memcpy(m_index_buffer_current, indices, sizeof(u16) * num_indices);
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -20,6 +22,12 @@ public:
 
   void AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices);
 
+  // Adds only the given triangles of the primitive, as triples of indices relative to its first
+  // vertex. Returns false without adding anything if this could need more indices than AddIndices,
+  // since only that many were reserved.
+  bool AddTriangles(OpcodeDecoder::Primitive primitive, std::span<const u16> triangles,
+                    u32 num_vertices);
+
   // returns numprimitives
   u32 GetNumVerts() const { return m_base_index; }
   u32 GetIndexLen() const { return static_cast<u32>(m_index_buffer_current - m_base_index_ptr); }
@@ -29,6 +37,7 @@ private:
   u16* m_index_buffer_current = nullptr;
   u16* m_base_index_ptr = nullptr;
   u32 m_base_index = 0;
+  bool m_primitive_restart = false;
 
   using PrimitiveFunction = u16* (*)(u16*, u32, u32);
   Common::EnumMap<PrimitiveFunction, OpcodeDecoder::Primitive::GX_DRAW_POINTS> m_primitive_table{};
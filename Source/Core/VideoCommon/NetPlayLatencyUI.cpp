@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/NetPlayLatencyUI.h"
+
+#include <algorithm>
+
+#include <imgui.h>
+#include <implot.h>
+
+#include "Common/Timer.h"
+#include "Core/NetPlayClient.h"
+
+constexpr float DEFAULT_WINDOW_WIDTH = 320.0f;
+constexpr float DEFAULT_WINDOW_HEIGHT = 160.0f;
+
+std::unique_ptr<NetPlayLatencyUI> g_netplay_latency_ui;
+
+NetPlayLatencyUI::NetPlayLatencyUI(std::shared_ptr<NetPlay::NetPlayClient> netplay_client)
+    : m_netplay_client{netplay_client}
+{
+}
+
+NetPlayLatencyUI::~NetPlayLatencyUI() = default;
+
+void NetPlayLatencyUI::Display()
+{
+  auto client = m_netplay_client.lock();
+  if (!client)
+    return;
+
+  const u64 now = Common::Timer::NowMs();
+  if (m_num_samples == 0 || now - m_last_sample_ms >= SAMPLE_INTERVAL_MS)
+  {
+    m_ping_samples[m_next_sample] = static_cast<float>(client->GetMaxPing());
+    m_buffer_samples[m_next_sample] = static_cast<float>(client->GetPadBufferSize());
+    m_next_sample = (m_next_sample + 1) % NUM_SAMPLES;
+    m_num_samples = std::min(m_num_samples + 1, NUM_SAMPLES);
+    m_last_sample_ms = now;
+  }
+
+  const float scale = ImGui::GetIO().DisplayFramebufferScale.x;
+
+  ImGui::SetNextWindowPos(ImVec2(10.0f * scale, 70.0f * scale), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2(DEFAULT_WINDOW_WIDTH * scale, DEFAULT_WINDOW_HEIGHT * scale),
+                           ImGuiCond_FirstUseEver);
+
+  // TODO: Translate these strings once imgui has multilingual fonts
+  if (!ImGui::Begin("Latency", nullptr, ImGuiWindowFlags_None))
+  {
+    ImGui::End();
+    return;
+  }
+
+  const size_t oldest = m_num_samples == NUM_SAMPLES ? m_next_sample : 0;
+  const int count = static_cast<int>(m_num_samples);
+  const int offset = static_cast<int>(oldest);
+  const float max_ping =
+      *std::max_element(m_ping_samples.begin(), m_ping_samples.begin() + m_num_samples);
+  const float max_buffer =
+      *std::max_element(m_buffer_samples.begin(), m_buffer_samples.begin() + m_num_samples);
+
+  if (ImPlot::BeginPlot("LatencyGraph", ImVec2(-1.0f, -1.0f),
+                        ImPlotFlags_NoTitle | ImPlotFlags_NoMenus | ImPlotFlags_NoInputs))
+  {
+    ImPlot::SetupAxis(ImAxis_X1, nullptr, ImPlotAxisFlags_NoDecorations);
+    ImPlot::SetupAxis(ImAxis_Y1, "Ping (ms)");
+    ImPlot::SetupAxis(ImAxis_Y2, "Buffer", ImPlotAxisFlags_Opposite);
+    ImPlot::SetupAxisLimits(ImAxis_X1, 0, NUM_SAMPLES - 1, ImGuiCond_Always);
+    ImPlot::SetupAxisLimits(ImAxis_Y1, 0, std::max(max_ping * 1.2f, 10.0f), ImGuiCond_Always);
+    ImPlot::SetupAxisLimits(ImAxis_Y2, 0, std::max(max_buffer * 1.2f, 5.0f), ImGuiCond_Always);
+    ImPlot::SetupLegend(ImPlotLocation_NorthWest, ImPlotLegendFlags_None);
+
+    ImPlot::SetAxes(ImAxis_X1, ImAxis_Y1);
+    ImPlot::PlotLine("Ping", m_ping_samples.data(), count, 1.0, 0.0, ImPlotLineFlags_None,
+                     offset);
+    ImPlot::SetAxes(ImAxis_X1, ImAxis_Y2);
+    ImPlot::PlotStairs("Buffer", m_buffer_samples.data(), count, 1.0, 0.0, ImPlotStairsFlags_None,
+                       offset);
+    ImPlot::EndPlot();
+  }
+
+  ImGui::End();
+}
@@ -0,0 +1,39 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+
+namespace NetPlay
+{
+class NetPlayClient;
+}
+
+// Graph of the highest ping of all players and the pad buffer size over time.
+class NetPlayLatencyUI
+{
+public:
+  explicit NetPlayLatencyUI(std::shared_ptr<NetPlay::NetPlayClient> netplay_client);
+  ~NetPlayLatencyUI();
+
+  void Display();
+
+private:
+  static constexpr size_t NUM_SAMPLES = 120;
+  static constexpr u64 SAMPLE_INTERVAL_MS = 500;
+
+  std::weak_ptr<NetPlay::NetPlayClient> m_netplay_client;
+
+  // Ring buffers, with m_next_sample being the oldest sample once they are full
+  std::array<float, NUM_SAMPLES> m_ping_samples{};
+  std::array<float, NUM_SAMPLES> m_buffer_samples{};
+  size_t m_num_samples = 0;
+  size_t m_next_sample = 0;
+  u64 m_last_sample_ms = 0;
+};
+
+extern std::unique_ptr<NetPlayLatencyUI> g_netplay_latency_ui;
@@ -4,7 +4,6 @@
 #include "VideoCommon/OnScreenUI.h"
 
 #include "Common/EnumMap.h"
-#include "Common/Profiler.h"
 #include "Common/Timer.h"
 
 #include "Core/AchievementManager.h"
@@ -21,6 +20,7 @@
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/NetPlayChatUI.h"
 #include "VideoCommon/NetPlayGolfUI.h"
+#include "VideoCommon/NetPlayLatencyUI.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/Present.h"
@@ -28,6 +28,7 @@
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoConfig.h"
 
+#include <array>
 #include <inttypes.h>
 #include <mutex>
 
@@ -203,9 +204,10 @@ void OnScreenUI::DrawImGui()
   struct ImGuiUbo
   {
     float u_rcp_viewport_size_mul2[2];
-    float padding[2];
+    std::array<float, 2> u_clip_space_rotation;
   };
-  ImGuiUbo ubo = {{1.0f / m_backbuffer_width * 2.0f, 1.0f / m_backbuffer_height * 2.0f}};
+  ImGuiUbo ubo = {{1.0f / m_backbuffer_width * 2.0f, 1.0f / m_backbuffer_height * 2.0f},
+                  g_gfx->GetClipSpaceRotation()};
 
   // Set up common state for drawing.
   g_gfx->SetPipeline(m_imgui_pipeline.get());
@@ -305,15 +307,17 @@ void OnScreenUI::DrawDebugText()
   if (Config::Get(Config::NETPLAY_GOLF_MODE_OVERLAY) && g_netplay_golf_ui)
     g_netplay_golf_ui->Display();
 
+  if (Config::Get(Config::NETPLAY_LATENCY_GRAPH_OVERLAY) && g_netplay_latency_ui)
+    g_netplay_latency_ui->Display();
+
   if (g_ActiveConfig.bOverlayProjStats)
     g_stats.DisplayProj();
 
   if (g_ActiveConfig.bOverlayScissorStats)
     g_stats.DisplayScissor();
 
-  const std::string profile_output = Common::Profiler::ToString();
-  if (!profile_output.empty())
-    ImGui::TextUnformatted(profile_output.c_str());
+  if (g_ActiveConfig.bOverlayGPUTimings)
+    g_stats.DisplayGPUTimings();
 }
 
 void OnScreenUI::DrawChallengesAndLeaderboards()
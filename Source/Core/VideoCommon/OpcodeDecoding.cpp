@@ -56,7 +56,13 @@ public:
     const u8 sub_command = command & CP_COMMAND_MASK;
     if constexpr (!is_preprocess)
     {
-      if (sub_command == MATINDEX_A)
+      // Games often rewrite registers with the values they already have. Those writes don't need
+      // the vertex loaders to be looked up or the CP and XF state to be checked again.
+      if (GetCPState().IsRedundantWrite(command, value))
+      {
+        INCSTAT(g_stats.this_frame.num_redundant_state_writes);
+      }
+      else if (sub_command == MATINDEX_A)
       {
         VertexLoaderManager::g_needs_cp_xf_consistency_check = true;
         auto& system = Core::System::GetInstance();
@@ -130,8 +136,8 @@ public:
     // load vertices
     const u32 size = vertex_size * num_vertices;
 
-    const u32 bytes =
-        VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices, vertex_data);
+    const u32 bytes = VertexLoaderManager::RunVertices<is_preprocess>(
+        vat, primitive, num_vertices, vertex_data, m_display_list_in_memory);
 
     ASSERT(bytes == size);
 
@@ -180,6 +186,7 @@ public:
         {
           auto& memory = system.GetMemory();
           start_address = memory.GetPointerForRange(address, size);
+          m_display_list_in_memory = true;
         }
 
         // Avoid the crash if memory.GetPointerForRange failed ..
@@ -197,6 +204,7 @@ public:
       }
 
       m_in_display_list = false;
+      m_display_list_in_memory = false;
     }
   }
   OPCODE_CALLBACK(void OnNop(u32 count))
@@ -255,6 +263,9 @@ public:
 
   u32 m_cycles = 0;
   bool m_in_display_list = false;
+  // Set while running a display list straight from emulated memory, which allows the vertex
+  // loader to cache its output by address.
+  bool m_display_list_in_memory = false;
 };
 
 template <bool is_preprocess>
@@ -60,6 +60,10 @@ public:
   // carefully!
   virtual void FlushResults() {}
 
+  // Accumulate the results of any queries the GPU has already completed, and make sure the rest
+  // get submitted, without waiting for them. Backends which can't do this flush instead.
+  virtual void PollResults() { FlushResults(); }
+
   // True if there are no further pending query results
   // NOTE: Called from CPU thread
   virtual bool IsFlushed() const { return true; }
@@ -4,11 +4,19 @@
 #include "VideoCommon/PerformanceMetrics.h"
 
 #include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
 
+#include <fmt/format.h>
 #include <imgui.h>
 #include <implot.h>
 
+#include "Common/Logging/Log.h"
 #include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/CoreTiming.h"
+#include "Core/System.h"
 #include "VideoCommon/VideoConfig.h"
 
 PerformanceMetrics g_perf_metrics;
@@ -19,15 +27,141 @@ void PerformanceMetrics::Reset()
   m_vps_counter.Reset();
 
   m_time_sleeping = DT::zero();
+  m_cpu_sleep = 0;
   m_samples = {};
 
   m_speed = 0;
   m_max_speed = 0;
+
+  m_gpu_idle = 0;
+  m_cpu_wait = 0;
+  m_last_frame_gpu_idle = 0;
+  m_last_frame_cpu_wait = 0;
+  for (int i = 0; i < NUM_INPUT_PORTS + NUM_WII_REMOTES; ++i)
+  {
+    m_input_age[i] = -1;
+    m_last_frame_input_age[i] = -1;
+  }
+
+  m_frame_times.Reset();
+  StartExport();
 }
 
 void PerformanceMetrics::CountFrame()
 {
-  m_fps_counter.Count();
+  const std::optional<DT> frame_time = m_fps_counter.Count();
+  if (frame_time)
+    m_frame_times.Push(*frame_time);
+
+  const DT gpu_idle{m_gpu_idle.exchange(0, std::memory_order_relaxed)};
+  const DT cpu_wait{m_cpu_wait.exchange(0, std::memory_order_relaxed)};
+  const DT cpu_sleep{m_cpu_sleep.exchange(0, std::memory_order_relaxed)};
+  m_last_frame_gpu_idle.store(gpu_idle.count(), std::memory_order_relaxed);
+  m_last_frame_cpu_wait.store(cpu_wait.count(), std::memory_order_relaxed);
+  for (int i = 0; i < NUM_INPUT_PORTS + NUM_WII_REMOTES; ++i)
+  {
+    m_last_frame_input_age[i].store(m_input_age[i].exchange(-1, std::memory_order_relaxed),
+                                    std::memory_order_relaxed);
+  }
+
+  if (m_export_file)
+  {
+    if (frame_time)
+      m_interval_frame_times.Push(*frame_time);
+    UpdateExport(Clock::now(), gpu_idle, cpu_wait, cpu_sleep);
+  }
+}
+
+void PerformanceMetrics::StartExport()
+{
+  m_export_file.Close();
+
+  const std::string path = Config::Get(Config::GFX_PERF_EXPORT_FILE);
+  if (path.empty())
+    return;
+
+  if (!m_export_file.Open(path, "w"))
+  {
+    ERROR_LOG_FMT(VIDEO, "Could not open performance export file {}", path);
+    return;
+  }
+
+  m_export_json = path.ends_with(".json");
+  m_export_interval =
+      std::chrono::milliseconds{std::max(1, Config::Get(Config::GFX_PERF_EXPORT_INTERVAL))};
+  m_export_start_time = Clock::now();
+  m_interval_start_time = m_export_start_time;
+  m_interval_frame_times.Reset();
+  m_interval_gpu_idle = DT::zero();
+  m_interval_cpu_wait = DT::zero();
+  m_interval_cpu_sleep = DT::zero();
+
+  if (!m_export_json)
+  {
+    m_export_file.WriteString("time_s,frames,fps,avg_ms,p50_ms,p99_ms,p99.9_ms,max_ms,"
+                              "low_1_fps,low_0.1_fps,speed,cpu_busy_pct,gpu_busy_pct\n");
+  }
+}
+
+void PerformanceMetrics::UpdateExport(TimePoint now, DT frame_gpu_idle, DT frame_cpu_wait,
+                                      DT frame_cpu_sleep)
+{
+  m_interval_gpu_idle += frame_gpu_idle;
+  m_interval_cpu_wait += frame_cpu_wait;
+  m_interval_cpu_sleep += frame_cpu_sleep;
+
+  const DT elapsed = now - m_interval_start_time;
+  if (elapsed < m_export_interval)
+    return;
+
+  const FrameTimeHistogram& frame_times = m_interval_frame_times;
+  const auto to_ms = [](DT time) { return DT_ms(time).count(); };
+  const auto to_fps = [](DT time) { return time > DT::zero() ? DT_s(1.0) / time : 0.0; };
+  const auto to_busy_pct = [elapsed](DT not_busy) {
+    return std::clamp(100.0 * (1.0 - DT_s(not_busy) / elapsed), 0.0, 100.0);
+  };
+
+  const double time = DT_s(now - m_export_start_time).count();
+  const u64 frames = frame_times.GetCount();
+  const double fps = frames / DT_s(elapsed).count();
+  const double avg_ms = frames ? to_ms(frame_times.GetTotal()) / frames : 0.0;
+  const DT p50 = frame_times.GetPercentile(0.5);
+  const DT p99 = frame_times.GetPercentile(0.99);
+  const DT p999 = frame_times.GetPercentile(0.999);
+  const double speed = GetSpeed();
+  const double cpu_busy = to_busy_pct(m_interval_cpu_wait + m_interval_cpu_sleep);
+  const double gpu_busy = to_busy_pct(m_interval_gpu_idle);
+
+  std::string line;
+  if (m_export_json)
+  {
+    fmt::format_to(std::back_inserter(line),
+                   R"({{"time_s":{:.3f},"frames":{},"fps":{:.2f},"avg_ms":{:.3f},)"
+                   R"("p50_ms":{:.3f},"p99_ms":{:.3f},"p99.9_ms":{:.3f},"max_ms":{:.3f},)"
+                   R"("low_1_fps":{:.2f},"low_0.1_fps":{:.2f},"speed":{:.4f},)"
+                   R"("cpu_busy_pct":{:.1f},"gpu_busy_pct":{:.1f}}})"
+                   "\n",
+                   time, frames, fps, avg_ms, to_ms(p50), to_ms(p99), to_ms(p999),
+                   to_ms(frame_times.GetMax()), to_fps(p99), to_fps(p999), speed, cpu_busy,
+                   gpu_busy);
+  }
+  else
+  {
+    fmt::format_to(std::back_inserter(line),
+                   "{:.3f},{},{:.2f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.2f},{:.2f},{:.4f},"
+                   "{:.1f},{:.1f}\n",
+                   time, frames, fps, avg_ms, to_ms(p50), to_ms(p99), to_ms(p999),
+                   to_ms(frame_times.GetMax()), to_fps(p99), to_fps(p999), speed, cpu_busy,
+                   gpu_busy);
+  }
+  m_export_file.WriteString(line);
+  m_export_file.Flush();
+
+  m_interval_start_time = now;
+  m_interval_frame_times.Reset();
+  m_interval_gpu_idle = DT::zero();
+  m_interval_cpu_wait = DT::zero();
+  m_interval_cpu_sleep = DT::zero();
 }
 
 void PerformanceMetrics::CountVBlank()
@@ -44,6 +178,32 @@ void PerformanceMetrics::OnEmulationStateChanged([[maybe_unused]] Core::State st
 void PerformanceMetrics::CountThrottleSleep(DT sleep)
 {
   m_time_sleeping += sleep;
+  m_cpu_sleep.fetch_add(sleep.count(), std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::CountGPUIdle(DT idle)
+{
+  m_gpu_idle.fetch_add(idle.count(), std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::CountCPUWait(DT wait)
+{
+  m_cpu_wait.fetch_add(wait.count(), std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::CountInputAge(int port, DT age)
+{
+  std::atomic<DT::rep>& input_age = m_input_age[port];
+  DT::rep oldest = input_age.load(std::memory_order_relaxed);
+  while (age.count() > oldest &&
+         !input_age.compare_exchange_weak(oldest, age.count(), std::memory_order_relaxed))
+  {
+  }
+}
+
+void PerformanceMetrics::CountWiiRemoteReportAge(int index, DT age)
+{
+  CountInputAge(NUM_INPUT_PORTS + index, age);
 }
 
 void PerformanceMetrics::AdjustClockSpeed(s64 ticks, u32 new_ppc_clock, u32 old_ppc_clock)
@@ -98,6 +258,24 @@ double PerformanceMetrics::GetMaxSpeed() const
   return m_max_speed.load(std::memory_order_relaxed);
 }
 
+DT PerformanceMetrics::GetLastFrameGPUIdle() const
+{
+  return DT(m_last_frame_gpu_idle.load(std::memory_order_relaxed));
+}
+
+DT PerformanceMetrics::GetLastFrameCPUWait() const
+{
+  return DT(m_last_frame_cpu_wait.load(std::memory_order_relaxed));
+}
+
+std::optional<DT> PerformanceMetrics::GetLastFrameInputAge(int port) const
+{
+  const DT::rep age = m_last_frame_input_age[port].load(std::memory_order_relaxed);
+  if (age < 0)
+    return std::nullopt;
+  return DT(age);
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   m_vps_counter.UpdateStats();
@@ -273,7 +451,14 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 
   if (g_ActiveConfig.bShowFPS || g_ActiveConfig.bShowFTimes)
   {
-    int count = g_ActiveConfig.bShowFPS + 2 * g_ActiveConfig.bShowFTimes;
+    std::array<std::optional<DT>, NUM_INPUT_PORTS + NUM_WII_REMOTES> input_ages;
+    int num_input_ages = 0;
+    for (int i = 0; i < NUM_INPUT_PORTS + NUM_WII_REMOTES; ++i)
+    {
+      input_ages[i] = GetLastFrameInputAge(i);
+      num_input_ages += input_ages[i].has_value();
+    }
+    int count = g_ActiveConfig.bShowFPS + (6 + num_input_ages) * g_ActiveConfig.bShowFTimes;
     float window_height = (12.f + 17.f * count) * backbuffer_scale;
 
     // Position in the top-right corner of the screen.
@@ -298,6 +483,30 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
                            DT_ms(m_fps_counter.GetDtAvg()).count());
         ImGui::TextColored(ImVec4(r, g, b, 1.0f), " ±:%6.2lfms",
                            DT_ms(m_fps_counter.GetDtStd()).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "1%%:%6.2lfms",
+                           DT_ms(m_frame_times.GetPercentile(0.99)).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), ".1%%:%5.2lfms",
+                           DT_ms(m_frame_times.GetPercentile(0.999)).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "idle:%5.2lfms",
+                           DT_ms(GetLastFrameGPUIdle()).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "wait:%5.2lfms",
+                           DT_ms(GetLastFrameCPUWait()).count());
+        for (int i = 0; i < NUM_INPUT_PORTS; ++i)
+        {
+          if (input_ages[i])
+          {
+            ImGui::TextColored(ImVec4(r, g, b, 1.0f), "in%d:%6.2lfms", i + 1,
+                               DT_ms(*input_ages[i]).count());
+          }
+        }
+        for (int i = 0; i < NUM_WII_REMOTES; ++i)
+        {
+          if (const std::optional<DT>& age = input_ages[NUM_INPUT_PORTS + i])
+          {
+            ImGui::TextColored(ImVec4(r, g, b, 1.0f), "wm%d:%6.2lfms", i + 1,
+                               DT_ms(*age).count());
+          }
+        }
       }
     }
     ImGui::End();
@@ -335,5 +544,33 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     ImGui::End();
   }
 
+  if (Config::Get(Config::MAIN_DEBUG_EVENT_PROFILING))
+  {
+    const std::vector<CoreTiming::EventProfile> profile =
+        Core::System::GetInstance().GetCoreTiming().GetEventProfile();
+    if (!profile.empty())
+    {
+      // Position in the bottom-right corner of the screen.
+      ImGui::SetNextWindowPos(
+          ImVec2(display_size.x - window_padding, display_size.y - window_padding),
+          set_next_position_condition, ImVec2(1.0f, 1.0f));
+      ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+      if (ImGui::Begin("EventStats", nullptr, imgui_flags))
+      {
+        clamp_window_position();
+        const size_t count = std::min<size_t>(profile.size(), 10);
+        for (size_t i = 0; i < count; ++i)
+        {
+          const CoreTiming::EventProfile& event = profile[i];
+          ImGui::TextUnformatted(fmt::format("{:<24}{:7.2f}ms {:6} calls", event.name,
+                                             DT_ms(event.time).count(), event.calls)
+                                     .c_str());
+        }
+      }
+      ImGui::End();
+    }
+  }
+
   ImGui::PopStyleVar(2);
 }
@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <deque>
+#include <optional>
+#include <string>
 
 #include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
 #include "Core/Core.h"
+#include "VideoCommon/FrameTimeHistogram.h"
 #include "VideoCommon/PerformanceTracker.h"
 
 namespace Core
@@ -18,6 +23,9 @@ class System;
 class PerformanceMetrics
 {
 public:
+  static constexpr int NUM_INPUT_PORTS = 4;
+  static constexpr int NUM_WII_REMOTES = 4;
+
   PerformanceMetrics() = default;
   ~PerformanceMetrics() = default;
 
@@ -37,16 +45,36 @@ public:
   void AdjustClockSpeed(s64 ticks, u32 new_ppc_clock, u32 old_ppc_clock);
   void CountPerformanceMarker(s64 ticks, u32 ticks_per_second);
 
+  // Time the GPU thread spent waiting for commands, and time the CPU thread spent waiting for the
+  // GPU thread. Both are totaled per presented frame. May be called from any thread.
+  void CountGPUIdle(DT idle);
+  void CountCPUWait(DT wait);
+
+  // How long ago the input read by the game from an emulated controller port was sampled from the
+  // host. The oldest one is kept per port and presented frame. May be called from any thread.
+  void CountInputAge(int port, DT age);
+  // The same for the data reports of a real Wii Remote.
+  void CountWiiRemoteReportAge(int index, DT age);
+
   // Getter Functions. May be called from any thread.
   double GetFPS() const;
   double GetVPS() const;
   double GetSpeed() const;
   double GetMaxSpeed() const;
+  DT GetLastFrameGPUIdle() const;
+  DT GetLastFrameCPUWait() const;
+  std::optional<DT> GetLastFrameInputAge(int port) const;
 
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
 
 private:
+  // Periodically writes frame time percentiles and thread busy percentages to the file set in
+  // Config::GFX_PERF_EXPORT_FILE. The file is JSON lines if its name ends with ".json", and CSV
+  // otherwise.
+  void StartExport();
+  void UpdateExport(TimePoint now, DT frame_gpu_idle, DT frame_cpu_wait, DT frame_cpu_sleep);
+
   PerformanceTracker m_fps_counter{"render_times.txt"};
   PerformanceTracker m_vps_counter{"vblank_times.txt"};
 
@@ -55,6 +83,14 @@ private:
   std::atomic<double> m_speed{};
   std::atomic<double> m_max_speed{};
 
+  std::atomic<DT::rep> m_gpu_idle{};
+  std::atomic<DT::rep> m_cpu_wait{};
+  std::atomic<DT::rep> m_last_frame_gpu_idle{};
+  std::atomic<DT::rep> m_last_frame_cpu_wait{};
+  // Negative if no input age was reported. The controller ports are followed by the Wii Remotes.
+  std::array<std::atomic<DT::rep>, NUM_INPUT_PORTS + NUM_WII_REMOTES> m_input_age{};
+  std::array<std::atomic<DT::rep>, NUM_INPUT_PORTS + NUM_WII_REMOTES> m_last_frame_input_age{};
+
   struct PerfSample
   {
     TimePoint clock_time;
@@ -64,6 +100,19 @@ private:
 
   std::deque<PerfSample> m_samples;
   DT m_time_sleeping{};
+  std::atomic<DT::rep> m_cpu_sleep{};
+
+  FrameTimeHistogram m_frame_times;
+
+  File::IOFile m_export_file;
+  bool m_export_json = false;
+  DT m_export_interval{};
+  TimePoint m_export_start_time{};
+  TimePoint m_interval_start_time{};
+  FrameTimeHistogram m_interval_frame_times;
+  DT m_interval_gpu_idle{};
+  DT m_interval_cpu_wait{};
+  DT m_interval_cpu_sleep{};
 };
 
 extern PerformanceMetrics g_perf_metrics;
@@ -0,0 +1,192 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PipelineMissReport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iterator>
+
+#include <fmt/format.h>
+
+#include "Common/Hash.h"
+
+namespace VideoCommon
+{
+namespace
+{
+const char* GetMissTypeName(PipelineMissType type)
+{
+  switch (type)
+  {
+  case PipelineMissType::SynchronousCompile:
+    return "Synchronous compile";
+  case PipelineMissType::UberShaderFallback:
+    return "Ubershader fallback";
+  case PipelineMissType::SkippedDraw:
+    return "Skipped draw";
+  default:
+    return "";
+  }
+}
+
+double ToMilliseconds(DT time)
+{
+  return std::chrono::duration<double, std::milli>(time).count();
+}
+
+template <typename UidType>
+u32 GetShaderHash(const UidType& uid)
+{
+  return Common::ComputeCRC32(uid.GetUidDataRaw(), uid.GetUidDataSize());
+}
+}  // namespace
+
+void PipelineMissReport::RecordMiss(PipelineMissType type, const GXPipelineUid& uid, bool known,
+                                    DT duration)
+{
+  const auto [it, inserted] = m_pipelines.try_emplace(uid);
+  Pipeline& pipeline = it->second;
+  if (inserted)
+  {
+    pipeline.first_miss = Clock::now() - m_start;
+    pipeline.first_type = type;
+    pipeline.known = known;
+  }
+
+  pipeline.misses[static_cast<size_t>(type)]++;
+  pipeline.compile_time += duration;
+}
+
+void PipelineMissReport::OnPipelineCompiled(const GXPipelineUid& uid)
+{
+  const auto it = m_pipelines.find(uid);
+  if (it == m_pipelines.end() || it->second.compiled)
+    return;
+
+  it->second.compiled = true;
+  it->second.compiled_at = Clock::now() - m_start;
+}
+
+void PipelineMissReport::RecordUberShaderCompile(DT duration)
+{
+  m_uber_shader_compiles++;
+  m_uber_shader_compile_time += duration;
+}
+
+DT PipelineMissReport::GetStallTime(const Pipeline& pipeline, TimePoint now) const
+{
+  if (pipeline.first_type == PipelineMissType::SynchronousCompile)
+    return pipeline.compile_time;
+
+  // Pipelines still compiling have held emulation up until now.
+  const DT ready = pipeline.compiled ? pipeline.compiled_at : now - m_start;
+  return pipeline.compile_time + std::max(ready - pipeline.first_miss, DT{});
+}
+
+std::vector<PipelineMissReport::PipelineMap::const_iterator>
+PipelineMissReport::GetSortedPipelines(TimePoint now) const
+{
+  std::vector<PipelineMap::const_iterator> pipelines;
+  pipelines.reserve(m_pipelines.size());
+  for (auto it = m_pipelines.begin(); it != m_pipelines.end(); ++it)
+    pipelines.push_back(it);
+
+  std::ranges::stable_sort(pipelines, std::ranges::greater{},
+                           [this, now](PipelineMap::const_iterator it) {
+                             return GetStallTime(it->second, now);
+                           });
+  return pipelines;
+}
+
+std::string PipelineMissReport::GetText(std::string_view game_id) const
+{
+  struct TypeSummary
+  {
+    u32 pipelines = 0;
+    u32 misses = 0;
+    DT stall_time{};
+    DT longest{};
+  };
+
+  const TimePoint now = Clock::now();
+  const std::vector<PipelineMap::const_iterator> pipelines = GetSortedPipelines(now);
+
+  std::array<TypeSummary, static_cast<size_t>(PipelineMissType::Count)> summaries{};
+  u32 known_pipelines = 0;
+  u32 pending_pipelines = 0;
+  for (const auto& it : pipelines)
+  {
+    const Pipeline& pipeline = it->second;
+    const DT stall_time = GetStallTime(pipeline, now);
+    TypeSummary& summary = summaries[static_cast<size_t>(pipeline.first_type)];
+    summary.pipelines++;
+    summary.stall_time += stall_time;
+    summary.longest = std::max(summary.longest, stall_time);
+    for (size_t i = 0; i < summaries.size(); i++)
+      summaries[i].misses += pipeline.misses[i];
+
+    if (pipeline.known)
+      known_pipelines++;
+    if (pipeline.first_type != PipelineMissType::SynchronousCompile && !pipeline.compiled)
+      pending_pipelines++;
+  }
+
+  std::string text;
+  auto out = std::back_inserter(text);
+  fmt::format_to(out, "Pipeline miss report for {}, recorded over {:.1f} s\n\n", game_id,
+                 std::chrono::duration<double>(now - m_start).count());
+
+  // Misses are counted per pipeline change rather than per draw.
+  fmt::format_to(out, "{:<24} {:>10} {:>10} {:>14} {:>14}\n", "Type", "Pipelines", "Misses",
+                 "Stall (ms)", "Longest (ms)");
+  for (size_t i = 0; i < summaries.size(); i++)
+  {
+    const TypeSummary& summary = summaries[i];
+    fmt::format_to(out, "{:<24} {:>10} {:>10} {:>14.1f} {:>14.1f}\n",
+                   GetMissTypeName(static_cast<PipelineMissType>(i)), summary.pipelines,
+                   summary.misses, ToMilliseconds(summary.stall_time),
+                   ToMilliseconds(summary.longest));
+  }
+
+  fmt::format_to(out, "\nSynchronous ubershader compiles: {}, {:.1f} ms\n", m_uber_shader_compiles,
+                 ToMilliseconds(m_uber_shader_compile_time));
+  fmt::format_to(out, "Missed pipelines known from the UID cache or a bundle: {} of {}\n",
+                 known_pipelines, pipelines.size());
+  fmt::format_to(out, "Missed pipelines still compiling when the report was written: {}\n\n",
+                 pending_pipelines);
+
+  // Known pipelines were missed because precompiling had not reached them yet. New pipelines were
+  // not covered by the UID cache or any bundle, and are the ones worth adding to a bundle.
+  fmt::format_to(out, "{:>14} {:<24} {:>8} {:>12} {:<6} {:<8} {:<8} {:<8} {:<8} {:<8} {:<8}\n",
+                 "First miss (s)", "Type", "Misses", "Stall (ms)", "Source", "VS", "GS", "PS",
+                 "Raster", "Depth", "Blend");
+  for (const auto& it : pipelines)
+  {
+    const GXPipelineUid& uid = it->first;
+    const Pipeline& pipeline = it->second;
+    u32 misses = 0;
+    for (const u32 count : pipeline.misses)
+      misses += count;
+
+    fmt::format_to(
+        out, "{:>14.3f} {:<24} {:>8} {:>12.1f} {:<6} {:08x} {:08x} {:08x} {:08x} {:08x} {:08x}\n",
+        std::chrono::duration<double>(pipeline.first_miss).count(),
+        GetMissTypeName(pipeline.first_type), misses, ToMilliseconds(GetStallTime(pipeline, now)),
+        pipeline.known ? "Known" : "New", GetShaderHash(uid.vs_uid), GetShaderHash(uid.gs_uid),
+        GetShaderHash(uid.ps_uid), uid.rasterization_state.hex, uid.depth_state.hex,
+        uid.blending_state.hex);
+  }
+
+  return text;
+}
+
+std::vector<GXPipelineUid> PipelineMissReport::GetUIDs() const
+{
+  std::vector<GXPipelineUid> uids;
+  for (const auto& it : GetSortedPipelines(Clock::now()))
+    uids.push_back(it->first);
+  return uids;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GXPipelineTypes.h"
+
+namespace VideoCommon
+{
+enum class PipelineMissType : u32
+{
+  // The specialized pipeline was compiled on the video thread, stalling emulation.
+  SynchronousCompile,
+  // An ubershader was drawn with while the specialized pipeline compiled in the background.
+  UberShaderFallback,
+  // Draws were skipped while the specialized pipeline compiled in the background.
+  SkippedDraw,
+  Count
+};
+
+// Records the GX pipelines which were not ready when a draw needed them, and how long they held
+// emulation up: the time spent compiling them synchronously, or the time from the first draw which
+// fell back to an ubershader or was skipped until the specialized pipeline was ready. A pipeline
+// which was already known from the UID cache or a shader bundle, but had not finished compiling,
+// is told apart from one which was not covered at all, so the report shows both how well the
+// precompiled UIDs cover the game and which pipelines are worth adding to a bundle.
+//
+// Only used on the video thread.
+class PipelineMissReport
+{
+public:
+  bool IsEmpty() const { return m_pipelines.empty(); }
+
+  // Records a draw which could not use the specialized pipeline for uid. known is whether the UID
+  // was already in the pipeline cache before this miss, and duration is how long compiling it
+  // synchronously took.
+  void RecordMiss(PipelineMissType type, const GXPipelineUid& uid, bool known, DT duration = {});
+
+  // Called when the specialized pipeline for uid has finished compiling in the background.
+  void OnPipelineCompiled(const GXPipelineUid& uid);
+
+  void RecordUberShaderCompile(DT duration);
+
+  // The report as text, with the pipelines which held emulation up for longest first.
+  std::string GetText(std::string_view game_id) const;
+
+  // The missed UIDs, in the same order as the report.
+  std::vector<GXPipelineUid> GetUIDs() const;
+
+private:
+  struct Pipeline
+  {
+    // Since the report started.
+    DT first_miss;
+    PipelineMissType first_type;
+    bool known;
+    bool compiled = false;
+    // Since the report started, if compiled in the background.
+    DT compiled_at{};
+    std::array<u32, static_cast<size_t>(PipelineMissType::Count)> misses{};
+    // Spent compiling synchronously.
+    DT compile_time{};
+  };
+
+  using PipelineMap = std::map<GXPipelineUid, Pipeline>;
+
+  DT GetStallTime(const Pipeline& pipeline, TimePoint now) const;
+  std::vector<PipelineMap::const_iterator> GetSortedPipelines(TimePoint now) const;
+
+  TimePoint m_start = Clock::now();
+  PipelineMap m_pipelines;
+  u32 m_uber_shader_compiles = 0;
+  DT m_uber_shader_compile_time{};
+};
+}  // namespace VideoCommon
@@ -200,11 +200,13 @@ PixelShaderUid GetPixelShaderUid()
     uid_data->ztest = EmulatedZ::ForcedEarly;
   }
 
+  // Writing depth from the shader keeps the host GPU from testing it early, so only do so when
+  // the value actually ends up being tested or written.
   const bool forced_early_z = uid_data->ztest == EmulatedZ::ForcedEarly;
+  const bool depth_used = bpmem.zmode.IsDepthUsed();
   const bool per_pixel_depth =
-      (bpmem.ztex2.op != ZTexOp::Disabled && uid_data->ztest == EmulatedZ::Late) ||
-      (!g_ActiveConfig.bFastDepthCalc && bpmem.zmode.test_enable && !forced_early_z) ||
-      (bpmem.zmode.test_enable && bpmem.genMode.zfreeze);
+      depth_used && ((bpmem.ztex2.op != ZTexOp::Disabled && uid_data->ztest == EmulatedZ::Late) ||
+                     (!g_ActiveConfig.bFastDepthCalc && !forced_early_z) || bpmem.genMode.zfreeze);
 
   uid_data->per_pixel_depth = per_pixel_depth;
 
@@ -310,6 +312,27 @@ PixelShaderUid GetPixelShaderUid()
   return out;
 }
 
+static bool NeedsAlphaTest(const pixel_shader_uid_data* uid_data)
+{
+  // NOTE: Fragment may not be discarded if alpha test always fails and early depth test is enabled
+  // (in this case we need to write a depth value if depth test passes regardless of the alpha
+  // testing result)
+  return uid_data->Pretest == AlphaTestResult::Undetermined ||
+         (uid_data->Pretest == AlphaTestResult::Fail && uid_data->ztest == EmulatedZ::Late);
+}
+
+bool PixelShaderDisablesEarlyDepth(const PixelShaderUid& uid)
+{
+  const pixel_shader_uid_data* const uid_data = uid.GetUidData();
+  if (uid_data->per_pixel_depth)
+    return true;
+
+  // With FORCE_EARLY_Z the depth test happens before the shader even if it discards, and the
+  // zcomploc hack leaves out the discard altogether.
+  return NeedsAlphaTest(uid_data) && uid_data->ztest != EmulatedZ::ForcedEarly &&
+         uid_data->ztest != EmulatedZ::EarlyWithZComplocHack;
+}
+
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid)
 {
@@ -326,6 +349,59 @@ void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& hos
   uid_data->bounding_box &= host_config.bounding_box && host_config.backend_bbox;
 }
 
+void CanonicalizePixelShaderUid(PixelShaderUid* uid)
+{
+  pixel_shader_uid_data* const uid_data = uid->GetUidData();
+
+  // Fog parameters are only read when fog is enabled.
+  if (uid_data->fog_fsel == FogType::Off)
+  {
+    uid_data->fog_proj = FogProjection::Perspective;
+    uid_data->fog_RangeBaseEnabled = 0;
+  }
+
+  // Matches skip_ztexture in WriteFragmentBody.
+  if (!uid_data->per_pixel_depth && uid_data->fog_fsel == FogType::Off)
+    uid_data->ztex_op = ZTexOp::Disabled;
+
+  const u32 num_stages = uid_data->genMode_numtevstages + 1;
+  for (u32 n = 0; n < num_stages; n++)
+  {
+    auto& stage = uid_data->stagehash[n];
+
+    // Tex coords which don't exist read tex coord 0, see WriteStage.
+    if (stage.tevorders_texcoord >= uid_data->genMode_numtexgens)
+      stage.tevorders_texcoord = 0;
+
+    // Without any tex gens, no texture is sampled.
+    if (uid_data->genMode_numtexgens == 0)
+    {
+      stage.tevorders_texmap = 0;
+      stage.tex_swap_r = ColorChannel::Red;
+      stage.tex_swap_g = ColorChannel::Red;
+      stage.tex_swap_b = ColorChannel::Red;
+      stage.tex_swap_a = ColorChannel::Red;
+    }
+
+    // Only wrapping and add to previous apply when there is no indirect operation.
+    TevStageIndirect tevind{.hex = stage.tevind};
+    if (tevind.bt >= uid_data->genMode_numindstages)
+    {
+      tevind.bs = IndTexBumpAlpha::Off;
+      tevind.matrix_index = IndMtxIndex::Off;
+    }
+    if (tevind.matrix_index == IndMtxIndex::Off)
+    {
+      tevind.bias = IndTexBias::None;
+      tevind.matrix_id = IndMtxId::Indirect;
+      if (tevind.bs == IndTexBumpAlpha::Off)
+        tevind.fmt = IndTexFormat::ITF_8;
+    }
+    tevind.lb_utclod = false;
+    stage.tevind = tevind.hex;
+  }
+}
+
 void WritePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
                                   const ShaderHostConfig& host_config, bool bounding_box)
 {
@@ -873,7 +949,7 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
                             GetInterpolationQualifier(msaa, ssaa, true, true), ShaderStage::Pixel);
 
     out.Write("}};\n");
-    if (stereo && !host_config.backend_gl_layer_in_fs)
+    if (stereo && !host_config.backend_gl_layer_in_fs && !host_config.backend_multiview)
       out.Write("flat in int layer;");
   }
   else
@@ -962,7 +1038,9 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
 
   if (host_config.backend_geometry_shaders && stereo)
   {
-    if (host_config.backend_gl_layer_in_fs)
+    if (host_config.backend_multiview)
+      out.Write("\tint layer = int(gl_ViewIndex);\n");
+    else if (host_config.backend_gl_layer_in_fs)
       out.Write("\tint layer = gl_Layer;\n");
   }
   else
@@ -1002,11 +1080,7 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
   out.Write("\tprocess_fragment(frag_input, frag_output);\n");
   out.Write("\tivec4 prev = frag_output.main & 255;\n");
 
-  // NOTE: Fragment may not be discarded if alpha test always fails and early depth test is enabled
-  // (in this case we need to write a depth value if depth test passes regardless of the alpha
-  // testing result)
-  if (uid_data->Pretest == AlphaTestResult::Undetermined ||
-      (uid_data->Pretest == AlphaTestResult::Fail && uid_data->ztest == EmulatedZ::Late))
+  if (NeedsAlphaTest(uid_data))
   {
     WriteAlphaTest(out, uid_data, api_type, uid_data->per_pixel_depth,
                    !uid_data->no_dual_src || uid_data->blend_enable);
@@ -173,4 +173,10 @@ void WriteFragmentBody(APIType api_type, const ShaderHostConfig& host_config,
                        const pixel_shader_uid_data* uid_data, ShaderCode& out);
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid);
+// Clears the fields which have no effect on the generated shader, so that equivalent UIDs compare
+// equal and share a pipeline.
+void CanonicalizePixelShaderUid(PixelShaderUid* uid);
+// Whether shaders for this UID keep the host GPU from testing depth before running them, because
+// they discard fragments or write depth themselves.
+bool PixelShaderDisablesEarlyDepth(const PixelShaderUid& uid);
 PixelShaderUid GetPixelShaderUid();
@@ -3,9 +3,12 @@
 
 #include "VideoCommon/PostProcessing.h"
 
+#include <algorithm>
+#include <array>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -25,6 +28,7 @@
 #include "VideoCommon/AbstractShader.h"
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimings.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/ShaderCache.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -60,6 +64,18 @@ static bool LoadShaderFromFile(const std::string& shader, const std::string& sub
   return true;
 }
 
+// Whether the shader only depends on the color of the pixel it outputs (passed through Sample()),
+// so that it can run in the same pass as the one producing that color.
+static bool IsPerPixelShader(const std::string& code)
+{
+  static constexpr std::array<std::string_view, 10> non_local_tokens = {
+      "SampleLocation", "SampleLayer", "SampleOffset", "GetCoordinates", "GetResolution",
+      "GetInvResolution", "texture", "samp0", "samp1", "v_tex0"};
+  return std::ranges::none_of(non_local_tokens, [&code](std::string_view token) {
+    return code.find(token) != std::string::npos;
+  });
+}
+
 PostProcessingConfiguration::PostProcessingConfiguration() = default;
 
 PostProcessingConfiguration::~PostProcessingConfiguration() = default;
@@ -432,8 +448,10 @@ void PostProcessing::RecompileShader()
 
   m_default_pipeline.reset();
   m_pipeline.reset();
+  m_fused_pipeline.reset();
   m_default_pixel_shader.reset();
   m_pixel_shader.reset();
+  m_fused_pixel_shader.reset();
   m_default_vertex_shader.reset();
   m_vertex_shader.reset();
   if (!CompilePixelShader())
@@ -448,6 +466,7 @@ void PostProcessing::RecompilePipeline()
 {
   m_default_pipeline.reset();
   m_pipeline.reset();
+  m_fused_pipeline.reset();
   CompilePipeline();
 }
 
@@ -499,14 +518,26 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   bool default_uniform_staging_buffer = true;
   const MathUtil::Rectangle<int> present_rect = g_presenter->GetTargetRectangle();
 
+  // Both passes in one, without the intermediary texture.
+  if (m_fused_pipeline && m_default_pipeline && needs_default_pipeline &&
+      needs_intermediary_buffer)
+  {
+    final_pipeline = m_fused_pipeline.get();
+    uniform_staging_buffer = &m_uniform_staging_buffer;
+    default_uniform_staging_buffer = false;
+
+    m_intermediary_frame_buffer.reset();
+    m_intermediary_color_texture.reset();
+  }
   // Intermediary pass.
   // We draw to a high quality intermediary texture for a couple reasons:
   // -Consistently do high quality gamma corrected resampling (upscaling/downscaling)
   // -Keep quality for gamma and gamut conversions, and HDR output
   //  (low bit depths lose too much quality with gamma conversions)
   // -Keep the post process phase in linear space, to better operate with colors
-  if (m_default_pipeline && needs_default_pipeline && needs_intermediary_buffer)
+  else if (m_default_pipeline && needs_default_pipeline && needs_intermediary_buffer)
   {
+    VideoCommon::GPUTimingScope gpu_timing(VideoCommon::GPUTimingCategory::XFBScaling);
     AbstractFramebuffer* const previous_framebuffer = g_gfx->GetCurrentFramebuffer();
 
     // We keep the min number of layers as the render target,
@@ -589,6 +620,13 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   // Final pass, either a user selected shader or the default (fixed) shader.
   if (final_pipeline)
   {
+    // Without a user selected shader, the final pass only scales and color corrects the XFB.
+    const bool user_post_process =
+        (final_pipeline == m_pipeline.get() && needs_intermediary_buffer) ||
+        final_pipeline == m_fused_pipeline.get();
+    VideoCommon::GPUTimingScope gpu_timing(user_post_process ?
+                                               VideoCommon::GPUTimingCategory::PostProcessing :
+                                               VideoCommon::GPUTimingCategory::XFBScaling);
     FillUniformBuffer(src_rect, src_tex, src_layer, g_gfx->GetCurrentFramebuffer()->GetRect(),
                       present_rect, uniform_staging_buffer->data(), !default_uniform_staging_buffer,
                       false);
@@ -616,6 +654,8 @@ std::string PostProcessing::GetUniformBufferHeader(bool user_post_process) const
   // How many horizontal and vertical stereo views do we have? (set to 1 when we use layers instead)
   ss << "  int2 stereo_views;\n";
   ss << "  float4 src_rect;\n";
+  // Cosine and sine of the rotation of the output, for pre-rotated backbuffers (zw are unused)
+  ss << "  float4 clip_space_rotation;\n";
   // The first (but not necessarily only) source layer we target
   ss << "  int src_layer;\n";
   ss << "  uint time;\n";
@@ -767,6 +807,35 @@ std::string PostProcessing::GetFooter() const
   return {};
 }
 
+std::string PostProcessing::GetFusedPixelShaderCode(
+    const std::string& default_pixel_shader_code) const
+{
+  std::ostringstream ss;
+  ss << GetHeader(true);
+
+  // The default shader's output is kept in a variable...
+  ss << "float4 fused_color;\n";
+  ss << "void SetFusedColor(float4 color) { fused_color = color; }\n";
+  ss << "#define main DefaultMain\n";
+  ss << "#define SetOutput SetFusedColor\n";
+  ss << default_pixel_shader_code;
+  ss << "\n#undef SetOutput\n";
+  ss << "#undef main\n";
+
+  // ...which is what the user shader samples.
+  ss << "#define Sample() fused_color\n";
+  ss << "#define main UserMain\n";
+  ss << m_config.GetShaderCode();
+  ss << "\n#undef main\n";
+
+  ss << "void main() {\n";
+  ss << "  DefaultMain();\n";
+  ss << "  UserMain();\n";
+  ss << "}\n";
+  ss << GetFooter();
+  return ss.str();
+}
+
 static std::string GetVertexShaderBody()
 {
   std::ostringstream ss;
@@ -788,10 +857,12 @@ static std::string GetVertexShaderBody()
   ss << "  opos = float4(v_tex0.xy * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 0.0f, 1.0f);\n";
   ss << "  v_tex0 = float3(src_rect.xy + (src_rect.zw * v_tex0.xy), float(src_layer));\n";
 
-  // Vulkan Y needs to be inverted on every pass
+  // Vulkan Y needs to be inverted on every pass, and the backbuffer can be pre-rotated
   if (g_backend_info.api_type == APIType::Vulkan)
   {
     ss << "  opos.y = -opos.y;\n";
+    ss << "  opos.xy = float2(opos.x * clip_space_rotation.x - opos.y * clip_space_rotation.y,\n";
+    ss << "                   opos.x * clip_space_rotation.y + opos.y * clip_space_rotation.x);\n";
   }
   // OpenGL Y needs to be inverted in all passes except the last one
   else if (g_backend_info.api_type == APIType::OpenGL)
@@ -838,6 +909,7 @@ struct BuiltinUniforms
   std::array<float, 4> window_resolution;
   std::array<float, 4> stereo_views;
   std::array<float, 4> src_rect;
+  std::array<float, 4> clip_space_rotation;
   s32 src_layer;
   u32 time;
   s32 graphics_api;
@@ -871,13 +943,19 @@ void PostProcessing::FillUniformBuffer(const MathUtil::Rectangle<int>& src,
   const float rcp_src_width = 1.0f / src_tex->GetWidth();
   const float rcp_src_height = 1.0f / src_tex->GetHeight();
 
+  // A pre-rotated target is described the way it's seen, not in the orientation it's stored in.
+  const std::array<float, 2> rotation = g_gfx->GetClipSpaceRotation();
+  float target_width = static_cast<float>(dst.GetWidth());
+  float target_height = static_cast<float>(dst.GetHeight());
+  if (g_gfx->GetCurrentFramebufferRotation() % 2 != 0)
+    std::swap(target_width, target_height);
+
   BuiltinUniforms builtin_uniforms;
   builtin_uniforms.source_resolution = {static_cast<float>(src_tex->GetWidth()),
                                         static_cast<float>(src_tex->GetHeight()), rcp_src_width,
                                         rcp_src_height};
-  builtin_uniforms.target_resolution = {
-      static_cast<float>(dst.GetWidth()), static_cast<float>(dst.GetHeight()),
-      1.0f / static_cast<float>(dst.GetWidth()), 1.0f / static_cast<float>(dst.GetHeight())};
+  builtin_uniforms.target_resolution = {target_width, target_height, 1.0f / target_width,
+                                        1.0f / target_height};
   builtin_uniforms.window_resolution = {
       static_cast<float>(wnd.GetWidth()), static_cast<float>(wnd.GetHeight()),
       1.0f / static_cast<float>(wnd.GetWidth()), 1.0f / static_cast<float>(wnd.GetHeight())};
@@ -885,6 +963,7 @@ void PostProcessing::FillUniformBuffer(const MathUtil::Rectangle<int>& src,
                                static_cast<float>(src.top) * rcp_src_height,
                                static_cast<float>(src.GetWidth()) * rcp_src_width,
                                static_cast<float>(src.GetHeight()) * rcp_src_height};
+  builtin_uniforms.clip_space_rotation = {rotation[0], rotation[1], 0.0f, 0.0f};
   builtin_uniforms.src_layer = static_cast<s32>(src_layer);
   builtin_uniforms.time = static_cast<u32>(m_timer.ElapsedMs());
   builtin_uniforms.graphics_api = static_cast<s32>(g_backend_info.api_type);
@@ -959,6 +1038,7 @@ bool PostProcessing::CompilePixelShader()
 {
   m_default_pixel_shader.reset();
   m_pixel_shader.reset();
+  m_fused_pixel_shader.reset();
 
   // Generate GLSL and compile the new shaders:
 
@@ -997,6 +1077,16 @@ bool PostProcessing::CompilePixelShader()
   }
 
   m_uniform_staging_buffer.resize(CalculateUniformsSize(true));
+
+  // Failing to compile this is fine, the passes will just run separately.
+  if (m_default_pixel_shader && !m_config.GetShader().empty() &&
+      IsPerPixelShader(m_config.GetShaderCode()))
+  {
+    m_fused_pixel_shader = g_gfx->CreateShaderFromSource(
+        ShaderStage::Pixel, GetFusedPixelShaderCode(default_pixel_shader_code),
+        fmt::format("Fused post-processing pixel shader: {}", m_config.GetShader()));
+  }
+
   return true;
 }
 
@@ -1059,6 +1149,12 @@ bool PostProcessing::CompilePipeline()
   if (!m_pipeline)
     return false;
 
+  if (m_fused_pixel_shader)
+  {
+    config.pixel_shader = m_fused_pixel_shader.get();
+    m_fused_pipeline = g_gfx->CreatePipeline(config);
+  }
+
   return true;
 }
 }  // namespace VideoCommon
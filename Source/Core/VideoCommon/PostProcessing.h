@@ -116,6 +116,7 @@ protected:
   std::string GetUniformBufferHeader(bool user_post_process) const;
   std::string GetHeader(bool user_post_process) const;
   std::string GetFooter() const;
+  std::string GetFusedPixelShaderCode(const std::string& default_pixel_shader_code) const;
 
   bool CompileVertexShader();
   bool CompilePixelShader();
@@ -144,6 +145,10 @@ protected:
   std::unique_ptr<AbstractShader> m_pixel_shader;
   std::unique_ptr<AbstractPipeline> m_pipeline;
   std::vector<u8> m_uniform_staging_buffer;
+  // Runs the default and the user post process in one pass, if the user shader only operates on
+  // the color of its own pixel. Uses the user post process uniforms.
+  std::unique_ptr<AbstractShader> m_fused_pixel_shader;
+  std::unique_ptr<AbstractPipeline> m_fused_pipeline;
 
   AbstractTextureFormat m_framebuffer_format = AbstractTextureFormat::Undefined;
 };
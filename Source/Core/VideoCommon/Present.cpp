@@ -16,6 +16,7 @@
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimings.h"
 #include "VideoCommon/OnScreenUI.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -865,6 +866,8 @@ void Presenter::Present(std::optional<TimePoint> presentation_time)
       m_onscreen_ui->DrawImGui();
   }
 
+  g_gpu_timings->EndFrame();
+
   // Present to the window system.
   {
     std::lock_guard<std::mutex> guard(m_swap_mutex);
@@ -84,6 +84,9 @@ union FramebufferState
   // can specify its own format
   BitField<25, 3, u32> additional_color_attachment_count;
 
+  // Renders every layer of the framebuffer at once, see BackendInfo::bSupportsMultiview.
+  BitField<28, 1, u32> multiview;
+
   u32 hex = 0;
 };
 
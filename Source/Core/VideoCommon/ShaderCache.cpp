@@ -6,6 +6,8 @@
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
+#include "Common/CommonPaths.h"
+#include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 #include "Core/ConfigManager.h"
@@ -46,6 +48,7 @@ bool ShaderCache::Initialize()
     return false;
 
   m_async_shader_compiler = g_gfx->CreateAsyncShaderCompiler();
+  m_async_shader_compiler->SetUrgentPriorityLimit(COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
   m_frame_end_handler = AfterFrameEvent::Register([this](Core::System&) { RetrieveAsyncShaders(); },
                                                   "RetrieveAsyncShaders");
   return true;
@@ -60,6 +63,7 @@ void ShaderCache::InitializeShaderCache()
   {
     LoadCaches();
     LoadPipelineUIDCache();
+    LoadPipelineUIDBundles();
   }
 
   // Queue ubershader precompiling if required.
@@ -77,7 +81,8 @@ void ShaderCache::InitializeShaderCache()
 
 void ShaderCache::Reload()
 {
-  WaitForAsyncCompiler();
+  // Anything still queued was generated for the old configuration.
+  m_async_shader_compiler->ClearPendingWork();
   ClosePipelineUIDCache();
   ClearCaches();
 
@@ -112,38 +117,88 @@ void ShaderCache::Shutdown()
     m_async_shader_compiler->StopWorkerThreads();
 
   ClosePipelineUIDCache();
+  WritePipelineMissReport();
 }
 
-const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
+/// Clears the parts of the shader UIDs which have no effect, so equivalent pipelines are only
+/// compiled and cached once.
+static GXPipelineUid CanonicalizePipelineUid(const GXPipelineUid& in)
 {
+  GXPipelineUid out;
+  // See ApplyDriverBugs.
+  memcpy(static_cast<void*>(&out), static_cast<const void*>(&in), sizeof(out));  // copy padding
+  CanonicalizeVertexShaderUid(&out.vs_uid);
+  CanonicalizePixelShaderUid(&out.ps_uid);
+  return out;
+}
+
+const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid_in)
+{
+  const GXPipelineUid uid = CanonicalizePipelineUid(uid_in);
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
 
+  INCSTAT(g_stats.num_pipeline_misses);
+
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
+  const TimePoint compile_start = Clock::now();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  if (g_ActiveConfig.bPipelineMissReport)
+  {
+    m_pipeline_miss_report.RecordMiss(PipelineMissType::SynchronousCompile, uid, exists_in_cache,
+                                      Clock::now() - compile_start);
+  }
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
   return InsertGXPipeline(uid, std::move(pipeline));
 }
 
-std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
+std::optional<const AbstractPipeline*>
+ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid_in)
 {
+  const GXPipelineUid uid = CanonicalizePipelineUid(uid_in);
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
       return it->second.first.get();
-    else
-      return {};
+
+    INCSTAT(g_stats.num_pipeline_misses);
+    RecordAsyncPipelineMiss(uid, true);
+    return {};
   }
 
+  INCSTAT(g_stats.num_pipeline_misses);
   AppendGXPipelineUID(uid);
+  if (g_backend_info.bSupportsFastPipelineLinking)
+  {
+    if (const AbstractPipeline* pipeline = FastLinkGXPipeline(uid))
+      return pipeline;
+  }
+
   QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+  RecordAsyncPipelineMiss(uid, false);
+  return {};
+}
+
+std::optional<const AbstractPipeline*>
+ShaderCache::GetUberPipelineForUidAsync(const GXUberPipelineUid& uid)
+{
+  auto it = m_gx_uber_pipeline_cache.find(uid);
+  if (it != m_gx_uber_pipeline_cache.end())
+  {
+    if (!it->second.second)
+      return it->second.first.get();
+    else
+      return {};
+  }
+
+  QueueUberPipelineCompile(uid, COMPILE_PRIORITY_SPECIALIZED_UBERSHADER_PIPELINE);
   return {};
 }
 
@@ -153,10 +208,13 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
 
+  const TimePoint compile_start = Clock::now();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  if (g_ActiveConfig.bPipelineMissReport)
+    m_pipeline_miss_report.RecordUberShaderCompile(Clock::now() - compile_start);
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
@@ -187,6 +245,9 @@ void ShaderCache::WaitForAsyncCompiler()
     g_presenter->Present();
   };
 
+  // Nothing is drawn while waiting, so all the workers can take on the shader cache.
+  m_async_shader_compiler->SetUrgentPriorityLimit(0);
+
   while (running &&
          (m_async_shader_compiler->HasPendingWork() || m_async_shader_compiler->HasCompletedWork()))
   {
@@ -195,6 +256,8 @@ void ShaderCache::WaitForAsyncCompiler()
     m_async_shader_compiler->RetrieveWorkItems();
   }
 
+  m_async_shader_compiler->SetUrgentPriorityLimit(COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+
   // An extra Present to clear the screen
   g_presenter->Present();
 }
@@ -263,7 +326,8 @@ void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type,
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
   CacheReader reader(cache);
-  u32 count = cache.disk_cache.OpenAndRead(filename, reader);
+  // Other instances may be using the same cache directory, so the cache is opened shared.
+  u32 count = cache.disk_cache.OpenAndRead(filename, reader, true);
   INFO_LOG_FMT(VIDEO, "Loaded {} cached shaders from {}", count, filename);
 }
 
@@ -318,7 +382,7 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
   CacheReader reader(this, cache);
-  const u32 count = disk_cache.OpenAndRead(filename, reader);
+  const u32 count = disk_cache.OpenAndRead(filename, reader, true);
   INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, filename);
 
   // If any of the pipelines in the cache failed to create, it's likely because of a change of
@@ -331,7 +395,7 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
                  filename);
     disk_cache.Close();
     File::Delete(filename);
-    disk_cache.OpenAndRead(filename, reader);
+    disk_cache.OpenAndRead(filename, reader, true);
   }
 }
 
@@ -383,6 +447,7 @@ void ShaderCache::LoadCaches()
 
 void ShaderCache::ClearCaches()
 {
+  m_replaced_gx_pipelines.clear();
   ClearPipelineCache(m_gx_pipeline_cache, m_gx_pipeline_disk_cache);
   ClearShaderCache(m_vs_cache);
   ClearShaderCache(m_gs_cache);
@@ -413,6 +478,7 @@ void ShaderCache::ClearCaches()
   SETSTAT(g_stats.num_pixel_shaders_alive, 0);
   SETSTAT(g_stats.num_vertex_shaders_created, 0);
   SETSTAT(g_stats.num_vertex_shaders_alive, 0);
+  SETSTAT(g_stats.num_pipeline_misses, 0);
 }
 
 void ShaderCache::CompileMissingPipelines()
@@ -601,6 +667,7 @@ AbstractPipelineConfig ShaderCache::GetGXPipelineConfig(
   config.depth_state = depth_state;
   config.blending_state = blending_state;
   config.framebuffer_state = g_framebuffer_manager->GetEFBFramebufferState();
+  config.framebuffer_state.multiview = m_host_config.stereo && m_host_config.backend_multiview;
   return config;
 }
 
@@ -732,6 +799,10 @@ static GXPipelineUid ApplyDriverBugs(const GXPipelineUid& in)
     out.gs_uid.GetUidData()->primitive_type = static_cast<u32>(prim);
   }
 
+  // The vertex shader reads the raw vertices from the vertex buffer itself
+  if (out.vs_uid.GetUidData()->vertex_pulling)
+    out.vertex_format = nullptr;
+
   return out;
 }
 
@@ -870,6 +941,8 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
                                                       std::unique_ptr<AbstractPipeline> pipeline)
 {
   auto& entry = m_gx_pipeline_cache[config];
+  if (entry.second && !m_pipeline_miss_report.IsEmpty())
+    m_pipeline_miss_report.OnPipelineCompiled(config);
   entry.second = false;
   if (!entry.first && pipeline)
   {
@@ -917,53 +990,79 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
   return entry.first.get();
 }
 
+namespace
+{
+constexpr u32 PIPELINE_UID_CACHE_MAGIC = 0x44495550;  // PUID
+constexpr size_t PIPELINE_UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+// Reads every UID from a pipeline UID file positioned at its start. Returns false if the file is
+// from a different version or is corrupted, in which case some UIDs may already have been passed
+// to the callback.
+template <typename Callback>
+bool ReadPipelineUIDFile(File::IOFile& file, Callback callback)
+{
+  u32 existing_magic;
+  u32 existing_version;
+  if (!file.ReadBytes(&existing_magic, sizeof(existing_magic)) ||
+      !file.ReadBytes(&existing_version, sizeof(existing_version)) ||
+      existing_magic != PIPELINE_UID_CACHE_MAGIC || existing_version != GX_PIPELINE_UID_VERSION)
+  {
+    return false;
+  }
+
+  // Ensure the expected size matches the actual size of the file. If it doesn't, it means
+  // the cache file may be corrupted, and we should not proceed with loading potentially
+  // garbage or invalid UIDs.
+  const u64 file_size = file.GetSize();
+  const size_t uid_count = static_cast<size_t>(file_size - PIPELINE_UID_CACHE_HEADER_SIZE) /
+                           sizeof(SerializedGXPipelineUid);
+  const size_t expected_size =
+      uid_count * sizeof(SerializedGXPipelineUid) + PIPELINE_UID_CACHE_HEADER_SIZE;
+  if (file_size != expected_size)
+    return false;
+
+  for (size_t i = 0; i < uid_count; i++)
+  {
+    SerializedGXPipelineUid serialized_uid;
+    if (!file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
+      return false;
+
+    callback(serialized_uid);
+  }
+
+  return true;
+}
+}  // namespace
+
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
-    u32 existing_magic;
-    u32 existing_version;
-    bool uid_file_valid = false;
-    if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
-        m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
+    // This just adds the pipelines to the map, they are compiled later.
+    size_t uid_count = 0;
+    bool uid_file_valid = ReadPipelineUIDFile(
+        m_gx_pipeline_uid_cache_file, [this, &uid_count](const auto& serialized_uid) {
+          AddSerializedGXPipelineUID(serialized_uid);
+          uid_count++;
+        });
+
+    // UIDs written before canonicalization, or with fields which have since been found to be
+    // irrelevant, collapse into fewer pipelines.
+    if (uid_file_valid && uid_count != m_gx_pipeline_cache.size())
     {
-      // Ensure the expected size matches the actual size of the file. If it doesn't, it means
-      // the cache file may be corrupted, and we should not proceed with loading potentially
-      // garbage or invalid UIDs.
-      const u64 file_size = m_gx_pipeline_uid_cache_file.GetSize();
-      const size_t uid_count =
-          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
-      const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
-      uid_file_valid = file_size == expected_size;
-      if (uid_file_valid)
-      {
-        for (size_t i = 0; i < uid_count; i++)
-        {
-          SerializedGXPipelineUid serialized_uid;
-          if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
-          {
-            // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
-          }
-          else
-          {
-            uid_file_valid = false;
-            break;
-          }
-        }
-      }
-
-      // We open the file for reading and writing, so we must seek to the end before writing.
-      if (uid_file_valid)
-        uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+      INFO_LOG_FMT(VIDEO, "{} pipeline UIDs in {} collapsed into {} unique pipelines ({:.2f}:1)",
+                   uid_count, filename, m_gx_pipeline_cache.size(),
+                   static_cast<double>(uid_count) /
+                       static_cast<double>(std::max<size_t>(m_gx_pipeline_cache.size(), 1)));
     }
 
+    // We open the file for reading and writing, so we must seek to the end before writing.
+    if (uid_file_valid)
+      uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(0, File::SeekOrigin::End);
+
     // If the file is invalid, close it. We re-open and truncate it below.
     if (!uid_file_valid)
       m_gx_pipeline_uid_cache_file.Close();
@@ -975,7 +1074,8 @@ void ShaderCache::LoadPipelineUIDCache()
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
+      m_gx_pipeline_uid_cache_file.WriteBytes(&PIPELINE_UID_CACHE_MAGIC,
+                                              sizeof(PIPELINE_UID_CACHE_MAGIC));
       m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
                                               sizeof(GX_PIPELINE_UID_VERSION));
 
@@ -990,24 +1090,60 @@ void ShaderCache::LoadPipelineUIDCache()
   INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
 }
 
+void ShaderCache::LoadPipelineUIDBundles()
+{
+  // Bundles use the same format as the UID cache, so the cache files of any number of users can
+  // simply be dropped into the directory. UIDs contain no host-specific state, so they're valid
+  // for every backend.
+  const std::string game_id = SConfig::GetInstance().GetGameID();
+  const std::vector<std::string> directories = {
+      File::GetSysDirectory() + SHADERBUNDLES_DIR DIR_SEP + game_id,
+      File::GetUserPath(D_SHADERBUNDLES_IDX) + game_id,
+  };
+
+  for (const std::string& path : Common::DoFileSearch(directories, {".uidcache"}))
+  {
+    File::IOFile file(path, "rb");
+    size_t new_uids = 0;
+    const bool valid = ReadPipelineUIDFile(file, [this, &new_uids](const auto& serialized_uid) {
+      if (!AddSerializedGXPipelineUID(serialized_uid))
+        return;
+
+      // Merge the bundle into the user's own UID cache, so it still applies if the bundle is
+      // removed, and so the cache can itself be shared as a bundle.
+      GXPipelineUid uid;
+      UnserializePipelineUid(serialized_uid, uid);
+      AppendGXPipelineUID(CanonicalizePipelineUid(uid));
+      new_uids++;
+    });
+
+    if (valid)
+      INFO_LOG_FMT(VIDEO, "Read {} new pipeline UIDs from bundle {}", new_uids, path);
+    else
+      WARN_LOG_FMT(VIDEO, "Pipeline UID bundle {} is invalid or from another version", path);
+  }
+}
+
 void ShaderCache::ClosePipelineUIDCache()
 {
   // This is left as a method in case we need to append extra data to the file in the future.
   m_gx_pipeline_uid_cache_file.Close();
 }
 
-void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
+bool ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
-  GXPipelineUid real_uid;
-  UnserializePipelineUid(uid, real_uid);
+  GXPipelineUid raw_uid;
+  UnserializePipelineUid(uid, raw_uid);
+  const GXPipelineUid real_uid = CanonicalizePipelineUid(raw_uid);
 
   auto iter = m_gx_pipeline_cache.find(real_uid);
   if (iter != m_gx_pipeline_cache.end())
-    return;
+    return false;
 
   // Flag it as empty with a null pipeline object, for later compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
   entry.second = false;
+  return true;
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -1024,6 +1160,48 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   }
 }
 
+void ShaderCache::RecordAsyncPipelineMiss(const GXPipelineUid& uid, bool known)
+{
+  if (!g_ActiveConfig.bPipelineMissReport)
+    return;
+
+  const PipelineMissType type =
+      g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders ?
+          PipelineMissType::UberShaderFallback :
+          PipelineMissType::SkippedDraw;
+  m_pipeline_miss_report.RecordMiss(type, uid, known);
+}
+
+void ShaderCache::WritePipelineMissReport()
+{
+  if (m_pipeline_miss_report.IsEmpty())
+    return;
+
+  // The missed UIDs are written in the UID cache format, so they can be added to a shader bundle.
+  const std::string game_id = SConfig::GetInstance().GetGameID();
+  const std::string path = File::GetUserPath(D_DUMPDEBUG_IDX) + game_id + "_pipeline_misses";
+  if (!File::WriteStringToFile(path + ".txt", m_pipeline_miss_report.GetText(game_id)))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to write pipeline miss report to {}.txt", path);
+    return;
+  }
+
+  File::IOFile file(path + ".uidcache", "wb");
+  bool written = file.WriteBytes(&PIPELINE_UID_CACHE_MAGIC, sizeof(PIPELINE_UID_CACHE_MAGIC)) &&
+                 file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION));
+  for (const GXPipelineUid& uid : m_pipeline_miss_report.GetUIDs())
+  {
+    SerializedGXPipelineUid disk_uid;
+    SerializePipelineUid(uid, disk_uid);
+    written = written && file.WriteBytes(&disk_uid, sizeof(disk_uid));
+  }
+
+  if (written)
+    NOTICE_LOG_FMT(VIDEO, "Wrote pipeline miss report to {}.txt", path);
+  else
+    WARN_LOG_FMT(VIDEO, "Failed to write missed pipeline UIDs to {}.uidcache", path);
+}
+
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
 {
   class VertexShaderWorkItem final : public AsyncShaderCompiler::WorkItem
@@ -1212,6 +1390,83 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
   m_gx_pipeline_cache[uid].second = true;
 }
 
+const AbstractPipeline* ShaderCache::FastLinkGXPipeline(const GXPipelineUid& uid)
+{
+  // Compiling the shaders is the slow part, which linking can't help with.
+  const GXPipelineUid actual_uid = ApplyDriverBugs(uid);
+  auto vs_it = m_vs_cache.shader_map.find(actual_uid.vs_uid);
+  if (vs_it == m_vs_cache.shader_map.end() || vs_it->second.pending)
+    return nullptr;
+
+  PixelShaderUid ps_uid = actual_uid.ps_uid;
+  ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
+  auto ps_it = m_ps_cache.shader_map.find(ps_uid);
+  if (ps_it == m_ps_cache.shader_map.end() || ps_it->second.pending)
+    return nullptr;
+
+  const std::optional<AbstractPipelineConfig> config = GetGXPipelineConfig(uid);
+  if (!config)
+    return nullptr;
+
+  std::unique_ptr<AbstractPipeline> pipeline = g_gfx->CreateFastLinkedPipeline(*config);
+  if (!pipeline)
+    return nullptr;
+
+  QueueOptimizedPipelineCompile(uid, *config);
+
+  auto& entry = m_gx_pipeline_cache[uid];
+  entry.first = std::move(pipeline);
+  entry.second = false;
+  return entry.first.get();
+}
+
+void ShaderCache::ReplaceFastLinkedGXPipeline(const GXPipelineUid& uid,
+                                              std::unique_ptr<AbstractPipeline> pipeline)
+{
+  // Keep using the fast linked pipeline if the optimized one failed to compile.
+  if (!pipeline)
+    return;
+
+  auto& entry = m_gx_pipeline_cache[uid];
+  if (entry.first)
+    m_replaced_gx_pipelines.push_back(std::move(entry.first));
+  InsertGXPipeline(uid, std::move(pipeline));
+}
+
+void ShaderCache::QueueOptimizedPipelineCompile(const GXPipelineUid& uid,
+                                                const AbstractPipelineConfig& config)
+{
+  class OptimizedPipelineWorkItem final : public AsyncShaderCompiler::WorkItem
+  {
+  public:
+    OptimizedPipelineWorkItem(ShaderCache* shader_cache_, const GXPipelineUid& uid_,
+                              const AbstractPipelineConfig& config_)
+        : shader_cache(shader_cache_), uid(uid_), config(config_)
+    {
+    }
+
+    bool Compile() override
+    {
+      pipeline = g_gfx->CreatePipeline(config);
+      return true;
+    }
+
+    void Retrieve() override
+    {
+      shader_cache->ReplaceFastLinkedGXPipeline(uid, std::move(pipeline));
+    }
+
+  private:
+    ShaderCache* shader_cache;
+    std::unique_ptr<AbstractPipeline> pipeline;
+    GXPipelineUid uid;
+    AbstractPipelineConfig config;
+  };
+
+  auto wi = m_async_shader_compiler->CreateWorkItem<OptimizedPipelineWorkItem>(this, uid, config);
+  m_async_shader_compiler->QueueWorkItem(std::move(wi), COMPILE_PRIORITY_OPTIMIZED_PIPELINE);
+}
+
 void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority)
 {
   class UberPipelineWorkItem final : public AsyncShaderCompiler::WorkItem
@@ -1567,23 +1822,28 @@ const AbstractPipeline* ShaderCache::GetTextureReinterpretPipeline(TextureFormat
 
 const AbstractShader*
 ShaderCache::GetTextureDecodingShader(TextureFormat format,
-                                      std::optional<TLUTFormat> palette_format)
+                                      std::optional<TLUTFormat> palette_format, bool from_tmem)
 {
-  const auto key = std::make_pair(static_cast<u32>(format),
-                                  static_cast<u32>(palette_format.value_or(TLUTFormat::IA8)));
+  // Only RGBA8 textures are decoded differently when they come from TMEM
+  from_tmem = from_tmem && format == TextureFormat::RGBA8;
+
+  const auto key = std::make_tuple(static_cast<u32>(format),
+                                   static_cast<u32>(palette_format.value_or(TLUTFormat::IA8)),
+                                   from_tmem);
   const auto [iter, inserted] = m_texture_decoding_shaders.emplace(key, nullptr);
   if (!inserted)
     return iter->second.get();
 
-  const std::string shader_source =
-      TextureConversionShaderTiled::GenerateDecodingShader(format, palette_format, APIType::OpenGL);
+  const std::string shader_source = TextureConversionShaderTiled::GenerateDecodingShader(
+      format, palette_format, from_tmem, APIType::OpenGL);
   if (shader_source.empty())
     return nullptr;
 
-  const std::string name =
-      palette_format.has_value() ?
-          fmt::format("Texture decoding compute shader: {}, {}", format, *palette_format) :
-          fmt::format("Texture decoding compute shader: {}", format);
+  std::string name = fmt::format("Texture decoding compute shader: {}", format);
+  if (palette_format.has_value())
+    name += fmt::format(", {}", *palette_format);
+  else if (from_tmem)
+    name += " from TMEM";
 
   std::unique_ptr<AbstractShader> shader =
       g_gfx->CreateShaderFromSource(ShaderStage::Compute, shader_source, name);
@@ -10,8 +10,10 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -22,6 +24,7 @@
 #include "VideoCommon/AsyncShaderCompiler.h"
 #include "VideoCommon/GXPipelineTypes.h"
 #include "VideoCommon/GeometryShaderGen.h"
+#include "VideoCommon/PipelineMissReport.h"
 #include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/TextureCacheBase.h"
@@ -69,6 +72,7 @@ public:
   // Accesses ShaderGen shader caches asynchronously.
   // The optional will be empty if this pipeline is now background compiling.
   std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid);
+  std::optional<const AbstractPipeline*> GetUberPipelineForUidAsync(const GXUberPipelineUid& uid);
 
   // Shared shaders
   const AbstractShader* GetScreenQuadVertexShader() const
@@ -112,7 +116,8 @@ public:
 
   // Texture decoding compute shaders
   const AbstractShader* GetTextureDecodingShader(TextureFormat format,
-                                                 std::optional<TLUTFormat> palette_format);
+                                                 std::optional<TLUTFormat> palette_format,
+                                                 bool from_tmem);
 
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
@@ -121,6 +126,9 @@ private:
   void LoadCaches();
   void ClearCaches();
   void LoadPipelineUIDCache();
+  // Adds the UIDs from the pipeline bundles shipped for the current game, so that they're
+  // precompiled along with the UID cache.
+  void LoadPipelineUIDBundles();
   void ClosePipelineUIDCache();
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
@@ -159,8 +167,17 @@ private:
                                            std::unique_ptr<AbstractPipeline> pipeline);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
                                                std::unique_ptr<AbstractPipeline> pipeline);
-  void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
+  // Returns a pipeline linked from precompiled parts if the backend supports it and the shaders
+  // for the UID are already compiled, and queues the compile of the optimized pipeline.
+  const AbstractPipeline* FastLinkGXPipeline(const GXPipelineUid& uid);
+  void ReplaceFastLinkedGXPipeline(const GXPipelineUid& uid,
+                                   std::unique_ptr<AbstractPipeline> pipeline);
+  // Returns false if the UID was already known.
+  bool AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
+  // known is whether the UID was already in the pipeline cache.
+  void RecordAsyncPipelineMiss(const GXPipelineUid& uid, bool known);
+  void WritePipelineMissReport();
 
   // ASync Compiler Methods
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
@@ -168,6 +185,8 @@ private:
   void QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priority);
   void QueuePixelUberShaderCompile(const UberShader::PixelShaderUid& uid, u32 priority);
   void QueuePipelineCompile(const GXPipelineUid& uid, u32 priority);
+  void QueueOptimizedPipelineCompile(const GXPipelineUid& uid,
+                                     const AbstractPipelineConfig& config);
   void QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority);
 
   // Populating various caches.
@@ -184,10 +203,14 @@ private:
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
+  // for as few frames as possible, otherwise we risk framerate drops. Pipelines replacing a fast
+  // linked one come right after, as something can already be drawn with those. Partially
+  // specialized ubershaders only speed up drawing with the generic ones, so they come next.
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
+    COMPILE_PRIORITY_OPTIMIZED_PIPELINE = 150,
+    COMPILE_PRIORITY_SPECIALIZED_UBERSHADER_PIPELINE = 175,
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
     COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
   };
@@ -228,9 +251,13 @@ private:
   std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
   std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
+  // Fast linked pipelines which have been replaced. These may still be in use by the GPU, so they
+  // are only destroyed along with the rest of the cache.
+  std::vector<std::unique_ptr<AbstractPipeline>> m_replaced_gx_pipelines;
   File::IOFile m_gx_pipeline_uid_cache_file;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
+  PipelineMissReport m_pipeline_miss_report;
 
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
@@ -250,7 +277,8 @@ private:
       m_texture_reinterpret_pipelines;
 
   // Texture decoding shaders
-  std::map<std::pair<u32, u32>, std::unique_ptr<AbstractShader>> m_texture_decoding_shaders;
+  std::map<std::tuple<u32, u32, bool>, std::unique_ptr<AbstractShader>>
+      m_texture_decoding_shaders;
 
   Common::EventHook m_frame_end_handler;
 };
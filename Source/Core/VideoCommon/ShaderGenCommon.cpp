@@ -47,6 +47,7 @@ ShaderHostConfig ShaderHostConfig::GetCurrent()
   bits.backend_dynamic_vertex_loader = g_backend_info.bSupportsDynamicVertexLoader;
   bits.backend_vs_point_line_expand = g_ActiveConfig.UseVSForLinePointExpand();
   bits.backend_gl_layer_in_fs = g_backend_info.bSupportsGLLayerInFS;
+  bits.backend_multiview = g_backend_info.bSupportsMultiview;
   return bits;
 }
 
@@ -340,6 +341,14 @@ void GenerateVSPointExpansion(ShaderCode& object, std::string_view indent, u32 t
   }
 }
 
+void GenerateVSStereoOffset(ShaderCode& object)
+{
+  // Same as the geometry shader does for each layer, see GenerateGeometryShaderCode.
+  object.Write("float hoffset = (gl_ViewIndex == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS
+               ".y;\n"
+               "o.pos.x += hoffset * (o.pos.w - " I_STEREOPARAMS ".z);\n");
+}
+
 const char* GetInterpolationQualifier(bool msaa, bool ssaa, bool in_glsl_interface_block, bool in)
 {
   if (!msaa)
@@ -179,6 +179,7 @@ union ShaderHostConfig
   BitField<27, 1, bool, u32> backend_dynamic_vertex_loader;
   BitField<28, 1, bool, u32> backend_vs_point_line_expand;
   BitField<29, 1, bool, u32> backend_gl_layer_in_fs;
+  BitField<30, 1, bool, u32> backend_multiview;
 
   static ShaderHostConfig GetCurrent();
 };
@@ -205,6 +206,9 @@ void GenerateVSLineExpansion(ShaderCode& object, std::string_view indent, u32 te
 
 void GenerateVSPointExpansion(ShaderCode& object, std::string_view indent, u32 texgens);
 
+// Offsets o.pos horizontally for the eye being rendered, when multiview renders both at once.
+void GenerateVSStereoOffset(ShaderCode& object);
+
 // We use the flag "centroid" to fix some MSAA rendering bugs. With MSAA, the
 // pixel shader will be executed for each pixel which has at least one passed sample.
 // So there may be rendered pixels where the center of the pixel isn't in the primitive.
@@ -319,6 +323,9 @@ static const char s_shader_uniforms[] = "\tuint    components;\n"
                                         "\tuint vertex_offset_rawcolor0;\n"
                                         "\tuint vertex_offset_rawcolor1;\n"
                                         "\tuint4 vertex_offset_rawtex[2];\n"  // std140 is pain
+                                        "\tuint4 pulled_array_base[3];\n"
+                                        "\tuint4 pulled_array_stride[3];\n"
+                                        "\tfloat4 pulled_frac_scale[3];\n"
                                         "\t#define xfmem_texMtxInfo(i) (xfmem_pack1[(i)].x)\n"
                                         "\t#define xfmem_postMtxInfo(i) (xfmem_pack1[(i)].y)\n"
                                         "\t#define xfmem_color(i) (xfmem_pack1[(i)].z)\n"
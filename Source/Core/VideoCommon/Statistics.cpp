@@ -3,6 +3,7 @@
 
 #include "VideoCommon/Statistics.h"
 
+#include <algorithm>
 #include <cstring>
 #include <utility>
 
@@ -13,6 +14,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/GPUTimings.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -90,14 +92,20 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Texture memory", "%.1f MiB", texture_cache_memory / 1048576.0);
+  draw_statistic("  EFB copies", "%.1f MiB", efb_copy_texture_memory / 1048576.0);
+  draw_statistic("  Custom textures", "%.1f MiB", custom_texture_memory / 1048576.0);
+  draw_statistic("Texture pool", "%.1f MiB", texture_pool_memory / 1048576.0);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
+  draw_statistic("pipeline misses", "%d", num_pipeline_misses);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
+  draw_statistic("  Late depth test", "%d", this_frame.num_draw_calls_late_depth);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
@@ -106,6 +114,7 @@ void Statistics::Display() const
   draw_statistic("CP loads (DL)", "%d", this_frame.num_cp_loads_in_dl);
   draw_statistic("BP loads", "%d", this_frame.num_bp_loads);
   draw_statistic("BP loads (DL)", "%d", this_frame.num_bp_loads_in_dl);
+  draw_statistic("Redundant state writes", "%d", this_frame.num_redundant_state_writes);
   draw_statistic("Vertex streamed", "%i kB", this_frame.bytes_vertex_streamed / 1024);
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
@@ -114,6 +123,8 @@ void Statistics::Display() const
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
+  draw_statistic("Perf query stalls:", "%d", this_frame.num_perf_query_stalls);
+  draw_statistic("Stream buffer stalls:", "%d", this_frame.num_stream_buffer_stalls);
 
   ImGui::Columns(1);
 
@@ -153,6 +164,64 @@ void Statistics::DisplayProj() const
   ImGui::End();
 }
 
+void Statistics::DisplayGPUTimings() const
+{
+  if (!ImGui::Begin("GPU Timings", nullptr, ImGuiWindowFlags_NoNavInputs))
+  {
+    ImGui::End();
+    return;
+  }
+
+  if (!g_backend_info.bSupportsTimestampQueries || !g_gpu_timings)
+  {
+    ImGui::TextUnformatted("GPU timestamp queries are not supported by this backend.");
+    ImGui::End();
+    return;
+  }
+
+  const VideoCommon::GPUTimings::FrameTimes& times = g_gpu_timings->GetLastFrameTimes();
+
+  ImGui::Columns(2, "GPU Timings", true);
+
+  double total_milliseconds = 0.0;
+  for (u32 i = 0; i < static_cast<u32>(VideoCommon::GPUTimingCategory::Count); i++)
+  {
+    ImGui::TextUnformatted(
+        VideoCommon::GetGPUTimingCategoryName(static_cast<VideoCommon::GPUTimingCategory>(i)));
+    ImGui::NextColumn();
+    ImGui::Text("%.3f ms", times.milliseconds[i]);
+    ImGui::NextColumn();
+    total_milliseconds += times.milliseconds[i];
+  }
+  ImGui::TextUnformatted("Total");
+  ImGui::NextColumn();
+  ImGui::Text("%.3f ms", total_milliseconds);
+  ImGui::NextColumn();
+  ImGui::TextUnformatted("Unmeasured spans");
+  ImGui::NextColumn();
+  ImGui::Text("%u", times.dropped_spans);
+  ImGui::NextColumn();
+
+  ImGui::Columns(1);
+
+  // Only the most expensive pipelines are listed, the rest are usually negligible.
+  constexpr size_t MAX_PIPELINES = 10;
+  ImGui::NewLine();
+  ImGui::Text("Most expensive pipelines (%zu total):", times.pipelines.size());
+  for (size_t i = 0; i < std::min(times.pipelines.size(), MAX_PIPELINES); i++)
+  {
+    const VideoCommon::GPUTimings::PipelineTime& pipeline = times.pipelines[i];
+    const char* usage = pipeline.usage == AbstractPipelineUsage::GX ? "GX" :
+                        pipeline.usage == AbstractPipelineUsage::GXUber ? "Ubershader" :
+                                                                          "Utility";
+    ImGui::Text("%-10s %p: %.3f ms in %u batches", usage,
+                static_cast<const void*>(pipeline.pipeline), pipeline.milliseconds,
+                pipeline.spans);
+  }
+
+  ImGui::End();
+}
+
 void Statistics::AddScissorRect()
 {
   if (clear_scissors)
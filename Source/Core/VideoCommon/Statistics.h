@@ -6,6 +6,7 @@
 #include <array>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/BPFunctions.h"
 
 struct Statistics
@@ -14,11 +15,20 @@ struct Statistics
   int num_pixel_shaders_alive = 0;
   int num_vertex_shaders_created = 0;
   int num_vertex_shaders_alive = 0;
+  // Draws whose pipeline was not ready, so it was compiled on the spot or the draw used an
+  // ubershader or was skipped.
+  int num_pipeline_misses = 0;
 
   int num_textures_created = 0;
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
 
+  // Approximate video memory used by the texture cache, in bytes
+  u64 texture_cache_memory = 0;
+  u64 efb_copy_texture_memory = 0;
+  u64 custom_texture_memory = 0;
+  u64 texture_pool_memory = 0;
+
   int num_vertex_loaders = 0;
 
   std::array<float, 6> proj{};
@@ -49,12 +59,17 @@ struct Statistics
     int num_cp_loads_in_dl = 0;
     int num_xf_loads_in_dl = 0;
 
+    // BP, CP and XF writes which were skipped because they wouldn't have changed anything
+    int num_redundant_state_writes = 0;
+
     int num_prims = 0;
     int num_dl_prims = 0;
     int num_shader_changes = 0;
 
     int num_primitive_joins = 0;
     int num_draw_calls = 0;
+    // Draws whose pixel shader prevents the host GPU from testing depth early
+    int num_draw_calls_late_depth = 0;
 
     int num_dlists_called = 0;
 
@@ -79,6 +94,9 @@ struct Statistics
     int num_draw_done = 0;
     int num_token = 0;
     int num_token_int = 0;
+
+    int num_perf_query_stalls = 0;
+    int num_stream_buffer_stalls = 0;
   };
   ThisFrame this_frame;
   void ResetFrame();
@@ -86,6 +104,7 @@ struct Statistics
   void AddScissorRect();
   void Display() const;
   void DisplayProj() const;
+  void DisplayGPUTimings() const;
   void DisplayScissor();
 };
 
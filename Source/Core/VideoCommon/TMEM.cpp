@@ -4,10 +4,14 @@
 
 #include "VideoCommon/TMEM.h"
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include "Common/ChunkFile.h"
+#include "Common/Hash.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/TextureDecoder.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -37,6 +41,10 @@
 // As a side-effect, TMEM emulation also tracks if the texture unit configuration has changed at
 // all, which Dolphin's TextureCache takes advantage of.
 //
+// It also remembers hashes of the regions which were preloaded from RAM, so that textures read
+// from TMEM can be found in the TextureCache without hashing TMEM on every bind. Preloads are
+// shared between all texture units, and are only forgotten once something overwrites them.
+//
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Checking if a texture fits in TMEM or not is complicated by the fact that Flipper's TMEM is quite
@@ -99,6 +107,16 @@ static u32 CalculateUnitSize(TextureUnitState::BankConfig bank_config);
 
 static std::array<TextureUnitState, 8> s_unit;
 
+struct PreloadedRegion
+{
+  u32 base;
+  u32 size;
+  u64 hash;
+};
+
+// Never overlap each other
+static std::vector<PreloadedRegion> s_preloads;
+
 // On TMEM configuration changed:
 // 1. invalidate stage.
 
@@ -277,14 +295,63 @@ bool IsValid(u32 unit)
   return s_unit[unit].state != TextureUnitState::State::INVALID;
 }
 
+void Preloaded(u32 tmem_addr, u32 size)
+{
+  Overwritten(tmem_addr, size);
+  if (size != 0)
+    s_preloads.push_back({tmem_addr, size, Common::GetHash64(&s_tex_mem[tmem_addr], size, 0)});
+}
+
+void Overwritten(u32 tmem_addr, u32 size)
+{
+  std::erase_if(s_preloads, [&](const PreloadedRegion& region) {
+    return region.base < tmem_addr + size && tmem_addr < region.base + region.size;
+  });
+}
+
+void ForgetPreloads()
+{
+  s_preloads.clear();
+}
+
+std::optional<u64> GetPreloadHash(u32 tmem_addr, u32 size)
+{
+  // Textures which start at different offsets into the same preload are different textures, so
+  // the range itself is part of the hash.
+  std::array<u64, 2> hash_input = {u64(tmem_addr) << 32 | size, 0};
+
+  const u32 end = tmem_addr + size;
+  u32 covered = tmem_addr;
+  while (covered < end)
+  {
+    const auto region = std::ranges::find_if(s_preloads, [&](const PreloadedRegion& r) {
+      return r.base <= covered && covered < r.base + r.size;
+    });
+    if (region == s_preloads.end())
+      return std::nullopt;
+
+    hash_input[1] = region->hash;
+    hash_input[0] = Common::GetHash64(reinterpret_cast<const u8*>(hash_input.data()),
+                                      sizeof(hash_input), 0);
+    covered = region->base + region->size;
+  }
+
+  return hash_input[0];
+}
+
 void Init()
 {
   s_unit.fill({});
+  s_preloads.clear();
 }
 
 void DoState(PointerWrap& p)
 {
   p.DoArray(s_unit);
+
+  // TMEM was replaced, and is hashed again the next time it is used.
+  if (p.IsReadMode())
+    s_preloads.clear();
 }
 
 }  // namespace TMEM
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "Common/BitSet.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -20,6 +22,15 @@ void FinalizeBinds(BitSet32 used_textures);
 bool IsCached(u32 unit);
 bool IsValid(u32 unit);
 
+// Remembers a hash of the size bytes at tmem_addr, which were just preloaded from RAM.
+void Preloaded(u32 tmem_addr, u32 size);
+// Forgets the preloads which overlap the range, because something else was written there.
+void Overwritten(u32 tmem_addr, u32 size);
+void ForgetPreloads();
+// Returns a hash of the range if it's exactly covered by preloads which are still in TMEM, which
+// is much cheaper than hashing TMEM again.
+std::optional<u64> GetPreloadHash(u32 tmem_addr, u32 size);
+
 void Init();
 void DoState(PointerWrap& p);
 
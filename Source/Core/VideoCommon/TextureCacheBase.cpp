@@ -4,9 +4,11 @@
 #include "VideoCommon/TextureCacheBase.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -26,6 +28,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Trace.h"
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
@@ -42,6 +45,7 @@
 #include "VideoCommon/Assets/TextureAssetUtils.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimings.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
@@ -54,6 +58,7 @@
 #include "VideoCommon/TextureConversionShader.h"
 #include "VideoCommon/TextureConverterShaderGen.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecodingPool.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -63,6 +68,36 @@ static const u64 TEXHASH_INVALID = 0;
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
 
+// Smaller textures are quick enough to decode that the placeholder isn't worth it.
+static constexpr u32 MIN_ASYNC_DECODE_TEXELS = 128 * 128;
+
+// Below this, a GPU decode costs more in dispatch and copy overhead than it saves.
+static constexpr u32 MIN_GPU_DECODE_TEXELS = 64 * 64;
+
+// The remembered arbitrary mipmap detection results are dropped once there are this many.
+static constexpr size_t MAX_ARBITRARY_MIPMAP_RESULTS = 16384;
+
+static u64 GetArbitraryMipmapKey(u64 full_hash, u32 num_levels)
+{
+  // There are at most 11 levels
+  return full_hash ^ (u64{num_levels} << 60);
+}
+
+// Approximate amount of video memory used by a texture, for the texture cache's memory budget.
+static u64 GetTextureMemorySize(const TextureConfig& config)
+{
+  const u32 block_size = AbstractTexture::GetBlockSizeForFormat(config.format);
+  u64 size = 0;
+  for (u32 level = 0; level < config.levels; level++)
+  {
+    const u32 width = std::max(config.width >> level, 1u);
+    const u32 height = std::max(config.height >> level, 1u);
+    size += u64{AbstractTexture::CalculateStrideForFormat(config.format, width)} *
+            ((height + block_size - 1) / block_size);
+  }
+  return size * config.layers * config.samples;
+}
+
 static int xfb_count = 0;
 
 std::unique_ptr<TextureCacheBase> g_texture_cache;
@@ -101,6 +136,8 @@ TextureCacheBase::TextureCacheBase()
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
 
+  UpdateDecodingPool(g_ActiveConfig);
+
   TMEM::InvalidateAll();
 }
 
@@ -111,12 +148,18 @@ void TextureCacheBase::Shutdown()
 
   HiresTexture::Shutdown();
 
+  // The staging textures of textures which are still being dumped have to be released too.
+  m_texture_dumper.Shutdown();
+
   // For correctness, we need to invalidate textures before the gpu context starts shutting down.
   Invalidate();
 }
 
 TextureCacheBase::~TextureCacheBase()
 {
+  // Finish the queued decodes before the buffers they write to go away
+  m_decoding_pool.reset();
+
   Common::FreeAlignedMemory(m_temp);
   m_temp = nullptr;
 }
@@ -135,20 +178,22 @@ bool TextureCacheBase::Initialize()
 void TextureCacheBase::Invalidate()
 {
   FlushEFBCopies();
+  DiscardAsyncDecodes();
   TMEM::InvalidateAll();
 
   for (auto& bind : m_bound_textures)
     bind.reset();
-  m_textures_by_hash.clear();
+  m_textures_by_hash.Clear();
   m_textures_by_address.clear();
 
-  m_texture_pool.clear();
+  m_texture_pool.Clear();
 }
 
 void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 {
   if (config.bHiresTextures != m_backup_config.hires_textures ||
-      config.bCacheHiresTextures != m_backup_config.cache_hires_textures)
+      config.bCacheHiresTextures != m_backup_config.cache_hires_textures ||
+      config.bTranscodeHiresTextures != m_backup_config.transcode_hires_textures)
   {
     HiresTexture::Update();
   }
@@ -168,12 +213,50 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
       change_count != m_backup_config.graphics_mod_change_count)
   {
     Invalidate();
+    m_arbitrary_mipmap_results.clear();
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  if (config.fArbitraryMipmapDetectionThreshold !=
+      m_backup_config.arbitrary_mipmap_detection_threshold)
+  {
+    m_arbitrary_mipmap_results.clear();
+  }
+
+  if (config.GetTextureDecodingThreads() != m_backup_config.texture_decoding_threads ||
+      config.bAsyncTextureDecoding != m_backup_config.async_texture_decoding)
+  {
+    UpdateDecodingPool(config);
+  }
+
   SetBackupConfig(config);
 }
 
+void TextureCacheBase::UpdateDecodingPool(const VideoConfig& config)
+{
+  // Background decodes need at least one worker, even if large textures aren't split up
+  u32 num_threads = config.GetTextureDecodingThreads();
+  if (config.bAsyncTextureDecoding)
+    num_threads = std::max(num_threads, 1u);
+
+  if (m_decoding_pool && m_decoding_pool->GetNumThreads() == num_threads)
+    return;
+
+  // The old pool finishes the decodes it already started, so they can still be retrieved
+  m_decoding_pool.reset();
+  if (num_threads != 0)
+    m_decoding_pool = std::make_unique<VideoCommon::TextureDecodingPool>(num_threads);
+}
+
+void TextureCacheBase::DecodeTexture(u8* dst, const u8* src, int width, int height,
+                                     TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  if (m_decoding_pool)
+    m_decoding_pool->Decode(dst, src, width, height, texformat, tlut, tlutfmt);
+  else
+    TexDecoder_Decode(dst, src, width, height, texformat, tlut, tlutfmt);
+}
+
 void TextureCacheBase::Cleanup(int _frameCount)
 {
   TexAddrCache::iterator iter = m_textures_by_address.begin();
@@ -214,23 +297,91 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
   }
 
-  TexPool::iterator iter2 = m_texture_pool.begin();
-  TexPool::iterator tcend2 = m_texture_pool.end();
-  while (iter2 != tcend2)
+  m_texture_pool.Age(_frameCount, TEXTURE_POOL_KILL_THRESHOLD);
+
+  EnforceMemoryBudget(_frameCount);
+}
+
+std::optional<u64> TextureCacheBase::GetMemoryBudget(u64 texture_memory) const
+{
+  std::optional<u64> budget;
+  if (g_ActiveConfig.iTextureCacheMemoryBudget > 0)
+    budget = u64(g_ActiveConfig.iTextureCacheMemoryBudget) << 20;
+
+  // Once the process uses more video memory than the driver is willing to give it, the driver
+  // starts paging, which hurts far more than reloading a few textures. The cache gives back enough
+  // to get well below the driver's budget again, so that this doesn't trigger on every frame.
+  if (const std::optional<VideoMemoryInfo> info = g_gfx->GetVideoMemoryInfo())
   {
-    if (iter2->second.frameCount == FRAMECOUNT_INVALID)
+    if (info->usage > info->budget / 20 * 19)
     {
-      iter2->second.frameCount = _frameCount;
+      const u64 excess = info->usage - info->budget / 20 * 17;
+      const u64 pressure_budget = texture_memory > excess ? texture_memory - excess : 0;
+      budget = std::min(budget.value_or(pressure_budget), pressure_budget);
     }
-    if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second.frameCount)
+  }
+
+  return budget;
+}
+
+void TextureCacheBase::EnforceMemoryBudget(int frame_count)
+{
+  u64 cache_size = 0;
+  u64 efb_copy_size = 0;
+  u64 custom_texture_size = 0;
+  for (const auto& [addr, entry] : m_textures_by_address)
+  {
+    if (!entry->texture)
+      continue;
+
+    const u64 size = GetTextureMemorySize(entry->texture->GetConfig());
+    cache_size += size;
+    if (entry->IsCopy())
+      efb_copy_size += size;
+    else if (entry->is_custom_tex)
+      custom_texture_size += size;
+  }
+
+  g_stats.texture_cache_memory = cache_size;
+  g_stats.efb_copy_texture_memory = efb_copy_size;
+  g_stats.custom_texture_memory = custom_texture_size;
+  g_stats.texture_pool_memory = m_texture_pool.GetMemoryUsage();
+
+  const std::optional<u64> budget =
+      GetMemoryBudget(cache_size + m_texture_pool.GetMemoryUsage());
+  if (!budget)
+    return;
+
+  if (cache_size > *budget)
+  {
+    // EFB copies living on the host GPU are unrecoverable, and textures which were used this frame
+    // would only be loaded again right away.
+    std::vector<std::pair<TexAddrCache::iterator, u64>> candidates;
+    for (auto iter = m_textures_by_address.begin(); iter != m_textures_by_address.end(); ++iter)
     {
-      iter2 = m_texture_pool.erase(iter2);
+      const TCacheEntry& entry = *iter->second;
+      if (entry.texture && !entry.IsCopy() && !entry.IsLocked() && entry.frameCount != frame_count)
+        candidates.emplace_back(iter, GetTextureMemorySize(entry.texture->GetConfig()));
     }
-    else
+
+    std::ranges::sort(candidates, {}, [](const auto& candidate) {
+      return candidate.first->second->frameCount;
+    });
+    for (const auto& [iter, size] : candidates)
     {
-      ++iter2;
+      if (cache_size <= *budget)
+        break;
+
+      InvalidateTexture(iter);
+      cache_size -= size;
     }
+    SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   }
+
+  // Whatever is left of the budget goes to the pool, least recently released textures first. This
+  // also frees the textures which were just invalidated, if they're no longer bound.
+  m_texture_pool.Trim(*budget > cache_size ? *budget - cache_size : 0);
+  g_stats.texture_pool_memory = m_texture_pool.GetMemoryUsage();
 }
 
 bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -251,14 +402,18 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   m_backup_config.texfmt_overlay_center = config.bTexFmtOverlayCenter;
   m_backup_config.hires_textures = config.bHiresTextures;
   m_backup_config.cache_hires_textures = config.bCacheHiresTextures;
+  m_backup_config.transcode_hires_textures = config.bTranscodeHiresTextures;
   m_backup_config.stereo_3d = config.stereo_mode != StereoMode::Off;
   m_backup_config.efb_mono_depth = config.bStereoEFBMonoDepth;
   m_backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
   m_backup_config.disable_vram_copies = config.bDisableCopyToVRAM;
   m_backup_config.arbitrary_mipmap_detection = config.bArbitraryMipmapDetection;
+  m_backup_config.arbitrary_mipmap_detection_threshold = config.fArbitraryMipmapDetectionThreshold;
   m_backup_config.graphics_mods = config.bGraphicMods;
   m_backup_config.graphics_mod_change_count =
       config.graphics_mod_config ? config.graphics_mod_config->GetChangeCount() : 0;
+  m_backup_config.texture_decoding_threads = config.GetTextureDecodingThreads();
+  m_backup_config.async_texture_decoding = config.bAsyncTextureDecoding;
 }
 
 bool TextureCacheBase::DidLinkedAssetsChange(const TCacheEntry& entry)
@@ -419,7 +574,7 @@ void TextureCacheBase::ScaleTextureCacheEntryTo(RcTcacheEntry& entry, u32 new_wi
   // At this point new_texture has the old texture in it,
   // we can potentially reuse this, so let's move it back to the pool
   auto config = new_texture->texture->GetConfig();
-  m_texture_pool.emplace(
+  m_texture_pool.Add(
       config, TexPoolEntry(std::move(new_texture->texture), std::move(new_texture->framebuffer)));
 }
 
@@ -551,6 +706,10 @@ void TextureCacheBase::DoState(PointerWrap& p)
   // Flush all pending XFB copies before either loading or saving.
   FlushEFBCopies();
 
+  // Saved textures have to contain their actual data.
+  while (!m_async_decodes.empty())
+    FinishAsyncDecode(m_async_decodes.back().entry.get());
+
   p.Do(m_last_entry_id);
 
   if (p.IsWriteMode() || p.IsMeasureMode())
@@ -605,14 +764,13 @@ void TextureCacheBase::DoSaveState(PointerWrap& p)
         textures_by_address_list.emplace_back(it.first, id);
       }
     }
-    for (const auto& it : m_textures_by_hash)
-    {
-      if (ShouldSaveEntry(it.second))
+    m_textures_by_hash.ForEach([&](u64 hash, const RcTcacheEntry& entry) {
+      if (ShouldSaveEntry(entry))
       {
-        const u32 id = AddCacheEntryToMap(it.second);
-        textures_by_hash_list.emplace_back(it.first, id);
+        const u32 id = AddCacheEntryToMap(entry);
+        textures_by_hash_list.emplace_back(hash, id);
       }
-    }
+    });
     for (u32 i = 0; i < m_bound_textures.size(); i++)
     {
       const auto& tentry = m_bound_textures[i];
@@ -692,7 +850,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
   // before inserting entries into the cache, as GetEntry will always return null.
   const bool commit_state = p.IsReadMode();
   if (commit_state)
-    Invalidate();
+    InvalidateForLoadState();
 
   // Preload all cache entries.
   u32 size = 0;
@@ -704,7 +862,6 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
     auto tex = DeserializeTexture(p);
     auto entry =
         std::make_shared<TCacheEntry>(std::move(tex->texture), std::move(tex->framebuffer));
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
     entry->DoState(p);
     if (entry->texture && commit_state)
       id_map.emplace(i, entry);
@@ -749,7 +906,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      entry->textures_by_hash_iter = m_textures_by_hash.emplace(hash, entry);
+      AddToHashCache(entry, hash);
   }
 
   // Clear bound textures
@@ -771,6 +928,34 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
   }
 }
 
+void TextureCacheBase::InvalidateForLoadState()
+{
+  FlushEFBCopies();
+  DiscardAsyncDecodes();
+  TMEM::InvalidateAll();
+
+  for (auto& bind : m_bound_textures)
+    bind.reset();
+
+  // EFB copies are restored from the state, and can't be checked against RAM. Textures which had
+  // EFB copies applied to them are dropped too, as the copies they used may be gone.
+  for (auto iter = m_textures_by_address.begin(); iter != m_textures_by_address.end();)
+  {
+    TCacheEntry& entry = *iter->second;
+    if (entry.IsCopy() || !entry.references.empty() || entry.IsLocked() ||
+        entry.async_decode_pending)
+    {
+      iter = InvalidateTexture(iter);
+      continue;
+    }
+
+    // The restored EFB copies may overlap the texture.
+    entry.may_have_overlapping_textures = true;
+    entry.frameCount = FRAMECOUNT_INVALID;
+    ++iter;
+  }
+}
+
 void TextureCacheBase::OnFrameEnd()
 {
   // Flush any outstanding EFB copies to RAM, in case the game is running at an uncapped frame
@@ -778,6 +963,8 @@ void TextureCacheBase::OnFrameEnd()
   // copies.
   FlushEFBCopies();
 
+  m_texture_dumper.OnFrameEnd();
+
   Cleanup(g_presenter->FrameCount());
 }
 
@@ -953,6 +1140,8 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
 
         // If one copy is stereo, and the other isn't... not much we can do here :/
         const u32 layers_to_copy = std::min(entry->GetNumLayers(), entry_to_update->GetNumLayers());
+        if (entry_to_update->async_decode_pending)
+          FinishAsyncDecode(entry_to_update.get());
         for (u32 layer = 0; layer < layers_to_copy; layer++)
         {
           entry_to_update->texture->CopyRectangleFromTexture(entry->texture.get(), srcrect, layer,
@@ -1074,7 +1263,8 @@ void TextureCacheBase::BindTextures(BitSet32 used_textures,
     const RcTcacheEntry& tentry = m_bound_textures[i];
     if (used_textures[i] && tentry)
     {
-      g_gfx->SetTexture(i, tentry->texture.get());
+      g_gfx->SetTexture(i, tentry->async_decode_pending ? m_async_decode_placeholder.get() :
+                                                          tentry->texture.get());
       pixel_shader_manager.SetTexDims(i, tentry->native_width, tentry->native_height);
 
       auto& state = samplers[i];
@@ -1233,6 +1423,9 @@ private:
 
 TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
 {
+  if (!m_async_decodes.empty())
+    RetrieveAsyncDecodes();
+
   if (auto entry = LoadImpl(texture_info, false))
   {
     if (!DidLinkedAssetsChange(*entry))
@@ -1303,12 +1496,52 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
   return entry.get();
 }
 
+// Preloaded textures don't need to be hashed again while TMEM still holds what was preloaded.
+static std::optional<u64> GetTmemPreloadHash(const TextureInfo& texture_info)
+{
+  const u32 even_address = static_cast<u32>(texture_info.GetData() - s_tex_mem.data());
+  const u32 odd_address = static_cast<u32>(texture_info.GetTmemOddAddress() - s_tex_mem.data());
+  u32 even_size = texture_info.GetTextureSize();
+  u32 odd_size = 0;
+
+  if (texture_info.GetTextureFormat() == TextureFormat::RGBA8)
+  {
+    // The AR and GB halves of each block are split between the banks.
+    if (texture_info.GetLevelCount() > 1)
+      return std::nullopt;
+    even_size /= 2;
+    odd_size = even_size;
+  }
+  else
+  {
+    // Odd levels are read from the odd bank, even levels follow the base level in the even bank.
+    for (u32 level = 1; level < texture_info.GetLevelCount(); ++level)
+    {
+      const TextureInfo::MipLevel* mip_level = texture_info.GetMipMapLevel(level - 1);
+      if (!mip_level)
+        return std::nullopt;
+      (level % 2 ? odd_size : even_size) += mip_level->GetTextureSize();
+    }
+  }
+
+  const std::optional<u64> even_hash = TMEM::GetPreloadHash(even_address, even_size);
+  if (!even_hash || odd_size == 0)
+    return even_hash;
+
+  const std::optional<u64> odd_hash = TMEM::GetPreloadHash(odd_address, odd_size);
+  if (!odd_hash)
+    return std::nullopt;
+  return *even_hash ^ std::rotl(*odd_hash, 1);
+}
+
 RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize,
                                            const TextureInfo& texture_info)
 {
   if (!texture_info.IsDataValid())
     return {};
 
+  TRACE_SCOPE("TextureCacheBase::GetTexture");
+
   // Hash assigned to texcache entry (also used to generate filenames used for texture dumping and
   // custom texture lookup)
   u64 base_hash = TEXHASH_INVALID;
@@ -1337,10 +1570,16 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                                                             MemoryUpdate::Type::TextureMap);
   }
 
+  std::optional<u64> tmem_preload_hash;
+  if (texture_info.IsFromTmem())
+    tmem_preload_hash = GetTmemPreloadHash(texture_info);
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  base_hash = tmem_preload_hash ? *tmem_preload_hash :
+                                  Common::GetHash64(texture_info.GetData(),
+                                                    texture_info.GetTextureSize(),
+                                                    textureCacheSafetyColorSampleSize);
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
@@ -1476,6 +1715,36 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
           return entry;
         }
       }
+
+      // If the texture data changed, but not its palette, and the entry wasn't used during this
+      // frame for another texture at the same address, only update the rows which changed.
+      if (!entry->IsEfbCopy() && !entry->block_row_hashes.empty() && entry->hash != full_hash &&
+          (entry->hash ^ entry->base_hash) == (full_hash ^ base_hash) &&
+          entry->format == full_format && entry->native_width == texture_info.GetRawWidth() &&
+          entry->native_height == texture_info.GetRawHeight() &&
+          entry->frameCount != FRAMECOUNT_INVALID && entry->references.empty() &&
+          !entry->IsLocked() && !entry->async_decode_pending &&
+          CanUpdateChangedTextureRows(texture_info) &&
+          UpdateChangedTextureRows(entry.get(), texture_info, bytes_per_block))
+      {
+        RemoveFromHashCache(entry.get());
+        if (textureCacheSafetyColorSampleSize == 0 ||
+            std::max(texture_info.GetTextureSize(), palette_size) <=
+                (u32)textureCacheSafetyColorSampleSize * 8)
+        {
+          AddToHashCache(entry, full_hash);
+        }
+        entry->SetHashes(base_hash, full_hash);
+        INCSTAT(g_stats.num_textures_uploaded);
+
+        entry = DoPartialTextureUpdates(iter->second, texture_info.GetTlutAddress(),
+                                        texture_info.GetTlutFormat());
+        if (entry)
+        {
+          entry->texture->FinishedRendering();
+          return entry;
+        }
+      }
     }
 
     // Find the texture which hasn't been used for the longest time. Count paletted
@@ -1529,25 +1798,25 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
       std::max(texture_info.GetTextureSize(), palette_size) <=
           (u32)textureCacheSafetyColorSampleSize * 8)
   {
-    auto hash_range = m_textures_by_hash.equal_range(full_hash);
-    TexHashCache::iterator hash_iter = hash_range.first;
-    while (hash_iter != hash_range.second)
-    {
-      RcTcacheEntry& entry = hash_iter->second;
-      // All parameters, except the address, need to match here
-      if (entry->format == full_format && entry->native_levels >= texture_info.GetLevelCount() &&
-          entry->native_width == texture_info.GetRawWidth() &&
-          entry->native_height == texture_info.GetRawHeight())
+    // All parameters, except the address, need to match here
+    const RcTcacheEntry* hash_entry =
+        m_textures_by_hash.FindIf(full_hash, [&](const RcTcacheEntry& entry) {
+          return entry->format == full_format &&
+                 entry->native_levels >= texture_info.GetLevelCount() &&
+                 entry->native_width == texture_info.GetRawWidth() &&
+                 entry->native_height == texture_info.GetRawHeight();
+        });
+    if (hash_entry)
+    {
+      // The partial updates may invalidate other textures, so don't hold on to the index.
+      RcTcacheEntry entry = *hash_entry;
+      entry = DoPartialTextureUpdates(entry, texture_info.GetTlutAddress(),
+                                      texture_info.GetTlutFormat());
+      if (entry)
       {
-        entry = DoPartialTextureUpdates(hash_iter->second, texture_info.GetTlutAddress(),
-                                        texture_info.GetTlutFormat());
-        if (entry)
-        {
-          entry->texture->FinishedRendering();
-          return entry;
-        }
+        entry->texture->FinishedRendering();
+        return entry;
       }
-      ++hash_iter;
     }
   }
 
@@ -1606,6 +1875,83 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   return entry;
 }
 
+static std::vector<u64> CalculateBlockRowHashes(const TextureInfo& texture_info,
+                                                u32 bytes_per_block)
+{
+  const u32 row_size =
+      (texture_info.GetExpandedWidth() / texture_info.GetBlockWidth()) * bytes_per_block;
+  const u32 num_rows = texture_info.GetExpandedHeight() / texture_info.GetBlockHeight();
+
+  std::vector<u64> hashes(num_rows);
+  const u8* src = texture_info.GetData();
+  for (u32 row = 0; row < num_rows; ++row, src += row_size)
+    hashes[row] = Common::GetHash64(src, row_size, 0);
+  return hashes;
+}
+
+bool TextureCacheBase::CanUpdateChangedTextureRows(const TextureInfo& texture_info) const
+{
+  // Only single level textures decoded straight from RAM, since every row of a mipmapped texture
+  // changes all of its levels. Custom textures, graphics mods and dumping need the whole texture.
+  return g_ActiveConfig.bUpdateChangedTextureRows && !texture_info.IsFromTmem() &&
+         texture_info.GetLevelCount() == 1 && !g_ActiveConfig.bHiresTextures &&
+         !g_ActiveConfig.bGraphicMods && !g_ActiveConfig.bDumpTextures;
+}
+
+bool TextureCacheBase::UpdateChangedTextureRows(TCacheEntry* entry,
+                                                const TextureInfo& texture_info,
+                                                u32 bytes_per_block)
+{
+  std::vector<u64> row_hashes = CalculateBlockRowHashes(texture_info, bytes_per_block);
+  if (row_hashes.size() != entry->block_row_hashes.size())
+    return false;
+
+  const u32 num_rows = static_cast<u32>(row_hashes.size());
+  u32 num_changed_rows = 0;
+  for (u32 row = 0; row < num_rows; ++row)
+    num_changed_rows += row_hashes[row] != entry->block_row_hashes[row];
+
+  // Past this point, decoding the whole texture isn't much slower, and saves the extra uploads.
+  if (num_changed_rows * 2 > num_rows)
+    return false;
+
+  TRACE_SCOPE("TextureCacheBase::UpdateChangedTextureRows");
+
+  const u32 block_height = texture_info.GetBlockHeight();
+  const u32 expanded_width = texture_info.GetExpandedWidth();
+  const u32 src_row_size = (expanded_width / texture_info.GetBlockWidth()) * bytes_per_block;
+  const u32 decoded_row_size = expanded_width * sizeof(u32) * block_height;
+  CheckTempSize(num_changed_rows * decoded_row_size);
+
+  // Consecutive changed rows are decoded and uploaded together.
+  u32 row = 0;
+  while (row < num_rows)
+  {
+    if (row_hashes[row] == entry->block_row_hashes[row])
+    {
+      ++row;
+      continue;
+    }
+
+    u32 end_row = row + 1;
+    while (end_row < num_rows && row_hashes[end_row] != entry->block_row_hashes[end_row])
+      ++end_row;
+
+    DecodeTexture(m_temp, texture_info.GetData() + row * src_row_size, expanded_width,
+                  (end_row - row) * block_height, texture_info.GetTextureFormat(),
+                  texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+
+    const u32 top = row * block_height;
+    const u32 bottom = std::min(end_row * block_height, texture_info.GetRawHeight());
+    entry->texture->LoadRegion(0, 0, top, texture_info.GetRawWidth(), bottom - top,
+                               expanded_width, m_temp, (end_row - row) * decoded_row_size);
+    row = end_row;
+  }
+
+  entry->block_row_hashes = std::move(row_hashes);
+  return true;
+}
+
 // Note: the following function assumes all CustomTextureData has a single slice.  This is verified
 // with the 'GameTexture::Validate' function after the data is loaded. Only a single slice is
 // expected because each texture is loaded into a texture array
@@ -1657,26 +2003,52 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     if (!entry) [[unlikely]]
       return entry;
 
-    // We can decode on the GPU if it is a supported format and the flag is enabled.
-    // Currently we don't decode RGBA8 textures from TMEM, as that would require copying from both
-    // banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
-    // there's no conversion between formats. In the future this could be extended with a separate
-    // shader, however.
-    const bool decode_on_gpu =
-        g_ActiveConfig.UseGPUTextureDecoding() &&
-        !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
+    // Arbitrary mipmaps are only detected the first time a texture is loaded.
+    std::optional<u64> arbitrary_mipmap_key;
+    if (g_ActiveConfig.bArbitraryMipmapDetection && texLevels > 1)
+    {
+      const u64 key = GetArbitraryMipmapKey(creation_info.full_hash, texLevels);
+      if (const auto result = m_arbitrary_mipmap_results.find(key);
+          result != m_arbitrary_mipmap_results.end())
+      {
+        entry->has_arbitrary_mips = result->second;
+      }
+      else
+      {
+        arbitrary_mipmap_key = key;
+      }
+    }
+
+    // We can decode on the GPU if the flag is enabled, which covers every format. Small textures
+    // are still decoded on the CPU, as are mipmapped textures when arbitrary mipmap detection
+    // needs to look at the decoded levels. Mipmaps follow the choice made for the base level.
+    const bool decode_on_gpu = g_ActiveConfig.UseGPUTextureDecoding() &&
+                               expanded_width * expanded_height >= MIN_GPU_DECODE_TEXELS &&
+                               !arbitrary_mipmap_key;
+    const bool rgba8_from_tmem =
+        texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8;
 
     ArbitraryMipmapDetector arbitrary_mip_detector;
 
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
 
-    if (!decode_on_gpu ||
-        !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
-            texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
-            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
-            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+    const bool decode_async = ShouldDecodeAsync(texture_info, decode_on_gpu, skip_texture_dump);
+    if (decode_async)
+    {
+      QueueAsyncDecode(entry, texture_info, texLevels, creation_info.palette_size,
+                       arbitrary_mipmap_key);
+    }
+    else if (!decode_on_gpu ||
+             !DecodeTextureOnGPU(
+                 entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+                 texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
+                 (rgba8_from_tmem ? creation_info.bytes_per_block / 2 :
+                                    creation_info.bytes_per_block) *
+                     (expanded_width / texture_info.GetBlockWidth()),
+                 rgba8_from_tmem ? texture_info.GetTmemOddAddress() :
+                                   texture_info.GetTlutAddress(),
+                 texture_info.GetTlutFormat(), rgba8_from_tmem))
     {
       size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
@@ -1698,11 +2070,11 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
       CheckTempSize(total_texture_size);
       dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
+      if (!rgba8_from_tmem)
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        DecodeTexture(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                      texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                      texture_info.GetTlutFormat());
       }
       else
       {
@@ -1718,7 +2090,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       dst_buffer += decoded_texture_size;
     }
 
-    for (u32 level = 1; level != texLevels; ++level)
+    // Background decodes take care of all levels themselves
+    for (u32 level = 1; level != texLevels && !decode_async; ++level)
     {
       auto mip_level = texture_info.GetMipMapLevel(level - 1);
       if (!mip_level)
@@ -1736,9 +2109,9 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        DecodeTexture(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                      mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                      texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
         entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
                              mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
 
@@ -1749,7 +2122,17 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       }
     }
 
-    entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+    if (arbitrary_mipmap_key && !decode_async)
+    {
+      entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+      RememberArbitraryMipmaps(*arbitrary_mipmap_key, entry->has_arbitrary_mips);
+    }
+
+    if (texLevels == 1 && CanUpdateChangedTextureRows(texture_info))
+    {
+      entry->block_row_hashes =
+          CalculateBlockRowHashes(texture_info, creation_info.bytes_per_block);
+    }
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
     {
@@ -1773,7 +2156,7 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
           (u32)safety_color_sample_size * 8)
   {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
+    AddToHashCache(entry, creation_info.full_hash);
   }
 
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
@@ -1798,6 +2181,160 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   return entry;
 }
 
+bool TextureCacheBase::ShouldDecodeAsync(const TextureInfo& texture_info, bool decode_on_gpu,
+                                         bool skip_texture_dump) const
+{
+  if (!g_ActiveConfig.bAsyncTextureDecoding || !m_decoding_pool || decode_on_gpu)
+    return false;
+
+  // Dumping needs the decoded data right away, and RGBA8 textures from TMEM are split between both
+  // banks, so they're always decoded on the spot.
+  if ((g_ActiveConfig.bDumpTextures && !skip_texture_dump) ||
+      (texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8))
+  {
+    return false;
+  }
+
+  return texture_info.GetExpandedWidth() * texture_info.GetExpandedHeight() >=
+         MIN_ASYNC_DECODE_TEXELS;
+}
+
+void TextureCacheBase::QueueAsyncDecode(const RcTcacheEntry& entry,
+                                        const TextureInfo& texture_info, u32 num_levels,
+                                        u32 palette_size, std::optional<u64> arbitrary_mipmap_key)
+{
+  auto data = std::make_shared<AsyncDecodeData>();
+  data->texformat = texture_info.GetTextureFormat();
+  data->tlutfmt = texture_info.GetTlutFormat();
+  if (palette_size != 0)
+  {
+    const u8* tlut = texture_info.GetTlutAddress();
+    data->tlut.assign(tlut, tlut + palette_size);
+  }
+
+  // Copy the source data, as the game may overwrite it before the decode runs
+  const auto add_level = [&](u32 level, const u8* src, u32 src_size, u32 width, u32 height,
+                             u32 expanded_width, u32 expanded_height) {
+    data->levels.push_back({level, width, height, expanded_width, expanded_height,
+                            data->src.size(), data->dst_size});
+    data->src.insert(data->src.end(), src, src + src_size);
+    data->dst_size += expanded_width * expanded_height * sizeof(u32);
+  };
+
+  add_level(0, texture_info.GetData(), texture_info.GetTextureSize(), texture_info.GetRawWidth(),
+            texture_info.GetRawHeight(), texture_info.GetExpandedWidth(),
+            texture_info.GetExpandedHeight());
+  for (u32 level = 1; level < num_levels; ++level)
+  {
+    const auto mip_level = texture_info.GetMipMapLevel(level - 1);
+    if (!mip_level)
+      continue;
+
+    add_level(level, mip_level->GetData(), mip_level->GetTextureSize(), mip_level->GetRawWidth(),
+              mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
+              mip_level->GetExpandedHeight());
+  }
+
+  m_decoding_pool->QueueTask([data] {
+    // Leave room for the downsampling done by the arbitrary mipmap detection
+    const AsyncDecodeLevel& base = data->levels[0];
+    const size_t downsample_size =
+        size_t{base.expanded_width} * base.expanded_height * sizeof(u32) * 5 / 16;
+    data->dst.reset(data->dst_size + downsample_size);
+
+    const u8* tlut = data->tlut.empty() ? nullptr : data->tlut.data();
+    for (const AsyncDecodeLevel& level : data->levels)
+    {
+      TexDecoder_Decode(data->dst.data() + level.dst_offset, data->src.data() + level.src_offset,
+                        level.expanded_width, level.expanded_height, data->texformat, tlut,
+                        data->tlutfmt);
+    }
+
+    data->done.store(true, std::memory_order_release);
+    data->done.notify_all();
+  });
+
+  entry->async_decode_pending = true;
+  m_async_decodes.push_back({entry, std::move(data), arbitrary_mipmap_key});
+}
+
+void TextureCacheBase::RetrieveAsyncDecodes()
+{
+  for (auto it = m_async_decodes.begin(); it != m_async_decodes.end();)
+  {
+    if (it->data->done.load(std::memory_order_acquire))
+    {
+      // Keep the entry alive until it's updated, as it may only be referenced by the decode
+      const AsyncDecode decode = std::move(*it);
+      it = m_async_decodes.erase(it);
+      UploadAsyncDecode(decode);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void TextureCacheBase::FinishAsyncDecode(TCacheEntry* entry)
+{
+  const auto it = std::ranges::find_if(m_async_decodes, [entry](const AsyncDecode& decode) {
+    return decode.entry.get() == entry;
+  });
+  if (it == m_async_decodes.end())
+    return;
+
+  const AsyncDecode decode = std::move(*it);
+  m_async_decodes.erase(it);
+
+  decode.data->done.wait(false, std::memory_order_acquire);
+  UploadAsyncDecode(decode);
+}
+
+void TextureCacheBase::UploadAsyncDecode(const AsyncDecode& decode)
+{
+  TCacheEntry* entry = decode.entry.get();
+  entry->async_decode_pending = false;
+
+  // The texture has been released to the pool if the entry was invalidated in the meantime
+  if (!entry->texture)
+    return;
+
+  const AsyncDecodeData& data = *decode.data;
+
+  ArbitraryMipmapDetector arbitrary_mip_detector;
+  for (const AsyncDecodeLevel& level : data.levels)
+  {
+    const u8* decoded = data.dst.data() + level.dst_offset;
+    entry->texture->Load(level.level, level.width, level.height, level.expanded_width, decoded,
+                         level.expanded_width * level.expanded_height * sizeof(u32));
+    arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width, decoded);
+  }
+
+  if (decode.arbitrary_mipmap_key)
+  {
+    entry->has_arbitrary_mips =
+        arbitrary_mip_detector.HasArbitraryMipmaps(decode.data->dst.data() + data.dst_size);
+    RememberArbitraryMipmaps(*decode.arbitrary_mipmap_key, entry->has_arbitrary_mips);
+  }
+  entry->texture->FinishedRendering();
+}
+
+void TextureCacheBase::RememberArbitraryMipmaps(u64 key, bool has_arbitrary_mips)
+{
+  if (m_arbitrary_mipmap_results.size() >= MAX_ARBITRARY_MIPMAP_RESULTS)
+    m_arbitrary_mipmap_results.clear();
+  m_arbitrary_mipmap_results.emplace(key, has_arbitrary_mips);
+}
+
+void TextureCacheBase::DiscardAsyncDecodes()
+{
+  // The workers only write to their own buffers, so there's no need to wait for them here
+  for (AsyncDecode& decode : m_async_decodes)
+    decode.entry->async_decode_pending = false;
+  m_async_decodes.clear();
+}
+
 static void GetDisplayRectForXFBEntry(TCacheEntry* entry, u32 width, u32 height,
                                       MathUtil::Rectangle<int>* display_rect)
 {
@@ -2357,6 +2894,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     }
   }
 
+  // Set if the copy was written to RAM immediately, and RAM already held the same contents.
+  bool ram_unchanged = false;
   if (copy_to_ram)
   {
     const std::array<u32, 3> coefficients = GetRAMCopyFilterCoefficients(filter_coefficients);
@@ -2375,8 +2914,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
       {
         // Immediately flush it.
-        WriteEFBCopyToRAM(dst, bytes_per_row / sizeof(u32), num_blocks_y, dstStride,
-                          std::move(staging_texture));
+        ram_unchanged = !WriteEFBCopyToRAM(dst, bytes_per_row / sizeof(u32), num_blocks_y,
+                                           dstStride, std::move(staging_texture));
       }
       else
       {
@@ -2410,6 +2949,15 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     RcTcacheEntry& overlapping_entry = iter.first->second;
 
+    // Without a VRAM copy, textures overlapping the copy only need to be invalidated because RAM
+    // changed under them. If it didn't, they're still valid, and don't need to be decoded again.
+    // Pending copies still have to be tossed, since flushing them would overwrite this one.
+    if (ram_unchanged && !copy_to_vram && !overlapping_entry->pending_efb_copy)
+    {
+      ++iter.first;
+      continue;
+    }
+
     if (overlapping_entry->addr == dstAddr && overlapping_entry->is_xfb_copy)
     {
       for (auto& reference : overlapping_entry->references)
@@ -2454,11 +3002,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
 
       // Do not load textures by hash, if they were at least partly overwritten by an efb copy.
       // In this case, comparing the hash is not enough to check, if two textures are identical.
-      if (overlapping_entry->textures_by_hash_iter != m_textures_by_hash.end())
-      {
-        m_textures_by_hash.erase(overlapping_entry->textures_by_hash_iter);
-        overlapping_entry->textures_by_hash_iter = m_textures_by_hash.end();
-      }
+      RemoveFromHashCache(overlapping_entry.get());
     }
     ++iter.first;
   }
@@ -2504,12 +3048,17 @@ void TextureCacheBase::FlushStaleBinds()
   }
 }
 
-void TextureCacheBase::WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
+bool TextureCacheBase::WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
                                          std::unique_ptr<AbstractStagingTexture> staging_texture)
 {
   MathUtil::Rectangle<int> copy_rect(0, 0, static_cast<int>(width), static_cast<int>(height));
-  staging_texture->ReadTexels(copy_rect, dst_ptr, stride);
+  bool changed = true;
+  if (g_ActiveConfig.bElideUnchangedEFBCopies)
+    changed = staging_texture->ReadTexelsIfChanged(copy_rect, dst_ptr, stride);
+  else
+    staging_texture->ReadTexels(copy_rect, dst_ptr, stride);
   ReleaseEFBCopyStagingTexture(std::move(staging_texture));
+  return changed;
 }
 
 void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
@@ -2638,7 +3187,6 @@ RcTcacheEntry TextureCacheBase::AllocateCacheEntry(const TextureConfig& config)
 
   auto cacheEntry =
       std::make_shared<TCacheEntry>(std::move(alloc->texture), std::move(alloc->framebuffer));
-  cacheEntry->textures_by_hash_iter = m_textures_by_hash.end();
   cacheEntry->id = m_last_entry_id++;
   return cacheEntry;
 }
@@ -2646,13 +3194,8 @@ RcTcacheEntry TextureCacheBase::AllocateCacheEntry(const TextureConfig& config)
 std::optional<TextureCacheBase::TexPoolEntry>
 TextureCacheBase::AllocateTexture(const TextureConfig& config)
 {
-  TexPool::iterator iter = FindMatchingTextureFromPool(config);
-  if (iter != m_texture_pool.end())
-  {
-    auto entry = std::move(iter->second);
-    m_texture_pool.erase(iter);
-    return std::move(entry);
-  }
+  if (std::optional<TexPoolEntry> entry = m_texture_pool.Take(config))
+    return entry;
 
   std::unique_ptr<AbstractTexture> texture = g_gfx->CreateTexture(config);
   if (!texture)
@@ -2678,19 +3221,121 @@ TextureCacheBase::AllocateTexture(const TextureConfig& config)
   return TexPoolEntry(std::move(texture), std::move(framebuffer));
 }
 
-TextureCacheBase::TexPool::iterator
-TextureCacheBase::FindMatchingTextureFromPool(const TextureConfig& config)
+void TextureCacheBase::TexPool::Add(const TextureConfig& config, TexPoolEntry entry)
+{
+  u32 id;
+  if (!m_free_nodes.empty())
+  {
+    id = m_free_nodes.back();
+    m_free_nodes.pop_back();
+  }
+  else
+  {
+    id = static_cast<u32>(m_nodes.size());
+    m_nodes.emplace_back();
+  }
+
+  Node& node = m_nodes[id];
+  node.entry.emplace(std::move(entry));
+  node.config = config;
+  node.memory_size = GetTextureMemorySize(config);
+  node.prev = m_newest;
+  node.next = INVALID_NODE;
+
+  if (m_newest != INVALID_NODE)
+    m_nodes[m_newest].next = id;
+  else
+    m_oldest = id;
+  m_newest = id;
+
+  m_index.Insert(config, id);
+  m_memory_usage += node.memory_size;
+}
+
+std::optional<TextureCacheBase::TexPoolEntry>
+TextureCacheBase::TexPool::Take(const TextureConfig& config)
 {
   // Find a texture from the pool that does not have a frameCount of FRAMECOUNT_INVALID.
   // This prevents a texture from being used twice in a single frame with different data,
   // which potentially means that a driver has to maintain two copies of the texture anyway.
   // Render-target textures are fine through, as they have to be generated in a seperated pass.
   // As non-render-target textures are usually static, this should not matter much.
-  auto range = m_texture_pool.equal_range(config);
-  auto matching_iter = std::find_if(range.first, range.second, [](const auto& iter) {
-    return iter.first.IsRenderTarget() || iter.second.frameCount != FRAMECOUNT_INVALID;
+  const u32* match = m_index.FindIf(config, [&](u32 id) {
+    return config.IsRenderTarget() || m_nodes[id].entry->frameCount != FRAMECOUNT_INVALID;
   });
-  return matching_iter != range.second ? matching_iter : m_texture_pool.end();
+  if (!match)
+    return std::nullopt;
+
+  const u32 id = *match;
+  std::optional<TexPoolEntry> entry = std::move(m_nodes[id].entry);
+  Remove(id);
+  return entry;
+}
+
+void TextureCacheBase::TexPool::Age(int frame_count, int kill_threshold)
+{
+  for (u32 id = m_oldest; id != INVALID_NODE;)
+  {
+    TexPoolEntry& entry = *m_nodes[id].entry;
+    const u32 next = m_nodes[id].next;
+
+    if (entry.frameCount == FRAMECOUNT_INVALID)
+      entry.frameCount = frame_count;
+    if (frame_count > kill_threshold + entry.frameCount)
+      Remove(id);
+
+    id = next;
+  }
+}
+
+void TextureCacheBase::TexPool::Trim(u64 max_size)
+{
+  while (m_memory_usage > max_size && m_oldest != INVALID_NODE)
+    Remove(m_oldest);
+}
+
+void TextureCacheBase::TexPool::Clear()
+{
+  m_nodes.clear();
+  m_free_nodes.clear();
+  m_index.Clear();
+  m_oldest = INVALID_NODE;
+  m_newest = INVALID_NODE;
+  m_memory_usage = 0;
+}
+
+void TextureCacheBase::TexPool::Remove(u32 id)
+{
+  Node& node = m_nodes[id];
+  if (node.prev != INVALID_NODE)
+    m_nodes[node.prev].next = node.next;
+  else
+    m_oldest = node.next;
+  if (node.next != INVALID_NODE)
+    m_nodes[node.next].prev = node.prev;
+  else
+    m_newest = node.prev;
+
+  m_index.Erase(node.config, id);
+  m_memory_usage -= node.memory_size;
+  node.entry.reset();
+  m_free_nodes.push_back(id);
+}
+
+void TextureCacheBase::AddToHashCache(const RcTcacheEntry& entry, u64 hash)
+{
+  m_textures_by_hash.Insert(hash, entry);
+  entry->textures_by_hash_key = hash;
+}
+
+void TextureCacheBase::RemoveFromHashCache(TCacheEntry* entry)
+{
+  if (!entry->textures_by_hash_key)
+    return;
+
+  m_textures_by_hash.EraseIf(*entry->textures_by_hash_key,
+                             [entry](const RcTcacheEntry& other) { return other.get() == entry; });
+  entry->textures_by_hash_key.reset();
 }
 
 TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCacheEntry* entry)
@@ -2733,11 +3378,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
 
   RcTcacheEntry& entry = iter->second;
 
-  if (entry->textures_by_hash_iter != m_textures_by_hash.end())
-  {
-    m_textures_by_hash.erase(entry->textures_by_hash_iter);
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
-  }
+  RemoveFromHashCache(entry.get());
 
   // If this is a pending EFB copy, we don't want to flush it here.
   // Why? Because let's say a game is rendering a bloom-type effect, using EFB copies to essentially
@@ -2777,8 +3418,8 @@ void TextureCacheBase::ReleaseToPool(TCacheEntry* entry)
   if (!entry->texture)
     return;
   auto config = entry->texture->GetConfig();
-  m_texture_pool.emplace(config,
-                         TexPoolEntry(std::move(entry->texture), std::move(entry->framebuffer)));
+  m_texture_pool.Add(config,
+                     TexPoolEntry(std::move(entry->texture), std::move(entry->framebuffer)));
 }
 
 bool TextureCacheBase::CreateUtilityTextures()
@@ -2805,6 +3446,18 @@ bool TextureCacheBase::CreateUtilityTextures()
       return false;
   }
 
+  constexpr TextureConfig placeholder_texture_config(1, 1, 1, 1, 1, AbstractTextureFormat::RGBA8,
+                                                     0, AbstractTextureType::Texture_2DArray);
+  m_async_decode_placeholder =
+      g_gfx->CreateTexture(placeholder_texture_config, "Async texture decoding placeholder");
+  if (!m_async_decode_placeholder)
+    return false;
+
+  // Transparent black, so that not yet loaded textures mostly just don't show up
+  constexpr u32 placeholder_texel = 0;
+  m_async_decode_placeholder->Load(0, 1, 1, 1, reinterpret_cast<const u8*>(&placeholder_texel),
+                                   sizeof(placeholder_texel));
+
   return true;
 }
 
@@ -2828,6 +3481,7 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
     return;
   }
 
+  VideoCommon::GPUTimingScope gpu_timing(VideoCommon::GPUTimingCategory::EFBCopies);
   const auto scaled_src_rect = g_framebuffer_manager->ConvertEFBRectangle(src_rect);
   const auto framebuffer_rect = g_gfx->ConvertFramebufferRectangle(
       scaled_src_rect, g_framebuffer_manager->GetEFBFramebuffer());
@@ -2902,6 +3556,7 @@ void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams&
     return;
   }
 
+  VideoCommon::GPUTimingScope gpu_timing(VideoCommon::GPUTimingCategory::EFBCopies);
   const auto scaled_src_rect = g_framebuffer_manager->ConvertEFBRectangle(src_rect);
   const auto framebuffer_rect = g_gfx->ConvertFramebufferRectangle(
       scaled_src_rect, g_framebuffer_manager->GetEFBFramebuffer());
@@ -2968,14 +3623,16 @@ bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, c
                                           u32 data_size, TextureFormat format, u32 width,
                                           u32 height, u32 aligned_width, u32 aligned_height,
                                           u32 row_stride, const u8* palette,
-                                          TLUTFormat palette_format)
+                                          TLUTFormat palette_format, bool from_tmem)
 {
-  const auto* info = TextureConversionShaderTiled::GetDecodingShaderInfo(format);
+  from_tmem &= format == TextureFormat::RGBA8;
+  const auto* info = TextureConversionShaderTiled::GetDecodingShaderInfo(format, from_tmem);
   if (!info)
     return false;
 
   const AbstractShader* shader = g_shader_cache->GetTextureDecodingShader(
-      format, info->palette_size != 0 ? std::make_optional(palette_format) : std::nullopt);
+      format, info->palette_size != 0 ? std::make_optional(palette_format) : std::nullopt,
+      from_tmem);
   if (!shader)
     return false;
 
@@ -2985,7 +3642,18 @@ bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, c
 
   // Allocate space in stream buffer, and copy texture + palette across.
   u32 src_offset = 0, palette_offset = 0;
-  if (info->palette_size > 0)
+  if (from_tmem)
+  {
+    // Both banks are uploaded in one go, with the odd bank taking the place of the palette.
+    const u32 bank_size = data_size / 2;
+    if (!g_vertex_manager->UploadTexelBuffer(data, bank_size, info->buffer_format, &src_offset,
+                                             palette, bank_size, info->buffer_format,
+                                             &palette_offset))
+    {
+      return false;
+    }
+  }
+  else if (info->palette_size > 0)
   {
     if (!g_vertex_manager->UploadTexelBuffer(data, data_size, info->buffer_format, &src_offset,
                                              palette, info->palette_size,
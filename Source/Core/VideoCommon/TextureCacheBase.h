@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <filesystem>
 #include <fmt/format.h>
 #include <map>
@@ -17,8 +18,10 @@
 #include <vector>
 
 #include "Common/BitSet.h"
+#include "Common/Buffer.h"
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
+#include "Common/FlatMultiMap.h"
 #include "Common/MathUtil.h"
 
 #include "VideoCommon/AbstractTexture.h"
@@ -41,6 +44,7 @@ namespace VideoCommon
 {
 class CustomTextureData;
 class GameTextureAsset;
+class TextureDecodingPool;
 }  // namespace VideoCommon
 
 constexpr std::string_view EFB_DUMP_PREFIX = "efb1";
@@ -144,6 +148,14 @@ struct TCacheEntry
 
   bool reference_changed = false;  // used by xfb to determine when a reference xfb changed
 
+  // Set while the texture is still being decoded in the background. A placeholder texture is bound
+  // instead until the decoded data has been uploaded.
+  bool async_decode_pending = false;
+
+  // Hashes of each row of blocks of the base level, if UpdateChangedTextureRows is enabled and the
+  // texture can be updated in place. Used to only decode and upload the rows which changed.
+  std::vector<u64> block_row_hashes;
+
   // Texture dimensions from the GameCube's point of view
   u32 native_width = 0;
   u32 native_height = 0;
@@ -152,9 +164,8 @@ struct TCacheEntry
   // used to delete textures which haven't been used for TEXTURE_KILL_THRESHOLD frames
   int frameCount = FRAMECOUNT_INVALID;
 
-  // Keep an iterator to the entry in m_textures_by_hash, so it does not need to be searched when
-  // removing the cache entry
-  std::multimap<u64, std::shared_ptr<TCacheEntry>>::iterator textures_by_hash_iter;
+  // The hash this entry was added to m_textures_by_hash with, if it is in there
+  std::optional<u64> textures_by_hash_key;
 
   // This is used to keep track of both:
   //   * efb copies used by this partially updated texture
@@ -319,10 +330,12 @@ protected:
   // width, height are the size of the image in pixels.
   // aligned_width, aligned_height are the size of the image in pixels, aligned to the block size.
   // row_stride is the number of bytes for a row of blocks, not pixels.
+  // For RGBA8 textures from TMEM, data and palette point to the even and odd banks, each holding
+  // half of data_size, and row_stride is the stride within a single bank.
   bool DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, const u8* data, u32 data_size,
                           TextureFormat format, u32 width, u32 height, u32 aligned_width,
                           u32 aligned_height, u32 row_stride, const u8* palette,
-                          TLUTFormat palette_format);
+                          TLUTFormat palette_format, bool from_tmem = false);
 
   virtual void CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
                        u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
@@ -339,10 +352,52 @@ protected:
   size_t m_temp_size = 0;
 
 private:
+  // Ordered, since FindOverlappingTextures needs to query address ranges.
   using TexAddrCache = std::multimap<u32, RcTcacheEntry>;
-  using TexHashCache = std::multimap<u64, RcTcacheEntry>;
+  using TexHashCache = Common::FlatMultiMap<u64, RcTcacheEntry>;
+
+  // Unused textures, kept around so that new cache entries don't need to allocate a texture.
+  // Textures are indexed by their config, and also linked in the order they were released in, so
+  // that the least recently used ones can be released first when over the memory budget.
+  class TexPool
+  {
+  public:
+    void Add(const TextureConfig& config, TexPoolEntry entry);
+
+    // Takes a texture with the given config out of the pool, if there is a suitable one.
+    std::optional<TexPoolEntry> Take(const TextureConfig& config);
+
+    // Frees the textures which haven't been reused for kill_threshold frames.
+    void Age(int frame_count, int kill_threshold);
+
+    // Frees the least recently released textures until the pool fits in max_size bytes.
+    void Trim(u64 max_size);
+
+    void Clear();
 
-  using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
+    u64 GetMemoryUsage() const { return m_memory_usage; }
+
+  private:
+    static constexpr u32 INVALID_NODE = ~u32{0};
+
+    struct Node
+    {
+      std::optional<TexPoolEntry> entry;
+      TextureConfig config;
+      u64 memory_size = 0;
+      u32 prev = INVALID_NODE;
+      u32 next = INVALID_NODE;
+    };
+
+    void Remove(u32 id);
+
+    std::vector<Node> m_nodes;
+    std::vector<u32> m_free_nodes;
+    Common::FlatMultiMap<TextureConfig, u32> m_index;
+    u32 m_oldest = INVALID_NODE;
+    u32 m_newest = INVALID_NODE;
+    u64 m_memory_usage = 0;
+  };
 
   static bool DidLinkedAssetsChange(const TCacheEntry& entry);
 
@@ -367,13 +422,42 @@ private:
                                         TLUTFormat tlutfmt);
   void StitchXFBCopy(RcTcacheEntry& entry_to_update);
 
+  bool CanUpdateChangedTextureRows(const TextureInfo& texture_info) const;
+  // Decodes and uploads the rows of blocks which changed since the entry was last loaded, if few
+  // enough of them did. Returns false if the texture should be decoded from scratch instead.
+  bool UpdateChangedTextureRows(TCacheEntry* entry, const TextureInfo& texture_info,
+                                u32 bytes_per_block);
+
   void CheckTempSize(size_t required_size);
 
+  void UpdateDecodingPool(const VideoConfig& config);
+  void DecodeTexture(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
+                     const u8* tlut, TLUTFormat tlutfmt);
+
+  bool ShouldDecodeAsync(const TextureInfo& texture_info, bool decode_on_gpu,
+                         bool skip_texture_dump) const;
+  void QueueAsyncDecode(const RcTcacheEntry& entry, const TextureInfo& texture_info,
+                        u32 num_levels, u32 palette_size,
+                        std::optional<u64> arbitrary_mipmap_key);
+  // Uploads the textures which have finished decoding.
+  void RetrieveAsyncDecodes();
+  // Waits for the texture to finish decoding and uploads it.
+  void FinishAsyncDecode(TCacheEntry* entry);
+  void DiscardAsyncDecodes();
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
-  TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  void AddToHashCache(const RcTcacheEntry& entry, u64 hash);
+  void RemoveFromHashCache(TCacheEntry* entry);
+
+  // Returns how much video memory the cache and pool may use, given that they use texture_memory
+  // now. This is the configured budget, lowered if the backend reports memory pressure.
+  std::optional<u64> GetMemoryBudget(u64 texture_memory) const;
+  // Invalidates the least recently used textures until the cache and pool fit in the budget.
+  void EnforceMemoryBudget(int frame_count);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
@@ -392,8 +476,10 @@ private:
   static std::array<u32, 3>
   GetVRAMCopyFilterCoefficients(const CopyFilterCoefficients::Values& coefficients);
 
-  // Flushes a pending EFB copy to RAM from the host to the guest RAM.
-  void WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
+  // Flushes a pending EFB copy to RAM from the host to the guest RAM. Returns false if guest RAM
+  // already held the same contents and ElideUnchangedEFBCopies is enabled, in which case nothing
+  // was written.
+  bool WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
                          std::unique_ptr<AbstractStagingTexture> staging_texture);
   void FlushEFBCopy(TCacheEntry* entry);
 
@@ -406,6 +492,9 @@ private:
   bool CheckReadbackTexture(u32 width, u32 height, AbstractTextureFormat format);
   void DoSaveState(PointerWrap& p);
   void DoLoadState(PointerWrap& p);
+  // Like Invalidate, but keeps the textures which were decoded from RAM, as their hashes are
+  // checked against RAM when they're used anyway, and the texture pool.
+  void InvalidateForLoadState();
 
   // m_textures_by_address is the authoritive version of what's actually "in" the texture cache
   // but it's possible for invalidated TCache entries to live on elsewhere
@@ -419,6 +508,10 @@ private:
   // It's valid for textures to be in here after they've been invalidated
   std::array<RcTcacheEntry, 8> m_bound_textures{};
 
+  // Results of the arbitrary mipmap detection, by full hash and level count of the texture. They
+  // outlive the cache entries, so the detection runs once per texture rather than every load.
+  std::unordered_map<u64, bool> m_arbitrary_mipmap_results;
+
   TexPool m_texture_pool;
   u64 m_last_entry_id = 0;
 
@@ -430,14 +523,18 @@ private:
     bool texfmt_overlay_center;
     bool hires_textures;
     bool cache_hires_textures;
+    bool transcode_hires_textures;
     bool copy_cache_enable;
     bool stereo_3d;
     bool efb_mono_depth;
     bool gpu_texture_decoding;
     bool disable_vram_copies;
     bool arbitrary_mipmap_detection;
+    float arbitrary_mipmap_detection_threshold;
     bool graphics_mods;
     u32 graphics_mod_change_count;
+    u32 texture_decoding_threads;
+    bool async_texture_decoding;
   };
   BackupConfig m_backup_config = {};
 
@@ -448,6 +545,50 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
+  // Threads used for decoding textures on the CPU, if enabled.
+  std::unique_ptr<VideoCommon::TextureDecodingPool> m_decoding_pool;
+
+  struct AsyncDecodeLevel
+  {
+    u32 level;
+    u32 width;
+    u32 height;
+    u32 expanded_width;
+    u32 expanded_height;
+    size_t src_offset;
+    size_t dst_offset;
+  };
+
+  // Everything a background decode needs, as the emulated memory and the texture cache entry may
+  // change while it's running. Once done is set, the worker doesn't touch this anymore.
+  struct AsyncDecodeData
+  {
+    std::vector<AsyncDecodeLevel> levels;
+    std::vector<u8> src;
+    std::vector<u8> tlut;
+    TextureFormat texformat;
+    TLUTFormat tlutfmt;
+    Common::UniqueBuffer<u8> dst;
+    size_t dst_size = 0;
+    std::atomic<bool> done = false;
+  };
+
+  struct AsyncDecode
+  {
+    RcTcacheEntry entry;
+    std::shared_ptr<AsyncDecodeData> data;
+    // Set if arbitrary mipmaps have to be detected once the texture is decoded
+    std::optional<u64> arbitrary_mipmap_key;
+  };
+
+  void UploadAsyncDecode(const AsyncDecode& decode);
+  void RememberArbitraryMipmaps(u64 key, bool has_arbitrary_mips);
+
+  std::vector<AsyncDecode> m_async_decodes;
+
+  // Bound in place of textures which are still being decoded.
+  std::unique_ptr<AbstractTexture> m_async_decode_placeholder;
+
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
 
@@ -1034,8 +1034,36 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
       }
       )"}}};
 
-const DecodingShaderInfo* GetDecodingShaderInfo(TextureFormat format)
+// The AR channels of each block are in the even bank, and the GB channels at the same offset in the
+// odd bank, which is bound in place of the palette.
+static const DecodingShaderInfo s_rgba8_from_tmem_decoding_shader_info{
+    TEXEL_BUFFER_FORMAT_R16_UINT, 0, 8, 8, false,
+    R"(
+      DEFINE_MAIN(8, 8)
+      {
+        uint2 coords = gl_GlobalInvocationID.xy;
+
+        // Tiled in 4x4 blocks, 16 bits per pixel in each bank
+        uint buffer_pos = GetTiledTexelOffset(uint2(4u, 4u), coords);
+        uint val1 = FETCH(buffer_pos);
+        uint val2 = FETCH_PALETTE(buffer_pos);
+
+        uint4 color;
+        color.a = (val1 & 0xFFu);
+        color.r = (val1 >> 8);
+        color.g = (val2 & 0xFFu);
+        color.b = (val2 >> 8);
+
+        float4 norm_color = float4(color) / 255.0;
+        imageStore(output_image, int3(int2(coords), 0), norm_color);
+      }
+      )"};
+
+const DecodingShaderInfo* GetDecodingShaderInfo(TextureFormat format, bool from_tmem)
 {
+  if (from_tmem && format == TextureFormat::RGBA8)
+    return &s_rgba8_from_tmem_decoding_shader_info;
+
   auto iter = s_decoding_shader_info.find(format);
   return iter != s_decoding_shader_info.end() ? &iter->second : nullptr;
 }
@@ -1051,13 +1079,16 @@ std::pair<u32, u32> GetDispatchCount(const DecodingShaderInfo* info, u32 width,
 }
 
 std::string GenerateDecodingShader(TextureFormat format, std::optional<TLUTFormat> palette_format,
-                                   APIType api_type)
+                                   bool from_tmem, APIType api_type)
 {
-  const DecodingShaderInfo* info = GetDecodingShaderInfo(format);
+  const DecodingShaderInfo* info = GetDecodingShaderInfo(format, from_tmem);
   if (!info)
     return "";
 
   std::ostringstream ss;
+  if (info == &s_rgba8_from_tmem_decoding_shader_info)
+    ss << "#define HAS_PALETTE 1\n";
+
   if (palette_format.has_value())
   {
     switch (*palette_format)
@@ -35,7 +35,9 @@ struct DecodingShaderInfo
 
 // Obtain shader information for the specified texture format.
 // If this format does not have a shader written for it, returns nullptr.
-const DecodingShaderInfo* GetDecodingShaderInfo(TextureFormat format);
+// RGBA8 textures preloaded to TMEM have their own shader, as they're split between both TMEM banks.
+// These take the odd bank in place of the palette.
+const DecodingShaderInfo* GetDecodingShaderInfo(TextureFormat format, bool from_tmem);
 
 // Determine how many thread groups should be dispatched for an image of the specified width/height.
 // First is the number of X groups, second is the number of Y groups, Z is always one.
@@ -43,7 +45,7 @@ std::pair<u32, u32> GetDispatchCount(const DecodingShaderInfo* info, u32 width,
 
 // Returns the GLSL string containing the texture decoding shader for the specified format.
 std::string GenerateDecodingShader(TextureFormat format, std::optional<TLUTFormat> palette_format,
-                                   APIType api_type);
+                                   bool from_tmem, APIType api_type);
 
 // Returns the GLSL string containing the palette conversion shader for the specified format.
 std::string GeneratePaletteConversionShader(TLUTFormat palette_format, APIType api_type);
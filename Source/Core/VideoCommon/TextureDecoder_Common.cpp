@@ -307,6 +307,26 @@ void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFor
     TexDecoder_DrawOverlay(dst, width, height, texformat);
 }
 
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int first_row, int num_rows,
+                           TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  const int block_width = TexDecoder_GetBlockWidthInTexels(texformat);
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  const int block_size =
+      TexDecoder_GetTexelSizeInNibbles(texformat) * block_width * block_height / 2;
+  const size_t blocks_per_row = (width + block_width - 1) / block_width;
+
+  src += (first_row / block_height) * blocks_per_row * block_size;
+  dst += static_cast<size_t>(first_row) * width * sizeof(u32);
+  _TexDecoder_DecodeImpl((u32*)dst, src, width, num_rows, texformat, tlut, tlutfmt);
+}
+
+void TexDecoder_FinishDecodeRows(u8* dst, int width, int height, TextureFormat texformat)
+{
+  if (TexFmt_Overlay_Enable)
+    TexDecoder_DrawOverlay(dst, width, height, texformat);
+}
+
 static inline u32 DecodePixel_IA8(u16 val)
 {
   int a = val & 0xFF;
@@ -0,0 +1,143 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureDecodingPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "Common/Thread.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace VideoCommon
+{
+namespace
+{
+// Waking up a worker costs a few microseconds, so don't split textures into bands that are faster
+// than that to decode.
+constexpr int MIN_TEXELS_PER_BAND = 32 * 1024;
+
+struct BandedDecode
+{
+  void Run()
+  {
+    for (int band = next_band++; band < num_bands; band = next_band++)
+    {
+      const int first_row = band * rows_per_band;
+      const int num_rows = std::min(rows_per_band, height - first_row);
+      TexDecoder_DecodeRows(dst, src, width, first_row, num_rows, texformat, tlut, tlutfmt);
+
+      if (remaining_bands.fetch_sub(1) == 1)
+        remaining_bands.notify_all();
+    }
+  }
+
+  u8* dst;
+  const u8* src;
+  int width;
+  int height;
+  TextureFormat texformat;
+  const u8* tlut;
+  TLUTFormat tlutfmt;
+
+  int rows_per_band;
+  int num_bands;
+  std::atomic<int> next_band{0};
+  std::atomic<int> remaining_bands;
+};
+}  // namespace
+
+TextureDecodingPool::TextureDecodingPool(u32 num_threads)
+{
+  for (u32 i = 0; i < num_threads; ++i)
+    m_threads.emplace_back(&TextureDecodingPool::WorkerThread, this);
+}
+
+TextureDecodingPool::~TextureDecodingPool()
+{
+  {
+    std::lock_guard lk(m_tasks_lock);
+    m_exit = true;
+  }
+  m_tasks_cv.notify_all();
+
+  for (std::thread& thread : m_threads)
+    thread.join();
+}
+
+void TextureDecodingPool::WorkerThread()
+{
+  Common::SetCurrentThreadName("Texture Decoder");
+
+  std::unique_lock lk(m_tasks_lock);
+  while (true)
+  {
+    m_tasks_cv.wait(lk, [this] { return m_exit || !m_tasks.empty(); });
+    if (m_tasks.empty())
+      return;
+
+    std::function<void()> task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+
+    lk.unlock();
+    task();
+    lk.lock();
+  }
+}
+
+void TextureDecodingPool::QueueTask(std::function<void()> task)
+{
+  {
+    std::lock_guard lk(m_tasks_lock);
+    m_tasks.push_back(std::move(task));
+  }
+  m_tasks_cv.notify_one();
+}
+
+void TextureDecodingPool::Decode(u8* dst, const u8* src, int width, int height,
+                                 TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  const int num_block_rows = (height + block_height - 1) / block_height;
+  const int max_bands = std::max(width * height / MIN_TEXELS_PER_BAND, 1);
+  const int num_bands =
+      std::min({num_block_rows, max_bands, static_cast<int>(m_threads.size()) + 1});
+
+  if (num_bands <= 1)
+  {
+    TexDecoder_Decode(dst, src, width, height, texformat, tlut, tlutfmt);
+    return;
+  }
+
+  // Shared with the helper tasks, which may only start running after all bands have been decoded
+  const auto decode = std::make_shared<BandedDecode>();
+  decode->dst = dst;
+  decode->src = src;
+  decode->width = width;
+  decode->height = height;
+  decode->texformat = texformat;
+  decode->tlut = tlut;
+  decode->tlutfmt = tlutfmt;
+
+  const int block_rows_per_band = (num_block_rows + num_bands - 1) / num_bands;
+  decode->rows_per_band = block_rows_per_band * block_height;
+  decode->num_bands = (num_block_rows + block_rows_per_band - 1) / block_rows_per_band;
+  decode->remaining_bands = decode->num_bands;
+
+  for (int i = 1; i < decode->num_bands; ++i)
+    QueueTask([decode] { decode->Run(); });
+
+  // Bands that no worker has picked up yet are decoded here, so this can't wait on workers that
+  // are busy with other tasks.
+  decode->Run();
+
+  for (int remaining = decode->remaining_bands.load(); remaining != 0;
+       remaining = decode->remaining_bands.load())
+  {
+    decode->remaining_bands.wait(remaining);
+  }
+
+  TexDecoder_FinishDecodeRows(dst, width, height, texformat);
+}
+}  // namespace VideoCommon
@@ -0,0 +1,51 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+enum class TextureFormat;
+enum class TLUTFormat;
+
+namespace VideoCommon
+{
+// Worker threads for decoding textures on the CPU. Large textures are split into bands of block
+// rows which are decoded in parallel, and whole texture loads can be run in the background.
+class TextureDecodingPool
+{
+public:
+  explicit TextureDecodingPool(u32 num_threads);
+  ~TextureDecodingPool();
+
+  TextureDecodingPool(const TextureDecodingPool&) = delete;
+  TextureDecodingPool& operator=(const TextureDecodingPool&) = delete;
+
+  u32 GetNumThreads() const { return static_cast<u32>(m_threads.size()); }
+
+  // Same as TexDecoder_Decode, but large textures are split up between the worker threads and the
+  // calling thread. Returns once the whole texture has been decoded.
+  void Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
+              const u8* tlut, TLUTFormat tlutfmt);
+
+  // Runs the task on one of the worker threads.
+  void QueueTask(std::function<void()> task);
+
+private:
+  void WorkerThread();
+
+  std::vector<std::thread> m_threads;
+
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex m_tasks_lock;
+  std::condition_variable m_tasks_cv;
+  bool m_exit = false;
+};
+}  // namespace VideoCommon
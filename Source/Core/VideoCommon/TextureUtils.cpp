@@ -3,19 +3,31 @@
 
 #include "VideoCommon/TextureUtils.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
+#include "Common/Assert.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/Image.h"
 #include "Common/Logging/Log.h"
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
 
+#include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/AbstractStagingTexture.h"
 #include "VideoCommon/AbstractTexture.h"
 
 namespace
 {
+// Textures are read back in batches at the end of the frame, so that the GPU doesn't have to be
+// waited on for every single one. These limit the memory used by the staging textures of a batch,
+// and by the textures waiting to be encoded.
+constexpr size_t MAX_PENDING_READBACK_BYTES = 64 * 1024 * 1024;
+constexpr size_t MAX_QUEUED_BYTES = 256 * 1024 * 1024;
+
 std::string BuildDumpTextureFilename(std::string basename, u32 level, bool is_arbitrary)
 {
   if (is_arbitrary)
@@ -47,6 +59,9 @@ void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 lev
   texture.Save(filename, level, Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL));
 }
 
+TextureDumper::TextureDumper() = default;
+TextureDumper::~TextureDumper() = default;
+
 void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
                                 bool is_arbitrary)
 {
@@ -55,6 +70,9 @@ void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string ba
 
   if (m_dumped_textures.empty())
   {
+    m_encode_thread.Reset("Texture Dumping",
+                          [this](EncodeRequest request) { EncodeTexture(std::move(request)); });
+
     if (!File::IsDirectory(dump_dir))
       File::CreateDir(dump_dir);
 
@@ -74,7 +92,75 @@ void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string ba
   if (file_existed)
     return;
 
-  texture.Save(fmt::format("{}/{}.png", dump_dir, name), level,
-               Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL));
+  // Same restrictions as AbstractTexture::Save
+  const TextureConfig& config = texture.GetConfig();
+  ASSERT(!AbstractTexture::IsCompressedFormat(config.format));
+  ASSERT(level < config.levels);
+  ASSERT(config.format != AbstractTextureFormat::RGBA16F);
+
+  const TextureConfig readback_config(std::max(1u, config.width >> level),
+                                      std::max(1u, config.height >> level), 1, 1, 1,
+                                      AbstractTextureFormat::RGBA8, 0,
+                                      AbstractTextureType::Texture_2DArray);
+  auto readback_texture =
+      g_gfx->CreateStagingTexture(StagingTextureType::Readback, readback_config);
+  if (!readback_texture)
+    return;
+
+  const size_t size = size_t{readback_config.width} * readback_config.height * 4;
+  if (m_pending_readback_bytes + size > MAX_PENDING_READBACK_BYTES)
+    FlushReadbacks();
+
+  readback_texture->CopyFromTexture(&texture, 0, level);
+  m_pending_readbacks.push_back(
+      {std::move(readback_texture), fmt::format("{}/{}.png", dump_dir, name)});
+  m_pending_readback_bytes += size;
+}
+
+void TextureDumper::OnFrameEnd()
+{
+  FlushReadbacks();
+}
+
+void TextureDumper::Shutdown()
+{
+  FlushReadbacks();
+  m_encode_thread.Shutdown();
+}
+
+void TextureDumper::FlushReadbacks()
+{
+  if (m_pending_readbacks.empty())
+    return;
+
+  const int compression_level = Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL);
+  for (PendingReadback& readback : m_pending_readbacks)
+  {
+    AbstractStagingTexture& texture = *readback.texture;
+    const u32 width = texture.GetWidth();
+    const u32 height = texture.GetHeight();
+    const size_t size = size_t{width} * height * 4;
+
+    // Encoding is much slower than reading back, so wait for the worker thread to catch up rather
+    // than piling up textures indefinitely.
+    if (m_queued_bytes.load(std::memory_order_relaxed) + size > MAX_QUEUED_BYTES)
+      m_encode_thread.WaitForCompletion();
+
+    EncodeRequest request{std::move(readback.filename), Common::UniqueBuffer<u8>(size), width,
+                          height, compression_level};
+    texture.ReadTexels(texture.GetRect(), request.data.data(), width * 4);
+
+    m_queued_bytes.fetch_add(size, std::memory_order_relaxed);
+    m_encode_thread.Push(std::move(request));
+  }
+  m_pending_readbacks.clear();
+  m_pending_readback_bytes = 0;
+}
+
+void TextureDumper::EncodeTexture(EncodeRequest request)
+{
+  Common::SavePNG(request.filename, request.data.data(), Common::ImageByteFormat::RGBA,
+                  request.width, request.height, request.width * 4, request.compression_level);
+  m_queued_bytes.fetch_sub(request.data.size(), std::memory_order_relaxed);
 }
 }  // namespace VideoCommon::TextureUtils
@@ -3,11 +3,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
+#include "Common/Buffer.h"
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
+class AbstractStagingTexture;
 class AbstractTexture;
 
 namespace VideoCommon::TextureUtils
@@ -15,12 +21,45 @@ namespace VideoCommon::TextureUtils
 class TextureDumper
 {
 public:
+  TextureDumper();
+  ~TextureDumper();
+
   // Only dumps if texture did not already exist anywhere within the dump-textures path.
+  // The texture is read back at the end of the frame and encoded on a worker thread.
   void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
                    bool is_arbitrary);
 
+  // Passes the textures copied during the frame to the worker thread.
+  void OnFrameEnd();
+
+  // Writes out all pending textures. Must be called before the backend is shut down.
+  void Shutdown();
+
 private:
+  struct PendingReadback
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    std::string filename;
+  };
+
+  struct EncodeRequest
+  {
+    std::string filename;
+    Common::UniqueBuffer<u8> data;
+    u32 width;
+    u32 height;
+    int compression_level;
+  };
+
+  void FlushReadbacks();
+  void EncodeTexture(EncodeRequest request);
+
   std::unordered_set<std::string> m_dumped_textures;
+
+  std::vector<PendingReadback> m_pending_readbacks;
+  size_t m_pending_readback_bytes = 0;
+  Common::WorkQueueThreadSP<EncodeRequest> m_encode_thread;
+  std::atomic<size_t> m_queued_bytes = 0;
 };
 
 void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
@@ -28,14 +28,21 @@ PixelShaderUid GetPixelShaderUid()
                            bpmem.alpha_test.TestResult() == AlphaTestResult::Undetermined) &&
                           !(bpmem.zmode.test_enable && bpmem.genMode.zfreeze);
   uid_data->per_pixel_depth =
-      (bpmem.ztex2.op != ZTexOp::Disabled && bpmem.GetEmulatedZ() == EmulatedZ::Late) ||
-      (!g_ActiveConfig.bFastDepthCalc && bpmem.zmode.test_enable && !uid_data->early_depth) ||
-      (bpmem.zmode.test_enable && bpmem.genMode.zfreeze);
+      bpmem.zmode.IsDepthUsed() &&
+      ((bpmem.ztex2.op != ZTexOp::Disabled && bpmem.GetEmulatedZ() == EmulatedZ::Late) ||
+       (!g_ActiveConfig.bFastDepthCalc && !uid_data->early_depth) || bpmem.genMode.zfreeze);
   uid_data->uint_output = bpmem.blendmode.UseLogicOp();
 
   return out;
 }
 
+void SpecializePixelShaderUid(PixelShaderUid* uid)
+{
+  pixel_ubershader_uid_data* const uid_data = uid->GetUidData();
+  uid_data->specialized_stages = 1;
+  uid_data->num_stages = bpmem.genMode.numtevstages;
+}
+
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid)
 {
@@ -133,7 +140,7 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                             GetInterpolationQualifier(msaa, ssaa, true, true), ShaderStage::Pixel);
 
     out.Write("}};\n\n");
-    if (stereo && !host_config.backend_gl_layer_in_fs)
+    if (stereo && !host_config.backend_gl_layer_in_fs && !host_config.backend_multiview)
       out.Write("flat in int layer;");
   }
   else
@@ -573,8 +580,15 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   out.Write("void main()\n{{\n");
   out.Write("  float4 rawpos = gl_FragCoord;\n");
 
-  out.Write("  uint num_stages = {};\n\n",
-            BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  if (uid_data->specialized_stages)
+  {
+    out.Write("  uint num_stages = {}u;\n\n", uid_data->num_stages);
+  }
+  else
+  {
+    out.Write("  uint num_stages = {};\n\n",
+              BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  }
 
   if (use_framebuffer_fetch)
   {
@@ -598,7 +612,9 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 
   if (host_config.backend_geometry_shaders && stereo)
   {
-    if (host_config.backend_gl_layer_in_fs)
+    if (host_config.backend_multiview)
+      out.Write("\tint layer = int(gl_ViewIndex);\n");
+    else if (host_config.backend_gl_layer_in_fs)
       out.Write("\tint layer = gl_Layer;\n");
   }
   else
@@ -20,6 +20,11 @@ struct pixel_ubershader_uid_data
   u32 uint_output : 1;
   u32 no_dual_src : 1;
 
+  // Partially specialized variants have a fixed TEV stage count, so the stage loop has a
+  // constant trip count which the driver can unroll.
+  u32 specialized_stages : 1;
+  u32 num_stages : 4;
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
@@ -28,6 +33,9 @@ using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
 PixelShaderUid GetPixelShaderUid();
 
+// Turns a generic pixel ubershader uid into one specialized for the current TEV stage count.
+void SpecializePixelShaderUid(PixelShaderUid* uid);
+
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data);
 
@@ -44,8 +52,9 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
     return fmt::format_to(
-        ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
+        ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}{}", uid.num_texgens,
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
-        uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
+        uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "",
+        uid.specialized_stages ? fmt::format(", {} TEV stages", uid.num_stages + 1) : "");
   }
 };
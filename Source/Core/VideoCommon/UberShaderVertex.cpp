@@ -37,6 +37,7 @@ ShaderCode GenVertexShader(APIType api_type, const ShaderHostConfig& host_config
   const bool ssaa = host_config.ssaa;
   const bool per_pixel_lighting = host_config.per_pixel_lighting;
   const bool vertex_rounding = host_config.vertex_rounding;
+  const bool multiview_stereo = host_config.stereo && host_config.backend_multiview;
   const bool vertex_loader =
       host_config.backend_dynamic_vertex_loader || host_config.backend_vs_point_line_expand;
   const u32 num_texgen = uid_data->num_texgens;
@@ -50,7 +51,7 @@ ShaderCode GenVertexShader(APIType api_type, const ShaderHostConfig& host_config
   out.Write("{}", s_shader_uniforms);
   out.Write("}};\n");
 
-  if (vertex_loader)
+  if (vertex_loader || multiview_stereo)
   {
     out.Write("UBO_BINDING(std140, 4) uniform GSBlock {{\n");
     out.Write("{}", s_geometry_shader_uniforms);
@@ -487,6 +488,9 @@ float3 load_input_float3_rawtex(uint vtx_offset, uint attr_offset) {{
               "}}\n");
   }
 
+  if (multiview_stereo)
+    GenerateVSStereoOffset(out);
+
   if (host_config.backend_geometry_shaders)
   {
     AssignVSOutputMembers(out, "vs", "o", num_texgen, host_config);
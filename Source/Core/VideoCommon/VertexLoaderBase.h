@@ -11,6 +11,7 @@
 #include "Common/CommonTypes.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/VertexPulling.h"
 
 class VertexLoaderUID
 {
@@ -57,6 +58,7 @@ class VertexLoaderBase
 public:
   static u32 GetVertexSize(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
   static u32 GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
+  static bool HasOnlyDirectAttributes(const TVtxDesc& vtx_desc);
   static std::unique_ptr<VertexLoaderBase> CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                               const VAT& vtx_attr);
   virtual ~VertexLoaderBase() {}
@@ -66,6 +68,10 @@ public:
   PortableVertexDeclaration m_native_vtx_decl{};
   const u32 m_vertex_size;  // number of bytes of a raw GC vertex
   const u32 m_native_components;
+  // If no attribute is indexed, the converted vertices only depend on the raw vertex data
+  const bool m_only_direct_attributes;
+  // How the vertex shader reads these vertices when GPU vertex pulling is used
+  const VertexPulling::Layout m_pulling_layout;
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
@@ -74,7 +80,9 @@ public:
 protected:
   VertexLoaderBase(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
       : m_vertex_size{GetVertexSize(vtx_desc, vtx_attr)},
-        m_native_components{GetVertexComponents(vtx_desc, vtx_attr)}, m_VtxAttr{vtx_attr},
+        m_native_components{GetVertexComponents(vtx_desc, vtx_attr)},
+        m_only_direct_attributes{HasOnlyDirectAttributes(vtx_desc)},
+        m_pulling_layout{VertexPulling::GetLayout(vtx_desc, vtx_attr)}, m_VtxAttr{vtx_attr},
         m_VtxDesc{vtx_desc}
   {
   }
@@ -4,9 +4,11 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -15,6 +17,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 
 #include "Core/DolphinAnalytics.h"
@@ -30,6 +33,7 @@
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexManagerBase.h"
+#include "VideoCommon/VertexPulling.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
@@ -62,6 +66,51 @@ std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_main_vertex_loaders;
 std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_preprocess_vertex_loaders;
 bool g_needs_cp_xf_consistency_check;
 
+namespace
+{
+// Converted vertices of a primitive. Most display lists are static model geometry which is drawn
+// again every frame, and many games also resubmit identical vertex data through the FIFO, so
+// reusing the converted data saves running the vertex loader. Entries are verified against a hash
+// of the raw vertex data on every use.
+struct CachedVertices
+{
+  const VertexLoaderBase* loader = nullptr;
+  int count = 0;
+  u64 hash = 0;
+
+  // Only filled in the second time the same data is seen, so that one-off geometry doesn't pay
+  // for the copy.
+  std::vector<u8> data;
+  int num_loaded = 0;
+
+  // The zfreeze and normal caches as written by the vertex loader
+  std::array<u32, 3> position_matrix_index_cache;
+  std::array<std::array<float, 4>, 3> position_cache;
+  std::array<float, 4> normal_cache;
+  std::array<float, 4> tangent_cache;
+  std::array<float, 4> binormal_cache;
+};
+
+// Primitives smaller than this are cheaper to convert again than to look up.
+constexpr int MIN_CACHED_VERTICES = 16;
+constexpr size_t MAX_CACHED_VERTEX_BYTES = 64 * 1024 * 1024;
+// Bounds the number of entries which only hold a hash, since most data seen through the FIFO
+// is never seen again.
+constexpr size_t MAX_VERTEX_DATA_CACHE_ENTRIES = 16384;
+}  // namespace
+
+// Display lists are cached by address, and other vertex data by its hash
+static std::unordered_map<const u8*, CachedVertices> s_display_list_vertex_cache;
+static std::unordered_map<u64, CachedVertices> s_vertex_data_cache;
+static size_t s_cached_vertex_bytes = 0;
+
+static void ClearVertexCaches()
+{
+  s_display_list_vertex_cache.clear();
+  s_vertex_data_cache.clear();
+  s_cached_vertex_bytes = 0;
+}
+
 void Init()
 {
   MarkAllDirty();
@@ -75,6 +124,7 @@ void Clear()
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
+  ClearVertexCaches();
 }
 
 void UpdateVertexArrayPointers()
@@ -389,8 +439,122 @@ static bool CanSplit(OpcodeDecoder::Primitive primitive)
   }
 }
 
+// Restores the parts of the zfreeze and normal caches which the vertex loader would have written.
+static void RestoreLoaderCaches(const VertexLoaderBase* loader, const CachedVertices& entry)
+{
+  const int last_vertices = std::min(entry.count, 3);
+  for (int i = 0; i < last_vertices; ++i)
+  {
+    position_cache[i] = entry.position_cache[i];
+    if (loader->m_native_components & VB_HAS_POSMTXIDX)
+      position_matrix_index_cache[i] = entry.position_matrix_index_cache[i];
+  }
+  if (loader->m_native_components & VB_HAS_NORMAL)
+    normal_cache = entry.normal_cache;
+  if (loader->m_native_components & VB_HAS_TANGENT)
+    tangent_cache = entry.tangent_cache;
+  if (loader->m_native_components & VB_HAS_BINORMAL)
+    binormal_cache = entry.binormal_cache;
+}
+
+static int RunCachedVertices(VertexLoaderBase* loader, const u8* src, u8* dst, int count,
+                             bool in_display_list)
+{
+  const u32 stride = loader->m_native_vtx_decl.stride;
+  const u64 hash = Common::GetHash64(src, count * loader->m_vertex_size, 0);
+
+  if (!in_display_list && s_vertex_data_cache.size() >= MAX_VERTEX_DATA_CACHE_ENTRIES &&
+      !s_vertex_data_cache.contains(hash))
+  {
+    for (const auto& [key, entry] : s_vertex_data_cache)
+      s_cached_vertex_bytes -= entry.data.size();
+    s_vertex_data_cache.clear();
+  }
+
+  CachedVertices& entry =
+      in_display_list ? s_display_list_vertex_cache[src] : s_vertex_data_cache[hash];
+  if (entry.loader != loader || entry.count != count || entry.hash != hash)
+  {
+    s_cached_vertex_bytes -= entry.data.size();
+    entry = CachedVertices{.loader = loader, .count = count, .hash = hash};
+    return loader->RunVertices(src, dst, count);
+  }
+
+  if (!entry.data.empty())
+  {
+    std::memcpy(dst, entry.data.data(), entry.num_loaded * stride);
+    RestoreLoaderCaches(loader, entry);
+    loader->m_numLoadedVertices += count;
+    return entry.num_loaded;
+  }
+
+  if (s_cached_vertex_bytes > MAX_CACHED_VERTEX_BYTES)
+  {
+    ClearVertexCaches();
+    return loader->RunVertices(src, dst, count);
+  }
+
+  // Convert into the cache instead of reading back from dst, which may be uncached GPU memory.
+  // As in VertexLoaderTester, the loaders may write a few bytes past the last vertex.
+  entry.data.resize(count * stride + 4);
+  entry.num_loaded = loader->RunVertices(src, entry.data.data(), count);
+  std::memcpy(dst, entry.data.data(), entry.num_loaded * stride);
+  s_cached_vertex_bytes += entry.data.size();
+
+  entry.position_matrix_index_cache = position_matrix_index_cache;
+  entry.position_cache = position_cache;
+  entry.normal_cache = normal_cache;
+  entry.tangent_cache = tangent_cache;
+  entry.binormal_cache = binormal_cache;
+
+  return entry.num_loaded;
+}
+
+// Copies the raw vertices for the vertex shader to decode. Returns false if the draw has to go
+// through the vertex loader instead.
+static bool RunPulledVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                              int count, const u8* src)
+{
+  const VertexPulling::Layout& layout = loader->m_pulling_layout;
+  VertexPulling::ArrayRanges ranges;
+  if (!VertexPulling::GetArrayRanges(layout, src, count, g_main_cp_state.array_strides, &ranges))
+    return false;
+
+  const int max_vertices = 16380;
+  do
+  {
+    const int run = CanSplit(primitive) && count > max_vertices ? max_vertices : count;
+    // Later runs have fewer vertices and the same array ranges, so only the first one can fail.
+    u8* const dst = g_vertex_manager->PrepareForPulledVertices(loader, primitive, run, ranges);
+    if (!dst)
+      return false;
+    count -= run;
+
+    std::memcpy(dst, src, run * layout.stride);
+
+    // The zfreeze slope and the normal constants come from the caches which the vertex loader
+    // fills with the last vertices, so those still have to be converted.
+    // As in VertexLoaderTester, the loaders may write a few bytes past the last vertex.
+    static std::vector<u8> s_last_vertices;
+    const int last_vertices = std::min(run, 3);
+    s_last_vertices.resize(last_vertices * loader->m_native_vtx_decl.stride + 4);
+    loader->RunVertices(src + (run - last_vertices) * layout.stride, s_last_vertices.data(),
+                        last_vertices);
+    loader->m_numLoadedVertices += run - last_vertices;
+    src += run * layout.stride;
+
+    g_vertex_manager->AddIndices(primitive, run);
+    g_vertex_manager->FlushData(run, layout.stride);
+
+    ADDSTAT(g_stats.this_frame.num_prims, run);
+  } while (count);
+
+  return true;
+}
+
 template <bool IsPreprocess>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                bool in_display_list)
 {
   if (count == 0) [[unlikely]]
     return 0;
@@ -437,19 +601,53 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     const bool cullall = (bpmem.genMode.cull_mode == CullMode::All &&
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
+    // Dropping the culled triangles of draws which are only partly visible doesn't save any draw
+    // calls, but does save the GPU from setting up those triangles.
+    const bool cull_triangles = g_ActiveConfig.bCPUCull && g_ActiveConfig.bCPUCullPartial &&
+                                primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES && !cullall;
+
+    if (g_ActiveConfig.UseGPUVertexPulling() && loader->m_pulling_layout.supported &&
+        !g_ActiveConfig.bCPUCull && !cullall &&
+        primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES &&
+        RunPulledVertices(loader, primitive, count, src))
+    {
+      INCSTAT(g_stats.this_frame.num_primitive_joins);
+      return size;
+    }
+    if (g_vertex_manager->IsPullingVertices())
+      g_vertex_manager->Flush();
+
     const int stride = loader->m_native_vtx_decl.stride;
+    const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
+    const bool use_cache = (in_display_list || g_ActiveConfig.bCacheVertexData) &&
+                           loader->m_only_direct_attributes && count >= MIN_CACHED_VERTICES &&
+                           count <= max_vertices;
     do
     {
-      const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
       const int run = CanSplit(primitive) && count > max_vertices ? max_vertices : count;
       count -= run;
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      const int num_loaded =
+          use_cache ? RunCachedVertices(loader, src, dst.GetPointer(), run, in_display_list) :
+                      loader->RunVertices(src, dst.GetPointer(), run);
       src += loader->m_vertex_size * max_vertices;
 
-      if (can_cpu_cull && !cullall)
+      bool added_indices = false;
+      if (cull_triangles)
+      {
+        const std::span<const u16> triangles =
+            g_vertex_manager->GetVisibleTriangles(loader, primitive, dst.GetPointer(), num_loaded);
+        if (can_cpu_cull && !triangles.empty())
+        {
+          DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
+          memmove(new_dst.GetPointer(), dst.GetPointer(), num_loaded * stride);
+          can_cpu_cull = false;
+        }
+        added_indices = g_vertex_manager->AddTriangles(primitive, triangles, num_loaded);
+      }
+      else if (can_cpu_cull && !cullall)
       {
         const bool all_culled =
             g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), num_loaded);
@@ -461,7 +659,8 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
         }
       }
 
-      g_vertex_manager->AddIndices(primitive, num_loaded);
+      if (!added_indices)
+        g_vertex_manager->AddIndices(primitive, num_loaded);
       g_vertex_manager->FlushData(num_loaded, stride);
 
       ADDSTAT(g_stats.this_frame.num_prims, num_loaded);
@@ -473,9 +672,9 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 }
 
 template int RunVertices<false>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                                const u8* src);
+                                const u8* src, bool in_display_list);
 template int RunVertices<true>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                               const u8* src);
+                               const u8* src, bool in_display_list);
 
 NativeVertexFormat* GetCurrentVertexFormat()
 {
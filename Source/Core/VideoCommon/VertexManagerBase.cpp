@@ -3,8 +3,10 @@
 
 #include "VideoCommon/VertexManagerBase.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <memory>
 
 #include "Common/ChunkFile.h"
@@ -14,6 +16,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/SmallVector.h"
+#include "Common/Trace.h"
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/SystemTimers.h"
@@ -24,6 +27,7 @@
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimings.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/CustomShaderCache.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
@@ -37,6 +41,7 @@
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureInfo.h"
+#include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -146,6 +151,19 @@ bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
   return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
 }
 
+std::span<const u16> VertexManagerBase::GetVisibleTriangles(VertexLoaderBase* loader,
+                                                            OpcodeDecoder::Primitive primitive,
+                                                            const u8* src, u32 count)
+{
+  return m_cpu_cull.GetVisibleTriangles(loader, primitive, src, count);
+}
+
+bool VertexManagerBase::AddTriangles(OpcodeDecoder::Primitive primitive,
+                                     std::span<const u16> triangles, u32 num_vertices)
+{
+  return m_index_generator.AddTriangles(primitive, triangles, num_vertices);
+}
+
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
                                                        u32 count, u32 stride, bool cullall)
 {
@@ -198,6 +216,10 @@ DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive
     remaining_index_generator_indices = m_index_generator.GetRemainingIndices(primitive);
     remaining_indices = GetRemainingIndices(primitive);
     m_is_flushed = false;
+
+    m_pulled_loader = nullptr;
+    for (PulledArray& array : m_pulled_arrays)
+      array.data.clear();
   }
 
   // Now that we've reset the buffer, there should be enough space. It's possible that we still
@@ -220,6 +242,111 @@ DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive
   return DataReader(m_cur_buffer_pointer, m_end_buffer_pointer);
 }
 
+bool VertexManagerBase::CanMergePulledVertices(const VertexLoaderBase* loader, u32 count,
+                                               const VertexPulling::ArrayRanges& ranges) const
+{
+  if (m_is_flushed || m_pulled_loader != loader)
+    return false;
+
+  const VertexPulling::Layout& layout = loader->m_pulling_layout;
+  u32 array_bytes = 0;
+  for (const u32 i : BitSet32(layout.indexed_arrays))
+  {
+    const PulledArray& array = m_pulled_arrays[i];
+    const CPArray cp_array = static_cast<CPArray>(i);
+    const u8* const base = VertexLoaderManager::cached_arraybases[cp_array];
+    if (array.base != base || array.stride != g_main_cp_state.array_strides[cp_array])
+      return false;
+
+    // The part of the array which both batches read must not have changed in between.
+    const u32 end = array.begin + static_cast<u32>(array.data.size());
+    const u32 overlap_begin = std::max(array.begin, ranges.begin[i]);
+    const u32 overlap_end = std::min(end, ranges.end[i]);
+    if (overlap_begin < overlap_end &&
+        std::memcmp(array.data.data() + (overlap_begin - array.begin), base + overlap_begin,
+                    overlap_end - overlap_begin) != 0)
+    {
+      return false;
+    }
+
+    array_bytes += std::max(end, ranges.end[i]) - std::min(array.begin, ranges.begin[i]);
+  }
+
+  return count * layout.stride + array_bytes + 4 <= GetRemainingSize();
+}
+
+u8* VertexManagerBase::PrepareForPulledVertices(const VertexLoaderBase* loader,
+                                                OpcodeDecoder::Primitive primitive, u32 count,
+                                                const VertexPulling::ArrayRanges& ranges)
+{
+  const VertexPulling::Layout& layout = loader->m_pulling_layout;
+  u32 array_bytes = 0;
+  for (const u32 i : BitSet32(layout.indexed_arrays))
+  {
+    if (!VertexLoaderManager::cached_arraybases[static_cast<CPArray>(i)])
+      return nullptr;
+    array_bytes += ranges.end[i] - ranges.begin[i];
+  }
+  if (count * layout.stride + array_bytes + 4 > MAXVBUFFERSIZE)
+    return nullptr;
+
+  if (!CanMergePulledVertices(loader, count, ranges))
+    Flush();
+
+  PrepareForAdditionalData(primitive, count, layout.stride, false);
+  m_pulled_loader = loader;
+
+  for (const u32 i : BitSet32(layout.indexed_arrays))
+  {
+    PulledArray& array = m_pulled_arrays[i];
+    const CPArray cp_array = static_cast<CPArray>(i);
+    const u8* const base = VertexLoaderManager::cached_arraybases[cp_array];
+    if (array.data.empty())
+    {
+      array.base = base;
+      array.stride = g_main_cp_state.array_strides[cp_array];
+      array.begin = ranges.begin[i];
+      array.data.assign(base + ranges.begin[i], base + ranges.end[i]);
+      continue;
+    }
+
+    const u32 end = array.begin + static_cast<u32>(array.data.size());
+    if (ranges.begin[i] < array.begin)
+    {
+      array.data.insert(array.data.begin(), base + ranges.begin[i], base + array.begin);
+      array.begin = ranges.begin[i];
+    }
+    if (ranges.end[i] > end)
+      array.data.insert(array.data.end(), base + end, base + ranges.end[i]);
+  }
+
+  return m_cur_buffer_pointer;
+}
+
+void VertexManagerBase::UploadPulledArrays(VertexShaderManager& vertex_shader_manager)
+{
+  auto& constants = vertex_shader_manager.constants;
+  const VertexPulling::Layout& layout = m_pulled_loader->m_pulling_layout;
+  u8* const arrays_start = m_cur_buffer_pointer;
+  for (const u32 i : BitSet32(layout.indexed_arrays))
+  {
+    // The shader adds index * stride to the base, so it may wrap around for high indices.
+    const PulledArray& array = m_pulled_arrays[i];
+    const u32 offset = static_cast<u32>(m_cur_buffer_pointer - m_base_buffer_pointer);
+    constants.pulled_array_base[i / 4][i % 4] = offset - array.begin;
+    constants.pulled_array_stride[i / 4][i % 4] = array.stride;
+    std::memcpy(m_cur_buffer_pointer, array.data.data(), array.data.size());
+    m_cur_buffer_pointer += array.data.size();
+  }
+
+  constants.pulled_frac_scale[0][0] = layout.position_scale;
+  for (u32 i = 0; i < layout.texcoord_scales.size(); i++)
+    constants.pulled_frac_scale[(i + 1) / 4][(i + 1) % 4] = layout.texcoord_scales[i];
+
+  m_pulled_array_bytes = static_cast<u32>(m_cur_buffer_pointer - arrays_start);
+  vertex_shader_manager.dirty = true;
+}
+
 DataReader VertexManagerBase::DisableCullAll(u32 stride)
 {
   if (m_cull_all)
@@ -439,6 +566,8 @@ void VertexManagerBase::Flush()
 
   m_is_flushed = true;
 
+  TRACE_SCOPE("VertexManagerBase::Flush");
+
   if (m_draw_counter == 0)
   {
     // This is more or less the start of the Frame
@@ -642,8 +771,19 @@ void VertexManagerBase::Flush()
     // Same with GPU texture decoding, which uses compute shaders.
     g_texture_cache->BindTextures(used_textures, samplers);
 
+    if (m_skipping_frame)
+    {
+      // Like EFB reads, bounding box results depend on the previous draws of the frame.
+      if (m_efb_read_this_frame.load(std::memory_order_relaxed) || g_bounding_box->IsEnabled())
+        m_skipping_frame = false;
+      else
+        skip = true;
+    }
+
     if (!skip)
     {
+      if (m_pulled_loader)
+        UploadPulledArrays(vertex_shader_manager);
       UpdatePipelineConfig();
       UpdatePipelineObject();
       if (m_current_pipeline_object)
@@ -709,7 +849,8 @@ void VertexManagerBase::CalculateZSlope(NativeVertexFormat* format)
   const PortableVertexDeclaration vert_decl = format->GetVertexDeclaration();
 
   // Make sure the buffer contains at least 3 vertices.
-  if ((m_cur_buffer_pointer - m_base_buffer_pointer) < (vert_decl.stride * 3))
+  const u32 stride = m_pulled_loader ? m_pulled_loader->m_pulling_layout.stride : vert_decl.stride;
+  if ((m_cur_buffer_pointer - m_base_buffer_pointer) < (stride * 3))
     return;
 
   // Lookup vertices of the last rendered triangle and software-transform them
@@ -807,6 +948,12 @@ void VertexManagerBase::UpdatePipelineConfig()
   }
 
   VertexShaderUid vs_uid = GetVertexShaderUid();
+  if (m_pulled_loader)
+  {
+    vertex_shader_uid_data* const uid_data = vs_uid.GetUidData();
+    uid_data->vertex_pulling = 1;
+    uid_data->pulled_attributes = m_pulled_loader->m_pulling_layout.attributes;
+  }
   if (vs_uid != m_current_pipeline_config.vs_uid)
   {
     m_current_pipeline_config.vs_uid = vs_uid;
@@ -893,8 +1040,7 @@ void VertexManagerBase::UpdatePipelineObject()
   case ShaderCompilationMode::SynchronousUberShaders:
   {
     // Exclusive ubershader mode, always use ubershaders.
-    m_current_pipeline_object =
-        g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+    m_current_pipeline_object = GetUberPipelineObject();
   }
   break;
 
@@ -913,8 +1059,7 @@ void VertexManagerBase::UpdatePipelineObject()
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
       // Specialized shaders not ready, use the ubershaders.
-      m_current_pipeline_object =
-          g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+      m_current_pipeline_object = GetUberPipelineObject();
     }
     else
     {
@@ -927,6 +1072,23 @@ void VertexManagerBase::UpdatePipelineObject()
   }
 }
 
+const AbstractPipeline* VertexManagerBase::GetUberPipelineObject()
+{
+  // Once the ubershader specialized for the current TEV stage count has been compiled in the
+  // background, prefer it over the generic one. Like specialized pipelines, it is picked up on the
+  // next pipeline change. Without compiler threads this would compile on the GPU thread, so only
+  // the generic ubershaders are used then.
+  if (g_ActiveConfig.GetShaderCompilerThreads() > 0)
+  {
+    VideoCommon::GXUberPipelineUid uid = m_current_uber_pipeline_config;
+    UberShader::SpecializePixelShaderUid(&uid.ps_uid);
+    if (const auto res = g_shader_cache->GetUberPipelineForUidAsync(uid); res && *res)
+      return *res;
+  }
+
+  return g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+}
+
 void VertexManagerBase::OnConfigChange()
 {
   // Reload index generator function tables in case VS expand config changed
@@ -996,6 +1158,21 @@ void VertexManagerBase::OnEFBCopyToRAM()
 
 void VertexManagerBase::OnEndFrame()
 {
+  // While fast-forwarding, the frames between the rendered ones only need to be rendered if the
+  // game reads back from the EFB. As that's only known once it happens, a frame is only skipped if
+  // nothing was read during the previous one.
+  const bool efb_read = m_efb_read_this_frame.exchange(false, std::memory_order_relaxed);
+  if (!efb_read && m_frames_skipped < g_ActiveConfig.iFastForwardFrameSkip)
+  {
+    m_skipping_frame = true;
+    m_frames_skipped++;
+  }
+  else
+  {
+    m_skipping_frame = false;
+    m_frames_skipped = 0;
+  }
+
   m_draw_counter = 0;
   m_last_efb_copy_draw_counter = 0;
   m_scheduled_command_buffer_kicks.clear();
@@ -1073,10 +1250,18 @@ void VertexManagerBase::RenderDrawCall(
 
   g_gfx->SetPipeline(current_pipeline);
 
+  u32 num_vertices = m_index_generator.GetNumVerts();
+  u32 vertex_stride = VertexLoaderManager::GetCurrentVertexFormat()->GetVertexStride();
+  if (m_pulled_loader)
+  {
+    // The raw vertices are followed by the vertex arrays they index.
+    vertex_stride = m_pulled_loader->m_pulling_layout.stride;
+    num_vertices += (m_pulled_array_bytes + vertex_stride - 1) / vertex_stride;
+  }
+
   u32 base_vertex, base_index;
-  CommitBuffer(m_index_generator.GetNumVerts(),
-               VertexLoaderManager::GetCurrentVertexFormat()->GetVertexStride(),
-               m_index_generator.GetIndexLen(), &base_vertex, &base_index);
+  CommitBuffer(num_vertices, vertex_stride, m_index_generator.GetIndexLen(), &base_vertex,
+               &base_index);
 
   if (g_backend_info.api_type != APIType::D3D && g_ActiveConfig.UseVSForLinePointExpand() &&
       (primitive_type == PrimitiveType::Points || primitive_type == PrimitiveType::Lines))
@@ -1090,10 +1275,13 @@ void VertexManagerBase::RenderDrawCall(
   if (PerfQueryBase::ShouldEmulate())
     g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
 
+  g_gpu_timings->OnDraw(current_pipeline);
   DrawCurrentBatch(base_index, m_index_generator.GetIndexLen(), base_vertex);
 
   // Track the total emulated state draws
   INCSTAT(g_stats.this_frame.num_draw_calls);
+  if (PixelShaderDisablesEarlyDepth(m_current_pipeline_config.ps_uid))
+    INCSTAT(g_stats.this_frame.num_draw_calls_late_depth);
 
   if (PerfQueryBase::ShouldEmulate())
     g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
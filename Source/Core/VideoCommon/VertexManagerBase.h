@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -13,6 +16,7 @@
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/VertexPulling.h"
 #include "VideoCommon/VideoEvents.h"
 
 struct CustomPixelShaderContents;
@@ -23,6 +27,8 @@ class NativeVertexFormat;
 class PixelShaderManager;
 class PointerWrap;
 struct PortableVertexDeclaration;
+class VertexLoaderBase;
+class VertexShaderManager;
 
 struct Slope
 {
@@ -110,6 +116,11 @@ public:
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
+  std::span<const u16> GetVisibleTriangles(VertexLoaderBase* loader,
+                                           OpcodeDecoder::Primitive primitive, const u8* src,
+                                           u32 count);
+  bool AddTriangles(OpcodeDecoder::Primitive primitive, std::span<const u16> triangles,
+                    u32 num_vertices);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
                                               u32 stride, bool cullall);
   /// Switch cullall off after a call to PrepareForAdditionalData with cullall true
@@ -121,6 +132,13 @@ public:
   void Flush();
   bool HasSendableVertices() const { return !m_is_flushed && !m_cull_all; }
 
+  // GPU vertex pulling, see VertexPulling.h.
+  bool IsPullingVertices() const { return !m_is_flushed && m_pulled_loader; }
+  /// Takes a snapshot of the parts of the vertex arrays which count raw vertices index, and
+  /// returns where to copy those vertices to. Returns nullptr if they don't fit into one batch.
+  u8* PrepareForPulledVertices(const VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                               u32 count, const VertexPulling::ArrayRanges& ranges);
+
   void DoState(PointerWrap& p);
 
   FlushStatistics ResetFlushAspectRatioCount();
@@ -171,6 +189,13 @@ public:
   // Call at the end of a frame.
   void OnEndFrame();
 
+  // Call when the emulated system reads back anything rendered by the GPU, so that no frames are
+  // skipped while it's doing so. Can be called from any thread.
+  void OnEFBRead() { m_efb_read_this_frame.store(true, std::memory_order_relaxed); }
+
+  // True if the draws and XFB copies of the current frame are skipped for fast-forwarding.
+  bool IsSkippingFrame() const { return m_skipping_frame; }
+
 protected:
   // When utility uniforms are used, the GX uniforms need to be re-written afterwards.
   static void InvalidateConstants();
@@ -230,6 +255,10 @@ private:
                       const AbstractPipeline* current_pipeline);
   void UpdatePipelineConfig();
   void UpdatePipelineObject();
+  bool CanMergePulledVertices(const VertexLoaderBase* loader, u32 count,
+                              const VertexPulling::ArrayRanges& ranges) const;
+  void UploadPulledArrays(VertexShaderManager& vertex_shader_manager);
+  const AbstractPipeline* GetUberPipelineObject();
 
   const AbstractPipeline*
   GetCustomPipeline(const CustomPixelShaderContents& custom_pixel_shader_contents,
@@ -240,6 +269,19 @@ private:
   bool m_is_flushed = true;
   FlushStatistics m_flush_statistics = {};
 
+  // The vertex arrays of a batch of pulled vertices are copied when the vertices are added, as
+  // the game may change them before the batch is flushed, and uploaded after the vertices.
+  struct PulledArray
+  {
+    const u8* base = nullptr;
+    u32 stride = 0;
+    u32 begin = 0;
+    std::vector<u8> data;
+  };
+  const VertexLoaderBase* m_pulled_loader = nullptr;
+  std::array<PulledArray, VertexPulling::NUM_ATTRIBUTES> m_pulled_arrays;
+  u32 m_pulled_array_bytes = 0;
+
   // CPU access tracking
   u32 m_draw_counter = 0;
   u32 m_last_efb_copy_draw_counter = 0;
@@ -248,6 +290,11 @@ private:
   std::vector<u32> m_scheduled_command_buffer_kicks;
   bool m_allow_background_execution = true;
 
+  // Fast-forward frame skipping
+  std::atomic<bool> m_efb_read_this_frame = false;
+  bool m_skipping_frame = false;
+  int m_frames_skipped = 0;
+
   std::unique_ptr<CustomShaderCache> m_custom_shader_cache;
   u64 m_ticks_elapsed = 0;
 
@@ -0,0 +1,191 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/VertexPulling.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "Common/Swap.h"
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/VertexLoaderBase.h"
+
+namespace VertexPulling
+{
+namespace
+{
+constexpr AttributeFormat MakeAttributeFormat(VertexComponentFormat mode, u32 format, u32 elements)
+{
+  return {static_cast<u8>(mode), static_cast<u8>(format), static_cast<u8>(elements), 0};
+}
+
+u32 GetColorSize(ColorFormat format)
+{
+  switch (format)
+  {
+  case ColorFormat::RGB565:
+  case ColorFormat::RGBA4444:
+    return 2;
+  case ColorFormat::RGB888:
+  case ColorFormat::RGBA6666:
+    return 3;
+  default:
+    return 4;
+  }
+}
+
+u32 GetAttributeSize(CPArray array, AttributeFormat attribute)
+{
+  const auto format = static_cast<ComponentFormat>(attribute.format);
+  switch (array)
+  {
+  case CPArray::Position:
+    return (attribute.elements ? 3 : 2) * GetComponentSize(format);
+  case CPArray::Normal:
+    return (attribute.elements ? 9 : 3) * GetComponentSize(format);
+  case CPArray::Color0:
+  case CPArray::Color1:
+    return GetColorSize(static_cast<ColorFormat>(attribute.format));
+  default:
+    return (attribute.elements ? 2 : 1) * GetComponentSize(format);
+  }
+}
+}  // namespace
+
+u32 GetComponentSize(ComponentFormat format)
+{
+  switch (format)
+  {
+  case ComponentFormat::UByte:
+  case ComponentFormat::Byte:
+    return 1;
+  case ComponentFormat::UShort:
+  case ComponentFormat::Short:
+    return 2;
+  default:
+    return 4;
+  }
+}
+
+Layout GetLayout(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
+{
+  AttributeFormats attributes{};
+  attributes[u32(CPArray::Position)] =
+      MakeAttributeFormat(vtx_desc.low.Position, u32(vtx_attr.g0.PosFormat.Value()),
+                          u32(vtx_attr.g0.PosElements.Value()));
+  attributes[u32(CPArray::Normal)] =
+      MakeAttributeFormat(vtx_desc.low.Normal, u32(vtx_attr.g0.NormalFormat.Value()),
+                          u32(vtx_attr.g0.NormalElements.Value()));
+  for (u32 i = 0; i < 2; i++)
+  {
+    attributes[u32(CPArray::Color0) + i] =
+        MakeAttributeFormat(vtx_desc.low.Color[i], u32(vtx_attr.GetColorFormat(i)), 0);
+  }
+  for (u32 i = 0; i < 8; i++)
+  {
+    attributes[u32(CPArray::TexCoord0) + i] =
+        MakeAttributeFormat(vtx_desc.high.TexCoord[i], u32(vtx_attr.GetTexFormat(i)),
+                            u32(vtx_attr.GetTexElements(i)));
+  }
+
+  Layout layout =
+      GetLayout(attributes, VertexLoaderBase::GetVertexComponents(vtx_desc, vtx_attr));
+
+  // The vertex shader always reads a position.
+  if (vtx_desc.low.Position == VertexComponentFormat::NotPresent)
+    layout.supported = false;
+  // With NormalIndex3, each of the normal, tangent and binormal has its own index.
+  if (IsIndexed(vtx_desc.low.Normal) && vtx_attr.g0.NormalElements == NormalComponentCount::NTB &&
+      vtx_attr.g0.NormalIndex3)
+  {
+    layout.supported = false;
+  }
+  for (u32 i = 0; i < 2; i++)
+  {
+    if (vtx_desc.low.Color[i] != VertexComponentFormat::NotPresent &&
+        vtx_attr.GetColorFormat(i) > ColorFormat::RGBA8888)
+    {
+      layout.supported = false;
+    }
+  }
+
+  layout.position_scale = 1.0f / (1U << vtx_attr.g0.PosFrac);
+  for (u32 i = 0; i < 8; i++)
+    layout.texcoord_scales[i] = 1.0f / (1U << vtx_attr.GetTexFrac(i));
+
+  return layout;
+}
+
+Layout GetLayout(const AttributeFormats& attributes, u32 components)
+{
+  Layout layout;
+  layout.supported = true;
+  layout.attributes = attributes;
+
+  // The matrix indices come first, one byte each.
+  u32 offset = 0;
+  if (components & VB_HAS_POSMTXIDX)
+    offset++;
+  for (u32 i = 0; i < 8; i++)
+  {
+    if (components & (VB_HAS_TEXMTXIDX0 << i))
+      offset++;
+  }
+
+  for (u32 i = 0; i < NUM_ATTRIBUTES; i++)
+  {
+    const auto mode = static_cast<VertexComponentFormat>(attributes[i].mode);
+    if (mode == VertexComponentFormat::NotPresent)
+      continue;
+
+    layout.offsets[i] = offset;
+    layout.sizes[i] = GetAttributeSize(static_cast<CPArray>(i), attributes[i]);
+    if (mode == VertexComponentFormat::Direct)
+    {
+      offset += layout.sizes[i];
+    }
+    else
+    {
+      layout.indexed_arrays |= 1U << i;
+      offset += mode == VertexComponentFormat::Index16 ? 2 : 1;
+    }
+  }
+  layout.stride = offset;
+
+  return layout;
+}
+
+bool GetArrayRanges(const Layout& layout, const u8* src, u32 count,
+                    const Common::EnumMap<u32, CPArray::XF_D>& array_strides, ArrayRanges* ranges)
+{
+  ranges->begin.fill(std::numeric_limits<u32>::max());
+  ranges->end.fill(0);
+
+  for (u32 i = 0; i < NUM_ATTRIBUTES; i++)
+  {
+    if (!(layout.indexed_arrays & (1U << i)))
+      continue;
+
+    const auto mode = static_cast<VertexComponentFormat>(layout.attributes[i].mode);
+    const bool index16 = mode == VertexComponentFormat::Index16;
+    const u32 skip_index = index16 ? 0xFFFF : 0xFF;
+    const u8* index_ptr = src + layout.offsets[i];
+    u32 min_index = std::numeric_limits<u32>::max();
+    u32 max_index = 0;
+    for (u32 vertex = 0; vertex < count; vertex++, index_ptr += layout.stride)
+    {
+      const u32 index = index16 ? Common::swap16(index_ptr) : *index_ptr;
+      if (i == u32(CPArray::Position) && index == skip_index)
+        return false;
+      min_index = std::min(min_index, index);
+      max_index = std::max(max_index, index);
+    }
+
+    const u32 stride = array_strides[static_cast<CPArray>(i)];
+    ranges->begin[i] = min_index * stride;
+    ranges->end[i] = max_index * stride + layout.sizes[i];
+  }
+
+  return true;
+}
+}  // namespace VertexPulling
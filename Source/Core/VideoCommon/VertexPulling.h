@@ -0,0 +1,68 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+#include "VideoCommon/CPMemory.h"
+
+// GPU vertex pulling: instead of converting vertices with a vertex loader, the raw guest vertices
+// and the parts of the vertex arrays they index are uploaded, and the vertex shader reads and
+// converts them itself.
+namespace VertexPulling
+{
+constexpr u32 NUM_ATTRIBUTES = static_cast<u32>(CPArray::TexCoord7) + 1;
+
+#pragma pack(1)
+// How one attribute (indexed by CPArray) is stored, as part of the vertex shader UID.
+struct AttributeFormat
+{
+  u8 mode : 2;      // VertexComponentFormat
+  u8 format : 3;    // ComponentFormat, or ColorFormat for colors
+  u8 elements : 1;  // CoordComponentCount, NormalComponentCount or TexComponentCount
+  u8 pad : 2;
+};
+#pragma pack()
+
+using AttributeFormats = std::array<AttributeFormat, NUM_ATTRIBUTES>;
+
+struct Layout
+{
+  // Formats the vertex shader can't read always go through the vertex loader.
+  bool supported = false;
+  AttributeFormats attributes{};
+  // Offset of each attribute, or of its array index, in a raw vertex
+  std::array<u32, NUM_ATTRIBUTES> offsets{};
+  // Number of bytes an attribute reads, from the vertex or from its array
+  std::array<u32, NUM_ATTRIBUTES> sizes{};
+  // Bitmask of the arrays which the vertices index, by CPArray
+  u32 indexed_arrays = 0;
+  u32 stride = 0;
+
+  // Dequantization factors from the VAT. As they only affect uniforms, these are left at 1 when
+  // the layout is created from a vertex shader UID.
+  float position_scale = 1.0f;
+  std::array<float, 8> texcoord_scales{1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+};
+
+Layout GetLayout(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
+Layout GetLayout(const AttributeFormats& attributes, u32 components);
+
+// Size of one component of a position, normal or texture coordinate
+u32 GetComponentSize(ComponentFormat format);
+
+// The range of bytes which a set of vertices reads from each indexed array, relative to its base
+struct ArrayRanges
+{
+  std::array<u32, NUM_ATTRIBUTES> begin;
+  std::array<u32, NUM_ATTRIBUTES> end;
+};
+
+// Returns false if a vertex is skipped because its position index is 0xFF or 0xFFFF, which only
+// the vertex loaders handle.
+bool GetArrayRanges(const Layout& layout, const u8* src, u32 count,
+                    const Common::EnumMap<u32, CPArray::XF_D>& array_strides, ArrayRanges* ranges);
+}  // namespace VertexPulling
@@ -10,6 +10,7 @@
 #include "VideoCommon/LightingShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexPulling.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
@@ -74,6 +75,32 @@ VertexShaderUid GetVertexShaderUid()
   return out;
 }
 
+void CanonicalizeVertexShaderUid(VertexShaderUid* uid)
+{
+  vertex_shader_uid_data* const uid_data = uid->GetUidData();
+
+  bool has_regular_texgen = false;
+  for (u32 i = 0; i < uid_data->numTexGens; ++i)
+  {
+    auto& texinfo = uid_data->texMtxInfo[i];
+    if (texinfo.texgentype == TexGenType::Regular)
+    {
+      has_regular_texgen = true;
+      continue;
+    }
+
+    // Other tex gen types don't read their input coordinate.
+    const bool is_color = texinfo.texgentype == TexGenType::Color0 ||
+                          texinfo.texgentype == TexGenType::Color1;
+    texinfo.sourcerow = is_color ? SourceRow::Colors : SourceRow::Geom;
+    texinfo.inputform = TexInputForm::AB11;
+  }
+
+  // The post-transform matrices only apply to regular tex gens.
+  if (!has_regular_texgen)
+    uid_data->dualTexTrans_enabled = 0;
+}
+
 static void WritePrimitiveExpand(APIType api_type, const ShaderHostConfig& host_config,
                                  const vertex_shader_uid_data* uid_data, ShaderCode& out)
 {
@@ -96,6 +123,234 @@ static void WritePrimitiveExpand(APIType api_type, const ShaderHostConfig& host_
   out.Write("}}\n\n");
 }
 
+// Declares the vertex inputs as globals, and a function which fills them in by reading the raw
+// guest vertex and the arrays it indexes from the vertex buffer.
+static void WritePulledVertexInputs(APIType api_type, const vertex_shader_uid_data* uid_data,
+                                    ShaderCode& out)
+{
+  const VertexPulling::Layout layout =
+      VertexPulling::GetLayout(uid_data->pulled_attributes, uid_data->components);
+
+  out.Write("SSBO_BINDING(1) readonly restrict buffer Vertices {{\n"
+            "  uint vertex_buffer[];\n"
+            "}};\n\n");
+  if (api_type == APIType::D3D)
+  {
+    // D3D doesn't include the base vertex in SV_VertexID
+    // See comment in UberShaderVertex for details
+    out.Write("UBO_BINDING(std140, 5) uniform DX_Constants {{\n"
+              "  uint base_vertex;\n"
+              "}};\n\n");
+  }
+
+  // Guest data is big-endian, and its fields aren't aligned.
+  out.Write(R"(uint pull_u8(uint addr) {{
+  return (vertex_buffer[addr >> 2] >> ((addr & 3u) * 8u)) & 0xffu;
+}}
+uint pull_u16(uint addr) {{ return (pull_u8(addr) << 8) | pull_u8(addr + 1u); }}
+uint pull_u32(uint addr) {{ return (pull_u16(addr) << 16) | pull_u16(addr + 2u); }}
+
+float pull_ubyte(uint addr) {{ return float(pull_u8(addr)); }}
+float pull_byte(uint addr) {{ return float(int(pull_u8(addr) << 24) >> 24); }}
+float pull_ushort(uint addr) {{ return float(pull_u16(addr)); }}
+float pull_short(uint addr) {{ return float(int(pull_u16(addr) << 16) >> 16); }}
+float pull_float(uint addr) {{ return uintBitsToFloat(pull_u32(addr)); }}
+
+uint expand5(uint x) {{ return (x << 3) | (x >> 2); }}
+uint expand6(uint x) {{ return (x << 2) | (x >> 4); }}
+float4 pull_rgb565(uint addr) {{
+  uint c = pull_u16(addr);
+  return float4(uint4(expand5(c >> 11), expand6((c >> 5) & 0x3fu), expand5(c & 0x1fu), 255u)) /
+         255.0;
+}}
+float4 pull_rgb888(uint addr) {{
+  return float4(uint4(pull_u8(addr), pull_u8(addr + 1u), pull_u8(addr + 2u), 255u)) / 255.0;
+}}
+float4 pull_rgba4444(uint addr) {{
+  uint c = pull_u16(addr);
+  return float4(uint4(c >> 12, (c >> 8) & 0xfu, (c >> 4) & 0xfu, c & 0xfu) * 17u) / 255.0;
+}}
+float4 pull_rgba6666(uint addr) {{
+  uint c = (pull_u8(addr) << 16) | pull_u16(addr + 1u);
+  return float4(uint4(expand6(c >> 18), expand6((c >> 12) & 0x3fu), expand6((c >> 6) & 0x3fu),
+                      expand6(c & 0x3fu))) / 255.0;
+}}
+float4 pull_rgba8888(uint addr) {{
+  return float4(uint4(pull_u8(addr), pull_u8(addr + 1u), pull_u8(addr + 2u), pull_u8(addr + 3u))) /
+         255.0;
+}}
+
+)");
+
+  out.Write("float4 rawpos;\n");
+  if ((uid_data->components & VB_HAS_POSMTXIDX) != 0)
+    out.Write("uint4 posmtx;\n");
+  if ((uid_data->components & VB_HAS_NORMAL) != 0)
+    out.Write("float3 rawnormal;\n");
+  if ((uid_data->components & VB_HAS_TANGENT) != 0)
+    out.Write("float3 rawtangent;\n");
+  if ((uid_data->components & VB_HAS_BINORMAL) != 0)
+    out.Write("float3 rawbinormal;\n");
+  if ((uid_data->components & VB_HAS_COL0) != 0)
+    out.Write("float4 rawcolor0;\n");
+  if ((uid_data->components & VB_HAS_COL1) != 0)
+    out.Write("float4 rawcolor1;\n");
+  for (u32 i = 0; i < 8; ++i)
+  {
+    if ((uid_data->components & ((VB_HAS_UV0 | VB_HAS_TEXMTXIDX0) << i)) != 0)
+      out.Write("float3 rawtex{};\n", i);
+  }
+
+  static constexpr std::array<const char*, 8> component_functions = {
+      "pull_ubyte", "pull_byte", "pull_ushort", "pull_short",
+      "pull_float", "pull_float", "pull_float", "pull_float"};
+  static constexpr std::array<const char*, 6> color_functions = {
+      "pull_rgb565", "pull_rgb888", "pull_rgb888", "pull_rgba4444", "pull_rgba6666",
+      "pull_rgba8888"};
+  static constexpr std::array<char, 4> swizzle = {'x', 'y', 'z', 'w'};
+
+  // Writes the address of the attribute's data to addr, reading its index first if needed.
+  const auto write_address = [&](CPArray array) {
+    const u32 i = static_cast<u32>(array);
+    switch (static_cast<VertexComponentFormat>(layout.attributes[i].mode))
+    {
+    case VertexComponentFormat::Direct:
+      out.Write("\taddr = vertex_addr + {}u;\n", layout.offsets[i]);
+      break;
+    case VertexComponentFormat::Index8:
+    case VertexComponentFormat::Index16:
+      out.Write("\taddr = pulled_array_base[{0}].{1} + pull_u{2}(vertex_addr + {3}u) * "
+                "pulled_array_stride[{0}].{1};\n",
+                i / 4, swizzle[i % 4],
+                layout.attributes[i].mode == u8(VertexComponentFormat::Index16) ? 16 : 8,
+                layout.offsets[i]);
+      break;
+    default:
+      break;
+    }
+  };
+  // Reads count components at addr, starting with the given one.
+  const auto components = [&](CPArray array, u32 first, u32 count) {
+    const auto format = static_cast<ComponentFormat>(layout.attributes[u32(array)].format);
+    const u32 size = VertexPulling::GetComponentSize(format);
+    std::string result;
+    for (u32 i = first; i < first + count; ++i)
+    {
+      result +=
+          fmt::format("{}{}(addr + {}u)", i != first ? ", " : "", component_functions[u32(format)],
+                      i * size);
+    }
+    return result;
+  };
+  const auto is_float = [&](CPArray array) {
+    return static_cast<ComponentFormat>(layout.attributes[u32(array)].format) >=
+           ComponentFormat::Float;
+  };
+
+  out.Write("void dolphin_pull_vertex()\n"
+            "{{\n");
+  if (api_type == APIType::D3D)
+    out.Write("\tuint vertex_addr = (uint(gl_VertexID) + base_vertex) * {}u;\n", layout.stride);
+  else
+    out.Write("\tuint vertex_addr = uint(gl_VertexID) * {}u;\n", layout.stride);
+  out.Write("\tuint addr;\n");
+
+  // Matrix indices come first, and are masked like the vertex loaders do.
+  u32 matrix_offset = 0;
+  if ((uid_data->components & VB_HAS_POSMTXIDX) != 0)
+  {
+    out.Write("\tposmtx = uint4(pull_u8(vertex_addr + {}u) & 0x3fu, 0u, 0u, 0u);\n",
+              matrix_offset++);
+  }
+  std::array<u32, 8> texmtx_offsets{};
+  for (u32 i = 0; i < 8; ++i)
+  {
+    if ((uid_data->components & (VB_HAS_TEXMTXIDX0 << i)) != 0)
+      texmtx_offsets[i] = matrix_offset++;
+  }
+
+  write_address(CPArray::Position);
+  if (layout.attributes[u32(CPArray::Position)].elements)
+    out.Write("\trawpos = float4({}, 1.0);\n", components(CPArray::Position, 0, 3));
+  else
+    out.Write("\trawpos = float4({}, 0.0, 1.0);\n", components(CPArray::Position, 0, 2));
+  if (!is_float(CPArray::Position))
+    out.Write("\trawpos.xyz *= pulled_frac_scale[0].x;\n");
+
+  if ((uid_data->components & VB_HAS_NORMAL) != 0)
+  {
+    // Normals have a fixed number of fractional bits, see VertexLoader_Normal
+    std::string scale = "";
+    switch (static_cast<ComponentFormat>(layout.attributes[u32(CPArray::Normal)].format))
+    {
+    case ComponentFormat::UByte:
+      scale = " * (1.0 / 128.0)";
+      break;
+    case ComponentFormat::Byte:
+      scale = " * (1.0 / 64.0)";
+      break;
+    case ComponentFormat::UShort:
+      scale = " * (1.0 / 32768.0)";
+      break;
+    case ComponentFormat::Short:
+      scale = " * (1.0 / 16384.0)";
+      break;
+    default:
+      break;
+    }
+
+    write_address(CPArray::Normal);
+    out.Write("\trawnormal = float3({}){};\n", components(CPArray::Normal, 0, 3), scale);
+    if ((uid_data->components & VB_HAS_TANGENT) != 0)
+      out.Write("\trawtangent = float3({}){};\n", components(CPArray::Normal, 3, 3), scale);
+    if ((uid_data->components & VB_HAS_BINORMAL) != 0)
+      out.Write("\trawbinormal = float3({}){};\n", components(CPArray::Normal, 6, 3), scale);
+  }
+
+  for (u32 i = 0; i < 2; ++i)
+  {
+    if ((uid_data->components & (VB_HAS_COL0 << i)) == 0)
+      continue;
+
+    write_address(CPArray::Color0 + static_cast<u8>(i));
+    out.Write("\trawcolor{} = {}(addr);\n", i,
+              color_functions[layout.attributes[u32(CPArray::Color0) + i].format]);
+  }
+
+  for (u32 i = 0; i < 8; ++i)
+  {
+    const bool has_texmtx = (uid_data->components & (VB_HAS_TEXMTXIDX0 << i)) != 0;
+    const std::string texmtx =
+        has_texmtx ? fmt::format("float(pull_u8(vertex_addr + {}u) & 0x3fu)", texmtx_offsets[i]) :
+                     "0.0";
+    if ((uid_data->components & (VB_HAS_UV0 << i)) == 0)
+    {
+      if (has_texmtx)
+        out.Write("\trawtex{} = float3(0.0, 0.0, {});\n", i, texmtx);
+      continue;
+    }
+
+    const CPArray array = CPArray::TexCoord0 + static_cast<u8>(i);
+    const u32 scale_index = i + 1;
+    const std::string scale =
+        is_float(array) ?
+            "" :
+            fmt::format(" * pulled_frac_scale[{}].{}", scale_index / 4, swizzle[scale_index % 4]);
+    write_address(array);
+    if (layout.attributes[u32(array)].elements)
+    {
+      out.Write("\trawtex{} = float3(float2({}){}, {});\n", i, components(array, 0, 2), scale,
+                texmtx);
+    }
+    else
+    {
+      out.Write("\trawtex{} = float3({}{}, 0.0, {});\n", i, components(array, 0, 1), scale,
+                texmtx);
+    }
+  }
+  out.Write("}}\n\n");
+}
+
 static void WriteTransformMatrices(APIType api_type, const ShaderHostConfig& host_config,
                                    const vertex_shader_uid_data* uid_data, ShaderCode& out)
 {
@@ -353,6 +608,7 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
   const bool msaa = host_config.msaa;
   const bool ssaa = host_config.ssaa;
   const bool vertex_rounding = host_config.vertex_rounding;
+  const bool multiview_stereo = host_config.stereo && host_config.backend_multiview;
 
   ShaderCode input_extract;
 
@@ -371,13 +627,13 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
     out.Write("}} custom_uniforms;\n");
   }
 
-  if (uid_data->vs_expand != VSExpand::None)
+  if (uid_data->vs_expand != VSExpand::None || multiview_stereo)
   {
     out.Write("UBO_BINDING(std140, 4) uniform GSBlock {{\n");
     out.Write("{}", s_geometry_shader_uniforms);
     out.Write("}};\n");
 
-    if (api_type == APIType::D3D)
+    if (uid_data->vs_expand != VSExpand::None && api_type == APIType::D3D)
     {
       // D3D doesn't include the base vertex in SV_VertexID
       out.Write("UBO_BINDING(std140, 5) uniform DX_Constants {{\n"
@@ -394,7 +650,11 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
   WriteIsNanHeader(out, api_type);
   GenerateLightingShaderHeader(out, uid_data->lighting);
 
-  if (uid_data->vs_expand == VSExpand::None)
+  if (uid_data->vertex_pulling)
+  {
+    WritePulledVertexInputs(api_type, uid_data, out);
+  }
+  else if (uid_data->vs_expand == VSExpand::None)
   {
     out.Write("ATTRIBUTE_LOCATION({:s}) in float4 rawpos;\n", ShaderAttrib::Position);
     if ((uid_data->components & VB_HAS_POSMTXIDX) != 0)
@@ -564,7 +824,11 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
 
   out.Write("void main()\n{{\n");
 
-  if (uid_data->vs_expand != VSExpand::None)
+  if (uid_data->vertex_pulling)
+  {
+    out.Write("dolphin_pull_vertex();\n");
+  }
+  else if (uid_data->vs_expand != VSExpand::None)
   {
     out.Write("InputData i = dolphin_primitive_expand_data(0);\n"
               "{}",
@@ -844,6 +1108,9 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
               "}}\n");
   }
 
+  if (multiview_stereo)
+    GenerateVSStereoOffset(out);
+
   if (host_config.backend_geometry_shaders)
   {
     AssignVSOutputMembers(out, "vs", "o", uid_data->numTexGens, host_config);
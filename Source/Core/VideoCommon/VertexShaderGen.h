@@ -8,6 +8,7 @@
 
 #include "VideoCommon/LightingShaderGen.h"
 #include "VideoCommon/ShaderGenCommon.h"
+#include "VideoCommon/VertexPulling.h"
 
 enum class APIType;
 enum class TexInputForm : u32;
@@ -61,6 +62,7 @@ struct vertex_shader_uid_data
   u32 dualTexTrans_enabled : 1;
   VSExpand vs_expand : 2;
   u32 position_has_3_elems : 1;
+  u32 vertex_pulling : 1;
 
   u16 texcoord_elem_count;      // 2 bits per texcoord input
   u16 texMtxInfo_n_projection;  // Stored separately to guarantee that the texMtxInfo struct is
@@ -83,6 +85,9 @@ struct vertex_shader_uid_data
   } postMtxInfo[8];
 
   LightingUidData lighting;
+
+  // The format of the raw vertices the shader reads, if vertex_pulling is set
+  VertexPulling::AttributeFormats pulled_attributes;
 };
 #pragma pack()
 
@@ -95,6 +100,9 @@ struct CustomVertexContents
 };
 
 VertexShaderUid GetVertexShaderUid();
+// Clears the fields which have no effect on the generated shader, so that equivalent UIDs compare
+// equal and share a pipeline.
+void CanonicalizeVertexShaderUid(VertexShaderUid* uid);
 ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& host_config,
                                     const vertex_shader_uid_data* uid_data,
                                     CustomVertexContents custom_contents);
@@ -159,6 +159,17 @@ bool VertexShaderManager::UseVertexDepthRange()
   return fabs(xfmem.viewport.zRange) > 16777215.0f || fabs(xfmem.viewport.farZ) > 16777215.0f;
 }
 
+// Games often load the same matrices again for every draw, so only mark the constants as dirty
+// when something actually changed. Otherwise the whole buffer would be uploaded again.
+static void UpdateConstantData(bool* dirty, void* dst, const void* src, size_t size)
+{
+  if (std::memcmp(dst, src, size) == 0)
+    return;
+
+  std::memcpy(dst, src, size);
+  *dirty = true;
+}
+
 // Syncs the shader constant buffers with xfmem
 // TODO: A cleaner way to control the matrices without making a mess in the parameters field
 void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
@@ -182,9 +193,8 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
   {
     int startn = per_vertex_transform_matrix_changes[0] / 4;
     int endn = (per_vertex_transform_matrix_changes[1] + 3) / 4;
-    memcpy(constants.transformmatrices[startn].data(), &xfmem.posMatrices[startn * 4],
-           (endn - startn) * sizeof(float4));
-    dirty = true;
+    UpdateConstantData(&dirty, constants.transformmatrices[startn].data(),
+                       &xfmem.posMatrices[startn * 4], (endn - startn) * sizeof(float4));
     xf_state_manager.ResetPerVertexTransformMatrixChanges();
   }
 
@@ -196,9 +206,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     int endn = (per_vertex_normal_matrices_changed[1] + 2) / 3;
     for (int i = startn; i < endn; i++)
     {
-      memcpy(constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i], 12);
+      UpdateConstantData(&dirty, constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i],
+                         12);
     }
-    dirty = true;
     xf_state_manager.ResetPerVertexNormalMatrixChanges();
   }
 
@@ -207,9 +217,8 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
   {
     int startn = post_transform_matrices_changed[0] / 4;
     int endn = (post_transform_matrices_changed[1] + 3) / 4;
-    memcpy(constants.posttransformmatrices[startn].data(), &xfmem.postMatrices[startn * 4],
-           (endn - startn) * sizeof(float4));
-    dirty = true;
+    UpdateConstantData(&dirty, constants.posttransformmatrices[startn].data(),
+                       &xfmem.postMatrices[startn * 4], (endn - startn) * sizeof(float4));
     xf_state_manager.ResetPostTransformMatrixChanges();
   }
 
@@ -293,11 +302,10 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     const float* norm =
         &xfmem.normalMatrices[3 * (g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 31)];
 
-    memcpy(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
-    memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
-    dirty = true;
+    UpdateConstantData(&dirty, constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
+    UpdateConstantData(&dirty, constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
+    UpdateConstantData(&dirty, constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
+    UpdateConstantData(&dirty, constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
   }
 
   if (xf_state_manager.DidTexMatrixAChange())
@@ -312,9 +320,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      UpdateConstantData(&dirty, constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i],
+                         3 * sizeof(float4));
     }
-    dirty = true;
   }
 
   if (xf_state_manager.DidTexMatrixBChange())
@@ -329,9 +337,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      UpdateConstantData(&dirty, constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i],
+                         3 * sizeof(float4));
     }
-    dirty = true;
   }
 
   if (xf_state_manager.DidViewportChange())
@@ -424,8 +432,8 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
       action->OnProjection(&projection);
     }
 
-    memcpy(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4));
-    dirty = true;
+    UpdateConstantData(&dirty, constants.projection.data(), corrected_matrix.data.data(),
+                       4 * sizeof(float4));
   }
 
   if (xf_state_manager.DidTexMatrixInfoChange())
@@ -51,12 +51,14 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTimings.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -96,10 +98,8 @@ void VideoBackendBase::Video_OutputXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride
   if (m_initialized && g_presenter && !g_ActiveConfig.bImmediateXFB)
   {
     auto& system = Core::System::GetInstance();
-    system.GetFifo().SyncGPU(Fifo::SyncGPUReason::Swap);
-
     const TimePoint presentation_time = system.GetCoreTiming().GetTargetHostTime(ticks);
-    AsyncRequests::GetInstance()->PushEvent([=] {
+    system.GetFifo().PushSwapEvent([=] {
       g_presenter->ViSwap(xfb_addr, fb_width, fb_stride, fb_height, ticks, presentation_time);
     });
   }
@@ -112,12 +112,25 @@ u32 VideoBackendBase::Video_GetQueryResult(PerfQueryType type)
     return 0;
   }
 
+  g_vertex_manager->OnEFBRead();
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::PerfQuery);
 
   if (!g_perf_query->IsFlushed())
   {
-    AsyncRequests::GetInstance()->PushBlockingEvent([] { g_perf_query->FlushResults(); });
+    // In non-blocking mode, the game reads whatever has been accumulated so far, and the
+    // remaining results arrive in later reads.
+    if (g_ActiveConfig.bPerfQueriesNonBlocking)
+    {
+      AsyncRequests::GetInstance()->PushEvent([] { g_perf_query->PollResults(); });
+    }
+    else
+    {
+      AsyncRequests::GetInstance()->PushBlockingEvent([] {
+        INCSTAT(g_stats.this_frame.num_perf_query_stalls);
+        g_perf_query->FlushResults();
+      });
+    }
   }
 
   return g_perf_query->GetQueryResult(type);
@@ -151,6 +164,7 @@ u16 VideoBackendBase::Video_GetBoundingBox(int index)
     warn_once = false;
   }
 
+  g_vertex_manager->OnEFBRead();
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::BBox);
 
@@ -307,6 +321,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   g_shader_cache = std::make_unique<VideoCommon::ShaderCache>();
   g_graphics_mod_manager = std::make_unique<GraphicsModManager>();
   g_widescreen = std::make_unique<WidescreenManager>();
+  g_gpu_timings = std::make_unique<VideoCommon::GPUTimings>();
 
   if (!g_vertex_manager->Initialize() || !g_shader_cache->Initialize() ||
       !g_perf_query->Initialize() || !g_presenter->Initialize() ||
@@ -369,6 +384,7 @@ void VideoBackendBase::ShutdownShared()
   g_vertex_manager.reset();
   g_efb_interface.reset();
   g_widescreen.reset();
+  g_gpu_timings.reset();
   g_gfx.reset();
 
   m_initialized = false;
@@ -6,9 +6,9 @@
 #include <algorithm>
 #include <optional>
 
-#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/Contains.h"
+#include "Common/TaskScheduler.h"
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/GraphicsSettings.h"
@@ -37,6 +37,11 @@ BackendInfo g_backend_info;
 static std::optional<CPUThreadConfigCallback::ConfigChangedCallbackID>
     s_config_changed_callback_id = std::nullopt;
 
+static bool IsFastForwarding()
+{
+  return Core::GetIsThrottlerTempDisabled() || Config::Get(Config::MAIN_EMULATION_SPEED) == 0.0f;
+}
+
 static bool IsVSyncActive(bool enabled)
 {
   // Vsync is disabled when the throttler is disabled by the tab key.
@@ -48,6 +53,8 @@ void UpdateActiveConfig()
 {
   g_ActiveConfig = g_Config;
   g_ActiveConfig.bVSyncActive = IsVSyncActive(g_ActiveConfig.bVSync);
+  if (!IsFastForwarding())
+    g_ActiveConfig.iFastForwardFrameSkip = 0;
 }
 
 void VideoConfig::Refresh()
@@ -79,8 +86,11 @@ void VideoConfig::Refresh()
 
   bVSync = Config::Get(Config::GFX_VSYNC);
   iAdapter = Config::Get(Config::GFX_ADAPTER);
+  iPresentFrameLatency =
+      std::clamp(Config::Get(Config::GFX_PRESENT_FRAME_LATENCY), 0, MAX_PRESENT_FRAME_LATENCY);
   iManuallyUploadBuffers = Config::Get(Config::GFX_MTL_MANUALLY_UPLOAD_BUFFERS);
   iUsePresentDrawable = Config::Get(Config::GFX_MTL_USE_PRESENT_DRAWABLE);
+  bUseArgumentBuffers = Config::Get(Config::GFX_MTL_USE_ARGUMENT_BUFFERS);
 
   bWidescreenHack = Config::Get(Config::GFX_WIDESCREEN_HACK);
   aspect_mode = Config::Get(Config::GFX_ASPECT_RATIO);
@@ -106,14 +116,18 @@ void VideoConfig::Refresh()
   bShowSpeedColors = Config::Get(Config::GFX_SHOW_SPEED_COLORS);
   iPerfSampleUSec = Config::Get(Config::GFX_PERF_SAMP_WINDOW) * 1000;
   bLogRenderTimeToFile = Config::Get(Config::GFX_LOG_RENDER_TIME_TO_FILE);
+  bPipelineMissReport = Config::Get(Config::GFX_PIPELINE_MISS_REPORT);
   bOverlayStats = Config::Get(Config::GFX_OVERLAY_STATS);
   bOverlayProjStats = Config::Get(Config::GFX_OVERLAY_PROJ_STATS);
   bOverlayScissorStats = Config::Get(Config::GFX_OVERLAY_SCISSOR_STATS);
+  bOverlayGPUTimings = Config::Get(Config::GFX_OVERLAY_GPU_TIMINGS);
   bDumpTextures = Config::Get(Config::GFX_DUMP_TEXTURES);
   bDumpMipmapTextures = Config::Get(Config::GFX_DUMP_MIP_TEXTURES);
   bDumpBaseTextures = Config::Get(Config::GFX_DUMP_BASE_TEXTURES);
   bHiresTextures = Config::Get(Config::GFX_HIRES_TEXTURES);
   bCacheHiresTextures = Config::Get(Config::GFX_CACHE_HIRES_TEXTURES);
+  bTranscodeHiresTextures = Config::Get(Config::GFX_TRANSCODE_HIRES_TEXTURES);
+  iCustomAssetMemoryBudget = Config::Get(Config::GFX_CUSTOM_ASSET_MEMORY_BUDGET);
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bEnableGPUTextureDecoding = Config::Get(Config::GFX_ENABLE_GPU_TEXTURE_DECODING);
@@ -123,6 +137,8 @@ void VideoConfig::Refresh()
   iMultisamples = Config::Get(Config::GFX_MSAA);
   bSSAA = Config::Get(Config::GFX_SSAA);
   iEFBScale = Config::Get(Config::GFX_EFB_SCALE);
+  bDynamicEFBScale = Config::Get(Config::GFX_DYNAMIC_EFB_SCALE);
+  iDynamicEFBScaleMin = Config::Get(Config::GFX_DYNAMIC_EFB_SCALE_MIN);
   bTexFmtOverlayEnable = Config::Get(Config::GFX_TEXFMT_OVERLAY_ENABLE);
   bTexFmtOverlayCenter = Config::Get(Config::GFX_TEXFMT_OVERLAY_CENTER);
   bWireFrame = Config::Get(Config::GFX_ENABLE_WIREFRAME);
@@ -131,12 +147,19 @@ void VideoConfig::Refresh()
   bEnableValidationLayer = Config::Get(Config::GFX_ENABLE_VALIDATION_LAYER);
   bBackendMultithreading = Config::Get(Config::GFX_BACKEND_MULTITHREADING);
   iCommandBufferExecuteInterval = Config::Get(Config::GFX_COMMAND_BUFFER_EXECUTE_INTERVAL);
+  bTransferQueue = Config::Get(Config::GFX_TRANSFER_QUEUE);
   bShaderCache = Config::Get(Config::GFX_SHADER_CACHE);
   bWaitForShadersBeforeStarting = Config::Get(Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING);
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
+  iTextureDecodingThreads = Config::Get(Config::GFX_TEXTURE_DECODING_THREADS);
+  iTextureCacheMemoryBudget = Config::Get(Config::GFX_TEXTURE_CACHE_MEMORY_BUDGET);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
+  bCPUCullPartial = Config::Get(Config::GFX_CPU_CULL_PARTIAL);
+  iCPUCullThreads = Config::Get(Config::GFX_CPU_CULL_THREADS);
+  bCacheVertexData = Config::Get(Config::GFX_CACHE_VERTEX_DATA);
+  bGPUVertexPulling = Config::Get(Config::GFX_GPU_VERTEX_PULLING);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
   iMaxAnisotropy = Config::Get(Config::GFX_ENHANCE_MAX_ANISOTROPY);
@@ -169,12 +192,15 @@ void VideoConfig::Refresh()
   bEFBAccessEnable = Config::Get(Config::GFX_HACK_EFB_ACCESS_ENABLE);
   bEFBAccessDeferInvalidation = Config::Get(Config::GFX_HACK_EFB_DEFER_INVALIDATION);
   bBBoxEnable = Config::Get(Config::GFX_HACK_BBOX_ENABLE);
+  iBBoxReadbackLatency = Config::Get(Config::GFX_HACK_BBOX_READBACK_LATENCY);
   bSkipEFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM);
   bSkipXFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM);
   bDisableCopyToVRAM = Config::Get(Config::GFX_HACK_DISABLE_COPY_TO_VRAM);
   bDeferEFBCopies = Config::Get(Config::GFX_HACK_DEFER_EFB_COPIES);
+  bElideUnchangedEFBCopies = Config::Get(Config::GFX_HACK_ELIDE_UNCHANGED_EFB_COPIES);
   bImmediateXFB = Config::Get(Config::GFX_HACK_IMMEDIATE_XFB);
   bVISkip = Config::Get(Config::GFX_HACK_VI_SKIP);
+  iFastForwardFrameSkip = Config::Get(Config::GFX_HACK_FAST_FORWARD_FRAME_SKIP);
   bSkipPresentingDuplicateXFBs = bVISkip || Config::Get(Config::GFX_HACK_SKIP_DUPLICATE_XFBS);
   bCopyEFBScaled = Config::Get(Config::GFX_HACK_COPY_EFB_SCALED);
   bEFBEmulateFormatChanges = Config::Get(Config::GFX_HACK_EFB_EMULATE_FORMAT_CHANGES);
@@ -182,11 +208,14 @@ void VideoConfig::Refresh()
   iEFBAccessTileSize = Config::Get(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE);
   iMissingColorValue = Config::Get(Config::GFX_HACK_MISSING_COLOR_VALUE);
   bFastTextureSampling = Config::Get(Config::GFX_HACK_FAST_TEXTURE_SAMPLING);
+  bAsyncTextureDecoding = Config::Get(Config::GFX_HACK_ASYNC_TEXTURE_DECODING);
+  bUpdateChangedTextureRows = Config::Get(Config::GFX_HACK_UPDATE_CHANGED_TEXTURE_ROWS);
 #ifdef __APPLE__
   bNoMipmapping = Config::Get(Config::GFX_HACK_NO_MIPMAPPING);
 #endif
 
   bPerfQueriesEnable = Config::Get(Config::GFX_PERF_QUERIES_ENABLE);
+  bPerfQueriesNonBlocking = Config::Get(Config::GFX_PERF_QUERIES_NON_BLOCKING);
 
   bGraphicMods = Config::Get(Config::GFX_MODS_ENABLE);
 
@@ -233,16 +262,17 @@ bool VideoConfig::UsingUberShaders() const
 
 static u32 GetNumAutoShaderCompilerThreads()
 {
-  // Automatic number.
-  return static_cast<u32>(std::clamp(cpu_info.num_cores - 3, 1, 4));
+  // Automatic number. Shader compiling shares the cores left by the emulation threads with the
+  // other background work, so it takes one less than them, and never more than four.
+  return std::clamp(Common::GetTaskThreadBudget(), 2u, 5u) - 1;
 }
 
 static u32 GetNumAutoShaderPreCompilerThreads()
 {
-  // Automatic number. We use clamp(cpus - 2, 1, infty) here.
+  // Automatic number. We use the task thread budget, clamp(cpus - 2, 1, infty), here.
   // We chose this because we don't want to limit our speed-up
   // and at the same time leave two logical cores for the dolphin UI and the rest of the OS.
-  return static_cast<u32>(std::max(cpu_info.num_cores - 2, 1));
+  return Common::GetTaskThreadBudget();
 }
 
 u32 VideoConfig::GetShaderCompilerThreads() const
@@ -273,6 +303,16 @@ u32 VideoConfig::GetShaderPrecompilerThreads() const
     return 1;
 }
 
+u32 VideoConfig::GetTextureDecodingThreads() const
+{
+  if (iTextureDecodingThreads >= 0)
+    return static_cast<u32>(iTextureDecodingThreads);
+
+  // Automatic number. The CPU and video threads are already busy, and the video thread decodes a
+  // share of each texture itself.
+  return std::clamp(Common::GetTaskThreadBudget(), 2u, 5u) - 1;
+}
+
 void CheckForConfigChanges()
 {
   const ShaderHostConfig old_shader_host_config = ShaderHostConfig::GetCurrent();
@@ -337,6 +377,8 @@ void CheckForConfigChanges()
     changed_bits |= CONFIG_CHANGE_BIT_BBOX;
   if (old_efb_scale != g_ActiveConfig.iEFBScale)
     changed_bits |= CONFIG_CHANGE_BIT_TARGET_SIZE;
+  if (g_framebuffer_manager->UpdateDynamicEFBScale())
+    changed_bits |= CONFIG_CHANGE_BIT_TARGET_SIZE;
   if (old_aspect_mode != g_ActiveConfig.aspect_mode)
     changed_bits |= CONFIG_CHANGE_BIT_ASPECT_RATIO;
   if (old_suggested_aspect_mode != g_ActiveConfig.suggested_aspect_mode)
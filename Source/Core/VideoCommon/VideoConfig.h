@@ -18,6 +18,7 @@
 #include "VideoCommon/VideoCommon.h"
 
 constexpr int EFB_SCALE_AUTO_INTEGRAL = 0;
+constexpr int MAX_PRESENT_FRAME_LATENCY = 3;
 
 enum class AspectMode : int
 {
@@ -178,9 +179,15 @@ struct BackendInfo
   bool bSupportsPartialMultisampleResolve = false;
   bool bSupportsDynamicVertexLoader = false;
   bool bSupportsVSLinePointExpand = false;
+  bool bSupportsGPUVertexPulling = false;
   bool bSupportsGLLayerInFS = true;
   bool bSupportsHDROutput = false;
   bool bSupportsUnrestrictedDepthRange = false;
+  bool bSupportsFastPipelineLinking = false;
+  bool bSupportsTimestampQueries = false;
+  // Stereoscopic game draws render both eyes in one pass, with the vertex shader offsetting each
+  // view, instead of having the geometry shader duplicate every primitive.
+  bool bSupportsMultiview = false;
 };
 
 extern BackendInfo g_backend_info;
@@ -196,6 +203,8 @@ struct VideoConfig final
   // General
   bool bVSync = false;
   bool bVSyncActive = false;
+  // Maximum number of frames queued for display, or 0 to leave this to the driver.
+  int iPresentFrameLatency = 0;
   bool bWidescreenHack = false;
   AspectMode aspect_mode{};
   int custom_aspect_width = 1;
@@ -212,6 +221,8 @@ struct VideoConfig final
   u32 iMultisamples = 0;
   bool bSSAA = false;
   int iEFBScale = 0;
+  bool bDynamicEFBScale = false;
+  int iDynamicEFBScaleMin = 1;
   TextureFilteringMode texture_filtering_mode = TextureFilteringMode::Default;
   OutputResamplingMode output_resampling_mode = OutputResamplingMode::Default;
   AnisotropicFilteringMode iMaxAnisotropy = AnisotropicFilteringMode::Default;
@@ -254,9 +265,11 @@ struct VideoConfig final
   bool bOverlayStats = false;
   bool bOverlayProjStats = false;
   bool bOverlayScissorStats = false;
+  bool bOverlayGPUTimings = false;
   bool bTexFmtOverlayEnable = false;
   bool bTexFmtOverlayCenter = false;
   bool bLogRenderTimeToFile = false;
+  bool bPipelineMissReport = false;
 
   // Render
   bool bWireFrame = false;
@@ -268,6 +281,9 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  bool bTranscodeHiresTextures = false;
+  // Memory budget for custom assets in MiB, 0 picks one based on the system memory
+  int iCustomAssetMemoryBudget = 0;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bBorderlessFullscreen = false;
@@ -280,14 +296,21 @@ struct VideoConfig final
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
   bool bPerfQueriesEnable = false;
+  bool bPerfQueriesNonBlocking = false;
   bool bBBoxEnable = false;
+  int iBBoxReadbackLatency = 0;
   bool bCPUCull = false;
+  bool bCPUCullPartial = false;
+  int iCPUCullThreads = 1;
+  bool bCacheVertexData = false;
+  bool bGPUVertexPulling = false;
 
   bool bEFBEmulateFormatChanges = false;
   bool bSkipEFBCopyToRam = false;
   bool bSkipXFBCopyToRam = false;
   bool bDisableCopyToVRAM = false;
   bool bDeferEFBCopies = false;
+  bool bElideUnchangedEFBCopies = false;
   bool bImmediateXFB = false;
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
@@ -298,10 +321,15 @@ struct VideoConfig final
   bool bFastDepthCalc = false;
   bool bVertexRounding = false;
   bool bVISkip = false;
+  // Number of frames which aren't rendered after each rendered frame while fast-forwarding,
+  // as long as nothing reads back the EFB. 0 while not fast-forwarding.
+  int iFastForwardFrameSkip = 0;
   int iEFBAccessTileSize = 0;
   int iSaveTargetId = 0;  // TODO: Should be dropped
   u32 iMissingColorValue = 0;
   bool bFastTextureSampling = false;
+  bool bAsyncTextureDecoding = false;
+  bool bUpdateChangedTextureRows = false;
 #ifdef __APPLE__
   bool bNoMipmapping = false;  // Used by macOS fifoci to work around an M1 bug
 #endif
@@ -322,6 +350,7 @@ struct VideoConfig final
   // Metal only config
   TriState iManuallyUploadBuffers = TriState::Auto;
   TriState iUsePresentDrawable = TriState::Auto;
+  bool bUseArgumentBuffers = false;
 
   // Enable API validation layers, currently only supported with Vulkan.
   bool bEnableValidationLayer = false;
@@ -333,6 +362,10 @@ struct VideoConfig final
   // Currently only supported with Vulkan.
   int iCommandBufferExecuteInterval = 0;
 
+  // Upload textures on a dedicated transfer queue, if the device has one.
+  // Currently only supported with Vulkan.
+  bool bTransferQueue = false;
+
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting = false;
   ShaderCompilationMode iShaderCompilationMode{};
@@ -343,6 +376,15 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of threads which help decoding textures on the CPU.
+  // 0 decodes textures on the video thread only.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecodingThreads = 0;
+
+  // Video memory in MiB which the texture cache tries to stay within, by freeing the least
+  // recently used textures. 0 disables the limit.
+  int iTextureCacheMemoryBudget = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -368,6 +410,13 @@ struct VideoConfig final
     return g_backend_info.bSupportsGPUTextureDecoding && bEnableGPUTextureDecoding;
   }
   bool UseVertexRounding() const { return bVertexRounding && iEFBScale != 1; }
+  bool UseGPUVertexPulling() const
+  {
+    // Ubershaders read vertices which have already been converted.
+    return g_backend_info.bSupportsGPUVertexPulling && bGPUVertexPulling &&
+           (iShaderCompilationMode == ShaderCompilationMode::Synchronous ||
+            iShaderCompilationMode == ShaderCompilationMode::AsynchronousSkipRendering);
+  }
   bool ManualTextureSamplingWithCustomTextureSizes() const
   {
     // If manual texture sampling is disabled, we don't need to do anything.
@@ -391,6 +440,7 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetTextureDecodingThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
@@ -17,6 +17,7 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/XFMemory.h"
@@ -33,6 +34,12 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
 {
   if (address >= XFMEM_REGISTERS_START && address < XFMEM_REGISTERS_END)
   {
+    // Games often rewrite registers with the values they already have between draws. Those
+    // writes must not split the current batch.
+    const bool changed = reinterpret_cast<const u32*>(&xfmem)[address] != value;
+    if (!changed)
+      INCSTAT(g_stats.this_frame.num_redundant_state_writes);
+
     switch (address)
     {
     case XFMEM_ERROR:
@@ -120,6 +127,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
+      if (!changed)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetViewportChanged();
       system.GetPixelShaderManager().SetViewportChanged();
@@ -133,6 +142,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
+      if (!changed)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetProjectionChanged();
       system.GetGeometryShaderManager().SetProjectionChanged();
@@ -151,6 +162,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
+      if (!changed)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
       break;
@@ -163,6 +176,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
+      if (!changed)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
       break;
@@ -232,12 +247,28 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
-    for (u32 i = 0; i < xf_mem_transfer_size; i++)
+    // Matrices and lights are frequently reloaded with the same contents, so only flush if
+    // something actually changes, as LoadIndexedXF does. Only the range from the first changed
+    // value on needs to be uploaded again.
+    u32* const xf_mem = reinterpret_cast<u32*>(&xfmem) + xf_mem_base;
+    u32 first_changed = 0;
+    while (first_changed < xf_mem_transfer_size &&
+           xf_mem[first_changed] == Common::swap32(data + first_changed * 4))
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      ++first_changed;
+    }
+    if (first_changed == xf_mem_transfer_size)
+    {
+      INCSTAT(g_stats.this_frame.num_redundant_state_writes);
+    }
+    else
+    {
+      XFMemWritten(xf_state_manager, xf_mem_transfer_size - first_changed,
+                   xf_mem_base + first_changed);
+      for (u32 i = first_changed; i < xf_mem_transfer_size; i++)
+        xf_mem[i] = Common::swap32(data + i * 4);
     }
+    data += xf_mem_transfer_size * 4;
   }
 
   // write to XF regs
@@ -278,21 +309,18 @@ void LoadIndexedXF(CPArray array, u32 index, u16 address, u8 size)
   }
 
   auto& xf_state_manager = system.GetXFStateManager();
-  bool changed = false;
-  for (u32 i = 0; i < size; ++i)
+  u32 first_changed = 0;
+  while (first_changed < size && currData[first_changed] == Common::swap32(newData[first_changed]))
+    ++first_changed;
+  if (first_changed == size)
   {
-    if (currData[i] != Common::swap32(newData[i]))
-    {
-      changed = true;
-      XFMemWritten(xf_state_manager, size, address);
-      break;
-    }
-  }
-  if (changed)
-  {
-    for (u32 i = 0; i < size; ++i)
-      currData[i] = Common::swap32(newData[i]);
+    INCSTAT(g_stats.this_frame.num_redundant_state_writes);
+    return;
   }
+
+  XFMemWritten(xf_state_manager, size - first_changed, address + first_changed);
+  for (u32 i = first_changed; i < size; ++i)
+    currData[i] = Common::swap32(newData[i]);
 }
 
 void PreprocessIndexedXF(CPArray array, u32 index, u16 address, u8 size)
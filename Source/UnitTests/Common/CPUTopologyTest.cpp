@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Common/CPUTopology.h"
+
+namespace
+{
+// Adds a physical core with two SMT siblings, numbered like Linux does: siblings are offset by the
+// number of physical cores.
+void AddCore(Common::CPUTopology* topology, u32 core, u32 num_cores, u32 performance_class,
+             u32 cache_group)
+{
+  topology->processors.push_back({core, core, performance_class, cache_group});
+  topology->processors.push_back({core + num_cores, core, performance_class, cache_group});
+}
+}  // namespace
+
+TEST(CPUTopology, UniformCPUIsLeftToTheScheduler)
+{
+  Common::CPUTopology topology;
+  for (u32 i = 0; i < 8; ++i)
+    AddCore(&topology, i, 8, 0, 0);
+
+  EXPECT_FALSE(topology.IsHybrid());
+  const Common::ThreadPlacement placement = Common::ComputeThreadPlacement(topology);
+  EXPECT_TRUE(placement.cpu_thread.empty());
+  EXPECT_TRUE(placement.gpu_thread.empty());
+  EXPECT_TRUE(placement.background.empty());
+}
+
+TEST(CPUTopology, HybridCPUUsesPerformanceCores)
+{
+  // 4 P-cores with SMT, followed by 4 E-cores without.
+  Common::CPUTopology topology;
+  for (u32 i = 0; i < 4; ++i)
+    AddCore(&topology, i, 4, 1, 0);
+  for (u32 i = 8; i < 12; ++i)
+    topology.processors.push_back({i, i, 0, 0});
+
+  EXPECT_TRUE(topology.IsHybrid());
+  const Common::ThreadPlacement placement = Common::ComputeThreadPlacement(topology);
+  EXPECT_EQ(placement.cpu_thread, (std::vector<u32>{3, 7}));
+  EXPECT_EQ(placement.gpu_thread, (std::vector<u32>{2, 6}));
+  EXPECT_EQ(placement.background, (std::vector<u32>{8, 9, 10, 11}));
+}
+
+TEST(CPUTopology, SeveralCacheGroupsKeepEmulationTogether)
+{
+  // Two CCDs of 4 cores each, sharing their L3 cache within the CCD.
+  Common::CPUTopology topology;
+  for (u32 i = 0; i < 8; ++i)
+    AddCore(&topology, i, 8, 0, i < 4 ? 0 : 4);
+
+  const Common::ThreadPlacement placement = Common::ComputeThreadPlacement(topology);
+  EXPECT_EQ(placement.cpu_thread, (std::vector<u32>{7, 15}));
+  EXPECT_EQ(placement.gpu_thread, (std::vector<u32>{6, 14}));
+  EXPECT_TRUE(placement.background.empty());
+}
+
+TEST(CPUTopology, GPUThreadPrefersTheCPUThreadsCache)
+{
+  // The cores of each cluster are numbered alternately, so the second fastest core by number is
+  // in the other cluster.
+  Common::CPUTopology topology;
+  for (u32 i = 0; i < 4; ++i)
+    topology.processors.push_back({i, i, 1, i % 2});
+
+  const Common::ThreadPlacement placement = Common::ComputeThreadPlacement(topology);
+  EXPECT_EQ(placement.cpu_thread, (std::vector<u32>{3}));
+  EXPECT_EQ(placement.gpu_thread, (std::vector<u32>{1}));
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatMultiMap.h"
+
+namespace
+{
+// Puts every key in the same probe sequence
+struct CollidingHash
+{
+  size_t operator()(u32) const { return 0; }
+};
+
+template <typename Map>
+int CountValues(Map& map, u32 key, int value)
+{
+  int count = 0;
+  map.FindIf(key, [&](int v) {
+    count += v == value;
+    return false;
+  });
+  return count;
+}
+}  // namespace
+
+TEST(FlatMultiMap, InsertFindErase)
+{
+  Common::FlatMultiMap<u32, int> map;
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(map.FindIf(1, [](int) { return true; }), nullptr);
+
+  map.Insert(1, 10);
+  map.Insert(1, 11);
+  map.Insert(2, 20);
+  EXPECT_EQ(map.Size(), 3u);
+
+  const int* value = map.FindIf(1, [](int v) { return v == 11; });
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(*value, 11);
+  EXPECT_EQ(map.FindIf(2, [](int v) { return v == 10; }), nullptr);
+
+  EXPECT_TRUE(map.Erase(1, 10));
+  EXPECT_FALSE(map.Erase(1, 10));
+  EXPECT_EQ(map.FindIf(1, [](int v) { return v == 10; }), nullptr);
+  EXPECT_NE(map.FindIf(1, [](int v) { return v == 11; }), nullptr);
+  EXPECT_EQ(map.Size(), 2u);
+
+  map.Clear();
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(map.FindIf(2, [](int) { return true; }), nullptr);
+}
+
+TEST(FlatMultiMap, EraseKeepsCollidingKeysReachable)
+{
+  Common::FlatMultiMap<u32, int, CollidingHash> map;
+  for (u32 i = 0; i < 10; ++i)
+    map.Insert(i, static_cast<int>(i));
+
+  EXPECT_TRUE(map.Erase(3, 3));
+  EXPECT_TRUE(map.Erase(0, 0));
+  for (u32 i = 0; i < 10; ++i)
+    EXPECT_EQ(CountValues(map, i, static_cast<int>(i)), i == 0 || i == 3 ? 0 : 1);
+}
+
+TEST(FlatMultiMap, MatchesStdMultimap)
+{
+  Common::FlatMultiMap<u32, int> map;
+  std::multimap<u32, int> reference;
+  std::mt19937 rng(1234);
+
+  for (int i = 0; i < 20000; ++i)
+  {
+    const u32 key = rng() % 256;
+    const int value = static_cast<int>(rng() % 4);
+    if (rng() % 3 != 0)
+    {
+      map.Insert(key, value);
+      reference.emplace(key, value);
+    }
+    else
+    {
+      const auto range = reference.equal_range(key);
+      const auto it = std::find_if(range.first, range.second,
+                                   [value](const auto& pair) { return pair.second == value; });
+      EXPECT_EQ(map.Erase(key, value), it != range.second);
+      if (it != range.second)
+        reference.erase(it);
+    }
+  }
+
+  EXPECT_EQ(map.Size(), reference.size());
+
+  size_t visited = 0;
+  map.ForEach([&](u32 key, int value) {
+    const auto range = reference.equal_range(key);
+    const auto expected = std::count_if(range.first, range.second,
+                                        [value](const auto& pair) { return pair.second == value; });
+    EXPECT_EQ(CountValues(map, key, value), expected);
+    ++visited;
+  });
+  EXPECT_EQ(visited, reference.size());
+}
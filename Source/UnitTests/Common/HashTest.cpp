@@ -0,0 +1,112 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+namespace
+{
+u32 ReferenceCRC32(const u8* data, size_t len)
+{
+  u32 crc = 0xffffffff;
+  for (size_t i = 0; i < len; ++i)
+  {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit)
+      crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+u32 ReferenceAdler32(const u8* data, size_t len)
+{
+  u32 s1 = 1;
+  u32 s2 = 0;
+  for (size_t i = 0; i < len; ++i)
+  {
+    s1 = (s1 + data[i]) % 65521;
+    s2 = (s2 + s1) % 65521;
+  }
+  return s1 | (s2 << 16);
+}
+
+std::vector<u8> RandomBytes(size_t size)
+{
+  std::mt19937 rng(size);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+    byte = static_cast<u8>(dist(rng));
+  return data;
+}
+}  // namespace
+
+TEST(Hash, CRC32MatchesReference)
+{
+  const std::vector<u8> data = RandomBytes(4096 + 64);
+
+  // Cover every tail length and alignment around the vectorized block sizes.
+  for (size_t offset = 0; offset < 16; ++offset)
+  {
+    for (size_t len = 0; len < 300; ++len)
+    {
+      EXPECT_EQ(Common::ComputeCRC32(data.data() + offset, len),
+                ReferenceCRC32(data.data() + offset, len))
+          << "offset " << offset << ", length " << len;
+    }
+  }
+  EXPECT_EQ(Common::ComputeCRC32(data.data(), 4096), ReferenceCRC32(data.data(), 4096));
+}
+
+TEST(Hash, CRC32CanBeUpdatedInParts)
+{
+  const std::vector<u8> data = RandomBytes(10000);
+  const u32 expected = ReferenceCRC32(data.data(), data.size());
+
+  for (const size_t split : {1, 63, 64, 65, 1000, 9999})
+  {
+    u32 crc = Common::StartCRC32();
+    crc = Common::UpdateCRC32(crc, data.data(), split);
+    crc = Common::UpdateCRC32(crc, data.data() + split, data.size() - split);
+    EXPECT_EQ(crc, expected) << "split at " << split;
+  }
+}
+
+TEST(Hash, Adler32MatchesReference)
+{
+  const std::vector<u8> data = RandomBytes(1024 + 16);
+  for (size_t offset = 0; offset < 16; offset += 3)
+  {
+    for (size_t len = 0; len < 1024; len += 7)
+    {
+      EXPECT_EQ(Common::HashAdler32(data.data() + offset, len),
+                ReferenceAdler32(data.data() + offset, len))
+          << "offset " << offset << ", length " << len;
+    }
+  }
+
+  // All 0xff bytes produce the largest sums, so long inputs check that the sums can't overflow
+  // between reductions.
+  const std::vector<u8> ones(100000, 0xff);
+  EXPECT_EQ(Common::HashAdler32(ones.data(), ones.size()),
+            ReferenceAdler32(ones.data(), ones.size()));
+}
+
+TEST(Hash, Hash128IsDeterministic)
+{
+  const std::vector<u8> data = RandomBytes(256);
+  EXPECT_EQ(Common::ComputeHash128(data.data(), data.size()),
+            Common::ComputeHash128(data.data(), data.size()));
+
+  // Every prefix should get its own hash.
+  std::unordered_set<Common::Hash128> hashes;
+  for (size_t len = 0; len <= data.size(); ++len)
+    hashes.insert(Common::ComputeHash128(data.data(), len));
+  EXPECT_EQ(hashes.size(), data.size() + 1);
+}
@@ -0,0 +1,260 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+using Cache = Common::LinearDiskCache<u32, u8>;
+
+class CollectingReader final : public Common::LinearDiskCacheReader<u32, u8>
+{
+public:
+  void Read(const u32& key, const u8* value, u32 value_size) override
+  {
+    entries[key].assign(value, value + value_size);
+  }
+
+  std::map<u32, std::vector<u8>> entries;
+};
+
+std::vector<u8> MakeValue(u32 key, u32 size)
+{
+  std::vector<u8> value(size);
+  for (u32 i = 0; i < size; ++i)
+    value[i] = static_cast<u8>(key * 7 + i);
+  return value;
+}
+
+void Append(Cache* cache, u32 key, u32 size)
+{
+  const std::vector<u8> value = MakeValue(key, size);
+  cache->Append(key, value.data(), size);
+}
+}  // namespace
+
+class LinearDiskCacheTest : public testing::Test
+{
+protected:
+  LinearDiskCacheTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/cache.bin")
+  {
+  }
+
+  ~LinearDiskCacheTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  std::map<u32, std::vector<u8>> ReadAll()
+  {
+    Cache cache;
+    CollectingReader reader;
+    const u32 count = cache.OpenAndRead(m_path, reader);
+    EXPECT_EQ(count, reader.entries.size());
+    return reader.entries;
+  }
+
+  const std::string m_directory;
+  const std::string m_path;
+};
+
+TEST_F(LinearDiskCacheTest, AppendedEntriesCanBeReadAndLookedUp)
+{
+  {
+    Cache cache;
+    EXPECT_EQ(cache.Open(m_path), 0u);
+    Append(&cache, 1, 10);
+    Append(&cache, 2, 0);
+    Append(&cache, 3, 1000);
+
+    const auto value = cache.Lookup(3);
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(std::vector<u8>(value->begin(), value->end()), MakeValue(3, 1000));
+    EXPECT_FALSE(cache.Lookup(4).has_value());
+  }
+
+  const auto entries = ReadAll();
+  ASSERT_EQ(entries.size(), 3u);
+  EXPECT_EQ(entries.at(1), MakeValue(1, 10));
+  EXPECT_TRUE(entries.at(2).empty());
+  EXPECT_EQ(entries.at(3), MakeValue(3, 1000));
+
+  Cache cache;
+  EXPECT_EQ(cache.Open(m_path), 3u);
+  const auto value = cache.Lookup(1);
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(std::vector<u8>(value->begin(), value->end()), MakeValue(1, 10));
+}
+
+TEST_F(LinearDiskCacheTest, LaterEntriesReplaceEarlierOnes)
+{
+  {
+    Cache cache;
+    cache.Open(m_path);
+    Append(&cache, 1, 10);
+    Append(&cache, 1, 20);
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+    EXPECT_EQ(cache.Lookup(1)->size(), 20u);
+  }
+
+  const auto entries = ReadAll();
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_EQ(entries.at(1), MakeValue(1, 20));
+}
+
+TEST_F(LinearDiskCacheTest, TornAppendOnlyLosesThatEntry)
+{
+  {
+    Cache cache;
+    cache.Open(m_path);
+    for (u32 key = 0; key < 5; ++key)
+      Append(&cache, key, 100);
+  }
+
+  // Cut off the middle of the last entry, like a crash while it was being written would.
+  {
+    File::IOFile file(m_path, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 50));
+  }
+
+  {
+    Cache cache;
+    EXPECT_EQ(cache.Open(m_path), 4u);
+    Append(&cache, 10, 100);
+  }
+
+  const auto entries = ReadAll();
+  ASSERT_EQ(entries.size(), 5u);
+  EXPECT_EQ(entries.count(4), 0u);
+  EXPECT_EQ(entries.at(10), MakeValue(10, 100));
+}
+
+TEST_F(LinearDiskCacheTest, CompactionDropsReplacedEntries)
+{
+  {
+    Cache cache;
+    cache.Open(m_path);
+    for (u32 round = 0; round < 4; ++round)
+    {
+      for (u32 key = 0; key < 100; ++key)
+        Append(&cache, key, 100 + round);
+    }
+  }
+  const u64 size_before = File::GetSize(m_path);
+
+  // Opening compacts the file, since most of it is replaced entries.
+  const auto entries = ReadAll();
+  const u64 size_after = File::GetSize(m_path);
+  EXPECT_LT(size_after, size_before / 2);
+  ASSERT_EQ(entries.size(), 100u);
+  EXPECT_EQ(entries.at(42), MakeValue(42, 103));
+
+  // Entries appended after the index are found as well.
+  {
+    Cache cache;
+    EXPECT_EQ(cache.Open(m_path), 100u);
+    Append(&cache, 1000, 5);
+  }
+  EXPECT_EQ(ReadAll().size(), 101u);
+  EXPECT_FALSE(File::Exists(m_path + ".tmp"));
+}
+
+TEST_F(LinearDiskCacheTest, CompactionDropsStaleEntries)
+{
+  Cache cache;
+  cache.Open(m_path);
+  for (u32 key = 0; key < 10; ++key)
+    Append(&cache, key, 10);
+
+  cache.Compact([](const u32& key) { return key % 2 == 0; });
+  EXPECT_EQ(cache.GetEntryCount(), 5u);
+  EXPECT_FALSE(cache.Lookup(2).has_value());
+  EXPECT_TRUE(cache.Lookup(3).has_value());
+
+  Append(&cache, 20, 10);
+  cache.Close();
+
+  const auto entries = ReadAll();
+  EXPECT_EQ(entries.size(), 6u);
+  EXPECT_EQ(entries.at(20), MakeValue(20, 10));
+}
+
+TEST_F(LinearDiskCacheTest, IncompatibleFilesAreReplaced)
+{
+  {
+    File::IOFile file(m_path, "wb");
+    file.WriteString("DCAC not a cache file");
+  }
+
+  Cache cache;
+  EXPECT_EQ(cache.Open(m_path), 0u);
+  Append(&cache, 1, 1);
+  cache.Close();
+  EXPECT_EQ(ReadAll().size(), 1u);
+}
+
+TEST_F(LinearDiskCacheTest, SharedCachesSeeEachOthersAppends)
+{
+  Cache first;
+  Cache second;
+  EXPECT_EQ(first.Open(m_path, true), 0u);
+  EXPECT_EQ(second.Open(m_path, true), 0u);
+
+  Append(&first, 1, 10);
+  Append(&second, 2, 20);
+  Append(&first, 3, 30);
+
+  // Each cache reads the other's entries before appending its own.
+  EXPECT_EQ(first.GetEntryCount(), 3u);
+  EXPECT_EQ(second.GetEntryCount(), 2u);
+  const auto value = first.Lookup(2);
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(std::vector<u8>(value->begin(), value->end()), MakeValue(2, 20));
+
+  first.Close();
+  second.Close();
+  const auto entries = ReadAll();
+  ASSERT_EQ(entries.size(), 3u);
+  EXPECT_EQ(entries.at(3), MakeValue(3, 30));
+}
+
+TEST_F(LinearDiskCacheTest, SharedCacheFollowsCompactedFile)
+{
+  Cache first;
+  first.Open(m_path, true);
+  for (u32 key = 0; key < 10; ++key)
+    Append(&first, key, 10);
+
+  // Another process replaces the file while the first one still has it open.
+  {
+    Cache second;
+    second.Open(m_path, true);
+    second.Compact();
+    Append(&second, 100, 10);
+  }
+
+  Append(&first, 200, 10);
+  first.Close();
+
+  const auto entries = ReadAll();
+  ASSERT_EQ(entries.size(), 12u);
+  EXPECT_EQ(entries.at(100), MakeValue(100, 10));
+  EXPECT_EQ(entries.at(200), MakeValue(200, 10));
+}
@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MPSCQueue.h"
+
+TEST(MPSCQueue, Simple)
+{
+  Common::MPSCQueue<u32, 16> q;
+  EXPECT_TRUE(q.Empty());
+
+  u32 v = 0;
+  EXPECT_FALSE(q.TryPop(v));
+
+  // Fill it completely, a few times over to wrap around.
+  for (u32 lap = 0; lap < 3; ++lap)
+  {
+    for (u32 i = 0; i < 16; ++i)
+      EXPECT_TRUE(q.TryPush(lap * 16 + i));
+    EXPECT_FALSE(q.TryPush(1234));
+    EXPECT_FALSE(q.Empty());
+
+    for (u32 i = 0; i < 16; ++i)
+    {
+      ASSERT_TRUE(q.TryPop(v));
+      EXPECT_EQ(lap * 16 + i, v);
+    }
+    EXPECT_TRUE(q.Empty());
+  }
+}
+
+TEST(MPSCQueue, MultiThreaded)
+{
+  struct Item
+  {
+    u32 producer;
+    u32 index;
+  };
+
+  constexpr u32 num_producers = 4;
+  constexpr u32 reps = 50000;
+
+  auto q = std::make_unique<Common::MPSCQueue<Item, 64>>();
+
+  std::vector<std::thread> producers;
+  for (u32 p = 0; p < num_producers; ++p)
+  {
+    producers.emplace_back([&q, p] {
+      for (u32 i = 0; i < reps; ++i)
+        q->Push({p, i});
+    });
+  }
+
+  // Items from each producer must arrive in the order they were pushed.
+  std::array<u32, num_producers> next_index{};
+  for (u32 received = 0; received < num_producers * reps;)
+  {
+    Item item;
+    if (!q->TryPop(item))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_LT(item.producer, num_producers);
+    EXPECT_EQ(next_index[item.producer]++, item.index);
+    ++received;
+  }
+
+  for (std::thread& t : producers)
+    t.join();
+
+  EXPECT_TRUE(q->Empty());
+  for (u32 count : next_index)
+    EXPECT_EQ(reps, count);
+}
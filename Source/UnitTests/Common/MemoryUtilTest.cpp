@@ -0,0 +1,71 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+
+// Included before gtest, whose TEST macro conflicts with XEmitter::TEST.
+#ifdef _M_X86_64
+#include "Common/x64Emitter.h"
+#endif
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr size_t SIZE = 0x10000;
+}
+
+TEST(MemoryUtil, NotDualMapped)
+{
+  u8* const ptr = static_cast<u8*>(Common::AllocateMemoryPages(SIZE));
+  ASSERT_NE(ptr, nullptr);
+  EXPECT_EQ(Common::GetWritableAliasOffset(ptr), 0);
+  EXPECT_EQ(Common::GetWritableAlias(ptr), ptr);
+  EXPECT_TRUE(Common::FreeMemoryPages(ptr, SIZE));
+}
+
+TEST(MemoryUtil, DualMappedAliasesShareMemory)
+{
+  u8* const executable = static_cast<u8*>(Common::AllocateDualMappedExecutableMemory(SIZE));
+  if (!executable)
+    GTEST_SKIP() << "Dual-mapped executable memory is unavailable on this host";
+
+  u8* const writable = Common::GetWritableAlias(executable);
+  EXPECT_NE(writable, executable);
+  EXPECT_EQ(Common::GetWritableAlias(executable + SIZE - 1), writable + SIZE - 1);
+  EXPECT_EQ(Common::GetWritableAliasOffset(executable + SIZE), 0);
+
+  constexpr u32 value = 0x12345678;
+  std::memcpy(writable + 0x1234, &value, sizeof(value));
+  u32 read_value;
+  std::memcpy(&read_value, executable + 0x1234, sizeof(read_value));
+  EXPECT_EQ(read_value, value);
+
+  EXPECT_TRUE(Common::FreeMemoryPages(executable, SIZE));
+  EXPECT_EQ(Common::GetWritableAliasOffset(executable), 0);
+}
+
+#ifdef _M_X86_64
+TEST(MemoryUtil, EmitToDualMappedMemory)
+{
+  u8* const executable = static_cast<u8*>(Common::AllocateDualMappedExecutableMemory(SIZE));
+  if (!executable)
+    GTEST_SKIP() << "Dual-mapped executable memory is unavailable on this host";
+
+  Gen::XEmitter emitter(executable, executable + SIZE);
+  emitter.MOV(32, R(Gen::ABI_RETURN), Gen::Imm32(0));
+  Gen::FixupBranch skip = emitter.J();
+  emitter.INT3();
+  emitter.SetJumpTarget(skip);
+  emitter.MOV(32, R(Gen::ABI_RETURN), Gen::Imm32(42));
+  emitter.RET();
+  ASSERT_FALSE(emitter.HasWriteFailed());
+
+  EXPECT_EQ(reinterpret_cast<u32 (*)()>(executable)(), 42u);
+
+  EXPECT_TRUE(Common::FreeMemoryPages(executable, SIZE));
+}
+#endif
@@ -0,0 +1,64 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Common/TaskScheduler.h"
+
+TEST(TaskScheduler, ParallelForCallsEveryIndexOnce)
+{
+  for (const size_t count : {0, 1, 7, 1000})
+  {
+    std::vector<std::atomic<int>> calls(count);
+    Common::ParallelFor(Common::TaskPriority::FrameBound, count, [&](size_t i) { calls[i]++; });
+
+    for (size_t i = 0; i < count; ++i)
+      EXPECT_EQ(calls[i], 1) << "index " << i << " of " << count;
+  }
+}
+
+TEST(TaskScheduler, WaitIncludesNestedTasks)
+{
+  std::atomic<int> finished = 0;
+  Common::TaskGroup group(Common::TaskPriority::Background);
+  for (int i = 0; i < 16; ++i)
+  {
+    group.Run([&] {
+      // Waiting for an inner group from a task must not deadlock, even when every worker is busy.
+      Common::TaskGroup inner(Common::TaskPriority::Background);
+      for (int j = 0; j < 4; ++j)
+        inner.Run([&] { finished++; });
+      inner.Wait();
+
+      group.Run([&] { finished++; });
+    });
+  }
+  group.Wait();
+
+  EXPECT_EQ(finished, 16 * 5);
+}
+
+TEST(TaskScheduler, HigherPriorityRunsWhileBackgroundIsBusy)
+{
+  // Occupy as many workers with background work as it is allowed to use.
+  std::atomic<bool> release = false;
+  Common::TaskGroup background(Common::TaskPriority::Background);
+  for (u32 i = 0; i < Common::GetTaskThreadBudget(); ++i)
+  {
+    background.Run([&] {
+      while (!release)
+        std::this_thread::yield();
+    });
+  }
+
+  std::atomic<int> calls = 0;
+  Common::ParallelFor(Common::TaskPriority::LatencyCritical, 64, [&](size_t) { calls++; });
+  EXPECT_EQ(calls, 64);
+
+  release = true;
+  background.Wait();
+}
@@ -265,6 +265,47 @@ TEST(CoreTiming, ChainScheduling)
   EXPECT_EQ(MAX_SLICE_LENGTH, ppc_state.downcount);
 }
 
+TEST(CoreTiming, RemoveEvent)
+{
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  CoreTiming::EventType* cb_a = core_timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_b = core_timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+  CoreTiming::EventType* cb_c = core_timing.RegisterEvent("callbackC", CallbackTemplate<2>);
+  CoreTiming::EventType* cb_d = core_timing.RegisterEvent("callbackD", CallbackTemplate<3>);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  core_timing.ScheduleEvent(500, cb_a, CB_IDS[0]);
+  core_timing.ScheduleEvent(1000, cb_b, CB_IDS[1]);
+  core_timing.ScheduleEvent(1500, cb_a, CB_IDS[0]);
+  core_timing.ScheduleEvent(2000, cb_c, CB_IDS[2]);
+  core_timing.ScheduleEvent(2500, cb_d, CB_IDS[3]);
+  EXPECT_EQ(500, ppc_state.downcount);
+
+  // Only the events scheduled before removing are removed.
+  core_timing.RemoveEvent(cb_a);
+  core_timing.ScheduleEvent(800, cb_a, CB_IDS[0]);
+
+  s_callbacks_ran_flags = 0;
+  ppc_state.downcount = 0;
+  core_timing.Advance();
+  EXPECT_EQ(0U, s_callbacks_ran_flags.to_ulong());
+  EXPECT_EQ(300, ppc_state.downcount);
+
+  AdvanceAndCheck(system, 0, 200);
+  AdvanceAndCheck(system, 1, 1000);
+  AdvanceAndCheck(system, 2, 500);
+  AdvanceAndCheck(system, 3, MAX_SLICE_LENGTH);
+}
+
 namespace ScheduleIntoPastTest
 {
 static CoreTiming::EventType* s_cb_next = nullptr;
@@ -0,0 +1,101 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
+
+namespace
+{
+constexpr u32 MAX_SAMPLES = 100;
+
+s16 ClampS16(s64 sample)
+{
+  return std::clamp<s64>(sample, -0x8000, 0x7FFF);
+}
+
+// Sample-by-sample versions of the AX mixing loops that the vector paths must match exactly.
+void ReferenceMixAdd(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                     s16* last_sample)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s16 sample = ClampS16((s64(input[i]) * volume) >> 15);
+    out[i] += sample;
+    volume += volume_delta;
+    *last_sample = sample;
+  }
+}
+
+void ReferenceApplyVolume(s16* samples, u32 count, u16& volume, u16 volume_delta,
+                          bool signed_volume)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 factor = signed_volume ? s32(s16(volume)) : s32(volume);
+    samples[i] = ClampS16((s32(samples[i]) * factor) >> 15);
+    volume += volume_delta;
+  }
+}
+}  // namespace
+
+TEST(AXMix, MixAddMatchesReference)
+{
+  std::mt19937 rng(0);
+  for (int iteration = 0; iteration < 10000; ++iteration)
+  {
+    const u32 count = rng() % MAX_SAMPLES;
+    std::array<s16, MAX_SAMPLES> input;
+    std::array<int, MAX_SAMPLES> out;
+    for (u32 i = 0; i < count; ++i)
+    {
+      input[i] = static_cast<s16>(rng());
+      out[i] = static_cast<int>(rng() % 0x20000) - 0x10000;
+    }
+    std::array<int, MAX_SAMPLES> expected_out = out;
+
+    u16 volume = static_cast<u16>(rng());
+    const u16 volume_delta = iteration % 4 == 0 ? 0 : static_cast<u16>(rng());
+    u16 expected_volume = volume;
+    s16 last_sample = 0x1234;
+    s16 expected_last_sample = last_sample;
+
+    DSP::HLE::AXMix::MixAdd(out.data(), input.data(), count, volume, volume_delta, &last_sample);
+    ReferenceMixAdd(expected_out.data(), input.data(), count, expected_volume, volume_delta,
+                    &expected_last_sample);
+
+    EXPECT_TRUE(std::equal(out.begin(), out.begin() + count, expected_out.begin()));
+    EXPECT_EQ(volume, expected_volume);
+    EXPECT_EQ(last_sample, expected_last_sample);
+  }
+}
+
+TEST(AXMix, ApplyVolumeMatchesReference)
+{
+  std::mt19937 rng(1);
+  for (int iteration = 0; iteration < 10000; ++iteration)
+  {
+    const u32 count = rng() % MAX_SAMPLES;
+    const bool signed_volume = (iteration & 1) != 0;
+    std::array<s16, MAX_SAMPLES> samples;
+    for (u32 i = 0; i < count; ++i)
+      samples[i] = static_cast<s16>(rng());
+    std::array<s16, MAX_SAMPLES> expected_samples = samples;
+
+    u16 volume = static_cast<u16>(rng());
+    const u16 volume_delta = static_cast<u16>(rng());
+    u16 expected_volume = volume;
+
+    DSP::HLE::AXMix::ApplyVolume(samples.data(), count, volume, volume_delta, signed_volume);
+    ReferenceApplyVolume(expected_samples.data(), count, expected_volume, volume_delta,
+                         signed_volume);
+
+    EXPECT_TRUE(std::equal(samples.begin(), samples.begin() + count, expected_samples.begin()));
+    EXPECT_EQ(volume, expected_volume);
+  }
+}
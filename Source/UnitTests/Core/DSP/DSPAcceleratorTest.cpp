@@ -1,7 +1,9 @@
 // Copyright 2017 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -35,6 +37,30 @@ protected:
   bool m_accov_raised = false;
 };
 
+// Simulated DSP accelerator reading from memory, which loops back to the start like AX voices.
+class MemoryTestAccelerator : public DSP::Accelerator
+{
+public:
+  explicit MemoryTestAccelerator(const std::vector<u8>& memory) : m_memory(memory) {}
+
+  u32 GetNumLoops() const { return m_num_loops; }
+
+protected:
+  void OnRawReadEndException() override {}
+  void OnRawWriteEndException() override {}
+  void OnSampleReadEndException() override
+  {
+    m_num_loops++;
+    SetYn2(GetYn2());
+  }
+  u8 ReadMemory(u32 address) override { return m_memory[address % m_memory.size()]; }
+  void WriteMemory(u32 address, u8 value) override {}
+
+private:
+  const std::vector<u8>& m_memory;
+  u32 m_num_loops = 0;
+};
+
 TEST(DSPAccelerator, Initialization)
 {
   TestAccelerator accelerator;
@@ -187,3 +213,58 @@ TEST(DSPAccelerator, CurrentAddressSkips)
   accelerator.TestRead();
   EXPECT_EQ(accelerator.GetCurrentAddress(), 0x00000013u);
 }
+
+TEST(DSPAccelerator, BlockReadsMatchSingleReads)
+{
+  std::vector<u8> memory(0x400);
+  u32 seed = 1;
+  for (u8& byte : memory)
+  {
+    seed = seed * 1103515245 + 12345;
+    byte = static_cast<u8>(seed >> 16);
+  }
+
+  std::array<s16, 16> coefs;
+  for (size_t i = 0; i < coefs.size(); ++i)
+    coefs[i] = static_cast<s16>((i % 2 == 0 ? 0x800 : -0x400) + static_cast<s16>(i * 0x40));
+
+  // ADPCM, PCM8 and PCM16, with end addresses that hit the special ADPCM looping cases. There are
+  // enough reads to loop back to the start a few times.
+  for (const u16 format : {0x00, 0x19, 0x1a})
+  {
+    for (const u32 end_address : {0x2f0u, 0x2f1u, 0x2f7u, 0x2ffu})
+    {
+      MemoryTestAccelerator single(memory);
+      MemoryTestAccelerator block(memory);
+      for (MemoryTestAccelerator* accelerator : {&single, &block})
+      {
+        accelerator->SetSampleFormat(format);
+        accelerator->SetStartAddress(0x5);
+        accelerator->SetEndAddress(end_address);
+        accelerator->SetCurrentAddress(0x2);
+        accelerator->SetPredScale(0x35);
+        accelerator->SetGain(0x1234);
+        accelerator->SetYn1(100);
+        accelerator->SetYn2(-100);
+      }
+
+      std::vector<s16> single_samples(3000);
+      for (s16& sample : single_samples)
+        sample = static_cast<s16>(single.ReadSample(coefs.data()));
+
+      std::vector<s16> block_samples(single_samples.size());
+      for (size_t i = 0, count = 1; i < block_samples.size(); i += count, count = count % 37 + 1)
+      {
+        count = std::min(count, block_samples.size() - i);
+        block.ReadSamples(coefs.data(), block_samples.data() + i, static_cast<u32>(count));
+      }
+
+      EXPECT_EQ(single_samples, block_samples);
+      EXPECT_EQ(single.GetNumLoops(), block.GetNumLoops());
+      EXPECT_EQ(single.GetCurrentAddress(), block.GetCurrentAddress());
+      EXPECT_EQ(single.GetYn1(), block.GetYn1());
+      EXPECT_EQ(single.GetYn2(), block.GetYn2());
+      EXPECT_EQ(single.GetPredScale(), block.GetPredScale());
+    }
+  }
+}
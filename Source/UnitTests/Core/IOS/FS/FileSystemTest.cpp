@@ -12,6 +12,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/MemoryBackend/FS.h"
 #include "Core/IOS/IOS.h"
 #include "UICommon/UICommon.h"
 
@@ -452,6 +453,74 @@ TEST_F(FileSystemTest, ReadDirectoryOrdering)
   EXPECT_TRUE(std::equal(result->begin(), result->end(), file_names.rbegin()));
 }
 
+TEST_F(FileSystemTest, MetadataPersistsAfterReopening)
+{
+  constexpr u8 ArbitraryAttribute = 0xE1;
+  constexpr Modes other_modes{Mode::ReadWrite, Mode::Read, Mode::None};
+
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/shared2/p", 0, modes), ResultCode::Success);
+  for (const std::string path : {"/shared2/p/a", "/shared2/p/b", "/shared2/p/c"})
+    ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, path, 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->SetMetadata(Uid{0}, "/shared2/p/a", Uid{0x1000}, Gid{1}, ArbitraryAttribute,
+                              other_modes),
+            ResultCode::Success);
+  ASSERT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/shared2/p/b"), ResultCode::Success);
+
+  m_fs.reset();
+  m_fs = IOS::HLE::Kernel{}.GetFS();
+
+  const Result<Metadata> metadata = m_fs->GetMetadata(Uid{0}, Gid{0}, "/shared2/p/a");
+  ASSERT_TRUE(metadata.Succeeded());
+  EXPECT_EQ(metadata->uid, 0x1000u);
+  EXPECT_EQ(metadata->gid, 1);
+  EXPECT_EQ(metadata->modes, other_modes);
+  EXPECT_EQ(metadata->attribute, ArbitraryAttribute);
+
+  const Result<std::vector<std::string>> files = m_fs->ReadDirectory(Uid{0}, Gid{0}, "/shared2/p");
+  ASSERT_TRUE(files.Succeeded());
+  EXPECT_EQ(*files, (std::vector<std::string>{"c", "a"}));
+}
+
+TEST_F(FileSystemTest, MemoryBackendOnlyWritesChangesOnFlush)
+{
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/shared2/a", 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/shared2/a/f", 0, modes), ResultCode::Success);
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, "/shared2/a/f", Mode::Write);
+    ASSERT_TRUE(file.Succeeded());
+    ASSERT_TRUE(file->Write("abc", 3).Succeeded());
+  }
+  m_fs.reset();
+
+  auto memory_fs = std::make_unique<MemoryFileSystem>(File::GetUserPath(D_WIIROOT_IDX));
+  {
+    const Result<FileHandle> file =
+        memory_fs->OpenFile(Uid{0}, Gid{0}, "/shared2/a/f", Mode::Read);
+    ASSERT_TRUE(file.Succeeded());
+    std::array<char, 3> data{};
+    ASSERT_TRUE(file->Read(data.data(), data.size()).Succeeded());
+    EXPECT_EQ(std::string(data.data(), data.size()), "abc");
+  }
+  ASSERT_EQ(memory_fs->Rename(Uid{0}, Gid{0}, "/shared2/a", "/shared2/b"), ResultCode::Success);
+  ASSERT_EQ(memory_fs->CreateDirectory(Uid{0}, Gid{0}, "/shared2/b/d", 0, modes),
+            ResultCode::Success);
+
+  m_fs = IOS::HLE::Kernel{}.GetFS();
+  EXPECT_TRUE(m_fs->GetMetadata(Uid{0}, Gid{0}, "/shared2/a/f").Succeeded());
+  EXPECT_EQ(m_fs->GetMetadata(Uid{0}, Gid{0}, "/shared2/b").Error(), ResultCode::NotFound);
+  m_fs.reset();
+
+  ASSERT_TRUE(memory_fs->Flush());
+  memory_fs.reset();
+
+  m_fs = IOS::HLE::Kernel{}.GetFS();
+  EXPECT_EQ(m_fs->GetMetadata(Uid{0}, Gid{0}, "/shared2/a").Error(), ResultCode::NotFound);
+  EXPECT_TRUE(m_fs->GetMetadata(Uid{0}, Gid{0}, "/shared2/b/d").Succeeded());
+  const Result<Metadata> metadata = m_fs->GetMetadata(Uid{0}, Gid{0}, "/shared2/b/f");
+  ASSERT_TRUE(metadata.Succeeded());
+  EXPECT_EQ(metadata->size, 3u);
+}
+
 TEST_F(FileSystemTest, CreateFullPath)
 {
   ASSERT_EQ(m_fs->CreateFullPath(Uid{0}, Gid{0}, "/tmp/a/b/c/d", 0, modes), ResultCode::Success);
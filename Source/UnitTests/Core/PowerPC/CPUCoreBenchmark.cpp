@@ -0,0 +1,378 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/Assembler/GekkoAssembler.h"
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
+#include "Core/MemTools.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+// Runs short PowerPC snippets under every CPU core available on the host. The regular test checks
+// that all cores end up in the same state as the interpreter. The disabled benchmark reports the
+// time per guest instruction and the size of the emitted code, so that changes to a JIT can be
+// evaluated without booting a game. Run it with:
+//   tests --gtest_also_run_disabled_tests --gtest_filter=CPUCoreBenchmark.*
+
+namespace
+{
+constexpr u32 CODE_ADDRESS = 0x00003000;
+constexpr u32 DATA_ADDRESS = 0x00100000;
+constexpr u32 DATA_SIZE = 0x40;
+
+// The longest slice CoreTiming runs, so that checking for the end of a run doesn't make the CPU
+// core leave its dispatcher any more often than it would anyway.
+constexpr s64 CHECK_PERIOD = 20000;
+
+struct Snippet
+{
+  const char* name;
+  // Runs once per iteration of the loop, must not touch CTR.
+  const char* body;
+  // Placed in front of the loop, for the body to call. Every instruction of the body and of its
+  // functions must run exactly once per iteration.
+  const char* functions = "";
+};
+
+constexpr std::array<Snippet, 5> SNIPPETS{{
+    {"integer", "add r3, r3, r4\n"
+                "rlwinm r5, r3, 3, 0, 28\n"
+                "xor r6, r5, r4\n"
+                "subf r7, r6, r3\n"
+                "mullw r8, r7, r4\n"
+                "srawi r9, r8, 4\n"
+                "addic r4, r4, 1\n"
+                "adde r10, r9, r6\n"
+                "cmpw r10, r3\n"
+                "mfcr r11\n"},
+    {"floating point", "fmadd f9, f1, f2, f3\n"
+                       "fmuls f10, f9, f2\n"
+                       "fsub f11, f10, f3\n"
+                       "fadds f12, f11, f1\n"
+                       "fnmsub f13, f12, f4, f5\n"
+                       "fdiv f14, f13, f6\n"
+                       "fctiwz f15, f14\n"
+                       "fcmpu cr1, f14, f13\n"},
+    {"paired single", "ps_madd f9, f1, f2, f3\n"
+                      "ps_mul f10, f9, f2\n"
+                      "ps_sum0 f11, f10, f9, f3\n"
+                      "ps_merge10 f12, f11, f10\n"
+                      "ps_add f13, f12, f1\n"
+                      "ps_muls0 f14, f13, f5\n"
+                      "ps_nmsub f15, f14, f6, f7\n"},
+    {"load/store", "lwz r3, 0(r31)\n"
+                   "addi r3, r3, 1\n"
+                   "stw r3, 4(r31)\n"
+                   "lhz r4, 8(r31)\n"
+                   "sth r4, 12(r31)\n"
+                   "lbz r5, 3(r31)\n"
+                   "stb r5, 14(r31)\n"
+                   "lfd f1, 16(r31)\n"
+                   "stfd f1, 24(r31)\n"
+                   "lfs f2, 32(r31)\n"
+                   "stfs f2, 36(r31)\n"
+                   "psq_l f3, 40(r31), 0, 0\n"
+                   "psq_st f3, 48(r31), 0, 0\n"
+                   "lwzx r6, r31, r30\n"
+                   "stwx r6, r31, r29\n"},
+    {"branch", "cmpw r3, r4\n"
+               "bne 0f\n"
+               "0:\n"
+               "bl leaf\n"
+               "andi. r7, r4, 1\n"
+               "beq 0f\n"
+               "0:\n"
+               "addi r4, r4, 1\n"
+               "cmplw cr1, r4, r5\n"
+               "bge cr1, 0f\n"
+               "0:\n",
+     "leaf:\n"
+     "addi r6, r6, 1\n"
+     "rlwinm r6, r6, 0, 16, 31\n"
+     "blr\n"},
+}};
+
+std::vector<PowerPC::CPUCore> GetAvailableCores()
+{
+  std::vector<PowerPC::CPUCore> cores{PowerPC::CPUCore::Interpreter,
+                                      PowerPC::CPUCore::CachedInterpreter};
+#ifdef _M_X86_64
+  cores.push_back(PowerPC::CPUCore::JIT64);
+#endif
+#ifdef _M_ARM_64
+  cores.push_back(PowerPC::CPUCore::JITARM64);
+#endif
+  return cores;
+}
+
+const char* GetCoreName(PowerPC::CPUCore core)
+{
+  switch (core)
+  {
+  case PowerPC::CPUCore::Interpreter:
+    return "Interpreter";
+  case PowerPC::CPUCore::JIT64:
+    return "JIT64";
+  case PowerPC::CPUCore::JITARM64:
+    return "JITARM64";
+  case PowerPC::CPUCore::CachedInterpreter:
+    return "CachedInterpreter";
+  }
+  return "Unknown";
+}
+
+struct RunResult
+{
+  std::array<u32, 32> gpr{};
+  std::array<u64, 64> fpr{};
+  u32 cr = 0;
+  std::array<u8, DATA_SIZE> data{};
+
+  u64 guest_instructions = 0;
+  DT host_time{};
+  // Size of the host code emitted for all blocks, zero for the interpreter.
+  size_t code_size = 0;
+};
+
+CoreTiming::EventType* s_check_event = nullptr;
+u32 s_end_address = 0;
+u64 s_tick_limit = 0;
+std::optional<TimePoint> s_end_time;
+
+void CheckForEnd(Core::System& system, u64, s64 cycles_late)
+{
+  auto& core_timing = system.GetCoreTiming();
+  if (system.GetPPCState().pc == s_end_address || core_timing.GetTicks() > s_tick_limit)
+  {
+    if (system.GetPPCState().pc == s_end_address)
+      s_end_time = Clock::now();
+    system.GetCPU().Break();
+    return;
+  }
+  core_timing.ScheduleEvent(CHECK_PERIOD - cycles_late, s_check_event);
+}
+
+class CPUCoreRunner final
+{
+public:
+  explicit CPUCoreRunner(Core::System& system)
+      : m_system(system), m_profile_path(File::CreateTempDir())
+  {
+    if (!UserDirectoryExists())
+      return;
+
+    Core::DeclareAsCPUThread();
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    EMM::InstallExceptionHandler();
+  }
+  ~CPUCoreRunner()
+  {
+    if (!UserDirectoryExists())
+      return;
+
+    EMM::UninstallExceptionHandler();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+  bool UserDirectoryExists() const { return !m_profile_path.empty(); }
+
+  std::optional<RunResult> Run(PowerPC::CPUCore core, const Snippet& snippet, u32 iterations)
+  {
+    // The loop ends in an idle loop, which the JITs skip straight to the next CheckForEnd.
+    const std::string source =
+        fmt::format("{}loop:\n{}bdnz loop\ndone:\nb done\n", snippet.functions, snippet.body);
+    const auto code = Assemble(snippet.name, source);
+    const auto functions = Assemble(snippet.name, snippet.functions);
+    if (!code || !functions)
+      return std::nullopt;
+
+    const u32 entry_address = CODE_ADDRESS + static_cast<u32>(functions->size());
+    const u32 end_address = CODE_ADDRESS + static_cast<u32>(code->size()) - 4;
+
+    auto& core_timing = m_system.GetCoreTiming();
+    auto& memory = m_system.GetMemory();
+    auto& cpu = m_system.GetCPU();
+    auto& ppc_state = m_system.GetPPCState();
+
+    core_timing.Init();
+    memory.Init();
+    cpu.Init(core);
+    s_check_event = core_timing.RegisterEvent("CPUCoreBenchmarkCheck", CheckForEnd);
+
+    memory.CopyToEmu(CODE_ADDRESS, code->data(), code->size());
+    InitializeState(iterations, entry_address);
+
+    RunResult result;
+    result.guest_instructions = u64{iterations} * ((code->size() - 4) / 4);
+
+    s_end_address = end_address;
+    s_tick_limit = result.guest_instructions * 100 + CHECK_PERIOD;
+    s_end_time.reset();
+    core_timing.ScheduleEvent(CHECK_PERIOD, s_check_event);
+
+    cpu.SetStepping(false);
+    const TimePoint start_time = Clock::now();
+    m_system.GetPowerPC().RunLoop();
+
+    const bool finished = s_end_time.has_value();
+    EXPECT_TRUE(finished) << snippet.name << " didn't finish on " << GetCoreName(core);
+    if (finished)
+      result.host_time = *s_end_time - start_time;
+
+    for (size_t i = 0; i < result.gpr.size(); ++i)
+      result.gpr[i] = ppc_state.gpr[i];
+    for (size_t i = 0; i < std::size(ppc_state.ps); ++i)
+    {
+      result.fpr[i * 2] = ppc_state.ps[i].PS0AsU64();
+      result.fpr[i * 2 + 1] = ppc_state.ps[i].PS1AsU64();
+    }
+    result.cr = ppc_state.cr.Get();
+    memory.CopyFromEmu(result.data.data(), DATA_ADDRESS, result.data.size());
+
+    {
+      Core::CPUThreadGuard guard(m_system);
+      m_system.GetJitInterface().RunOnBlocks(guard, [&result](const JitBlock& block) {
+        result.code_size += static_cast<size_t>(block.near_end - block.near_begin) +
+                            static_cast<size_t>(block.far_end - block.far_begin);
+      });
+    }
+
+    cpu.Shutdown();
+    memory.Shutdown();
+    core_timing.Shutdown();
+
+    if (!finished)
+      return std::nullopt;
+    return result;
+  }
+
+private:
+  static std::optional<std::vector<u8>> Assemble(const char* name, const std::string& source)
+  {
+    auto result = Common::GekkoAssembler::Assemble(source, CODE_ADDRESS);
+    if (Common::GekkoAssembler::IsFailure(result))
+    {
+      ADD_FAILURE() << "Failed to assemble " << name << ": "
+                    << Common::GekkoAssembler::GetFailure(result).message;
+      return std::nullopt;
+    }
+
+    auto& blocks = Common::GekkoAssembler::GetT(result);
+    if (blocks.empty())
+      return std::vector<u8>{};
+    EXPECT_EQ(blocks.size(), 1u);
+    return std::move(blocks[0].instructions);
+  }
+
+  void InitializeState(u32 iterations, u32 entry_address)
+  {
+    auto& memory = m_system.GetMemory();
+    auto& ppc_state = m_system.GetPPCState();
+
+    memory.Write_U32(0x12345678, DATA_ADDRESS);
+    memory.Write_U32(0x0000abcd, DATA_ADDRESS + 8);
+    memory.Write_U64(std::bit_cast<u64>(1.5), DATA_ADDRESS + 16);
+    memory.Write_U32(std::bit_cast<u32>(2.5f), DATA_ADDRESS + 32);
+    memory.Write_U32(std::bit_cast<u32>(0.75f), DATA_ADDRESS + 40);
+    memory.Write_U32(std::bit_cast<u32>(-3.0f), DATA_ADDRESS + 44);
+    memory.Write_U32(0xdeadbeef, DATA_ADDRESS + 56);
+
+    for (u32 i = 0; i < 32; ++i)
+    {
+      ppc_state.gpr[i] = i * 0x01234567 + 1;
+      ppc_state.ps[i].SetBoth(1.0 + i * 0.25, 0.5 - i * 0.125);
+    }
+    ppc_state.gpr[29] = 60;
+    ppc_state.gpr[30] = 56;
+    ppc_state.gpr[31] = DATA_ADDRESS;
+
+    CTR(ppc_state) = iterations;
+    ppc_state.msr.FP = 1;
+    HID2(ppc_state).PSE = 1;
+    HID2(ppc_state).LSQE = 1;
+    ppc_state.pc = entry_address;
+    ppc_state.npc = entry_address;
+    PowerPC::MSRUpdated(ppc_state);
+    PowerPC::RoundingModeUpdated(ppc_state);
+  }
+
+  Core::System& m_system;
+  std::string m_profile_path;
+};
+}  // namespace
+
+TEST(CPUCoreBenchmark, CoresMatchInterpreter)
+{
+  CPUCoreRunner runner(Core::System::GetInstance());
+  ASSERT_TRUE(runner.UserDirectoryExists());
+
+  constexpr u32 ITERATIONS = 1000;
+  for (const Snippet& snippet : SNIPPETS)
+  {
+    const auto expected = runner.Run(PowerPC::CPUCore::Interpreter, snippet, ITERATIONS);
+    ASSERT_TRUE(expected.has_value()) << snippet.name;
+
+    for (const PowerPC::CPUCore core : GetAvailableCores())
+    {
+      if (core == PowerPC::CPUCore::Interpreter)
+        continue;
+
+      const auto actual = runner.Run(core, snippet, ITERATIONS);
+      ASSERT_TRUE(actual.has_value()) << snippet.name << " on " << GetCoreName(core);
+      EXPECT_EQ(actual->gpr, expected->gpr) << snippet.name << " on " << GetCoreName(core);
+      EXPECT_EQ(actual->fpr, expected->fpr) << snippet.name << " on " << GetCoreName(core);
+      EXPECT_EQ(actual->cr, expected->cr) << snippet.name << " on " << GetCoreName(core);
+      EXPECT_EQ(actual->data, expected->data) << snippet.name << " on " << GetCoreName(core);
+    }
+  }
+}
+
+TEST(CPUCoreBenchmark, DISABLED_Benchmark)
+{
+  CPUCoreRunner runner(Core::System::GetInstance());
+  ASSERT_TRUE(runner.UserDirectoryExists());
+
+  constexpr u32 ITERATIONS = 2'000'000;
+  fmt::print("{:<16} {:<18} {:>12} {:>12}\n", "Snippet", "Core", "ns/instr", "Code bytes");
+  for (const Snippet& snippet : SNIPPETS)
+  {
+    for (const PowerPC::CPUCore core : GetAvailableCores())
+    {
+      const auto result = runner.Run(core, snippet, ITERATIONS);
+      if (!result)
+        continue;
+
+      const double ns_per_instruction =
+          std::chrono::duration<double, std::nano>(result->host_time).count() /
+          result->guest_instructions;
+      fmt::print("{:<16} {:<18} {:>12.3f} {:>12}\n", snippet.name, GetCoreName(core),
+                 ns_per_instruction, result->code_size);
+    }
+  }
+}
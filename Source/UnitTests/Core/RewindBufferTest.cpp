@@ -0,0 +1,107 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+namespace
+{
+std::vector<u8> MakeState(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::vector<u8> state(size);
+  std::ranges::generate(state, [&] { return static_cast<u8>(rng()); });
+  return state;
+}
+
+std::vector<u8> PopState(State::RewindBuffer& rewind_buffer)
+{
+  Common::UniqueBuffer<u8> buffer;
+  EXPECT_TRUE(rewind_buffer.Pop(buffer));
+  return std::vector<u8>(buffer.begin(), buffer.end());
+}
+}  // namespace
+
+TEST(RewindBuffer, RoundTrip)
+{
+  State::RewindBuffer rewind_buffer(64 << 20);
+
+  const std::vector<u8> first = MakeState(1 << 20, 1);
+  const std::vector<u8> second = MakeState(100, 2);
+  const std::vector<u8> third = MakeState((1 << 20) + 12345, 3);
+  rewind_buffer.Push(first);
+  rewind_buffer.Push(second);
+  rewind_buffer.Push(third);
+  EXPECT_EQ(rewind_buffer.GetNumSnapshots(), 3u);
+
+  EXPECT_EQ(PopState(rewind_buffer), third);
+  EXPECT_EQ(PopState(rewind_buffer), second);
+  EXPECT_EQ(PopState(rewind_buffer), first);
+
+  Common::UniqueBuffer<u8> buffer;
+  EXPECT_FALSE(rewind_buffer.Pop(buffer));
+  EXPECT_EQ(rewind_buffer.GetMemoryUsage(), 0u);
+}
+
+TEST(RewindBuffer, SharesUnchangedData)
+{
+  State::RewindBuffer rewind_buffer(64 << 20);
+
+  std::vector<u8> state = MakeState(4 << 20, 4);
+  rewind_buffer.Push(state);
+  const size_t first_usage = rewind_buffer.GetMemoryUsage();
+
+  // A small modification, plus a few bytes inserted near the start, which shifts everything
+  // after it
+  state[(2 << 20) + 17] ^= 0xFF;
+  state.insert(state.begin() + 1000, {1, 2, 3});
+  rewind_buffer.Push(state);
+
+  const size_t second_usage = rewind_buffer.GetMemoryUsage() - first_usage;
+  EXPECT_LT(second_usage, 4 * State::RewindBuffer::MAX_CHUNK_SIZE);
+
+  EXPECT_EQ(PopState(rewind_buffer), state);
+}
+
+TEST(RewindBuffer, EnforcesMemoryBudget)
+{
+  State::RewindBuffer rewind_buffer(3 << 20);
+
+  for (u32 i = 0; i < 10; ++i)
+    rewind_buffer.Push(MakeState(1 << 20, i));
+
+  EXPECT_LE(rewind_buffer.GetMemoryUsage(), 3u << 20);
+  EXPECT_EQ(rewind_buffer.GetNumSnapshots(), 2u);
+  EXPECT_EQ(PopState(rewind_buffer), MakeState(1 << 20, 9));
+
+  // The newest snapshot is kept even if it's bigger than the budget
+  rewind_buffer.SetMemoryBudget(0);
+  EXPECT_EQ(rewind_buffer.GetNumSnapshots(), 1u);
+  EXPECT_EQ(PopState(rewind_buffer), MakeState(1 << 20, 8));
+}
+
+TEST(RewindBuffer, GetKeepsSnapshots)
+{
+  State::RewindBuffer rewind_buffer(64 << 20);
+
+  const std::vector<u8> first = MakeState(1 << 20, 10);
+  const std::vector<u8> second = MakeState(1 << 20, 11);
+  rewind_buffer.Push(first);
+  rewind_buffer.Push(second);
+
+  Common::UniqueBuffer<u8> buffer;
+  ASSERT_TRUE(rewind_buffer.Get(0, buffer));
+  EXPECT_EQ(std::vector<u8>(buffer.begin(), buffer.end()), first);
+  EXPECT_FALSE(rewind_buffer.Get(2, buffer));
+  EXPECT_EQ(rewind_buffer.GetNumSnapshots(), 2u);
+
+  EXPECT_EQ(PopState(rewind_buffer), second);
+  EXPECT_EQ(PopState(rewind_buffer), first);
+}
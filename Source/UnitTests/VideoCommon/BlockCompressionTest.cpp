@@ -0,0 +1,130 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/Assets/BlockCompression.h"
+
+namespace
+{
+std::array<s32, 3> DecodeRGB565(u16 color)
+{
+  const s32 r = color >> 11;
+  const s32 g = (color >> 5) & 0x3f;
+  const s32 b = color & 0x1f;
+  return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+// Decodes the color of one pixel of a block in 4-color mode
+std::array<s32, 3> DecodeColor(const u8* block, u32 pixel)
+{
+  u16 color0;
+  u16 color1;
+  u32 indices;
+  std::memcpy(&color0, block, sizeof(color0));
+  std::memcpy(&color1, block + 2, sizeof(color1));
+  std::memcpy(&indices, block + 4, sizeof(indices));
+  EXPECT_GE(color0, color1);
+
+  const std::array<s32, 3> c0 = DecodeRGB565(color0);
+  const std::array<s32, 3> c1 = DecodeRGB565(color1);
+  std::array<s32, 3> result;
+  for (int i = 0; i < 3; i++)
+  {
+    const std::array<s32, 4> palette{c0[i], c1[i], (2 * c0[i] + c1[i]) / 3,
+                                     (c0[i] + 2 * c1[i]) / 3};
+    result[i] = palette[(indices >> (pixel * 2)) & 3];
+  }
+  return result;
+}
+
+s32 DecodeAlpha(const u8* block, u32 pixel)
+{
+  u64 indices = 0;
+  for (int i = 0; i < 6; i++)
+    indices |= u64{block[2 + i]} << (i * 8);
+
+  const s32 alpha0 = block[0];
+  const s32 alpha1 = block[1];
+  const u32 index = (indices >> (pixel * 3)) & 7;
+  if (index < 2)
+    return index == 0 ? alpha0 : alpha1;
+  return ((8 - index) * alpha0 + (index - 1) * alpha1) / 7;
+}
+}  // namespace
+
+TEST(BlockCompression, SolidColor)
+{
+  std::vector<u8> image(4 * 4 * 4);
+  for (size_t i = 0; i < image.size(); i += 4)
+  {
+    image[i] = 255;
+    image[i + 1] = 0;
+    image[i + 2] = 255;
+    image[i + 3] = 255;
+  }
+
+  std::array<u8, 8> block;
+  VideoCommon::EncodeBC1(image.data(), 4, 4, 4, block.data());
+  for (u32 pixel = 0; pixel < 16; pixel++)
+    EXPECT_EQ(DecodeColor(block.data(), pixel), (std::array<s32, 3>{255, 0, 255}));
+}
+
+TEST(BlockCompression, Gradient)
+{
+  // Two blocks, so that the blocks are checked to be stored in order. Each of them only varies
+  // along one axis, which the 4 colors of a block can represent well.
+  constexpr u32 width = 8;
+  std::vector<u8> image(width * 4 * 4);
+  for (u32 y = 0; y < 4; y++)
+  {
+    for (u32 x = 0; x < width; x++)
+    {
+      u8* pixel = &image[(y * width + x) * 4];
+      const u32 t = x * 16 + y * 4;
+      pixel[0] = static_cast<u8>(t);
+      pixel[1] = static_cast<u8>(255 - t);
+      pixel[2] = 128;
+      pixel[3] = 255;
+    }
+  }
+
+  std::array<u8, 16> blocks;
+  VideoCommon::EncodeBC1(image.data(), width, 4, width, blocks.data());
+  for (u32 y = 0; y < 4; y++)
+  {
+    for (u32 x = 0; x < width; x++)
+    {
+      const u8* pixel = &image[(y * width + x) * 4];
+      const std::array<s32, 3> decoded = DecodeColor(&blocks[(x / 4) * 8], y * 4 + x % 4);
+      for (int i = 0; i < 3; i++)
+        EXPECT_LE(std::abs(decoded[i] - pixel[i]), 16) << "at " << x << "," << y;
+    }
+  }
+}
+
+TEST(BlockCompression, Alpha)
+{
+  // A 2x2 image, which is padded to a whole block from its edges
+  const std::array<u8, 16> image{0, 0, 0, 0,   0, 0, 0, 85,  //
+                                 0, 0, 0, 170, 0, 0, 0, 255};
+
+  std::array<u8, 16> block;
+  VideoCommon::EncodeBC3(image.data(), 2, 2, 2, block.data());
+  for (u32 y = 0; y < 4; y++)
+  {
+    for (u32 x = 0; x < 4; x++)
+    {
+      const s32 expected = image[(std::min(y, 1u) * 2 + std::min(x, 1u)) * 4 + 3];
+      EXPECT_LE(std::abs(DecodeAlpha(block.data(), y * 4 + x) - expected), 19);
+      EXPECT_EQ(DecodeColor(block.data() + 8, y * 4 + x), (std::array<s32, 3>{0, 0, 0}));
+    }
+  }
+}
@@ -0,0 +1,48 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "VideoCommon/FrameTimeHistogram.h"
+
+using namespace std::chrono_literals;
+
+TEST(FrameTimeHistogram, Empty)
+{
+  FrameTimeHistogram histogram;
+  EXPECT_EQ(histogram.GetCount(), 0u);
+  EXPECT_EQ(histogram.GetPercentile(0.99), DT::zero());
+}
+
+TEST(FrameTimeHistogram, Percentiles)
+{
+  FrameTimeHistogram histogram;
+  for (int i = 0; i < 990; ++i)
+    histogram.Push(16ms);
+  for (int i = 0; i < 9; ++i)
+    histogram.Push(33ms);
+  histogram.Push(50ms);
+
+  EXPECT_EQ(histogram.GetCount(), 1000u);
+  EXPECT_EQ(histogram.GetMax(), DT(50ms));
+  EXPECT_EQ(histogram.GetPercentile(0.5), DT(16100us));
+  EXPECT_EQ(histogram.GetPercentile(0.99), DT(16100us));
+  EXPECT_EQ(histogram.GetPercentile(0.995), DT(33100us));
+  EXPECT_EQ(histogram.GetPercentile(1.0), DT(50ms));
+}
+
+TEST(FrameTimeHistogram, Overflow)
+{
+  FrameTimeHistogram histogram;
+  histogram.Push(1ms);
+  histogram.Push(2s);
+
+  EXPECT_EQ(histogram.GetPercentile(1.0), DT(2s));
+  EXPECT_EQ(histogram.GetTotal(), DT(2001ms));
+
+  histogram.Reset();
+  EXPECT_EQ(histogram.GetCount(), 0u);
+  EXPECT_EQ(histogram.GetMax(), DT::zero());
+}
@@ -0,0 +1,70 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/TextureEncoder.h"
+#include "VideoCommon/BPMemory.h"
+
+namespace
+{
+constexpr u32 EFB_STRIDE = 640 * 3;
+
+struct EncoderTestCase
+{
+  PixelFormat efb_format;
+  EFBCopyFormat copy_format;
+  bool yuv;
+};
+
+constexpr EncoderTestCase ENCODER_TEST_CASES[] = {
+    {PixelFormat::RGBA6_Z24, EFBCopyFormat::RGBA8, false},
+    {PixelFormat::RGB8_Z24, EFBCopyFormat::RGBA8, false},
+    {PixelFormat::RGB565_Z16, EFBCopyFormat::RGBA8, false},
+    {PixelFormat::Z24, EFBCopyFormat::RGBA8, false},
+    {PixelFormat::RGB8_Z24, EFBCopyFormat::R8, true},
+    {PixelFormat::RGB565_Z16, EFBCopyFormat::R8_0x1, true},
+};
+}  // namespace
+
+TEST(SWTextureEncoder, VectorizedMatchesGeneric)
+{
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> byte_distribution(0, 255);
+
+  // Enough rows for the largest copy, plus a block of slack for the reads past its bottom edge
+  std::vector<u8> efb(EFB_STRIDE * 68);
+  for (u8& byte : efb)
+    byte = static_cast<u8>(byte_distribution(rng));
+
+  for (const EncoderTestCase& test_case : ENCODER_TEST_CASES)
+  {
+    for (const auto& [width, height] : {std::pair{4u, 4u}, {8u, 4u}, {64u, 64u}, {13u, 7u},
+                                        {1u, 1u}, {31u, 17u}, {640u, 4u}})
+    {
+      SCOPED_TRACE(fmt::format("EFB format {}, copy format {}, {}x{}", test_case.efb_format,
+                               static_cast<int>(test_case.copy_format), width, height));
+
+      bpmem.copyTexSrcWH.x = width - 1;
+      bpmem.copyTexSrcWH.y = height - 1;
+      bpmem.triggerEFBCopy.half_scale = false;
+      // Room for a row of blocks of the widest format, at 64 bytes per block of 4 pixels
+      bpmem.copyDestStride = (width + 3) / 4 * 2;
+
+      const u32 dst_size = ((height + 3) / 4 + 1) * (bpmem.copyDestStride << 5);
+      std::vector<u8> expected(dst_size, 0xcd);
+      std::vector<u8> actual(dst_size, 0xcd);
+      TextureEncoder::EncodeEfbPixels(expected.data(), efb.data(), test_case.efb_format,
+                                      test_case.copy_format, test_case.yuv, false, false);
+      TextureEncoder::EncodeEfbPixels(actual.data(), efb.data(), test_case.efb_format,
+                                      test_case.copy_format, test_case.yuv, false, true);
+      EXPECT_EQ(expected, actual);
+    }
+  }
+}
@@ -0,0 +1,265 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/SWTexture.h"
+#include "VideoBackends/Software/SWEfbInterface.h"
+#include "VideoBackends/Software/TextureEncoder.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/TextureCacheBase.h"
+#include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VideoCommon.h"
+
+// Checks that the bulk texture decoders produce the same texels as the per-texel reference
+// decoder, for every implementation the host can run. The disabled benchmarks report the
+// throughput of each decoder implementation and of the software EFB copy encoder. Run them with:
+//   tests --gtest_also_run_disabled_tests --gtest_filter=TextureCodecBenchmark.*
+
+namespace
+{
+struct DecodeFormat
+{
+  TextureFormat format;
+  TLUTFormat tlut_format = TLUTFormat::IA8;
+};
+
+constexpr std::array<DecodeFormat, 17> DECODE_FORMATS{{
+    {TextureFormat::I4},
+    {TextureFormat::I8},
+    {TextureFormat::IA4},
+    {TextureFormat::IA8},
+    {TextureFormat::RGB565},
+    {TextureFormat::RGB5A3},
+    {TextureFormat::RGBA8},
+    {TextureFormat::C4, TLUTFormat::IA8},
+    {TextureFormat::C4, TLUTFormat::RGB565},
+    {TextureFormat::C4, TLUTFormat::RGB5A3},
+    {TextureFormat::C8, TLUTFormat::IA8},
+    {TextureFormat::C8, TLUTFormat::RGB565},
+    {TextureFormat::C8, TLUTFormat::RGB5A3},
+    {TextureFormat::C14X2, TLUTFormat::IA8},
+    {TextureFormat::C14X2, TLUTFormat::RGB565},
+    {TextureFormat::C14X2, TLUTFormat::RGB5A3},
+    {TextureFormat::CMPR},
+}};
+
+// The decoder implementations _TexDecoder_DecodeImpl picks between on this host.
+struct DecoderImplementation
+{
+  const char* name;
+  bool ssse3;
+};
+
+std::vector<DecoderImplementation> GetDecoderImplementations()
+{
+#ifdef _M_X86_64
+  std::vector<DecoderImplementation> implementations{{"SSE2", false}};
+  if (cpu_info.bSSSE3)
+    implementations.push_back({"SSSE3", true});
+  return implementations;
+#else
+  return {{"Generic", false}};
+#endif
+}
+
+// Makes the texture decoder use the given implementation for as long as it is alive.
+class ScopedDecoderImplementation final
+{
+public:
+  explicit ScopedDecoderImplementation(const DecoderImplementation& implementation)
+      : m_ssse3(cpu_info.bSSSE3)
+  {
+#ifdef _M_X86_64
+    cpu_info.bSSSE3 = implementation.ssse3;
+#endif
+  }
+  ~ScopedDecoderImplementation() { cpu_info.bSSSE3 = m_ssse3; }
+
+  ScopedDecoderImplementation(const ScopedDecoderImplementation&) = delete;
+  ScopedDecoderImplementation& operator=(const ScopedDecoderImplementation&) = delete;
+
+private:
+  bool m_ssse3;
+};
+
+std::string GetFormatName(const DecodeFormat& format)
+{
+  if (IsColorIndexed(format.format))
+    return fmt::format("{}/{}", format.format, format.tlut_format);
+  return fmt::format("{}", format.format);
+}
+
+std::vector<u8> MakeRandomData(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::vector<u8> data(size);
+  std::ranges::generate(data, [&] { return static_cast<u8>(rng()); });
+  return data;
+}
+
+double GetGigabytesPerSecond(size_t bytes, DT time)
+{
+  return bytes / std::chrono::duration<double>(time).count() / 1e9;
+}
+
+// Repeats f until it has run for a while, and returns the average time it took.
+template <typename F>
+DT TimeRepeatedly(F f)
+{
+  constexpr DT MIN_TIME = std::chrono::milliseconds(200);
+
+  u32 runs = 0;
+  const TimePoint start = Clock::now();
+  DT elapsed{};
+  do
+  {
+    f();
+    ++runs;
+    elapsed = Clock::now() - start;
+  } while (elapsed < MIN_TIME);
+  return elapsed / runs;
+}
+}  // namespace
+
+TEST(TextureCodecBenchmark, DecodersMatchTexelDecoder)
+{
+  constexpr int WIDTH = 128;
+  constexpr int HEIGHT = 64;
+
+  const std::vector<u8> tlut = MakeRandomData(TexDecoder_GetPaletteSize(TextureFormat::C14X2), 0);
+
+  u32 seed = 1;
+  for (const DecodeFormat& format : DECODE_FORMATS)
+  {
+    const std::vector<u8> src =
+        MakeRandomData(TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, format.format), seed++);
+
+    std::vector<u8> expected(WIDTH * HEIGHT * 4);
+    for (int t = 0; t < HEIGHT; ++t)
+    {
+      for (int s = 0; s < WIDTH; ++s)
+      {
+        // Like the texture registers, the texel decoder takes the width minus one.
+        TexDecoder_DecodeTexel(&expected[(t * WIDTH + s) * 4], src, s, t, WIDTH - 1, format.format,
+                               tlut, format.tlut_format);
+      }
+    }
+
+    for (const DecoderImplementation& implementation : GetDecoderImplementations())
+    {
+      ScopedDecoderImplementation scoped_implementation(implementation);
+
+      std::vector<u8> decoded(WIDTH * HEIGHT * 4);
+      TexDecoder_Decode(decoded.data(), src.data(), WIDTH, HEIGHT, format.format, tlut.data(),
+                        format.tlut_format);
+
+      EXPECT_EQ(decoded, expected) << GetFormatName(format) << " with " << implementation.name;
+    }
+  }
+}
+
+TEST(TextureCodecBenchmark, DISABLED_Decode)
+{
+  constexpr int WIDTH = 1024;
+  constexpr int HEIGHT = 1024;
+
+  const std::vector<u8> tlut = MakeRandomData(TexDecoder_GetPaletteSize(TextureFormat::C14X2), 0);
+  std::vector<u8> decoded(WIDTH * HEIGHT * 4);
+
+  // Throughput is in decoded RGBA8 bytes, so that it is comparable between formats.
+  fmt::print("{:<24} {:<10} {:>10}\n", "Format", "Decoder", "GB/s");
+  u32 seed = 1;
+  for (const DecodeFormat& format : DECODE_FORMATS)
+  {
+    const std::vector<u8> src =
+        MakeRandomData(TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, format.format), seed++);
+
+    for (const DecoderImplementation& implementation : GetDecoderImplementations())
+    {
+      ScopedDecoderImplementation scoped_implementation(implementation);
+
+      const DT time = TimeRepeatedly([&] {
+        TexDecoder_Decode(decoded.data(), src.data(), WIDTH, HEIGHT, format.format, tlut.data(),
+                          format.tlut_format);
+      });
+      fmt::print("{:<24} {:<10} {:>10.2f}\n", GetFormatName(format), implementation.name,
+                 GetGigabytesPerSecond(decoded.size(), time));
+    }
+  }
+}
+
+TEST(TextureCodecBenchmark, DISABLED_Encode)
+{
+  struct EncodeSource
+  {
+    const char* name;
+    PixelFormat efb_format;
+    bool depth;
+    std::vector<EFBCopyFormat> copy_formats;
+  };
+
+  const std::vector<EFBCopyFormat> color_formats{
+      EFBCopyFormat::R4,     EFBCopyFormat::R8,     EFBCopyFormat::RA4, EFBCopyFormat::RA8,
+      EFBCopyFormat::RGB565, EFBCopyFormat::RGB5A3, EFBCopyFormat::RGBA8, EFBCopyFormat::A8,
+      EFBCopyFormat::G8,     EFBCopyFormat::B8,     EFBCopyFormat::RG8, EFBCopyFormat::GB8,
+  };
+  const std::vector<EFBCopyFormat> depth_formats{
+      EFBCopyFormat::R4, EFBCopyFormat::R8,  EFBCopyFormat::RGBA8, EFBCopyFormat::G8,
+      EFBCopyFormat::B8, EFBCopyFormat::RG8, EFBCopyFormat::GB8,
+  };
+  const std::array<EncodeSource, 3> sources{{
+      {"RGBA6", PixelFormat::RGBA6_Z24, false, color_formats},
+      {"RGB8", PixelFormat::RGB8_Z24, false, color_formats},
+      {"Z24", PixelFormat::Z24, true, depth_formats},
+  }};
+
+  // Fill both the color and the depth buffer of the software EFB.
+  const std::vector<u8> efb_contents = MakeRandomData(EFB_WIDTH * EFB_HEIGHT * 6, 0);
+  std::ranges::copy(efb_contents, EfbInterface::GetPixelPointer(0, 0, false));
+
+  SW::SWStagingTexture dst(StagingTextureType::Readback,
+                           TextureConfig(EFB_WIDTH * 4, 1024, 1, 1, 1, AbstractTextureFormat::BGRA8,
+                                         0, AbstractTextureType::Texture_2DArray));
+  const MathUtil::Rectangle<int> src_rect(0, 0, EFB_WIDTH, EFB_HEIGHT);
+
+  // Throughput is in EFB pixels read, as 4 bytes each.
+  fmt::print("{:<8} {:<8} {:>10}\n", "EFB", "Copy", "GB/s");
+  for (const EncodeSource& source : sources)
+  {
+    for (const EFBCopyFormat copy_format : source.copy_formats)
+    {
+      const TextureFormat base_format = TexDecoder_GetEFBCopyBaseFormat(copy_format);
+      const u32 block_height = TexDecoder_GetEFBCopyBlockHeightInTexels(copy_format);
+      const u32 bytes_per_row = TexDecoder_GetTextureSizeInBytes(EFB_WIDTH, block_height,
+                                                                 base_format);
+      const u32 num_blocks_y = EFB_HEIGHT / block_height;
+
+      bpmem.copyTexSrcWH.x = EFB_WIDTH - 1;
+      bpmem.copyTexSrcWH.y = EFB_HEIGHT - 1;
+      bpmem.triggerEFBCopy.half_scale = false;
+      bpmem.copyDestStride = bytes_per_row / 32;
+
+      const EFBCopyParams params(source.efb_format, copy_format, source.depth, false, false, false,
+                                 false);
+      const DT time = TimeRepeatedly([&] {
+        TextureEncoder::Encode(&dst, params, EFB_WIDTH, bytes_per_row, num_blocks_y, bytes_per_row,
+                               src_rect, false, 1.0f, 1.0f);
+      });
+      fmt::print("{:<8} {:<8} {:>10.2f}\n", source.name, fmt::format("{}", copy_format),
+                 GetGigabytesPerSecond(size_t{EFB_WIDTH} * EFB_HEIGHT * 4, time));
+    }
+  }
+}
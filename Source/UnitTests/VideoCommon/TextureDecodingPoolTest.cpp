@@ -0,0 +1,64 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecodingPool.h"
+
+namespace
+{
+struct DecodeParams
+{
+  TextureFormat format;
+  int width;
+  int height;
+};
+
+std::vector<u8> MakeRandomData(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::vector<u8> data(size);
+  std::ranges::generate(data, [&] { return static_cast<u8>(rng()); });
+  return data;
+}
+}  // namespace
+
+TEST(TextureDecodingPool, MatchesSingleThreadedDecode)
+{
+  VideoCommon::TextureDecodingPool pool(3);
+
+  // Big enough to be split up, with heights that don't divide evenly into bands
+  static constexpr DecodeParams params[] = {
+      {TextureFormat::I4, 512, 296},     {TextureFormat::I8, 512, 260},
+      {TextureFormat::IA4, 480, 264},    {TextureFormat::IA8, 512, 252},
+      {TextureFormat::RGB565, 512, 260}, {TextureFormat::RGB5A3, 300, 412},
+      {TextureFormat::RGBA8, 512, 268},  {TextureFormat::C4, 512, 296},
+      {TextureFormat::C8, 512, 268},     {TextureFormat::C14X2, 512, 252},
+      {TextureFormat::CMPR, 1024, 520},  {TextureFormat::RGBA8, 64, 64},
+  };
+
+  const std::vector<u8> tlut = MakeRandomData(TexDecoder_GetPaletteSize(TextureFormat::C14X2), 0);
+
+  u32 seed = 1;
+  for (const auto& [format, width, height] : params)
+  {
+    const std::vector<u8> src =
+        MakeRandomData(TexDecoder_GetTextureSizeInBytes(width, height, format), seed++);
+
+    std::vector<u8> expected(width * height * 4);
+    TexDecoder_Decode(expected.data(), src.data(), width, height, format, tlut.data(),
+                      TLUTFormat::RGB5A3);
+
+    std::vector<u8> decoded(width * height * 4);
+    pool.Decode(decoded.data(), src.data(), width, height, format, tlut.data(),
+                TLUTFormat::RGB5A3);
+
+    EXPECT_EQ(decoded, expected) << "format " << static_cast<int>(format);
+  }
+}
@@ -0,0 +1,265 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoader.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VideoConfig.h"
+
+// Runs representative vertex formats through the generic vertex loader and the host's JIT vertex
+// loader. The regular test checks that both produce the same vertices. The disabled benchmark
+// reports vertices per second for each loader, and fails if the JIT loader is slower than the
+// generic one. Run it with:
+//   tests --gtest_also_run_disabled_tests --gtest_filter=VertexLoaderBenchmark.*
+
+namespace
+{
+constexpr u32 ARRAY_STRIDE = 64;
+constexpr size_t ARRAY_SIZE = 0x10000 * ARRAY_STRIDE + ARRAY_STRIDE;
+
+struct VertexFormat
+{
+  const char* name;
+  std::function<void(TVtxDesc&, VAT&)> setup;
+};
+
+const std::array<VertexFormat, 5> VERTEX_FORMATS{{
+    {"indexed position",
+     [](TVtxDesc& desc, VAT& vat) {
+       desc.low.Position = VertexComponentFormat::Index16;
+       vat.g0.PosElements = CoordComponentCount::XYZ;
+       vat.g0.PosFormat = ComponentFormat::Float;
+     }},
+    {"normal with NBT",
+     [](TVtxDesc& desc, VAT& vat) {
+       desc.low.Position = VertexComponentFormat::Index16;
+       desc.low.Normal = VertexComponentFormat::Index16;
+       vat.g0.PosElements = CoordComponentCount::XYZ;
+       vat.g0.PosFormat = ComponentFormat::Float;
+       vat.g0.NormalElements = NormalComponentCount::NTB;
+       vat.g0.NormalFormat = ComponentFormat::Short;
+     }},
+    {"skinned direct",
+     [](TVtxDesc& desc, VAT& vat) {
+       desc.low.PosMatIdx = true;
+       desc.low.Position = VertexComponentFormat::Direct;
+       desc.low.Normal = VertexComponentFormat::Direct;
+       desc.low.Color0 = VertexComponentFormat::Direct;
+       desc.high.Tex0Coord = VertexComponentFormat::Direct;
+       vat.g0.PosElements = CoordComponentCount::XYZ;
+       vat.g0.PosFormat = ComponentFormat::Short;
+       vat.g0.PosFrac = 8;
+       vat.g0.NormalElements = NormalComponentCount::N;
+       vat.g0.NormalFormat = ComponentFormat::Byte;
+       vat.g0.Color0Elements = ColorComponentCount::RGBA;
+       vat.g0.Color0Comp = ColorFormat::RGBA8888;
+       vat.g0.Tex0CoordElements = TexComponentCount::ST;
+       vat.g0.Tex0CoordFormat = ComponentFormat::Short;
+       vat.g0.Tex0Frac = 10;
+     }},
+    {"multiple texcoords",
+     [](TVtxDesc& desc, VAT& vat) {
+       desc.low.Tex0MatIdx = true;
+       desc.low.Tex1MatIdx = true;
+       desc.low.Position = VertexComponentFormat::Index8;
+       desc.low.Color0 = VertexComponentFormat::Index8;
+       desc.high.Tex0Coord = VertexComponentFormat::Index16;
+       desc.high.Tex1Coord = VertexComponentFormat::Index16;
+       desc.high.Tex2Coord = VertexComponentFormat::Index16;
+       desc.high.Tex3Coord = VertexComponentFormat::Direct;
+       vat.g0.PosElements = CoordComponentCount::XYZ;
+       vat.g0.PosFormat = ComponentFormat::Float;
+       vat.g0.Color0Elements = ColorComponentCount::RGB;
+       vat.g0.Color0Comp = ColorFormat::RGB565;
+       vat.g0.Tex0CoordElements = TexComponentCount::ST;
+       vat.g0.Tex0CoordFormat = ComponentFormat::Float;
+       vat.g1.Tex1CoordElements = TexComponentCount::ST;
+       vat.g1.Tex1CoordFormat = ComponentFormat::Short;
+       vat.g1.Tex1Frac = 12;
+       vat.g1.Tex2CoordElements = TexComponentCount::ST;
+       vat.g1.Tex2CoordFormat = ComponentFormat::UShort;
+       vat.g1.Tex2Frac = 15;
+       vat.g1.Tex3CoordElements = TexComponentCount::ST;
+       vat.g1.Tex3CoordFormat = ComponentFormat::Byte;
+       vat.g1.Tex3Frac = 6;
+     }},
+    {"everything indexed",
+     [](TVtxDesc& desc, VAT& vat) {
+       desc.low.PosMatIdx = true;
+       desc.low.Position = VertexComponentFormat::Index16;
+       desc.low.Normal = VertexComponentFormat::Index16;
+       desc.low.Color0 = VertexComponentFormat::Index16;
+       desc.low.Color1 = VertexComponentFormat::Index16;
+       desc.high.Tex0Coord = VertexComponentFormat::Index16;
+       desc.high.Tex1Coord = VertexComponentFormat::Index16;
+       desc.high.Tex2Coord = VertexComponentFormat::Index16;
+       desc.high.Tex3Coord = VertexComponentFormat::Index16;
+       desc.high.Tex4Coord = VertexComponentFormat::Index16;
+       desc.high.Tex5Coord = VertexComponentFormat::Index16;
+       desc.high.Tex6Coord = VertexComponentFormat::Index16;
+       desc.high.Tex7Coord = VertexComponentFormat::Index16;
+       vat.g0.PosElements = CoordComponentCount::XYZ;
+       vat.g0.PosFormat = ComponentFormat::Float;
+       vat.g0.NormalElements = NormalComponentCount::NTB;
+       vat.g0.NormalFormat = ComponentFormat::Float;
+       vat.g0.Color0Elements = ColorComponentCount::RGBA;
+       vat.g0.Color0Comp = ColorFormat::RGBA8888;
+       vat.g0.Color1Elements = ColorComponentCount::RGBA;
+       vat.g0.Color1Comp = ColorFormat::RGBA6666;
+       vat.g0.Tex0CoordElements = TexComponentCount::ST;
+       vat.g0.Tex0CoordFormat = ComponentFormat::Float;
+       vat.g1.Tex1CoordElements = TexComponentCount::ST;
+       vat.g1.Tex1CoordFormat = ComponentFormat::Float;
+       vat.g1.Tex2CoordElements = TexComponentCount::ST;
+       vat.g1.Tex2CoordFormat = ComponentFormat::Float;
+       vat.g1.Tex3CoordElements = TexComponentCount::ST;
+       vat.g1.Tex3CoordFormat = ComponentFormat::Float;
+       vat.g1.Tex4CoordElements = TexComponentCount::ST;
+       vat.g1.Tex4CoordFormat = ComponentFormat::Float;
+       vat.g2.Tex5CoordElements = TexComponentCount::ST;
+       vat.g2.Tex5CoordFormat = ComponentFormat::Float;
+       vat.g2.Tex6CoordElements = TexComponentCount::ST;
+       vat.g2.Tex6CoordFormat = ComponentFormat::Float;
+       vat.g2.Tex7CoordElements = TexComponentCount::ST;
+       vat.g2.Tex7CoordFormat = ComponentFormat::Float;
+     }},
+}};
+
+std::vector<u8> MakeRandomData(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::vector<u8> data(size);
+  std::ranges::generate(data, [&] { return static_cast<u8>(rng()); });
+  return data;
+}
+
+class VertexLoaderBenchmark : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // Any 16-bit index stays within the arrays.
+    m_arrays = MakeRandomData(ARRAY_SIZE, 0);
+    for (int i = 0; i < NUM_VERTEX_COMPONENT_ARRAYS; i++)
+    {
+      VertexLoaderManager::cached_arraybases[static_cast<CPArray>(i)] = m_arrays.data();
+      g_main_cp_state.array_strides[static_cast<CPArray>(i)] = ARRAY_STRIDE;
+    }
+  }
+
+  struct Loaders
+  {
+    std::unique_ptr<VertexLoaderBase> generic;
+    std::unique_ptr<VertexLoaderBase> native;
+  };
+
+  static Loaders CreateLoaders(const VertexFormat& format)
+  {
+    TVtxDesc vtx_desc;
+    VAT vtx_attr;
+    format.setup(vtx_desc, vtx_attr);
+
+    Loaders loaders;
+    loaders.generic = std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
+
+    // Without a JIT for the host, CreateVertexLoader falls back to the generic loader.
+    const VertexLoaderType loader_type = g_ActiveConfig.vertex_loader_type;
+    g_ActiveConfig.vertex_loader_type = VertexLoaderType::Native;
+    loaders.native = VertexLoaderBase::CreateVertexLoader(vtx_desc, vtx_attr);
+    g_ActiveConfig.vertex_loader_type = loader_type;
+    if (dynamic_cast<VertexLoader*>(loaders.native.get()))
+      loaders.native.reset();
+    return loaders;
+  }
+
+  // Loads count vertices, starting from the same vertex caches every time.
+  static std::vector<u8> Run(VertexLoaderBase& loader, const std::vector<u8>& src, int count)
+  {
+    VertexLoaderManager::position_matrix_index_cache = {};
+    VertexLoaderManager::position_cache = {};
+    VertexLoaderManager::normal_cache = {};
+    VertexLoaderManager::tangent_cache = {};
+    VertexLoaderManager::binormal_cache = {};
+
+    std::vector<u8> dst(count * loader.m_native_vtx_decl.stride + 4);
+    EXPECT_EQ(loader.RunVertices(src.data(), dst.data(), count), count);
+    return dst;
+  }
+
+  std::vector<u8> m_arrays;
+};
+
+// Returns the number of vertices loader loads per second.
+double MeasureVerticesPerSecond(VertexLoaderBase& loader, const std::vector<u8>& src, int count)
+{
+  constexpr DT MIN_TIME = std::chrono::milliseconds(300);
+
+  std::vector<u8> dst(count * loader.m_native_vtx_decl.stride + 4);
+  u64 vertices = 0;
+  const TimePoint start = Clock::now();
+  DT elapsed{};
+  do
+  {
+    vertices += loader.RunVertices(src.data(), dst.data(), count);
+    elapsed = Clock::now() - start;
+  } while (elapsed < MIN_TIME);
+  return vertices / std::chrono::duration<double>(elapsed).count();
+}
+}  // namespace
+
+TEST_F(VertexLoaderBenchmark, NativeMatchesGeneric)
+{
+  constexpr int COUNT = 1000;
+
+  u32 seed = 1;
+  for (const VertexFormat& format : VERTEX_FORMATS)
+  {
+    Loaders loaders = CreateLoaders(format);
+    if (!loaders.native)
+      GTEST_SKIP() << "No JIT vertex loader on this host";
+
+    ASSERT_EQ(loaders.generic->m_vertex_size, loaders.native->m_vertex_size) << format.name;
+    ASSERT_EQ(loaders.generic->m_native_vtx_decl.stride, loaders.native->m_native_vtx_decl.stride)
+        << format.name;
+
+    const std::vector<u8> src = MakeRandomData(COUNT * loaders.generic->m_vertex_size, seed++);
+    const std::vector<u8> expected = Run(*loaders.generic, src, COUNT);
+    const std::vector<u8> actual = Run(*loaders.native, src, COUNT);
+    EXPECT_EQ(actual, expected) << format.name;
+  }
+}
+
+TEST_F(VertexLoaderBenchmark, DISABLED_Benchmark)
+{
+  constexpr int COUNT = 100000;
+
+  fmt::print("{:<20} {:>12} {:>12}\n", "Format", "Generic Mv/s", "JIT Mv/s");
+  u32 seed = 1;
+  for (const VertexFormat& format : VERTEX_FORMATS)
+  {
+    Loaders loaders = CreateLoaders(format);
+    const std::vector<u8> src = MakeRandomData(COUNT * loaders.generic->m_vertex_size, seed++);
+
+    const double generic = MeasureVerticesPerSecond(*loaders.generic, src, COUNT);
+    const double native =
+        loaders.native ? MeasureVerticesPerSecond(*loaders.native, src, COUNT) : 0.0;
+    fmt::print("{:<20} {:>12.2f} {:>12.2f}\n", format.name, generic / 1e6, native / 1e6);
+
+    if (loaders.native)
+      EXPECT_GT(native, generic) << "The JIT vertex loader is slower for " << format.name;
+  }
+}
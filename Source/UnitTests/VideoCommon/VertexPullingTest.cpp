@@ -0,0 +1,95 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexPulling.h"
+
+TEST(VertexPulling, StrideMatchesVertexSize)
+{
+  // Walk through a spread of descriptions and attribute formats.
+  for (u32 seed = 0; seed < 4096; seed++)
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = (seed * 0x9E3779B9u) & 0x1FFFF;
+    vtx_desc.high.Hex = (seed * 0x85EBCA6Bu) & 0xFFFF;
+    VAT vtx_attr;
+    vtx_attr.g0.Hex = seed * 0xC2B2AE35u;
+    vtx_attr.g1.Hex = seed * 0x27D4EB2Fu;
+    vtx_attr.g2.Hex = seed * 0x165667B1u;
+    // Invalid color formats are reported by the vertex loaders.
+    vtx_attr.g0.Color0Comp = static_cast<ColorFormat>(seed % 6);
+    vtx_attr.g0.Color1Comp = static_cast<ColorFormat>(seed / 6 % 6);
+
+    const VertexPulling::Layout layout = VertexPulling::GetLayout(vtx_desc, vtx_attr);
+    if (layout.supported)
+      EXPECT_EQ(layout.stride, VertexLoaderBase::GetVertexSize(vtx_desc, vtx_attr)) << seed;
+  }
+}
+
+TEST(VertexPulling, OffsetsFollowMatrixIndices)
+{
+  TVtxDesc vtx_desc;
+  vtx_desc.low.PosMatIdx = 1;
+  vtx_desc.low.Tex1MatIdx = 1;
+  vtx_desc.low.Position = VertexComponentFormat::Direct;
+  vtx_desc.low.Color0 = VertexComponentFormat::Index16;
+  vtx_desc.high.Tex0Coord = VertexComponentFormat::Index8;
+  VAT vtx_attr;
+  vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  vtx_attr.g0.PosFormat = ComponentFormat::Short;
+  vtx_attr.g0.PosFrac = 4;
+  vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Float;
+
+  const VertexPulling::Layout layout = VertexPulling::GetLayout(vtx_desc, vtx_attr);
+  ASSERT_TRUE(layout.supported);
+  EXPECT_EQ(layout.offsets[u32(CPArray::Position)], 2u);
+  EXPECT_EQ(layout.sizes[u32(CPArray::Position)], 6u);
+  EXPECT_EQ(layout.offsets[u32(CPArray::Color0)], 8u);
+  EXPECT_EQ(layout.sizes[u32(CPArray::Color0)], 4u);
+  EXPECT_EQ(layout.offsets[u32(CPArray::TexCoord0)], 10u);
+  EXPECT_EQ(layout.sizes[u32(CPArray::TexCoord0)], 8u);
+  EXPECT_EQ(layout.stride, 11u);
+  EXPECT_EQ(layout.indexed_arrays,
+            (1u << u32(CPArray::Color0)) | (1u << u32(CPArray::TexCoord0)));
+  EXPECT_EQ(layout.position_scale, 1.0f / 16);
+}
+
+TEST(VertexPulling, ArrayRanges)
+{
+  TVtxDesc vtx_desc;
+  vtx_desc.low.Position = VertexComponentFormat::Index16;
+  vtx_desc.low.Color0 = VertexComponentFormat::Index8;
+  VAT vtx_attr;
+  vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  vtx_attr.g0.Color0Comp = ColorFormat::RGB565;
+  const VertexPulling::Layout layout = VertexPulling::GetLayout(vtx_desc, vtx_attr);
+  ASSERT_EQ(layout.stride, 3u);
+
+  Common::EnumMap<u32, CPArray::XF_D> array_strides{};
+  array_strides[CPArray::Position] = 12;
+  array_strides[CPArray::Color0] = 2;
+
+  // Position indices are big-endian.
+  std::array<u8, 9> vertices = {0x01, 0x00, 7, 0x00, 0x10, 2, 0x00, 0x20, 5};
+  VertexPulling::ArrayRanges ranges;
+  ASSERT_TRUE(VertexPulling::GetArrayRanges(layout, vertices.data(), 3, array_strides, &ranges));
+  EXPECT_EQ(ranges.begin[u32(CPArray::Position)], 0x10u * 12);
+  EXPECT_EQ(ranges.end[u32(CPArray::Position)], 0x100u * 12 + 12);
+  EXPECT_EQ(ranges.begin[u32(CPArray::Color0)], 2u * 2);
+  EXPECT_EQ(ranges.end[u32(CPArray::Color0)], 7u * 2 + 2);
+
+  // The vertex loaders skip vertices with a position index of 0xFFFF.
+  vertices[3] = 0xFF;
+  vertices[4] = 0xFF;
+  EXPECT_FALSE(VertexPulling::GetArrayRanges(layout, vertices.data(), 3, array_strides, &ranges));
+}